@@ -19,7 +19,7 @@ int sendrequest(char * interface, char * ipadd, char * arpresp) {
     cprintf("Create ARP request for IP:%s over Interface:%s\n", ipadd, interface);
     
     // Test if the NIC is found/connected/loaded
-    nic * _nic;
+    nic _nic;
     // TODO
     if (getnicdevice(interface, &_nic) < 0) {
 	cprintf("ERROR: sendrequest : Device not loaded\n");
@@ -28,8 +28,8 @@ int sendrequest(char * interface, char * ipadd, char * arpresp) {
     
     // Create an ARP packet and send it across the NIC
     eth_head eth;
-    initframe(_nic->macaddr, ipadd, &eth);
-    _nic->sendpacket(_nic->drvr, (uint8_t *) &eth, sizeof(eth) - 2);	// Removing the padding
+    initframe(_nic.macaddr, ipadd, &eth);
+    _nic.sendpacket(_nic.drvr, (uint8_t *) &eth, sizeof(eth) - 2);	// Removing the padding
     
     // Initialize the ARP response and test if it exists
     eth_head resp;
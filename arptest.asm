@@ -0,0 +1,1211 @@
+
+_arptest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "types.h"
+#include "user.h"
+
+int main(void) {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 10             	sub    $0x10,%esp
+    int MACSIZE = 18;
+    char * ip = "192.168.2.1", * mac = malloc(MACSIZE);
+  11:	6a 12                	push   $0x12
+  13:	e8 88 06 00 00       	call   6a0 <malloc>
+    if (arp("mynet0", ip, mac, MACSIZE) < 0)
+  18:	6a 12                	push   $0x12
+  1a:	50                   	push   %eax
+  1b:	68 88 07 00 00       	push   $0x788
+  20:	68 94 07 00 00       	push   $0x794
+  25:	e8 0a 03 00 00       	call   334 <arp>
+  2a:	83 c4 20             	add    $0x20,%esp
+  2d:	85 c0                	test   %eax,%eax
+  2f:	78 05                	js     36 <main+0x36>
+	printf(1, "ARP for IP:%s Failed\n", ip);
+    exit();
+  31:	e8 5e 02 00 00       	call   294 <exit>
+	printf(1, "ARP for IP:%s Failed\n", ip);
+  36:	50                   	push   %eax
+  37:	68 88 07 00 00       	push   $0x788
+  3c:	68 9b 07 00 00       	push   $0x79b
+  41:	6a 01                	push   $0x1
+  43:	e8 18 04 00 00       	call   460 <printf>
+  48:	83 c4 10             	add    $0x10,%esp
+  4b:	eb e4                	jmp    31 <main+0x31>
+  4d:	66 90                	xchg   %ax,%ax
+  4f:	90                   	nop
+
+00000050 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  50:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  51:	31 c0                	xor    %eax,%eax
+{
+  53:	89 e5                	mov    %esp,%ebp
+  55:	53                   	push   %ebx
+  56:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  59:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  60:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  64:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  67:	83 c0 01             	add    $0x1,%eax
+  6a:	84 d2                	test   %dl,%dl
+  6c:	75 f2                	jne    60 <strcpy+0x10>
+    ;
+  return os;
+}
+  6e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  71:	89 c8                	mov    %ecx,%eax
+  73:	c9                   	leave
+  74:	c3                   	ret
+  75:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000080 <strlen>:
+
+uint
+strlen(char *s)
+{
+  80:	55                   	push   %ebp
+  81:	89 e5                	mov    %esp,%ebp
+  83:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  86:	80 3a 00             	cmpb   $0x0,(%edx)
+  89:	74 15                	je     a0 <strlen+0x20>
+  8b:	31 c0                	xor    %eax,%eax
+  8d:	8d 76 00             	lea    0x0(%esi),%esi
+  90:	83 c0 01             	add    $0x1,%eax
+  93:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  97:	89 c1                	mov    %eax,%ecx
+  99:	75 f5                	jne    90 <strlen+0x10>
+    ;
+  return n;
+}
+  9b:	89 c8                	mov    %ecx,%eax
+  9d:	5d                   	pop    %ebp
+  9e:	c3                   	ret
+  9f:	90                   	nop
+  for(n = 0; s[n]; n++)
+  a0:	31 c9                	xor    %ecx,%ecx
+}
+  a2:	5d                   	pop    %ebp
+  a3:	89 c8                	mov    %ecx,%eax
+  a5:	c3                   	ret
+  a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000000b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  b0:	55                   	push   %ebp
+  b1:	89 e5                	mov    %esp,%ebp
+  b3:	57                   	push   %edi
+  b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+  bd:	89 d7                	mov    %edx,%edi
+  bf:	fc                   	cld
+  c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  c5:	89 d0                	mov    %edx,%eax
+  c7:	c9                   	leave
+  c8:	c3                   	ret
+  c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000000d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  d0:	55                   	push   %ebp
+  d1:	89 e5                	mov    %esp,%ebp
+  d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+  da:	0f b6 10             	movzbl (%eax),%edx
+  dd:	84 d2                	test   %dl,%dl
+  df:	75 12                	jne    f3 <strchr+0x23>
+  e1:	eb 1d                	jmp    100 <strchr+0x30>
+  e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  e7:	90                   	nop
+  e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+  ec:	83 c0 01             	add    $0x1,%eax
+  ef:	84 d2                	test   %dl,%dl
+  f1:	74 0d                	je     100 <strchr+0x30>
+    if(*s == c)
+  f3:	38 d1                	cmp    %dl,%cl
+  f5:	75 f1                	jne    e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+  f7:	5d                   	pop    %ebp
+  f8:	c3                   	ret
+  f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 100:	31 c0                	xor    %eax,%eax
+}
+ 102:	5d                   	pop    %ebp
+ 103:	c3                   	ret
+ 104:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 10f:	90                   	nop
+
+00000110 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	57                   	push   %edi
+ 114:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 115:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 118:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 119:	31 db                	xor    %ebx,%ebx
+{
+ 11b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 11e:	eb 27                	jmp    147 <gets+0x37>
+    cc = read(0, &c, 1);
+ 120:	83 ec 04             	sub    $0x4,%esp
+ 123:	6a 01                	push   $0x1
+ 125:	56                   	push   %esi
+ 126:	6a 00                	push   $0x0
+ 128:	e8 7f 01 00 00       	call   2ac <read>
+    if(cc < 1)
+ 12d:	83 c4 10             	add    $0x10,%esp
+ 130:	85 c0                	test   %eax,%eax
+ 132:	7e 1d                	jle    151 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 134:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 138:	8b 55 08             	mov    0x8(%ebp),%edx
+ 13b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 13f:	3c 0a                	cmp    $0xa,%al
+ 141:	74 10                	je     153 <gets+0x43>
+ 143:	3c 0d                	cmp    $0xd,%al
+ 145:	74 0c                	je     153 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 147:	89 df                	mov    %ebx,%edi
+ 149:	83 c3 01             	add    $0x1,%ebx
+ 14c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 14f:	7c cf                	jl     120 <gets+0x10>
+ 151:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 153:	8b 45 08             	mov    0x8(%ebp),%eax
+ 156:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 15a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 15d:	5b                   	pop    %ebx
+ 15e:	5e                   	pop    %esi
+ 15f:	5f                   	pop    %edi
+ 160:	5d                   	pop    %ebp
+ 161:	c3                   	ret
+ 162:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000170 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 170:	55                   	push   %ebp
+ 171:	89 e5                	mov    %esp,%ebp
+ 173:	56                   	push   %esi
+ 174:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 175:	83 ec 08             	sub    $0x8,%esp
+ 178:	6a 00                	push   $0x0
+ 17a:	ff 75 08             	push   0x8(%ebp)
+ 17d:	e8 52 01 00 00       	call   2d4 <open>
+  if(fd < 0)
+ 182:	83 c4 10             	add    $0x10,%esp
+ 185:	85 c0                	test   %eax,%eax
+ 187:	78 27                	js     1b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 189:	83 ec 08             	sub    $0x8,%esp
+ 18c:	ff 75 0c             	push   0xc(%ebp)
+ 18f:	89 c3                	mov    %eax,%ebx
+ 191:	50                   	push   %eax
+ 192:	e8 55 01 00 00       	call   2ec <fstat>
+  close(fd);
+ 197:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 19a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 19c:	e8 1b 01 00 00       	call   2bc <close>
+  return r;
+ 1a1:	83 c4 10             	add    $0x10,%esp
+}
+ 1a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1a7:	89 f0                	mov    %esi,%eax
+ 1a9:	5b                   	pop    %ebx
+ 1aa:	5e                   	pop    %esi
+ 1ab:	5d                   	pop    %ebp
+ 1ac:	c3                   	ret
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 1b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1b5:	eb ed                	jmp    1a4 <stat+0x34>
+ 1b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1be:	66 90                	xchg   %ax,%ax
+
+000001c0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	57                   	push   %edi
+ 1c4:	56                   	push   %esi
+ 1c5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 1ce:	85 c0                	test   %eax,%eax
+ 1d0:	7e 13                	jle    1e5 <memmove+0x25>
+ 1d2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 1d4:	89 d7                	mov    %edx,%edi
+ 1d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1dd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 1e0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 1e1:	39 f8                	cmp    %edi,%eax
+ 1e3:	75 fb                	jne    1e0 <memmove+0x20>
+  return vdst;
+}
+ 1e5:	5e                   	pop    %esi
+ 1e6:	89 d0                	mov    %edx,%eax
+ 1e8:	5f                   	pop    %edi
+ 1e9:	5d                   	pop    %ebp
+ 1ea:	c3                   	ret
+ 1eb:	66 90                	xchg   %ax,%ax
+ 1ed:	66 90                	xchg   %ax,%ax
+ 1ef:	90                   	nop
+
+000001f0 <strcmp>:
+#include "types.h"
+#include "util.h"
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	53                   	push   %ebx
+ 1f4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1fa:	0f b6 02             	movzbl (%edx),%eax
+ 1fd:	84 c0                	test   %al,%al
+ 1ff:	75 17                	jne    218 <strcmp+0x28>
+ 201:	eb 3a                	jmp    23d <strcmp+0x4d>
+ 203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 207:	90                   	nop
+ 208:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 20c:	83 c2 01             	add    $0x1,%edx
+ 20f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 212:	84 c0                	test   %al,%al
+ 214:	74 1a                	je     230 <strcmp+0x40>
+    p++, q++;
+ 216:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 218:	0f b6 19             	movzbl (%ecx),%ebx
+ 21b:	38 c3                	cmp    %al,%bl
+ 21d:	74 e9                	je     208 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 21f:	29 d8                	sub    %ebx,%eax
+}
+ 221:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 224:	c9                   	leave
+ 225:	c3                   	ret
+ 226:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 230:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 234:	31 c0                	xor    %eax,%eax
+ 236:	29 d8                	sub    %ebx,%eax
+}
+ 238:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 23b:	c9                   	leave
+ 23c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 23d:	0f b6 19             	movzbl (%ecx),%ebx
+ 240:	31 c0                	xor    %eax,%eax
+ 242:	eb db                	jmp    21f <strcmp+0x2f>
+ 244:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 24f:	90                   	nop
+
+00000250 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	53                   	push   %ebx
+ 254:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 257:	0f be 02             	movsbl (%edx),%eax
+ 25a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 25d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 260:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 265:	77 1e                	ja     285 <atoi+0x35>
+ 267:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 270:	83 c2 01             	add    $0x1,%edx
+ 273:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 276:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 27a:	0f be 02             	movsbl (%edx),%eax
+ 27d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 280:	80 fb 09             	cmp    $0x9,%bl
+ 283:	76 eb                	jbe    270 <atoi+0x20>
+  return n;
+ 285:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 288:	89 c8                	mov    %ecx,%eax
+ 28a:	c9                   	leave
+ 28b:	c3                   	ret
+
+0000028c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 28c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 291:	cd 40                	int    $0x40
+ 293:	c3                   	ret
+
+00000294 <exit>:
+SYSCALL(exit)
+ 294:	b8 02 00 00 00       	mov    $0x2,%eax
+ 299:	cd 40                	int    $0x40
+ 29b:	c3                   	ret
+
+0000029c <wait>:
+SYSCALL(wait)
+ 29c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2a1:	cd 40                	int    $0x40
+ 2a3:	c3                   	ret
+
+000002a4 <pipe>:
+SYSCALL(pipe)
+ 2a4:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2a9:	cd 40                	int    $0x40
+ 2ab:	c3                   	ret
+
+000002ac <read>:
+SYSCALL(read)
+ 2ac:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2b1:	cd 40                	int    $0x40
+ 2b3:	c3                   	ret
+
+000002b4 <write>:
+SYSCALL(write)
+ 2b4:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2b9:	cd 40                	int    $0x40
+ 2bb:	c3                   	ret
+
+000002bc <close>:
+SYSCALL(close)
+ 2bc:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2c1:	cd 40                	int    $0x40
+ 2c3:	c3                   	ret
+
+000002c4 <kill>:
+SYSCALL(kill)
+ 2c4:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2c9:	cd 40                	int    $0x40
+ 2cb:	c3                   	ret
+
+000002cc <exec>:
+SYSCALL(exec)
+ 2cc:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2d1:	cd 40                	int    $0x40
+ 2d3:	c3                   	ret
+
+000002d4 <open>:
+SYSCALL(open)
+ 2d4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2d9:	cd 40                	int    $0x40
+ 2db:	c3                   	ret
+
+000002dc <mknod>:
+SYSCALL(mknod)
+ 2dc:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2e1:	cd 40                	int    $0x40
+ 2e3:	c3                   	ret
+
+000002e4 <unlink>:
+SYSCALL(unlink)
+ 2e4:	b8 12 00 00 00       	mov    $0x12,%eax
+ 2e9:	cd 40                	int    $0x40
+ 2eb:	c3                   	ret
+
+000002ec <fstat>:
+SYSCALL(fstat)
+ 2ec:	b8 08 00 00 00       	mov    $0x8,%eax
+ 2f1:	cd 40                	int    $0x40
+ 2f3:	c3                   	ret
+
+000002f4 <link>:
+SYSCALL(link)
+ 2f4:	b8 13 00 00 00       	mov    $0x13,%eax
+ 2f9:	cd 40                	int    $0x40
+ 2fb:	c3                   	ret
+
+000002fc <mkdir>:
+SYSCALL(mkdir)
+ 2fc:	b8 14 00 00 00       	mov    $0x14,%eax
+ 301:	cd 40                	int    $0x40
+ 303:	c3                   	ret
+
+00000304 <chdir>:
+SYSCALL(chdir)
+ 304:	b8 09 00 00 00       	mov    $0x9,%eax
+ 309:	cd 40                	int    $0x40
+ 30b:	c3                   	ret
+
+0000030c <dup>:
+SYSCALL(dup)
+ 30c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 311:	cd 40                	int    $0x40
+ 313:	c3                   	ret
+
+00000314 <getpid>:
+SYSCALL(getpid)
+ 314:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 319:	cd 40                	int    $0x40
+ 31b:	c3                   	ret
+
+0000031c <sbrk>:
+SYSCALL(sbrk)
+ 31c:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 321:	cd 40                	int    $0x40
+ 323:	c3                   	ret
+
+00000324 <sleep>:
+SYSCALL(sleep)
+ 324:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 329:	cd 40                	int    $0x40
+ 32b:	c3                   	ret
+
+0000032c <uptime>:
+SYSCALL(uptime)
+ 32c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 331:	cd 40                	int    $0x40
+ 333:	c3                   	ret
+
+00000334 <arp>:
+SYSCALL(arp)
+ 334:	b8 16 00 00 00       	mov    $0x16,%eax
+ 339:	cd 40                	int    $0x40
+ 33b:	c3                   	ret
+
+0000033c <mmap>:
+SYSCALL(mmap)
+ 33c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 341:	cd 40                	int    $0x40
+ 343:	c3                   	ret
+
+00000344 <munmap>:
+SYSCALL(munmap)
+ 344:	b8 18 00 00 00       	mov    $0x18,%eax
+ 349:	cd 40                	int    $0x40
+ 34b:	c3                   	ret
+
+0000034c <msync>:
+SYSCALL(msync)
+ 34c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 351:	cd 40                	int    $0x40
+ 353:	c3                   	ret
+
+00000354 <shmcreate>:
+SYSCALL(shmcreate)
+ 354:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 359:	cd 40                	int    $0x40
+ 35b:	c3                   	ret
+
+0000035c <shmattach>:
+SYSCALL(shmattach)
+ 35c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 361:	cd 40                	int    $0x40
+ 363:	c3                   	ret
+
+00000364 <shmdetach>:
+SYSCALL(shmdetach)
+ 364:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 369:	cd 40                	int    $0x40
+ 36b:	c3                   	ret
+
+0000036c <futex_wait>:
+SYSCALL(futex_wait)
+ 36c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 371:	cd 40                	int    $0x40
+ 373:	c3                   	ret
+
+00000374 <futex_wake>:
+SYSCALL(futex_wake)
+ 374:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 379:	cd 40                	int    $0x40
+ 37b:	c3                   	ret
+
+0000037c <nice>:
+SYSCALL(nice)
+ 37c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 381:	cd 40                	int    $0x40
+ 383:	c3                   	ret
+
+00000384 <setpriority>:
+SYSCALL(setpriority)
+ 384:	b8 20 00 00 00       	mov    $0x20,%eax
+ 389:	cd 40                	int    $0x40
+ 38b:	c3                   	ret
+
+0000038c <cputime>:
+SYSCALL(cputime)
+ 38c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 391:	cd 40                	int    $0x40
+ 393:	c3                   	ret
+
+00000394 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 394:	b8 22 00 00 00       	mov    $0x22,%eax
+ 399:	cd 40                	int    $0x40
+ 39b:	c3                   	ret
+
+0000039c <clone>:
+SYSCALL(clone)
+ 39c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3a1:	cd 40                	int    $0x40
+ 3a3:	c3                   	ret
+
+000003a4 <join>:
+SYSCALL(join)
+ 3a4:	b8 24 00 00 00       	mov    $0x24,%eax
+ 3a9:	cd 40                	int    $0x40
+ 3ab:	c3                   	ret
+
+000003ac <lockstat>:
+SYSCALL(lockstat)
+ 3ac:	b8 25 00 00 00       	mov    $0x25,%eax
+ 3b1:	cd 40                	int    $0x40
+ 3b3:	c3                   	ret
+ 3b4:	66 90                	xchg   %ax,%ax
+ 3b6:	66 90                	xchg   %ax,%ax
+ 3b8:	66 90                	xchg   %ax,%ax
+ 3ba:	66 90                	xchg   %ax,%ax
+ 3bc:	66 90                	xchg   %ax,%ax
+ 3be:	66 90                	xchg   %ax,%ax
+
+000003c0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	57                   	push   %edi
+ 3c4:	56                   	push   %esi
+ 3c5:	53                   	push   %ebx
+ 3c6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 3c8:	89 d1                	mov    %edx,%ecx
+{
+ 3ca:	83 ec 3c             	sub    $0x3c,%esp
+ 3cd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 3d0:	85 d2                	test   %edx,%edx
+ 3d2:	0f 89 80 00 00 00    	jns    458 <printint+0x98>
+ 3d8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 3dc:	74 7a                	je     458 <printint+0x98>
+    x = -xx;
+ 3de:	f7 d9                	neg    %ecx
+    neg = 1;
+ 3e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 3e5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 3e8:	31 f6                	xor    %esi,%esi
+ 3ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 3f0:	89 c8                	mov    %ecx,%eax
+ 3f2:	31 d2                	xor    %edx,%edx
+ 3f4:	89 f7                	mov    %esi,%edi
+ 3f6:	f7 f3                	div    %ebx
+ 3f8:	8d 76 01             	lea    0x1(%esi),%esi
+ 3fb:	0f b6 92 10 08 00 00 	movzbl 0x810(%edx),%edx
+ 402:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 406:	89 ca                	mov    %ecx,%edx
+ 408:	89 c1                	mov    %eax,%ecx
+ 40a:	39 da                	cmp    %ebx,%edx
+ 40c:	73 e2                	jae    3f0 <printint+0x30>
+  if(neg)
+ 40e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 411:	85 c0                	test   %eax,%eax
+ 413:	74 07                	je     41c <printint+0x5c>
+    buf[i++] = '-';
+ 415:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 41a:	89 f7                	mov    %esi,%edi
+ 41c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 41f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 422:	01 df                	add    %ebx,%edi
+ 424:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 428:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 42b:	83 ec 04             	sub    $0x4,%esp
+ 42e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 431:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 434:	6a 01                	push   $0x1
+ 436:	50                   	push   %eax
+ 437:	56                   	push   %esi
+ 438:	e8 77 fe ff ff       	call   2b4 <write>
+  while(--i >= 0)
+ 43d:	89 f8                	mov    %edi,%eax
+ 43f:	83 c4 10             	add    $0x10,%esp
+ 442:	83 ef 01             	sub    $0x1,%edi
+ 445:	39 d8                	cmp    %ebx,%eax
+ 447:	75 df                	jne    428 <printint+0x68>
+}
+ 449:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 44c:	5b                   	pop    %ebx
+ 44d:	5e                   	pop    %esi
+ 44e:	5f                   	pop    %edi
+ 44f:	5d                   	pop    %ebp
+ 450:	c3                   	ret
+ 451:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 458:	31 c0                	xor    %eax,%eax
+ 45a:	eb 89                	jmp    3e5 <printint+0x25>
+ 45c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000460 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+ 465:	53                   	push   %ebx
+ 466:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 469:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 46c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 46f:	0f b6 1e             	movzbl (%esi),%ebx
+ 472:	83 c6 01             	add    $0x1,%esi
+ 475:	84 db                	test   %bl,%bl
+ 477:	74 67                	je     4e0 <printf+0x80>
+ 479:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 47c:	31 d2                	xor    %edx,%edx
+ 47e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 481:	eb 34                	jmp    4b7 <printf+0x57>
+ 483:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 487:	90                   	nop
+ 488:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 48b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 490:	83 f8 25             	cmp    $0x25,%eax
+ 493:	74 18                	je     4ad <printf+0x4d>
+  write(fd, &c, 1);
+ 495:	83 ec 04             	sub    $0x4,%esp
+ 498:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 49b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 49e:	6a 01                	push   $0x1
+ 4a0:	50                   	push   %eax
+ 4a1:	57                   	push   %edi
+ 4a2:	e8 0d fe ff ff       	call   2b4 <write>
+ 4a7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 4aa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 4ad:	0f b6 1e             	movzbl (%esi),%ebx
+ 4b0:	83 c6 01             	add    $0x1,%esi
+ 4b3:	84 db                	test   %bl,%bl
+ 4b5:	74 29                	je     4e0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 4b7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 4ba:	85 d2                	test   %edx,%edx
+ 4bc:	74 ca                	je     488 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 4be:	83 fa 25             	cmp    $0x25,%edx
+ 4c1:	75 ea                	jne    4ad <printf+0x4d>
+      if(c == 'd'){
+ 4c3:	83 f8 25             	cmp    $0x25,%eax
+ 4c6:	0f 84 24 01 00 00    	je     5f0 <printf+0x190>
+ 4cc:	83 e8 63             	sub    $0x63,%eax
+ 4cf:	83 f8 15             	cmp    $0x15,%eax
+ 4d2:	77 1c                	ja     4f0 <printf+0x90>
+ 4d4:	ff 24 85 b8 07 00 00 	jmp    *0x7b8(,%eax,4)
+ 4db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4df:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 4e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4e3:	5b                   	pop    %ebx
+ 4e4:	5e                   	pop    %esi
+ 4e5:	5f                   	pop    %edi
+ 4e6:	5d                   	pop    %ebp
+ 4e7:	c3                   	ret
+ 4e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ef:	90                   	nop
+  write(fd, &c, 1);
+ 4f0:	83 ec 04             	sub    $0x4,%esp
+ 4f3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 4f6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 4fa:	6a 01                	push   $0x1
+ 4fc:	52                   	push   %edx
+ 4fd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 500:	57                   	push   %edi
+ 501:	e8 ae fd ff ff       	call   2b4 <write>
+ 506:	83 c4 0c             	add    $0xc,%esp
+ 509:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 50c:	6a 01                	push   $0x1
+ 50e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 511:	52                   	push   %edx
+ 512:	57                   	push   %edi
+ 513:	e8 9c fd ff ff       	call   2b4 <write>
+        putc(fd, c);
+ 518:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 51b:	31 d2                	xor    %edx,%edx
+ 51d:	eb 8e                	jmp    4ad <printf+0x4d>
+ 51f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 520:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 523:	83 ec 0c             	sub    $0xc,%esp
+ 526:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 52b:	8b 13                	mov    (%ebx),%edx
+ 52d:	6a 00                	push   $0x0
+ 52f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 531:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 534:	e8 87 fe ff ff       	call   3c0 <printint>
+        ap++;
+ 539:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 53c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 53f:	31 d2                	xor    %edx,%edx
+ 541:	e9 67 ff ff ff       	jmp    4ad <printf+0x4d>
+ 546:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 54d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 550:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 553:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 555:	83 c0 04             	add    $0x4,%eax
+ 558:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 55b:	85 db                	test   %ebx,%ebx
+ 55d:	0f 84 9d 00 00 00    	je     600 <printf+0x1a0>
+        while(*s != 0){
+ 563:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 566:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 568:	84 c0                	test   %al,%al
+ 56a:	0f 84 3d ff ff ff    	je     4ad <printf+0x4d>
+ 570:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 573:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 576:	89 de                	mov    %ebx,%esi
+ 578:	89 d3                	mov    %edx,%ebx
+ 57a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 580:	83 ec 04             	sub    $0x4,%esp
+ 583:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 586:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 589:	6a 01                	push   $0x1
+ 58b:	53                   	push   %ebx
+ 58c:	57                   	push   %edi
+ 58d:	e8 22 fd ff ff       	call   2b4 <write>
+        while(*s != 0){
+ 592:	0f b6 06             	movzbl (%esi),%eax
+ 595:	83 c4 10             	add    $0x10,%esp
+ 598:	84 c0                	test   %al,%al
+ 59a:	75 e4                	jne    580 <printf+0x120>
+      state = 0;
+ 59c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 59f:	31 d2                	xor    %edx,%edx
+ 5a1:	e9 07 ff ff ff       	jmp    4ad <printf+0x4d>
+ 5a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ad:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 5b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5b3:	83 ec 0c             	sub    $0xc,%esp
+ 5b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5bb:	8b 13                	mov    (%ebx),%edx
+ 5bd:	6a 01                	push   $0x1
+ 5bf:	e9 6b ff ff ff       	jmp    52f <printf+0xcf>
+ 5c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 5c8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 5cb:	83 ec 04             	sub    $0x4,%esp
+ 5ce:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 5d1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 5d3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 5d6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5d9:	6a 01                	push   $0x1
+ 5db:	52                   	push   %edx
+ 5dc:	57                   	push   %edi
+ 5dd:	e8 d2 fc ff ff       	call   2b4 <write>
+        ap++;
+ 5e2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 5e5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5e8:	31 d2                	xor    %edx,%edx
+ 5ea:	e9 be fe ff ff       	jmp    4ad <printf+0x4d>
+ 5ef:	90                   	nop
+  write(fd, &c, 1);
+ 5f0:	83 ec 04             	sub    $0x4,%esp
+ 5f3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5f6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5f9:	6a 01                	push   $0x1
+ 5fb:	e9 11 ff ff ff       	jmp    511 <printf+0xb1>
+ 600:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 605:	bb b1 07 00 00       	mov    $0x7b1,%ebx
+ 60a:	e9 61 ff ff ff       	jmp    570 <printf+0x110>
+ 60f:	90                   	nop
+
+00000610 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 610:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 611:	a1 ac 0a 00 00       	mov    0xaac,%eax
+{
+ 616:	89 e5                	mov    %esp,%ebp
+ 618:	57                   	push   %edi
+ 619:	56                   	push   %esi
+ 61a:	53                   	push   %ebx
+ 61b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 61e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 621:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 628:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 62a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 62c:	39 ca                	cmp    %ecx,%edx
+ 62e:	73 30                	jae    660 <free+0x50>
+ 630:	39 c1                	cmp    %eax,%ecx
+ 632:	72 04                	jb     638 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 634:	39 c2                	cmp    %eax,%edx
+ 636:	72 f0                	jb     628 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 638:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 63b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 63e:	39 f8                	cmp    %edi,%eax
+ 640:	74 2e                	je     670 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 642:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 645:	8b 42 04             	mov    0x4(%edx),%eax
+ 648:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 64b:	39 f1                	cmp    %esi,%ecx
+ 64d:	74 38                	je     687 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 64f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 651:	5b                   	pop    %ebx
+  freep = p;
+ 652:	89 15 ac 0a 00 00    	mov    %edx,0xaac
+}
+ 658:	5e                   	pop    %esi
+ 659:	5f                   	pop    %edi
+ 65a:	5d                   	pop    %ebp
+ 65b:	c3                   	ret
+ 65c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 660:	39 c1                	cmp    %eax,%ecx
+ 662:	72 d0                	jb     634 <free+0x24>
+ 664:	eb c2                	jmp    628 <free+0x18>
+ 666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 66d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 670:	03 70 04             	add    0x4(%eax),%esi
+ 673:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 676:	8b 02                	mov    (%edx),%eax
+ 678:	8b 00                	mov    (%eax),%eax
+ 67a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 67d:	8b 42 04             	mov    0x4(%edx),%eax
+ 680:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 683:	39 f1                	cmp    %esi,%ecx
+ 685:	75 c8                	jne    64f <free+0x3f>
+    p->s.size += bp->s.size;
+ 687:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 68a:	89 15 ac 0a 00 00    	mov    %edx,0xaac
+    p->s.size += bp->s.size;
+ 690:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 693:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 696:	89 0a                	mov    %ecx,(%edx)
+}
+ 698:	5b                   	pop    %ebx
+ 699:	5e                   	pop    %esi
+ 69a:	5f                   	pop    %edi
+ 69b:	5d                   	pop    %ebp
+ 69c:	c3                   	ret
+ 69d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006a0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 6a0:	55                   	push   %ebp
+ 6a1:	89 e5                	mov    %esp,%ebp
+ 6a3:	57                   	push   %edi
+ 6a4:	56                   	push   %esi
+ 6a5:	53                   	push   %ebx
+ 6a6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 6ac:	8b 15 ac 0a 00 00    	mov    0xaac,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6b2:	8d 78 07             	lea    0x7(%eax),%edi
+ 6b5:	c1 ef 03             	shr    $0x3,%edi
+ 6b8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 6bb:	85 d2                	test   %edx,%edx
+ 6bd:	0f 84 8d 00 00 00    	je     750 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6c3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6c5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6c8:	39 f9                	cmp    %edi,%ecx
+ 6ca:	73 64                	jae    730 <malloc+0x90>
+  if(nu < 4096)
+ 6cc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 6d1:	39 df                	cmp    %ebx,%edi
+ 6d3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 6d6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 6dd:	eb 0a                	jmp    6e9 <malloc+0x49>
+ 6df:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6e0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6e2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6e5:	39 f9                	cmp    %edi,%ecx
+ 6e7:	73 47                	jae    730 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 6e9:	89 c2                	mov    %eax,%edx
+ 6eb:	39 05 ac 0a 00 00    	cmp    %eax,0xaac
+ 6f1:	75 ed                	jne    6e0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 6f3:	83 ec 0c             	sub    $0xc,%esp
+ 6f6:	56                   	push   %esi
+ 6f7:	e8 20 fc ff ff       	call   31c <sbrk>
+  if(p == (char*)-1)
+ 6fc:	83 c4 10             	add    $0x10,%esp
+ 6ff:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 702:	74 1c                	je     720 <malloc+0x80>
+  hp->s.size = nu;
+ 704:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 707:	83 ec 0c             	sub    $0xc,%esp
+ 70a:	83 c0 08             	add    $0x8,%eax
+ 70d:	50                   	push   %eax
+ 70e:	e8 fd fe ff ff       	call   610 <free>
+  return freep;
+ 713:	8b 15 ac 0a 00 00    	mov    0xaac,%edx
+      if((p = morecore(nunits)) == 0)
+ 719:	83 c4 10             	add    $0x10,%esp
+ 71c:	85 d2                	test   %edx,%edx
+ 71e:	75 c0                	jne    6e0 <malloc+0x40>
+        return 0;
+  }
+}
+ 720:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 723:	31 c0                	xor    %eax,%eax
+}
+ 725:	5b                   	pop    %ebx
+ 726:	5e                   	pop    %esi
+ 727:	5f                   	pop    %edi
+ 728:	5d                   	pop    %ebp
+ 729:	c3                   	ret
+ 72a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 730:	39 cf                	cmp    %ecx,%edi
+ 732:	74 4c                	je     780 <malloc+0xe0>
+        p->s.size -= nunits;
+ 734:	29 f9                	sub    %edi,%ecx
+ 736:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 739:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 73c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 73f:	89 15 ac 0a 00 00    	mov    %edx,0xaac
+}
+ 745:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 748:	83 c0 08             	add    $0x8,%eax
+}
+ 74b:	5b                   	pop    %ebx
+ 74c:	5e                   	pop    %esi
+ 74d:	5f                   	pop    %edi
+ 74e:	5d                   	pop    %ebp
+ 74f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 750:	c7 05 ac 0a 00 00 b0 	movl   $0xab0,0xaac
+ 757:	0a 00 00 
+    base.s.size = 0;
+ 75a:	b8 b0 0a 00 00       	mov    $0xab0,%eax
+    base.s.ptr = freep = prevp = &base;
+ 75f:	c7 05 b0 0a 00 00 b0 	movl   $0xab0,0xab0
+ 766:	0a 00 00 
+    base.s.size = 0;
+ 769:	c7 05 b4 0a 00 00 00 	movl   $0x0,0xab4
+ 770:	00 00 00 
+    if(p->s.size >= nunits){
+ 773:	e9 54 ff ff ff       	jmp    6cc <malloc+0x2c>
+ 778:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 77f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 780:	8b 08                	mov    (%eax),%ecx
+ 782:	89 0a                	mov    %ecx,(%edx)
+ 784:	eb b9                	jmp    73f <malloc+0x9f>
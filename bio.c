@@ -1,6 +1,6 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
+// The buffer cache is a hash table of buf structures holding
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
@@ -17,94 +17,307 @@
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+//
+// Each buffer sits in the hash bucket of its (dev, blockno), and
+// each bucket has a lock of its own that protects the bucket's
+// chain, the refcnt of its buffers and a list of its unused
+// buffers, least recently released first.  Finding a cached
+// block and releasing it touch only one bucket.  A miss looks
+// at the oldest unused buffer of a few buckets, starting where
+// the last miss stopped, and recycles the oldest of those.  It
+// holds one bucket lock at a time: the victim's while taking it
+// out, then the block's while putting it in.
+//
+// binit() sizes the cache by the amount of free memory.
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
 
-struct {
+#define BHASH(dev, blockno) (((dev)*31 + (blockno)) % NBUCKET)
+#define NVICTIM 8   // buckets a miss compares
+
+struct bucket {
   struct spinlock lock;
-  struct buf buf[NBUF];
+  struct buf *head;   // buffers of this bucket, through next
+  struct buf *lru;    // unused buffers, oldest first, through lnext
+  struct buf *mru;    // newest unused buffer
+};
 
-  // Linked list of all buffers, through prev/next.
-  // head.next is most recently used.
-  struct buf head;
+struct {
+  struct bucket bucket[NBUCKET];
+  uint nbuf;
+  uint clock;             // counts releases, for lastuse
+  uint hand;              // bucket where the next miss starts
 } bcache;
 
+// Append b to k's list of unused buffers.
+// Caller must hold k->lock.
+static void
+lruput(struct bucket *k, struct buf *b)
+{
+  b->lnext = 0;
+  b->lprev = k->mru;
+  if(k->mru)
+    k->mru->lnext = b;
+  else
+    k->lru = b;
+  k->mru = b;
+}
+
+// Take b off k's list of unused buffers.
+// Caller must hold k->lock.
+static void
+lrutake(struct bucket *k, struct buf *b)
+{
+  if(b->lprev)
+    b->lprev->lnext = b->lnext;
+  else
+    k->lru = b->lnext;
+  if(b->lnext)
+    b->lnext->lprev = b->lprev;
+  else
+    k->mru = b->lprev;
+}
+
 void
 binit(void)
 {
+  struct bucket *k;
   struct buf *b;
+  char *hdr, *data;
+  uint i, n, nh, nd;
 
-  initlock(&bcache.lock, "bcache");
+  for(k = bcache.bucket; k < &bcache.bucket[NBUCKET]; k++)
+    initlock(&k->lock, "bcache.bucket");
 
 //PAGEBREAK!
-  // Create linked list of buffers
-  bcache.head.prev = &bcache.head;
-  bcache.head.next = &bcache.head;
-  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
+  // Use about a thirty-second of free memory for block data.
+  n = kfreecount() / 32 * (PGSIZE / BSIZE);
+  if(n < NBUF)
+    n = NBUF;
+  if(n > NBUFMAX)
+    n = NBUFMAX;
+
+  // Carve buffers and their data out of whole pages.  They start
+  // unused and spread over the buckets, with a blockno that no
+  // disk has.
+  nh = nd = 0;
+  hdr = data = 0;
+  for(i = 0; i < n; i++){
+    if(nh == 0 && (hdr = kalloc()) != 0)
+      nh = PGSIZE / sizeof(struct buf);
+    if(nd == 0 && (data = kalloc()) != 0)
+      nd = PGSIZE / BSIZE;
+    if(nh == 0 || nd == 0)
+      break;
+    b = (struct buf*)hdr + --nh;
+    b->data = (uchar*)data + --nd * BSIZE;
+    b->dev = -1;
+    b->blockno = -1;
+    b->flags = 0;
+    b->refcnt = 0;
+    b->lastuse = 0;
     initsleeplock(&b->lock, "buffer");
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+    k = &bcache.bucket[i % NBUCKET];
+    b->next = k->head;
+    k->head = b;
+    lruput(k, b);
   }
+  if(i < NBUF)
+    panic("binit: out of memory");
+  bcache.nbuf = i;
+  cprintf("bcache: %d buffers\n", i);
 }
 
-// Look through buffer cache for block on device dev.
-// If not found, allocate a buffer.
-// In either case, return locked buffer.
+// Look for the cached block in bucket k and take a reference
+// to it, without locking its buffer.
+// Caller must hold k->lock.
 static struct buf*
-bget(uint dev, uint blockno)
+blookup(struct bucket *k, uint dev, uint blockno)
 {
   struct buf *b;
 
-  acquire(&bcache.lock);
-
-  // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
+  for(b = k->head; b; b = b->next){
     if(b->dev == dev && b->blockno == blockno){
-      b->refcnt++;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
+      if(b->refcnt++ == 0)
+        lrutake(k, b);
+      break;
     }
   }
+  return b;
+}
+
+// Return the oldest unused buffer in k that can be recycled,
+// or 0.  Caller must hold k->lock.
+static struct buf*
+boldest(struct bucket *k)
+{
+  struct buf *b;
 
-  // Not cached; recycle an unused buffer.
   // Even if refcnt==0, B_DIRTY indicates a buffer is in use
   // because log.c has modified it but not yet committed it.
-  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
-      b->dev = dev;
-      b->blockno = blockno;
-      b->flags = 0;
+  for(b = k->lru; b; b = b->lnext)
+    if((b->flags & B_DIRTY) == 0)
+      return b;
+  return 0;
+}
+
+// Find an unused buffer released long ago, and take it out of
+// its bucket with a reference.  Looks at the oldest buffers
+// of NVICTIM buckets that have any, without locking them, then
+// locks the bucket of the oldest of those to take it.
+static struct buf*
+bvictim(void)
+{
+  struct bucket *k, *vk;
+  struct buf *b, **pp;
+  uint i, n, age;
+
+  for(i = 0; i < 2*NBUCKET; ){
+    vk = 0;
+    age = 0;
+    for(n = 0; n < NVICTIM && i < 2*NBUCKET; i++){
+      k = &bcache.bucket[__sync_fetch_and_add(&bcache.hand, 1) % NBUCKET];
+      if((b = *(struct buf * volatile *)&k->lru) == 0)
+        continue;
+      n++;
+      if(vk == 0 || (int)(b->lastuse - age) < 0){
+        vk = k;
+        age = b->lastuse;
+      }
+    }
+    if(vk == 0)
+      continue;
+
+    // The bucket may have changed since we looked.
+    acquire(&vk->lock);
+    if((b = boldest(vk)) != 0){
+      lrutake(vk, b);
+      for(pp = &vk->head; *pp != b; pp = &(*pp)->next)
+        ;
+      *pp = b->next;
       b->refcnt = 1;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
+      release(&vk->lock);
       return b;
     }
+    release(&vk->lock);
   }
   panic("bget: no buffers");
 }
 
+// Drop a reference to b, stamping it with the time, for LRU
+// recycling, if it is now unused.
+static void
+bput(struct buf *b)
+{
+  struct bucket *k;
+
+  k = &bcache.bucket[BHASH(b->dev, b->blockno)];
+  acquire(&k->lock);
+  b->refcnt--;
+  if (b->refcnt == 0) {
+    // no one is waiting for it.
+    b->lastuse = __sync_fetch_and_add(&bcache.clock, 1);
+    lruput(k, b);
+  }
+  release(&k->lock);
+}
+
+// Put back v, a victim that turned out not to be needed, as
+// it was.
+static void
+bunvictim(struct buf *v)
+{
+  struct bucket *k;
+
+  k = &bcache.bucket[BHASH(v->dev, v->blockno)];
+  acquire(&k->lock);
+  v->next = k->head;
+  k->head = v;
+  v->refcnt = 0;
+  lruput(k, v);
+  release(&k->lock);
+}
+
+// Look through buffer cache for block on device dev.
+// If not found, allocate a buffer.
+// In either case, return locked buffer.
+// If new is set, only a newly allocated buffer will do:
+// return 0 if the block is cached already.
+static struct buf*
+bget(uint dev, uint blockno, int new)
+{
+  struct bucket *k;
+  struct buf *b, *v;
+
+  // Is the block already cached?
+  k = &bcache.bucket[BHASH(dev, blockno)];
+  acquire(&k->lock);
+  b = blookup(k, dev, blockno);
+  release(&k->lock);
+  if(b != 0)
+    goto found;
+
+  // Not cached; recycle a buffer, unless another CPU cached
+  // the block while we weren't holding its bucket's lock.
+  v = bvictim();
+  acquire(&k->lock);
+  if((b = blookup(k, dev, blockno)) != 0){
+    release(&k->lock);
+    bunvictim(v);
+    goto found;
+  }
+  v->dev = dev;
+  v->blockno = blockno;
+  v->flags = 0;
+  v->next = k->head;
+  k->head = v;
+  release(&k->lock);
+  acquiresleep(&v->lock);
+  return v;
+
+found:
+  if(new){
+    bput(b);
+    return 0;
+  }
+  acquiresleep(&b->lock);
+  return b;
+}
+
 // Return a locked buf with the contents of the indicated block.
 struct buf*
 bread(uint dev, uint blockno)
 {
   struct buf *b;
 
-  b = bget(dev, blockno);
+  b = bget(dev, blockno, 0);
   if((b->flags & B_VALID) == 0) {
     iderw(b);
   }
   return b;
 }
 
+// Start reading the indicated block into the cache, unless
+// it is there already, without waiting for the disk.  The
+// disk driver releases the buffer when the read is done.
+void
+breadahead(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  if((b = bget(dev, blockno, 1)) == 0)
+    return;
+  b->flags |= B_ASYNC;
+  iderw(b);
+}
+
 // Write b's contents to disk.  Must be locked.
 void
 bwrite(struct buf *b)
@@ -115,8 +328,28 @@ bwrite(struct buf *b)
   iderw(b);
 }
 
+// Write the contents of locked buffer b to block blockno of
+// b's device instead of its own, leaving b, and any cached
+// copy of blockno, as they are.
+void
+bwriteat(struct buf *b, uint blockno)
+{
+  struct buf tb;
+
+  if(!holdingsleep(&b->lock))
+    panic("bwriteat");
+  memset(&tb, 0, sizeof(tb));
+  tb.dev = b->dev;
+  tb.blockno = blockno;
+  tb.flags = B_VALID|B_DIRTY;
+  tb.data = b->data;
+  initsleeplock(&tb.lock, "buffer");
+  acquiresleep(&tb.lock);
+  iderw(&tb);
+  releasesleep(&tb.lock);
+}
+
 // Release a locked buffer.
-// Move to the head of the MRU list.
 void
 brelse(struct buf *b)
 {
@@ -124,20 +357,7 @@ brelse(struct buf *b)
     panic("brelse");
 
   releasesleep(&b->lock);
-
-  acquire(&bcache.lock);
-  b->refcnt--;
-  if (b->refcnt == 0) {
-    // no one is waiting for it.
-    b->next->prev = b->prev;
-    b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
-  }
-  
-  release(&bcache.lock);
+  bput(b);
 }
 //PAGEBREAK!
 // Blank page.
@@ -4,11 +4,14 @@ struct buf {
   uint blockno;
   struct sleeplock lock;
   uint refcnt;
-  struct buf *prev; // LRU cache list
-  struct buf *next;
+  uint lastuse;     // when refcnt last dropped to 0, for LRU
+  struct buf *next; // hash chain
+  struct buf *lprev; // bucket's LRU list, while refcnt is 0
+  struct buf *lnext;
   struct buf *qnext; // disk queue
-  uchar data[BSIZE];
+  uchar *data;      // BSIZE bytes
 };
 #define B_VALID 0x2  // buffer has been read from disk
 #define B_DIRTY 0x4  // buffer needs to be written to disk
+#define B_ASYNC 0x8  // read-ahead: disk driver releases the buffer when done
 
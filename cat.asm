@@ -0,0 +1,1311 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 01 00 00 00       	mov    $0x1,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  24:	83 f8 01             	cmp    $0x1,%eax
+  27:	7f 26                	jg     4f <main+0x4f>
+  29:	eb 52                	jmp    7d <main+0x7d>
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat(fd);
+  30:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 1; i < argc; i++){
+  33:	83 c6 01             	add    $0x1,%esi
+  36:	83 c3 04             	add    $0x4,%ebx
+    cat(fd);
+  39:	50                   	push   %eax
+  3a:	e8 51 00 00 00       	call   90 <cat>
+    close(fd);
+  3f:	89 3c 24             	mov    %edi,(%esp)
+  42:	e8 35 03 00 00       	call   37c <close>
+  for(i = 1; i < argc; i++){
+  47:	83 c4 10             	add    $0x10,%esp
+  4a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  4d:	74 29                	je     78 <main+0x78>
+    if((fd = open(argv[i], 0)) < 0){
+  4f:	83 ec 08             	sub    $0x8,%esp
+  52:	6a 00                	push   $0x0
+  54:	ff 33                	push   (%ebx)
+  56:	e8 39 03 00 00       	call   394 <open>
+  5b:	83 c4 10             	add    $0x10,%esp
+  5e:	89 c7                	mov    %eax,%edi
+  60:	85 c0                	test   %eax,%eax
+  62:	79 cc                	jns    30 <main+0x30>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+  64:	50                   	push   %eax
+  65:	ff 33                	push   (%ebx)
+  67:	68 6b 08 00 00       	push   $0x86b
+  6c:	6a 01                	push   $0x1
+  6e:	e8 ad 04 00 00       	call   520 <printf>
+      exit();
+  73:	e8 dc 02 00 00       	call   354 <exit>
+  }
+  exit();
+  78:	e8 d7 02 00 00       	call   354 <exit>
+    cat(0);
+  7d:	83 ec 0c             	sub    $0xc,%esp
+  80:	6a 00                	push   $0x0
+  82:	e8 09 00 00 00       	call   90 <cat>
+    exit();
+  87:	e8 c8 02 00 00       	call   354 <exit>
+  8c:	66 90                	xchg   %ax,%ax
+  8e:	66 90                	xchg   %ax,%ax
+
+00000090 <cat>:
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	56                   	push   %esi
+  94:	53                   	push   %ebx
+  95:	8b 75 08             	mov    0x8(%ebp),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  98:	eb 1d                	jmp    b7 <cat+0x27>
+  9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if (write(1, buf, n) != n) {
+  a0:	83 ec 04             	sub    $0x4,%esp
+  a3:	53                   	push   %ebx
+  a4:	68 c0 0b 00 00       	push   $0xbc0
+  a9:	6a 01                	push   $0x1
+  ab:	e8 c4 02 00 00       	call   374 <write>
+  b0:	83 c4 10             	add    $0x10,%esp
+  b3:	39 d8                	cmp    %ebx,%eax
+  b5:	75 25                	jne    dc <cat+0x4c>
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  b7:	83 ec 04             	sub    $0x4,%esp
+  ba:	68 00 02 00 00       	push   $0x200
+  bf:	68 c0 0b 00 00       	push   $0xbc0
+  c4:	56                   	push   %esi
+  c5:	e8 a2 02 00 00       	call   36c <read>
+  ca:	83 c4 10             	add    $0x10,%esp
+  cd:	89 c3                	mov    %eax,%ebx
+  cf:	85 c0                	test   %eax,%eax
+  d1:	7f cd                	jg     a0 <cat+0x10>
+  if(n < 0){
+  d3:	75 1b                	jne    f0 <cat+0x60>
+}
+  d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  d8:	5b                   	pop    %ebx
+  d9:	5e                   	pop    %esi
+  da:	5d                   	pop    %ebp
+  db:	c3                   	ret
+      printf(1, "cat: write error\n");
+  dc:	83 ec 08             	sub    $0x8,%esp
+  df:	68 48 08 00 00       	push   $0x848
+  e4:	6a 01                	push   $0x1
+  e6:	e8 35 04 00 00       	call   520 <printf>
+      exit();
+  eb:	e8 64 02 00 00       	call   354 <exit>
+    printf(1, "cat: read error\n");
+  f0:	50                   	push   %eax
+  f1:	50                   	push   %eax
+  f2:	68 5a 08 00 00       	push   $0x85a
+  f7:	6a 01                	push   $0x1
+  f9:	e8 22 04 00 00       	call   520 <printf>
+    exit();
+  fe:	e8 51 02 00 00       	call   354 <exit>
+ 103:	66 90                	xchg   %ax,%ax
+ 105:	66 90                	xchg   %ax,%ax
+ 107:	66 90                	xchg   %ax,%ax
+ 109:	66 90                	xchg   %ax,%ax
+ 10b:	66 90                	xchg   %ax,%ax
+ 10d:	66 90                	xchg   %ax,%ax
+ 10f:	90                   	nop
+
+00000110 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 110:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 111:	31 c0                	xor    %eax,%eax
+{
+ 113:	89 e5                	mov    %esp,%ebp
+ 115:	53                   	push   %ebx
+ 116:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 119:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 11c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 120:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 124:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 127:	83 c0 01             	add    $0x1,%eax
+ 12a:	84 d2                	test   %dl,%dl
+ 12c:	75 f2                	jne    120 <strcpy+0x10>
+    ;
+  return os;
+}
+ 12e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 131:	89 c8                	mov    %ecx,%eax
+ 133:	c9                   	leave
+ 134:	c3                   	ret
+ 135:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000140 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 146:	80 3a 00             	cmpb   $0x0,(%edx)
+ 149:	74 15                	je     160 <strlen+0x20>
+ 14b:	31 c0                	xor    %eax,%eax
+ 14d:	8d 76 00             	lea    0x0(%esi),%esi
+ 150:	83 c0 01             	add    $0x1,%eax
+ 153:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 157:	89 c1                	mov    %eax,%ecx
+ 159:	75 f5                	jne    150 <strlen+0x10>
+    ;
+  return n;
+}
+ 15b:	89 c8                	mov    %ecx,%eax
+ 15d:	5d                   	pop    %ebp
+ 15e:	c3                   	ret
+ 15f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 160:	31 c9                	xor    %ecx,%ecx
+}
+ 162:	5d                   	pop    %ebp
+ 163:	89 c8                	mov    %ecx,%eax
+ 165:	c3                   	ret
+ 166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000170 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 170:	55                   	push   %ebp
+ 171:	89 e5                	mov    %esp,%ebp
+ 173:	57                   	push   %edi
+ 174:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 177:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 17a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 17d:	89 d7                	mov    %edx,%edi
+ 17f:	fc                   	cld
+ 180:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 182:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 185:	89 d0                	mov    %edx,%eax
+ 187:	c9                   	leave
+ 188:	c3                   	ret
+ 189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000190 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	8b 45 08             	mov    0x8(%ebp),%eax
+ 196:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 19a:	0f b6 10             	movzbl (%eax),%edx
+ 19d:	84 d2                	test   %dl,%dl
+ 19f:	75 12                	jne    1b3 <strchr+0x23>
+ 1a1:	eb 1d                	jmp    1c0 <strchr+0x30>
+ 1a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1a7:	90                   	nop
+ 1a8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1ac:	83 c0 01             	add    $0x1,%eax
+ 1af:	84 d2                	test   %dl,%dl
+ 1b1:	74 0d                	je     1c0 <strchr+0x30>
+    if(*s == c)
+ 1b3:	38 d1                	cmp    %dl,%cl
+ 1b5:	75 f1                	jne    1a8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1b7:	5d                   	pop    %ebp
+ 1b8:	c3                   	ret
+ 1b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 1c0:	31 c0                	xor    %eax,%eax
+}
+ 1c2:	5d                   	pop    %ebp
+ 1c3:	c3                   	ret
+ 1c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1cf:	90                   	nop
+
+000001d0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	57                   	push   %edi
+ 1d4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1d5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1d8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1d9:	31 db                	xor    %ebx,%ebx
+{
+ 1db:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1de:	eb 27                	jmp    207 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1e0:	83 ec 04             	sub    $0x4,%esp
+ 1e3:	6a 01                	push   $0x1
+ 1e5:	56                   	push   %esi
+ 1e6:	6a 00                	push   $0x0
+ 1e8:	e8 7f 01 00 00       	call   36c <read>
+    if(cc < 1)
+ 1ed:	83 c4 10             	add    $0x10,%esp
+ 1f0:	85 c0                	test   %eax,%eax
+ 1f2:	7e 1d                	jle    211 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1f4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1fb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1ff:	3c 0a                	cmp    $0xa,%al
+ 201:	74 10                	je     213 <gets+0x43>
+ 203:	3c 0d                	cmp    $0xd,%al
+ 205:	74 0c                	je     213 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 207:	89 df                	mov    %ebx,%edi
+ 209:	83 c3 01             	add    $0x1,%ebx
+ 20c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 20f:	7c cf                	jl     1e0 <gets+0x10>
+ 211:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 213:	8b 45 08             	mov    0x8(%ebp),%eax
+ 216:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 21a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 21d:	5b                   	pop    %ebx
+ 21e:	5e                   	pop    %esi
+ 21f:	5f                   	pop    %edi
+ 220:	5d                   	pop    %ebp
+ 221:	c3                   	ret
+ 222:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000230 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	56                   	push   %esi
+ 234:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 235:	83 ec 08             	sub    $0x8,%esp
+ 238:	6a 00                	push   $0x0
+ 23a:	ff 75 08             	push   0x8(%ebp)
+ 23d:	e8 52 01 00 00       	call   394 <open>
+  if(fd < 0)
+ 242:	83 c4 10             	add    $0x10,%esp
+ 245:	85 c0                	test   %eax,%eax
+ 247:	78 27                	js     270 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 249:	83 ec 08             	sub    $0x8,%esp
+ 24c:	ff 75 0c             	push   0xc(%ebp)
+ 24f:	89 c3                	mov    %eax,%ebx
+ 251:	50                   	push   %eax
+ 252:	e8 55 01 00 00       	call   3ac <fstat>
+  close(fd);
+ 257:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 25a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 25c:	e8 1b 01 00 00       	call   37c <close>
+  return r;
+ 261:	83 c4 10             	add    $0x10,%esp
+}
+ 264:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 267:	89 f0                	mov    %esi,%eax
+ 269:	5b                   	pop    %ebx
+ 26a:	5e                   	pop    %esi
+ 26b:	5d                   	pop    %ebp
+ 26c:	c3                   	ret
+ 26d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 270:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 275:	eb ed                	jmp    264 <stat+0x34>
+ 277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27e:	66 90                	xchg   %ax,%ax
+
+00000280 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	57                   	push   %edi
+ 284:	56                   	push   %esi
+ 285:	8b 45 10             	mov    0x10(%ebp),%eax
+ 288:	8b 55 08             	mov    0x8(%ebp),%edx
+ 28b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 28e:	85 c0                	test   %eax,%eax
+ 290:	7e 13                	jle    2a5 <memmove+0x25>
+ 292:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 294:	89 d7                	mov    %edx,%edi
+ 296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2a1:	39 f8                	cmp    %edi,%eax
+ 2a3:	75 fb                	jne    2a0 <memmove+0x20>
+  return vdst;
+}
+ 2a5:	5e                   	pop    %esi
+ 2a6:	89 d0                	mov    %edx,%eax
+ 2a8:	5f                   	pop    %edi
+ 2a9:	5d                   	pop    %ebp
+ 2aa:	c3                   	ret
+ 2ab:	66 90                	xchg   %ax,%ax
+ 2ad:	66 90                	xchg   %ax,%ax
+ 2af:	90                   	nop
+
+000002b0 <strcmp>:
+#include "types.h"
+#include "util.h"
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	53                   	push   %ebx
+ 2b4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 2ba:	0f b6 02             	movzbl (%edx),%eax
+ 2bd:	84 c0                	test   %al,%al
+ 2bf:	75 17                	jne    2d8 <strcmp+0x28>
+ 2c1:	eb 3a                	jmp    2fd <strcmp+0x4d>
+ 2c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2c7:	90                   	nop
+ 2c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 2cc:	83 c2 01             	add    $0x1,%edx
+ 2cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 2d2:	84 c0                	test   %al,%al
+ 2d4:	74 1a                	je     2f0 <strcmp+0x40>
+    p++, q++;
+ 2d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 2d8:	0f b6 19             	movzbl (%ecx),%ebx
+ 2db:	38 c3                	cmp    %al,%bl
+ 2dd:	74 e9                	je     2c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 2df:	29 d8                	sub    %ebx,%eax
+}
+ 2e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2e4:	c9                   	leave
+ 2e5:	c3                   	ret
+ 2e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 2f4:	31 c0                	xor    %eax,%eax
+ 2f6:	29 d8                	sub    %ebx,%eax
+}
+ 2f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2fb:	c9                   	leave
+ 2fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 300:	31 c0                	xor    %eax,%eax
+ 302:	eb db                	jmp    2df <strcmp+0x2f>
+ 304:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 30f:	90                   	nop
+
+00000310 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	53                   	push   %ebx
+ 314:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 317:	0f be 02             	movsbl (%edx),%eax
+ 31a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 31d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 320:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 325:	77 1e                	ja     345 <atoi+0x35>
+ 327:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 330:	83 c2 01             	add    $0x1,%edx
+ 333:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 336:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 33a:	0f be 02             	movsbl (%edx),%eax
+ 33d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 340:	80 fb 09             	cmp    $0x9,%bl
+ 343:	76 eb                	jbe    330 <atoi+0x20>
+  return n;
+ 345:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 348:	89 c8                	mov    %ecx,%eax
+ 34a:	c9                   	leave
+ 34b:	c3                   	ret
+
+0000034c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 34c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 351:	cd 40                	int    $0x40
+ 353:	c3                   	ret
+
+00000354 <exit>:
+SYSCALL(exit)
+ 354:	b8 02 00 00 00       	mov    $0x2,%eax
+ 359:	cd 40                	int    $0x40
+ 35b:	c3                   	ret
+
+0000035c <wait>:
+SYSCALL(wait)
+ 35c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 361:	cd 40                	int    $0x40
+ 363:	c3                   	ret
+
+00000364 <pipe>:
+SYSCALL(pipe)
+ 364:	b8 04 00 00 00       	mov    $0x4,%eax
+ 369:	cd 40                	int    $0x40
+ 36b:	c3                   	ret
+
+0000036c <read>:
+SYSCALL(read)
+ 36c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 371:	cd 40                	int    $0x40
+ 373:	c3                   	ret
+
+00000374 <write>:
+SYSCALL(write)
+ 374:	b8 10 00 00 00       	mov    $0x10,%eax
+ 379:	cd 40                	int    $0x40
+ 37b:	c3                   	ret
+
+0000037c <close>:
+SYSCALL(close)
+ 37c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 381:	cd 40                	int    $0x40
+ 383:	c3                   	ret
+
+00000384 <kill>:
+SYSCALL(kill)
+ 384:	b8 06 00 00 00       	mov    $0x6,%eax
+ 389:	cd 40                	int    $0x40
+ 38b:	c3                   	ret
+
+0000038c <exec>:
+SYSCALL(exec)
+ 38c:	b8 07 00 00 00       	mov    $0x7,%eax
+ 391:	cd 40                	int    $0x40
+ 393:	c3                   	ret
+
+00000394 <open>:
+SYSCALL(open)
+ 394:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 399:	cd 40                	int    $0x40
+ 39b:	c3                   	ret
+
+0000039c <mknod>:
+SYSCALL(mknod)
+ 39c:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3a1:	cd 40                	int    $0x40
+ 3a3:	c3                   	ret
+
+000003a4 <unlink>:
+SYSCALL(unlink)
+ 3a4:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3a9:	cd 40                	int    $0x40
+ 3ab:	c3                   	ret
+
+000003ac <fstat>:
+SYSCALL(fstat)
+ 3ac:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3b1:	cd 40                	int    $0x40
+ 3b3:	c3                   	ret
+
+000003b4 <link>:
+SYSCALL(link)
+ 3b4:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3b9:	cd 40                	int    $0x40
+ 3bb:	c3                   	ret
+
+000003bc <mkdir>:
+SYSCALL(mkdir)
+ 3bc:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3c1:	cd 40                	int    $0x40
+ 3c3:	c3                   	ret
+
+000003c4 <chdir>:
+SYSCALL(chdir)
+ 3c4:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3c9:	cd 40                	int    $0x40
+ 3cb:	c3                   	ret
+
+000003cc <dup>:
+SYSCALL(dup)
+ 3cc:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3d1:	cd 40                	int    $0x40
+ 3d3:	c3                   	ret
+
+000003d4 <getpid>:
+SYSCALL(getpid)
+ 3d4:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3d9:	cd 40                	int    $0x40
+ 3db:	c3                   	ret
+
+000003dc <sbrk>:
+SYSCALL(sbrk)
+ 3dc:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3e1:	cd 40                	int    $0x40
+ 3e3:	c3                   	ret
+
+000003e4 <sleep>:
+SYSCALL(sleep)
+ 3e4:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3e9:	cd 40                	int    $0x40
+ 3eb:	c3                   	ret
+
+000003ec <uptime>:
+SYSCALL(uptime)
+ 3ec:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3f1:	cd 40                	int    $0x40
+ 3f3:	c3                   	ret
+
+000003f4 <arp>:
+SYSCALL(arp)
+ 3f4:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3f9:	cd 40                	int    $0x40
+ 3fb:	c3                   	ret
+
+000003fc <mmap>:
+SYSCALL(mmap)
+ 3fc:	b8 17 00 00 00       	mov    $0x17,%eax
+ 401:	cd 40                	int    $0x40
+ 403:	c3                   	ret
+
+00000404 <munmap>:
+SYSCALL(munmap)
+ 404:	b8 18 00 00 00       	mov    $0x18,%eax
+ 409:	cd 40                	int    $0x40
+ 40b:	c3                   	ret
+
+0000040c <msync>:
+SYSCALL(msync)
+ 40c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 411:	cd 40                	int    $0x40
+ 413:	c3                   	ret
+
+00000414 <shmcreate>:
+SYSCALL(shmcreate)
+ 414:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 419:	cd 40                	int    $0x40
+ 41b:	c3                   	ret
+
+0000041c <shmattach>:
+SYSCALL(shmattach)
+ 41c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 421:	cd 40                	int    $0x40
+ 423:	c3                   	ret
+
+00000424 <shmdetach>:
+SYSCALL(shmdetach)
+ 424:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 429:	cd 40                	int    $0x40
+ 42b:	c3                   	ret
+
+0000042c <futex_wait>:
+SYSCALL(futex_wait)
+ 42c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 431:	cd 40                	int    $0x40
+ 433:	c3                   	ret
+
+00000434 <futex_wake>:
+SYSCALL(futex_wake)
+ 434:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 439:	cd 40                	int    $0x40
+ 43b:	c3                   	ret
+
+0000043c <nice>:
+SYSCALL(nice)
+ 43c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 441:	cd 40                	int    $0x40
+ 443:	c3                   	ret
+
+00000444 <setpriority>:
+SYSCALL(setpriority)
+ 444:	b8 20 00 00 00       	mov    $0x20,%eax
+ 449:	cd 40                	int    $0x40
+ 44b:	c3                   	ret
+
+0000044c <cputime>:
+SYSCALL(cputime)
+ 44c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 451:	cd 40                	int    $0x40
+ 453:	c3                   	ret
+
+00000454 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 454:	b8 22 00 00 00       	mov    $0x22,%eax
+ 459:	cd 40                	int    $0x40
+ 45b:	c3                   	ret
+
+0000045c <clone>:
+SYSCALL(clone)
+ 45c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 461:	cd 40                	int    $0x40
+ 463:	c3                   	ret
+
+00000464 <join>:
+SYSCALL(join)
+ 464:	b8 24 00 00 00       	mov    $0x24,%eax
+ 469:	cd 40                	int    $0x40
+ 46b:	c3                   	ret
+
+0000046c <lockstat>:
+SYSCALL(lockstat)
+ 46c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 471:	cd 40                	int    $0x40
+ 473:	c3                   	ret
+ 474:	66 90                	xchg   %ax,%ax
+ 476:	66 90                	xchg   %ax,%ax
+ 478:	66 90                	xchg   %ax,%ax
+ 47a:	66 90                	xchg   %ax,%ax
+ 47c:	66 90                	xchg   %ax,%ax
+ 47e:	66 90                	xchg   %ax,%ax
+
+00000480 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	57                   	push   %edi
+ 484:	56                   	push   %esi
+ 485:	53                   	push   %ebx
+ 486:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 488:	89 d1                	mov    %edx,%ecx
+{
+ 48a:	83 ec 3c             	sub    $0x3c,%esp
+ 48d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 490:	85 d2                	test   %edx,%edx
+ 492:	0f 89 80 00 00 00    	jns    518 <printint+0x98>
+ 498:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 49c:	74 7a                	je     518 <printint+0x98>
+    x = -xx;
+ 49e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 4a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 4a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 4a8:	31 f6                	xor    %esi,%esi
+ 4aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 4b0:	89 c8                	mov    %ecx,%eax
+ 4b2:	31 d2                	xor    %edx,%edx
+ 4b4:	89 f7                	mov    %esi,%edi
+ 4b6:	f7 f3                	div    %ebx
+ 4b8:	8d 76 01             	lea    0x1(%esi),%esi
+ 4bb:	0f b6 92 e0 08 00 00 	movzbl 0x8e0(%edx),%edx
+ 4c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 4c6:	89 ca                	mov    %ecx,%edx
+ 4c8:	89 c1                	mov    %eax,%ecx
+ 4ca:	39 da                	cmp    %ebx,%edx
+ 4cc:	73 e2                	jae    4b0 <printint+0x30>
+  if(neg)
+ 4ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 4d1:	85 c0                	test   %eax,%eax
+ 4d3:	74 07                	je     4dc <printint+0x5c>
+    buf[i++] = '-';
+ 4d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 4da:	89 f7                	mov    %esi,%edi
+ 4dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 4df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 4e2:	01 df                	add    %ebx,%edi
+ 4e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 4e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 4eb:	83 ec 04             	sub    $0x4,%esp
+ 4ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 4f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 4f4:	6a 01                	push   $0x1
+ 4f6:	50                   	push   %eax
+ 4f7:	56                   	push   %esi
+ 4f8:	e8 77 fe ff ff       	call   374 <write>
+  while(--i >= 0)
+ 4fd:	89 f8                	mov    %edi,%eax
+ 4ff:	83 c4 10             	add    $0x10,%esp
+ 502:	83 ef 01             	sub    $0x1,%edi
+ 505:	39 d8                	cmp    %ebx,%eax
+ 507:	75 df                	jne    4e8 <printint+0x68>
+}
+ 509:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 50c:	5b                   	pop    %ebx
+ 50d:	5e                   	pop    %esi
+ 50e:	5f                   	pop    %edi
+ 50f:	5d                   	pop    %ebp
+ 510:	c3                   	ret
+ 511:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 518:	31 c0                	xor    %eax,%eax
+ 51a:	eb 89                	jmp    4a5 <printint+0x25>
+ 51c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000520 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	57                   	push   %edi
+ 524:	56                   	push   %esi
+ 525:	53                   	push   %ebx
+ 526:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 529:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 52c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 52f:	0f b6 1e             	movzbl (%esi),%ebx
+ 532:	83 c6 01             	add    $0x1,%esi
+ 535:	84 db                	test   %bl,%bl
+ 537:	74 67                	je     5a0 <printf+0x80>
+ 539:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 53c:	31 d2                	xor    %edx,%edx
+ 53e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 541:	eb 34                	jmp    577 <printf+0x57>
+ 543:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 547:	90                   	nop
+ 548:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 54b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 550:	83 f8 25             	cmp    $0x25,%eax
+ 553:	74 18                	je     56d <printf+0x4d>
+  write(fd, &c, 1);
+ 555:	83 ec 04             	sub    $0x4,%esp
+ 558:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 55b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 55e:	6a 01                	push   $0x1
+ 560:	50                   	push   %eax
+ 561:	57                   	push   %edi
+ 562:	e8 0d fe ff ff       	call   374 <write>
+ 567:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 56a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 56d:	0f b6 1e             	movzbl (%esi),%ebx
+ 570:	83 c6 01             	add    $0x1,%esi
+ 573:	84 db                	test   %bl,%bl
+ 575:	74 29                	je     5a0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 577:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 57a:	85 d2                	test   %edx,%edx
+ 57c:	74 ca                	je     548 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 57e:	83 fa 25             	cmp    $0x25,%edx
+ 581:	75 ea                	jne    56d <printf+0x4d>
+      if(c == 'd'){
+ 583:	83 f8 25             	cmp    $0x25,%eax
+ 586:	0f 84 24 01 00 00    	je     6b0 <printf+0x190>
+ 58c:	83 e8 63             	sub    $0x63,%eax
+ 58f:	83 f8 15             	cmp    $0x15,%eax
+ 592:	77 1c                	ja     5b0 <printf+0x90>
+ 594:	ff 24 85 88 08 00 00 	jmp    *0x888(,%eax,4)
+ 59b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 59f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 5a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5a3:	5b                   	pop    %ebx
+ 5a4:	5e                   	pop    %esi
+ 5a5:	5f                   	pop    %edi
+ 5a6:	5d                   	pop    %ebp
+ 5a7:	c3                   	ret
+ 5a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5af:	90                   	nop
+  write(fd, &c, 1);
+ 5b0:	83 ec 04             	sub    $0x4,%esp
+ 5b3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5b6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 5ba:	6a 01                	push   $0x1
+ 5bc:	52                   	push   %edx
+ 5bd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 5c0:	57                   	push   %edi
+ 5c1:	e8 ae fd ff ff       	call   374 <write>
+ 5c6:	83 c4 0c             	add    $0xc,%esp
+ 5c9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5cc:	6a 01                	push   $0x1
+ 5ce:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 5d1:	52                   	push   %edx
+ 5d2:	57                   	push   %edi
+ 5d3:	e8 9c fd ff ff       	call   374 <write>
+        putc(fd, c);
+ 5d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5db:	31 d2                	xor    %edx,%edx
+ 5dd:	eb 8e                	jmp    56d <printf+0x4d>
+ 5df:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 5e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5e3:	83 ec 0c             	sub    $0xc,%esp
+ 5e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 5eb:	8b 13                	mov    (%ebx),%edx
+ 5ed:	6a 00                	push   $0x0
+ 5ef:	89 f8                	mov    %edi,%eax
+        ap++;
+ 5f1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 5f4:	e8 87 fe ff ff       	call   480 <printint>
+        ap++;
+ 5f9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 5fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5ff:	31 d2                	xor    %edx,%edx
+ 601:	e9 67 ff ff ff       	jmp    56d <printf+0x4d>
+ 606:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 60d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 610:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 613:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 615:	83 c0 04             	add    $0x4,%eax
+ 618:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 61b:	85 db                	test   %ebx,%ebx
+ 61d:	0f 84 9d 00 00 00    	je     6c0 <printf+0x1a0>
+        while(*s != 0){
+ 623:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 626:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 628:	84 c0                	test   %al,%al
+ 62a:	0f 84 3d ff ff ff    	je     56d <printf+0x4d>
+ 630:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 633:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 636:	89 de                	mov    %ebx,%esi
+ 638:	89 d3                	mov    %edx,%ebx
+ 63a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 640:	83 ec 04             	sub    $0x4,%esp
+ 643:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 646:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 649:	6a 01                	push   $0x1
+ 64b:	53                   	push   %ebx
+ 64c:	57                   	push   %edi
+ 64d:	e8 22 fd ff ff       	call   374 <write>
+        while(*s != 0){
+ 652:	0f b6 06             	movzbl (%esi),%eax
+ 655:	83 c4 10             	add    $0x10,%esp
+ 658:	84 c0                	test   %al,%al
+ 65a:	75 e4                	jne    640 <printf+0x120>
+      state = 0;
+ 65c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 65f:	31 d2                	xor    %edx,%edx
+ 661:	e9 07 ff ff ff       	jmp    56d <printf+0x4d>
+ 666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 66d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 670:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 673:	83 ec 0c             	sub    $0xc,%esp
+ 676:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 67b:	8b 13                	mov    (%ebx),%edx
+ 67d:	6a 01                	push   $0x1
+ 67f:	e9 6b ff ff ff       	jmp    5ef <printf+0xcf>
+ 684:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 688:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 68b:	83 ec 04             	sub    $0x4,%esp
+ 68e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 691:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 693:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 696:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 699:	6a 01                	push   $0x1
+ 69b:	52                   	push   %edx
+ 69c:	57                   	push   %edi
+ 69d:	e8 d2 fc ff ff       	call   374 <write>
+        ap++;
+ 6a2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6a5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6a8:	31 d2                	xor    %edx,%edx
+ 6aa:	e9 be fe ff ff       	jmp    56d <printf+0x4d>
+ 6af:	90                   	nop
+  write(fd, &c, 1);
+ 6b0:	83 ec 04             	sub    $0x4,%esp
+ 6b3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6b6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6b9:	6a 01                	push   $0x1
+ 6bb:	e9 11 ff ff ff       	jmp    5d1 <printf+0xb1>
+ 6c0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 6c5:	bb 80 08 00 00       	mov    $0x880,%ebx
+ 6ca:	e9 61 ff ff ff       	jmp    630 <printf+0x110>
+ 6cf:	90                   	nop
+
+000006d0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6d0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6d1:	a1 c0 0d 00 00       	mov    0xdc0,%eax
+{
+ 6d6:	89 e5                	mov    %esp,%ebp
+ 6d8:	57                   	push   %edi
+ 6d9:	56                   	push   %esi
+ 6da:	53                   	push   %ebx
+ 6db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 6de:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6e8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6ea:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6ec:	39 ca                	cmp    %ecx,%edx
+ 6ee:	73 30                	jae    720 <free+0x50>
+ 6f0:	39 c1                	cmp    %eax,%ecx
+ 6f2:	72 04                	jb     6f8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6f4:	39 c2                	cmp    %eax,%edx
+ 6f6:	72 f0                	jb     6e8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 6f8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 6fb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 6fe:	39 f8                	cmp    %edi,%eax
+ 700:	74 2e                	je     730 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 702:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 705:	8b 42 04             	mov    0x4(%edx),%eax
+ 708:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 70b:	39 f1                	cmp    %esi,%ecx
+ 70d:	74 38                	je     747 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 70f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 711:	5b                   	pop    %ebx
+  freep = p;
+ 712:	89 15 c0 0d 00 00    	mov    %edx,0xdc0
+}
+ 718:	5e                   	pop    %esi
+ 719:	5f                   	pop    %edi
+ 71a:	5d                   	pop    %ebp
+ 71b:	c3                   	ret
+ 71c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 720:	39 c1                	cmp    %eax,%ecx
+ 722:	72 d0                	jb     6f4 <free+0x24>
+ 724:	eb c2                	jmp    6e8 <free+0x18>
+ 726:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 72d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 730:	03 70 04             	add    0x4(%eax),%esi
+ 733:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 736:	8b 02                	mov    (%edx),%eax
+ 738:	8b 00                	mov    (%eax),%eax
+ 73a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 73d:	8b 42 04             	mov    0x4(%edx),%eax
+ 740:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 743:	39 f1                	cmp    %esi,%ecx
+ 745:	75 c8                	jne    70f <free+0x3f>
+    p->s.size += bp->s.size;
+ 747:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 74a:	89 15 c0 0d 00 00    	mov    %edx,0xdc0
+    p->s.size += bp->s.size;
+ 750:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 753:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 756:	89 0a                	mov    %ecx,(%edx)
+}
+ 758:	5b                   	pop    %ebx
+ 759:	5e                   	pop    %esi
+ 75a:	5f                   	pop    %edi
+ 75b:	5d                   	pop    %ebp
+ 75c:	c3                   	ret
+ 75d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000760 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 760:	55                   	push   %ebp
+ 761:	89 e5                	mov    %esp,%ebp
+ 763:	57                   	push   %edi
+ 764:	56                   	push   %esi
+ 765:	53                   	push   %ebx
+ 766:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 769:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 76c:	8b 15 c0 0d 00 00    	mov    0xdc0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 772:	8d 78 07             	lea    0x7(%eax),%edi
+ 775:	c1 ef 03             	shr    $0x3,%edi
+ 778:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 77b:	85 d2                	test   %edx,%edx
+ 77d:	0f 84 8d 00 00 00    	je     810 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 783:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 785:	8b 48 04             	mov    0x4(%eax),%ecx
+ 788:	39 f9                	cmp    %edi,%ecx
+ 78a:	73 64                	jae    7f0 <malloc+0x90>
+  if(nu < 4096)
+ 78c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 791:	39 df                	cmp    %ebx,%edi
+ 793:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 796:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 79d:	eb 0a                	jmp    7a9 <malloc+0x49>
+ 79f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7a0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 7a2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 7a5:	39 f9                	cmp    %edi,%ecx
+ 7a7:	73 47                	jae    7f0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 7a9:	89 c2                	mov    %eax,%edx
+ 7ab:	39 05 c0 0d 00 00    	cmp    %eax,0xdc0
+ 7b1:	75 ed                	jne    7a0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 7b3:	83 ec 0c             	sub    $0xc,%esp
+ 7b6:	56                   	push   %esi
+ 7b7:	e8 20 fc ff ff       	call   3dc <sbrk>
+  if(p == (char*)-1)
+ 7bc:	83 c4 10             	add    $0x10,%esp
+ 7bf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 7c2:	74 1c                	je     7e0 <malloc+0x80>
+  hp->s.size = nu;
+ 7c4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 7c7:	83 ec 0c             	sub    $0xc,%esp
+ 7ca:	83 c0 08             	add    $0x8,%eax
+ 7cd:	50                   	push   %eax
+ 7ce:	e8 fd fe ff ff       	call   6d0 <free>
+  return freep;
+ 7d3:	8b 15 c0 0d 00 00    	mov    0xdc0,%edx
+      if((p = morecore(nunits)) == 0)
+ 7d9:	83 c4 10             	add    $0x10,%esp
+ 7dc:	85 d2                	test   %edx,%edx
+ 7de:	75 c0                	jne    7a0 <malloc+0x40>
+        return 0;
+  }
+}
+ 7e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 7e3:	31 c0                	xor    %eax,%eax
+}
+ 7e5:	5b                   	pop    %ebx
+ 7e6:	5e                   	pop    %esi
+ 7e7:	5f                   	pop    %edi
+ 7e8:	5d                   	pop    %ebp
+ 7e9:	c3                   	ret
+ 7ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 7f0:	39 cf                	cmp    %ecx,%edi
+ 7f2:	74 4c                	je     840 <malloc+0xe0>
+        p->s.size -= nunits;
+ 7f4:	29 f9                	sub    %edi,%ecx
+ 7f6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 7f9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 7fc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 7ff:	89 15 c0 0d 00 00    	mov    %edx,0xdc0
+}
+ 805:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 808:	83 c0 08             	add    $0x8,%eax
+}
+ 80b:	5b                   	pop    %ebx
+ 80c:	5e                   	pop    %esi
+ 80d:	5f                   	pop    %edi
+ 80e:	5d                   	pop    %ebp
+ 80f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 810:	c7 05 c0 0d 00 00 c4 	movl   $0xdc4,0xdc0
+ 817:	0d 00 00 
+    base.s.size = 0;
+ 81a:	b8 c4 0d 00 00       	mov    $0xdc4,%eax
+    base.s.ptr = freep = prevp = &base;
+ 81f:	c7 05 c4 0d 00 00 c4 	movl   $0xdc4,0xdc4
+ 826:	0d 00 00 
+    base.s.size = 0;
+ 829:	c7 05 c8 0d 00 00 00 	movl   $0x0,0xdc8
+ 830:	00 00 00 
+    if(p->s.size >= nunits){
+ 833:	e9 54 ff ff ff       	jmp    78c <malloc+0x2c>
+ 838:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 83f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 840:	8b 08                	mov    (%eax),%ecx
+ 842:	89 0a                	mov    %ecx,(%edx)
+ 844:	eb b9                	jmp    7ff <malloc+0x9f>
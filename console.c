@@ -237,6 +237,7 @@ consoleread(struct inode *ip, char *dst, int n)
 {
   uint target;
   int c;
+  char ch;
 
   iunlock(ip);
   target = n;
@@ -259,7 +260,12 @@ consoleread(struct inode *ip, char *dst, int n)
       }
       break;
     }
-    *dst++ = c;
+    ch = c;
+    if(ucopy(dst++, &ch, 1) < 0){
+      release(&cons.lock);
+      ilock(ip);
+      return -1;
+    }
     --n;
     if(c == '\n')
       break;
@@ -274,15 +280,19 @@ int
 consolewrite(struct inode *ip, char *buf, int n)
 {
   int i;
+  char c;
 
   iunlock(ip);
   acquire(&cons.lock);
-  for(i = 0; i < n; i++)
-    consputc(buf[i] & 0xff);
+  for(i = 0; i < n; i++){
+    if(ucopy(&c, buf+i, 1) < 0)
+      break;
+    consputc(c & 0xff);
+  }
   release(&cons.lock);
   ilock(ip);
 
-  return n;
+  return i < n ? -1 : n;
 }
 
 void
@@ -0,0 +1,183 @@
+// Directory entry cache.
+//
+// The dentry cache remembers the results of recent directory
+// lookups, found or not, so that namex() can walk a path without
+// locking and searching each directory on the way.
+//
+// Interface:
+// * dcachelookup(dp, name, &ip, &off) looks name up in dp.  If
+//   the answer is cached it returns 1 and sets ip to a referenced
+//   inode, or to 0 if dp has no such name.  dp need not be locked.
+// * dcacheenter(dp, name, inum, off) records that name is at
+//   off in dp with inode number inum, or is absent if inum is 0.
+// * dcachepurge(dp) forgets the names in dp, when it is freed.
+//
+// Directories change only with their inode locked, and their
+// lookups and changes call dcacheenter() before unlocking, so
+// the cache says the same as the disk.  dcachelookup() takes the
+// reference to the inode it finds before letting go of the
+// cache, so an unlink() after it can't free the inode meanwhile.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+
+#define NDHASH 257   // hash buckets
+
+struct dentry {
+  uint dev;
+  uint pinum;            // directory holding the name
+  char name[DIRSIZ];
+  uint inum;             // 0 if the name is absent
+  uint off;              // offset of the entry in the directory
+  struct dentry *hnext;  // hash chain
+  struct dentry *prev;   // LRU list, most recently used first
+  struct dentry *next;
+};
+
+struct {
+  struct spinlock lock;
+  struct dentry ent[NDCACHE];
+  struct dentry *hash[NDHASH];
+  struct dentry head;    // head.next is the most recently used
+} dcache;
+
+static uint
+dhash(uint dev, uint pinum, char *name)
+{
+  uint h;
+  int i;
+
+  h = dev * 31 + pinum;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = h * 31 + (uchar)name[i];
+  return h % NDHASH;
+}
+
+void
+dcacheinit(void)
+{
+  struct dentry *d;
+
+  initlock(&dcache.lock, "dcache");
+  dcache.head.prev = &dcache.head;
+  dcache.head.next = &dcache.head;
+  for(d = dcache.ent; d < dcache.ent+NDCACHE; d++){
+    d->next = dcache.head.next;
+    d->prev = &dcache.head;
+    dcache.head.next->prev = d;
+    dcache.head.next = d;
+  }
+}
+
+// Move d to the front of the LRU list.
+// Caller must hold dcache.lock.
+static void
+dtouch(struct dentry *d)
+{
+  d->next->prev = d->prev;
+  d->prev->next = d->next;
+  d->next = dcache.head.next;
+  d->prev = &dcache.head;
+  dcache.head.next->prev = d;
+  dcache.head.next = d;
+}
+
+// Take d out of its hash chain, making it free.
+// Caller must hold dcache.lock.
+static void
+dunhash(struct dentry *d)
+{
+  struct dentry **pp;
+
+  if(d->pinum == 0)
+    return;
+  for(pp = &dcache.hash[dhash(d->dev, d->pinum, d->name)]; *pp; pp = &(*pp)->hnext){
+    if(*pp == d){
+      *pp = d->hnext;
+      break;
+    }
+  }
+  d->pinum = 0;
+}
+
+// Find the entry for name in dp.
+// Caller must hold dcache.lock.
+static struct dentry*
+dfind(uint dev, uint pinum, char *name)
+{
+  struct dentry *d;
+
+  for(d = dcache.hash[dhash(dev, pinum, name)]; d; d = d->hnext)
+    if(d->dev == dev && d->pinum == pinum && namecmp(d->name, name) == 0)
+      return d;
+  return 0;
+}
+
+int
+dcachelookup(struct inode *dp, char *name, struct inode **ipp, uint *poff)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  if((d = dfind(dp->dev, dp->inum, name)) == 0){
+    release(&dcache.lock);
+    return 0;
+  }
+  dtouch(d);
+  *ipp = d->inum ? iget(d->dev, d->inum) : 0;
+  if(poff)
+    *poff = d->off;
+  release(&dcache.lock);
+  return 1;
+}
+
+// Caller must hold dp->lock.
+void
+dcacheenter(struct inode *dp, char *name, uint inum, uint off)
+{
+  struct dentry *d;
+  uint h;
+
+  acquire(&dcache.lock);
+  if((d = dfind(dp->dev, dp->inum, name)) == 0){
+    // Recycle the least recently used entry.
+    d = dcache.head.prev;
+    dunhash(d);
+    d->dev = dp->dev;
+    d->pinum = dp->inum;
+    strncpy(d->name, name, DIRSIZ);
+    h = dhash(d->dev, d->pinum, d->name);
+    d->hnext = dcache.hash[h];
+    dcache.hash[h] = d;
+  }
+  d->inum = inum;
+  d->off = off;
+  dtouch(d);
+  release(&dcache.lock);
+}
+
+void
+dcachepurge(struct inode *dp)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  for(d = dcache.ent; d < dcache.ent+NDCACHE; d++){
+    if(d->pinum == dp->inum && d->dev == dp->dev){
+      dunhash(d);
+      // Put it at the back, to be reused first.
+      d->next->prev = d->prev;
+      d->prev->next = d->next;
+      d->prev = dcache.head.prev;
+      d->next = &dcache.head;
+      dcache.head.prev->next = d;
+      dcache.head.prev = d;
+    }
+  }
+  release(&dcache.lock);
+}
@@ -1,20 +1,29 @@
 struct buf;
 struct context;
 struct file;
+struct files;
 struct inode;
+struct lockstat;
+struct mm;
 struct pipe;
 struct proc;
+struct rcuhead;
 struct rtcdate;
 struct spinlock;
 struct sleeplock;
 struct stat;
+struct shm;
 struct superblock;
+struct timespec;
+struct vma;
 
 // bio.c
 void            binit(void);
 struct buf*     bread(uint, uint);
+void            breadahead(uint, uint);
 void            brelse(struct buf*);
 void            bwrite(struct buf*);
+void            bwriteat(struct buf*, uint);
 
 // console.c
 void            consoleinit(void);
@@ -22,6 +31,12 @@ void            cprintf(char*, ...);
 void            consoleintr(int(*)(void));
 void            panic(char*) __attribute__((noreturn));
 
+// dcache.c
+void            dcacheinit(void);
+int             dcachelookup(struct inode*, char*, struct inode**, uint*);
+void            dcacheenter(struct inode*, char*, uint, uint);
+void            dcachepurge(struct inode*);
+
 // exec.c
 int             exec(char*, char**);
 
@@ -29,6 +44,10 @@ int             exec(char*, char**);
 struct file*    filealloc(void);
 void            fileclose(struct file*);
 struct file*    filedup(struct file*);
+struct files*   filesalloc(void);
+struct files*   filescopy(struct files*);
+struct files*   filesdup(struct files*);
+void            filesput(struct files*);
 void            fileinit(void);
 int             fileread(struct file*, char*, int n);
 int             filestat(struct file*, struct stat*);
@@ -37,9 +56,11 @@ int             filewrite(struct file*, char*, int n);
 // fs.c
 void            readsb(int dev, struct superblock *sb);
 int             dirlink(struct inode*, char*, uint);
+void            dirunlink(struct inode*, uint);
 struct inode*   dirlookup(struct inode*, char*, uint*);
 struct inode*   ialloc(uint, short);
 struct inode*   idup(struct inode*);
+struct inode*   iget(uint, uint);
 void            iinit(int dev);
 void            ilock(struct inode*);
 void            iput(struct inode*);
@@ -56,6 +77,7 @@ int             writei(struct inode*, char*, uint, uint);
 // ide.c
 void            ideinit(void);
 void            ideintr(void);
+int             idedmainit(uint);
 void            iderw(struct buf*);
 
 // ioapic.c
@@ -66,6 +88,9 @@ void            ioapicinit(void);
 // kalloc.c
 char*           kalloc(void);
 void            kfree(char*);
+void            kdup(char*);
+int             krefcount(char*);
+uint            kfreecount(void);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
 
@@ -78,8 +103,11 @@ int             lapicid(void);
 extern volatile uint*    lapic;
 void            lapiceoi(void);
 void            lapicinit(void);
+void            lapicipi(int, int);
 void            lapicstartap(uchar, uint);
+void            lapictimer(uint64_t);
 void            microdelay(int);
+extern uint     tsctick;
 
 // log.c
 void            initlog(int dev);
@@ -95,6 +123,14 @@ void            mpinit(void);
 void            picenable(int);
 void            picinit(void);
 
+// pcache.c
+void            pcacheinit(void);
+char*           pcacheget(struct inode*, uint);
+void            pcacheinval(struct inode*);
+int             pcachehas(struct inode*);
+int             pcacheread(struct inode*, uint, char*, uint);
+void            pcacheupdate(struct inode*, uint, char*, uint);
+
 // pipe.c
 int             pipealloc(struct file**, struct file**);
 void            pipeclose(struct pipe*, int);
@@ -103,17 +139,25 @@ int             pipewrite(struct pipe*, char*, int);
 
 //PAGEBREAK: 16
 // proc.c
+int             clone(uint, uint, uint);
 int             cpuid(void);
+void            execthreads(struct mm*);
 void            exit(void);
 int             fork(void);
-int             growproc(int);
+int             futexwait(uint, int);
+int             futexwake(uint, int);
+int             join(uint*);
 int             kill(int);
+int             kthread(char*, void(*)(void*), void*);
+int             nice(int);
 struct cpu*     mycpu(void);
 struct proc*    myproc();
 void            pinit(void);
 void            procdump(void);
 void            scheduler(void) __attribute__((noreturn));
 void            sched(void);
+int             schedtick(void);
+int             setpriority(int, int, int);
 void            setproc(struct proc*);
 void            sleep(void*, struct spinlock*);
 void            userinit(void);
@@ -121,6 +165,15 @@ int             wait(void);
 void            wakeup(void*);
 void            yield(void);
 
+// shm.c
+void            shminit(void);
+struct shm*     shmcreate(char*, uint);
+struct shm*     shmlookup(char*);
+void            shmdup(struct shm*);
+void            shmput(struct shm*);
+char*           shmpage(struct shm*, uint);
+uint            shmsize(struct shm*);
+
 // swtch.S
 void            swtch(struct context**, struct context*);
 
@@ -129,10 +182,19 @@ void            acquire(struct spinlock*);
 void            getcallerpcs(void*, uint*);
 int             holding(struct spinlock*);
 void            initlock(struct spinlock*, char*);
+int             lockstatget(int, struct lockstat*);
 void            release(struct spinlock*);
 void            pushcli(void);
 void            popcli(void);
 
+// rcu.c
+void            callrcu(struct rcuhead*, void (*)(struct rcuhead*));
+void            rcuinit(void);
+void            rcustart(void);
+void            rcureadlock(void);
+void            rcureadunlock(void);
+void            rcusync(void);
+
 // sleeplock.c
 void            acquiresleep(struct sleeplock*);
 void            releasesleep(struct sleeplock*);
@@ -151,20 +213,29 @@ char*           strncpy(char*, const char*, int);
 // syscall.c
 int             argint(int, int*);
 int             argptr(int, char**, int);
-int             argstr(int, char**);
+int             argwptr(int, char**, int);
+int             argstr(int, char*, int);
 int             fetchint(uint, int*);
-int             fetchstr(uint, char**);
+int             fetchstr(uint, char*, int);
 void            syscall(void);
 
 // timer.c
 void            timerinit(void);
 
 // trap.c
+void            clockarm(void);
+void            clocktime(struct timespec*);
+void            clockupdate(void);
 void            idtinit(void);
+uint64_t        nexttimeout(void);
+int             sleepns(uint64_t);
 extern uint     ticks;
 void            tvinit(void);
 extern struct spinlock tickslock;
 
+// uaccess.S
+int             ucopy(void*, void*, uint);
+
 // uart.c
 void            uartinit(void);
 void            uartintr(void);
@@ -174,6 +245,13 @@ void            uartputc(int);
 int             strcmp(const char *p, const char *q);
 int             atoi(const char *s);
 
+// virtblk.c
+int             virtblkinit(uint, int);
+int             virtblkrw(struct buf*);
+
+// virtio.c
+int             virtiointr(int);
+
 // vm.c
 void            seginit(void);
 void            kvmalloc(void);
@@ -183,15 +261,33 @@ int             allocuvm(pde_t*, uint, uint);
 int             deallocuvm(pde_t*, uint, uint);
 void            freevm(pde_t*);
 void            inituvm(pde_t*, char*, uint);
-int             loaduvm(pde_t*, char*, struct inode*, uint, uint);
 pde_t*          copyuvm(pde_t*, uint);
 void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
+int             vmfault(struct proc*, uint, int);
+int             vmprefault(struct proc*, uint, uint, int);
+int             copymm(struct proc*, struct proc*);
+void            freevma(pde_t*, struct vma*);
+int             growmm(struct proc*, int);
+void            mminit(void);
+struct mm*      mmalloc(void);
+struct mm*      mmdup(struct mm*);
+void            mmput(struct mm*);
+void            mmlock(struct mm*);
+void            mmunlock(struct mm*);
+int             mmap(struct proc*, uint, int, struct inode*, uint);
+int             msync(struct proc*, uint, uint);
+int             munmap(struct proc*, uint, uint);
+int             shmmap(struct proc*, struct shm*);
+int             shmunmap(struct proc*, uint);
 
 // arp.c
 int             sendrequest(char * intrfc, char * ipaddr, char * arpresp);
 
+// nic.c
+void            nicinit(void);
+
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
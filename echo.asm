@@ -0,0 +1,1225 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  for(i = 1; i < argc; i++)
+  19:	83 fe 01             	cmp    $0x1,%esi
+  1c:	7e 47                	jle    65 <main+0x65>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  1e:	8b 47 04             	mov    0x4(%edi),%eax
+  21:	83 fe 02             	cmp    $0x2,%esi
+  24:	74 2a                	je     50 <main+0x50>
+  26:	bb 02 00 00 00       	mov    $0x2,%ebx
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  30:	68 a8 07 00 00       	push   $0x7a8
+  35:	83 c3 01             	add    $0x1,%ebx
+  38:	50                   	push   %eax
+  39:	68 aa 07 00 00       	push   $0x7aa
+  3e:	6a 01                	push   $0x1
+  40:	e8 3b 04 00 00       	call   480 <printf>
+  45:	8b 44 9f fc          	mov    -0x4(%edi,%ebx,4),%eax
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	39 f3                	cmp    %esi,%ebx
+  4e:	75 e0                	jne    30 <main+0x30>
+  50:	68 af 07 00 00       	push   $0x7af
+  55:	50                   	push   %eax
+  56:	68 aa 07 00 00       	push   $0x7aa
+  5b:	6a 01                	push   $0x1
+  5d:	e8 1e 04 00 00       	call   480 <printf>
+  62:	83 c4 10             	add    $0x10,%esp
+  exit();
+  65:	e8 4a 02 00 00       	call   2b4 <exit>
+  6a:	66 90                	xchg   %ax,%ax
+  6c:	66 90                	xchg   %ax,%ax
+  6e:	66 90                	xchg   %ax,%ax
+
+00000070 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  70:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  71:	31 c0                	xor    %eax,%eax
+{
+  73:	89 e5                	mov    %esp,%ebp
+  75:	53                   	push   %ebx
+  76:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  79:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  80:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  84:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  87:	83 c0 01             	add    $0x1,%eax
+  8a:	84 d2                	test   %dl,%dl
+  8c:	75 f2                	jne    80 <strcpy+0x10>
+    ;
+  return os;
+}
+  8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  91:	89 c8                	mov    %ecx,%eax
+  93:	c9                   	leave
+  94:	c3                   	ret
+  95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000a0 <strlen>:
+
+uint
+strlen(char *s)
+{
+  a0:	55                   	push   %ebp
+  a1:	89 e5                	mov    %esp,%ebp
+  a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  a6:	80 3a 00             	cmpb   $0x0,(%edx)
+  a9:	74 15                	je     c0 <strlen+0x20>
+  ab:	31 c0                	xor    %eax,%eax
+  ad:	8d 76 00             	lea    0x0(%esi),%esi
+  b0:	83 c0 01             	add    $0x1,%eax
+  b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  b7:	89 c1                	mov    %eax,%ecx
+  b9:	75 f5                	jne    b0 <strlen+0x10>
+    ;
+  return n;
+}
+  bb:	89 c8                	mov    %ecx,%eax
+  bd:	5d                   	pop    %ebp
+  be:	c3                   	ret
+  bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+  c0:	31 c9                	xor    %ecx,%ecx
+}
+  c2:	5d                   	pop    %ebp
+  c3:	89 c8                	mov    %ecx,%eax
+  c5:	c3                   	ret
+  c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000000d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  d0:	55                   	push   %ebp
+  d1:	89 e5                	mov    %esp,%ebp
+  d3:	57                   	push   %edi
+  d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  da:	8b 45 0c             	mov    0xc(%ebp),%eax
+  dd:	89 d7                	mov    %edx,%edi
+  df:	fc                   	cld
+  e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  e5:	89 d0                	mov    %edx,%eax
+  e7:	c9                   	leave
+  e8:	c3                   	ret
+  e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000000f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+  fa:	0f b6 10             	movzbl (%eax),%edx
+  fd:	84 d2                	test   %dl,%dl
+  ff:	75 12                	jne    113 <strchr+0x23>
+ 101:	eb 1d                	jmp    120 <strchr+0x30>
+ 103:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 107:	90                   	nop
+ 108:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 10c:	83 c0 01             	add    $0x1,%eax
+ 10f:	84 d2                	test   %dl,%dl
+ 111:	74 0d                	je     120 <strchr+0x30>
+    if(*s == c)
+ 113:	38 d1                	cmp    %dl,%cl
+ 115:	75 f1                	jne    108 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 117:	5d                   	pop    %ebp
+ 118:	c3                   	ret
+ 119:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 120:	31 c0                	xor    %eax,%eax
+}
+ 122:	5d                   	pop    %ebp
+ 123:	c3                   	ret
+ 124:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 12f:	90                   	nop
+
+00000130 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	57                   	push   %edi
+ 134:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 135:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 138:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 139:	31 db                	xor    %ebx,%ebx
+{
+ 13b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 13e:	eb 27                	jmp    167 <gets+0x37>
+    cc = read(0, &c, 1);
+ 140:	83 ec 04             	sub    $0x4,%esp
+ 143:	6a 01                	push   $0x1
+ 145:	56                   	push   %esi
+ 146:	6a 00                	push   $0x0
+ 148:	e8 7f 01 00 00       	call   2cc <read>
+    if(cc < 1)
+ 14d:	83 c4 10             	add    $0x10,%esp
+ 150:	85 c0                	test   %eax,%eax
+ 152:	7e 1d                	jle    171 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 154:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 158:	8b 55 08             	mov    0x8(%ebp),%edx
+ 15b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 15f:	3c 0a                	cmp    $0xa,%al
+ 161:	74 10                	je     173 <gets+0x43>
+ 163:	3c 0d                	cmp    $0xd,%al
+ 165:	74 0c                	je     173 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 167:	89 df                	mov    %ebx,%edi
+ 169:	83 c3 01             	add    $0x1,%ebx
+ 16c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 16f:	7c cf                	jl     140 <gets+0x10>
+ 171:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 173:	8b 45 08             	mov    0x8(%ebp),%eax
+ 176:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 17a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 17d:	5b                   	pop    %ebx
+ 17e:	5e                   	pop    %esi
+ 17f:	5f                   	pop    %edi
+ 180:	5d                   	pop    %ebp
+ 181:	c3                   	ret
+ 182:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000190 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	56                   	push   %esi
+ 194:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 195:	83 ec 08             	sub    $0x8,%esp
+ 198:	6a 00                	push   $0x0
+ 19a:	ff 75 08             	push   0x8(%ebp)
+ 19d:	e8 52 01 00 00       	call   2f4 <open>
+  if(fd < 0)
+ 1a2:	83 c4 10             	add    $0x10,%esp
+ 1a5:	85 c0                	test   %eax,%eax
+ 1a7:	78 27                	js     1d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1a9:	83 ec 08             	sub    $0x8,%esp
+ 1ac:	ff 75 0c             	push   0xc(%ebp)
+ 1af:	89 c3                	mov    %eax,%ebx
+ 1b1:	50                   	push   %eax
+ 1b2:	e8 55 01 00 00       	call   30c <fstat>
+  close(fd);
+ 1b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 1ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1bc:	e8 1b 01 00 00       	call   2dc <close>
+  return r;
+ 1c1:	83 c4 10             	add    $0x10,%esp
+}
+ 1c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1c7:	89 f0                	mov    %esi,%eax
+ 1c9:	5b                   	pop    %ebx
+ 1ca:	5e                   	pop    %esi
+ 1cb:	5d                   	pop    %ebp
+ 1cc:	c3                   	ret
+ 1cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 1d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1d5:	eb ed                	jmp    1c4 <stat+0x34>
+ 1d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1de:	66 90                	xchg   %ax,%ax
+
+000001e0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	56                   	push   %esi
+ 1e5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 1ee:	85 c0                	test   %eax,%eax
+ 1f0:	7e 13                	jle    205 <memmove+0x25>
+ 1f2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 1f4:	89 d7                	mov    %edx,%edi
+ 1f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 200:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 201:	39 f8                	cmp    %edi,%eax
+ 203:	75 fb                	jne    200 <memmove+0x20>
+  return vdst;
+}
+ 205:	5e                   	pop    %esi
+ 206:	89 d0                	mov    %edx,%eax
+ 208:	5f                   	pop    %edi
+ 209:	5d                   	pop    %ebp
+ 20a:	c3                   	ret
+ 20b:	66 90                	xchg   %ax,%ax
+ 20d:	66 90                	xchg   %ax,%ax
+ 20f:	90                   	nop
+
+00000210 <strcmp>:
+#include "types.h"
+#include "util.h"
+
+int
+strcmp(const char *p, const char *q)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	53                   	push   %ebx
+ 214:	8b 55 08             	mov    0x8(%ebp),%edx
+ 217:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 21a:	0f b6 02             	movzbl (%edx),%eax
+ 21d:	84 c0                	test   %al,%al
+ 21f:	75 17                	jne    238 <strcmp+0x28>
+ 221:	eb 3a                	jmp    25d <strcmp+0x4d>
+ 223:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 227:	90                   	nop
+ 228:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 22c:	83 c2 01             	add    $0x1,%edx
+ 22f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 232:	84 c0                	test   %al,%al
+ 234:	74 1a                	je     250 <strcmp+0x40>
+    p++, q++;
+ 236:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 238:	0f b6 19             	movzbl (%ecx),%ebx
+ 23b:	38 c3                	cmp    %al,%bl
+ 23d:	74 e9                	je     228 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 23f:	29 d8                	sub    %ebx,%eax
+}
+ 241:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 244:	c9                   	leave
+ 245:	c3                   	ret
+ 246:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 250:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 254:	31 c0                	xor    %eax,%eax
+ 256:	29 d8                	sub    %ebx,%eax
+}
+ 258:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 25b:	c9                   	leave
+ 25c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 25d:	0f b6 19             	movzbl (%ecx),%ebx
+ 260:	31 c0                	xor    %eax,%eax
+ 262:	eb db                	jmp    23f <strcmp+0x2f>
+ 264:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 26f:	90                   	nop
+
+00000270 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	53                   	push   %ebx
+ 274:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 277:	0f be 02             	movsbl (%edx),%eax
+ 27a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 27d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 280:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 285:	77 1e                	ja     2a5 <atoi+0x35>
+ 287:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 290:	83 c2 01             	add    $0x1,%edx
+ 293:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 296:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 29a:	0f be 02             	movsbl (%edx),%eax
+ 29d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2a0:	80 fb 09             	cmp    $0x9,%bl
+ 2a3:	76 eb                	jbe    290 <atoi+0x20>
+  return n;
+ 2a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2a8:	89 c8                	mov    %ecx,%eax
+ 2aa:	c9                   	leave
+ 2ab:	c3                   	ret
+
+000002ac <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2ac:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2b1:	cd 40                	int    $0x40
+ 2b3:	c3                   	ret
+
+000002b4 <exit>:
+SYSCALL(exit)
+ 2b4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2b9:	cd 40                	int    $0x40
+ 2bb:	c3                   	ret
+
+000002bc <wait>:
+SYSCALL(wait)
+ 2bc:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2c1:	cd 40                	int    $0x40
+ 2c3:	c3                   	ret
+
+000002c4 <pipe>:
+SYSCALL(pipe)
+ 2c4:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2c9:	cd 40                	int    $0x40
+ 2cb:	c3                   	ret
+
+000002cc <read>:
+SYSCALL(read)
+ 2cc:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2d1:	cd 40                	int    $0x40
+ 2d3:	c3                   	ret
+
+000002d4 <write>:
+SYSCALL(write)
+ 2d4:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2d9:	cd 40                	int    $0x40
+ 2db:	c3                   	ret
+
+000002dc <close>:
+SYSCALL(close)
+ 2dc:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2e1:	cd 40                	int    $0x40
+ 2e3:	c3                   	ret
+
+000002e4 <kill>:
+SYSCALL(kill)
+ 2e4:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2e9:	cd 40                	int    $0x40
+ 2eb:	c3                   	ret
+
+000002ec <exec>:
+SYSCALL(exec)
+ 2ec:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2f1:	cd 40                	int    $0x40
+ 2f3:	c3                   	ret
+
+000002f4 <open>:
+SYSCALL(open)
+ 2f4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2f9:	cd 40                	int    $0x40
+ 2fb:	c3                   	ret
+
+000002fc <mknod>:
+SYSCALL(mknod)
+ 2fc:	b8 11 00 00 00       	mov    $0x11,%eax
+ 301:	cd 40                	int    $0x40
+ 303:	c3                   	ret
+
+00000304 <unlink>:
+SYSCALL(unlink)
+ 304:	b8 12 00 00 00       	mov    $0x12,%eax
+ 309:	cd 40                	int    $0x40
+ 30b:	c3                   	ret
+
+0000030c <fstat>:
+SYSCALL(fstat)
+ 30c:	b8 08 00 00 00       	mov    $0x8,%eax
+ 311:	cd 40                	int    $0x40
+ 313:	c3                   	ret
+
+00000314 <link>:
+SYSCALL(link)
+ 314:	b8 13 00 00 00       	mov    $0x13,%eax
+ 319:	cd 40                	int    $0x40
+ 31b:	c3                   	ret
+
+0000031c <mkdir>:
+SYSCALL(mkdir)
+ 31c:	b8 14 00 00 00       	mov    $0x14,%eax
+ 321:	cd 40                	int    $0x40
+ 323:	c3                   	ret
+
+00000324 <chdir>:
+SYSCALL(chdir)
+ 324:	b8 09 00 00 00       	mov    $0x9,%eax
+ 329:	cd 40                	int    $0x40
+ 32b:	c3                   	ret
+
+0000032c <dup>:
+SYSCALL(dup)
+ 32c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 331:	cd 40                	int    $0x40
+ 333:	c3                   	ret
+
+00000334 <getpid>:
+SYSCALL(getpid)
+ 334:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 339:	cd 40                	int    $0x40
+ 33b:	c3                   	ret
+
+0000033c <sbrk>:
+SYSCALL(sbrk)
+ 33c:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 341:	cd 40                	int    $0x40
+ 343:	c3                   	ret
+
+00000344 <sleep>:
+SYSCALL(sleep)
+ 344:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 349:	cd 40                	int    $0x40
+ 34b:	c3                   	ret
+
+0000034c <uptime>:
+SYSCALL(uptime)
+ 34c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 351:	cd 40                	int    $0x40
+ 353:	c3                   	ret
+
+00000354 <arp>:
+SYSCALL(arp)
+ 354:	b8 16 00 00 00       	mov    $0x16,%eax
+ 359:	cd 40                	int    $0x40
+ 35b:	c3                   	ret
+
+0000035c <mmap>:
+SYSCALL(mmap)
+ 35c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 361:	cd 40                	int    $0x40
+ 363:	c3                   	ret
+
+00000364 <munmap>:
+SYSCALL(munmap)
+ 364:	b8 18 00 00 00       	mov    $0x18,%eax
+ 369:	cd 40                	int    $0x40
+ 36b:	c3                   	ret
+
+0000036c <msync>:
+SYSCALL(msync)
+ 36c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 371:	cd 40                	int    $0x40
+ 373:	c3                   	ret
+
+00000374 <shmcreate>:
+SYSCALL(shmcreate)
+ 374:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 379:	cd 40                	int    $0x40
+ 37b:	c3                   	ret
+
+0000037c <shmattach>:
+SYSCALL(shmattach)
+ 37c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 381:	cd 40                	int    $0x40
+ 383:	c3                   	ret
+
+00000384 <shmdetach>:
+SYSCALL(shmdetach)
+ 384:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 389:	cd 40                	int    $0x40
+ 38b:	c3                   	ret
+
+0000038c <futex_wait>:
+SYSCALL(futex_wait)
+ 38c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 391:	cd 40                	int    $0x40
+ 393:	c3                   	ret
+
+00000394 <futex_wake>:
+SYSCALL(futex_wake)
+ 394:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 399:	cd 40                	int    $0x40
+ 39b:	c3                   	ret
+
+0000039c <nice>:
+SYSCALL(nice)
+ 39c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3a1:	cd 40                	int    $0x40
+ 3a3:	c3                   	ret
+
+000003a4 <setpriority>:
+SYSCALL(setpriority)
+ 3a4:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3a9:	cd 40                	int    $0x40
+ 3ab:	c3                   	ret
+
+000003ac <cputime>:
+SYSCALL(cputime)
+ 3ac:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3b1:	cd 40                	int    $0x40
+ 3b3:	c3                   	ret
+
+000003b4 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 3b4:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3b9:	cd 40                	int    $0x40
+ 3bb:	c3                   	ret
+
+000003bc <clone>:
+SYSCALL(clone)
+ 3bc:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3c1:	cd 40                	int    $0x40
+ 3c3:	c3                   	ret
+
+000003c4 <join>:
+SYSCALL(join)
+ 3c4:	b8 24 00 00 00       	mov    $0x24,%eax
+ 3c9:	cd 40                	int    $0x40
+ 3cb:	c3                   	ret
+
+000003cc <lockstat>:
+SYSCALL(lockstat)
+ 3cc:	b8 25 00 00 00       	mov    $0x25,%eax
+ 3d1:	cd 40                	int    $0x40
+ 3d3:	c3                   	ret
+ 3d4:	66 90                	xchg   %ax,%ax
+ 3d6:	66 90                	xchg   %ax,%ax
+ 3d8:	66 90                	xchg   %ax,%ax
+ 3da:	66 90                	xchg   %ax,%ax
+ 3dc:	66 90                	xchg   %ax,%ax
+ 3de:	66 90                	xchg   %ax,%ax
+
+000003e0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	57                   	push   %edi
+ 3e4:	56                   	push   %esi
+ 3e5:	53                   	push   %ebx
+ 3e6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 3e8:	89 d1                	mov    %edx,%ecx
+{
+ 3ea:	83 ec 3c             	sub    $0x3c,%esp
+ 3ed:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 3f0:	85 d2                	test   %edx,%edx
+ 3f2:	0f 89 80 00 00 00    	jns    478 <printint+0x98>
+ 3f8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 3fc:	74 7a                	je     478 <printint+0x98>
+    x = -xx;
+ 3fe:	f7 d9                	neg    %ecx
+    neg = 1;
+ 400:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 405:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 408:	31 f6                	xor    %esi,%esi
+ 40a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 410:	89 c8                	mov    %ecx,%eax
+ 412:	31 d2                	xor    %edx,%edx
+ 414:	89 f7                	mov    %esi,%edi
+ 416:	f7 f3                	div    %ebx
+ 418:	8d 76 01             	lea    0x1(%esi),%esi
+ 41b:	0f b6 92 10 08 00 00 	movzbl 0x810(%edx),%edx
+ 422:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 426:	89 ca                	mov    %ecx,%edx
+ 428:	89 c1                	mov    %eax,%ecx
+ 42a:	39 da                	cmp    %ebx,%edx
+ 42c:	73 e2                	jae    410 <printint+0x30>
+  if(neg)
+ 42e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 431:	85 c0                	test   %eax,%eax
+ 433:	74 07                	je     43c <printint+0x5c>
+    buf[i++] = '-';
+ 435:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 43a:	89 f7                	mov    %esi,%edi
+ 43c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 43f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 442:	01 df                	add    %ebx,%edi
+ 444:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 448:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 44b:	83 ec 04             	sub    $0x4,%esp
+ 44e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 451:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 454:	6a 01                	push   $0x1
+ 456:	50                   	push   %eax
+ 457:	56                   	push   %esi
+ 458:	e8 77 fe ff ff       	call   2d4 <write>
+  while(--i >= 0)
+ 45d:	89 f8                	mov    %edi,%eax
+ 45f:	83 c4 10             	add    $0x10,%esp
+ 462:	83 ef 01             	sub    $0x1,%edi
+ 465:	39 d8                	cmp    %ebx,%eax
+ 467:	75 df                	jne    448 <printint+0x68>
+}
+ 469:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 46c:	5b                   	pop    %ebx
+ 46d:	5e                   	pop    %esi
+ 46e:	5f                   	pop    %edi
+ 46f:	5d                   	pop    %ebp
+ 470:	c3                   	ret
+ 471:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 478:	31 c0                	xor    %eax,%eax
+ 47a:	eb 89                	jmp    405 <printint+0x25>
+ 47c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	57                   	push   %edi
+ 484:	56                   	push   %esi
+ 485:	53                   	push   %ebx
+ 486:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 489:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 48c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 48f:	0f b6 1e             	movzbl (%esi),%ebx
+ 492:	83 c6 01             	add    $0x1,%esi
+ 495:	84 db                	test   %bl,%bl
+ 497:	74 67                	je     500 <printf+0x80>
+ 499:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 49c:	31 d2                	xor    %edx,%edx
+ 49e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 4a1:	eb 34                	jmp    4d7 <printf+0x57>
+ 4a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4a7:	90                   	nop
+ 4a8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 4ab:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 4b0:	83 f8 25             	cmp    $0x25,%eax
+ 4b3:	74 18                	je     4cd <printf+0x4d>
+  write(fd, &c, 1);
+ 4b5:	83 ec 04             	sub    $0x4,%esp
+ 4b8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 4bb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 4be:	6a 01                	push   $0x1
+ 4c0:	50                   	push   %eax
+ 4c1:	57                   	push   %edi
+ 4c2:	e8 0d fe ff ff       	call   2d4 <write>
+ 4c7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 4ca:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 4cd:	0f b6 1e             	movzbl (%esi),%ebx
+ 4d0:	83 c6 01             	add    $0x1,%esi
+ 4d3:	84 db                	test   %bl,%bl
+ 4d5:	74 29                	je     500 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 4d7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 4da:	85 d2                	test   %edx,%edx
+ 4dc:	74 ca                	je     4a8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 4de:	83 fa 25             	cmp    $0x25,%edx
+ 4e1:	75 ea                	jne    4cd <printf+0x4d>
+      if(c == 'd'){
+ 4e3:	83 f8 25             	cmp    $0x25,%eax
+ 4e6:	0f 84 24 01 00 00    	je     610 <printf+0x190>
+ 4ec:	83 e8 63             	sub    $0x63,%eax
+ 4ef:	83 f8 15             	cmp    $0x15,%eax
+ 4f2:	77 1c                	ja     510 <printf+0x90>
+ 4f4:	ff 24 85 b8 07 00 00 	jmp    *0x7b8(,%eax,4)
+ 4fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4ff:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 500:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 503:	5b                   	pop    %ebx
+ 504:	5e                   	pop    %esi
+ 505:	5f                   	pop    %edi
+ 506:	5d                   	pop    %ebp
+ 507:	c3                   	ret
+ 508:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50f:	90                   	nop
+  write(fd, &c, 1);
+ 510:	83 ec 04             	sub    $0x4,%esp
+ 513:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 516:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 51a:	6a 01                	push   $0x1
+ 51c:	52                   	push   %edx
+ 51d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 520:	57                   	push   %edi
+ 521:	e8 ae fd ff ff       	call   2d4 <write>
+ 526:	83 c4 0c             	add    $0xc,%esp
+ 529:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 52c:	6a 01                	push   $0x1
+ 52e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 531:	52                   	push   %edx
+ 532:	57                   	push   %edi
+ 533:	e8 9c fd ff ff       	call   2d4 <write>
+        putc(fd, c);
+ 538:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 53b:	31 d2                	xor    %edx,%edx
+ 53d:	eb 8e                	jmp    4cd <printf+0x4d>
+ 53f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 540:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 543:	83 ec 0c             	sub    $0xc,%esp
+ 546:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 54b:	8b 13                	mov    (%ebx),%edx
+ 54d:	6a 00                	push   $0x0
+ 54f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 551:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 554:	e8 87 fe ff ff       	call   3e0 <printint>
+        ap++;
+ 559:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 55c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 55f:	31 d2                	xor    %edx,%edx
+ 561:	e9 67 ff ff ff       	jmp    4cd <printf+0x4d>
+ 566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 570:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 573:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 575:	83 c0 04             	add    $0x4,%eax
+ 578:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 57b:	85 db                	test   %ebx,%ebx
+ 57d:	0f 84 9d 00 00 00    	je     620 <printf+0x1a0>
+        while(*s != 0){
+ 583:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 586:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 588:	84 c0                	test   %al,%al
+ 58a:	0f 84 3d ff ff ff    	je     4cd <printf+0x4d>
+ 590:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 593:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 596:	89 de                	mov    %ebx,%esi
+ 598:	89 d3                	mov    %edx,%ebx
+ 59a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 5a0:	83 ec 04             	sub    $0x4,%esp
+ 5a3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 5a6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 5a9:	6a 01                	push   $0x1
+ 5ab:	53                   	push   %ebx
+ 5ac:	57                   	push   %edi
+ 5ad:	e8 22 fd ff ff       	call   2d4 <write>
+        while(*s != 0){
+ 5b2:	0f b6 06             	movzbl (%esi),%eax
+ 5b5:	83 c4 10             	add    $0x10,%esp
+ 5b8:	84 c0                	test   %al,%al
+ 5ba:	75 e4                	jne    5a0 <printf+0x120>
+      state = 0;
+ 5bc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 5bf:	31 d2                	xor    %edx,%edx
+ 5c1:	e9 07 ff ff ff       	jmp    4cd <printf+0x4d>
+ 5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 5d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5d3:	83 ec 0c             	sub    $0xc,%esp
+ 5d6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5db:	8b 13                	mov    (%ebx),%edx
+ 5dd:	6a 01                	push   $0x1
+ 5df:	e9 6b ff ff ff       	jmp    54f <printf+0xcf>
+ 5e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 5e8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 5eb:	83 ec 04             	sub    $0x4,%esp
+ 5ee:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 5f1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 5f3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 5f6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5f9:	6a 01                	push   $0x1
+ 5fb:	52                   	push   %edx
+ 5fc:	57                   	push   %edi
+ 5fd:	e8 d2 fc ff ff       	call   2d4 <write>
+        ap++;
+ 602:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 605:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 608:	31 d2                	xor    %edx,%edx
+ 60a:	e9 be fe ff ff       	jmp    4cd <printf+0x4d>
+ 60f:	90                   	nop
+  write(fd, &c, 1);
+ 610:	83 ec 04             	sub    $0x4,%esp
+ 613:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 616:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 619:	6a 01                	push   $0x1
+ 61b:	e9 11 ff ff ff       	jmp    531 <printf+0xb1>
+ 620:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 625:	bb b1 07 00 00       	mov    $0x7b1,%ebx
+ 62a:	e9 61 ff ff ff       	jmp    590 <printf+0x110>
+ 62f:	90                   	nop
+
+00000630 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 630:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 631:	a1 b8 0a 00 00       	mov    0xab8,%eax
+{
+ 636:	89 e5                	mov    %esp,%ebp
+ 638:	57                   	push   %edi
+ 639:	56                   	push   %esi
+ 63a:	53                   	push   %ebx
+ 63b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 63e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 641:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 648:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 64a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 64c:	39 ca                	cmp    %ecx,%edx
+ 64e:	73 30                	jae    680 <free+0x50>
+ 650:	39 c1                	cmp    %eax,%ecx
+ 652:	72 04                	jb     658 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 654:	39 c2                	cmp    %eax,%edx
+ 656:	72 f0                	jb     648 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 658:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 65b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 65e:	39 f8                	cmp    %edi,%eax
+ 660:	74 2e                	je     690 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 662:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 665:	8b 42 04             	mov    0x4(%edx),%eax
+ 668:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 66b:	39 f1                	cmp    %esi,%ecx
+ 66d:	74 38                	je     6a7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 66f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 671:	5b                   	pop    %ebx
+  freep = p;
+ 672:	89 15 b8 0a 00 00    	mov    %edx,0xab8
+}
+ 678:	5e                   	pop    %esi
+ 679:	5f                   	pop    %edi
+ 67a:	5d                   	pop    %ebp
+ 67b:	c3                   	ret
+ 67c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 680:	39 c1                	cmp    %eax,%ecx
+ 682:	72 d0                	jb     654 <free+0x24>
+ 684:	eb c2                	jmp    648 <free+0x18>
+ 686:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 68d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 690:	03 70 04             	add    0x4(%eax),%esi
+ 693:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 696:	8b 02                	mov    (%edx),%eax
+ 698:	8b 00                	mov    (%eax),%eax
+ 69a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 69d:	8b 42 04             	mov    0x4(%edx),%eax
+ 6a0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 6a3:	39 f1                	cmp    %esi,%ecx
+ 6a5:	75 c8                	jne    66f <free+0x3f>
+    p->s.size += bp->s.size;
+ 6a7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 6aa:	89 15 b8 0a 00 00    	mov    %edx,0xab8
+    p->s.size += bp->s.size;
+ 6b0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 6b3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 6b6:	89 0a                	mov    %ecx,(%edx)
+}
+ 6b8:	5b                   	pop    %ebx
+ 6b9:	5e                   	pop    %esi
+ 6ba:	5f                   	pop    %edi
+ 6bb:	5d                   	pop    %ebp
+ 6bc:	c3                   	ret
+ 6bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006c0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 6c0:	55                   	push   %ebp
+ 6c1:	89 e5                	mov    %esp,%ebp
+ 6c3:	57                   	push   %edi
+ 6c4:	56                   	push   %esi
+ 6c5:	53                   	push   %ebx
+ 6c6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 6cc:	8b 15 b8 0a 00 00    	mov    0xab8,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6d2:	8d 78 07             	lea    0x7(%eax),%edi
+ 6d5:	c1 ef 03             	shr    $0x3,%edi
+ 6d8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 6db:	85 d2                	test   %edx,%edx
+ 6dd:	0f 84 8d 00 00 00    	je     770 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6e3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6e5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6e8:	39 f9                	cmp    %edi,%ecx
+ 6ea:	73 64                	jae    750 <malloc+0x90>
+  if(nu < 4096)
+ 6ec:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 6f1:	39 df                	cmp    %ebx,%edi
+ 6f3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 6f6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 6fd:	eb 0a                	jmp    709 <malloc+0x49>
+ 6ff:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 700:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 702:	8b 48 04             	mov    0x4(%eax),%ecx
+ 705:	39 f9                	cmp    %edi,%ecx
+ 707:	73 47                	jae    750 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 709:	89 c2                	mov    %eax,%edx
+ 70b:	39 05 b8 0a 00 00    	cmp    %eax,0xab8
+ 711:	75 ed                	jne    700 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 713:	83 ec 0c             	sub    $0xc,%esp
+ 716:	56                   	push   %esi
+ 717:	e8 20 fc ff ff       	call   33c <sbrk>
+  if(p == (char*)-1)
+ 71c:	83 c4 10             	add    $0x10,%esp
+ 71f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 722:	74 1c                	je     740 <malloc+0x80>
+  hp->s.size = nu;
+ 724:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 727:	83 ec 0c             	sub    $0xc,%esp
+ 72a:	83 c0 08             	add    $0x8,%eax
+ 72d:	50                   	push   %eax
+ 72e:	e8 fd fe ff ff       	call   630 <free>
+  return freep;
+ 733:	8b 15 b8 0a 00 00    	mov    0xab8,%edx
+      if((p = morecore(nunits)) == 0)
+ 739:	83 c4 10             	add    $0x10,%esp
+ 73c:	85 d2                	test   %edx,%edx
+ 73e:	75 c0                	jne    700 <malloc+0x40>
+        return 0;
+  }
+}
+ 740:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 743:	31 c0                	xor    %eax,%eax
+}
+ 745:	5b                   	pop    %ebx
+ 746:	5e                   	pop    %esi
+ 747:	5f                   	pop    %edi
+ 748:	5d                   	pop    %ebp
+ 749:	c3                   	ret
+ 74a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 750:	39 cf                	cmp    %ecx,%edi
+ 752:	74 4c                	je     7a0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 754:	29 f9                	sub    %edi,%ecx
+ 756:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 759:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 75c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 75f:	89 15 b8 0a 00 00    	mov    %edx,0xab8
+}
+ 765:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 768:	83 c0 08             	add    $0x8,%eax
+}
+ 76b:	5b                   	pop    %ebx
+ 76c:	5e                   	pop    %esi
+ 76d:	5f                   	pop    %edi
+ 76e:	5d                   	pop    %ebp
+ 76f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 770:	c7 05 b8 0a 00 00 bc 	movl   $0xabc,0xab8
+ 777:	0a 00 00 
+    base.s.size = 0;
+ 77a:	b8 bc 0a 00 00       	mov    $0xabc,%eax
+    base.s.ptr = freep = prevp = &base;
+ 77f:	c7 05 bc 0a 00 00 bc 	movl   $0xabc,0xabc
+ 786:	0a 00 00 
+    base.s.size = 0;
+ 789:	c7 05 c0 0a 00 00 00 	movl   $0x0,0xac0
+ 790:	00 00 00 
+    if(p->s.size >= nunits){
+ 793:	e9 54 ff ff ff       	jmp    6ec <malloc+0x2c>
+ 798:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 79f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 7a0:	8b 08                	mov    (%eax),%ecx
+ 7a2:	89 0a                	mov    %ecx,(%edx)
+ 7a4:	eb b9                	jmp    75f <malloc+0x9f>
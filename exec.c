@@ -16,13 +16,20 @@ exec(char *path, char **argv)
   struct elfhdr elf;
   struct inode *ip;
   struct proghdr ph;
-  pde_t *pgdir, *oldpgdir;
+  pde_t *pgdir;
+  struct mm *mm, *oldmm;
+  struct vma *v;
   struct proc *curproc = myproc();
 
+  // The new image gets an address space of its own, leaving
+  // any other threads the old one.
+  if((mm = mmalloc()) == 0)
+    return -1;
   begin_op();
 
   if((ip = namei(path)) == 0){
     end_op();
+    mmput(mm);
     cprintf("exec: fail\n");
     return -1;
   }
@@ -37,24 +44,36 @@ exec(char *path, char **argv)
 
   if((pgdir = setupkvm()) == 0)
     goto bad;
+  mm->pgdir = pgdir;
 
-  // Load program into memory.
+  // Record where each segment lives in the file; vmfault()
+  // reads the pages in as the program touches them.
   sz = 0;
+  v = mm->vma;
   for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
     if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
       goto bad;
-    if(ph.type != ELF_PROG_LOAD)
+    if(ph.type != ELF_PROG_LOAD || ph.memsz == 0)
       continue;
     if(ph.memsz < ph.filesz)
       goto bad;
     if(ph.vaddr + ph.memsz < ph.vaddr)
       goto bad;
-    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
+    if(ph.vaddr + ph.memsz >= KERNBASE)
       goto bad;
     if(ph.vaddr % PGSIZE != 0)
       goto bad;
-    if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
+    if(v == &mm->vma[NVMA])
       goto bad;
+    v->start = ph.vaddr;
+    v->end = PGROUNDUP(ph.vaddr + ph.memsz);
+    v->flags = (ph.flags & ELF_PROG_FLAG_WRITE) ? VMA_WRITE : 0;
+    v->ip = idup(ip);
+    v->off = ph.off;
+    v->filesz = ph.filesz;
+    if(v->end > sz)
+      sz = v->end;
+    v++;
   }
   iunlockput(ip);
   end_op();
@@ -94,21 +113,21 @@ exec(char *path, char **argv)
   safestrcpy(curproc->name, last, sizeof(curproc->name));
 
   // Commit to the user image.
-  oldpgdir = curproc->pgdir;
-  curproc->pgdir = pgdir;
-  curproc->sz = sz;
+  oldmm = curproc->mm;
+  mm->sz = sz;
+  curproc->mm = mm;
   curproc->tf->eip = elf.entry;  // main
   curproc->tf->esp = sp;
   switchuvm(curproc);
-  freevm(oldpgdir);
+  execthreads(oldmm);
+  mmput(oldmm);
   return 0;
 
  bad:
-  if(pgdir)
-    freevm(pgdir);
   if(ip){
     iunlockput(ip);
     end_op();
   }
+  mmput(mm);
   return -1;
 }
@@ -16,10 +16,103 @@ struct {
   struct file file[NFILE];
 } ftable;
 
+struct {
+  struct spinlock lock;
+  struct files files[NPROC];
+} fdtable;
+
 void
 fileinit(void)
 {
+  struct files *fs;
+
   initlock(&ftable.lock, "ftable");
+  initlock(&fdtable.lock, "fdtable");
+  for(fs = fdtable.files; fs < fdtable.files + NPROC; fs++)
+    initlock(&fs->lock, "files");
+}
+
+// Allocate an empty file descriptor table.
+struct files*
+filesalloc(void)
+{
+  struct files *fs;
+
+  acquire(&fdtable.lock);
+  for(fs = fdtable.files; fs < fdtable.files + NPROC; fs++){
+    if(fs->ref == 0){
+      fs->ref = 1;
+      release(&fdtable.lock);
+      return fs;
+    }
+  }
+  release(&fdtable.lock);
+  return 0;
+}
+
+// Make a new table with the same files and directory
+// as fs, for a child process.
+struct files*
+filescopy(struct files *fs)
+{
+  struct files *nfs;
+  int fd;
+
+  if((nfs = filesalloc()) == 0)
+    return 0;
+  acquire(&fs->lock);
+  for(fd = 0; fd < NOFILE; fd++)
+    if(fs->ofile[fd])
+      nfs->ofile[fd] = filedup(fs->ofile[fd]);
+  nfs->cwd = idup(fs->cwd);
+  release(&fs->lock);
+  return nfs;
+}
+
+// Increment ref count for table fs.
+struct files*
+filesdup(struct files *fs)
+{
+  acquire(&fdtable.lock);
+  if(fs->ref < 1)
+    panic("filesdup");
+  fs->ref++;
+  release(&fdtable.lock);
+  return fs;
+}
+
+// Drop a reference to table fs.  The last one closes
+// its files and releases its directory.
+void
+filesput(struct files *fs)
+{
+  struct file *ofile[NOFILE];
+  struct inode *cwd;
+  int fd;
+
+  acquire(&fdtable.lock);
+  if(fs->ref < 1)
+    panic("filesput");
+  if(fs->ref > 1){
+    fs->ref--;
+    release(&fdtable.lock);
+    return;
+  }
+  memmove(ofile, fs->ofile, sizeof(ofile));
+  cwd = fs->cwd;
+  memset(fs->ofile, 0, sizeof(fs->ofile));
+  fs->cwd = 0;
+  fs->ref = 0;
+  release(&fdtable.lock);
+
+  for(fd = 0; fd < NOFILE; fd++)
+    if(ofile[fd])
+      fileclose(ofile[fd]);
+  if(cwd){
+    begin_op();
+    iput(cwd);
+    end_op();
+  }
 }
 
 // Allocate a file structure.
@@ -130,7 +223,7 @@ filewrite(struct file *f, char *addr, int n)
     // and 2 blocks of slop for non-aligned writes.
     // this really belongs lower down, since writei()
     // might be writing a device like the console.
-    int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
+    int max = ((MAXOPBLOCKS-1-1-2) / 2) * BSIZE;
     int i = 0;
     while(i < n){
       int n1 = n - i;
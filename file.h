@@ -8,21 +8,40 @@ struct file {
   uint off;
 };
 
+// The open files and current directory of a process,
+// shared by its threads.
+struct files {
+  struct spinlock lock;  // protects ofile and cwd
+  int ref;               // threads using it; 0 if free
+  struct file *ofile[NOFILE];
+  struct inode *cwd;
+};
+
 
 // in-memory copy of an inode
 struct inode {
   uint dev;           // Device number
   uint inum;          // Inode number
   int ref;            // Reference count
+  struct inode *hnext;   // hash chain, protected by icache.lock
+  struct inode *lprev;   // unused list, likewise
+  struct inode *lnext;
   struct sleeplock lock; // protects everything below here
   int valid;          // inode has been read from disk?
+  uint ralast;        // last block read, for read-ahead
+  uint ranext;        // next block to read ahead
+  uint rawin;         // read-ahead window, in blocks; 0 if not sequential
+  uint goal;          // block after the last one bmap() found
+  struct dirhash *dirhash;  // index of a directory's entries, or 0
+  int dhfull;         // directory too big to index
+  int pcached;        // may have pages in the page cache
 
   short type;         // copy of disk inode
   short major;
   short minor;
   short nlink;
   uint size;
-  uint addrs[NDIRECT+1];
+  uint addrs[NDIRECT+2];
 };
 
 // table mapping major device number to
@@ -0,0 +1,747 @@
+
+_forktest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "fork test OK\n");
+}
+
+int
+main(void)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 e4 f0             	and    $0xfffffff0,%esp
+  forktest();
+   6:	e8 35 00 00 00       	call   40 <forktest>
+  exit();
+   b:	e8 54 03 00 00       	call   364 <exit>
+
+00000010 <printf>:
+{
+  10:	55                   	push   %ebp
+  11:	89 e5                	mov    %esp,%ebp
+  13:	53                   	push   %ebx
+  14:	83 ec 10             	sub    $0x10,%esp
+  17:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  write(fd, s, strlen(s));
+  1a:	53                   	push   %ebx
+  1b:	e8 30 01 00 00       	call   150 <strlen>
+  20:	83 c4 0c             	add    $0xc,%esp
+  23:	50                   	push   %eax
+  24:	53                   	push   %ebx
+  25:	ff 75 08             	push   0x8(%ebp)
+  28:	e8 57 03 00 00       	call   384 <write>
+}
+  2d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  30:	83 c4 10             	add    $0x10,%esp
+  33:	c9                   	leave
+  34:	c3                   	ret
+  35:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000040 <forktest>:
+{
+  40:	55                   	push   %ebp
+  41:	89 e5                	mov    %esp,%ebp
+  43:	53                   	push   %ebx
+  for(n=0; n<N; n++){
+  44:	31 db                	xor    %ebx,%ebx
+{
+  46:	83 ec 10             	sub    $0x10,%esp
+  write(fd, s, strlen(s));
+  49:	68 84 04 00 00       	push   $0x484
+  4e:	e8 fd 00 00 00       	call   150 <strlen>
+  53:	83 c4 0c             	add    $0xc,%esp
+  56:	50                   	push   %eax
+  57:	68 84 04 00 00       	push   $0x484
+  5c:	6a 01                	push   $0x1
+  5e:	e8 21 03 00 00       	call   384 <write>
+  63:	83 c4 10             	add    $0x10,%esp
+  66:	eb 19                	jmp    81 <forktest+0x41>
+  68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6f:	90                   	nop
+    if(pid == 0)
+  70:	74 5b                	je     cd <forktest+0x8d>
+  for(n=0; n<N; n++){
+  72:	83 c3 01             	add    $0x1,%ebx
+  75:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+  7b:	0f 84 86 00 00 00    	je     107 <forktest+0xc7>
+    pid = fork();
+  81:	e8 d6 02 00 00       	call   35c <fork>
+    if(pid < 0)
+  86:	85 c0                	test   %eax,%eax
+  88:	79 e6                	jns    70 <forktest+0x30>
+  for(; n > 0; n--){
+  8a:	85 db                	test   %ebx,%ebx
+  8c:	74 10                	je     9e <forktest+0x5e>
+  8e:	66 90                	xchg   %ax,%ax
+    if(wait() < 0){
+  90:	e8 d7 02 00 00       	call   36c <wait>
+  95:	85 c0                	test   %eax,%eax
+  97:	78 39                	js     d2 <forktest+0x92>
+  for(; n > 0; n--){
+  99:	83 eb 01             	sub    $0x1,%ebx
+  9c:	75 f2                	jne    90 <forktest+0x50>
+  if(wait() != -1){
+  9e:	e8 c9 02 00 00       	call   36c <wait>
+  a3:	83 f8 ff             	cmp    $0xffffffff,%eax
+  a6:	75 4c                	jne    f4 <forktest+0xb4>
+  write(fd, s, strlen(s));
+  a8:	83 ec 0c             	sub    $0xc,%esp
+  ab:	68 b6 04 00 00       	push   $0x4b6
+  b0:	e8 9b 00 00 00       	call   150 <strlen>
+  b5:	83 c4 0c             	add    $0xc,%esp
+  b8:	50                   	push   %eax
+  b9:	68 b6 04 00 00       	push   $0x4b6
+  be:	6a 01                	push   $0x1
+  c0:	e8 bf 02 00 00       	call   384 <write>
+}
+  c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  c8:	83 c4 10             	add    $0x10,%esp
+  cb:	c9                   	leave
+  cc:	c3                   	ret
+      exit();
+  cd:	e8 92 02 00 00       	call   364 <exit>
+  write(fd, s, strlen(s));
+  d2:	83 ec 0c             	sub    $0xc,%esp
+  d5:	68 8f 04 00 00       	push   $0x48f
+  da:	e8 71 00 00 00       	call   150 <strlen>
+  df:	83 c4 0c             	add    $0xc,%esp
+  e2:	50                   	push   %eax
+  e3:	68 8f 04 00 00       	push   $0x48f
+  e8:	6a 01                	push   $0x1
+  ea:	e8 95 02 00 00       	call   384 <write>
+      exit();
+  ef:	e8 70 02 00 00       	call   364 <exit>
+    printf(1, "wait got too many\n");
+  f4:	50                   	push   %eax
+  f5:	50                   	push   %eax
+  f6:	68 a3 04 00 00       	push   $0x4a3
+  fb:	6a 01                	push   $0x1
+  fd:	e8 0e ff ff ff       	call   10 <printf>
+    exit();
+ 102:	e8 5d 02 00 00       	call   364 <exit>
+    printf(1, "fork claimed to work N times!\n", N);
+ 107:	52                   	push   %edx
+ 108:	68 e8 03 00 00       	push   $0x3e8
+ 10d:	68 c4 04 00 00       	push   $0x4c4
+ 112:	6a 01                	push   $0x1
+ 114:	e8 f7 fe ff ff       	call   10 <printf>
+    exit();
+ 119:	e8 46 02 00 00       	call   364 <exit>
+ 11e:	66 90                	xchg   %ax,%ax
+
+00000120 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 120:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 121:	31 c0                	xor    %eax,%eax
+{
+ 123:	89 e5                	mov    %esp,%ebp
+ 125:	53                   	push   %ebx
+ 126:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 129:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 130:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 134:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 137:	83 c0 01             	add    $0x1,%eax
+ 13a:	84 d2                	test   %dl,%dl
+ 13c:	75 f2                	jne    130 <strcpy+0x10>
+    ;
+  return os;
+}
+ 13e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 141:	89 c8                	mov    %ecx,%eax
+ 143:	c9                   	leave
+ 144:	c3                   	ret
+ 145:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 156:	80 3a 00             	cmpb   $0x0,(%edx)
+ 159:	74 15                	je     170 <strlen+0x20>
+ 15b:	31 c0                	xor    %eax,%eax
+ 15d:	8d 76 00             	lea    0x0(%esi),%esi
+ 160:	83 c0 01             	add    $0x1,%eax
+ 163:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 167:	89 c1                	mov    %eax,%ecx
+ 169:	75 f5                	jne    160 <strlen+0x10>
+    ;
+  return n;
+}
+ 16b:	89 c8                	mov    %ecx,%eax
+ 16d:	5d                   	pop    %ebp
+ 16e:	c3                   	ret
+ 16f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 170:	31 c9                	xor    %ecx,%ecx
+}
+ 172:	5d                   	pop    %ebp
+ 173:	89 c8                	mov    %ecx,%eax
+ 175:	c3                   	ret
+ 176:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000180 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	57                   	push   %edi
+ 184:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 187:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 18a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 18d:	89 d7                	mov    %edx,%edi
+ 18f:	fc                   	cld
+ 190:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 192:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 195:	89 d0                	mov    %edx,%eax
+ 197:	c9                   	leave
+ 198:	c3                   	ret
+ 199:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1aa:	0f b6 10             	movzbl (%eax),%edx
+ 1ad:	84 d2                	test   %dl,%dl
+ 1af:	75 12                	jne    1c3 <strchr+0x23>
+ 1b1:	eb 1d                	jmp    1d0 <strchr+0x30>
+ 1b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1b7:	90                   	nop
+ 1b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1bc:	83 c0 01             	add    $0x1,%eax
+ 1bf:	84 d2                	test   %dl,%dl
+ 1c1:	74 0d                	je     1d0 <strchr+0x30>
+    if(*s == c)
+ 1c3:	38 d1                	cmp    %dl,%cl
+ 1c5:	75 f1                	jne    1b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1c7:	5d                   	pop    %ebp
+ 1c8:	c3                   	ret
+ 1c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 1d0:	31 c0                	xor    %eax,%eax
+}
+ 1d2:	5d                   	pop    %ebp
+ 1d3:	c3                   	ret
+ 1d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1df:	90                   	nop
+
+000001e0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1e5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1e8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1e9:	31 db                	xor    %ebx,%ebx
+{
+ 1eb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1ee:	eb 27                	jmp    217 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1f0:	83 ec 04             	sub    $0x4,%esp
+ 1f3:	6a 01                	push   $0x1
+ 1f5:	56                   	push   %esi
+ 1f6:	6a 00                	push   $0x0
+ 1f8:	e8 7f 01 00 00       	call   37c <read>
+    if(cc < 1)
+ 1fd:	83 c4 10             	add    $0x10,%esp
+ 200:	85 c0                	test   %eax,%eax
+ 202:	7e 1d                	jle    221 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 204:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 208:	8b 55 08             	mov    0x8(%ebp),%edx
+ 20b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 20f:	3c 0a                	cmp    $0xa,%al
+ 211:	74 10                	je     223 <gets+0x43>
+ 213:	3c 0d                	cmp    $0xd,%al
+ 215:	74 0c                	je     223 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 217:	89 df                	mov    %ebx,%edi
+ 219:	83 c3 01             	add    $0x1,%ebx
+ 21c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 21f:	7c cf                	jl     1f0 <gets+0x10>
+ 221:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 223:	8b 45 08             	mov    0x8(%ebp),%eax
+ 226:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 22a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 22d:	5b                   	pop    %ebx
+ 22e:	5e                   	pop    %esi
+ 22f:	5f                   	pop    %edi
+ 230:	5d                   	pop    %ebp
+ 231:	c3                   	ret
+ 232:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 239:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000240 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	56                   	push   %esi
+ 244:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 245:	83 ec 08             	sub    $0x8,%esp
+ 248:	6a 00                	push   $0x0
+ 24a:	ff 75 08             	push   0x8(%ebp)
+ 24d:	e8 52 01 00 00       	call   3a4 <open>
+  if(fd < 0)
+ 252:	83 c4 10             	add    $0x10,%esp
+ 255:	85 c0                	test   %eax,%eax
+ 257:	78 27                	js     280 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 259:	83 ec 08             	sub    $0x8,%esp
+ 25c:	ff 75 0c             	push   0xc(%ebp)
+ 25f:	89 c3                	mov    %eax,%ebx
+ 261:	50                   	push   %eax
+ 262:	e8 55 01 00 00       	call   3bc <fstat>
+  close(fd);
+ 267:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 26a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 26c:	e8 1b 01 00 00       	call   38c <close>
+  return r;
+ 271:	83 c4 10             	add    $0x10,%esp
+}
+ 274:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 277:	89 f0                	mov    %esi,%eax
+ 279:	5b                   	pop    %ebx
+ 27a:	5e                   	pop    %esi
+ 27b:	5d                   	pop    %ebp
+ 27c:	c3                   	ret
+ 27d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 280:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 285:	eb ed                	jmp    274 <stat+0x34>
+ 287:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28e:	66 90                	xchg   %ax,%ax
+
+00000290 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	57                   	push   %edi
+ 294:	56                   	push   %esi
+ 295:	8b 45 10             	mov    0x10(%ebp),%eax
+ 298:	8b 55 08             	mov    0x8(%ebp),%edx
+ 29b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 29e:	85 c0                	test   %eax,%eax
+ 2a0:	7e 13                	jle    2b5 <memmove+0x25>
+ 2a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2a4:	89 d7                	mov    %edx,%edi
+ 2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2b1:	39 f8                	cmp    %edi,%eax
+ 2b3:	75 fb                	jne    2b0 <memmove+0x20>
+  return vdst;
+}
+ 2b5:	5e                   	pop    %esi
+ 2b6:	89 d0                	mov    %edx,%eax
+ 2b8:	5f                   	pop    %edi
+ 2b9:	5d                   	pop    %ebp
+ 2ba:	c3                   	ret
+ 2bb:	66 90                	xchg   %ax,%ax
+ 2bd:	66 90                	xchg   %ax,%ax
+ 2bf:	90                   	nop
+
+000002c0 <strcmp>:
+#include "types.h"
+#include "util.h"
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	53                   	push   %ebx
+ 2c4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 2ca:	0f b6 02             	movzbl (%edx),%eax
+ 2cd:	84 c0                	test   %al,%al
+ 2cf:	75 17                	jne    2e8 <strcmp+0x28>
+ 2d1:	eb 3a                	jmp    30d <strcmp+0x4d>
+ 2d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2d7:	90                   	nop
+ 2d8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 2dc:	83 c2 01             	add    $0x1,%edx
+ 2df:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 2e2:	84 c0                	test   %al,%al
+ 2e4:	74 1a                	je     300 <strcmp+0x40>
+    p++, q++;
+ 2e6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 2e8:	0f b6 19             	movzbl (%ecx),%ebx
+ 2eb:	38 c3                	cmp    %al,%bl
+ 2ed:	74 e9                	je     2d8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 2ef:	29 d8                	sub    %ebx,%eax
+}
+ 2f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2f4:	c9                   	leave
+ 2f5:	c3                   	ret
+ 2f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 300:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 304:	31 c0                	xor    %eax,%eax
+ 306:	29 d8                	sub    %ebx,%eax
+}
+ 308:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 30b:	c9                   	leave
+ 30c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 30d:	0f b6 19             	movzbl (%ecx),%ebx
+ 310:	31 c0                	xor    %eax,%eax
+ 312:	eb db                	jmp    2ef <strcmp+0x2f>
+ 314:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 31f:	90                   	nop
+
+00000320 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	53                   	push   %ebx
+ 324:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 327:	0f be 02             	movsbl (%edx),%eax
+ 32a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 32d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 330:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 335:	77 1e                	ja     355 <atoi+0x35>
+ 337:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 340:	83 c2 01             	add    $0x1,%edx
+ 343:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 346:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 34a:	0f be 02             	movsbl (%edx),%eax
+ 34d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 350:	80 fb 09             	cmp    $0x9,%bl
+ 353:	76 eb                	jbe    340 <atoi+0x20>
+  return n;
+ 355:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 358:	89 c8                	mov    %ecx,%eax
+ 35a:	c9                   	leave
+ 35b:	c3                   	ret
+
+0000035c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 35c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 361:	cd 40                	int    $0x40
+ 363:	c3                   	ret
+
+00000364 <exit>:
+SYSCALL(exit)
+ 364:	b8 02 00 00 00       	mov    $0x2,%eax
+ 369:	cd 40                	int    $0x40
+ 36b:	c3                   	ret
+
+0000036c <wait>:
+SYSCALL(wait)
+ 36c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 371:	cd 40                	int    $0x40
+ 373:	c3                   	ret
+
+00000374 <pipe>:
+SYSCALL(pipe)
+ 374:	b8 04 00 00 00       	mov    $0x4,%eax
+ 379:	cd 40                	int    $0x40
+ 37b:	c3                   	ret
+
+0000037c <read>:
+SYSCALL(read)
+ 37c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 381:	cd 40                	int    $0x40
+ 383:	c3                   	ret
+
+00000384 <write>:
+SYSCALL(write)
+ 384:	b8 10 00 00 00       	mov    $0x10,%eax
+ 389:	cd 40                	int    $0x40
+ 38b:	c3                   	ret
+
+0000038c <close>:
+SYSCALL(close)
+ 38c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 391:	cd 40                	int    $0x40
+ 393:	c3                   	ret
+
+00000394 <kill>:
+SYSCALL(kill)
+ 394:	b8 06 00 00 00       	mov    $0x6,%eax
+ 399:	cd 40                	int    $0x40
+ 39b:	c3                   	ret
+
+0000039c <exec>:
+SYSCALL(exec)
+ 39c:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3a1:	cd 40                	int    $0x40
+ 3a3:	c3                   	ret
+
+000003a4 <open>:
+SYSCALL(open)
+ 3a4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3a9:	cd 40                	int    $0x40
+ 3ab:	c3                   	ret
+
+000003ac <mknod>:
+SYSCALL(mknod)
+ 3ac:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3b1:	cd 40                	int    $0x40
+ 3b3:	c3                   	ret
+
+000003b4 <unlink>:
+SYSCALL(unlink)
+ 3b4:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3b9:	cd 40                	int    $0x40
+ 3bb:	c3                   	ret
+
+000003bc <fstat>:
+SYSCALL(fstat)
+ 3bc:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3c1:	cd 40                	int    $0x40
+ 3c3:	c3                   	ret
+
+000003c4 <link>:
+SYSCALL(link)
+ 3c4:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3c9:	cd 40                	int    $0x40
+ 3cb:	c3                   	ret
+
+000003cc <mkdir>:
+SYSCALL(mkdir)
+ 3cc:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3d1:	cd 40                	int    $0x40
+ 3d3:	c3                   	ret
+
+000003d4 <chdir>:
+SYSCALL(chdir)
+ 3d4:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3d9:	cd 40                	int    $0x40
+ 3db:	c3                   	ret
+
+000003dc <dup>:
+SYSCALL(dup)
+ 3dc:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3e1:	cd 40                	int    $0x40
+ 3e3:	c3                   	ret
+
+000003e4 <getpid>:
+SYSCALL(getpid)
+ 3e4:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3e9:	cd 40                	int    $0x40
+ 3eb:	c3                   	ret
+
+000003ec <sbrk>:
+SYSCALL(sbrk)
+ 3ec:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3f1:	cd 40                	int    $0x40
+ 3f3:	c3                   	ret
+
+000003f4 <sleep>:
+SYSCALL(sleep)
+ 3f4:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3f9:	cd 40                	int    $0x40
+ 3fb:	c3                   	ret
+
+000003fc <uptime>:
+SYSCALL(uptime)
+ 3fc:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 401:	cd 40                	int    $0x40
+ 403:	c3                   	ret
+
+00000404 <arp>:
+SYSCALL(arp)
+ 404:	b8 16 00 00 00       	mov    $0x16,%eax
+ 409:	cd 40                	int    $0x40
+ 40b:	c3                   	ret
+
+0000040c <mmap>:
+SYSCALL(mmap)
+ 40c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 411:	cd 40                	int    $0x40
+ 413:	c3                   	ret
+
+00000414 <munmap>:
+SYSCALL(munmap)
+ 414:	b8 18 00 00 00       	mov    $0x18,%eax
+ 419:	cd 40                	int    $0x40
+ 41b:	c3                   	ret
+
+0000041c <msync>:
+SYSCALL(msync)
+ 41c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 421:	cd 40                	int    $0x40
+ 423:	c3                   	ret
+
+00000424 <shmcreate>:
+SYSCALL(shmcreate)
+ 424:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 429:	cd 40                	int    $0x40
+ 42b:	c3                   	ret
+
+0000042c <shmattach>:
+SYSCALL(shmattach)
+ 42c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 431:	cd 40                	int    $0x40
+ 433:	c3                   	ret
+
+00000434 <shmdetach>:
+SYSCALL(shmdetach)
+ 434:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 439:	cd 40                	int    $0x40
+ 43b:	c3                   	ret
+
+0000043c <futex_wait>:
+SYSCALL(futex_wait)
+ 43c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 441:	cd 40                	int    $0x40
+ 443:	c3                   	ret
+
+00000444 <futex_wake>:
+SYSCALL(futex_wake)
+ 444:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 449:	cd 40                	int    $0x40
+ 44b:	c3                   	ret
+
+0000044c <nice>:
+SYSCALL(nice)
+ 44c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 451:	cd 40                	int    $0x40
+ 453:	c3                   	ret
+
+00000454 <setpriority>:
+SYSCALL(setpriority)
+ 454:	b8 20 00 00 00       	mov    $0x20,%eax
+ 459:	cd 40                	int    $0x40
+ 45b:	c3                   	ret
+
+0000045c <cputime>:
+SYSCALL(cputime)
+ 45c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 461:	cd 40                	int    $0x40
+ 463:	c3                   	ret
+
+00000464 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 464:	b8 22 00 00 00       	mov    $0x22,%eax
+ 469:	cd 40                	int    $0x40
+ 46b:	c3                   	ret
+
+0000046c <clone>:
+SYSCALL(clone)
+ 46c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 471:	cd 40                	int    $0x40
+ 473:	c3                   	ret
+
+00000474 <join>:
+SYSCALL(join)
+ 474:	b8 24 00 00 00       	mov    $0x24,%eax
+ 479:	cd 40                	int    $0x40
+ 47b:	c3                   	ret
+
+0000047c <lockstat>:
+SYSCALL(lockstat)
+ 47c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 481:	cd 40                	int    $0x40
+ 483:	c3                   	ret
@@ -23,6 +23,7 @@
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 static void itrunc(struct inode*);
+static void dhfree(struct inode*);
 // there should be one superblock per disk device, but we run with
 // only one device
 struct superblock sb; 
@@ -52,22 +53,79 @@ bzero(int dev, int bno)
 
 // Blocks.
 
-// Allocate a zeroed disk block.
-static uint
-balloc(uint dev)
+#define NBMAP (FSSIZE/BPB + 1)
+
+// In-memory summary of the free map: how many blocks are free
+// under each bitmap block, so that balloc() need not read full
+// ones, and where the last allocation ended, so that
+// allocations without a goal carry on from there (next fit)
+// instead of rescanning from block 0.  The counts are hints
+// for choosing a bitmap block; the bitmap itself, read under
+// its buffer lock, decides.
+struct {
+  struct spinlock lock;
+  uint nbmap;           // bitmap blocks
+  uint nfree[NBMAP];    // free blocks under each bitmap block
+  uint cursor;          // block after the last one allocated
+} bsum;
+
+// Count the free blocks under each bitmap block.
+static void
+bsuminit(int dev)
 {
-  int b, bi, m;
   struct buf *bp;
+  uint b, bi;
 
-  bp = 0;
+  initlock(&bsum.lock, "bsum");
+  bsum.nbmap = (sb.size + BPB - 1) / BPB;
+  if(bsum.nbmap > NBMAP)
+    panic("bsuminit: file system too big");
   for(b = 0; b < sb.size; b += BPB){
     bp = bread(dev, BBLOCK(b, sb));
-    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi++)
+      if((bp->data[bi/8] & (1 << (bi % 8))) == 0)
+        bsum.nfree[b / BPB]++;
+    brelse(bp);
+  }
+  bsum.cursor = sb.bmapstart;
+}
+
+// Allocate a zeroed disk block, the first free one at or
+// after goal if there is one, so that blocks allocated one
+// after another end up next to each other on the disk.
+// With no goal (0), carry on from the last allocation.
+static uint
+balloc(uint dev, uint goal)
+{
+  int b, bi, m, k;
+  uint *w;
+  struct buf *bp;
+
+  if(goal == 0 || goal >= sb.size)
+    goal = bsum.cursor;
+  // Visit the bitmap block holding goal last as well as
+  // first, for the blocks before goal.
+  for(k = 0; k <= bsum.nbmap; k++){
+    b = ((goal / BPB + k) % bsum.nbmap) * BPB;
+    if(bsum.nfree[b / BPB] == 0)
+      continue;
+    bp = bread(dev, BBLOCK(b, sb));
+    w = (uint*)bp->data;
+    for(bi = k == 0 ? goal % BPB : 0; bi < BPB && b + bi < sb.size; bi++){
+      // Skip 32 blocks at a time while they're all in use.
+      if(bi % 32 == 0 && w[bi/32] == ~0U){
+        bi += 31;
+        continue;
+      }
       m = 1 << (bi % 8);
       if((bp->data[bi/8] & m) == 0){  // Is block free?
         bp->data[bi/8] |= m;  // Mark block in use.
         log_write(bp);
         brelse(bp);
+        acquire(&bsum.lock);
+        bsum.nfree[b / BPB]--;
+        bsum.cursor = b + bi + 1;
+        release(&bsum.lock);
         bzero(dev, b + bi);
         return b + bi;
       }
@@ -84,7 +142,6 @@ bfree(int dev, uint b)
   struct buf *bp;
   int bi, m;
 
-  readsb(dev, &sb);
   bp = bread(dev, BBLOCK(b, sb));
   bi = b % BPB;
   m = 1 << (bi % 8);
@@ -93,6 +150,9 @@ bfree(int dev, uint b)
   bp->data[bi/8] &= ~m;
   log_write(bp);
   brelse(bp);
+  acquire(&bsum.lock);
+  bsum.nfree[b / BPB]++;
+  release(&bsum.lock);
 }
 
 // Inodes.
@@ -121,17 +181,19 @@ bfree(int dev, uint b)
 //   the reference and link counts have fallen to zero.
 //
 // * Referencing in cache: an entry in the inode cache
-//   is free if ip->ref is zero. Otherwise ip->ref tracks
+//   is unused if ip->ref is zero. Otherwise ip->ref tracks
 //   the number of in-memory pointers to the entry (open
 //   files and current directories). iget() finds or
 //   creates a cache entry and increments its ref; iput()
-//   decrements ref.
+//   decrements ref.  An unused entry keeps its inode until
+//   iget() recycles it, least recently used first.
 //
 // * Valid: the information (type, size, &c) in an inode
 //   cache entry is only correct when ip->valid is 1.
-//   ilock() reads the inode from
-//   the disk and sets ip->valid, while iput() clears
-//   ip->valid if ip->ref has fallen to zero.
+//   ilock() reads the inode from the disk and sets
+//   ip->valid, which stays set while the entry holds the
+//   same inode, in use or not; iput() clears it when it
+//   frees the inode.
 //
 // * Locked: file system code may only examine and modify
 //   the information in an inode and its content if it
@@ -158,36 +220,82 @@ bfree(int dev, uint b)
 // The icache.lock spin-lock protects the allocation of icache
 // entries. Since ip->ref indicates whether an entry is free,
 // and ip->dev and ip->inum indicate which i-node an entry
-// holds, one must hold icache.lock while using any of those fields.
+// holds, one must hold icache.lock to change dev and inum, or
+// to take ref from zero or bring it to zero.  ref is otherwise
+// changed with atomic instructions, so that iget() can look up
+// cached inodes without the lock.  icache.lock also protects
+// the hash chains and the list of unused entries.
+//
+// iinit() sizes the cache by the amount of free memory.
 //
 // An ip->lock sleep-lock protects all ip-> fields other than ref,
 // dev, and inum.  One must hold ip->lock in order to
 // read or write that inode's ip->valid, ip->size, ip->type, &c.
 
+#define IHASH(dev, inum) (((dev)*31 + (inum)) % NIHASH)
+
 struct {
   struct spinlock lock;
-  struct inode inode[NINODE];
+  struct inode *hash[NIHASH];
+  struct inode lru;    // unused entries, least recently used first
+  uint ninode;
 } icache;
 
+// Put ip, no longer in use, at the end of the unused list.
+// Caller must hold icache.lock.
+static void
+iunused(struct inode *ip)
+{
+  ip->lnext = &icache.lru;
+  ip->lprev = icache.lru.lprev;
+  icache.lru.lprev->lnext = ip;
+  icache.lru.lprev = ip;
+}
+
 void
 iinit(int dev)
 {
-  int i = 0;
-  
+  struct inode *ip;
+  char *page;
+  uint i, n, np;
+
   initlock(&icache.lock, "icache");
-  for(i = 0; i < NINODE; i++) {
-    initsleeplock(&icache.inode[i].lock, "inode");
+  icache.lru.lprev = icache.lru.lnext = &icache.lru;
+
+  // Use about a two-hundred-fifty-sixth of free memory.
+  n = kfreecount() / 256 * (PGSIZE / sizeof(struct inode));
+  if(n < NINODE)
+    n = NINODE;
+  if(n > NINODEMAX)
+    n = NINODEMAX;
+  np = 0;
+  page = 0;
+  for(i = 0; i < n; i++){
+    if(np == 0 && (page = kalloc()) != 0){
+      memset(page, 0, PGSIZE);
+      np = PGSIZE / sizeof(struct inode);
+    }
+    if(np == 0)
+      break;
+    ip = (struct inode*)page + --np;
+    initsleeplock(&ip->lock, "inode");
+    iunused(ip);
   }
+  if(i < NINODE)
+    panic("iinit: out of memory");
+  icache.ninode = i;
 
   readsb(dev, &sb);
+  if(sb.bsize != BSIZE)
+    panic("iinit: block size");
   cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
- inodestart %d bmap start %d\n", sb.size, sb.nblocks,
+ inodestart %d bmap start %d bsize %d\n", sb.size, sb.nblocks,
           sb.ninodes, sb.nlog, sb.logstart, sb.inodestart,
-          sb.bmapstart);
+          sb.bmapstart, sb.bsize);
+  cprintf("icache: %d inodes\n", icache.ninode);
+  bsuminit(dev);
 }
 
-static struct inode* iget(uint dev, uint inum);
-
 //PAGEBREAK!
 // Allocate an inode on device dev.
 // Mark it as allocated by  giving it type type.
@@ -239,34 +347,68 @@ iupdate(struct inode *ip)
 // Find the inode with number inum on device dev
 // and return the in-memory copy. Does not lock
 // the inode and does not read it from disk.
-static struct inode*
+struct inode*
 iget(uint dev, uint inum)
 {
-  struct inode *ip, *empty;
+  struct inode *ip, **pp;
+  int r;
+
+  // Is the inode already cached?  Look without the lock.  An
+  // entry keeps its dev and inum for as long as ref is above
+  // zero, so take a reference only if it is, then check that
+  // the entry wasn't recycled before we got it.  Entries are
+  // never freed, so no grace period is needed; one that moves
+  // to another chain under us just ends the search early.
+  for(ip = icache.hash[IHASH(dev, inum)]; ip; ip = ip->hnext){
+    if(ip->dev != dev || ip->inum != inum)
+      continue;
+    do {
+      r = *(volatile int*)&ip->ref;
+    } while(r > 0 && !__sync_bool_compare_and_swap(&ip->ref, r, r+1));
+    if(r == 0)
+      break;
+    if(ip->dev == dev && ip->inum == inum)
+      return ip;
+    // Recycled under us.  Its other holders may have let go
+    // meanwhile, so drop the reference the careful way.
+    iput(ip);
+    break;
+  }
 
   acquire(&icache.lock);
 
-  // Is the inode already cached?
-  empty = 0;
-  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
-    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
-      ip->ref++;
+  for(ip = icache.hash[IHASH(dev, inum)]; ip; ip = ip->hnext){
+    if(ip->dev == dev && ip->inum == inum){
+      if(__sync_fetch_and_add(&ip->ref, 1) == 0){
+        // Back in use, with its contents still valid.
+        ip->lprev->lnext = ip->lnext;
+        ip->lnext->lprev = ip->lprev;
+      }
       release(&icache.lock);
       return ip;
     }
-    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
-      empty = ip;
   }
 
-  // Recycle an inode cache entry.
-  if(empty == 0)
+  // Recycle the least recently used entry.
+  ip = icache.lru.lnext;
+  if(ip == &icache.lru)
     panic("iget: no inodes");
-
-  ip = empty;
+  ip->lprev->lnext = ip->lnext;
+  ip->lnext->lprev = ip->lprev;
+  for(pp = &icache.hash[IHASH(ip->dev, ip->inum)]; *pp; pp = &(*pp)->hnext){
+    if(*pp == ip){
+      *pp = ip->hnext;
+      break;
+    }
+  }
+  dhfree(ip);
   ip->dev = dev;
   ip->inum = inum;
-  ip->ref = 1;
   ip->valid = 0;
+  ip->hnext = icache.hash[IHASH(dev, inum)];
+  __sync_synchronize();  // lock-free lookups must see dev and inum first
+  icache.hash[IHASH(dev, inum)] = ip;
+  ip->ref = 1;
   release(&icache.lock);
 
   return ip;
@@ -277,9 +419,7 @@ iget(uint dev, uint inum)
 struct inode*
 idup(struct inode *ip)
 {
-  acquire(&icache.lock);
-  ip->ref++;
-  release(&icache.lock);
+  __sync_fetch_and_add(&ip->ref, 1);
   return ip;
 }
 
@@ -306,6 +446,10 @@ ilock(struct inode *ip)
     ip->size = dip->size;
     memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
     brelse(bp);
+    ip->ralast = ip->ranext = ip->rawin = 0;
+    ip->goal = 0;
+    dhfree(ip);
+    ip->pcached = pcachehas(ip);
     ip->valid = 1;
     if(ip->type == 0)
       panic("ilock: no type");
@@ -324,7 +468,7 @@ iunlock(struct inode *ip)
 
 // Drop a reference to an in-memory inode.
 // If that was the last reference, the inode cache entry can
-// be recycled.
+// be recycled, and its directory index is freed.
 // If that was the last reference and the inode has no links
 // to it, free the inode (and its content) on disk.
 // All calls to iput() must be inside a transaction in
@@ -333,11 +477,13 @@ void
 iput(struct inode *ip)
 {
   acquiresleep(&ip->lock);
-  if(ip->valid && ip->nlink == 0){
-    acquire(&icache.lock);
-    int r = ip->ref;
-    release(&icache.lock);
-    if(r == 1){
+  acquire(&icache.lock);
+  int r = ip->ref;
+  release(&icache.lock);
+  if(r == 1){
+    // An unused inode shouldn't hold on to a page.
+    dhfree(ip);
+    if(ip->valid && ip->nlink == 0){
       // inode has no links and no other references: truncate and free.
       itrunc(ip);
       ip->type = 0;
@@ -348,7 +494,8 @@ iput(struct inode *ip)
   releasesleep(&ip->lock);
 
   acquire(&icache.lock);
-  ip->ref--;
+  if(__sync_sub_and_fetch(&ip->ref, 1) == 0)
+    iunused(ip);
   release(&icache.lock);
 }
 
@@ -366,38 +513,94 @@ iunlockput(struct inode *ip)
 // The content (data) associated with each inode is stored
 // in blocks on the disk. The first NDIRECT block numbers
 // are listed in ip->addrs[].  The next NINDIRECT blocks are
-// listed in block ip->addrs[NDIRECT].
+// listed in block ip->addrs[NDIRECT].  The NDINDIRECT blocks
+// after those are listed in the blocks that are listed in
+// block ip->addrs[NDIRECT+1].
+//
+// New blocks are allocated just after the block bmap() last
+// found, so that a file written in order is laid out in order.
 
-// Return the disk block address of the nth block in inode ip.
-// If there is no such block, bmap allocates one.
+// Return entry i of indirect block addr of ip, allocating a
+// block for it if there is none and alloc is set.
 static uint
-bmap(struct inode *ip, uint bn)
+bindirect(struct inode *ip, uint addr, uint i, int alloc)
 {
-  uint addr, *a;
   struct buf *bp;
+  uint *a;
+
+  bp = bread(ip->dev, addr);
+  a = (uint*)bp->data;
+  if((addr = a[i]) == 0 && alloc){
+    a[i] = addr = balloc(ip->dev, ip->goal);
+    log_write(bp);
+  }
+  brelse(bp);
+  return addr;
+}
+
+// Return the disk block address of the nth block in inode ip.
+// If there is no such block, bmap allocates one, unless alloc
+// is 0, in which case it returns 0.
+static uint
+bmap(struct inode *ip, uint bn, int alloc)
+{
+  uint addr;
 
   if(bn < NDIRECT){
-    if((addr = ip->addrs[bn]) == 0)
-      ip->addrs[bn] = addr = balloc(ip->dev);
-    return addr;
+    if((addr = ip->addrs[bn]) == 0 && alloc)
+      ip->addrs[bn] = addr = balloc(ip->dev, ip->goal);
+    goto out;
   }
   bn -= NDIRECT;
 
   if(bn < NINDIRECT){
     // Load indirect block, allocating if necessary.
-    if((addr = ip->addrs[NDIRECT]) == 0)
-      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
-    bp = bread(ip->dev, addr);
-    a = (uint*)bp->data;
-    if((addr = a[bn]) == 0){
-      a[bn] = addr = balloc(ip->dev);
-      log_write(bp);
-    }
-    brelse(bp);
-    return addr;
+    if((addr = ip->addrs[NDIRECT]) == 0 && alloc)
+      ip->addrs[NDIRECT] = addr = balloc(ip->dev, ip->goal);
+    if(addr)
+      addr = bindirect(ip, addr, bn, alloc);
+    goto out;
+  }
+  bn -= NINDIRECT;
+
+  if(bn < NDINDIRECT){
+    // Load double-indirect block, then the indirect block
+    // under it, allocating if necessary.
+    if((addr = ip->addrs[NDIRECT+1]) == 0 && alloc)
+      ip->addrs[NDIRECT+1] = addr = balloc(ip->dev, ip->goal);
+    if(addr)
+      addr = bindirect(ip, addr, bn / NINDIRECT, alloc);
+    if(addr)
+      addr = bindirect(ip, addr, bn % NINDIRECT, alloc);
+    goto out;
   }
 
   panic("bmap: out of range");
+
+out:
+  if(addr)
+    ip->goal = addr + 1;
+  return addr;
+}
+
+// Free block addr and, if it is an indirect block with depth
+// levels of blocks under it, the blocks it lists.
+static void
+bfreetree(uint dev, uint addr, int depth)
+{
+  struct buf *bp;
+  uint *a;
+  int j;
+
+  if(depth > 0){
+    bp = bread(dev, addr);
+    a = (uint*)bp->data;
+    for(j = 0; j < NINDIRECT; j++)
+      if(a[j])
+        bfreetree(dev, a[j], depth - 1);
+    brelse(bp);
+  }
+  bfree(dev, addr);
 }
 
 // Truncate inode (discard contents).
@@ -408,29 +611,20 @@ bmap(struct inode *ip, uint bn)
 static void
 itrunc(struct inode *ip)
 {
-  int i, j;
-  struct buf *bp;
-  uint *a;
+  int i;
 
-  for(i = 0; i < NDIRECT; i++){
+  pcacheinval(ip);
+  dhfree(ip);
+  if(ip->type == T_DIR)
+    dcachepurge(ip);
+  for(i = 0; i < NDIRECT+2; i++){
     if(ip->addrs[i]){
-      bfree(ip->dev, ip->addrs[i]);
+      // Direct, indirect or double-indirect.
+      bfreetree(ip->dev, ip->addrs[i], i < NDIRECT ? 0 : i - NDIRECT + 1);
       ip->addrs[i] = 0;
     }
   }
 
-  if(ip->addrs[NDIRECT]){
-    bp = bread(ip->dev, ip->addrs[NDIRECT]);
-    a = (uint*)bp->data;
-    for(j = 0; j < NINDIRECT; j++){
-      if(a[j])
-        bfree(ip->dev, a[j]);
-    }
-    brelse(bp);
-    bfree(ip->dev, ip->addrs[NDIRECT]);
-    ip->addrs[NDIRECT] = 0;
-  }
-
   ip->size = 0;
   iupdate(ip);
 }
@@ -447,14 +641,48 @@ stati(struct inode *ip, struct stat *st)
   st->size = ip->size;
 }
 
+// Note that ip's blocks first through last have just been read.
+// While ip is read sequentially, start reading the next blocks
+// into the buffer cache, a window that doubles on each
+// sequential read up to RAMAX blocks, so that the disk works
+// ahead of the reader.  Caller must hold ip->lock.
+static void
+readahead(struct inode *ip, uint first, uint last)
+{
+  uint bn, end, addr;
+
+  if(first == ip->ralast || first == ip->ralast + 1){
+    if(ip->rawin == 0)
+      ip->rawin = 2;
+    else if(ip->rawin < RAMAX)
+      ip->rawin *= 2;
+  } else {
+    ip->rawin = 0;
+    ip->ranext = 0;
+  }
+  ip->ralast = last;
+  if(ip->rawin == 0 || ip->size == 0)
+    return;
+
+  end = last + ip->rawin;
+  if(end > (ip->size - 1)/BSIZE)
+    end = (ip->size - 1)/BSIZE;
+  bn = ip->ranext > last ? ip->ranext : last + 1;
+  for(; bn <= end; bn++)
+    if((addr = bmap(ip, bn, 0)) != 0)
+      breadahead(ip->dev, addr);
+  ip->ranext = bn;
+}
+
 //PAGEBREAK!
 // Read data from inode.
 // Caller must hold ip->lock.
 int
 readi(struct inode *ip, char *dst, uint off, uint n)
 {
-  uint tot, m;
+  uint tot, m, first;
   struct buf *bp;
+  int r;
 
   if(ip->type == T_DEV){
     if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
@@ -467,12 +695,24 @@ readi(struct inode *ip, char *dst, uint off, uint n)
   if(off + n > ip->size)
     n = ip->size - off;
 
+  first = off/BSIZE;
   for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
     m = min(n - tot, BSIZE - off%BSIZE);
-    memmove(dst, bp->data + off%BSIZE, m);
+    // A shared mapping may have changed the cached page.
+    if((r = pcacheread(ip, off, dst, m)) != 0){
+      if(r < 0)
+        return -1;
+      continue;
+    }
+    bp = bread(ip->dev, bmap(ip, off/BSIZE, 1));
+    if(ucopy(dst, bp->data + off%BSIZE, m) < 0){
+      brelse(bp);
+      return -1;
+    }
     brelse(bp);
   }
+  if(n > 0)
+    readahead(ip, first, (off-1)/BSIZE);
   return n;
 }
 
@@ -484,6 +724,7 @@ writei(struct inode *ip, char *src, uint off, uint n)
 {
   uint tot, m;
   struct buf *bp;
+  int r;
 
   if(ip->type == T_DEV){
     if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
@@ -493,22 +734,27 @@ writei(struct inode *ip, char *src, uint off, uint n)
 
   if(off > ip->size || off + n < off)
     return -1;
-  if(off + n > MAXFILE*BSIZE)
+  if(off + n > (uint64_t)MAXFILE*BSIZE)
     return -1;
 
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    bp = bread(ip->dev, bmap(ip, off/BSIZE, 1));
     m = min(n - tot, BSIZE - off%BSIZE);
-    memmove(bp->data + off%BSIZE, src, m);
+    // The block may be partly changed even if src faulted,
+    // so log it, and copy it to cached pages, either way.
+    r = ucopy(bp->data + off%BSIZE, src, m);
     log_write(bp);
+    pcacheupdate(ip, off, (char*)bp->data + off%BSIZE, m);
     brelse(bp);
+    if(r < 0)
+      break;
   }
 
-  if(n > 0 && off > ip->size){
+  if(tot > 0 && off > ip->size){
     ip->size = off;
     iupdate(ip);
   }
-  return n;
+  return tot < n ? -1 : n;
 }
 
 //PAGEBREAK!
@@ -520,41 +766,202 @@ namecmp(const char *s, const char *t)
   return strncmp(s, t, DIRSIZ);
 }
 
+// Directory index.
+//
+// The first lookup in a directory builds a hash table of its
+// entries in a page of its own, so that later lookups read
+// only the entries whose names hash to the same slot instead
+// of the whole directory.  The table belongs to the cached
+// inode and is protected by the inode's lock; dirlink() and
+// dirunlink() keep it up to date.  A directory with too many
+// entries for one page, or too long for a slot to point at
+// its last entry, is scanned as before.
+
+#define DHSLOTS  ((PGSIZE - 2*sizeof(uint)) / sizeof(uint))
+#define DHMAX    (DHSLOTS*3/4)   // most slots in use before rebuilding
+#define DHDEAD   0xffffffff      // slot of a removed entry
+#define DHNENT   0xffff          // entries a slot can point at
+
+// A slot holds a tag from the name's hash in its top 16 bits
+// and the entry's index + 1 in the rest; 0 if never used.
+struct dirhash {
+  uint nused;      // slots that aren't 0, DHDEAD ones included
+  uint freeoff;    // no free entry before this offset
+  uint slot[DHSLOTS];
+};
+
+static uint
+dirnamehash(char *name)
+{
+  uint h;
+  int i;
+
+  h = 2166136261;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = (h ^ (uchar)name[i]) * 16777619;
+  return h;
+}
+
+// Add the entry at off called name to h.
+static void
+dhinsert(struct dirhash *h, char *name, uint off)
+{
+  uint hv, i;
+
+  hv = dirnamehash(name);
+  for(i = hv % DHSLOTS; h->slot[i] != 0 && h->slot[i] != DHDEAD; i = (i+1) % DHSLOTS)
+    ;
+  if(h->slot[i] == 0)
+    h->nused++;
+  h->slot[i] = (hv & 0xffff0000) | (off/sizeof(struct dirent) + 1);
+}
+
+// Forget the index of dp.
+static void
+dhfree(struct inode *dp)
+{
+  if(dp->dirhash)
+    kfree((char*)dp->dirhash);
+  dp->dirhash = 0;
+  dp->dhfull = 0;
+}
+
+// Return the index of dp, building it if there is none.
+// Returns 0 if dp is too big to index or memory runs out.
+// Caller must hold dp->lock.
+static struct dirhash*
+dirindex(struct inode *dp)
+{
+  struct dirhash *h;
+  struct dirent *de;
+  struct buf *bp;
+  uint off, n, addr;
+
+  if(dp->dirhash || dp->dhfull)
+    return dp->dirhash;
+  if(dp->size / sizeof(*de) > DHNENT){
+    dp->dhfull = 1;
+    return 0;
+  }
+  if((h = (struct dirhash*)kalloc()) == 0)
+    return 0;
+  memset(h, 0, PGSIZE);
+  h->freeoff = dp->size;
+  for(off = 0; off < dp->size; off += BSIZE){
+    if((addr = bmap(dp, off/BSIZE, 0)) == 0){
+      // A hole reads as free entries.
+      if(h->freeoff == dp->size)
+        h->freeoff = off;
+      continue;
+    }
+    bp = bread(dp->dev, addr);
+    n = min(dp->size - off, BSIZE) / sizeof(*de);
+    for(de = (struct dirent*)bp->data; n > 0; n--, de++){
+      if(de->inum == 0){
+        if(h->freeoff == dp->size)
+          h->freeoff = off + ((char*)de - (char*)bp->data);
+        continue;
+      }
+      if(h->nused >= DHMAX){
+        brelse(bp);
+        kfree((char*)h);
+        dp->dhfull = 1;
+        return 0;
+      }
+      dhinsert(h, de->name, off + ((char*)de - (char*)bp->data));
+    }
+    brelse(bp);
+  }
+  dp->dirhash = h;
+  return h;
+}
+
+// Look for name in dp through its index h.
+// Returns the inode number and sets *poff, or returns 0.
+static uint
+dhlookup(struct inode *dp, struct dirhash *h, char *name, uint *poff)
+{
+  uint hv, i, v, off;
+  struct dirent de;
+
+  hv = dirnamehash(name);
+  for(i = hv % DHSLOTS; (v = h->slot[i]) != 0; i = (i+1) % DHSLOTS){
+    if(v == DHDEAD || (v & 0xffff0000) != (hv & 0xffff0000))
+      continue;
+    off = ((v & 0xffff) - 1) * sizeof(de);
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+      panic("dirlookup read");
+    if(de.inum != 0 && namecmp(name, de.name) == 0){
+      *poff = off;
+      return de.inum;
+    }
+  }
+  return 0;
+}
+
+// Look for name in dp by reading all of it, a block at a time.
+static uint
+dirscan(struct inode *dp, char *name, uint *poff)
+{
+  struct dirent *de;
+  struct buf *bp;
+  uint off, n, inum, addr;
+
+  for(off = 0; off < dp->size; off += BSIZE){
+    if((addr = bmap(dp, off/BSIZE, 0)) == 0)
+      continue;   // a hole has no entries
+    bp = bread(dp->dev, addr);
+    n = min(dp->size - off, BSIZE) / sizeof(*de);
+    for(de = (struct dirent*)bp->data; n > 0; n--, de++){
+      if(de->inum != 0 && namecmp(name, de->name) == 0){
+        *poff = off + ((char*)de - (char*)bp->data);
+        inum = de->inum;
+        brelse(bp);
+        return inum;
+      }
+    }
+    brelse(bp);
+  }
+  return 0;
+}
+
 // Look for a directory entry in a directory.
 // If found, set *poff to byte offset of entry.
+// Caller must hold dp->lock.
 struct inode*
 dirlookup(struct inode *dp, char *name, uint *poff)
 {
   uint off, inum;
-  struct dirent de;
+  struct dirhash *h;
+  struct inode *ip;
 
   if(dp->type != T_DIR)
     panic("dirlookup not DIR");
 
-  for(off = 0; off < dp->size; off += sizeof(de)){
-    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-      panic("dirlookup read");
-    if(de.inum == 0)
-      continue;
-    if(namecmp(name, de.name) == 0){
-      // entry matches path element
-      if(poff)
-        *poff = off;
-      inum = de.inum;
-      return iget(dp->dev, inum);
-    }
-  }
-
-  return 0;
+  if(dcachelookup(dp, name, &ip, poff))
+    return ip;
+  off = 0;
+  if((h = dirindex(dp)) != 0)
+    inum = dhlookup(dp, h, name, &off);
+  else
+    inum = dirscan(dp, name, &off);
+  dcacheenter(dp, name, inum, off);
+  if(inum == 0)
+    return 0;
+  // entry matches path element
+  if(poff)
+    *poff = off;
+  return iget(dp->dev, inum);
 }
 
 // Write a new directory entry (name, inum) into the directory dp.
 int
 dirlink(struct inode *dp, char *name, uint inum)
 {
-  int off;
+  uint off;
   struct dirent de;
   struct inode *ip;
+  struct dirhash *h;
 
   // Check that name is not present.
   if((ip = dirlookup(dp, name, 0)) != 0){
@@ -563,7 +970,8 @@ dirlink(struct inode *dp, char *name, uint inum)
   }
 
   // Look for an empty dirent.
-  for(off = 0; off < dp->size; off += sizeof(de)){
+  h = dp->dirhash;
+  for(off = h ? h->freeoff : 0; off < dp->size; off += sizeof(de)){
     if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
       panic("dirlink read");
     if(de.inum == 0)
@@ -574,10 +982,48 @@ dirlink(struct inode *dp, char *name, uint inum)
   de.inum = inum;
   if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
     panic("dirlink");
-
+  dcacheenter(dp, name, inum, off);
+
+  if(h){
+    h->freeoff = off + sizeof(de);
+    if(off/sizeof(de) >= DHNENT){
+      dhfree(dp);
+      dp->dhfull = 1;
+    } else if(h->nused >= DHMAX)
+      dhfree(dp);   // rebuild without the removed entries
+    else
+      dhinsert(h, name, off);
+  }
   return 0;
 }
 
+// Remove the directory entry at off from the directory dp.
+void
+dirunlink(struct inode *dp, uint off)
+{
+  struct dirent de;
+  struct dirhash *h;
+  uint i, v;
+
+  if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+    panic("dirunlink read");
+  dcacheenter(dp, de.name, 0, 0);
+  if((h = dp->dirhash) != 0){
+    v = (dirnamehash(de.name) & 0xffff0000) | (off/sizeof(de) + 1);
+    for(i = dirnamehash(de.name) % DHSLOTS; h->slot[i] != 0; i = (i+1) % DHSLOTS){
+      if(h->slot[i] == v){
+        h->slot[i] = DHDEAD;
+        break;
+      }
+    }
+    if(off < h->freeoff)
+      h->freeoff = off;
+  }
+  memset(&de, 0, sizeof(de));
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+    panic("unlink: writei");
+}
+
 //PAGEBREAK!
 // Paths
 
@@ -622,6 +1068,8 @@ skipelem(char *path, char *name)
 // If parent != 0, return the inode for the parent and copy the final
 // path element into name, which must have room for DIRSIZ bytes.
 // Must be called inside a transaction since it calls iput().
+// Path elements found in the dentry cache are walked past
+// without locking the directory they are in.
 static struct inode*
 namex(char *path, int nameiparent, char *name)
 {
@@ -629,10 +1077,20 @@ namex(char *path, int nameiparent, char *name)
 
   if(*path == '/')
     ip = iget(ROOTDEV, ROOTINO);
-  else
-    ip = idup(myproc()->cwd);
+  else {
+    acquire(&myproc()->files->lock);
+    ip = idup(myproc()->files->cwd);
+    release(&myproc()->files->lock);
+  }
 
   while((path = skipelem(path, name)) != 0){
+    if(!(nameiparent && *path == '\0') && dcachelookup(ip, name, &next, 0)){
+      iput(ip);
+      if(next == 0)
+        return 0;
+      ip = next;
+      continue;
+    }
     ilock(ip);
     if(ip->type != T_DIR){
       iunlockput(ip);
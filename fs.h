@@ -3,7 +3,7 @@
 
 
 #define ROOTINO 1  // root i-number
-#define BSIZE 512  // block size
+#define BSIZE 4096  // block size; a multiple of the 512-byte sector
 
 // Disk layout:
 // [ boot block | super block | log | inode blocks |
@@ -19,11 +19,38 @@ struct superblock {
   uint logstart;     // Block number of first log block
   uint inodestart;   // Block number of first inode block
   uint bmapstart;    // Block number of first free map block
+  uint bsize;        // Block size in bytes; must be BSIZE
 };
 
-#define NDIRECT 12
+// An inode maps its first NDIRECT blocks directly, the next
+// NINDIRECT through an indirect block, and the rest through a
+// double-indirect block.  Sizes are 32 bits, so with 4 KB blocks
+// the double-indirect block covers any file that fits.
+// The log (see log.c) is a header block recording where the
+// oldest live transaction starts, then a circular area of the
+// other nlog-1 blocks.  A transaction there is a descriptor block
+// listing the home block numbers of the blocks that follow it,
+// with a checksum of itself and of those blocks.
+struct loghead {
+  uint tail;         // log area slot of the oldest live descriptor
+  uint seq;          // its sequence number
+};
+
+#define LOGMAGIC 0x6c6f6721
+#define NLOGDESC (BSIZE / sizeof(uint) - 4)
+
+struct logdesc {
+  uint magic;        // LOGMAGIC
+  uint seq;          // one more than the previous transaction's
+  uint n;            // number of blocks
+  uint sum;          // checksum of the rest and of the blocks
+  uint block[NLOGDESC];  // their home locations
+};
+
+#define NDIRECT 11
 #define NINDIRECT (BSIZE / sizeof(uint))
-#define MAXFILE (NDIRECT + NINDIRECT)
+#define NDINDIRECT (NINDIRECT * NINDIRECT)
+#define MAXFILE (NDIRECT + NINDIRECT + NDINDIRECT)
 
 // On-disk inode structure
 struct dinode {
@@ -32,7 +59,7 @@ struct dinode {
   short minor;          // Minor device number (T_DEV only)
   short nlink;          // Number of links to inode in file system
   uint size;            // Size of file (bytes)
-  uint addrs[NDIRECT+1];   // Data block addresses
+  uint addrs[NDIRECT+2];   // Data block addresses
 };
 
 // Inodes per block.
@@ -0,0 +1,1659 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 01                	mov    (%ecx),%eax
+  16:	8b 59 04             	mov    0x4(%ecx),%ebx
+  19:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  int fd, i;
+  char *pattern;
+
+  if(argc <= 1){
+  1c:	83 f8 01             	cmp    $0x1,%eax
+  1f:	7e 6f                	jle    90 <main+0x90>
+    printf(2, "usage: grep pattern [file ...]\n");
+    exit();
+  }
+  pattern = argv[1];
+  21:	8b 43 04             	mov    0x4(%ebx),%eax
+  24:	83 c3 08             	add    $0x8,%ebx
+
+  if(argc <= 2){
+  27:	83 7d e4 02          	cmpl   $0x2,-0x1c(%ebp)
+    grep(pattern, 0);
+    exit();
+  }
+
+  for(i = 2; i < argc; i++){
+  2b:	be 02 00 00 00       	mov    $0x2,%esi
+  pattern = argv[1];
+  30:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(argc <= 2){
+  33:	75 2d                	jne    62 <main+0x62>
+  35:	eb 6c                	jmp    a3 <main+0xa3>
+  37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  3e:	66 90                	xchg   %ax,%ax
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "grep: cannot open %s\n", argv[i]);
+      exit();
+    }
+    grep(pattern, fd);
+  40:	83 ec 08             	sub    $0x8,%esp
+  for(i = 2; i < argc; i++){
+  43:	83 c6 01             	add    $0x1,%esi
+  46:	83 c3 04             	add    $0x4,%ebx
+    grep(pattern, fd);
+  49:	50                   	push   %eax
+  4a:	ff 75 e0             	push   -0x20(%ebp)
+  4d:	e8 9e 01 00 00       	call   1f0 <grep>
+    close(fd);
+  52:	89 3c 24             	mov    %edi,(%esp)
+  55:	e8 b2 05 00 00       	call   60c <close>
+  for(i = 2; i < argc; i++){
+  5a:	83 c4 10             	add    $0x10,%esp
+  5d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  60:	7e 29                	jle    8b <main+0x8b>
+    if((fd = open(argv[i], 0)) < 0){
+  62:	83 ec 08             	sub    $0x8,%esp
+  65:	6a 00                	push   $0x0
+  67:	ff 33                	push   (%ebx)
+  69:	e8 b6 05 00 00       	call   624 <open>
+  6e:	83 c4 10             	add    $0x10,%esp
+  71:	89 c7                	mov    %eax,%edi
+  73:	85 c0                	test   %eax,%eax
+  75:	79 c9                	jns    40 <main+0x40>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+  77:	50                   	push   %eax
+  78:	ff 33                	push   (%ebx)
+  7a:	68 f8 0a 00 00       	push   $0xaf8
+  7f:	6a 01                	push   $0x1
+  81:	e8 2a 07 00 00       	call   7b0 <printf>
+      exit();
+  86:	e8 59 05 00 00       	call   5e4 <exit>
+  }
+  exit();
+  8b:	e8 54 05 00 00       	call   5e4 <exit>
+    printf(2, "usage: grep pattern [file ...]\n");
+  90:	51                   	push   %ecx
+  91:	51                   	push   %ecx
+  92:	68 d8 0a 00 00       	push   $0xad8
+  97:	6a 02                	push   $0x2
+  99:	e8 12 07 00 00       	call   7b0 <printf>
+    exit();
+  9e:	e8 41 05 00 00       	call   5e4 <exit>
+    grep(pattern, 0);
+  a3:	52                   	push   %edx
+  a4:	52                   	push   %edx
+  a5:	6a 00                	push   $0x0
+  a7:	50                   	push   %eax
+  a8:	e8 43 01 00 00       	call   1f0 <grep>
+    exit();
+  ad:	e8 32 05 00 00       	call   5e4 <exit>
+  b2:	66 90                	xchg   %ax,%ax
+  b4:	66 90                	xchg   %ax,%ax
+  b6:	66 90                	xchg   %ax,%ax
+  b8:	66 90                	xchg   %ax,%ax
+  ba:	66 90                	xchg   %ax,%ax
+  bc:	66 90                	xchg   %ax,%ax
+  be:	66 90                	xchg   %ax,%ax
+
+000000c0 <matchhere>:
+  return 0;
+}
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	57                   	push   %edi
+  c4:	56                   	push   %esi
+  c5:	53                   	push   %ebx
+  c6:	83 ec 0c             	sub    $0xc,%esp
+  c9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(re[0] == '\0')
+  cf:	0f b6 0f             	movzbl (%edi),%ecx
+  d2:	84 c9                	test   %cl,%cl
+  d4:	0f 84 96 00 00 00    	je     170 <matchhere+0xb0>
+    return 1;
+  if(re[1] == '*')
+  da:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+  de:	3c 2a                	cmp    $0x2a,%al
+  e0:	74 2d                	je     10f <matchhere+0x4f>
+  e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return matchstar(re[0], re+2, text);
+  if(re[0] == '$' && re[1] == '\0')
+    return *text == '\0';
+  e8:	0f b6 33             	movzbl (%ebx),%esi
+  if(re[0] == '$' && re[1] == '\0')
+  eb:	80 f9 24             	cmp    $0x24,%cl
+  ee:	74 50                	je     140 <matchhere+0x80>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+  f0:	89 f2                	mov    %esi,%edx
+  f2:	84 d2                	test   %dl,%dl
+  f4:	74 6e                	je     164 <matchhere+0xa4>
+  f6:	80 f9 2e             	cmp    $0x2e,%cl
+  f9:	75 65                	jne    160 <matchhere+0xa0>
+    return matchhere(re+1, text+1);
+  fb:	83 c3 01             	add    $0x1,%ebx
+  fe:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+ 101:	84 c0                	test   %al,%al
+ 103:	74 6b                	je     170 <matchhere+0xb0>
+ 105:	89 c1                	mov    %eax,%ecx
+  if(re[1] == '*')
+ 107:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+ 10b:	3c 2a                	cmp    $0x2a,%al
+ 10d:	75 d9                	jne    e8 <matchhere+0x28>
+    return matchstar(re[0], re+2, text);
+ 10f:	8d 77 02             	lea    0x2(%edi),%esi
+ 112:	0f be f9             	movsbl %cl,%edi
+  return 0;
+}
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+ 115:	8d 76 00             	lea    0x0(%esi),%esi
+{
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+ 118:	83 ec 08             	sub    $0x8,%esp
+ 11b:	53                   	push   %ebx
+ 11c:	56                   	push   %esi
+ 11d:	e8 9e ff ff ff       	call   c0 <matchhere>
+ 122:	83 c4 10             	add    $0x10,%esp
+ 125:	85 c0                	test   %eax,%eax
+ 127:	75 47                	jne    170 <matchhere+0xb0>
+      return 1;
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 129:	0f be 13             	movsbl (%ebx),%edx
+ 12c:	84 d2                	test   %dl,%dl
+ 12e:	74 45                	je     175 <matchhere+0xb5>
+ 130:	83 c3 01             	add    $0x1,%ebx
+ 133:	39 fa                	cmp    %edi,%edx
+ 135:	74 e1                	je     118 <matchhere+0x58>
+ 137:	83 ff 2e             	cmp    $0x2e,%edi
+ 13a:	74 dc                	je     118 <matchhere+0x58>
+ 13c:	eb 37                	jmp    175 <matchhere+0xb5>
+ 13e:	66 90                	xchg   %ax,%ax
+  if(re[0] == '$' && re[1] == '\0')
+ 140:	84 c0                	test   %al,%al
+ 142:	74 39                	je     17d <matchhere+0xbd>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 144:	89 f2                	mov    %esi,%edx
+ 146:	84 d2                	test   %dl,%dl
+ 148:	74 1a                	je     164 <matchhere+0xa4>
+ 14a:	80 fa 24             	cmp    $0x24,%dl
+ 14d:	75 15                	jne    164 <matchhere+0xa4>
+    return matchhere(re+1, text+1);
+ 14f:	83 c3 01             	add    $0x1,%ebx
+ 152:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+ 155:	89 c1                	mov    %eax,%ecx
+ 157:	eb ae                	jmp    107 <matchhere+0x47>
+ 159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 160:	38 ca                	cmp    %cl,%dl
+ 162:	74 97                	je     fb <matchhere+0x3b>
+}
+ 164:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+ 167:	31 c0                	xor    %eax,%eax
+}
+ 169:	5b                   	pop    %ebx
+ 16a:	5e                   	pop    %esi
+ 16b:	5f                   	pop    %edi
+ 16c:	5d                   	pop    %ebp
+ 16d:	c3                   	ret
+ 16e:	66 90                	xchg   %ax,%ax
+    return 1;
+ 170:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 175:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 178:	5b                   	pop    %ebx
+ 179:	5e                   	pop    %esi
+ 17a:	5f                   	pop    %edi
+ 17b:	5d                   	pop    %ebp
+ 17c:	c3                   	ret
+    return *text == '\0';
+ 17d:	89 f0                	mov    %esi,%eax
+ 17f:	84 c0                	test   %al,%al
+ 181:	0f 94 c0             	sete   %al
+ 184:	0f b6 c0             	movzbl %al,%eax
+ 187:	eb ec                	jmp    175 <matchhere+0xb5>
+ 189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000190 <match>:
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	56                   	push   %esi
+ 194:	53                   	push   %ebx
+ 195:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 198:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(re[0] == '^')
+ 19b:	80 3b 5e             	cmpb   $0x5e,(%ebx)
+ 19e:	75 11                	jne    1b1 <match+0x21>
+ 1a0:	eb 2e                	jmp    1d0 <match+0x40>
+ 1a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  }while(*text++ != '\0');
+ 1a8:	83 c6 01             	add    $0x1,%esi
+ 1ab:	80 7e ff 00          	cmpb   $0x0,-0x1(%esi)
+ 1af:	74 16                	je     1c7 <match+0x37>
+    if(matchhere(re, text))
+ 1b1:	83 ec 08             	sub    $0x8,%esp
+ 1b4:	56                   	push   %esi
+ 1b5:	53                   	push   %ebx
+ 1b6:	e8 05 ff ff ff       	call   c0 <matchhere>
+ 1bb:	83 c4 10             	add    $0x10,%esp
+ 1be:	85 c0                	test   %eax,%eax
+ 1c0:	74 e6                	je     1a8 <match+0x18>
+      return 1;
+ 1c2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 1c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1ca:	5b                   	pop    %ebx
+ 1cb:	5e                   	pop    %esi
+ 1cc:	5d                   	pop    %ebp
+ 1cd:	c3                   	ret
+ 1ce:	66 90                	xchg   %ax,%ax
+    return matchhere(re+1, text);
+ 1d0:	83 c3 01             	add    $0x1,%ebx
+ 1d3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 1d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1d9:	5b                   	pop    %ebx
+ 1da:	5e                   	pop    %esi
+ 1db:	5d                   	pop    %ebp
+    return matchhere(re+1, text);
+ 1dc:	e9 df fe ff ff       	jmp    c0 <matchhere>
+ 1e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ef:	90                   	nop
+
+000001f0 <grep>:
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	57                   	push   %edi
+  m = 0;
+ 1f4:	31 ff                	xor    %edi,%edi
+{
+ 1f6:	56                   	push   %esi
+ 1f7:	53                   	push   %ebx
+ 1f8:	83 ec 1c             	sub    $0x1c,%esp
+ 1fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 1fe:	89 7d e0             	mov    %edi,-0x20(%ebp)
+    return matchhere(re+1, text);
+ 201:	8d 43 01             	lea    0x1(%ebx),%eax
+ 204:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+ 210:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 213:	b8 ff 03 00 00       	mov    $0x3ff,%eax
+ 218:	83 ec 04             	sub    $0x4,%esp
+ 21b:	29 c8                	sub    %ecx,%eax
+ 21d:	50                   	push   %eax
+ 21e:	8d 81 00 0f 00 00    	lea    0xf00(%ecx),%eax
+ 224:	50                   	push   %eax
+ 225:	ff 75 0c             	push   0xc(%ebp)
+ 228:	e8 cf 03 00 00       	call   5fc <read>
+ 22d:	83 c4 10             	add    $0x10,%esp
+ 230:	85 c0                	test   %eax,%eax
+ 232:	0f 8e fd 00 00 00    	jle    335 <grep+0x145>
+    m += n;
+ 238:	01 45 e0             	add    %eax,-0x20(%ebp)
+ 23b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    buf[m] = '\0';
+ 23e:	bf 00 0f 00 00       	mov    $0xf00,%edi
+ 243:	89 de                	mov    %ebx,%esi
+ 245:	c6 81 00 0f 00 00 00 	movb   $0x0,0xf00(%ecx)
+    while((q = strchr(p, '\n')) != 0){
+ 24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 250:	83 ec 08             	sub    $0x8,%esp
+ 253:	6a 0a                	push   $0xa
+ 255:	57                   	push   %edi
+ 256:	e8 c5 01 00 00       	call   420 <strchr>
+ 25b:	83 c4 10             	add    $0x10,%esp
+ 25e:	89 c2                	mov    %eax,%edx
+ 260:	85 c0                	test   %eax,%eax
+ 262:	0f 84 88 00 00 00    	je     2f0 <grep+0x100>
+      *q = 0;
+ 268:	c6 02 00             	movb   $0x0,(%edx)
+  if(re[0] == '^')
+ 26b:	80 3e 5e             	cmpb   $0x5e,(%esi)
+ 26e:	74 58                	je     2c8 <grep+0xd8>
+ 270:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 273:	89 d3                	mov    %edx,%ebx
+ 275:	eb 12                	jmp    289 <grep+0x99>
+ 277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27e:	66 90                	xchg   %ax,%ax
+  }while(*text++ != '\0');
+ 280:	83 c7 01             	add    $0x1,%edi
+ 283:	80 7f ff 00          	cmpb   $0x0,-0x1(%edi)
+ 287:	74 37                	je     2c0 <grep+0xd0>
+    if(matchhere(re, text))
+ 289:	83 ec 08             	sub    $0x8,%esp
+ 28c:	57                   	push   %edi
+ 28d:	56                   	push   %esi
+ 28e:	e8 2d fe ff ff       	call   c0 <matchhere>
+ 293:	83 c4 10             	add    $0x10,%esp
+ 296:	85 c0                	test   %eax,%eax
+ 298:	74 e6                	je     280 <grep+0x90>
+        write(1, p, q+1 - p);
+ 29a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 29d:	89 da                	mov    %ebx,%edx
+ 29f:	8d 5b 01             	lea    0x1(%ebx),%ebx
+ 2a2:	89 d8                	mov    %ebx,%eax
+ 2a4:	83 ec 04             	sub    $0x4,%esp
+        *q = '\n';
+ 2a7:	c6 02 0a             	movb   $0xa,(%edx)
+        write(1, p, q+1 - p);
+ 2aa:	29 f8                	sub    %edi,%eax
+ 2ac:	50                   	push   %eax
+ 2ad:	57                   	push   %edi
+ 2ae:	89 df                	mov    %ebx,%edi
+ 2b0:	6a 01                	push   $0x1
+ 2b2:	e8 4d 03 00 00       	call   604 <write>
+ 2b7:	83 c4 10             	add    $0x10,%esp
+ 2ba:	eb 94                	jmp    250 <grep+0x60>
+ 2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2c0:	8d 7b 01             	lea    0x1(%ebx),%edi
+      p = q+1;
+ 2c3:	eb 8b                	jmp    250 <grep+0x60>
+ 2c5:	8d 76 00             	lea    0x0(%esi),%esi
+    return matchhere(re+1, text);
+ 2c8:	83 ec 08             	sub    $0x8,%esp
+ 2cb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 2ce:	57                   	push   %edi
+ 2cf:	ff 75 dc             	push   -0x24(%ebp)
+ 2d2:	e8 e9 fd ff ff       	call   c0 <matchhere>
+        write(1, p, q+1 - p);
+ 2d7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    return matchhere(re+1, text);
+ 2da:	83 c4 10             	add    $0x10,%esp
+        write(1, p, q+1 - p);
+ 2dd:	8d 5a 01             	lea    0x1(%edx),%ebx
+      if(match(pattern, p)){
+ 2e0:	85 c0                	test   %eax,%eax
+ 2e2:	75 be                	jne    2a2 <grep+0xb2>
+        write(1, p, q+1 - p);
+ 2e4:	89 df                	mov    %ebx,%edi
+ 2e6:	e9 65 ff ff ff       	jmp    250 <grep+0x60>
+ 2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ef:	90                   	nop
+    if(p == buf)
+ 2f0:	89 f3                	mov    %esi,%ebx
+ 2f2:	81 ff 00 0f 00 00    	cmp    $0xf00,%edi
+ 2f8:	74 2f                	je     329 <grep+0x139>
+    if(m > 0){
+ 2fa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 2fd:	85 c0                	test   %eax,%eax
+ 2ff:	0f 8e 0b ff ff ff    	jle    210 <grep+0x20>
+      m -= p - buf;
+ 305:	89 f8                	mov    %edi,%eax
+      memmove(buf, p, m);
+ 307:	83 ec 04             	sub    $0x4,%esp
+      m -= p - buf;
+ 30a:	2d 00 0f 00 00       	sub    $0xf00,%eax
+ 30f:	29 45 e0             	sub    %eax,-0x20(%ebp)
+ 312:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      memmove(buf, p, m);
+ 315:	51                   	push   %ecx
+ 316:	57                   	push   %edi
+ 317:	68 00 0f 00 00       	push   $0xf00
+ 31c:	e8 ef 01 00 00       	call   510 <memmove>
+ 321:	83 c4 10             	add    $0x10,%esp
+ 324:	e9 e7 fe ff ff       	jmp    210 <grep+0x20>
+      m = 0;
+ 329:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+ 330:	e9 db fe ff ff       	jmp    210 <grep+0x20>
+}
+ 335:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 338:	5b                   	pop    %ebx
+ 339:	5e                   	pop    %esi
+ 33a:	5f                   	pop    %edi
+ 33b:	5d                   	pop    %ebp
+ 33c:	c3                   	ret
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000340 <matchstar>:
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	57                   	push   %edi
+ 344:	56                   	push   %esi
+ 345:	53                   	push   %ebx
+ 346:	83 ec 0c             	sub    $0xc,%esp
+ 349:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 34c:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 34f:	8b 7d 10             	mov    0x10(%ebp),%edi
+ 352:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(matchhere(re, text))
+ 358:	83 ec 08             	sub    $0x8,%esp
+ 35b:	57                   	push   %edi
+ 35c:	56                   	push   %esi
+ 35d:	e8 5e fd ff ff       	call   c0 <matchhere>
+ 362:	83 c4 10             	add    $0x10,%esp
+ 365:	85 c0                	test   %eax,%eax
+ 367:	75 1f                	jne    388 <matchstar+0x48>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 369:	0f be 17             	movsbl (%edi),%edx
+ 36c:	84 d2                	test   %dl,%dl
+ 36e:	74 0c                	je     37c <matchstar+0x3c>
+ 370:	83 c7 01             	add    $0x1,%edi
+ 373:	39 da                	cmp    %ebx,%edx
+ 375:	74 e1                	je     358 <matchstar+0x18>
+ 377:	83 fb 2e             	cmp    $0x2e,%ebx
+ 37a:	74 dc                	je     358 <matchstar+0x18>
+}
+ 37c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 37f:	5b                   	pop    %ebx
+ 380:	5e                   	pop    %esi
+ 381:	5f                   	pop    %edi
+ 382:	5d                   	pop    %ebp
+ 383:	c3                   	ret
+ 384:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 388:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 1;
+ 38b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 390:	5b                   	pop    %ebx
+ 391:	5e                   	pop    %esi
+ 392:	5f                   	pop    %edi
+ 393:	5d                   	pop    %ebp
+ 394:	c3                   	ret
+ 395:	66 90                	xchg   %ax,%ax
+ 397:	66 90                	xchg   %ax,%ax
+ 399:	66 90                	xchg   %ax,%ax
+ 39b:	66 90                	xchg   %ax,%ax
+ 39d:	66 90                	xchg   %ax,%ax
+ 39f:	90                   	nop
+
+000003a0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 3a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 3a1:	31 c0                	xor    %eax,%eax
+{
+ 3a3:	89 e5                	mov    %esp,%ebp
+ 3a5:	53                   	push   %ebx
+ 3a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 3ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 3b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 3b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 3b7:	83 c0 01             	add    $0x1,%eax
+ 3ba:	84 d2                	test   %dl,%dl
+ 3bc:	75 f2                	jne    3b0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 3be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3c1:	89 c8                	mov    %ecx,%eax
+ 3c3:	c9                   	leave
+ 3c4:	c3                   	ret
+ 3c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 3d6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 3d9:	74 15                	je     3f0 <strlen+0x20>
+ 3db:	31 c0                	xor    %eax,%eax
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 3e0:	83 c0 01             	add    $0x1,%eax
+ 3e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 3e7:	89 c1                	mov    %eax,%ecx
+ 3e9:	75 f5                	jne    3e0 <strlen+0x10>
+    ;
+  return n;
+}
+ 3eb:	89 c8                	mov    %ecx,%eax
+ 3ed:	5d                   	pop    %ebp
+ 3ee:	c3                   	ret
+ 3ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 3f0:	31 c9                	xor    %ecx,%ecx
+}
+ 3f2:	5d                   	pop    %ebp
+ 3f3:	89 c8                	mov    %ecx,%eax
+ 3f5:	c3                   	ret
+ 3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000400 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 407:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 40a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 40d:	89 d7                	mov    %edx,%edi
+ 40f:	fc                   	cld
+ 410:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 412:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 415:	89 d0                	mov    %edx,%eax
+ 417:	c9                   	leave
+ 418:	c3                   	ret
+ 419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	8b 45 08             	mov    0x8(%ebp),%eax
+ 426:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 42a:	0f b6 10             	movzbl (%eax),%edx
+ 42d:	84 d2                	test   %dl,%dl
+ 42f:	75 12                	jne    443 <strchr+0x23>
+ 431:	eb 1d                	jmp    450 <strchr+0x30>
+ 433:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 437:	90                   	nop
+ 438:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 43c:	83 c0 01             	add    $0x1,%eax
+ 43f:	84 d2                	test   %dl,%dl
+ 441:	74 0d                	je     450 <strchr+0x30>
+    if(*s == c)
+ 443:	38 d1                	cmp    %dl,%cl
+ 445:	75 f1                	jne    438 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 447:	5d                   	pop    %ebp
+ 448:	c3                   	ret
+ 449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 450:	31 c0                	xor    %eax,%eax
+}
+ 452:	5d                   	pop    %ebp
+ 453:	c3                   	ret
+ 454:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 45f:	90                   	nop
+
+00000460 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 465:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 468:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 469:	31 db                	xor    %ebx,%ebx
+{
+ 46b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 46e:	eb 27                	jmp    497 <gets+0x37>
+    cc = read(0, &c, 1);
+ 470:	83 ec 04             	sub    $0x4,%esp
+ 473:	6a 01                	push   $0x1
+ 475:	56                   	push   %esi
+ 476:	6a 00                	push   $0x0
+ 478:	e8 7f 01 00 00       	call   5fc <read>
+    if(cc < 1)
+ 47d:	83 c4 10             	add    $0x10,%esp
+ 480:	85 c0                	test   %eax,%eax
+ 482:	7e 1d                	jle    4a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 484:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 488:	8b 55 08             	mov    0x8(%ebp),%edx
+ 48b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 48f:	3c 0a                	cmp    $0xa,%al
+ 491:	74 10                	je     4a3 <gets+0x43>
+ 493:	3c 0d                	cmp    $0xd,%al
+ 495:	74 0c                	je     4a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 497:	89 df                	mov    %ebx,%edi
+ 499:	83 c3 01             	add    $0x1,%ebx
+ 49c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 49f:	7c cf                	jl     470 <gets+0x10>
+ 4a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 4a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 4aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4ad:	5b                   	pop    %ebx
+ 4ae:	5e                   	pop    %esi
+ 4af:	5f                   	pop    %edi
+ 4b0:	5d                   	pop    %ebp
+ 4b1:	c3                   	ret
+ 4b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	56                   	push   %esi
+ 4c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4c5:	83 ec 08             	sub    $0x8,%esp
+ 4c8:	6a 00                	push   $0x0
+ 4ca:	ff 75 08             	push   0x8(%ebp)
+ 4cd:	e8 52 01 00 00       	call   624 <open>
+  if(fd < 0)
+ 4d2:	83 c4 10             	add    $0x10,%esp
+ 4d5:	85 c0                	test   %eax,%eax
+ 4d7:	78 27                	js     500 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 4d9:	83 ec 08             	sub    $0x8,%esp
+ 4dc:	ff 75 0c             	push   0xc(%ebp)
+ 4df:	89 c3                	mov    %eax,%ebx
+ 4e1:	50                   	push   %eax
+ 4e2:	e8 55 01 00 00       	call   63c <fstat>
+  close(fd);
+ 4e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 4ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 4ec:	e8 1b 01 00 00       	call   60c <close>
+  return r;
+ 4f1:	83 c4 10             	add    $0x10,%esp
+}
+ 4f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4f7:	89 f0                	mov    %esi,%eax
+ 4f9:	5b                   	pop    %ebx
+ 4fa:	5e                   	pop    %esi
+ 4fb:	5d                   	pop    %ebp
+ 4fc:	c3                   	ret
+ 4fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 500:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 505:	eb ed                	jmp    4f4 <stat+0x34>
+ 507:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50e:	66 90                	xchg   %ax,%ax
+
+00000510 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	57                   	push   %edi
+ 514:	56                   	push   %esi
+ 515:	8b 45 10             	mov    0x10(%ebp),%eax
+ 518:	8b 55 08             	mov    0x8(%ebp),%edx
+ 51b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 51e:	85 c0                	test   %eax,%eax
+ 520:	7e 13                	jle    535 <memmove+0x25>
+ 522:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 524:	89 d7                	mov    %edx,%edi
+ 526:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 530:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 531:	39 f8                	cmp    %edi,%eax
+ 533:	75 fb                	jne    530 <memmove+0x20>
+  return vdst;
+}
+ 535:	5e                   	pop    %esi
+ 536:	89 d0                	mov    %edx,%eax
+ 538:	5f                   	pop    %edi
+ 539:	5d                   	pop    %ebp
+ 53a:	c3                   	ret
+ 53b:	66 90                	xchg   %ax,%ax
+ 53d:	66 90                	xchg   %ax,%ax
+ 53f:	90                   	nop
+
+00000540 <strcmp>:
+#include "types.h"
+#include "util.h"
+
+int
+strcmp(const char *p, const char *q)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	53                   	push   %ebx
+ 544:	8b 55 08             	mov    0x8(%ebp),%edx
+ 547:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 54a:	0f b6 02             	movzbl (%edx),%eax
+ 54d:	84 c0                	test   %al,%al
+ 54f:	75 17                	jne    568 <strcmp+0x28>
+ 551:	eb 3a                	jmp    58d <strcmp+0x4d>
+ 553:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 557:	90                   	nop
+ 558:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 55c:	83 c2 01             	add    $0x1,%edx
+ 55f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 562:	84 c0                	test   %al,%al
+ 564:	74 1a                	je     580 <strcmp+0x40>
+    p++, q++;
+ 566:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 568:	0f b6 19             	movzbl (%ecx),%ebx
+ 56b:	38 c3                	cmp    %al,%bl
+ 56d:	74 e9                	je     558 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 56f:	29 d8                	sub    %ebx,%eax
+}
+ 571:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 574:	c9                   	leave
+ 575:	c3                   	ret
+ 576:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 57d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 580:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 584:	31 c0                	xor    %eax,%eax
+ 586:	29 d8                	sub    %ebx,%eax
+}
+ 588:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 58b:	c9                   	leave
+ 58c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 58d:	0f b6 19             	movzbl (%ecx),%ebx
+ 590:	31 c0                	xor    %eax,%eax
+ 592:	eb db                	jmp    56f <strcmp+0x2f>
+ 594:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 59f:	90                   	nop
+
+000005a0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	89 e5                	mov    %esp,%ebp
+ 5a3:	53                   	push   %ebx
+ 5a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 5a7:	0f be 02             	movsbl (%edx),%eax
+ 5aa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 5ad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 5b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 5b5:	77 1e                	ja     5d5 <atoi+0x35>
+ 5b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5be:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 5c0:	83 c2 01             	add    $0x1,%edx
+ 5c3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 5c6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 5ca:	0f be 02             	movsbl (%edx),%eax
+ 5cd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 5d0:	80 fb 09             	cmp    $0x9,%bl
+ 5d3:	76 eb                	jbe    5c0 <atoi+0x20>
+  return n;
+ 5d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5d8:	89 c8                	mov    %ecx,%eax
+ 5da:	c9                   	leave
+ 5db:	c3                   	ret
+
+000005dc <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5dc:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5e1:	cd 40                	int    $0x40
+ 5e3:	c3                   	ret
+
+000005e4 <exit>:
+SYSCALL(exit)
+ 5e4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5e9:	cd 40                	int    $0x40
+ 5eb:	c3                   	ret
+
+000005ec <wait>:
+SYSCALL(wait)
+ 5ec:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5f1:	cd 40                	int    $0x40
+ 5f3:	c3                   	ret
+
+000005f4 <pipe>:
+SYSCALL(pipe)
+ 5f4:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5f9:	cd 40                	int    $0x40
+ 5fb:	c3                   	ret
+
+000005fc <read>:
+SYSCALL(read)
+ 5fc:	b8 05 00 00 00       	mov    $0x5,%eax
+ 601:	cd 40                	int    $0x40
+ 603:	c3                   	ret
+
+00000604 <write>:
+SYSCALL(write)
+ 604:	b8 10 00 00 00       	mov    $0x10,%eax
+ 609:	cd 40                	int    $0x40
+ 60b:	c3                   	ret
+
+0000060c <close>:
+SYSCALL(close)
+ 60c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 611:	cd 40                	int    $0x40
+ 613:	c3                   	ret
+
+00000614 <kill>:
+SYSCALL(kill)
+ 614:	b8 06 00 00 00       	mov    $0x6,%eax
+ 619:	cd 40                	int    $0x40
+ 61b:	c3                   	ret
+
+0000061c <exec>:
+SYSCALL(exec)
+ 61c:	b8 07 00 00 00       	mov    $0x7,%eax
+ 621:	cd 40                	int    $0x40
+ 623:	c3                   	ret
+
+00000624 <open>:
+SYSCALL(open)
+ 624:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 629:	cd 40                	int    $0x40
+ 62b:	c3                   	ret
+
+0000062c <mknod>:
+SYSCALL(mknod)
+ 62c:	b8 11 00 00 00       	mov    $0x11,%eax
+ 631:	cd 40                	int    $0x40
+ 633:	c3                   	ret
+
+00000634 <unlink>:
+SYSCALL(unlink)
+ 634:	b8 12 00 00 00       	mov    $0x12,%eax
+ 639:	cd 40                	int    $0x40
+ 63b:	c3                   	ret
+
+0000063c <fstat>:
+SYSCALL(fstat)
+ 63c:	b8 08 00 00 00       	mov    $0x8,%eax
+ 641:	cd 40                	int    $0x40
+ 643:	c3                   	ret
+
+00000644 <link>:
+SYSCALL(link)
+ 644:	b8 13 00 00 00       	mov    $0x13,%eax
+ 649:	cd 40                	int    $0x40
+ 64b:	c3                   	ret
+
+0000064c <mkdir>:
+SYSCALL(mkdir)
+ 64c:	b8 14 00 00 00       	mov    $0x14,%eax
+ 651:	cd 40                	int    $0x40
+ 653:	c3                   	ret
+
+00000654 <chdir>:
+SYSCALL(chdir)
+ 654:	b8 09 00 00 00       	mov    $0x9,%eax
+ 659:	cd 40                	int    $0x40
+ 65b:	c3                   	ret
+
+0000065c <dup>:
+SYSCALL(dup)
+ 65c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 661:	cd 40                	int    $0x40
+ 663:	c3                   	ret
+
+00000664 <getpid>:
+SYSCALL(getpid)
+ 664:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 669:	cd 40                	int    $0x40
+ 66b:	c3                   	ret
+
+0000066c <sbrk>:
+SYSCALL(sbrk)
+ 66c:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 671:	cd 40                	int    $0x40
+ 673:	c3                   	ret
+
+00000674 <sleep>:
+SYSCALL(sleep)
+ 674:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 679:	cd 40                	int    $0x40
+ 67b:	c3                   	ret
+
+0000067c <uptime>:
+SYSCALL(uptime)
+ 67c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 681:	cd 40                	int    $0x40
+ 683:	c3                   	ret
+
+00000684 <arp>:
+SYSCALL(arp)
+ 684:	b8 16 00 00 00       	mov    $0x16,%eax
+ 689:	cd 40                	int    $0x40
+ 68b:	c3                   	ret
+
+0000068c <mmap>:
+SYSCALL(mmap)
+ 68c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 691:	cd 40                	int    $0x40
+ 693:	c3                   	ret
+
+00000694 <munmap>:
+SYSCALL(munmap)
+ 694:	b8 18 00 00 00       	mov    $0x18,%eax
+ 699:	cd 40                	int    $0x40
+ 69b:	c3                   	ret
+
+0000069c <msync>:
+SYSCALL(msync)
+ 69c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6a1:	cd 40                	int    $0x40
+ 6a3:	c3                   	ret
+
+000006a4 <shmcreate>:
+SYSCALL(shmcreate)
+ 6a4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6a9:	cd 40                	int    $0x40
+ 6ab:	c3                   	ret
+
+000006ac <shmattach>:
+SYSCALL(shmattach)
+ 6ac:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6b1:	cd 40                	int    $0x40
+ 6b3:	c3                   	ret
+
+000006b4 <shmdetach>:
+SYSCALL(shmdetach)
+ 6b4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6b9:	cd 40                	int    $0x40
+ 6bb:	c3                   	ret
+
+000006bc <futex_wait>:
+SYSCALL(futex_wait)
+ 6bc:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6c1:	cd 40                	int    $0x40
+ 6c3:	c3                   	ret
+
+000006c4 <futex_wake>:
+SYSCALL(futex_wake)
+ 6c4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6c9:	cd 40                	int    $0x40
+ 6cb:	c3                   	ret
+
+000006cc <nice>:
+SYSCALL(nice)
+ 6cc:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6d1:	cd 40                	int    $0x40
+ 6d3:	c3                   	ret
+
+000006d4 <setpriority>:
+SYSCALL(setpriority)
+ 6d4:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6d9:	cd 40                	int    $0x40
+ 6db:	c3                   	ret
+
+000006dc <cputime>:
+SYSCALL(cputime)
+ 6dc:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6e1:	cd 40                	int    $0x40
+ 6e3:	c3                   	ret
+
+000006e4 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 6e4:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6e9:	cd 40                	int    $0x40
+ 6eb:	c3                   	ret
+
+000006ec <clone>:
+SYSCALL(clone)
+ 6ec:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6f1:	cd 40                	int    $0x40
+ 6f3:	c3                   	ret
+
+000006f4 <join>:
+SYSCALL(join)
+ 6f4:	b8 24 00 00 00       	mov    $0x24,%eax
+ 6f9:	cd 40                	int    $0x40
+ 6fb:	c3                   	ret
+
+000006fc <lockstat>:
+SYSCALL(lockstat)
+ 6fc:	b8 25 00 00 00       	mov    $0x25,%eax
+ 701:	cd 40                	int    $0x40
+ 703:	c3                   	ret
+ 704:	66 90                	xchg   %ax,%ax
+ 706:	66 90                	xchg   %ax,%ax
+ 708:	66 90                	xchg   %ax,%ax
+ 70a:	66 90                	xchg   %ax,%ax
+ 70c:	66 90                	xchg   %ax,%ax
+ 70e:	66 90                	xchg   %ax,%ax
+
+00000710 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 710:	55                   	push   %ebp
+ 711:	89 e5                	mov    %esp,%ebp
+ 713:	57                   	push   %edi
+ 714:	56                   	push   %esi
+ 715:	53                   	push   %ebx
+ 716:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 718:	89 d1                	mov    %edx,%ecx
+{
+ 71a:	83 ec 3c             	sub    $0x3c,%esp
+ 71d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 720:	85 d2                	test   %edx,%edx
+ 722:	0f 89 80 00 00 00    	jns    7a8 <printint+0x98>
+ 728:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 72c:	74 7a                	je     7a8 <printint+0x98>
+    x = -xx;
+ 72e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 730:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 735:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 738:	31 f6                	xor    %esi,%esi
+ 73a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 740:	89 c8                	mov    %ecx,%eax
+ 742:	31 d2                	xor    %edx,%edx
+ 744:	89 f7                	mov    %esi,%edi
+ 746:	f7 f3                	div    %ebx
+ 748:	8d 76 01             	lea    0x1(%esi),%esi
+ 74b:	0f b6 92 70 0b 00 00 	movzbl 0xb70(%edx),%edx
+ 752:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 756:	89 ca                	mov    %ecx,%edx
+ 758:	89 c1                	mov    %eax,%ecx
+ 75a:	39 da                	cmp    %ebx,%edx
+ 75c:	73 e2                	jae    740 <printint+0x30>
+  if(neg)
+ 75e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 761:	85 c0                	test   %eax,%eax
+ 763:	74 07                	je     76c <printint+0x5c>
+    buf[i++] = '-';
+ 765:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 76a:	89 f7                	mov    %esi,%edi
+ 76c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 76f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 772:	01 df                	add    %ebx,%edi
+ 774:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 778:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 77b:	83 ec 04             	sub    $0x4,%esp
+ 77e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 781:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 784:	6a 01                	push   $0x1
+ 786:	50                   	push   %eax
+ 787:	56                   	push   %esi
+ 788:	e8 77 fe ff ff       	call   604 <write>
+  while(--i >= 0)
+ 78d:	89 f8                	mov    %edi,%eax
+ 78f:	83 c4 10             	add    $0x10,%esp
+ 792:	83 ef 01             	sub    $0x1,%edi
+ 795:	39 d8                	cmp    %ebx,%eax
+ 797:	75 df                	jne    778 <printint+0x68>
+}
+ 799:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 79c:	5b                   	pop    %ebx
+ 79d:	5e                   	pop    %esi
+ 79e:	5f                   	pop    %edi
+ 79f:	5d                   	pop    %ebp
+ 7a0:	c3                   	ret
+ 7a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 7a8:	31 c0                	xor    %eax,%eax
+ 7aa:	eb 89                	jmp    735 <printint+0x25>
+ 7ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 7b0:	55                   	push   %ebp
+ 7b1:	89 e5                	mov    %esp,%ebp
+ 7b3:	57                   	push   %edi
+ 7b4:	56                   	push   %esi
+ 7b5:	53                   	push   %ebx
+ 7b6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 7b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 7bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 7bf:	0f b6 1e             	movzbl (%esi),%ebx
+ 7c2:	83 c6 01             	add    $0x1,%esi
+ 7c5:	84 db                	test   %bl,%bl
+ 7c7:	74 67                	je     830 <printf+0x80>
+ 7c9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 7cc:	31 d2                	xor    %edx,%edx
+ 7ce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 7d1:	eb 34                	jmp    807 <printf+0x57>
+ 7d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7d7:	90                   	nop
+ 7d8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 7db:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 7e0:	83 f8 25             	cmp    $0x25,%eax
+ 7e3:	74 18                	je     7fd <printf+0x4d>
+  write(fd, &c, 1);
+ 7e5:	83 ec 04             	sub    $0x4,%esp
+ 7e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 7eb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7ee:	6a 01                	push   $0x1
+ 7f0:	50                   	push   %eax
+ 7f1:	57                   	push   %edi
+ 7f2:	e8 0d fe ff ff       	call   604 <write>
+ 7f7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 7fa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 7fd:	0f b6 1e             	movzbl (%esi),%ebx
+ 800:	83 c6 01             	add    $0x1,%esi
+ 803:	84 db                	test   %bl,%bl
+ 805:	74 29                	je     830 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 807:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 80a:	85 d2                	test   %edx,%edx
+ 80c:	74 ca                	je     7d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 80e:	83 fa 25             	cmp    $0x25,%edx
+ 811:	75 ea                	jne    7fd <printf+0x4d>
+      if(c == 'd'){
+ 813:	83 f8 25             	cmp    $0x25,%eax
+ 816:	0f 84 24 01 00 00    	je     940 <printf+0x190>
+ 81c:	83 e8 63             	sub    $0x63,%eax
+ 81f:	83 f8 15             	cmp    $0x15,%eax
+ 822:	77 1c                	ja     840 <printf+0x90>
+ 824:	ff 24 85 18 0b 00 00 	jmp    *0xb18(,%eax,4)
+ 82b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 82f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 830:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 833:	5b                   	pop    %ebx
+ 834:	5e                   	pop    %esi
+ 835:	5f                   	pop    %edi
+ 836:	5d                   	pop    %ebp
+ 837:	c3                   	ret
+ 838:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 83f:	90                   	nop
+  write(fd, &c, 1);
+ 840:	83 ec 04             	sub    $0x4,%esp
+ 843:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 846:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 84a:	6a 01                	push   $0x1
+ 84c:	52                   	push   %edx
+ 84d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 850:	57                   	push   %edi
+ 851:	e8 ae fd ff ff       	call   604 <write>
+ 856:	83 c4 0c             	add    $0xc,%esp
+ 859:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 85c:	6a 01                	push   $0x1
+ 85e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 861:	52                   	push   %edx
+ 862:	57                   	push   %edi
+ 863:	e8 9c fd ff ff       	call   604 <write>
+        putc(fd, c);
+ 868:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 86b:	31 d2                	xor    %edx,%edx
+ 86d:	eb 8e                	jmp    7fd <printf+0x4d>
+ 86f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 870:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 873:	83 ec 0c             	sub    $0xc,%esp
+ 876:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 87b:	8b 13                	mov    (%ebx),%edx
+ 87d:	6a 00                	push   $0x0
+ 87f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 881:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 884:	e8 87 fe ff ff       	call   710 <printint>
+        ap++;
+ 889:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 88c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 88f:	31 d2                	xor    %edx,%edx
+ 891:	e9 67 ff ff ff       	jmp    7fd <printf+0x4d>
+ 896:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 8a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 8a3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 8a5:	83 c0 04             	add    $0x4,%eax
+ 8a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 8ab:	85 db                	test   %ebx,%ebx
+ 8ad:	0f 84 9d 00 00 00    	je     950 <printf+0x1a0>
+        while(*s != 0){
+ 8b3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 8b6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 8b8:	84 c0                	test   %al,%al
+ 8ba:	0f 84 3d ff ff ff    	je     7fd <printf+0x4d>
+ 8c0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8c3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 8c6:	89 de                	mov    %ebx,%esi
+ 8c8:	89 d3                	mov    %edx,%ebx
+ 8ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 8d0:	83 ec 04             	sub    $0x4,%esp
+ 8d3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 8d6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 8d9:	6a 01                	push   $0x1
+ 8db:	53                   	push   %ebx
+ 8dc:	57                   	push   %edi
+ 8dd:	e8 22 fd ff ff       	call   604 <write>
+        while(*s != 0){
+ 8e2:	0f b6 06             	movzbl (%esi),%eax
+ 8e5:	83 c4 10             	add    $0x10,%esp
+ 8e8:	84 c0                	test   %al,%al
+ 8ea:	75 e4                	jne    8d0 <printf+0x120>
+      state = 0;
+ 8ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 8ef:	31 d2                	xor    %edx,%edx
+ 8f1:	e9 07 ff ff ff       	jmp    7fd <printf+0x4d>
+ 8f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8fd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 900:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 903:	83 ec 0c             	sub    $0xc,%esp
+ 906:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 90b:	8b 13                	mov    (%ebx),%edx
+ 90d:	6a 01                	push   $0x1
+ 90f:	e9 6b ff ff ff       	jmp    87f <printf+0xcf>
+ 914:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 918:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 91b:	83 ec 04             	sub    $0x4,%esp
+ 91e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 921:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 923:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 926:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 929:	6a 01                	push   $0x1
+ 92b:	52                   	push   %edx
+ 92c:	57                   	push   %edi
+ 92d:	e8 d2 fc ff ff       	call   604 <write>
+        ap++;
+ 932:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 935:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 938:	31 d2                	xor    %edx,%edx
+ 93a:	e9 be fe ff ff       	jmp    7fd <printf+0x4d>
+ 93f:	90                   	nop
+  write(fd, &c, 1);
+ 940:	83 ec 04             	sub    $0x4,%esp
+ 943:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 946:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 949:	6a 01                	push   $0x1
+ 94b:	e9 11 ff ff ff       	jmp    861 <printf+0xb1>
+ 950:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 955:	bb 0e 0b 00 00       	mov    $0xb0e,%ebx
+ 95a:	e9 61 ff ff ff       	jmp    8c0 <printf+0x110>
+ 95f:	90                   	nop
+
+00000960 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 960:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 961:	a1 00 13 00 00       	mov    0x1300,%eax
+{
+ 966:	89 e5                	mov    %esp,%ebp
+ 968:	57                   	push   %edi
+ 969:	56                   	push   %esi
+ 96a:	53                   	push   %ebx
+ 96b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 96e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 971:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 978:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 97a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 97c:	39 ca                	cmp    %ecx,%edx
+ 97e:	73 30                	jae    9b0 <free+0x50>
+ 980:	39 c1                	cmp    %eax,%ecx
+ 982:	72 04                	jb     988 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 984:	39 c2                	cmp    %eax,%edx
+ 986:	72 f0                	jb     978 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 988:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 98b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 98e:	39 f8                	cmp    %edi,%eax
+ 990:	74 2e                	je     9c0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 992:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 995:	8b 42 04             	mov    0x4(%edx),%eax
+ 998:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 99b:	39 f1                	cmp    %esi,%ecx
+ 99d:	74 38                	je     9d7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 99f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 9a1:	5b                   	pop    %ebx
+  freep = p;
+ 9a2:	89 15 00 13 00 00    	mov    %edx,0x1300
+}
+ 9a8:	5e                   	pop    %esi
+ 9a9:	5f                   	pop    %edi
+ 9aa:	5d                   	pop    %ebp
+ 9ab:	c3                   	ret
+ 9ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9b0:	39 c1                	cmp    %eax,%ecx
+ 9b2:	72 d0                	jb     984 <free+0x24>
+ 9b4:	eb c2                	jmp    978 <free+0x18>
+ 9b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9bd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 9c0:	03 70 04             	add    0x4(%eax),%esi
+ 9c3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9c6:	8b 02                	mov    (%edx),%eax
+ 9c8:	8b 00                	mov    (%eax),%eax
+ 9ca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 9cd:	8b 42 04             	mov    0x4(%edx),%eax
+ 9d0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9d3:	39 f1                	cmp    %esi,%ecx
+ 9d5:	75 c8                	jne    99f <free+0x3f>
+    p->s.size += bp->s.size;
+ 9d7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 9da:	89 15 00 13 00 00    	mov    %edx,0x1300
+    p->s.size += bp->s.size;
+ 9e0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 9e3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 9e6:	89 0a                	mov    %ecx,(%edx)
+}
+ 9e8:	5b                   	pop    %ebx
+ 9e9:	5e                   	pop    %esi
+ 9ea:	5f                   	pop    %edi
+ 9eb:	5d                   	pop    %ebp
+ 9ec:	c3                   	ret
+ 9ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009f0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 9f0:	55                   	push   %ebp
+ 9f1:	89 e5                	mov    %esp,%ebp
+ 9f3:	57                   	push   %edi
+ 9f4:	56                   	push   %esi
+ 9f5:	53                   	push   %ebx
+ 9f6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 9fc:	8b 15 00 13 00 00    	mov    0x1300,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a02:	8d 78 07             	lea    0x7(%eax),%edi
+ a05:	c1 ef 03             	shr    $0x3,%edi
+ a08:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ a0b:	85 d2                	test   %edx,%edx
+ a0d:	0f 84 8d 00 00 00    	je     aa0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a13:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a15:	8b 48 04             	mov    0x4(%eax),%ecx
+ a18:	39 f9                	cmp    %edi,%ecx
+ a1a:	73 64                	jae    a80 <malloc+0x90>
+  if(nu < 4096)
+ a1c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a21:	39 df                	cmp    %ebx,%edi
+ a23:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a26:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a2d:	eb 0a                	jmp    a39 <malloc+0x49>
+ a2f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a30:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a32:	8b 48 04             	mov    0x4(%eax),%ecx
+ a35:	39 f9                	cmp    %edi,%ecx
+ a37:	73 47                	jae    a80 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ a39:	89 c2                	mov    %eax,%edx
+ a3b:	39 05 00 13 00 00    	cmp    %eax,0x1300
+ a41:	75 ed                	jne    a30 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ a43:	83 ec 0c             	sub    $0xc,%esp
+ a46:	56                   	push   %esi
+ a47:	e8 20 fc ff ff       	call   66c <sbrk>
+  if(p == (char*)-1)
+ a4c:	83 c4 10             	add    $0x10,%esp
+ a4f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a52:	74 1c                	je     a70 <malloc+0x80>
+  hp->s.size = nu;
+ a54:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ a57:	83 ec 0c             	sub    $0xc,%esp
+ a5a:	83 c0 08             	add    $0x8,%eax
+ a5d:	50                   	push   %eax
+ a5e:	e8 fd fe ff ff       	call   960 <free>
+  return freep;
+ a63:	8b 15 00 13 00 00    	mov    0x1300,%edx
+      if((p = morecore(nunits)) == 0)
+ a69:	83 c4 10             	add    $0x10,%esp
+ a6c:	85 d2                	test   %edx,%edx
+ a6e:	75 c0                	jne    a30 <malloc+0x40>
+        return 0;
+  }
+}
+ a70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a73:	31 c0                	xor    %eax,%eax
+}
+ a75:	5b                   	pop    %ebx
+ a76:	5e                   	pop    %esi
+ a77:	5f                   	pop    %edi
+ a78:	5d                   	pop    %ebp
+ a79:	c3                   	ret
+ a7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ a80:	39 cf                	cmp    %ecx,%edi
+ a82:	74 4c                	je     ad0 <malloc+0xe0>
+        p->s.size -= nunits;
+ a84:	29 f9                	sub    %edi,%ecx
+ a86:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ a89:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ a8c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ a8f:	89 15 00 13 00 00    	mov    %edx,0x1300
+}
+ a95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ a98:	83 c0 08             	add    $0x8,%eax
+}
+ a9b:	5b                   	pop    %ebx
+ a9c:	5e                   	pop    %esi
+ a9d:	5f                   	pop    %edi
+ a9e:	5d                   	pop    %ebp
+ a9f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ aa0:	c7 05 00 13 00 00 04 	movl   $0x1304,0x1300
+ aa7:	13 00 00 
+    base.s.size = 0;
+ aaa:	b8 04 13 00 00       	mov    $0x1304,%eax
+    base.s.ptr = freep = prevp = &base;
+ aaf:	c7 05 04 13 00 00 04 	movl   $0x1304,0x1304
+ ab6:	13 00 00 
+    base.s.size = 0;
+ ab9:	c7 05 08 13 00 00 00 	movl   $0x0,0x1308
+ ac0:	00 00 00 
+    if(p->s.size >= nunits){
+ ac3:	e9 54 ff ff ff       	jmp    a1c <malloc+0x2c>
+ ac8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ acf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ ad0:	8b 08                	mov    (%eax),%ecx
+ ad2:	89 0a                	mov    %ecx,(%edx)
+ ad4:	eb b9                	jmp    a8f <malloc+0x9f>
@@ -1,4 +1,20 @@
-// Simple PIO-based (non-DMA) IDE driver code.
+// Simple IDE driver code.
+//
+// Blocks move by PIO until pciinit() finds the PCI IDE
+// controller and calls idedmainit().  From then on they move
+// by bus-master DMA: the controller copies the data to or from
+// memory by itself, following a table of physical region
+// descriptors (PRDs), and interrupts when it is done.  A DMA
+// command also takes along the queued requests for the blocks
+// that follow the first one, so that a run of blocks costs one
+// command and one interrupt.
+//
+// Waiting requests are kept in two queues, one for reads and
+// one for writes, each in C-LOOK order: ascending block numbers
+// from where the last command taken from it started, then
+// around again from the lowest.  Reads go first, since
+// processes are waiting for them, but after IDE_MAXREADS read
+// commands in a row the writes get a turn.
 
 #include "types.h"
 #include "defs.h"
@@ -23,17 +39,56 @@
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_SETMUL 0xc6
+#define IDE_CMD_RDDMA 0xc8
+#define IDE_CMD_WRDMA 0xca
 
-// idequeue points to the buf now being read/written to the disk.
-// idequeue->qnext points to the next buf to be processed.
-// You must hold idelock while manipulating queue.
+#define SECTOR_PER_BLOCK (BSIZE/SECTOR_SIZE)
+#define IDE_MAXMULT   16   // most sectors per READ/WRITE MULTIPLE interrupt
+#define IDE_MAXDMA    (256/SECTOR_PER_BLOCK)  // most blocks per DMA command
+#define IDE_MAXREADS  8    // read commands in a row while writes wait
+
+// Bus-master IDE registers of the primary channel, as
+// offsets from the I/O base in the controller's BAR 4.
+#define BM_CMD        0    // command
+#define BM_STATUS     2    // status
+#define BM_PRDT       4    // physical address of the PRD table
+#define BM_CMD_START  0x01
+#define BM_CMD_READ   0x08 // device to memory
+#define BM_STATUS_ERR 0x02
+#define BM_STATUS_INT 0x04
+
+// A physical region descriptor: a piece of memory for the
+// controller to transfer to or from.  It must not cross a
+// 64 KB boundary; buffer data are page-aligned pages, so a
+// block never does.
+struct prd {
+  uint addr;
+  ushort len;
+  ushort flags;
+};
+#define PRD_EOT       0x8000  // last descriptor in the table
+
+// idequeue points to the bufs now being read/written to the
+// disk, through qnext.  readq and writeq hold the ones waiting.
+// You must hold idelock while manipulating the queues.
+
+struct ideq {
+  struct buf *head;  // through qnext, in the order to start them
+  uint pos;          // block number of the last one started
+};
 
 static struct spinlock idelock;
 static struct buf *idequeue;
+static struct ideq readq, writeq;
+static int nreads;   // read commands in a row while writes wait
 
 static int havedisk1;
 static void idestart(struct buf*);
 
+static uint bmbase;        // bus-master I/O base; 0 if PIO only
+static struct prd *prdt;   // PRD table for the current command
+
 // Wait for IDE disk to become ready.
 static int
 idewait(int checkerr)
@@ -65,33 +120,88 @@ ideinit(void)
     }
   }
 
+  // Have the disks move a whole block per interrupt in
+  // READ MULTIPLE and WRITE MULTIPLE.
+  if(SECTOR_PER_BLOCK > 1){
+    for(i = 0; i <= havedisk1; i++){
+      outb(0x1f6, 0xe0 | (i<<4));
+      idewait(0);
+      outb(0x1f2, SECTOR_PER_BLOCK);
+      outb(0x1f7, IDE_CMD_SETMUL);
+      idewait(0);
+    }
+  }
+
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0<<4));
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Use bus-master DMA through the controller whose bus-master
+// registers start at I/O port base.  Called by pciinit().
+int
+idedmainit(uint base)
+{
+  struct prd *p;
+
+  if(base == 0 || (p = (struct prd*)kalloc()) == 0)
+    return -1;
+  acquire(&idelock);
+  if(idequeue != 0)
+    panic("idedmainit: busy");
+  prdt = p;
+  bmbase = base;
+  outb(bmbase+BM_CMD, 0);
+  outb(bmbase+BM_STATUS, BM_STATUS_ERR|BM_STATUS_INT);
+  release(&idelock);
+  cprintf("ide: bus-master DMA at 0x%x\n", base);
+  return 0;
+}
+
+// Start the request for b and the bufs after it in its
+// qnext list, which are for the blocks that follow b's.
+// Caller must hold idelock.
 static void
 idestart(struct buf *b)
 {
+  struct buf *q;
+  int n, write;
+
   if(b == 0)
     panic("idestart");
-  if(b->blockno >= FSSIZE)
-    panic("incorrect blockno");
-  int sector_per_block =  BSIZE/SECTOR_SIZE;
+  int sector_per_block =  SECTOR_PER_BLOCK;
   int sector = b->blockno * sector_per_block;
   int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
   int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
 
-  if (sector_per_block > 7) panic("idestart");
+  if (sector_per_block > IDE_MAXMULT) panic("idestart");
+
+  write = b->flags & B_DIRTY;
+  for(n = 0, q = b; q; q = q->qnext, n++){
+    if(bmbase){
+      prdt[n].addr = V2P(q->data);
+      prdt[n].len = BSIZE;
+      prdt[n].flags = q->qnext ? 0 : PRD_EOT;
+    }
+  }
+  if(n > (bmbase ? IDE_MAXDMA : 1))
+    panic("idestart: too many");
+  if(b->blockno + n > FSSIZE)
+    panic("incorrect blockno");
 
   idewait(0);
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f2, (n * sector_per_block) & 0xff);  // number of sectors, 0 is 256
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
-  if(b->flags & B_DIRTY){
+  if(bmbase){
+    outl(bmbase+BM_PRDT, V2P(prdt));
+    outb(bmbase+BM_STATUS, BM_STATUS_ERR|BM_STATUS_INT);
+    outb(bmbase+BM_CMD, write ? 0 : BM_CMD_READ);
+    outb(0x1f7, write ? IDE_CMD_WRDMA : IDE_CMD_RDDMA);
+    outb(bmbase+BM_CMD, (write ? 0 : BM_CMD_READ) | BM_CMD_START);
+  } else if(write){
     outb(0x1f7, write_cmd);
     outsl(0x1f0, b->data, BSIZE/4);
   } else {
@@ -99,33 +209,94 @@ idestart(struct buf *b)
   }
 }
 
+// Add b to q, after the bufs that C-LOOK starts first.
+// Caller must hold idelock.
+static void
+ideqinsert(struct ideq *q, struct buf *b)
+{
+  struct buf **pp;
+
+  for(pp = &q->head; *pp; pp = &(*pp)->qnext)  //DOC:insert-queue
+    if((*pp)->blockno - q->pos > b->blockno - q->pos)
+      break;
+  b->qnext = *pp;
+  *pp = b;
+}
+
+// Start the next command, if any request is waiting.
+// Caller must hold idelock and the disk must be idle.
+static void
+idenext(void)
+{
+  struct ideq *q;
+  struct buf *b, *last;
+  int n;
+
+  if(readq.head && (writeq.head == 0 || nreads < IDE_MAXREADS)){
+    q = &readq;
+    nreads = writeq.head ? nreads + 1 : 0;
+  } else if(writeq.head){
+    q = &writeq;
+    nreads = 0;
+  } else
+    return;
+
+  // Take the first request and, with DMA, the ones for the
+  // blocks right after it.
+  b = last = q->head;
+  for(n = 1; bmbase && n < IDE_MAXDMA && last->qnext; n++){
+    if(last->qnext->dev != b->dev || last->qnext->blockno != last->blockno + 1)
+      break;
+    last = last->qnext;
+  }
+  q->head = last->qnext;
+  last->qnext = 0;
+  q->pos = b->blockno;
+  idequeue = b;
+  idestart(b);
+}
+
 // Interrupt handler.
 void
 ideintr(void)
 {
   struct buf *b;
+  int ok;
 
-  // First queued buffer is the active request.
+  // idequeue holds the bufs of the finished command.
   acquire(&idelock);
 
-  if((b = idequeue) == 0){
+  if(idequeue == 0){
     release(&idelock);
     return;
   }
-  idequeue = b->qnext;
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, BSIZE/4);
+  if(bmbase){
+    outb(bmbase+BM_CMD, 0);
+    outb(bmbase+BM_STATUS, BM_STATUS_ERR|BM_STATUS_INT);
+  }
+  ok = idewait(1) >= 0;
 
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+  while((b = idequeue) != 0){
+    idequeue = b->qnext;
 
-  // Start disk on next buf in queue.
-  if(idequeue != 0)
-    idestart(idequeue);
+    // Read data if needed.
+    if(!bmbase && !(b->flags & B_DIRTY) && ok)
+      insl(0x1f0, b->data, BSIZE/4);
+
+    // Wake process waiting for this buf, or release it if
+    // nobody is.
+    b->flags |= B_VALID;
+    b->flags &= ~B_DIRTY;
+    if(b->flags & B_ASYNC){
+      b->flags &= ~B_ASYNC;
+      brelse(b);
+    } else
+      wakeup(b);
+  }
+
+  // Start disk on the next request.
+  idenext();
 
   release(&idelock);
 }
@@ -134,29 +305,33 @@ ideintr(void)
 // Sync buf with disk.
 // If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
 // Else if B_VALID is not set, read buf from disk, set B_VALID.
+// If B_ASYNC is set, return at once; ideintr() releases the buf.
 void
 iderw(struct buf *b)
 {
-  struct buf **pp;
-
   if(!holdingsleep(&b->lock))
     panic("iderw: buf not locked");
   if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
     panic("iderw: nothing to do");
+
+  // Disk 1 may be a virtio disk instead (see virtblk.c).
+  if(b->dev == 1 && virtblkrw(b) == 0)
+    return;
   if(b->dev != 0 && !havedisk1)
     panic("iderw: ide disk 1 not present");
 
   acquire(&idelock);  //DOC:acquire-lock
 
-  // Append b to idequeue.
-  b->qnext = 0;
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
-    ;
-  *pp = b;
+  ideqinsert((b->flags & B_DIRTY) ? &writeq : &readq, b);
 
   // Start disk if necessary.
-  if(idequeue == b)
-    idestart(b);
+  if(idequeue == 0)
+    idenext();
+
+  if(b->flags & B_ASYNC){
+    release(&idelock);
+    return;
+  }
 
   // Wait for request to finish.
   while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
@@ -0,0 +1,1287 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+   f:	83 ec 08             	sub    $0x8,%esp
+  12:	6a 02                	push   $0x2
+  14:	68 28 08 00 00       	push   $0x828
+  19:	e8 56 03 00 00       	call   374 <open>
+  1e:	83 c4 10             	add    $0x10,%esp
+  21:	85 c0                	test   %eax,%eax
+  23:	0f 88 9f 00 00 00    	js     c8 <main+0xc8>
+    mknod("console", 1, 1);
+    open("console", O_RDWR);
+  }
+  dup(0);  // stdout
+  29:	83 ec 0c             	sub    $0xc,%esp
+  2c:	6a 00                	push   $0x0
+  2e:	e8 79 03 00 00       	call   3ac <dup>
+  dup(0);  // stderr
+  33:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  3a:	e8 6d 03 00 00       	call   3ac <dup>
+  3f:	83 c4 10             	add    $0x10,%esp
+  42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+  48:	83 ec 08             	sub    $0x8,%esp
+  4b:	68 30 08 00 00       	push   $0x830
+  50:	6a 01                	push   $0x1
+  52:	e8 a9 04 00 00       	call   500 <printf>
+    pid = fork();
+  57:	e8 d0 02 00 00       	call   32c <fork>
+    if(pid < 0){
+  5c:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+  5f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+  61:	85 c0                	test   %eax,%eax
+  63:	78 2c                	js     91 <main+0x91>
+      printf(1, "init: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+  65:	74 3d                	je     a4 <main+0xa4>
+  67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6e:	66 90                	xchg   %ax,%ax
+      exec("sh", argv);
+      printf(1, "init: exec sh failed\n");
+      exit();
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+  70:	e8 c7 02 00 00       	call   33c <wait>
+  75:	85 c0                	test   %eax,%eax
+  77:	78 cf                	js     48 <main+0x48>
+  79:	39 c3                	cmp    %eax,%ebx
+  7b:	74 cb                	je     48 <main+0x48>
+      printf(1, "zombie!\n");
+  7d:	83 ec 08             	sub    $0x8,%esp
+  80:	68 6f 08 00 00       	push   $0x86f
+  85:	6a 01                	push   $0x1
+  87:	e8 74 04 00 00       	call   500 <printf>
+  8c:	83 c4 10             	add    $0x10,%esp
+  8f:	eb df                	jmp    70 <main+0x70>
+      printf(1, "init: fork failed\n");
+  91:	53                   	push   %ebx
+  92:	53                   	push   %ebx
+  93:	68 43 08 00 00       	push   $0x843
+  98:	6a 01                	push   $0x1
+  9a:	e8 61 04 00 00       	call   500 <printf>
+      exit();
+  9f:	e8 90 02 00 00       	call   334 <exit>
+      exec("sh", argv);
+  a4:	50                   	push   %eax
+  a5:	50                   	push   %eax
+  a6:	68 78 0b 00 00       	push   $0xb78
+  ab:	68 56 08 00 00       	push   $0x856
+  b0:	e8 b7 02 00 00       	call   36c <exec>
+      printf(1, "init: exec sh failed\n");
+  b5:	5a                   	pop    %edx
+  b6:	59                   	pop    %ecx
+  b7:	68 59 08 00 00       	push   $0x859
+  bc:	6a 01                	push   $0x1
+  be:	e8 3d 04 00 00       	call   500 <printf>
+      exit();
+  c3:	e8 6c 02 00 00       	call   334 <exit>
+    mknod("console", 1, 1);
+  c8:	50                   	push   %eax
+  c9:	6a 01                	push   $0x1
+  cb:	6a 01                	push   $0x1
+  cd:	68 28 08 00 00       	push   $0x828
+  d2:	e8 a5 02 00 00       	call   37c <mknod>
+    open("console", O_RDWR);
+  d7:	58                   	pop    %eax
+  d8:	5a                   	pop    %edx
+  d9:	6a 02                	push   $0x2
+  db:	68 28 08 00 00       	push   $0x828
+  e0:	e8 8f 02 00 00       	call   374 <open>
+  e5:	83 c4 10             	add    $0x10,%esp
+  e8:	e9 3c ff ff ff       	jmp    29 <main+0x29>
+  ed:	66 90                	xchg   %ax,%ax
+  ef:	90                   	nop
+
+000000f0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  f1:	31 c0                	xor    %eax,%eax
+{
+  f3:	89 e5                	mov    %esp,%ebp
+  f5:	53                   	push   %ebx
+  f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 100:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 104:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 107:	83 c0 01             	add    $0x1,%eax
+ 10a:	84 d2                	test   %dl,%dl
+ 10c:	75 f2                	jne    100 <strcpy+0x10>
+    ;
+  return os;
+}
+ 10e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 111:	89 c8                	mov    %ecx,%eax
+ 113:	c9                   	leave
+ 114:	c3                   	ret
+ 115:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000120 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 126:	80 3a 00             	cmpb   $0x0,(%edx)
+ 129:	74 15                	je     140 <strlen+0x20>
+ 12b:	31 c0                	xor    %eax,%eax
+ 12d:	8d 76 00             	lea    0x0(%esi),%esi
+ 130:	83 c0 01             	add    $0x1,%eax
+ 133:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 137:	89 c1                	mov    %eax,%ecx
+ 139:	75 f5                	jne    130 <strlen+0x10>
+    ;
+  return n;
+}
+ 13b:	89 c8                	mov    %ecx,%eax
+ 13d:	5d                   	pop    %ebp
+ 13e:	c3                   	ret
+ 13f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 140:	31 c9                	xor    %ecx,%ecx
+}
+ 142:	5d                   	pop    %ebp
+ 143:	89 c8                	mov    %ecx,%eax
+ 145:	c3                   	ret
+ 146:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000150 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	57                   	push   %edi
+ 154:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 157:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 15a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 15d:	89 d7                	mov    %edx,%edi
+ 15f:	fc                   	cld
+ 160:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 162:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 165:	89 d0                	mov    %edx,%eax
+ 167:	c9                   	leave
+ 168:	c3                   	ret
+ 169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000170 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 170:	55                   	push   %ebp
+ 171:	89 e5                	mov    %esp,%ebp
+ 173:	8b 45 08             	mov    0x8(%ebp),%eax
+ 176:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 17a:	0f b6 10             	movzbl (%eax),%edx
+ 17d:	84 d2                	test   %dl,%dl
+ 17f:	75 12                	jne    193 <strchr+0x23>
+ 181:	eb 1d                	jmp    1a0 <strchr+0x30>
+ 183:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 187:	90                   	nop
+ 188:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 18c:	83 c0 01             	add    $0x1,%eax
+ 18f:	84 d2                	test   %dl,%dl
+ 191:	74 0d                	je     1a0 <strchr+0x30>
+    if(*s == c)
+ 193:	38 d1                	cmp    %dl,%cl
+ 195:	75 f1                	jne    188 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 197:	5d                   	pop    %ebp
+ 198:	c3                   	ret
+ 199:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 1a0:	31 c0                	xor    %eax,%eax
+}
+ 1a2:	5d                   	pop    %ebp
+ 1a3:	c3                   	ret
+ 1a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1af:	90                   	nop
+
+000001b0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	57                   	push   %edi
+ 1b4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1b5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1b8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1b9:	31 db                	xor    %ebx,%ebx
+{
+ 1bb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1be:	eb 27                	jmp    1e7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1c0:	83 ec 04             	sub    $0x4,%esp
+ 1c3:	6a 01                	push   $0x1
+ 1c5:	56                   	push   %esi
+ 1c6:	6a 00                	push   $0x0
+ 1c8:	e8 7f 01 00 00       	call   34c <read>
+    if(cc < 1)
+ 1cd:	83 c4 10             	add    $0x10,%esp
+ 1d0:	85 c0                	test   %eax,%eax
+ 1d2:	7e 1d                	jle    1f1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1d4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1db:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1df:	3c 0a                	cmp    $0xa,%al
+ 1e1:	74 10                	je     1f3 <gets+0x43>
+ 1e3:	3c 0d                	cmp    $0xd,%al
+ 1e5:	74 0c                	je     1f3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1e7:	89 df                	mov    %ebx,%edi
+ 1e9:	83 c3 01             	add    $0x1,%ebx
+ 1ec:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1ef:	7c cf                	jl     1c0 <gets+0x10>
+ 1f1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1fd:	5b                   	pop    %ebx
+ 1fe:	5e                   	pop    %esi
+ 1ff:	5f                   	pop    %edi
+ 200:	5d                   	pop    %ebp
+ 201:	c3                   	ret
+ 202:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 209:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000210 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	56                   	push   %esi
+ 214:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 215:	83 ec 08             	sub    $0x8,%esp
+ 218:	6a 00                	push   $0x0
+ 21a:	ff 75 08             	push   0x8(%ebp)
+ 21d:	e8 52 01 00 00       	call   374 <open>
+  if(fd < 0)
+ 222:	83 c4 10             	add    $0x10,%esp
+ 225:	85 c0                	test   %eax,%eax
+ 227:	78 27                	js     250 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 229:	83 ec 08             	sub    $0x8,%esp
+ 22c:	ff 75 0c             	push   0xc(%ebp)
+ 22f:	89 c3                	mov    %eax,%ebx
+ 231:	50                   	push   %eax
+ 232:	e8 55 01 00 00       	call   38c <fstat>
+  close(fd);
+ 237:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 23a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 23c:	e8 1b 01 00 00       	call   35c <close>
+  return r;
+ 241:	83 c4 10             	add    $0x10,%esp
+}
+ 244:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 247:	89 f0                	mov    %esi,%eax
+ 249:	5b                   	pop    %ebx
+ 24a:	5e                   	pop    %esi
+ 24b:	5d                   	pop    %ebp
+ 24c:	c3                   	ret
+ 24d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 250:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 255:	eb ed                	jmp    244 <stat+0x34>
+ 257:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25e:	66 90                	xchg   %ax,%ax
+
+00000260 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	57                   	push   %edi
+ 264:	56                   	push   %esi
+ 265:	8b 45 10             	mov    0x10(%ebp),%eax
+ 268:	8b 55 08             	mov    0x8(%ebp),%edx
+ 26b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 26e:	85 c0                	test   %eax,%eax
+ 270:	7e 13                	jle    285 <memmove+0x25>
+ 272:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 274:	89 d7                	mov    %edx,%edi
+ 276:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 280:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 281:	39 f8                	cmp    %edi,%eax
+ 283:	75 fb                	jne    280 <memmove+0x20>
+  return vdst;
+}
+ 285:	5e                   	pop    %esi
+ 286:	89 d0                	mov    %edx,%eax
+ 288:	5f                   	pop    %edi
+ 289:	5d                   	pop    %ebp
+ 28a:	c3                   	ret
+ 28b:	66 90                	xchg   %ax,%ax
+ 28d:	66 90                	xchg   %ax,%ax
+ 28f:	90                   	nop
+
+00000290 <strcmp>:
+#include "types.h"
+#include "util.h"
+
+int
+strcmp(const char *p, const char *q)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	53                   	push   %ebx
+ 294:	8b 55 08             	mov    0x8(%ebp),%edx
+ 297:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 29a:	0f b6 02             	movzbl (%edx),%eax
+ 29d:	84 c0                	test   %al,%al
+ 29f:	75 17                	jne    2b8 <strcmp+0x28>
+ 2a1:	eb 3a                	jmp    2dd <strcmp+0x4d>
+ 2a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2a7:	90                   	nop
+ 2a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 2ac:	83 c2 01             	add    $0x1,%edx
+ 2af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 2b2:	84 c0                	test   %al,%al
+ 2b4:	74 1a                	je     2d0 <strcmp+0x40>
+    p++, q++;
+ 2b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 2b8:	0f b6 19             	movzbl (%ecx),%ebx
+ 2bb:	38 c3                	cmp    %al,%bl
+ 2bd:	74 e9                	je     2a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 2bf:	29 d8                	sub    %ebx,%eax
+}
+ 2c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2c4:	c9                   	leave
+ 2c5:	c3                   	ret
+ 2c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 2d4:	31 c0                	xor    %eax,%eax
+ 2d6:	29 d8                	sub    %ebx,%eax
+}
+ 2d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2db:	c9                   	leave
+ 2dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2dd:	0f b6 19             	movzbl (%ecx),%ebx
+ 2e0:	31 c0                	xor    %eax,%eax
+ 2e2:	eb db                	jmp    2bf <strcmp+0x2f>
+ 2e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ef:	90                   	nop
+
+000002f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	53                   	push   %ebx
+ 2f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2f7:	0f be 02             	movsbl (%edx),%eax
+ 2fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2fd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 300:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 305:	77 1e                	ja     325 <atoi+0x35>
+ 307:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 310:	83 c2 01             	add    $0x1,%edx
+ 313:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 316:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 31a:	0f be 02             	movsbl (%edx),%eax
+ 31d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 320:	80 fb 09             	cmp    $0x9,%bl
+ 323:	76 eb                	jbe    310 <atoi+0x20>
+  return n;
+ 325:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 328:	89 c8                	mov    %ecx,%eax
+ 32a:	c9                   	leave
+ 32b:	c3                   	ret
+
+0000032c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 32c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 331:	cd 40                	int    $0x40
+ 333:	c3                   	ret
+
+00000334 <exit>:
+SYSCALL(exit)
+ 334:	b8 02 00 00 00       	mov    $0x2,%eax
+ 339:	cd 40                	int    $0x40
+ 33b:	c3                   	ret
+
+0000033c <wait>:
+SYSCALL(wait)
+ 33c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 341:	cd 40                	int    $0x40
+ 343:	c3                   	ret
+
+00000344 <pipe>:
+SYSCALL(pipe)
+ 344:	b8 04 00 00 00       	mov    $0x4,%eax
+ 349:	cd 40                	int    $0x40
+ 34b:	c3                   	ret
+
+0000034c <read>:
+SYSCALL(read)
+ 34c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 351:	cd 40                	int    $0x40
+ 353:	c3                   	ret
+
+00000354 <write>:
+SYSCALL(write)
+ 354:	b8 10 00 00 00       	mov    $0x10,%eax
+ 359:	cd 40                	int    $0x40
+ 35b:	c3                   	ret
+
+0000035c <close>:
+SYSCALL(close)
+ 35c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 361:	cd 40                	int    $0x40
+ 363:	c3                   	ret
+
+00000364 <kill>:
+SYSCALL(kill)
+ 364:	b8 06 00 00 00       	mov    $0x6,%eax
+ 369:	cd 40                	int    $0x40
+ 36b:	c3                   	ret
+
+0000036c <exec>:
+SYSCALL(exec)
+ 36c:	b8 07 00 00 00       	mov    $0x7,%eax
+ 371:	cd 40                	int    $0x40
+ 373:	c3                   	ret
+
+00000374 <open>:
+SYSCALL(open)
+ 374:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 379:	cd 40                	int    $0x40
+ 37b:	c3                   	ret
+
+0000037c <mknod>:
+SYSCALL(mknod)
+ 37c:	b8 11 00 00 00       	mov    $0x11,%eax
+ 381:	cd 40                	int    $0x40
+ 383:	c3                   	ret
+
+00000384 <unlink>:
+SYSCALL(unlink)
+ 384:	b8 12 00 00 00       	mov    $0x12,%eax
+ 389:	cd 40                	int    $0x40
+ 38b:	c3                   	ret
+
+0000038c <fstat>:
+SYSCALL(fstat)
+ 38c:	b8 08 00 00 00       	mov    $0x8,%eax
+ 391:	cd 40                	int    $0x40
+ 393:	c3                   	ret
+
+00000394 <link>:
+SYSCALL(link)
+ 394:	b8 13 00 00 00       	mov    $0x13,%eax
+ 399:	cd 40                	int    $0x40
+ 39b:	c3                   	ret
+
+0000039c <mkdir>:
+SYSCALL(mkdir)
+ 39c:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3a1:	cd 40                	int    $0x40
+ 3a3:	c3                   	ret
+
+000003a4 <chdir>:
+SYSCALL(chdir)
+ 3a4:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3a9:	cd 40                	int    $0x40
+ 3ab:	c3                   	ret
+
+000003ac <dup>:
+SYSCALL(dup)
+ 3ac:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3b1:	cd 40                	int    $0x40
+ 3b3:	c3                   	ret
+
+000003b4 <getpid>:
+SYSCALL(getpid)
+ 3b4:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3b9:	cd 40                	int    $0x40
+ 3bb:	c3                   	ret
+
+000003bc <sbrk>:
+SYSCALL(sbrk)
+ 3bc:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3c1:	cd 40                	int    $0x40
+ 3c3:	c3                   	ret
+
+000003c4 <sleep>:
+SYSCALL(sleep)
+ 3c4:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3c9:	cd 40                	int    $0x40
+ 3cb:	c3                   	ret
+
+000003cc <uptime>:
+SYSCALL(uptime)
+ 3cc:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3d1:	cd 40                	int    $0x40
+ 3d3:	c3                   	ret
+
+000003d4 <arp>:
+SYSCALL(arp)
+ 3d4:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3d9:	cd 40                	int    $0x40
+ 3db:	c3                   	ret
+
+000003dc <mmap>:
+SYSCALL(mmap)
+ 3dc:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3e1:	cd 40                	int    $0x40
+ 3e3:	c3                   	ret
+
+000003e4 <munmap>:
+SYSCALL(munmap)
+ 3e4:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3e9:	cd 40                	int    $0x40
+ 3eb:	c3                   	ret
+
+000003ec <msync>:
+SYSCALL(msync)
+ 3ec:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3f1:	cd 40                	int    $0x40
+ 3f3:	c3                   	ret
+
+000003f4 <shmcreate>:
+SYSCALL(shmcreate)
+ 3f4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3f9:	cd 40                	int    $0x40
+ 3fb:	c3                   	ret
+
+000003fc <shmattach>:
+SYSCALL(shmattach)
+ 3fc:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 401:	cd 40                	int    $0x40
+ 403:	c3                   	ret
+
+00000404 <shmdetach>:
+SYSCALL(shmdetach)
+ 404:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 409:	cd 40                	int    $0x40
+ 40b:	c3                   	ret
+
+0000040c <futex_wait>:
+SYSCALL(futex_wait)
+ 40c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 411:	cd 40                	int    $0x40
+ 413:	c3                   	ret
+
+00000414 <futex_wake>:
+SYSCALL(futex_wake)
+ 414:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 419:	cd 40                	int    $0x40
+ 41b:	c3                   	ret
+
+0000041c <nice>:
+SYSCALL(nice)
+ 41c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 421:	cd 40                	int    $0x40
+ 423:	c3                   	ret
+
+00000424 <setpriority>:
+SYSCALL(setpriority)
+ 424:	b8 20 00 00 00       	mov    $0x20,%eax
+ 429:	cd 40                	int    $0x40
+ 42b:	c3                   	ret
+
+0000042c <cputime>:
+SYSCALL(cputime)
+ 42c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 431:	cd 40                	int    $0x40
+ 433:	c3                   	ret
+
+00000434 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 434:	b8 22 00 00 00       	mov    $0x22,%eax
+ 439:	cd 40                	int    $0x40
+ 43b:	c3                   	ret
+
+0000043c <clone>:
+SYSCALL(clone)
+ 43c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 441:	cd 40                	int    $0x40
+ 443:	c3                   	ret
+
+00000444 <join>:
+SYSCALL(join)
+ 444:	b8 24 00 00 00       	mov    $0x24,%eax
+ 449:	cd 40                	int    $0x40
+ 44b:	c3                   	ret
+
+0000044c <lockstat>:
+SYSCALL(lockstat)
+ 44c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 451:	cd 40                	int    $0x40
+ 453:	c3                   	ret
+ 454:	66 90                	xchg   %ax,%ax
+ 456:	66 90                	xchg   %ax,%ax
+ 458:	66 90                	xchg   %ax,%ax
+ 45a:	66 90                	xchg   %ax,%ax
+ 45c:	66 90                	xchg   %ax,%ax
+ 45e:	66 90                	xchg   %ax,%ax
+
+00000460 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+ 465:	53                   	push   %ebx
+ 466:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 468:	89 d1                	mov    %edx,%ecx
+{
+ 46a:	83 ec 3c             	sub    $0x3c,%esp
+ 46d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 470:	85 d2                	test   %edx,%edx
+ 472:	0f 89 80 00 00 00    	jns    4f8 <printint+0x98>
+ 478:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 47c:	74 7a                	je     4f8 <printint+0x98>
+    x = -xx;
+ 47e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 480:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 485:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 488:	31 f6                	xor    %esi,%esi
+ 48a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 490:	89 c8                	mov    %ecx,%eax
+ 492:	31 d2                	xor    %edx,%edx
+ 494:	89 f7                	mov    %esi,%edi
+ 496:	f7 f3                	div    %ebx
+ 498:	8d 76 01             	lea    0x1(%esi),%esi
+ 49b:	0f b6 92 d8 08 00 00 	movzbl 0x8d8(%edx),%edx
+ 4a2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 4a6:	89 ca                	mov    %ecx,%edx
+ 4a8:	89 c1                	mov    %eax,%ecx
+ 4aa:	39 da                	cmp    %ebx,%edx
+ 4ac:	73 e2                	jae    490 <printint+0x30>
+  if(neg)
+ 4ae:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 4b1:	85 c0                	test   %eax,%eax
+ 4b3:	74 07                	je     4bc <printint+0x5c>
+    buf[i++] = '-';
+ 4b5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 4ba:	89 f7                	mov    %esi,%edi
+ 4bc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 4bf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 4c2:	01 df                	add    %ebx,%edi
+ 4c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 4c8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 4cb:	83 ec 04             	sub    $0x4,%esp
+ 4ce:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 4d1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 4d4:	6a 01                	push   $0x1
+ 4d6:	50                   	push   %eax
+ 4d7:	56                   	push   %esi
+ 4d8:	e8 77 fe ff ff       	call   354 <write>
+  while(--i >= 0)
+ 4dd:	89 f8                	mov    %edi,%eax
+ 4df:	83 c4 10             	add    $0x10,%esp
+ 4e2:	83 ef 01             	sub    $0x1,%edi
+ 4e5:	39 d8                	cmp    %ebx,%eax
+ 4e7:	75 df                	jne    4c8 <printint+0x68>
+}
+ 4e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4ec:	5b                   	pop    %ebx
+ 4ed:	5e                   	pop    %esi
+ 4ee:	5f                   	pop    %edi
+ 4ef:	5d                   	pop    %ebp
+ 4f0:	c3                   	ret
+ 4f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 4f8:	31 c0                	xor    %eax,%eax
+ 4fa:	eb 89                	jmp    485 <printint+0x25>
+ 4fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000500 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 500:	55                   	push   %ebp
+ 501:	89 e5                	mov    %esp,%ebp
+ 503:	57                   	push   %edi
+ 504:	56                   	push   %esi
+ 505:	53                   	push   %ebx
+ 506:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 509:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 50c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 50f:	0f b6 1e             	movzbl (%esi),%ebx
+ 512:	83 c6 01             	add    $0x1,%esi
+ 515:	84 db                	test   %bl,%bl
+ 517:	74 67                	je     580 <printf+0x80>
+ 519:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 51c:	31 d2                	xor    %edx,%edx
+ 51e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 521:	eb 34                	jmp    557 <printf+0x57>
+ 523:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 527:	90                   	nop
+ 528:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 52b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 530:	83 f8 25             	cmp    $0x25,%eax
+ 533:	74 18                	je     54d <printf+0x4d>
+  write(fd, &c, 1);
+ 535:	83 ec 04             	sub    $0x4,%esp
+ 538:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 53b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 53e:	6a 01                	push   $0x1
+ 540:	50                   	push   %eax
+ 541:	57                   	push   %edi
+ 542:	e8 0d fe ff ff       	call   354 <write>
+ 547:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 54a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 54d:	0f b6 1e             	movzbl (%esi),%ebx
+ 550:	83 c6 01             	add    $0x1,%esi
+ 553:	84 db                	test   %bl,%bl
+ 555:	74 29                	je     580 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 557:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 55a:	85 d2                	test   %edx,%edx
+ 55c:	74 ca                	je     528 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 55e:	83 fa 25             	cmp    $0x25,%edx
+ 561:	75 ea                	jne    54d <printf+0x4d>
+      if(c == 'd'){
+ 563:	83 f8 25             	cmp    $0x25,%eax
+ 566:	0f 84 24 01 00 00    	je     690 <printf+0x190>
+ 56c:	83 e8 63             	sub    $0x63,%eax
+ 56f:	83 f8 15             	cmp    $0x15,%eax
+ 572:	77 1c                	ja     590 <printf+0x90>
+ 574:	ff 24 85 80 08 00 00 	jmp    *0x880(,%eax,4)
+ 57b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 57f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 580:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 583:	5b                   	pop    %ebx
+ 584:	5e                   	pop    %esi
+ 585:	5f                   	pop    %edi
+ 586:	5d                   	pop    %ebp
+ 587:	c3                   	ret
+ 588:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58f:	90                   	nop
+  write(fd, &c, 1);
+ 590:	83 ec 04             	sub    $0x4,%esp
+ 593:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 596:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 59a:	6a 01                	push   $0x1
+ 59c:	52                   	push   %edx
+ 59d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 5a0:	57                   	push   %edi
+ 5a1:	e8 ae fd ff ff       	call   354 <write>
+ 5a6:	83 c4 0c             	add    $0xc,%esp
+ 5a9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5ac:	6a 01                	push   $0x1
+ 5ae:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 5b1:	52                   	push   %edx
+ 5b2:	57                   	push   %edi
+ 5b3:	e8 9c fd ff ff       	call   354 <write>
+        putc(fd, c);
+ 5b8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5bb:	31 d2                	xor    %edx,%edx
+ 5bd:	eb 8e                	jmp    54d <printf+0x4d>
+ 5bf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 5c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5c3:	83 ec 0c             	sub    $0xc,%esp
+ 5c6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 5cb:	8b 13                	mov    (%ebx),%edx
+ 5cd:	6a 00                	push   $0x0
+ 5cf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 5d1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 5d4:	e8 87 fe ff ff       	call   460 <printint>
+        ap++;
+ 5d9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 5dc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5df:	31 d2                	xor    %edx,%edx
+ 5e1:	e9 67 ff ff ff       	jmp    54d <printf+0x4d>
+ 5e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ed:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 5f0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 5f3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 5f5:	83 c0 04             	add    $0x4,%eax
+ 5f8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 5fb:	85 db                	test   %ebx,%ebx
+ 5fd:	0f 84 9d 00 00 00    	je     6a0 <printf+0x1a0>
+        while(*s != 0){
+ 603:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 606:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 608:	84 c0                	test   %al,%al
+ 60a:	0f 84 3d ff ff ff    	je     54d <printf+0x4d>
+ 610:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 613:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 616:	89 de                	mov    %ebx,%esi
+ 618:	89 d3                	mov    %edx,%ebx
+ 61a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 620:	83 ec 04             	sub    $0x4,%esp
+ 623:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 626:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 629:	6a 01                	push   $0x1
+ 62b:	53                   	push   %ebx
+ 62c:	57                   	push   %edi
+ 62d:	e8 22 fd ff ff       	call   354 <write>
+        while(*s != 0){
+ 632:	0f b6 06             	movzbl (%esi),%eax
+ 635:	83 c4 10             	add    $0x10,%esp
+ 638:	84 c0                	test   %al,%al
+ 63a:	75 e4                	jne    620 <printf+0x120>
+      state = 0;
+ 63c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 63f:	31 d2                	xor    %edx,%edx
+ 641:	e9 07 ff ff ff       	jmp    54d <printf+0x4d>
+ 646:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 64d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 650:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 653:	83 ec 0c             	sub    $0xc,%esp
+ 656:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 65b:	8b 13                	mov    (%ebx),%edx
+ 65d:	6a 01                	push   $0x1
+ 65f:	e9 6b ff ff ff       	jmp    5cf <printf+0xcf>
+ 664:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 668:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 66b:	83 ec 04             	sub    $0x4,%esp
+ 66e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 671:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 673:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 676:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 679:	6a 01                	push   $0x1
+ 67b:	52                   	push   %edx
+ 67c:	57                   	push   %edi
+ 67d:	e8 d2 fc ff ff       	call   354 <write>
+        ap++;
+ 682:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 685:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 688:	31 d2                	xor    %edx,%edx
+ 68a:	e9 be fe ff ff       	jmp    54d <printf+0x4d>
+ 68f:	90                   	nop
+  write(fd, &c, 1);
+ 690:	83 ec 04             	sub    $0x4,%esp
+ 693:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 696:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 699:	6a 01                	push   $0x1
+ 69b:	e9 11 ff ff ff       	jmp    5b1 <printf+0xb1>
+ 6a0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 6a5:	bb 78 08 00 00       	mov    $0x878,%ebx
+ 6aa:	e9 61 ff ff ff       	jmp    610 <printf+0x110>
+ 6af:	90                   	nop
+
+000006b0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6b0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6b1:	a1 80 0b 00 00       	mov    0xb80,%eax
+{
+ 6b6:	89 e5                	mov    %esp,%ebp
+ 6b8:	57                   	push   %edi
+ 6b9:	56                   	push   %esi
+ 6ba:	53                   	push   %ebx
+ 6bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 6be:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6c8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6ca:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6cc:	39 ca                	cmp    %ecx,%edx
+ 6ce:	73 30                	jae    700 <free+0x50>
+ 6d0:	39 c1                	cmp    %eax,%ecx
+ 6d2:	72 04                	jb     6d8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6d4:	39 c2                	cmp    %eax,%edx
+ 6d6:	72 f0                	jb     6c8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 6d8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 6db:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 6de:	39 f8                	cmp    %edi,%eax
+ 6e0:	74 2e                	je     710 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6e2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 6e5:	8b 42 04             	mov    0x4(%edx),%eax
+ 6e8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 6eb:	39 f1                	cmp    %esi,%ecx
+ 6ed:	74 38                	je     727 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 6ef:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 6f1:	5b                   	pop    %ebx
+  freep = p;
+ 6f2:	89 15 80 0b 00 00    	mov    %edx,0xb80
+}
+ 6f8:	5e                   	pop    %esi
+ 6f9:	5f                   	pop    %edi
+ 6fa:	5d                   	pop    %ebp
+ 6fb:	c3                   	ret
+ 6fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 700:	39 c1                	cmp    %eax,%ecx
+ 702:	72 d0                	jb     6d4 <free+0x24>
+ 704:	eb c2                	jmp    6c8 <free+0x18>
+ 706:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 70d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 710:	03 70 04             	add    0x4(%eax),%esi
+ 713:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 716:	8b 02                	mov    (%edx),%eax
+ 718:	8b 00                	mov    (%eax),%eax
+ 71a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 71d:	8b 42 04             	mov    0x4(%edx),%eax
+ 720:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 723:	39 f1                	cmp    %esi,%ecx
+ 725:	75 c8                	jne    6ef <free+0x3f>
+    p->s.size += bp->s.size;
+ 727:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 72a:	89 15 80 0b 00 00    	mov    %edx,0xb80
+    p->s.size += bp->s.size;
+ 730:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 733:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 736:	89 0a                	mov    %ecx,(%edx)
+}
+ 738:	5b                   	pop    %ebx
+ 739:	5e                   	pop    %esi
+ 73a:	5f                   	pop    %edi
+ 73b:	5d                   	pop    %ebp
+ 73c:	c3                   	ret
+ 73d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000740 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 740:	55                   	push   %ebp
+ 741:	89 e5                	mov    %esp,%ebp
+ 743:	57                   	push   %edi
+ 744:	56                   	push   %esi
+ 745:	53                   	push   %ebx
+ 746:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 749:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 74c:	8b 15 80 0b 00 00    	mov    0xb80,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 752:	8d 78 07             	lea    0x7(%eax),%edi
+ 755:	c1 ef 03             	shr    $0x3,%edi
+ 758:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 75b:	85 d2                	test   %edx,%edx
+ 75d:	0f 84 8d 00 00 00    	je     7f0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 763:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 765:	8b 48 04             	mov    0x4(%eax),%ecx
+ 768:	39 f9                	cmp    %edi,%ecx
+ 76a:	73 64                	jae    7d0 <malloc+0x90>
+  if(nu < 4096)
+ 76c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 771:	39 df                	cmp    %ebx,%edi
+ 773:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 776:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 77d:	eb 0a                	jmp    789 <malloc+0x49>
+ 77f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 780:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 782:	8b 48 04             	mov    0x4(%eax),%ecx
+ 785:	39 f9                	cmp    %edi,%ecx
+ 787:	73 47                	jae    7d0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 789:	89 c2                	mov    %eax,%edx
+ 78b:	39 05 80 0b 00 00    	cmp    %eax,0xb80
+ 791:	75 ed                	jne    780 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 793:	83 ec 0c             	sub    $0xc,%esp
+ 796:	56                   	push   %esi
+ 797:	e8 20 fc ff ff       	call   3bc <sbrk>
+  if(p == (char*)-1)
+ 79c:	83 c4 10             	add    $0x10,%esp
+ 79f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 7a2:	74 1c                	je     7c0 <malloc+0x80>
+  hp->s.size = nu;
+ 7a4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 7a7:	83 ec 0c             	sub    $0xc,%esp
+ 7aa:	83 c0 08             	add    $0x8,%eax
+ 7ad:	50                   	push   %eax
+ 7ae:	e8 fd fe ff ff       	call   6b0 <free>
+  return freep;
+ 7b3:	8b 15 80 0b 00 00    	mov    0xb80,%edx
+      if((p = morecore(nunits)) == 0)
+ 7b9:	83 c4 10             	add    $0x10,%esp
+ 7bc:	85 d2                	test   %edx,%edx
+ 7be:	75 c0                	jne    780 <malloc+0x40>
+        return 0;
+  }
+}
+ 7c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 7c3:	31 c0                	xor    %eax,%eax
+}
+ 7c5:	5b                   	pop    %ebx
+ 7c6:	5e                   	pop    %esi
+ 7c7:	5f                   	pop    %edi
+ 7c8:	5d                   	pop    %ebp
+ 7c9:	c3                   	ret
+ 7ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 7d0:	39 cf                	cmp    %ecx,%edi
+ 7d2:	74 4c                	je     820 <malloc+0xe0>
+        p->s.size -= nunits;
+ 7d4:	29 f9                	sub    %edi,%ecx
+ 7d6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 7d9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 7dc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 7df:	89 15 80 0b 00 00    	mov    %edx,0xb80
+}
+ 7e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 7e8:	83 c0 08             	add    $0x8,%eax
+}
+ 7eb:	5b                   	pop    %ebx
+ 7ec:	5e                   	pop    %esi
+ 7ed:	5f                   	pop    %edi
+ 7ee:	5d                   	pop    %ebp
+ 7ef:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 7f0:	c7 05 80 0b 00 00 84 	movl   $0xb84,0xb80
+ 7f7:	0b 00 00 
+    base.s.size = 0;
+ 7fa:	b8 84 0b 00 00       	mov    $0xb84,%eax
+    base.s.ptr = freep = prevp = &base;
+ 7ff:	c7 05 84 0b 00 00 84 	movl   $0xb84,0xb84
+ 806:	0b 00 00 
+    base.s.size = 0;
+ 809:	c7 05 88 0b 00 00 00 	movl   $0x0,0xb88
+ 810:	00 00 00 
+    if(p->s.size >= nunits){
+ 813:	e9 54 ff ff ff       	jmp    76c <malloc+0x2c>
+ 818:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 81f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 820:	8b 08                	mov    (%eax),%ecx
+ 822:	89 0a                	mov    %ecx,(%edx)
+ 824:	eb b9                	jmp    7df <malloc+0x9f>
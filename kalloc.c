@@ -1,6 +1,12 @@
 // Physical memory allocator, intended to allocate
 // memory for user processes, kernel stacks, page table pages,
 // and pipe buffers. Allocates 4096-byte pages.
+//
+// A page can be mapped by several page tables at once (shared
+// program text, copy-on-write pages), so each page carries a
+// reference count.  kalloc() returns a page with one reference,
+// kdup() adds one, and kfree() drops one, only putting the page
+// back on the free list when the last reference goes away.
 
 #include "types.h"
 #include "defs.h"
@@ -21,6 +27,8 @@ struct {
   struct spinlock lock;
   int use_lock;
   struct run *freelist;
+  uint nfree;      // number of pages on freelist
+  ushort ref[PHYSTOP/PGSIZE];  // references to each physical page
 } kmem;
 
 // Initialization happens in two phases.
@@ -64,6 +72,19 @@ kfree(char *v)
   if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
     panic("kfree");
 
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  if(kmem.ref[V2P(v)/PGSIZE] > 1){
+    // Still mapped somewhere else.
+    kmem.ref[V2P(v)/PGSIZE]--;
+    if(kmem.use_lock)
+      release(&kmem.lock);
+    return;
+  }
+  kmem.ref[V2P(v)/PGSIZE] = 0;
+  if(kmem.use_lock)
+    release(&kmem.lock);
+
   // Fill with junk to catch dangling refs.
   memset(v, 1, PGSIZE);
 
@@ -72,6 +93,7 @@ kfree(char *v)
   r = (struct run*)v;
   r->next = kmem.freelist;
   kmem.freelist = r;
+  kmem.nfree++;
   if(kmem.use_lock)
     release(&kmem.lock);
 }
@@ -87,10 +109,45 @@ kalloc(void)
   if(kmem.use_lock)
     acquire(&kmem.lock);
   r = kmem.freelist;
-  if(r)
+  if(r){
     kmem.freelist = r->next;
+    kmem.nfree--;
+    kmem.ref[V2P(r)/PGSIZE] = 1;
+  }
   if(kmem.use_lock)
     release(&kmem.lock);
   return (char*)r;
 }
 
+// Add a reference to the page at v, which must have
+// been returned by kalloc().
+void
+kdup(char *v)
+{
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+    panic("kdup");
+
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  if(kmem.ref[V2P(v)/PGSIZE] < 1)
+    panic("kdup: free page");
+  kmem.ref[V2P(v)/PGSIZE]++;
+  if(kmem.use_lock)
+    release(&kmem.lock);
+}
+
+// Return the number of references to the page at v.
+int
+krefcount(char *v)
+{
+  return kmem.ref[V2P(v)/PGSIZE];
+}
+
+// Return the number of free physical pages.
+// Only a hint: the count may change as soon as it is read.
+uint
+kfreecount(void)
+{
+  return kmem.nfree;
+}
+
@@ -42,6 +42,8 @@
 #define TDCR    (0x03E0/4)   // Timer Divide Configuration
 
 volatile uint *lapic;  // Initialized in mp.c
+uint tsctick;          // TSC cycles per clock tick
+static uint lapictick; // LAPIC timer counts per clock tick
 
 //PAGEBREAK!
 static void
@@ -51,6 +53,37 @@ lapicw(int index, int value)
   lapic[ID];  // wait for write to finish, by reading
 }
 
+// 8254 programmable interval timer, channel 2.
+#define PIT_HZ    1193182  // input clock
+#define PIT_CH2   0x42
+#define PIT_CTRL  0x43
+#define PIT_GATE  0x61     // bit 0 gates channel 2, bit 5 is its output
+
+// Count how far the LAPIC timer and the TSC advance
+// during one clock tick, timed by the PIT.
+static void
+lapiccalibrate(void)
+{
+  uint latch;
+  uint64_t t0;
+
+  latch = PIT_HZ / HZ;
+  outb(PIT_GATE, (inb(PIT_GATE) & ~0x02) | 0x01);  // gate on, speaker off
+  outb(PIT_CTRL, 0xB0);  // channel 2, one-shot, low then high byte
+  outb(PIT_CH2, latch & 0xFF);
+  outb(PIT_CH2, latch >> 8);  // starts counting
+  lapicw(TIMER, MASKED);
+  lapicw(TICR, 0xFFFFFFFF);
+  t0 = rdtsc();
+  while((inb(PIT_GATE) & 0x20) == 0)
+    ;
+  tsctick = rdtsc() - t0;
+  lapictick = 0xFFFFFFFF - lapic[TCCR];
+  lapicw(TICR, 0);
+  if(lapictick == 0)
+    lapictick = 10000000;
+}
+
 void
 lapicinit(void)
 {
@@ -60,13 +93,15 @@ lapicinit(void)
   // Enable local APIC; set spurious interrupt vector.
   lapicw(SVR, ENABLE | (T_IRQ0 + IRQ_SPURIOUS));
 
-  // The timer repeatedly counts down at bus frequency
-  // from lapic[TICR] and then issues an interrupt.
-  // If xv6 cared more about precise timekeeping,
-  // TICR would be calibrated using an external time source.
+  // The timer counts down once at bus frequency from
+  // lapic[TICR] and then issues an interrupt; see lapictimer.
+  // The boot CPU measures the bus frequency against the
+  // PIT first, and the other CPUs share its result.
   lapicw(TDCR, X1);
-  lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
-  lapicw(TICR, 10000000);
+  if(lapictick == 0)
+    lapiccalibrate();
+  lapicw(TIMER, T_IRQ0 + IRQ_TIMER);
+  lapicw(TICR, lapictick);
 
   // Disable logical interrupt lines.
   lapicw(LINT0, MASKED);
@@ -113,6 +148,37 @@ lapiceoi(void)
     lapicw(EOI, 0);
 }
 
+// Interrupt this CPU after ns nanoseconds, or never if ns
+// is 0.  Replaces any earlier request.
+void
+lapictimer(uint64_t ns)
+{
+  uint64_t max;
+  uint n;
+
+  if(!lapic)
+    return;
+  max = (uint64_t)(0xFFFFFFFF / lapictick) * (1000000000 / HZ);
+  if(ns > max)
+    ns = max;  // wake early; the caller rechecks
+  n = divl(ns * lapictick, 1000000000 / HZ);
+  if(ns > 0 && n == 0)
+    n = 1;
+  lapicw(TICR, n);
+}
+
+// Send interrupt vector to the CPU with the given APIC id.
+void
+lapicipi(int apicid, int vector)
+{
+  if(!lapic)
+    return;
+  lapicw(ICRHI, apicid<<24);
+  lapicw(ICRLO, FIXED | vector);
+  while(lapic[ICRLO] & DELIVS)
+    ;
+}
+
 // Spin for a given number of microseconds.
 // On real hardware would want to tune this dynamically.
 void
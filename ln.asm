@@ -0,0 +1,1225 @@
+
+_ln:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  if(argc != 3){
+   f:	83 39 03             	cmpl   $0x3,(%ecx)
+{
+  12:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc != 3){
+  15:	74 13                	je     2a <main+0x2a>
+    printf(2, "Usage: ln old new\n");
+  17:	52                   	push   %edx
+  18:	52                   	push   %edx
+  19:	68 98 07 00 00       	push   $0x798
+  1e:	6a 02                	push   $0x2
+  20:	e8 4b 04 00 00       	call   470 <printf>
+    exit();
+  25:	e8 7a 02 00 00       	call   2a4 <exit>
+  }
+  if(link(argv[1], argv[2]) < 0)
+  2a:	50                   	push   %eax
+  2b:	50                   	push   %eax
+  2c:	ff 73 08             	push   0x8(%ebx)
+  2f:	ff 73 04             	push   0x4(%ebx)
+  32:	e8 cd 02 00 00       	call   304 <link>
+  37:	83 c4 10             	add    $0x10,%esp
+  3a:	85 c0                	test   %eax,%eax
+  3c:	78 05                	js     43 <main+0x43>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  exit();
+  3e:	e8 61 02 00 00       	call   2a4 <exit>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  43:	ff 73 08             	push   0x8(%ebx)
+  46:	ff 73 04             	push   0x4(%ebx)
+  49:	68 ab 07 00 00       	push   $0x7ab
+  4e:	6a 02                	push   $0x2
+  50:	e8 1b 04 00 00       	call   470 <printf>
+  55:	83 c4 10             	add    $0x10,%esp
+  58:	eb e4                	jmp    3e <main+0x3e>
+  5a:	66 90                	xchg   %ax,%ax
+  5c:	66 90                	xchg   %ax,%ax
+  5e:	66 90                	xchg   %ax,%ax
+
+00000060 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  60:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  61:	31 c0                	xor    %eax,%eax
+{
+  63:	89 e5                	mov    %esp,%ebp
+  65:	53                   	push   %ebx
+  66:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  69:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  70:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  74:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  77:	83 c0 01             	add    $0x1,%eax
+  7a:	84 d2                	test   %dl,%dl
+  7c:	75 f2                	jne    70 <strcpy+0x10>
+    ;
+  return os;
+}
+  7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  81:	89 c8                	mov    %ecx,%eax
+  83:	c9                   	leave
+  84:	c3                   	ret
+  85:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000090 <strlen>:
+
+uint
+strlen(char *s)
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  96:	80 3a 00             	cmpb   $0x0,(%edx)
+  99:	74 15                	je     b0 <strlen+0x20>
+  9b:	31 c0                	xor    %eax,%eax
+  9d:	8d 76 00             	lea    0x0(%esi),%esi
+  a0:	83 c0 01             	add    $0x1,%eax
+  a3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  a7:	89 c1                	mov    %eax,%ecx
+  a9:	75 f5                	jne    a0 <strlen+0x10>
+    ;
+  return n;
+}
+  ab:	89 c8                	mov    %ecx,%eax
+  ad:	5d                   	pop    %ebp
+  ae:	c3                   	ret
+  af:	90                   	nop
+  for(n = 0; s[n]; n++)
+  b0:	31 c9                	xor    %ecx,%ecx
+}
+  b2:	5d                   	pop    %ebp
+  b3:	89 c8                	mov    %ecx,%eax
+  b5:	c3                   	ret
+  b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000000c0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	57                   	push   %edi
+  c4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+  cd:	89 d7                	mov    %edx,%edi
+  cf:	fc                   	cld
+  d0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  d5:	89 d0                	mov    %edx,%eax
+  d7:	c9                   	leave
+  d8:	c3                   	ret
+  d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000000e0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  e0:	55                   	push   %ebp
+  e1:	89 e5                	mov    %esp,%ebp
+  e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+  ea:	0f b6 10             	movzbl (%eax),%edx
+  ed:	84 d2                	test   %dl,%dl
+  ef:	75 12                	jne    103 <strchr+0x23>
+  f1:	eb 1d                	jmp    110 <strchr+0x30>
+  f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  f7:	90                   	nop
+  f8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+  fc:	83 c0 01             	add    $0x1,%eax
+  ff:	84 d2                	test   %dl,%dl
+ 101:	74 0d                	je     110 <strchr+0x30>
+    if(*s == c)
+ 103:	38 d1                	cmp    %dl,%cl
+ 105:	75 f1                	jne    f8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 107:	5d                   	pop    %ebp
+ 108:	c3                   	ret
+ 109:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 110:	31 c0                	xor    %eax,%eax
+}
+ 112:	5d                   	pop    %ebp
+ 113:	c3                   	ret
+ 114:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 11f:	90                   	nop
+
+00000120 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	57                   	push   %edi
+ 124:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 125:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 128:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 129:	31 db                	xor    %ebx,%ebx
+{
+ 12b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 12e:	eb 27                	jmp    157 <gets+0x37>
+    cc = read(0, &c, 1);
+ 130:	83 ec 04             	sub    $0x4,%esp
+ 133:	6a 01                	push   $0x1
+ 135:	56                   	push   %esi
+ 136:	6a 00                	push   $0x0
+ 138:	e8 7f 01 00 00       	call   2bc <read>
+    if(cc < 1)
+ 13d:	83 c4 10             	add    $0x10,%esp
+ 140:	85 c0                	test   %eax,%eax
+ 142:	7e 1d                	jle    161 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 144:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 148:	8b 55 08             	mov    0x8(%ebp),%edx
+ 14b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 14f:	3c 0a                	cmp    $0xa,%al
+ 151:	74 10                	je     163 <gets+0x43>
+ 153:	3c 0d                	cmp    $0xd,%al
+ 155:	74 0c                	je     163 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 157:	89 df                	mov    %ebx,%edi
+ 159:	83 c3 01             	add    $0x1,%ebx
+ 15c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 15f:	7c cf                	jl     130 <gets+0x10>
+ 161:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 163:	8b 45 08             	mov    0x8(%ebp),%eax
+ 166:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 16a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 16d:	5b                   	pop    %ebx
+ 16e:	5e                   	pop    %esi
+ 16f:	5f                   	pop    %edi
+ 170:	5d                   	pop    %ebp
+ 171:	c3                   	ret
+ 172:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000180 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	56                   	push   %esi
+ 184:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 185:	83 ec 08             	sub    $0x8,%esp
+ 188:	6a 00                	push   $0x0
+ 18a:	ff 75 08             	push   0x8(%ebp)
+ 18d:	e8 52 01 00 00       	call   2e4 <open>
+  if(fd < 0)
+ 192:	83 c4 10             	add    $0x10,%esp
+ 195:	85 c0                	test   %eax,%eax
+ 197:	78 27                	js     1c0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 199:	83 ec 08             	sub    $0x8,%esp
+ 19c:	ff 75 0c             	push   0xc(%ebp)
+ 19f:	89 c3                	mov    %eax,%ebx
+ 1a1:	50                   	push   %eax
+ 1a2:	e8 55 01 00 00       	call   2fc <fstat>
+  close(fd);
+ 1a7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 1aa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1ac:	e8 1b 01 00 00       	call   2cc <close>
+  return r;
+ 1b1:	83 c4 10             	add    $0x10,%esp
+}
+ 1b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1b7:	89 f0                	mov    %esi,%eax
+ 1b9:	5b                   	pop    %ebx
+ 1ba:	5e                   	pop    %esi
+ 1bb:	5d                   	pop    %ebp
+ 1bc:	c3                   	ret
+ 1bd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 1c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1c5:	eb ed                	jmp    1b4 <stat+0x34>
+ 1c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ce:	66 90                	xchg   %ax,%ax
+
+000001d0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	57                   	push   %edi
+ 1d4:	56                   	push   %esi
+ 1d5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 1de:	85 c0                	test   %eax,%eax
+ 1e0:	7e 13                	jle    1f5 <memmove+0x25>
+ 1e2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 1e4:	89 d7                	mov    %edx,%edi
+ 1e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 1f0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 1f1:	39 f8                	cmp    %edi,%eax
+ 1f3:	75 fb                	jne    1f0 <memmove+0x20>
+  return vdst;
+}
+ 1f5:	5e                   	pop    %esi
+ 1f6:	89 d0                	mov    %edx,%eax
+ 1f8:	5f                   	pop    %edi
+ 1f9:	5d                   	pop    %ebp
+ 1fa:	c3                   	ret
+ 1fb:	66 90                	xchg   %ax,%ax
+ 1fd:	66 90                	xchg   %ax,%ax
+ 1ff:	90                   	nop
+
+00000200 <strcmp>:
+#include "types.h"
+#include "util.h"
+
+int
+strcmp(const char *p, const char *q)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	53                   	push   %ebx
+ 204:	8b 55 08             	mov    0x8(%ebp),%edx
+ 207:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 20a:	0f b6 02             	movzbl (%edx),%eax
+ 20d:	84 c0                	test   %al,%al
+ 20f:	75 17                	jne    228 <strcmp+0x28>
+ 211:	eb 3a                	jmp    24d <strcmp+0x4d>
+ 213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 217:	90                   	nop
+ 218:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 21c:	83 c2 01             	add    $0x1,%edx
+ 21f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 222:	84 c0                	test   %al,%al
+ 224:	74 1a                	je     240 <strcmp+0x40>
+    p++, q++;
+ 226:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 228:	0f b6 19             	movzbl (%ecx),%ebx
+ 22b:	38 c3                	cmp    %al,%bl
+ 22d:	74 e9                	je     218 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 22f:	29 d8                	sub    %ebx,%eax
+}
+ 231:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 234:	c9                   	leave
+ 235:	c3                   	ret
+ 236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 240:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 244:	31 c0                	xor    %eax,%eax
+ 246:	29 d8                	sub    %ebx,%eax
+}
+ 248:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 24b:	c9                   	leave
+ 24c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 24d:	0f b6 19             	movzbl (%ecx),%ebx
+ 250:	31 c0                	xor    %eax,%eax
+ 252:	eb db                	jmp    22f <strcmp+0x2f>
+ 254:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 25f:	90                   	nop
+
+00000260 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	53                   	push   %ebx
+ 264:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 267:	0f be 02             	movsbl (%edx),%eax
+ 26a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 26d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 270:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 275:	77 1e                	ja     295 <atoi+0x35>
+ 277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 280:	83 c2 01             	add    $0x1,%edx
+ 283:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 286:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 28a:	0f be 02             	movsbl (%edx),%eax
+ 28d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 290:	80 fb 09             	cmp    $0x9,%bl
+ 293:	76 eb                	jbe    280 <atoi+0x20>
+  return n;
+ 295:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 298:	89 c8                	mov    %ecx,%eax
+ 29a:	c9                   	leave
+ 29b:	c3                   	ret
+
+0000029c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 29c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2a1:	cd 40                	int    $0x40
+ 2a3:	c3                   	ret
+
+000002a4 <exit>:
+SYSCALL(exit)
+ 2a4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2a9:	cd 40                	int    $0x40
+ 2ab:	c3                   	ret
+
+000002ac <wait>:
+SYSCALL(wait)
+ 2ac:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2b1:	cd 40                	int    $0x40
+ 2b3:	c3                   	ret
+
+000002b4 <pipe>:
+SYSCALL(pipe)
+ 2b4:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2b9:	cd 40                	int    $0x40
+ 2bb:	c3                   	ret
+
+000002bc <read>:
+SYSCALL(read)
+ 2bc:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2c1:	cd 40                	int    $0x40
+ 2c3:	c3                   	ret
+
+000002c4 <write>:
+SYSCALL(write)
+ 2c4:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2c9:	cd 40                	int    $0x40
+ 2cb:	c3                   	ret
+
+000002cc <close>:
+SYSCALL(close)
+ 2cc:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2d1:	cd 40                	int    $0x40
+ 2d3:	c3                   	ret
+
+000002d4 <kill>:
+SYSCALL(kill)
+ 2d4:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2d9:	cd 40                	int    $0x40
+ 2db:	c3                   	ret
+
+000002dc <exec>:
+SYSCALL(exec)
+ 2dc:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2e1:	cd 40                	int    $0x40
+ 2e3:	c3                   	ret
+
+000002e4 <open>:
+SYSCALL(open)
+ 2e4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2e9:	cd 40                	int    $0x40
+ 2eb:	c3                   	ret
+
+000002ec <mknod>:
+SYSCALL(mknod)
+ 2ec:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2f1:	cd 40                	int    $0x40
+ 2f3:	c3                   	ret
+
+000002f4 <unlink>:
+SYSCALL(unlink)
+ 2f4:	b8 12 00 00 00       	mov    $0x12,%eax
+ 2f9:	cd 40                	int    $0x40
+ 2fb:	c3                   	ret
+
+000002fc <fstat>:
+SYSCALL(fstat)
+ 2fc:	b8 08 00 00 00       	mov    $0x8,%eax
+ 301:	cd 40                	int    $0x40
+ 303:	c3                   	ret
+
+00000304 <link>:
+SYSCALL(link)
+ 304:	b8 13 00 00 00       	mov    $0x13,%eax
+ 309:	cd 40                	int    $0x40
+ 30b:	c3                   	ret
+
+0000030c <mkdir>:
+SYSCALL(mkdir)
+ 30c:	b8 14 00 00 00       	mov    $0x14,%eax
+ 311:	cd 40                	int    $0x40
+ 313:	c3                   	ret
+
+00000314 <chdir>:
+SYSCALL(chdir)
+ 314:	b8 09 00 00 00       	mov    $0x9,%eax
+ 319:	cd 40                	int    $0x40
+ 31b:	c3                   	ret
+
+0000031c <dup>:
+SYSCALL(dup)
+ 31c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 321:	cd 40                	int    $0x40
+ 323:	c3                   	ret
+
+00000324 <getpid>:
+SYSCALL(getpid)
+ 324:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 329:	cd 40                	int    $0x40
+ 32b:	c3                   	ret
+
+0000032c <sbrk>:
+SYSCALL(sbrk)
+ 32c:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 331:	cd 40                	int    $0x40
+ 333:	c3                   	ret
+
+00000334 <sleep>:
+SYSCALL(sleep)
+ 334:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 339:	cd 40                	int    $0x40
+ 33b:	c3                   	ret
+
+0000033c <uptime>:
+SYSCALL(uptime)
+ 33c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 341:	cd 40                	int    $0x40
+ 343:	c3                   	ret
+
+00000344 <arp>:
+SYSCALL(arp)
+ 344:	b8 16 00 00 00       	mov    $0x16,%eax
+ 349:	cd 40                	int    $0x40
+ 34b:	c3                   	ret
+
+0000034c <mmap>:
+SYSCALL(mmap)
+ 34c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 351:	cd 40                	int    $0x40
+ 353:	c3                   	ret
+
+00000354 <munmap>:
+SYSCALL(munmap)
+ 354:	b8 18 00 00 00       	mov    $0x18,%eax
+ 359:	cd 40                	int    $0x40
+ 35b:	c3                   	ret
+
+0000035c <msync>:
+SYSCALL(msync)
+ 35c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 361:	cd 40                	int    $0x40
+ 363:	c3                   	ret
+
+00000364 <shmcreate>:
+SYSCALL(shmcreate)
+ 364:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 369:	cd 40                	int    $0x40
+ 36b:	c3                   	ret
+
+0000036c <shmattach>:
+SYSCALL(shmattach)
+ 36c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 371:	cd 40                	int    $0x40
+ 373:	c3                   	ret
+
+00000374 <shmdetach>:
+SYSCALL(shmdetach)
+ 374:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 379:	cd 40                	int    $0x40
+ 37b:	c3                   	ret
+
+0000037c <futex_wait>:
+SYSCALL(futex_wait)
+ 37c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 381:	cd 40                	int    $0x40
+ 383:	c3                   	ret
+
+00000384 <futex_wake>:
+SYSCALL(futex_wake)
+ 384:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 389:	cd 40                	int    $0x40
+ 38b:	c3                   	ret
+
+0000038c <nice>:
+SYSCALL(nice)
+ 38c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 391:	cd 40                	int    $0x40
+ 393:	c3                   	ret
+
+00000394 <setpriority>:
+SYSCALL(setpriority)
+ 394:	b8 20 00 00 00       	mov    $0x20,%eax
+ 399:	cd 40                	int    $0x40
+ 39b:	c3                   	ret
+
+0000039c <cputime>:
+SYSCALL(cputime)
+ 39c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3a1:	cd 40                	int    $0x40
+ 3a3:	c3                   	ret
+
+000003a4 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 3a4:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3a9:	cd 40                	int    $0x40
+ 3ab:	c3                   	ret
+
+000003ac <clone>:
+SYSCALL(clone)
+ 3ac:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3b1:	cd 40                	int    $0x40
+ 3b3:	c3                   	ret
+
+000003b4 <join>:
+SYSCALL(join)
+ 3b4:	b8 24 00 00 00       	mov    $0x24,%eax
+ 3b9:	cd 40                	int    $0x40
+ 3bb:	c3                   	ret
+
+000003bc <lockstat>:
+SYSCALL(lockstat)
+ 3bc:	b8 25 00 00 00       	mov    $0x25,%eax
+ 3c1:	cd 40                	int    $0x40
+ 3c3:	c3                   	ret
+ 3c4:	66 90                	xchg   %ax,%ax
+ 3c6:	66 90                	xchg   %ax,%ax
+ 3c8:	66 90                	xchg   %ax,%ax
+ 3ca:	66 90                	xchg   %ax,%ax
+ 3cc:	66 90                	xchg   %ax,%ax
+ 3ce:	66 90                	xchg   %ax,%ax
+
+000003d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	57                   	push   %edi
+ 3d4:	56                   	push   %esi
+ 3d5:	53                   	push   %ebx
+ 3d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 3d8:	89 d1                	mov    %edx,%ecx
+{
+ 3da:	83 ec 3c             	sub    $0x3c,%esp
+ 3dd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 3e0:	85 d2                	test   %edx,%edx
+ 3e2:	0f 89 80 00 00 00    	jns    468 <printint+0x98>
+ 3e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 3ec:	74 7a                	je     468 <printint+0x98>
+    x = -xx;
+ 3ee:	f7 d9                	neg    %ecx
+    neg = 1;
+ 3f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 3f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 3f8:	31 f6                	xor    %esi,%esi
+ 3fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 400:	89 c8                	mov    %ecx,%eax
+ 402:	31 d2                	xor    %edx,%edx
+ 404:	89 f7                	mov    %esi,%edi
+ 406:	f7 f3                	div    %ebx
+ 408:	8d 76 01             	lea    0x1(%esi),%esi
+ 40b:	0f b6 92 20 08 00 00 	movzbl 0x820(%edx),%edx
+ 412:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 416:	89 ca                	mov    %ecx,%edx
+ 418:	89 c1                	mov    %eax,%ecx
+ 41a:	39 da                	cmp    %ebx,%edx
+ 41c:	73 e2                	jae    400 <printint+0x30>
+  if(neg)
+ 41e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 421:	85 c0                	test   %eax,%eax
+ 423:	74 07                	je     42c <printint+0x5c>
+    buf[i++] = '-';
+ 425:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 42a:	89 f7                	mov    %esi,%edi
+ 42c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 42f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 432:	01 df                	add    %ebx,%edi
+ 434:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 438:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 43b:	83 ec 04             	sub    $0x4,%esp
+ 43e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 441:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 444:	6a 01                	push   $0x1
+ 446:	50                   	push   %eax
+ 447:	56                   	push   %esi
+ 448:	e8 77 fe ff ff       	call   2c4 <write>
+  while(--i >= 0)
+ 44d:	89 f8                	mov    %edi,%eax
+ 44f:	83 c4 10             	add    $0x10,%esp
+ 452:	83 ef 01             	sub    $0x1,%edi
+ 455:	39 d8                	cmp    %ebx,%eax
+ 457:	75 df                	jne    438 <printint+0x68>
+}
+ 459:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 45c:	5b                   	pop    %ebx
+ 45d:	5e                   	pop    %esi
+ 45e:	5f                   	pop    %edi
+ 45f:	5d                   	pop    %ebp
+ 460:	c3                   	ret
+ 461:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 468:	31 c0                	xor    %eax,%eax
+ 46a:	eb 89                	jmp    3f5 <printint+0x25>
+ 46c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000470 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	57                   	push   %edi
+ 474:	56                   	push   %esi
+ 475:	53                   	push   %ebx
+ 476:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 479:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 47c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 47f:	0f b6 1e             	movzbl (%esi),%ebx
+ 482:	83 c6 01             	add    $0x1,%esi
+ 485:	84 db                	test   %bl,%bl
+ 487:	74 67                	je     4f0 <printf+0x80>
+ 489:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 48c:	31 d2                	xor    %edx,%edx
+ 48e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 491:	eb 34                	jmp    4c7 <printf+0x57>
+ 493:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 497:	90                   	nop
+ 498:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 49b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 4a0:	83 f8 25             	cmp    $0x25,%eax
+ 4a3:	74 18                	je     4bd <printf+0x4d>
+  write(fd, &c, 1);
+ 4a5:	83 ec 04             	sub    $0x4,%esp
+ 4a8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 4ab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 4ae:	6a 01                	push   $0x1
+ 4b0:	50                   	push   %eax
+ 4b1:	57                   	push   %edi
+ 4b2:	e8 0d fe ff ff       	call   2c4 <write>
+ 4b7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 4ba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 4bd:	0f b6 1e             	movzbl (%esi),%ebx
+ 4c0:	83 c6 01             	add    $0x1,%esi
+ 4c3:	84 db                	test   %bl,%bl
+ 4c5:	74 29                	je     4f0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 4c7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 4ca:	85 d2                	test   %edx,%edx
+ 4cc:	74 ca                	je     498 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 4ce:	83 fa 25             	cmp    $0x25,%edx
+ 4d1:	75 ea                	jne    4bd <printf+0x4d>
+      if(c == 'd'){
+ 4d3:	83 f8 25             	cmp    $0x25,%eax
+ 4d6:	0f 84 24 01 00 00    	je     600 <printf+0x190>
+ 4dc:	83 e8 63             	sub    $0x63,%eax
+ 4df:	83 f8 15             	cmp    $0x15,%eax
+ 4e2:	77 1c                	ja     500 <printf+0x90>
+ 4e4:	ff 24 85 c8 07 00 00 	jmp    *0x7c8(,%eax,4)
+ 4eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4ef:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 4f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4f3:	5b                   	pop    %ebx
+ 4f4:	5e                   	pop    %esi
+ 4f5:	5f                   	pop    %edi
+ 4f6:	5d                   	pop    %ebp
+ 4f7:	c3                   	ret
+ 4f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ff:	90                   	nop
+  write(fd, &c, 1);
+ 500:	83 ec 04             	sub    $0x4,%esp
+ 503:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 506:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 50a:	6a 01                	push   $0x1
+ 50c:	52                   	push   %edx
+ 50d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 510:	57                   	push   %edi
+ 511:	e8 ae fd ff ff       	call   2c4 <write>
+ 516:	83 c4 0c             	add    $0xc,%esp
+ 519:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 51c:	6a 01                	push   $0x1
+ 51e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 521:	52                   	push   %edx
+ 522:	57                   	push   %edi
+ 523:	e8 9c fd ff ff       	call   2c4 <write>
+        putc(fd, c);
+ 528:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 52b:	31 d2                	xor    %edx,%edx
+ 52d:	eb 8e                	jmp    4bd <printf+0x4d>
+ 52f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 530:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 533:	83 ec 0c             	sub    $0xc,%esp
+ 536:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 53b:	8b 13                	mov    (%ebx),%edx
+ 53d:	6a 00                	push   $0x0
+ 53f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 541:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 544:	e8 87 fe ff ff       	call   3d0 <printint>
+        ap++;
+ 549:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 54c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 54f:	31 d2                	xor    %edx,%edx
+ 551:	e9 67 ff ff ff       	jmp    4bd <printf+0x4d>
+ 556:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 560:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 563:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 565:	83 c0 04             	add    $0x4,%eax
+ 568:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 56b:	85 db                	test   %ebx,%ebx
+ 56d:	0f 84 9d 00 00 00    	je     610 <printf+0x1a0>
+        while(*s != 0){
+ 573:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 576:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 578:	84 c0                	test   %al,%al
+ 57a:	0f 84 3d ff ff ff    	je     4bd <printf+0x4d>
+ 580:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 583:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 586:	89 de                	mov    %ebx,%esi
+ 588:	89 d3                	mov    %edx,%ebx
+ 58a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 590:	83 ec 04             	sub    $0x4,%esp
+ 593:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 596:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 599:	6a 01                	push   $0x1
+ 59b:	53                   	push   %ebx
+ 59c:	57                   	push   %edi
+ 59d:	e8 22 fd ff ff       	call   2c4 <write>
+        while(*s != 0){
+ 5a2:	0f b6 06             	movzbl (%esi),%eax
+ 5a5:	83 c4 10             	add    $0x10,%esp
+ 5a8:	84 c0                	test   %al,%al
+ 5aa:	75 e4                	jne    590 <printf+0x120>
+      state = 0;
+ 5ac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 5af:	31 d2                	xor    %edx,%edx
+ 5b1:	e9 07 ff ff ff       	jmp    4bd <printf+0x4d>
+ 5b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5bd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 5c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5c3:	83 ec 0c             	sub    $0xc,%esp
+ 5c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5cb:	8b 13                	mov    (%ebx),%edx
+ 5cd:	6a 01                	push   $0x1
+ 5cf:	e9 6b ff ff ff       	jmp    53f <printf+0xcf>
+ 5d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 5d8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 5db:	83 ec 04             	sub    $0x4,%esp
+ 5de:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 5e1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 5e3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 5e6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5e9:	6a 01                	push   $0x1
+ 5eb:	52                   	push   %edx
+ 5ec:	57                   	push   %edi
+ 5ed:	e8 d2 fc ff ff       	call   2c4 <write>
+        ap++;
+ 5f2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 5f5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5f8:	31 d2                	xor    %edx,%edx
+ 5fa:	e9 be fe ff ff       	jmp    4bd <printf+0x4d>
+ 5ff:	90                   	nop
+  write(fd, &c, 1);
+ 600:	83 ec 04             	sub    $0x4,%esp
+ 603:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 606:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 609:	6a 01                	push   $0x1
+ 60b:	e9 11 ff ff ff       	jmp    521 <printf+0xb1>
+ 610:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 615:	bb bf 07 00 00       	mov    $0x7bf,%ebx
+ 61a:	e9 61 ff ff ff       	jmp    580 <printf+0x110>
+ 61f:	90                   	nop
+
+00000620 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 620:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 621:	a1 c0 0a 00 00       	mov    0xac0,%eax
+{
+ 626:	89 e5                	mov    %esp,%ebp
+ 628:	57                   	push   %edi
+ 629:	56                   	push   %esi
+ 62a:	53                   	push   %ebx
+ 62b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 62e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 631:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 638:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 63a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 63c:	39 ca                	cmp    %ecx,%edx
+ 63e:	73 30                	jae    670 <free+0x50>
+ 640:	39 c1                	cmp    %eax,%ecx
+ 642:	72 04                	jb     648 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 644:	39 c2                	cmp    %eax,%edx
+ 646:	72 f0                	jb     638 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 648:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 64b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 64e:	39 f8                	cmp    %edi,%eax
+ 650:	74 2e                	je     680 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 652:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 655:	8b 42 04             	mov    0x4(%edx),%eax
+ 658:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 65b:	39 f1                	cmp    %esi,%ecx
+ 65d:	74 38                	je     697 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 65f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 661:	5b                   	pop    %ebx
+  freep = p;
+ 662:	89 15 c0 0a 00 00    	mov    %edx,0xac0
+}
+ 668:	5e                   	pop    %esi
+ 669:	5f                   	pop    %edi
+ 66a:	5d                   	pop    %ebp
+ 66b:	c3                   	ret
+ 66c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 670:	39 c1                	cmp    %eax,%ecx
+ 672:	72 d0                	jb     644 <free+0x24>
+ 674:	eb c2                	jmp    638 <free+0x18>
+ 676:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 67d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 680:	03 70 04             	add    0x4(%eax),%esi
+ 683:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 686:	8b 02                	mov    (%edx),%eax
+ 688:	8b 00                	mov    (%eax),%eax
+ 68a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 68d:	8b 42 04             	mov    0x4(%edx),%eax
+ 690:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 693:	39 f1                	cmp    %esi,%ecx
+ 695:	75 c8                	jne    65f <free+0x3f>
+    p->s.size += bp->s.size;
+ 697:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 69a:	89 15 c0 0a 00 00    	mov    %edx,0xac0
+    p->s.size += bp->s.size;
+ 6a0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 6a3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 6a6:	89 0a                	mov    %ecx,(%edx)
+}
+ 6a8:	5b                   	pop    %ebx
+ 6a9:	5e                   	pop    %esi
+ 6aa:	5f                   	pop    %edi
+ 6ab:	5d                   	pop    %ebp
+ 6ac:	c3                   	ret
+ 6ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006b0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 6b0:	55                   	push   %ebp
+ 6b1:	89 e5                	mov    %esp,%ebp
+ 6b3:	57                   	push   %edi
+ 6b4:	56                   	push   %esi
+ 6b5:	53                   	push   %ebx
+ 6b6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 6bc:	8b 15 c0 0a 00 00    	mov    0xac0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6c2:	8d 78 07             	lea    0x7(%eax),%edi
+ 6c5:	c1 ef 03             	shr    $0x3,%edi
+ 6c8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 6cb:	85 d2                	test   %edx,%edx
+ 6cd:	0f 84 8d 00 00 00    	je     760 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6d3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6d5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6d8:	39 f9                	cmp    %edi,%ecx
+ 6da:	73 64                	jae    740 <malloc+0x90>
+  if(nu < 4096)
+ 6dc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 6e1:	39 df                	cmp    %ebx,%edi
+ 6e3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 6e6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 6ed:	eb 0a                	jmp    6f9 <malloc+0x49>
+ 6ef:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6f0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6f2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6f5:	39 f9                	cmp    %edi,%ecx
+ 6f7:	73 47                	jae    740 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 6f9:	89 c2                	mov    %eax,%edx
+ 6fb:	39 05 c0 0a 00 00    	cmp    %eax,0xac0
+ 701:	75 ed                	jne    6f0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 703:	83 ec 0c             	sub    $0xc,%esp
+ 706:	56                   	push   %esi
+ 707:	e8 20 fc ff ff       	call   32c <sbrk>
+  if(p == (char*)-1)
+ 70c:	83 c4 10             	add    $0x10,%esp
+ 70f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 712:	74 1c                	je     730 <malloc+0x80>
+  hp->s.size = nu;
+ 714:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 717:	83 ec 0c             	sub    $0xc,%esp
+ 71a:	83 c0 08             	add    $0x8,%eax
+ 71d:	50                   	push   %eax
+ 71e:	e8 fd fe ff ff       	call   620 <free>
+  return freep;
+ 723:	8b 15 c0 0a 00 00    	mov    0xac0,%edx
+      if((p = morecore(nunits)) == 0)
+ 729:	83 c4 10             	add    $0x10,%esp
+ 72c:	85 d2                	test   %edx,%edx
+ 72e:	75 c0                	jne    6f0 <malloc+0x40>
+        return 0;
+  }
+}
+ 730:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 733:	31 c0                	xor    %eax,%eax
+}
+ 735:	5b                   	pop    %ebx
+ 736:	5e                   	pop    %esi
+ 737:	5f                   	pop    %edi
+ 738:	5d                   	pop    %ebp
+ 739:	c3                   	ret
+ 73a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 740:	39 cf                	cmp    %ecx,%edi
+ 742:	74 4c                	je     790 <malloc+0xe0>
+        p->s.size -= nunits;
+ 744:	29 f9                	sub    %edi,%ecx
+ 746:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 749:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 74c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 74f:	89 15 c0 0a 00 00    	mov    %edx,0xac0
+}
+ 755:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 758:	83 c0 08             	add    $0x8,%eax
+}
+ 75b:	5b                   	pop    %ebx
+ 75c:	5e                   	pop    %esi
+ 75d:	5f                   	pop    %edi
+ 75e:	5d                   	pop    %ebp
+ 75f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 760:	c7 05 c0 0a 00 00 c4 	movl   $0xac4,0xac0
+ 767:	0a 00 00 
+    base.s.size = 0;
+ 76a:	b8 c4 0a 00 00       	mov    $0xac4,%eax
+    base.s.ptr = freep = prevp = &base;
+ 76f:	c7 05 c4 0a 00 00 c4 	movl   $0xac4,0xac4
+ 776:	0a 00 00 
+    base.s.size = 0;
+ 779:	c7 05 c8 0a 00 00 00 	movl   $0x0,0xac8
+ 780:	00 00 00 
+    if(p->s.size >= nunits){
+ 783:	e9 54 ff ff ff       	jmp    6dc <malloc+0x2c>
+ 788:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 78f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 790:	8b 08                	mov    (%eax),%ecx
+ 792:	89 0a                	mov    %ecx,(%edx)
+ 794:	eb b9                	jmp    74f <malloc+0x9f>
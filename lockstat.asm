@@ -0,0 +1,1263 @@
+
+_lockstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+struct lockstat ls[NLOCKSTAT];
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 10             	sub    $0x10,%esp
+  int i, n;
+
+  if((n = lockstat(ls, NLOCKSTAT)) < 0){
+  14:	6a 20                	push   $0x20
+  16:	68 40 0b 00 00       	push   $0xb40
+  1b:	e8 dc 03 00 00       	call   3fc <lockstat>
+  20:	83 c4 10             	add    $0x10,%esp
+  23:	85 c0                	test   %eax,%eax
+  25:	78 5f                	js     86 <main+0x86>
+    printf(2, "lockstat: failed\n");
+    exit();
+  }
+  printf(1, "name acquires contended spin maxhold\n");
+  27:	53                   	push   %ebx
+  28:	89 c7                	mov    %eax,%edi
+  2a:	53                   	push   %ebx
+  2b:	68 fc 07 00 00       	push   $0x7fc
+  30:	6a 01                	push   $0x1
+  32:	e8 79 04 00 00       	call   4b0 <printf>
+  for(i = 0; i < n; i++)
+  37:	83 c4 10             	add    $0x10,%esp
+  3a:	85 ff                	test   %edi,%edi
+  3c:	74 43                	je     81 <main+0x81>
+  3e:	bb 40 0b 00 00       	mov    $0xb40,%ebx
+  43:	31 f6                	xor    %esi,%esi
+  45:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "%s %d %d %d %d\n", ls[i].name, ls[i].acquires,
+           ls[i].contended, (uint)(ls[i].spin >> 10),
+           (uint)(ls[i].maxhold >> 10));
+  48:	8b 53 24             	mov    0x24(%ebx),%edx
+  4b:	8b 43 20             	mov    0x20(%ebx),%eax
+    printf(1, "%s %d %d %d %d\n", ls[i].name, ls[i].acquires,
+  4e:	83 ec 04             	sub    $0x4,%esp
+  for(i = 0; i < n; i++)
+  51:	83 c6 01             	add    $0x1,%esi
+           (uint)(ls[i].maxhold >> 10));
+  54:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+           ls[i].contended, (uint)(ls[i].spin >> 10),
+  58:	8b 53 1c             	mov    0x1c(%ebx),%edx
+    printf(1, "%s %d %d %d %d\n", ls[i].name, ls[i].acquires,
+  5b:	50                   	push   %eax
+           ls[i].contended, (uint)(ls[i].spin >> 10),
+  5c:	8b 43 18             	mov    0x18(%ebx),%eax
+  5f:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+    printf(1, "%s %d %d %d %d\n", ls[i].name, ls[i].acquires,
+  63:	50                   	push   %eax
+  64:	ff 73 14             	push   0x14(%ebx)
+  67:	ff 73 10             	push   0x10(%ebx)
+  6a:	53                   	push   %ebx
+  for(i = 0; i < n; i++)
+  6b:	83 c3 28             	add    $0x28,%ebx
+    printf(1, "%s %d %d %d %d\n", ls[i].name, ls[i].acquires,
+  6e:	68 ea 07 00 00       	push   $0x7ea
+  73:	6a 01                	push   $0x1
+  75:	e8 36 04 00 00       	call   4b0 <printf>
+  for(i = 0; i < n; i++)
+  7a:	83 c4 20             	add    $0x20,%esp
+  7d:	39 f7                	cmp    %esi,%edi
+  7f:	75 c7                	jne    48 <main+0x48>
+  exit();
+  81:	e8 5e 02 00 00       	call   2e4 <exit>
+    printf(2, "lockstat: failed\n");
+  86:	56                   	push   %esi
+  87:	56                   	push   %esi
+  88:	68 d8 07 00 00       	push   $0x7d8
+  8d:	6a 02                	push   $0x2
+  8f:	e8 1c 04 00 00       	call   4b0 <printf>
+    exit();
+  94:	e8 4b 02 00 00       	call   2e4 <exit>
+  99:	66 90                	xchg   %ax,%ax
+  9b:	66 90                	xchg   %ax,%ax
+  9d:	66 90                	xchg   %ax,%ax
+  9f:	90                   	nop
+
+000000a0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  a1:	31 c0                	xor    %eax,%eax
+{
+  a3:	89 e5                	mov    %esp,%ebp
+  a5:	53                   	push   %ebx
+  a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  b7:	83 c0 01             	add    $0x1,%eax
+  ba:	84 d2                	test   %dl,%dl
+  bc:	75 f2                	jne    b0 <strcpy+0x10>
+    ;
+  return os;
+}
+  be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  c1:	89 c8                	mov    %ecx,%eax
+  c3:	c9                   	leave
+  c4:	c3                   	ret
+  c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000d0 <strlen>:
+
+uint
+strlen(char *s)
+{
+  d0:	55                   	push   %ebp
+  d1:	89 e5                	mov    %esp,%ebp
+  d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  d6:	80 3a 00             	cmpb   $0x0,(%edx)
+  d9:	74 15                	je     f0 <strlen+0x20>
+  db:	31 c0                	xor    %eax,%eax
+  dd:	8d 76 00             	lea    0x0(%esi),%esi
+  e0:	83 c0 01             	add    $0x1,%eax
+  e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  e7:	89 c1                	mov    %eax,%ecx
+  e9:	75 f5                	jne    e0 <strlen+0x10>
+    ;
+  return n;
+}
+  eb:	89 c8                	mov    %ecx,%eax
+  ed:	5d                   	pop    %ebp
+  ee:	c3                   	ret
+  ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+  f0:	31 c9                	xor    %ecx,%ecx
+}
+  f2:	5d                   	pop    %ebp
+  f3:	89 c8                	mov    %ecx,%eax
+  f5:	c3                   	ret
+  f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000100 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	57                   	push   %edi
+ 104:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 107:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 10a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 10d:	89 d7                	mov    %edx,%edi
+ 10f:	fc                   	cld
+ 110:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 112:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 115:	89 d0                	mov    %edx,%eax
+ 117:	c9                   	leave
+ 118:	c3                   	ret
+ 119:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000120 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	8b 45 08             	mov    0x8(%ebp),%eax
+ 126:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 12a:	0f b6 10             	movzbl (%eax),%edx
+ 12d:	84 d2                	test   %dl,%dl
+ 12f:	75 12                	jne    143 <strchr+0x23>
+ 131:	eb 1d                	jmp    150 <strchr+0x30>
+ 133:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 137:	90                   	nop
+ 138:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 13c:	83 c0 01             	add    $0x1,%eax
+ 13f:	84 d2                	test   %dl,%dl
+ 141:	74 0d                	je     150 <strchr+0x30>
+    if(*s == c)
+ 143:	38 d1                	cmp    %dl,%cl
+ 145:	75 f1                	jne    138 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 147:	5d                   	pop    %ebp
+ 148:	c3                   	ret
+ 149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 150:	31 c0                	xor    %eax,%eax
+}
+ 152:	5d                   	pop    %ebp
+ 153:	c3                   	ret
+ 154:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 15f:	90                   	nop
+
+00000160 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	57                   	push   %edi
+ 164:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 165:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 168:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 169:	31 db                	xor    %ebx,%ebx
+{
+ 16b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 16e:	eb 27                	jmp    197 <gets+0x37>
+    cc = read(0, &c, 1);
+ 170:	83 ec 04             	sub    $0x4,%esp
+ 173:	6a 01                	push   $0x1
+ 175:	56                   	push   %esi
+ 176:	6a 00                	push   $0x0
+ 178:	e8 7f 01 00 00       	call   2fc <read>
+    if(cc < 1)
+ 17d:	83 c4 10             	add    $0x10,%esp
+ 180:	85 c0                	test   %eax,%eax
+ 182:	7e 1d                	jle    1a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 184:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 188:	8b 55 08             	mov    0x8(%ebp),%edx
+ 18b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 18f:	3c 0a                	cmp    $0xa,%al
+ 191:	74 10                	je     1a3 <gets+0x43>
+ 193:	3c 0d                	cmp    $0xd,%al
+ 195:	74 0c                	je     1a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 197:	89 df                	mov    %ebx,%edi
+ 199:	83 c3 01             	add    $0x1,%ebx
+ 19c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 19f:	7c cf                	jl     170 <gets+0x10>
+ 1a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1ad:	5b                   	pop    %ebx
+ 1ae:	5e                   	pop    %esi
+ 1af:	5f                   	pop    %edi
+ 1b0:	5d                   	pop    %ebp
+ 1b1:	c3                   	ret
+ 1b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001c0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	56                   	push   %esi
+ 1c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1c5:	83 ec 08             	sub    $0x8,%esp
+ 1c8:	6a 00                	push   $0x0
+ 1ca:	ff 75 08             	push   0x8(%ebp)
+ 1cd:	e8 52 01 00 00       	call   324 <open>
+  if(fd < 0)
+ 1d2:	83 c4 10             	add    $0x10,%esp
+ 1d5:	85 c0                	test   %eax,%eax
+ 1d7:	78 27                	js     200 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1d9:	83 ec 08             	sub    $0x8,%esp
+ 1dc:	ff 75 0c             	push   0xc(%ebp)
+ 1df:	89 c3                	mov    %eax,%ebx
+ 1e1:	50                   	push   %eax
+ 1e2:	e8 55 01 00 00       	call   33c <fstat>
+  close(fd);
+ 1e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 1ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1ec:	e8 1b 01 00 00       	call   30c <close>
+  return r;
+ 1f1:	83 c4 10             	add    $0x10,%esp
+}
+ 1f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1f7:	89 f0                	mov    %esi,%eax
+ 1f9:	5b                   	pop    %ebx
+ 1fa:	5e                   	pop    %esi
+ 1fb:	5d                   	pop    %ebp
+ 1fc:	c3                   	ret
+ 1fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 200:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 205:	eb ed                	jmp    1f4 <stat+0x34>
+ 207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20e:	66 90                	xchg   %ax,%ax
+
+00000210 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	57                   	push   %edi
+ 214:	56                   	push   %esi
+ 215:	8b 45 10             	mov    0x10(%ebp),%eax
+ 218:	8b 55 08             	mov    0x8(%ebp),%edx
+ 21b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 21e:	85 c0                	test   %eax,%eax
+ 220:	7e 13                	jle    235 <memmove+0x25>
+ 222:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 224:	89 d7                	mov    %edx,%edi
+ 226:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 230:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 231:	39 f8                	cmp    %edi,%eax
+ 233:	75 fb                	jne    230 <memmove+0x20>
+  return vdst;
+}
+ 235:	5e                   	pop    %esi
+ 236:	89 d0                	mov    %edx,%eax
+ 238:	5f                   	pop    %edi
+ 239:	5d                   	pop    %ebp
+ 23a:	c3                   	ret
+ 23b:	66 90                	xchg   %ax,%ax
+ 23d:	66 90                	xchg   %ax,%ax
+ 23f:	90                   	nop
+
+00000240 <strcmp>:
+#include "types.h"
+#include "util.h"
+
+int
+strcmp(const char *p, const char *q)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	53                   	push   %ebx
+ 244:	8b 55 08             	mov    0x8(%ebp),%edx
+ 247:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 24a:	0f b6 02             	movzbl (%edx),%eax
+ 24d:	84 c0                	test   %al,%al
+ 24f:	75 17                	jne    268 <strcmp+0x28>
+ 251:	eb 3a                	jmp    28d <strcmp+0x4d>
+ 253:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 257:	90                   	nop
+ 258:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 25c:	83 c2 01             	add    $0x1,%edx
+ 25f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 262:	84 c0                	test   %al,%al
+ 264:	74 1a                	je     280 <strcmp+0x40>
+    p++, q++;
+ 266:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 268:	0f b6 19             	movzbl (%ecx),%ebx
+ 26b:	38 c3                	cmp    %al,%bl
+ 26d:	74 e9                	je     258 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 26f:	29 d8                	sub    %ebx,%eax
+}
+ 271:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 274:	c9                   	leave
+ 275:	c3                   	ret
+ 276:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 280:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 284:	31 c0                	xor    %eax,%eax
+ 286:	29 d8                	sub    %ebx,%eax
+}
+ 288:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 28b:	c9                   	leave
+ 28c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 28d:	0f b6 19             	movzbl (%ecx),%ebx
+ 290:	31 c0                	xor    %eax,%eax
+ 292:	eb db                	jmp    26f <strcmp+0x2f>
+ 294:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 29f:	90                   	nop
+
+000002a0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	53                   	push   %ebx
+ 2a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2a7:	0f be 02             	movsbl (%edx),%eax
+ 2aa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2ad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2b5:	77 1e                	ja     2d5 <atoi+0x35>
+ 2b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2be:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 2c0:	83 c2 01             	add    $0x1,%edx
+ 2c3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 2c6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 2ca:	0f be 02             	movsbl (%edx),%eax
+ 2cd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2d0:	80 fb 09             	cmp    $0x9,%bl
+ 2d3:	76 eb                	jbe    2c0 <atoi+0x20>
+  return n;
+ 2d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2d8:	89 c8                	mov    %ecx,%eax
+ 2da:	c9                   	leave
+ 2db:	c3                   	ret
+
+000002dc <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2dc:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2e1:	cd 40                	int    $0x40
+ 2e3:	c3                   	ret
+
+000002e4 <exit>:
+SYSCALL(exit)
+ 2e4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2e9:	cd 40                	int    $0x40
+ 2eb:	c3                   	ret
+
+000002ec <wait>:
+SYSCALL(wait)
+ 2ec:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2f1:	cd 40                	int    $0x40
+ 2f3:	c3                   	ret
+
+000002f4 <pipe>:
+SYSCALL(pipe)
+ 2f4:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2f9:	cd 40                	int    $0x40
+ 2fb:	c3                   	ret
+
+000002fc <read>:
+SYSCALL(read)
+ 2fc:	b8 05 00 00 00       	mov    $0x5,%eax
+ 301:	cd 40                	int    $0x40
+ 303:	c3                   	ret
+
+00000304 <write>:
+SYSCALL(write)
+ 304:	b8 10 00 00 00       	mov    $0x10,%eax
+ 309:	cd 40                	int    $0x40
+ 30b:	c3                   	ret
+
+0000030c <close>:
+SYSCALL(close)
+ 30c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 311:	cd 40                	int    $0x40
+ 313:	c3                   	ret
+
+00000314 <kill>:
+SYSCALL(kill)
+ 314:	b8 06 00 00 00       	mov    $0x6,%eax
+ 319:	cd 40                	int    $0x40
+ 31b:	c3                   	ret
+
+0000031c <exec>:
+SYSCALL(exec)
+ 31c:	b8 07 00 00 00       	mov    $0x7,%eax
+ 321:	cd 40                	int    $0x40
+ 323:	c3                   	ret
+
+00000324 <open>:
+SYSCALL(open)
+ 324:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 329:	cd 40                	int    $0x40
+ 32b:	c3                   	ret
+
+0000032c <mknod>:
+SYSCALL(mknod)
+ 32c:	b8 11 00 00 00       	mov    $0x11,%eax
+ 331:	cd 40                	int    $0x40
+ 333:	c3                   	ret
+
+00000334 <unlink>:
+SYSCALL(unlink)
+ 334:	b8 12 00 00 00       	mov    $0x12,%eax
+ 339:	cd 40                	int    $0x40
+ 33b:	c3                   	ret
+
+0000033c <fstat>:
+SYSCALL(fstat)
+ 33c:	b8 08 00 00 00       	mov    $0x8,%eax
+ 341:	cd 40                	int    $0x40
+ 343:	c3                   	ret
+
+00000344 <link>:
+SYSCALL(link)
+ 344:	b8 13 00 00 00       	mov    $0x13,%eax
+ 349:	cd 40                	int    $0x40
+ 34b:	c3                   	ret
+
+0000034c <mkdir>:
+SYSCALL(mkdir)
+ 34c:	b8 14 00 00 00       	mov    $0x14,%eax
+ 351:	cd 40                	int    $0x40
+ 353:	c3                   	ret
+
+00000354 <chdir>:
+SYSCALL(chdir)
+ 354:	b8 09 00 00 00       	mov    $0x9,%eax
+ 359:	cd 40                	int    $0x40
+ 35b:	c3                   	ret
+
+0000035c <dup>:
+SYSCALL(dup)
+ 35c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 361:	cd 40                	int    $0x40
+ 363:	c3                   	ret
+
+00000364 <getpid>:
+SYSCALL(getpid)
+ 364:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 369:	cd 40                	int    $0x40
+ 36b:	c3                   	ret
+
+0000036c <sbrk>:
+SYSCALL(sbrk)
+ 36c:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 371:	cd 40                	int    $0x40
+ 373:	c3                   	ret
+
+00000374 <sleep>:
+SYSCALL(sleep)
+ 374:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 379:	cd 40                	int    $0x40
+ 37b:	c3                   	ret
+
+0000037c <uptime>:
+SYSCALL(uptime)
+ 37c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 381:	cd 40                	int    $0x40
+ 383:	c3                   	ret
+
+00000384 <arp>:
+SYSCALL(arp)
+ 384:	b8 16 00 00 00       	mov    $0x16,%eax
+ 389:	cd 40                	int    $0x40
+ 38b:	c3                   	ret
+
+0000038c <mmap>:
+SYSCALL(mmap)
+ 38c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 391:	cd 40                	int    $0x40
+ 393:	c3                   	ret
+
+00000394 <munmap>:
+SYSCALL(munmap)
+ 394:	b8 18 00 00 00       	mov    $0x18,%eax
+ 399:	cd 40                	int    $0x40
+ 39b:	c3                   	ret
+
+0000039c <msync>:
+SYSCALL(msync)
+ 39c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3a1:	cd 40                	int    $0x40
+ 3a3:	c3                   	ret
+
+000003a4 <shmcreate>:
+SYSCALL(shmcreate)
+ 3a4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3a9:	cd 40                	int    $0x40
+ 3ab:	c3                   	ret
+
+000003ac <shmattach>:
+SYSCALL(shmattach)
+ 3ac:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3b1:	cd 40                	int    $0x40
+ 3b3:	c3                   	ret
+
+000003b4 <shmdetach>:
+SYSCALL(shmdetach)
+ 3b4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3b9:	cd 40                	int    $0x40
+ 3bb:	c3                   	ret
+
+000003bc <futex_wait>:
+SYSCALL(futex_wait)
+ 3bc:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3c1:	cd 40                	int    $0x40
+ 3c3:	c3                   	ret
+
+000003c4 <futex_wake>:
+SYSCALL(futex_wake)
+ 3c4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3c9:	cd 40                	int    $0x40
+ 3cb:	c3                   	ret
+
+000003cc <nice>:
+SYSCALL(nice)
+ 3cc:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3d1:	cd 40                	int    $0x40
+ 3d3:	c3                   	ret
+
+000003d4 <setpriority>:
+SYSCALL(setpriority)
+ 3d4:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3d9:	cd 40                	int    $0x40
+ 3db:	c3                   	ret
+
+000003dc <cputime>:
+SYSCALL(cputime)
+ 3dc:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3e1:	cd 40                	int    $0x40
+ 3e3:	c3                   	ret
+
+000003e4 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 3e4:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3e9:	cd 40                	int    $0x40
+ 3eb:	c3                   	ret
+
+000003ec <clone>:
+SYSCALL(clone)
+ 3ec:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3f1:	cd 40                	int    $0x40
+ 3f3:	c3                   	ret
+
+000003f4 <join>:
+SYSCALL(join)
+ 3f4:	b8 24 00 00 00       	mov    $0x24,%eax
+ 3f9:	cd 40                	int    $0x40
+ 3fb:	c3                   	ret
+
+000003fc <lockstat>:
+SYSCALL(lockstat)
+ 3fc:	b8 25 00 00 00       	mov    $0x25,%eax
+ 401:	cd 40                	int    $0x40
+ 403:	c3                   	ret
+ 404:	66 90                	xchg   %ax,%ax
+ 406:	66 90                	xchg   %ax,%ax
+ 408:	66 90                	xchg   %ax,%ax
+ 40a:	66 90                	xchg   %ax,%ax
+ 40c:	66 90                	xchg   %ax,%ax
+ 40e:	66 90                	xchg   %ax,%ax
+
+00000410 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	57                   	push   %edi
+ 414:	56                   	push   %esi
+ 415:	53                   	push   %ebx
+ 416:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 418:	89 d1                	mov    %edx,%ecx
+{
+ 41a:	83 ec 3c             	sub    $0x3c,%esp
+ 41d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 420:	85 d2                	test   %edx,%edx
+ 422:	0f 89 80 00 00 00    	jns    4a8 <printint+0x98>
+ 428:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 42c:	74 7a                	je     4a8 <printint+0x98>
+    x = -xx;
+ 42e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 430:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 435:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 438:	31 f6                	xor    %esi,%esi
+ 43a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 440:	89 c8                	mov    %ecx,%eax
+ 442:	31 d2                	xor    %edx,%edx
+ 444:	89 f7                	mov    %esi,%edi
+ 446:	f7 f3                	div    %ebx
+ 448:	8d 76 01             	lea    0x1(%esi),%esi
+ 44b:	0f b6 92 84 08 00 00 	movzbl 0x884(%edx),%edx
+ 452:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 456:	89 ca                	mov    %ecx,%edx
+ 458:	89 c1                	mov    %eax,%ecx
+ 45a:	39 da                	cmp    %ebx,%edx
+ 45c:	73 e2                	jae    440 <printint+0x30>
+  if(neg)
+ 45e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 461:	85 c0                	test   %eax,%eax
+ 463:	74 07                	je     46c <printint+0x5c>
+    buf[i++] = '-';
+ 465:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 46a:	89 f7                	mov    %esi,%edi
+ 46c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 46f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 472:	01 df                	add    %ebx,%edi
+ 474:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 478:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 47b:	83 ec 04             	sub    $0x4,%esp
+ 47e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 481:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 484:	6a 01                	push   $0x1
+ 486:	50                   	push   %eax
+ 487:	56                   	push   %esi
+ 488:	e8 77 fe ff ff       	call   304 <write>
+  while(--i >= 0)
+ 48d:	89 f8                	mov    %edi,%eax
+ 48f:	83 c4 10             	add    $0x10,%esp
+ 492:	83 ef 01             	sub    $0x1,%edi
+ 495:	39 d8                	cmp    %ebx,%eax
+ 497:	75 df                	jne    478 <printint+0x68>
+}
+ 499:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 49c:	5b                   	pop    %ebx
+ 49d:	5e                   	pop    %esi
+ 49e:	5f                   	pop    %edi
+ 49f:	5d                   	pop    %ebp
+ 4a0:	c3                   	ret
+ 4a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 4a8:	31 c0                	xor    %eax,%eax
+ 4aa:	eb 89                	jmp    435 <printint+0x25>
+ 4ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	57                   	push   %edi
+ 4b4:	56                   	push   %esi
+ 4b5:	53                   	push   %ebx
+ 4b6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 4b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 4bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 4bf:	0f b6 1e             	movzbl (%esi),%ebx
+ 4c2:	83 c6 01             	add    $0x1,%esi
+ 4c5:	84 db                	test   %bl,%bl
+ 4c7:	74 67                	je     530 <printf+0x80>
+ 4c9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 4cc:	31 d2                	xor    %edx,%edx
+ 4ce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 4d1:	eb 34                	jmp    507 <printf+0x57>
+ 4d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4d7:	90                   	nop
+ 4d8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 4db:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 4e0:	83 f8 25             	cmp    $0x25,%eax
+ 4e3:	74 18                	je     4fd <printf+0x4d>
+  write(fd, &c, 1);
+ 4e5:	83 ec 04             	sub    $0x4,%esp
+ 4e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 4eb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 4ee:	6a 01                	push   $0x1
+ 4f0:	50                   	push   %eax
+ 4f1:	57                   	push   %edi
+ 4f2:	e8 0d fe ff ff       	call   304 <write>
+ 4f7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 4fa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 4fd:	0f b6 1e             	movzbl (%esi),%ebx
+ 500:	83 c6 01             	add    $0x1,%esi
+ 503:	84 db                	test   %bl,%bl
+ 505:	74 29                	je     530 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 507:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 50a:	85 d2                	test   %edx,%edx
+ 50c:	74 ca                	je     4d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 50e:	83 fa 25             	cmp    $0x25,%edx
+ 511:	75 ea                	jne    4fd <printf+0x4d>
+      if(c == 'd'){
+ 513:	83 f8 25             	cmp    $0x25,%eax
+ 516:	0f 84 24 01 00 00    	je     640 <printf+0x190>
+ 51c:	83 e8 63             	sub    $0x63,%eax
+ 51f:	83 f8 15             	cmp    $0x15,%eax
+ 522:	77 1c                	ja     540 <printf+0x90>
+ 524:	ff 24 85 2c 08 00 00 	jmp    *0x82c(,%eax,4)
+ 52b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 52f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 530:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 533:	5b                   	pop    %ebx
+ 534:	5e                   	pop    %esi
+ 535:	5f                   	pop    %edi
+ 536:	5d                   	pop    %ebp
+ 537:	c3                   	ret
+ 538:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53f:	90                   	nop
+  write(fd, &c, 1);
+ 540:	83 ec 04             	sub    $0x4,%esp
+ 543:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 546:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 54a:	6a 01                	push   $0x1
+ 54c:	52                   	push   %edx
+ 54d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 550:	57                   	push   %edi
+ 551:	e8 ae fd ff ff       	call   304 <write>
+ 556:	83 c4 0c             	add    $0xc,%esp
+ 559:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 55c:	6a 01                	push   $0x1
+ 55e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 561:	52                   	push   %edx
+ 562:	57                   	push   %edi
+ 563:	e8 9c fd ff ff       	call   304 <write>
+        putc(fd, c);
+ 568:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 56b:	31 d2                	xor    %edx,%edx
+ 56d:	eb 8e                	jmp    4fd <printf+0x4d>
+ 56f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 570:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 573:	83 ec 0c             	sub    $0xc,%esp
+ 576:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 57b:	8b 13                	mov    (%ebx),%edx
+ 57d:	6a 00                	push   $0x0
+ 57f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 581:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 584:	e8 87 fe ff ff       	call   410 <printint>
+        ap++;
+ 589:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 58c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 58f:	31 d2                	xor    %edx,%edx
+ 591:	e9 67 ff ff ff       	jmp    4fd <printf+0x4d>
+ 596:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 5a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 5a3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 5a5:	83 c0 04             	add    $0x4,%eax
+ 5a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 5ab:	85 db                	test   %ebx,%ebx
+ 5ad:	0f 84 9d 00 00 00    	je     650 <printf+0x1a0>
+        while(*s != 0){
+ 5b3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 5b6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 5b8:	84 c0                	test   %al,%al
+ 5ba:	0f 84 3d ff ff ff    	je     4fd <printf+0x4d>
+ 5c0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5c3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 5c6:	89 de                	mov    %ebx,%esi
+ 5c8:	89 d3                	mov    %edx,%ebx
+ 5ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 5d0:	83 ec 04             	sub    $0x4,%esp
+ 5d3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 5d6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 5d9:	6a 01                	push   $0x1
+ 5db:	53                   	push   %ebx
+ 5dc:	57                   	push   %edi
+ 5dd:	e8 22 fd ff ff       	call   304 <write>
+        while(*s != 0){
+ 5e2:	0f b6 06             	movzbl (%esi),%eax
+ 5e5:	83 c4 10             	add    $0x10,%esp
+ 5e8:	84 c0                	test   %al,%al
+ 5ea:	75 e4                	jne    5d0 <printf+0x120>
+      state = 0;
+ 5ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 5ef:	31 d2                	xor    %edx,%edx
+ 5f1:	e9 07 ff ff ff       	jmp    4fd <printf+0x4d>
+ 5f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5fd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 600:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 603:	83 ec 0c             	sub    $0xc,%esp
+ 606:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 60b:	8b 13                	mov    (%ebx),%edx
+ 60d:	6a 01                	push   $0x1
+ 60f:	e9 6b ff ff ff       	jmp    57f <printf+0xcf>
+ 614:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 618:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 61b:	83 ec 04             	sub    $0x4,%esp
+ 61e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 621:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 623:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 626:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 629:	6a 01                	push   $0x1
+ 62b:	52                   	push   %edx
+ 62c:	57                   	push   %edi
+ 62d:	e8 d2 fc ff ff       	call   304 <write>
+        ap++;
+ 632:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 635:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 638:	31 d2                	xor    %edx,%edx
+ 63a:	e9 be fe ff ff       	jmp    4fd <printf+0x4d>
+ 63f:	90                   	nop
+  write(fd, &c, 1);
+ 640:	83 ec 04             	sub    $0x4,%esp
+ 643:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 646:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 649:	6a 01                	push   $0x1
+ 64b:	e9 11 ff ff ff       	jmp    561 <printf+0xb1>
+ 650:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 655:	bb 22 08 00 00       	mov    $0x822,%ebx
+ 65a:	e9 61 ff ff ff       	jmp    5c0 <printf+0x110>
+ 65f:	90                   	nop
+
+00000660 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 660:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 661:	a1 40 10 00 00       	mov    0x1040,%eax
+{
+ 666:	89 e5                	mov    %esp,%ebp
+ 668:	57                   	push   %edi
+ 669:	56                   	push   %esi
+ 66a:	53                   	push   %ebx
+ 66b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 66e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 671:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 678:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 67a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 67c:	39 ca                	cmp    %ecx,%edx
+ 67e:	73 30                	jae    6b0 <free+0x50>
+ 680:	39 c1                	cmp    %eax,%ecx
+ 682:	72 04                	jb     688 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 684:	39 c2                	cmp    %eax,%edx
+ 686:	72 f0                	jb     678 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 688:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 68b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 68e:	39 f8                	cmp    %edi,%eax
+ 690:	74 2e                	je     6c0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 692:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 695:	8b 42 04             	mov    0x4(%edx),%eax
+ 698:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 69b:	39 f1                	cmp    %esi,%ecx
+ 69d:	74 38                	je     6d7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 69f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 6a1:	5b                   	pop    %ebx
+  freep = p;
+ 6a2:	89 15 40 10 00 00    	mov    %edx,0x1040
+}
+ 6a8:	5e                   	pop    %esi
+ 6a9:	5f                   	pop    %edi
+ 6aa:	5d                   	pop    %ebp
+ 6ab:	c3                   	ret
+ 6ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6b0:	39 c1                	cmp    %eax,%ecx
+ 6b2:	72 d0                	jb     684 <free+0x24>
+ 6b4:	eb c2                	jmp    678 <free+0x18>
+ 6b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6bd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 6c0:	03 70 04             	add    0x4(%eax),%esi
+ 6c3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6c6:	8b 02                	mov    (%edx),%eax
+ 6c8:	8b 00                	mov    (%eax),%eax
+ 6ca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 6cd:	8b 42 04             	mov    0x4(%edx),%eax
+ 6d0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 6d3:	39 f1                	cmp    %esi,%ecx
+ 6d5:	75 c8                	jne    69f <free+0x3f>
+    p->s.size += bp->s.size;
+ 6d7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 6da:	89 15 40 10 00 00    	mov    %edx,0x1040
+    p->s.size += bp->s.size;
+ 6e0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 6e3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 6e6:	89 0a                	mov    %ecx,(%edx)
+}
+ 6e8:	5b                   	pop    %ebx
+ 6e9:	5e                   	pop    %esi
+ 6ea:	5f                   	pop    %edi
+ 6eb:	5d                   	pop    %ebp
+ 6ec:	c3                   	ret
+ 6ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006f0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 6f0:	55                   	push   %ebp
+ 6f1:	89 e5                	mov    %esp,%ebp
+ 6f3:	57                   	push   %edi
+ 6f4:	56                   	push   %esi
+ 6f5:	53                   	push   %ebx
+ 6f6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 6fc:	8b 15 40 10 00 00    	mov    0x1040,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 702:	8d 78 07             	lea    0x7(%eax),%edi
+ 705:	c1 ef 03             	shr    $0x3,%edi
+ 708:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 70b:	85 d2                	test   %edx,%edx
+ 70d:	0f 84 8d 00 00 00    	je     7a0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 713:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 715:	8b 48 04             	mov    0x4(%eax),%ecx
+ 718:	39 f9                	cmp    %edi,%ecx
+ 71a:	73 64                	jae    780 <malloc+0x90>
+  if(nu < 4096)
+ 71c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 721:	39 df                	cmp    %ebx,%edi
+ 723:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 726:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 72d:	eb 0a                	jmp    739 <malloc+0x49>
+ 72f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 730:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 732:	8b 48 04             	mov    0x4(%eax),%ecx
+ 735:	39 f9                	cmp    %edi,%ecx
+ 737:	73 47                	jae    780 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 739:	89 c2                	mov    %eax,%edx
+ 73b:	39 05 40 10 00 00    	cmp    %eax,0x1040
+ 741:	75 ed                	jne    730 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 743:	83 ec 0c             	sub    $0xc,%esp
+ 746:	56                   	push   %esi
+ 747:	e8 20 fc ff ff       	call   36c <sbrk>
+  if(p == (char*)-1)
+ 74c:	83 c4 10             	add    $0x10,%esp
+ 74f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 752:	74 1c                	je     770 <malloc+0x80>
+  hp->s.size = nu;
+ 754:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 757:	83 ec 0c             	sub    $0xc,%esp
+ 75a:	83 c0 08             	add    $0x8,%eax
+ 75d:	50                   	push   %eax
+ 75e:	e8 fd fe ff ff       	call   660 <free>
+  return freep;
+ 763:	8b 15 40 10 00 00    	mov    0x1040,%edx
+      if((p = morecore(nunits)) == 0)
+ 769:	83 c4 10             	add    $0x10,%esp
+ 76c:	85 d2                	test   %edx,%edx
+ 76e:	75 c0                	jne    730 <malloc+0x40>
+        return 0;
+  }
+}
+ 770:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 773:	31 c0                	xor    %eax,%eax
+}
+ 775:	5b                   	pop    %ebx
+ 776:	5e                   	pop    %esi
+ 777:	5f                   	pop    %edi
+ 778:	5d                   	pop    %ebp
+ 779:	c3                   	ret
+ 77a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 780:	39 cf                	cmp    %ecx,%edi
+ 782:	74 4c                	je     7d0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 784:	29 f9                	sub    %edi,%ecx
+ 786:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 789:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 78c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 78f:	89 15 40 10 00 00    	mov    %edx,0x1040
+}
+ 795:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 798:	83 c0 08             	add    $0x8,%eax
+}
+ 79b:	5b                   	pop    %ebx
+ 79c:	5e                   	pop    %esi
+ 79d:	5f                   	pop    %edi
+ 79e:	5d                   	pop    %ebp
+ 79f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 7a0:	c7 05 40 10 00 00 44 	movl   $0x1044,0x1040
+ 7a7:	10 00 00 
+    base.s.size = 0;
+ 7aa:	b8 44 10 00 00       	mov    $0x1044,%eax
+    base.s.ptr = freep = prevp = &base;
+ 7af:	c7 05 44 10 00 00 44 	movl   $0x1044,0x1044
+ 7b6:	10 00 00 
+    base.s.size = 0;
+ 7b9:	c7 05 48 10 00 00 00 	movl   $0x0,0x1048
+ 7c0:	00 00 00 
+    if(p->s.size >= nunits){
+ 7c3:	e9 54 ff ff ff       	jmp    71c <malloc+0x2c>
+ 7c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7cf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 7d0:	8b 08                	mov    (%eax),%ecx
+ 7d2:	89 0a                	mov    %ecx,(%edx)
+ 7d4:	eb b9                	jmp    78f <malloc+0x9f>
@@ -0,0 +1,27 @@
+// Print the contention counters of the kernel's spin locks.
+// Times are in units of 1024 TSC cycles.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "lockstat.h"
+
+struct lockstat ls[NLOCKSTAT];
+
+int
+main(void)
+{
+  int i, n;
+
+  if((n = lockstat(ls, NLOCKSTAT)) < 0){
+    printf(2, "lockstat: failed\n");
+    exit();
+  }
+  printf(1, "name acquires contended spin maxhold\n");
+  for(i = 0; i < n; i++)
+    printf(1, "%s %d %d %d %d\n", ls[i].name, ls[i].acquires,
+           ls[i].contended, (uint)(ls[i].spin >> 10),
+           (uint)(ls[i].maxhold >> 10));
+  exit();
+}
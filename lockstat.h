@@ -0,0 +1,11 @@
+// Contention counters kept for each kind of spin lock, as
+// returned by the lockstat system call.  All locks with the same
+// name share one record, so the counts for locks such as the
+// per-process ones are totals over every instance.
+struct lockstat {
+  char name[16];
+  uint acquires;       // times the lock was acquired
+  uint contended;      // acquisitions that had to wait
+  uint64_t spin;       // TSC cycles spent waiting
+  uint64_t maxhold;    // longest time held, in TSC cycles
+};
@@ -17,107 +17,169 @@
 // A system call should call begin_op()/end_op() to mark
 // its start and end. Usually begin_op() just increments
 // the count of in-progress FS system calls and returns.
-// But if it thinks the log is close to running out, it
-// sleeps until the last outstanding end_op() commits.
+// But if it thinks the transaction is close to its largest
+// size, it sleeps until the log flusher takes the transaction.
 //
-// The log is a physical re-do log containing disk blocks.
-// The on-disk log format:
-//   header block, containing block #s for block A, B, C, ...
+// Commits are done by the log flusher, a kernel thread, so
+// end_op() doesn't wait for the disk; the flusher commits
+// whatever system calls finished while it was busy as one
+// group.  It copies the transaction's blocks into the log
+// buffers while no system call is active, and from then on
+// lets the next transaction's system calls run while it writes
+// the log.
+//
+// The log is a physical re-do log containing disk blocks, kept
+// as a circular area (see fs.h):
+//   descriptor of transaction 1, listing block #s for A, B, ...
 //   block A
 //   block B
+//   descriptor of transaction 2, listing block #s for C, ...
 //   block C
 //   ...
-// Log appends are synchronous.
+// A transaction commits when its descriptor, written after its
+// blocks, reaches the disk.  Committed blocks stay pinned in the
+// cache until they are checkpointed: written to their home
+// locations, oldest transaction first, after which the header
+// moves the tail past them and their space is reused.  The
+// flusher checkpoints a little at a time, to keep half the area
+// free for the next transaction.  Recovery replays the
+// transactions from the tail on whose descriptors carry the
+// expected sequence numbers and checksums.  The checksum covers
+// the blocks as well, so neither a torn commit nor a logged
+// block from an earlier lap that happens to look like the
+// expected descriptor gets replayed.
 
-// Contents of the header block, used for both the on-disk header block
-// and to keep track in memory of logged block# before commit.
+// Blocks logged by a transaction, in memory.
 struct logheader {
   int n;
-  int block[LOGSIZE];
+  int block[NLOGDESC];
 };
 
 struct log {
   struct spinlock lock;
-  int start;
-  int size;
+  int start;       // header block; the area follows it
+  int size;        // blocks in the circular area
+  int txnmax;      // most blocks in a transaction
   int outstanding; // how many FS sys calls are executing.
-  int committing;  // in commit(), please wait.
+  int committing;  // copying a transaction to the log, please wait.
   int dev;
-  struct logheader lh;
+  uint tail;       // first live slot, counting from 0 forever
+  uint head;       // next free slot, likewise
+  uint seq;        // sequence number of the transaction at tail
+  uint headseq;    // sequence number of the next to commit
+  struct logheader lh;   // the transaction being built
+  struct logheader clh;  // the transaction being committed
+  struct buf *lbuf[NLOGDESC];  // log blocks of clh, held by the flusher
+  int lhome[LOGMAX];  // home of each slot's block, -n for a descriptor
 };
 struct log log;
 
 static void recover_from_log(void);
 static void commit();
+static void logflusher(void*);
+
+// Block number of log area slot i.
+#define LOGSLOT(i) (log.start + 1 + (i) % log.size)
 
 void
 initlog(int dev)
 {
-  if (sizeof(struct logheader) >= BSIZE)
-    panic("initlog: too big logheader");
-
   struct superblock sb;
   initlock(&log.lock, "log");
   readsb(dev, &sb);
   log.start = sb.logstart;
-  log.size = sb.nlog;
+  log.size = sb.nlog - 1;
+  log.txnmax = log.size/2 - 1;
+  if(log.txnmax > NLOGDESC)
+    log.txnmax = NLOGDESC;
+  if(log.size > LOGMAX || log.txnmax < MAXOPBLOCKS)
+    panic("initlog: bad log size");
   log.dev = dev;
   recover_from_log();
+  if(kthread("logflush", logflusher, 0) < 0)
+    panic("initlog: no flusher");
 }
 
-// Copy committed blocks from log to their home location
-static void
-install_trans(void)
+// Add the n bytes at p to the checksum sum.
+static uint
+logsum(uint sum, void *p, int n)
 {
-  int tail;
+  uint *w;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
-    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
-    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
-    bwrite(dbuf);  // write dst to disk
-    brelse(lbuf);
-    brelse(dbuf);
-  }
+  for(w = p; n > 0; n -= sizeof(*w))
+    sum = (sum ^ *w++) * 16777619;
+  return sum;
 }
 
-// Read the log header from disk into the in-memory log header
-static void
-read_head(void)
+// The checksum of descriptor d, without its blocks.
+static uint
+descsum(struct logdesc *d)
 {
-  struct buf *buf = bread(log.dev, log.start);
-  struct logheader *lh = (struct logheader *) (buf->data);
-  int i;
-  log.lh.n = lh->n;
-  for (i = 0; i < log.lh.n; i++) {
-    log.lh.block[i] = lh->block[i];
-  }
-  brelse(buf);
+  uint sum;
+
+  sum = logsum(2166136261, d, 3*sizeof(uint));   // magic, seq, n
+  return logsum(sum, d->block, d->n*sizeof(uint));
 }
 
-// Write in-memory log header to disk.
-// This is the true point at which the
-// current transaction commits.
+// Write the tail of the log to the header block.  Until this
+// is done, recovery would replay the transactions before it.
 static void
 write_head(void)
 {
   struct buf *buf = bread(log.dev, log.start);
-  struct logheader *hb = (struct logheader *) (buf->data);
-  int i;
-  hb->n = log.lh.n;
-  for (i = 0; i < log.lh.n; i++) {
-    hb->block[i] = log.lh.block[i];
-  }
+  struct loghead *hb = (struct loghead *) (buf->data);
+  hb->tail = log.tail % log.size;
+  hb->seq = log.seq;
   bwrite(buf);
   brelse(buf);
 }
 
+// Replay the committed transactions from the tail on.
 static void
 recover_from_log(void)
 {
-  read_head();
-  install_trans(); // if committed, copy from log to disk
-  log.lh.n = 0;
+  struct buf *buf = bread(log.dev, log.start);
+  struct loghead *hb = (struct loghead *) (buf->data);
+  struct logdesc *d;
+  struct buf *lbuf;
+  uint sum;
+  int i;
+
+  log.tail = hb->tail % log.size;
+  log.seq = hb->seq;
+  brelse(buf);
+
+  for(;;){
+    struct buf *dbuf = bread(log.dev, LOGSLOT(log.tail));
+    d = (struct logdesc *) (dbuf->data);
+    if(d->magic != LOGMAGIC || d->seq != log.seq || d->n > NLOGDESC){
+      brelse(dbuf);
+      break;
+    }
+    sum = descsum(d);
+    for (i = 0; i < d->n; i++) {
+      lbuf = bread(log.dev, LOGSLOT(log.tail+1+i));
+      sum = logsum(sum, lbuf->data, BSIZE);
+      brelse(lbuf);
+    }
+    if(sum != d->sum){
+      brelse(dbuf);
+      break;
+    }
+    for (i = 0; i < d->n; i++) {
+      lbuf = bread(log.dev, LOGSLOT(log.tail+1+i)); // read log block
+      struct buf *hbuf = bread(log.dev, d->block[i]); // read dst
+      memmove(hbuf->data, lbuf->data, BSIZE);  // copy block to dst
+      bwrite(hbuf);  // write dst to disk
+      brelse(lbuf);
+      brelse(hbuf);
+    }
+    log.tail += d->n + 1;
+    log.seq++;
+    brelse(dbuf);
+  }
+  log.head = log.tail;
+  log.headseq = log.seq;
   write_head(); // clear the log
 }
 
@@ -129,8 +191,8 @@ begin_op(void)
   while(1){
     if(log.committing){
       sleep(&log, &log.lock);
-    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
-      // this op might exhaust log space; wait for commit.
+    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > log.txnmax){
+      // this op might make the transaction too big; wait for commit.
       sleep(&log, &log.lock);
     } else {
       log.outstanding += 1;
@@ -141,19 +203,17 @@ begin_op(void)
 }
 
 // called at the end of each FS system call.
-// commits if this was the last outstanding operation.
+// hands the transaction to the flusher if this was the last
+// outstanding operation.
 void
 end_op(void)
 {
-  int do_commit = 0;
-
   acquire(&log.lock);
   log.outstanding -= 1;
   if(log.committing)
     panic("log.committing");
   if(log.outstanding == 0){
-    do_commit = 1;
-    log.committing = 1;
+    wakeup(&log.lh);
   } else {
     // begin_op() may be waiting for log space,
     // and decrementing log.outstanding has decreased
@@ -161,43 +221,153 @@ end_op(void)
     wakeup(&log);
   }
   release(&log.lock);
+}
 
-  if(do_commit){
-    // call commit w/o holding locks, since not allowed
-    // to sleep with locks.
-    commit();
+// Is block b logged by a live transaction in slots from on?
+static int
+relogged(int b, uint from)
+{
+  uint s;
+
+  for (s = from; s != log.head; s++)
+    if (log.lhome[s % log.size] == b)
+      return 1;
+  return 0;
+}
+
+// Is block b in the transaction being built?
+// Caller must hold log.lock.
+static int
+inlh(int b)
+{
+  int i;
+
+  for (i = 0; i < log.lh.n; i++)
+    if (log.lh.block[i] == b)
+      return 1;
+  return 0;
+}
+
+// Checkpoint the oldest transaction: write its blocks to their
+// home locations, except those that a later transaction logs
+// again, and unpin them from the cache.  Only the flusher
+// calls it, so the live transactions stay put meanwhile.
+static void
+checkpoint(void)
+{
+  int i, n, b;
+  uint next;
+  struct buf *lbuf, *hbuf;
+
+  n = -log.lhome[log.tail % log.size];
+  next = log.tail + 1 + n;
+  for (i = 0; i < n; i++) {
+    b = log.lhome[(log.tail + 1 + i) % log.size];
+    if (relogged(b, next))
+      continue;  // a later transaction will write it home
+    lbuf = bread(log.dev, LOGSLOT(log.tail + 1 + i));
+    bwriteat(lbuf, b);
+    brelse(lbuf);
+
+    // The cached copy holds what we just wrote, or newer data
+    // that some system call has logged since.
+    hbuf = bread(log.dev, b);
     acquire(&log.lock);
-    log.committing = 0;
-    wakeup(&log);
+    if (!inlh(b))
+      hbuf->flags &= ~B_DIRTY;
     release(&log.lock);
+    brelse(hbuf);
   }
+  log.tail = next;
+  log.seq++;
 }
 
-// Copy modified blocks from cache to log.
+// Copy modified blocks from cache to the log buffers after the
+// head, which stay locked until the commit is done.
 static void
 write_log(void)
 {
   int tail;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *to = bread(log.dev, log.start+tail+1); // log block
-    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
+  for (tail = 0; tail < log.clh.n; tail++) {
+    struct buf *to = bread(log.dev, LOGSLOT(log.head+1+tail)); // log block
+    struct buf *from = bread(log.dev, log.clh.block[tail]); // cache block
     memmove(to->data, from->data, BSIZE);
-    bwrite(to);  // write the log
     brelse(from);
-    brelse(to);
+    log.lbuf[tail] = to;
+    log.lhome[(log.head+1+tail) % log.size] = log.clh.block[tail];
   }
 }
 
+// Write the descriptor of clh -- the real commit.
+static void
+write_desc(void)
+{
+  struct buf *buf = bread(log.dev, LOGSLOT(log.head));
+  struct logdesc *d = (struct logdesc *) (buf->data);
+  int i;
+
+  d->magic = LOGMAGIC;
+  d->seq = log.headseq;
+  d->n = log.clh.n;
+  for (i = 0; i < log.clh.n; i++)
+    d->block[i] = log.clh.block[i];
+  d->sum = descsum(d);
+  for (i = 0; i < log.clh.n; i++)
+    d->sum = logsum(d->sum, log.lbuf[i]->data, BSIZE);
+  bwrite(buf);
+  brelse(buf);
+}
+
 static void
 commit()
 {
-  if (log.lh.n > 0) {
-    write_log();     // Write modified blocks from cache to log
-    write_head();    // Write header to disk -- the real commit
-    install_trans(); // Now install writes to home locations
+  int tail;
+
+  write_log();     // Copy modified blocks from cache to log buffers
+
+  // The next transaction can start now.
+  acquire(&log.lock);
+  log.committing = 0;
+  wakeup(&log);
+  release(&log.lock);
+
+  for (tail = 0; tail < log.clh.n; tail++)
+    bwrite(log.lbuf[tail]);  // write the log
+  write_desc();    // Write descriptor to disk -- the real commit
+  for (tail = 0; tail < log.clh.n; tail++)
+    brelse(log.lbuf[tail]);
+  log.lhome[log.head % log.size] = -log.clh.n;
+  log.head += log.clh.n + 1;
+  log.headseq++;
+  log.clh.n = 0;
+}
+
+// The log flusher: commit the current transaction whenever
+// no system call is in the middle of it, then checkpoint old
+// transactions until there is room for the next one.
+static void
+logflusher(void *arg)
+{
+  int moved;
+
+  for(;;){
+    acquire(&log.lock);
+    while(log.lh.n == 0 || log.outstanding > 0)
+      sleep(&log.lh, &log.lock);
+    log.committing = 1;
+    log.clh = log.lh;
     log.lh.n = 0;
-    write_head();    // Erase the transaction from the log
+    release(&log.lock);
+    commit();
+
+    moved = 0;
+    while(log.size - (log.head - log.tail) < log.txnmax + 1){
+      checkpoint();
+      moved = 1;
+    }
+    if(moved)
+      write_head();
   }
 }
 
@@ -215,7 +385,7 @@ log_write(struct buf *b)
 {
   int i;
 
-  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+  if (log.lh.n >= log.txnmax)
     panic("too big a transaction");
   if (log.outstanding < 1)
     panic("log_write outside of trans");
@@ -231,4 +401,3 @@ log_write(struct buf *b)
   b->flags |= B_DIRTY; // prevent eviction
   release(&log.lock);
 }
-
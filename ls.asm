@@ -0,0 +1,1510 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  close(fd);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	bb 01 00 00 00       	mov    $0x1,%ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 31                	mov    (%ecx),%esi
+  1b:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+  1e:	83 fe 01             	cmp    $0x1,%esi
+  21:	7e 1f                	jle    42 <main+0x42>
+  23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  27:	90                   	nop
+    ls(".");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+    ls(argv[i]);
+  28:	83 ec 0c             	sub    $0xc,%esp
+  2b:	ff 34 9f             	push   (%edi,%ebx,4)
+  for(i=1; i<argc; i++)
+  2e:	83 c3 01             	add    $0x1,%ebx
+    ls(argv[i]);
+  31:	e8 ca 00 00 00       	call   100 <ls>
+  for(i=1; i<argc; i++)
+  36:	83 c4 10             	add    $0x10,%esp
+  39:	39 de                	cmp    %ebx,%esi
+  3b:	75 eb                	jne    28 <main+0x28>
+  exit();
+  3d:	e8 42 05 00 00       	call   584 <exit>
+    ls(".");
+  42:	83 ec 0c             	sub    $0xc,%esp
+  45:	68 c0 0a 00 00       	push   $0xac0
+  4a:	e8 b1 00 00 00       	call   100 <ls>
+    exit();
+  4f:	e8 30 05 00 00       	call   584 <exit>
+  54:	66 90                	xchg   %ax,%ax
+  56:	66 90                	xchg   %ax,%ax
+  58:	66 90                	xchg   %ax,%ax
+  5a:	66 90                	xchg   %ax,%ax
+  5c:	66 90                	xchg   %ax,%ax
+  5e:	66 90                	xchg   %ax,%ax
+
+00000060 <fmtname>:
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	56                   	push   %esi
+  64:	53                   	push   %ebx
+  65:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+  68:	83 ec 0c             	sub    $0xc,%esp
+  6b:	56                   	push   %esi
+  6c:	e8 ff 02 00 00       	call   370 <strlen>
+  71:	83 c4 10             	add    $0x10,%esp
+  74:	01 f0                	add    %esi,%eax
+  76:	89 c3                	mov    %eax,%ebx
+  78:	73 0f                	jae    89 <fmtname+0x29>
+  7a:	eb 12                	jmp    8e <fmtname+0x2e>
+  7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  83:	39 f0                	cmp    %esi,%eax
+  85:	72 0a                	jb     91 <fmtname+0x31>
+  87:	89 c3                	mov    %eax,%ebx
+  89:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+  8c:	75 f2                	jne    80 <fmtname+0x20>
+  p++;
+  8e:	83 c3 01             	add    $0x1,%ebx
+  if(strlen(p) >= DIRSIZ)
+  91:	83 ec 0c             	sub    $0xc,%esp
+  94:	53                   	push   %ebx
+  95:	e8 d6 02 00 00       	call   370 <strlen>
+  9a:	83 c4 10             	add    $0x10,%esp
+  9d:	83 f8 0d             	cmp    $0xd,%eax
+  a0:	77 4a                	ja     ec <fmtname+0x8c>
+  memmove(buf, p, strlen(p));
+  a2:	83 ec 0c             	sub    $0xc,%esp
+  a5:	53                   	push   %ebx
+  a6:	e8 c5 02 00 00       	call   370 <strlen>
+  ab:	83 c4 0c             	add    $0xc,%esp
+  ae:	50                   	push   %eax
+  af:	53                   	push   %ebx
+  b0:	68 48 0e 00 00       	push   $0xe48
+  b5:	e8 f6 03 00 00       	call   4b0 <memmove>
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  ba:	89 1c 24             	mov    %ebx,(%esp)
+  bd:	e8 ae 02 00 00       	call   370 <strlen>
+  c2:	89 1c 24             	mov    %ebx,(%esp)
+  return buf;
+  c5:	bb 48 0e 00 00       	mov    $0xe48,%ebx
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  ca:	89 c6                	mov    %eax,%esi
+  cc:	e8 9f 02 00 00       	call   370 <strlen>
+  d1:	ba 0e 00 00 00       	mov    $0xe,%edx
+  d6:	83 c4 0c             	add    $0xc,%esp
+  d9:	29 f2                	sub    %esi,%edx
+  db:	05 48 0e 00 00       	add    $0xe48,%eax
+  e0:	52                   	push   %edx
+  e1:	6a 20                	push   $0x20
+  e3:	50                   	push   %eax
+  e4:	e8 b7 02 00 00       	call   3a0 <memset>
+  return buf;
+  e9:	83 c4 10             	add    $0x10,%esp
+}
+  ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  ef:	89 d8                	mov    %ebx,%eax
+  f1:	5b                   	pop    %ebx
+  f2:	5e                   	pop    %esi
+  f3:	5d                   	pop    %ebp
+  f4:	c3                   	ret
+  f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000100 <ls>:
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	57                   	push   %edi
+ 104:	56                   	push   %esi
+ 105:	53                   	push   %ebx
+ 106:	81 ec 64 02 00 00    	sub    $0x264,%esp
+ 10c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if((fd = open(path, 0)) < 0){
+ 10f:	6a 00                	push   $0x0
+ 111:	57                   	push   %edi
+ 112:	e8 ad 04 00 00       	call   5c4 <open>
+ 117:	83 c4 10             	add    $0x10,%esp
+ 11a:	85 c0                	test   %eax,%eax
+ 11c:	0f 88 9e 01 00 00    	js     2c0 <ls+0x1c0>
+  if(fstat(fd, &st) < 0){
+ 122:	83 ec 08             	sub    $0x8,%esp
+ 125:	8d b5 d4 fd ff ff    	lea    -0x22c(%ebp),%esi
+ 12b:	89 c3                	mov    %eax,%ebx
+ 12d:	56                   	push   %esi
+ 12e:	50                   	push   %eax
+ 12f:	e8 a8 04 00 00       	call   5dc <fstat>
+ 134:	83 c4 10             	add    $0x10,%esp
+ 137:	85 c0                	test   %eax,%eax
+ 139:	0f 88 c1 01 00 00    	js     300 <ls+0x200>
+  switch(st.type){
+ 13f:	0f b7 85 d4 fd ff ff 	movzwl -0x22c(%ebp),%eax
+ 146:	66 83 f8 01          	cmp    $0x1,%ax
+ 14a:	74 64                	je     1b0 <ls+0xb0>
+ 14c:	66 83 f8 02          	cmp    $0x2,%ax
+ 150:	74 1e                	je     170 <ls+0x70>
+  close(fd);
+ 152:	83 ec 0c             	sub    $0xc,%esp
+ 155:	53                   	push   %ebx
+ 156:	e8 51 04 00 00       	call   5ac <close>
+ 15b:	83 c4 10             	add    $0x10,%esp
+}
+ 15e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 161:	5b                   	pop    %ebx
+ 162:	5e                   	pop    %esi
+ 163:	5f                   	pop    %edi
+ 164:	5d                   	pop    %ebp
+ 165:	c3                   	ret
+ 166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+ 170:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+ 176:	83 ec 0c             	sub    $0xc,%esp
+ 179:	8b b5 dc fd ff ff    	mov    -0x224(%ebp),%esi
+ 17f:	89 95 b4 fd ff ff    	mov    %edx,-0x24c(%ebp)
+ 185:	57                   	push   %edi
+ 186:	e8 d5 fe ff ff       	call   60 <fmtname>
+ 18b:	8b 95 b4 fd ff ff    	mov    -0x24c(%ebp),%edx
+ 191:	59                   	pop    %ecx
+ 192:	5f                   	pop    %edi
+ 193:	52                   	push   %edx
+ 194:	56                   	push   %esi
+ 195:	6a 02                	push   $0x2
+ 197:	50                   	push   %eax
+ 198:	68 a0 0a 00 00       	push   $0xaa0
+ 19d:	6a 01                	push   $0x1
+ 19f:	e8 ac 05 00 00       	call   750 <printf>
+    break;
+ 1a4:	83 c4 20             	add    $0x20,%esp
+ 1a7:	eb a9                	jmp    152 <ls+0x52>
+ 1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+ 1b0:	83 ec 0c             	sub    $0xc,%esp
+ 1b3:	57                   	push   %edi
+ 1b4:	e8 b7 01 00 00       	call   370 <strlen>
+ 1b9:	83 c4 10             	add    $0x10,%esp
+ 1bc:	83 c0 10             	add    $0x10,%eax
+ 1bf:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 1c4:	0f 87 16 01 00 00    	ja     2e0 <ls+0x1e0>
+    strcpy(buf, path);
+ 1ca:	83 ec 08             	sub    $0x8,%esp
+ 1cd:	57                   	push   %edi
+ 1ce:	8d bd e8 fd ff ff    	lea    -0x218(%ebp),%edi
+ 1d4:	57                   	push   %edi
+ 1d5:	e8 66 01 00 00       	call   340 <strcpy>
+    p = buf+strlen(buf);
+ 1da:	89 3c 24             	mov    %edi,(%esp)
+ 1dd:	e8 8e 01 00 00       	call   370 <strlen>
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1e2:	83 c4 10             	add    $0x10,%esp
+    p = buf+strlen(buf);
+ 1e5:	01 f8                	add    %edi,%eax
+    *p++ = '/';
+ 1e7:	8d 48 01             	lea    0x1(%eax),%ecx
+    p = buf+strlen(buf);
+ 1ea:	89 85 a8 fd ff ff    	mov    %eax,-0x258(%ebp)
+    *p++ = '/';
+ 1f0:	89 8d a4 fd ff ff    	mov    %ecx,-0x25c(%ebp)
+ 1f6:	c6 00 2f             	movb   $0x2f,(%eax)
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 200:	83 ec 04             	sub    $0x4,%esp
+ 203:	8d 85 c4 fd ff ff    	lea    -0x23c(%ebp),%eax
+ 209:	6a 10                	push   $0x10
+ 20b:	50                   	push   %eax
+ 20c:	53                   	push   %ebx
+ 20d:	e8 8a 03 00 00       	call   59c <read>
+ 212:	83 c4 10             	add    $0x10,%esp
+ 215:	83 f8 10             	cmp    $0x10,%eax
+ 218:	0f 85 34 ff ff ff    	jne    152 <ls+0x52>
+      if(de.inum == 0)
+ 21e:	66 83 bd c4 fd ff ff 	cmpw   $0x0,-0x23c(%ebp)
+ 225:	00 
+ 226:	74 d8                	je     200 <ls+0x100>
+      memmove(p, de.name, DIRSIZ);
+ 228:	83 ec 04             	sub    $0x4,%esp
+ 22b:	8d 85 c6 fd ff ff    	lea    -0x23a(%ebp),%eax
+ 231:	6a 0e                	push   $0xe
+ 233:	50                   	push   %eax
+ 234:	ff b5 a4 fd ff ff    	push   -0x25c(%ebp)
+ 23a:	e8 71 02 00 00       	call   4b0 <memmove>
+      p[DIRSIZ] = 0;
+ 23f:	8b 85 a8 fd ff ff    	mov    -0x258(%ebp),%eax
+ 245:	c6 40 0f 00          	movb   $0x0,0xf(%eax)
+      if(stat(buf, &st) < 0){
+ 249:	58                   	pop    %eax
+ 24a:	5a                   	pop    %edx
+ 24b:	56                   	push   %esi
+ 24c:	57                   	push   %edi
+ 24d:	e8 0e 02 00 00       	call   460 <stat>
+ 252:	83 c4 10             	add    $0x10,%esp
+ 255:	85 c0                	test   %eax,%eax
+ 257:	0f 88 cb 00 00 00    	js     328 <ls+0x228>
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+ 25d:	8b 8d e4 fd ff ff    	mov    -0x21c(%ebp),%ecx
+ 263:	8b 95 dc fd ff ff    	mov    -0x224(%ebp),%edx
+ 269:	83 ec 0c             	sub    $0xc,%esp
+ 26c:	0f bf 85 d4 fd ff ff 	movswl -0x22c(%ebp),%eax
+ 273:	89 8d ac fd ff ff    	mov    %ecx,-0x254(%ebp)
+ 279:	89 95 b0 fd ff ff    	mov    %edx,-0x250(%ebp)
+ 27f:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+ 285:	57                   	push   %edi
+ 286:	e8 d5 fd ff ff       	call   60 <fmtname>
+ 28b:	5a                   	pop    %edx
+ 28c:	59                   	pop    %ecx
+ 28d:	8b 8d ac fd ff ff    	mov    -0x254(%ebp),%ecx
+ 293:	51                   	push   %ecx
+ 294:	8b 95 b0 fd ff ff    	mov    -0x250(%ebp),%edx
+ 29a:	52                   	push   %edx
+ 29b:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+ 2a1:	50                   	push   %eax
+ 2a2:	68 a0 0a 00 00       	push   $0xaa0
+ 2a7:	6a 01                	push   $0x1
+ 2a9:	e8 a2 04 00 00       	call   750 <printf>
+ 2ae:	83 c4 20             	add    $0x20,%esp
+ 2b1:	e9 4a ff ff ff       	jmp    200 <ls+0x100>
+ 2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(2, "ls: cannot open %s\n", path);
+ 2c0:	83 ec 04             	sub    $0x4,%esp
+ 2c3:	57                   	push   %edi
+ 2c4:	68 78 0a 00 00       	push   $0xa78
+ 2c9:	6a 02                	push   $0x2
+ 2cb:	e8 80 04 00 00       	call   750 <printf>
+    return;
+ 2d0:	83 c4 10             	add    $0x10,%esp
+}
+ 2d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2d6:	5b                   	pop    %ebx
+ 2d7:	5e                   	pop    %esi
+ 2d8:	5f                   	pop    %edi
+ 2d9:	5d                   	pop    %ebp
+ 2da:	c3                   	ret
+ 2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2df:	90                   	nop
+      printf(1, "ls: path too long\n");
+ 2e0:	83 ec 08             	sub    $0x8,%esp
+ 2e3:	68 ad 0a 00 00       	push   $0xaad
+ 2e8:	6a 01                	push   $0x1
+ 2ea:	e8 61 04 00 00       	call   750 <printf>
+      break;
+ 2ef:	83 c4 10             	add    $0x10,%esp
+ 2f2:	e9 5b fe ff ff       	jmp    152 <ls+0x52>
+ 2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fe:	66 90                	xchg   %ax,%ax
+    printf(2, "ls: cannot stat %s\n", path);
+ 300:	83 ec 04             	sub    $0x4,%esp
+ 303:	57                   	push   %edi
+ 304:	68 8c 0a 00 00       	push   $0xa8c
+ 309:	6a 02                	push   $0x2
+ 30b:	e8 40 04 00 00       	call   750 <printf>
+    close(fd);
+ 310:	89 1c 24             	mov    %ebx,(%esp)
+ 313:	e8 94 02 00 00       	call   5ac <close>
+    return;
+ 318:	83 c4 10             	add    $0x10,%esp
+}
+ 31b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 31e:	5b                   	pop    %ebx
+ 31f:	5e                   	pop    %esi
+ 320:	5f                   	pop    %edi
+ 321:	5d                   	pop    %ebp
+ 322:	c3                   	ret
+ 323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 327:	90                   	nop
+        printf(1, "ls: cannot stat %s\n", buf);
+ 328:	83 ec 04             	sub    $0x4,%esp
+ 32b:	57                   	push   %edi
+ 32c:	68 8c 0a 00 00       	push   $0xa8c
+ 331:	6a 01                	push   $0x1
+ 333:	e8 18 04 00 00       	call   750 <printf>
+        continue;
+ 338:	83 c4 10             	add    $0x10,%esp
+ 33b:	e9 c0 fe ff ff       	jmp    200 <ls+0x100>
+
+00000340 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 340:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 341:	31 c0                	xor    %eax,%eax
+{
+ 343:	89 e5                	mov    %esp,%ebp
+ 345:	53                   	push   %ebx
+ 346:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 349:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 350:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 354:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 357:	83 c0 01             	add    $0x1,%eax
+ 35a:	84 d2                	test   %dl,%dl
+ 35c:	75 f2                	jne    350 <strcpy+0x10>
+    ;
+  return os;
+}
+ 35e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 361:	89 c8                	mov    %ecx,%eax
+ 363:	c9                   	leave
+ 364:	c3                   	ret
+ 365:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 376:	80 3a 00             	cmpb   $0x0,(%edx)
+ 379:	74 15                	je     390 <strlen+0x20>
+ 37b:	31 c0                	xor    %eax,%eax
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+ 380:	83 c0 01             	add    $0x1,%eax
+ 383:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 387:	89 c1                	mov    %eax,%ecx
+ 389:	75 f5                	jne    380 <strlen+0x10>
+    ;
+  return n;
+}
+ 38b:	89 c8                	mov    %ecx,%eax
+ 38d:	5d                   	pop    %ebp
+ 38e:	c3                   	ret
+ 38f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 390:	31 c9                	xor    %ecx,%ecx
+}
+ 392:	5d                   	pop    %ebp
+ 393:	89 c8                	mov    %ecx,%eax
+ 395:	c3                   	ret
+ 396:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003a0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	57                   	push   %edi
+ 3a4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 3a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 3aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3ad:	89 d7                	mov    %edx,%edi
+ 3af:	fc                   	cld
+ 3b0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 3b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 3b5:	89 d0                	mov    %edx,%eax
+ 3b7:	c9                   	leave
+ 3b8:	c3                   	ret
+ 3b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003c0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3ca:	0f b6 10             	movzbl (%eax),%edx
+ 3cd:	84 d2                	test   %dl,%dl
+ 3cf:	75 12                	jne    3e3 <strchr+0x23>
+ 3d1:	eb 1d                	jmp    3f0 <strchr+0x30>
+ 3d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3d7:	90                   	nop
+ 3d8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 3dc:	83 c0 01             	add    $0x1,%eax
+ 3df:	84 d2                	test   %dl,%dl
+ 3e1:	74 0d                	je     3f0 <strchr+0x30>
+    if(*s == c)
+ 3e3:	38 d1                	cmp    %dl,%cl
+ 3e5:	75 f1                	jne    3d8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 3e7:	5d                   	pop    %ebp
+ 3e8:	c3                   	ret
+ 3e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 3f0:	31 c0                	xor    %eax,%eax
+}
+ 3f2:	5d                   	pop    %ebp
+ 3f3:	c3                   	ret
+ 3f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3ff:	90                   	nop
+
+00000400 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 405:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 408:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 409:	31 db                	xor    %ebx,%ebx
+{
+ 40b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 40e:	eb 27                	jmp    437 <gets+0x37>
+    cc = read(0, &c, 1);
+ 410:	83 ec 04             	sub    $0x4,%esp
+ 413:	6a 01                	push   $0x1
+ 415:	56                   	push   %esi
+ 416:	6a 00                	push   $0x0
+ 418:	e8 7f 01 00 00       	call   59c <read>
+    if(cc < 1)
+ 41d:	83 c4 10             	add    $0x10,%esp
+ 420:	85 c0                	test   %eax,%eax
+ 422:	7e 1d                	jle    441 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 424:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 428:	8b 55 08             	mov    0x8(%ebp),%edx
+ 42b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 42f:	3c 0a                	cmp    $0xa,%al
+ 431:	74 10                	je     443 <gets+0x43>
+ 433:	3c 0d                	cmp    $0xd,%al
+ 435:	74 0c                	je     443 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 437:	89 df                	mov    %ebx,%edi
+ 439:	83 c3 01             	add    $0x1,%ebx
+ 43c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 43f:	7c cf                	jl     410 <gets+0x10>
+ 441:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 443:	8b 45 08             	mov    0x8(%ebp),%eax
+ 446:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 44a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 44d:	5b                   	pop    %ebx
+ 44e:	5e                   	pop    %esi
+ 44f:	5f                   	pop    %edi
+ 450:	5d                   	pop    %ebp
+ 451:	c3                   	ret
+ 452:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 459:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000460 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	56                   	push   %esi
+ 464:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 465:	83 ec 08             	sub    $0x8,%esp
+ 468:	6a 00                	push   $0x0
+ 46a:	ff 75 08             	push   0x8(%ebp)
+ 46d:	e8 52 01 00 00       	call   5c4 <open>
+  if(fd < 0)
+ 472:	83 c4 10             	add    $0x10,%esp
+ 475:	85 c0                	test   %eax,%eax
+ 477:	78 27                	js     4a0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 479:	83 ec 08             	sub    $0x8,%esp
+ 47c:	ff 75 0c             	push   0xc(%ebp)
+ 47f:	89 c3                	mov    %eax,%ebx
+ 481:	50                   	push   %eax
+ 482:	e8 55 01 00 00       	call   5dc <fstat>
+  close(fd);
+ 487:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 48a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 48c:	e8 1b 01 00 00       	call   5ac <close>
+  return r;
+ 491:	83 c4 10             	add    $0x10,%esp
+}
+ 494:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 497:	89 f0                	mov    %esi,%eax
+ 499:	5b                   	pop    %ebx
+ 49a:	5e                   	pop    %esi
+ 49b:	5d                   	pop    %ebp
+ 49c:	c3                   	ret
+ 49d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 4a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 4a5:	eb ed                	jmp    494 <stat+0x34>
+ 4a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ae:	66 90                	xchg   %ax,%ax
+
+000004b0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	57                   	push   %edi
+ 4b4:	56                   	push   %esi
+ 4b5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 4be:	85 c0                	test   %eax,%eax
+ 4c0:	7e 13                	jle    4d5 <memmove+0x25>
+ 4c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 4c4:	89 d7                	mov    %edx,%edi
+ 4c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 4d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 4d1:	39 f8                	cmp    %edi,%eax
+ 4d3:	75 fb                	jne    4d0 <memmove+0x20>
+  return vdst;
+}
+ 4d5:	5e                   	pop    %esi
+ 4d6:	89 d0                	mov    %edx,%eax
+ 4d8:	5f                   	pop    %edi
+ 4d9:	5d                   	pop    %ebp
+ 4da:	c3                   	ret
+ 4db:	66 90                	xchg   %ax,%ax
+ 4dd:	66 90                	xchg   %ax,%ax
+ 4df:	90                   	nop
+
+000004e0 <strcmp>:
+#include "types.h"
+#include "util.h"
+
+int
+strcmp(const char *p, const char *q)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	53                   	push   %ebx
+ 4e4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 4ea:	0f b6 02             	movzbl (%edx),%eax
+ 4ed:	84 c0                	test   %al,%al
+ 4ef:	75 17                	jne    508 <strcmp+0x28>
+ 4f1:	eb 3a                	jmp    52d <strcmp+0x4d>
+ 4f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4f7:	90                   	nop
+ 4f8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 4fc:	83 c2 01             	add    $0x1,%edx
+ 4ff:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 502:	84 c0                	test   %al,%al
+ 504:	74 1a                	je     520 <strcmp+0x40>
+    p++, q++;
+ 506:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 508:	0f b6 19             	movzbl (%ecx),%ebx
+ 50b:	38 c3                	cmp    %al,%bl
+ 50d:	74 e9                	je     4f8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 50f:	29 d8                	sub    %ebx,%eax
+}
+ 511:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 514:	c9                   	leave
+ 515:	c3                   	ret
+ 516:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 51d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 520:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 524:	31 c0                	xor    %eax,%eax
+ 526:	29 d8                	sub    %ebx,%eax
+}
+ 528:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 52b:	c9                   	leave
+ 52c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 52d:	0f b6 19             	movzbl (%ecx),%ebx
+ 530:	31 c0                	xor    %eax,%eax
+ 532:	eb db                	jmp    50f <strcmp+0x2f>
+ 534:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 53f:	90                   	nop
+
+00000540 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	53                   	push   %ebx
+ 544:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 547:	0f be 02             	movsbl (%edx),%eax
+ 54a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 54d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 550:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 555:	77 1e                	ja     575 <atoi+0x35>
+ 557:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 560:	83 c2 01             	add    $0x1,%edx
+ 563:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 566:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 56a:	0f be 02             	movsbl (%edx),%eax
+ 56d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 570:	80 fb 09             	cmp    $0x9,%bl
+ 573:	76 eb                	jbe    560 <atoi+0x20>
+  return n;
+ 575:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 578:	89 c8                	mov    %ecx,%eax
+ 57a:	c9                   	leave
+ 57b:	c3                   	ret
+
+0000057c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 57c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 581:	cd 40                	int    $0x40
+ 583:	c3                   	ret
+
+00000584 <exit>:
+SYSCALL(exit)
+ 584:	b8 02 00 00 00       	mov    $0x2,%eax
+ 589:	cd 40                	int    $0x40
+ 58b:	c3                   	ret
+
+0000058c <wait>:
+SYSCALL(wait)
+ 58c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 591:	cd 40                	int    $0x40
+ 593:	c3                   	ret
+
+00000594 <pipe>:
+SYSCALL(pipe)
+ 594:	b8 04 00 00 00       	mov    $0x4,%eax
+ 599:	cd 40                	int    $0x40
+ 59b:	c3                   	ret
+
+0000059c <read>:
+SYSCALL(read)
+ 59c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5a1:	cd 40                	int    $0x40
+ 5a3:	c3                   	ret
+
+000005a4 <write>:
+SYSCALL(write)
+ 5a4:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5a9:	cd 40                	int    $0x40
+ 5ab:	c3                   	ret
+
+000005ac <close>:
+SYSCALL(close)
+ 5ac:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5b1:	cd 40                	int    $0x40
+ 5b3:	c3                   	ret
+
+000005b4 <kill>:
+SYSCALL(kill)
+ 5b4:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5b9:	cd 40                	int    $0x40
+ 5bb:	c3                   	ret
+
+000005bc <exec>:
+SYSCALL(exec)
+ 5bc:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5c1:	cd 40                	int    $0x40
+ 5c3:	c3                   	ret
+
+000005c4 <open>:
+SYSCALL(open)
+ 5c4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5c9:	cd 40                	int    $0x40
+ 5cb:	c3                   	ret
+
+000005cc <mknod>:
+SYSCALL(mknod)
+ 5cc:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5d1:	cd 40                	int    $0x40
+ 5d3:	c3                   	ret
+
+000005d4 <unlink>:
+SYSCALL(unlink)
+ 5d4:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5d9:	cd 40                	int    $0x40
+ 5db:	c3                   	ret
+
+000005dc <fstat>:
+SYSCALL(fstat)
+ 5dc:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5e1:	cd 40                	int    $0x40
+ 5e3:	c3                   	ret
+
+000005e4 <link>:
+SYSCALL(link)
+ 5e4:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5e9:	cd 40                	int    $0x40
+ 5eb:	c3                   	ret
+
+000005ec <mkdir>:
+SYSCALL(mkdir)
+ 5ec:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5f1:	cd 40                	int    $0x40
+ 5f3:	c3                   	ret
+
+000005f4 <chdir>:
+SYSCALL(chdir)
+ 5f4:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5f9:	cd 40                	int    $0x40
+ 5fb:	c3                   	ret
+
+000005fc <dup>:
+SYSCALL(dup)
+ 5fc:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 601:	cd 40                	int    $0x40
+ 603:	c3                   	ret
+
+00000604 <getpid>:
+SYSCALL(getpid)
+ 604:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 609:	cd 40                	int    $0x40
+ 60b:	c3                   	ret
+
+0000060c <sbrk>:
+SYSCALL(sbrk)
+ 60c:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 611:	cd 40                	int    $0x40
+ 613:	c3                   	ret
+
+00000614 <sleep>:
+SYSCALL(sleep)
+ 614:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 619:	cd 40                	int    $0x40
+ 61b:	c3                   	ret
+
+0000061c <uptime>:
+SYSCALL(uptime)
+ 61c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 621:	cd 40                	int    $0x40
+ 623:	c3                   	ret
+
+00000624 <arp>:
+SYSCALL(arp)
+ 624:	b8 16 00 00 00       	mov    $0x16,%eax
+ 629:	cd 40                	int    $0x40
+ 62b:	c3                   	ret
+
+0000062c <mmap>:
+SYSCALL(mmap)
+ 62c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 631:	cd 40                	int    $0x40
+ 633:	c3                   	ret
+
+00000634 <munmap>:
+SYSCALL(munmap)
+ 634:	b8 18 00 00 00       	mov    $0x18,%eax
+ 639:	cd 40                	int    $0x40
+ 63b:	c3                   	ret
+
+0000063c <msync>:
+SYSCALL(msync)
+ 63c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 641:	cd 40                	int    $0x40
+ 643:	c3                   	ret
+
+00000644 <shmcreate>:
+SYSCALL(shmcreate)
+ 644:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 649:	cd 40                	int    $0x40
+ 64b:	c3                   	ret
+
+0000064c <shmattach>:
+SYSCALL(shmattach)
+ 64c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 651:	cd 40                	int    $0x40
+ 653:	c3                   	ret
+
+00000654 <shmdetach>:
+SYSCALL(shmdetach)
+ 654:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 659:	cd 40                	int    $0x40
+ 65b:	c3                   	ret
+
+0000065c <futex_wait>:
+SYSCALL(futex_wait)
+ 65c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 661:	cd 40                	int    $0x40
+ 663:	c3                   	ret
+
+00000664 <futex_wake>:
+SYSCALL(futex_wake)
+ 664:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 669:	cd 40                	int    $0x40
+ 66b:	c3                   	ret
+
+0000066c <nice>:
+SYSCALL(nice)
+ 66c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 671:	cd 40                	int    $0x40
+ 673:	c3                   	ret
+
+00000674 <setpriority>:
+SYSCALL(setpriority)
+ 674:	b8 20 00 00 00       	mov    $0x20,%eax
+ 679:	cd 40                	int    $0x40
+ 67b:	c3                   	ret
+
+0000067c <cputime>:
+SYSCALL(cputime)
+ 67c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 681:	cd 40                	int    $0x40
+ 683:	c3                   	ret
+
+00000684 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 684:	b8 22 00 00 00       	mov    $0x22,%eax
+ 689:	cd 40                	int    $0x40
+ 68b:	c3                   	ret
+
+0000068c <clone>:
+SYSCALL(clone)
+ 68c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 691:	cd 40                	int    $0x40
+ 693:	c3                   	ret
+
+00000694 <join>:
+SYSCALL(join)
+ 694:	b8 24 00 00 00       	mov    $0x24,%eax
+ 699:	cd 40                	int    $0x40
+ 69b:	c3                   	ret
+
+0000069c <lockstat>:
+SYSCALL(lockstat)
+ 69c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 6a1:	cd 40                	int    $0x40
+ 6a3:	c3                   	ret
+ 6a4:	66 90                	xchg   %ax,%ax
+ 6a6:	66 90                	xchg   %ax,%ax
+ 6a8:	66 90                	xchg   %ax,%ax
+ 6aa:	66 90                	xchg   %ax,%ax
+ 6ac:	66 90                	xchg   %ax,%ax
+ 6ae:	66 90                	xchg   %ax,%ax
+
+000006b0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6b0:	55                   	push   %ebp
+ 6b1:	89 e5                	mov    %esp,%ebp
+ 6b3:	57                   	push   %edi
+ 6b4:	56                   	push   %esi
+ 6b5:	53                   	push   %ebx
+ 6b6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 6b8:	89 d1                	mov    %edx,%ecx
+{
+ 6ba:	83 ec 3c             	sub    $0x3c,%esp
+ 6bd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 6c0:	85 d2                	test   %edx,%edx
+ 6c2:	0f 89 80 00 00 00    	jns    748 <printint+0x98>
+ 6c8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 6cc:	74 7a                	je     748 <printint+0x98>
+    x = -xx;
+ 6ce:	f7 d9                	neg    %ecx
+    neg = 1;
+ 6d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 6d5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 6d8:	31 f6                	xor    %esi,%esi
+ 6da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 6e0:	89 c8                	mov    %ecx,%eax
+ 6e2:	31 d2                	xor    %edx,%edx
+ 6e4:	89 f7                	mov    %esi,%edi
+ 6e6:	f7 f3                	div    %ebx
+ 6e8:	8d 76 01             	lea    0x1(%esi),%esi
+ 6eb:	0f b6 92 24 0b 00 00 	movzbl 0xb24(%edx),%edx
+ 6f2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 6f6:	89 ca                	mov    %ecx,%edx
+ 6f8:	89 c1                	mov    %eax,%ecx
+ 6fa:	39 da                	cmp    %ebx,%edx
+ 6fc:	73 e2                	jae    6e0 <printint+0x30>
+  if(neg)
+ 6fe:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 701:	85 c0                	test   %eax,%eax
+ 703:	74 07                	je     70c <printint+0x5c>
+    buf[i++] = '-';
+ 705:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 70a:	89 f7                	mov    %esi,%edi
+ 70c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 70f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 712:	01 df                	add    %ebx,%edi
+ 714:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 718:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 71b:	83 ec 04             	sub    $0x4,%esp
+ 71e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 721:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 724:	6a 01                	push   $0x1
+ 726:	50                   	push   %eax
+ 727:	56                   	push   %esi
+ 728:	e8 77 fe ff ff       	call   5a4 <write>
+  while(--i >= 0)
+ 72d:	89 f8                	mov    %edi,%eax
+ 72f:	83 c4 10             	add    $0x10,%esp
+ 732:	83 ef 01             	sub    $0x1,%edi
+ 735:	39 d8                	cmp    %ebx,%eax
+ 737:	75 df                	jne    718 <printint+0x68>
+}
+ 739:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 73c:	5b                   	pop    %ebx
+ 73d:	5e                   	pop    %esi
+ 73e:	5f                   	pop    %edi
+ 73f:	5d                   	pop    %ebp
+ 740:	c3                   	ret
+ 741:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 748:	31 c0                	xor    %eax,%eax
+ 74a:	eb 89                	jmp    6d5 <printint+0x25>
+ 74c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000750 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 750:	55                   	push   %ebp
+ 751:	89 e5                	mov    %esp,%ebp
+ 753:	57                   	push   %edi
+ 754:	56                   	push   %esi
+ 755:	53                   	push   %ebx
+ 756:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 759:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 75c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 75f:	0f b6 1e             	movzbl (%esi),%ebx
+ 762:	83 c6 01             	add    $0x1,%esi
+ 765:	84 db                	test   %bl,%bl
+ 767:	74 67                	je     7d0 <printf+0x80>
+ 769:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 76c:	31 d2                	xor    %edx,%edx
+ 76e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 771:	eb 34                	jmp    7a7 <printf+0x57>
+ 773:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 777:	90                   	nop
+ 778:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 77b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 780:	83 f8 25             	cmp    $0x25,%eax
+ 783:	74 18                	je     79d <printf+0x4d>
+  write(fd, &c, 1);
+ 785:	83 ec 04             	sub    $0x4,%esp
+ 788:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 78b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 78e:	6a 01                	push   $0x1
+ 790:	50                   	push   %eax
+ 791:	57                   	push   %edi
+ 792:	e8 0d fe ff ff       	call   5a4 <write>
+ 797:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 79a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 79d:	0f b6 1e             	movzbl (%esi),%ebx
+ 7a0:	83 c6 01             	add    $0x1,%esi
+ 7a3:	84 db                	test   %bl,%bl
+ 7a5:	74 29                	je     7d0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 7a7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 7aa:	85 d2                	test   %edx,%edx
+ 7ac:	74 ca                	je     778 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 7ae:	83 fa 25             	cmp    $0x25,%edx
+ 7b1:	75 ea                	jne    79d <printf+0x4d>
+      if(c == 'd'){
+ 7b3:	83 f8 25             	cmp    $0x25,%eax
+ 7b6:	0f 84 24 01 00 00    	je     8e0 <printf+0x190>
+ 7bc:	83 e8 63             	sub    $0x63,%eax
+ 7bf:	83 f8 15             	cmp    $0x15,%eax
+ 7c2:	77 1c                	ja     7e0 <printf+0x90>
+ 7c4:	ff 24 85 cc 0a 00 00 	jmp    *0xacc(,%eax,4)
+ 7cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7cf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 7d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7d3:	5b                   	pop    %ebx
+ 7d4:	5e                   	pop    %esi
+ 7d5:	5f                   	pop    %edi
+ 7d6:	5d                   	pop    %ebp
+ 7d7:	c3                   	ret
+ 7d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7df:	90                   	nop
+  write(fd, &c, 1);
+ 7e0:	83 ec 04             	sub    $0x4,%esp
+ 7e3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7e6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 7ea:	6a 01                	push   $0x1
+ 7ec:	52                   	push   %edx
+ 7ed:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 7f0:	57                   	push   %edi
+ 7f1:	e8 ae fd ff ff       	call   5a4 <write>
+ 7f6:	83 c4 0c             	add    $0xc,%esp
+ 7f9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7fc:	6a 01                	push   $0x1
+ 7fe:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 801:	52                   	push   %edx
+ 802:	57                   	push   %edi
+ 803:	e8 9c fd ff ff       	call   5a4 <write>
+        putc(fd, c);
+ 808:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 80b:	31 d2                	xor    %edx,%edx
+ 80d:	eb 8e                	jmp    79d <printf+0x4d>
+ 80f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 810:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 813:	83 ec 0c             	sub    $0xc,%esp
+ 816:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 81b:	8b 13                	mov    (%ebx),%edx
+ 81d:	6a 00                	push   $0x0
+ 81f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 821:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 824:	e8 87 fe ff ff       	call   6b0 <printint>
+        ap++;
+ 829:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 82c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 82f:	31 d2                	xor    %edx,%edx
+ 831:	e9 67 ff ff ff       	jmp    79d <printf+0x4d>
+ 836:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 83d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 840:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 843:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 845:	83 c0 04             	add    $0x4,%eax
+ 848:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 84b:	85 db                	test   %ebx,%ebx
+ 84d:	0f 84 9d 00 00 00    	je     8f0 <printf+0x1a0>
+        while(*s != 0){
+ 853:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 856:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 858:	84 c0                	test   %al,%al
+ 85a:	0f 84 3d ff ff ff    	je     79d <printf+0x4d>
+ 860:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 863:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 866:	89 de                	mov    %ebx,%esi
+ 868:	89 d3                	mov    %edx,%ebx
+ 86a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 870:	83 ec 04             	sub    $0x4,%esp
+ 873:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 876:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 879:	6a 01                	push   $0x1
+ 87b:	53                   	push   %ebx
+ 87c:	57                   	push   %edi
+ 87d:	e8 22 fd ff ff       	call   5a4 <write>
+        while(*s != 0){
+ 882:	0f b6 06             	movzbl (%esi),%eax
+ 885:	83 c4 10             	add    $0x10,%esp
+ 888:	84 c0                	test   %al,%al
+ 88a:	75 e4                	jne    870 <printf+0x120>
+      state = 0;
+ 88c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 88f:	31 d2                	xor    %edx,%edx
+ 891:	e9 07 ff ff ff       	jmp    79d <printf+0x4d>
+ 896:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 8a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8a3:	83 ec 0c             	sub    $0xc,%esp
+ 8a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 8ab:	8b 13                	mov    (%ebx),%edx
+ 8ad:	6a 01                	push   $0x1
+ 8af:	e9 6b ff ff ff       	jmp    81f <printf+0xcf>
+ 8b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 8b8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 8bb:	83 ec 04             	sub    $0x4,%esp
+ 8be:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 8c1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 8c3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 8c6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 8c9:	6a 01                	push   $0x1
+ 8cb:	52                   	push   %edx
+ 8cc:	57                   	push   %edi
+ 8cd:	e8 d2 fc ff ff       	call   5a4 <write>
+        ap++;
+ 8d2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8d5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8d8:	31 d2                	xor    %edx,%edx
+ 8da:	e9 be fe ff ff       	jmp    79d <printf+0x4d>
+ 8df:	90                   	nop
+  write(fd, &c, 1);
+ 8e0:	83 ec 04             	sub    $0x4,%esp
+ 8e3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8e6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8e9:	6a 01                	push   $0x1
+ 8eb:	e9 11 ff ff ff       	jmp    801 <printf+0xb1>
+ 8f0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 8f5:	bb c2 0a 00 00       	mov    $0xac2,%ebx
+ 8fa:	e9 61 ff ff ff       	jmp    860 <printf+0x110>
+ 8ff:	90                   	nop
+
+00000900 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 900:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 901:	a1 58 0e 00 00       	mov    0xe58,%eax
+{
+ 906:	89 e5                	mov    %esp,%ebp
+ 908:	57                   	push   %edi
+ 909:	56                   	push   %esi
+ 90a:	53                   	push   %ebx
+ 90b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 90e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 911:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 918:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 91a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 91c:	39 ca                	cmp    %ecx,%edx
+ 91e:	73 30                	jae    950 <free+0x50>
+ 920:	39 c1                	cmp    %eax,%ecx
+ 922:	72 04                	jb     928 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 924:	39 c2                	cmp    %eax,%edx
+ 926:	72 f0                	jb     918 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 928:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 92b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 92e:	39 f8                	cmp    %edi,%eax
+ 930:	74 2e                	je     960 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 932:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 935:	8b 42 04             	mov    0x4(%edx),%eax
+ 938:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 93b:	39 f1                	cmp    %esi,%ecx
+ 93d:	74 38                	je     977 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 93f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 941:	5b                   	pop    %ebx
+  freep = p;
+ 942:	89 15 58 0e 00 00    	mov    %edx,0xe58
+}
+ 948:	5e                   	pop    %esi
+ 949:	5f                   	pop    %edi
+ 94a:	5d                   	pop    %ebp
+ 94b:	c3                   	ret
+ 94c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 950:	39 c1                	cmp    %eax,%ecx
+ 952:	72 d0                	jb     924 <free+0x24>
+ 954:	eb c2                	jmp    918 <free+0x18>
+ 956:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 95d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 960:	03 70 04             	add    0x4(%eax),%esi
+ 963:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 966:	8b 02                	mov    (%edx),%eax
+ 968:	8b 00                	mov    (%eax),%eax
+ 96a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 96d:	8b 42 04             	mov    0x4(%edx),%eax
+ 970:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 973:	39 f1                	cmp    %esi,%ecx
+ 975:	75 c8                	jne    93f <free+0x3f>
+    p->s.size += bp->s.size;
+ 977:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 97a:	89 15 58 0e 00 00    	mov    %edx,0xe58
+    p->s.size += bp->s.size;
+ 980:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 983:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 986:	89 0a                	mov    %ecx,(%edx)
+}
+ 988:	5b                   	pop    %ebx
+ 989:	5e                   	pop    %esi
+ 98a:	5f                   	pop    %edi
+ 98b:	5d                   	pop    %ebp
+ 98c:	c3                   	ret
+ 98d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000990 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 990:	55                   	push   %ebp
+ 991:	89 e5                	mov    %esp,%ebp
+ 993:	57                   	push   %edi
+ 994:	56                   	push   %esi
+ 995:	53                   	push   %ebx
+ 996:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 999:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 99c:	8b 15 58 0e 00 00    	mov    0xe58,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9a2:	8d 78 07             	lea    0x7(%eax),%edi
+ 9a5:	c1 ef 03             	shr    $0x3,%edi
+ 9a8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 9ab:	85 d2                	test   %edx,%edx
+ 9ad:	0f 84 8d 00 00 00    	je     a40 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9b3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9b5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9b8:	39 f9                	cmp    %edi,%ecx
+ 9ba:	73 64                	jae    a20 <malloc+0x90>
+  if(nu < 4096)
+ 9bc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 9c1:	39 df                	cmp    %ebx,%edi
+ 9c3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 9c6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 9cd:	eb 0a                	jmp    9d9 <malloc+0x49>
+ 9cf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9d0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9d2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9d5:	39 f9                	cmp    %edi,%ecx
+ 9d7:	73 47                	jae    a20 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 9d9:	89 c2                	mov    %eax,%edx
+ 9db:	39 05 58 0e 00 00    	cmp    %eax,0xe58
+ 9e1:	75 ed                	jne    9d0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 9e3:	83 ec 0c             	sub    $0xc,%esp
+ 9e6:	56                   	push   %esi
+ 9e7:	e8 20 fc ff ff       	call   60c <sbrk>
+  if(p == (char*)-1)
+ 9ec:	83 c4 10             	add    $0x10,%esp
+ 9ef:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 9f2:	74 1c                	je     a10 <malloc+0x80>
+  hp->s.size = nu;
+ 9f4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 9f7:	83 ec 0c             	sub    $0xc,%esp
+ 9fa:	83 c0 08             	add    $0x8,%eax
+ 9fd:	50                   	push   %eax
+ 9fe:	e8 fd fe ff ff       	call   900 <free>
+  return freep;
+ a03:	8b 15 58 0e 00 00    	mov    0xe58,%edx
+      if((p = morecore(nunits)) == 0)
+ a09:	83 c4 10             	add    $0x10,%esp
+ a0c:	85 d2                	test   %edx,%edx
+ a0e:	75 c0                	jne    9d0 <malloc+0x40>
+        return 0;
+  }
+}
+ a10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a13:	31 c0                	xor    %eax,%eax
+}
+ a15:	5b                   	pop    %ebx
+ a16:	5e                   	pop    %esi
+ a17:	5f                   	pop    %edi
+ a18:	5d                   	pop    %ebp
+ a19:	c3                   	ret
+ a1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ a20:	39 cf                	cmp    %ecx,%edi
+ a22:	74 4c                	je     a70 <malloc+0xe0>
+        p->s.size -= nunits;
+ a24:	29 f9                	sub    %edi,%ecx
+ a26:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ a29:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ a2c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ a2f:	89 15 58 0e 00 00    	mov    %edx,0xe58
+}
+ a35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ a38:	83 c0 08             	add    $0x8,%eax
+}
+ a3b:	5b                   	pop    %ebx
+ a3c:	5e                   	pop    %esi
+ a3d:	5f                   	pop    %edi
+ a3e:	5d                   	pop    %ebp
+ a3f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ a40:	c7 05 58 0e 00 00 5c 	movl   $0xe5c,0xe58
+ a47:	0e 00 00 
+    base.s.size = 0;
+ a4a:	b8 5c 0e 00 00       	mov    $0xe5c,%eax
+    base.s.ptr = freep = prevp = &base;
+ a4f:	c7 05 5c 0e 00 00 5c 	movl   $0xe5c,0xe5c
+ a56:	0e 00 00 
+    base.s.size = 0;
+ a59:	c7 05 60 0e 00 00 00 	movl   $0x0,0xe60
+ a60:	00 00 00 
+    if(p->s.size >= nunits){
+ a63:	e9 54 ff ff ff       	jmp    9bc <malloc+0x2c>
+ a68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a6f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a70:	8b 08                	mov    (%eax),%ecx
+ a72:	89 0a                	mov    %ecx,(%edx)
+ a74:	eb b9                	jmp    a2f <malloc+0x9f>
@@ -28,14 +28,21 @@ main(void)
   consoleinit();   // console hardware
   uartinit();      // serial port
   pinit();         // process table
+  mminit();        // address spaces
   tvinit();        // trap vectors
-  binit();         // buffer cache
   fileinit();      // file table
+  pcacheinit();    // page cache
+  dcacheinit();    // directory entry cache
+  shminit();       // shared-memory segments
   ideinit();       // disk 
   startothers();   // start other processors
   kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+  binit();         // buffer cache, sized by free memory
+  rcuinit();       // read-copy update
+  nicinit();       // network devices
   pciinit();       // pci devices
   userinit();      // first user process
+  rcustart();      // rcu callback thread
   mpmain();        // finish this processor's setup
 }
 
@@ -32,6 +32,13 @@ ideintr(void)
   // no-op
 }
 
+// No DMA for a disk in memory.
+int
+idedmainit(uint base)
+{
+  return -1;
+}
+
 // Sync buf with disk.
 // If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
 // Else if B_VALID is not set, read buf from disk, set B_VALID.
@@ -57,4 +64,8 @@ iderw(struct buf *b)
   } else
     memmove(b->data, p, BSIZE);
   b->flags |= B_VALID;
+  if(b->flags & B_ASYNC){
+    b->flags &= ~B_ASYNC;
+    brelse(b);
+  }
 }
@@ -0,0 +1,1245 @@
+
+_mkdir:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	bf 01 00 00 00       	mov    $0x1,%edi
+  13:	56                   	push   %esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1c:	8b 31                	mov    (%ecx),%esi
+  1e:	83 c3 04             	add    $0x4,%ebx
+  int i;
+
+  if(argc < 2){
+  21:	83 fe 01             	cmp    $0x1,%esi
+  24:	7f 14                	jg     3a <main+0x3a>
+  26:	eb 3a                	jmp    62 <main+0x62>
+  28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+    printf(2, "Usage: mkdir files...\n");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  30:	83 c7 01             	add    $0x1,%edi
+  33:	83 c3 04             	add    $0x4,%ebx
+  36:	39 fe                	cmp    %edi,%esi
+  38:	74 23                	je     5d <main+0x5d>
+    if(mkdir(argv[i]) < 0){
+  3a:	83 ec 0c             	sub    $0xc,%esp
+  3d:	ff 33                	push   (%ebx)
+  3f:	e8 e8 02 00 00       	call   32c <mkdir>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	85 c0                	test   %eax,%eax
+  49:	79 e5                	jns    30 <main+0x30>
+      printf(2, "mkdir: %s failed to create\n", argv[i]);
+  4b:	50                   	push   %eax
+  4c:	ff 33                	push   (%ebx)
+  4e:	68 cf 07 00 00       	push   $0x7cf
+  53:	6a 02                	push   $0x2
+  55:	e8 36 04 00 00       	call   490 <printf>
+      break;
+  5a:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+
+  exit();
+  5d:	e8 62 02 00 00       	call   2c4 <exit>
+    printf(2, "Usage: mkdir files...\n");
+  62:	52                   	push   %edx
+  63:	52                   	push   %edx
+  64:	68 b8 07 00 00       	push   $0x7b8
+  69:	6a 02                	push   $0x2
+  6b:	e8 20 04 00 00       	call   490 <printf>
+    exit();
+  70:	e8 4f 02 00 00       	call   2c4 <exit>
+  75:	66 90                	xchg   %ax,%ax
+  77:	66 90                	xchg   %ax,%ax
+  79:	66 90                	xchg   %ax,%ax
+  7b:	66 90                	xchg   %ax,%ax
+  7d:	66 90                	xchg   %ax,%ax
+  7f:	90                   	nop
+
+00000080 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  80:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  81:	31 c0                	xor    %eax,%eax
+{
+  83:	89 e5                	mov    %esp,%ebp
+  85:	53                   	push   %ebx
+  86:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  89:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  90:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  94:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  97:	83 c0 01             	add    $0x1,%eax
+  9a:	84 d2                	test   %dl,%dl
+  9c:	75 f2                	jne    90 <strcpy+0x10>
+    ;
+  return os;
+}
+  9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  a1:	89 c8                	mov    %ecx,%eax
+  a3:	c9                   	leave
+  a4:	c3                   	ret
+  a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000b0 <strlen>:
+
+uint
+strlen(char *s)
+{
+  b0:	55                   	push   %ebp
+  b1:	89 e5                	mov    %esp,%ebp
+  b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  b6:	80 3a 00             	cmpb   $0x0,(%edx)
+  b9:	74 15                	je     d0 <strlen+0x20>
+  bb:	31 c0                	xor    %eax,%eax
+  bd:	8d 76 00             	lea    0x0(%esi),%esi
+  c0:	83 c0 01             	add    $0x1,%eax
+  c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  c7:	89 c1                	mov    %eax,%ecx
+  c9:	75 f5                	jne    c0 <strlen+0x10>
+    ;
+  return n;
+}
+  cb:	89 c8                	mov    %ecx,%eax
+  cd:	5d                   	pop    %ebp
+  ce:	c3                   	ret
+  cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+  d0:	31 c9                	xor    %ecx,%ecx
+}
+  d2:	5d                   	pop    %ebp
+  d3:	89 c8                	mov    %ecx,%eax
+  d5:	c3                   	ret
+  d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000000e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  e0:	55                   	push   %ebp
+  e1:	89 e5                	mov    %esp,%ebp
+  e3:	57                   	push   %edi
+  e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+  ed:	89 d7                	mov    %edx,%edi
+  ef:	fc                   	cld
+  f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  f5:	89 d0                	mov    %edx,%eax
+  f7:	c9                   	leave
+  f8:	c3                   	ret
+  f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000100 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	8b 45 08             	mov    0x8(%ebp),%eax
+ 106:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 10a:	0f b6 10             	movzbl (%eax),%edx
+ 10d:	84 d2                	test   %dl,%dl
+ 10f:	75 12                	jne    123 <strchr+0x23>
+ 111:	eb 1d                	jmp    130 <strchr+0x30>
+ 113:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 117:	90                   	nop
+ 118:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 11c:	83 c0 01             	add    $0x1,%eax
+ 11f:	84 d2                	test   %dl,%dl
+ 121:	74 0d                	je     130 <strchr+0x30>
+    if(*s == c)
+ 123:	38 d1                	cmp    %dl,%cl
+ 125:	75 f1                	jne    118 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 127:	5d                   	pop    %ebp
+ 128:	c3                   	ret
+ 129:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 130:	31 c0                	xor    %eax,%eax
+}
+ 132:	5d                   	pop    %ebp
+ 133:	c3                   	ret
+ 134:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 13f:	90                   	nop
+
+00000140 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	57                   	push   %edi
+ 144:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 145:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 148:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 149:	31 db                	xor    %ebx,%ebx
+{
+ 14b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 14e:	eb 27                	jmp    177 <gets+0x37>
+    cc = read(0, &c, 1);
+ 150:	83 ec 04             	sub    $0x4,%esp
+ 153:	6a 01                	push   $0x1
+ 155:	56                   	push   %esi
+ 156:	6a 00                	push   $0x0
+ 158:	e8 7f 01 00 00       	call   2dc <read>
+    if(cc < 1)
+ 15d:	83 c4 10             	add    $0x10,%esp
+ 160:	85 c0                	test   %eax,%eax
+ 162:	7e 1d                	jle    181 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 164:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 168:	8b 55 08             	mov    0x8(%ebp),%edx
+ 16b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 16f:	3c 0a                	cmp    $0xa,%al
+ 171:	74 10                	je     183 <gets+0x43>
+ 173:	3c 0d                	cmp    $0xd,%al
+ 175:	74 0c                	je     183 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 177:	89 df                	mov    %ebx,%edi
+ 179:	83 c3 01             	add    $0x1,%ebx
+ 17c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 17f:	7c cf                	jl     150 <gets+0x10>
+ 181:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 183:	8b 45 08             	mov    0x8(%ebp),%eax
+ 186:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 18a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 18d:	5b                   	pop    %ebx
+ 18e:	5e                   	pop    %esi
+ 18f:	5f                   	pop    %edi
+ 190:	5d                   	pop    %ebp
+ 191:	c3                   	ret
+ 192:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 199:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001a0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	56                   	push   %esi
+ 1a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1a5:	83 ec 08             	sub    $0x8,%esp
+ 1a8:	6a 00                	push   $0x0
+ 1aa:	ff 75 08             	push   0x8(%ebp)
+ 1ad:	e8 52 01 00 00       	call   304 <open>
+  if(fd < 0)
+ 1b2:	83 c4 10             	add    $0x10,%esp
+ 1b5:	85 c0                	test   %eax,%eax
+ 1b7:	78 27                	js     1e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1b9:	83 ec 08             	sub    $0x8,%esp
+ 1bc:	ff 75 0c             	push   0xc(%ebp)
+ 1bf:	89 c3                	mov    %eax,%ebx
+ 1c1:	50                   	push   %eax
+ 1c2:	e8 55 01 00 00       	call   31c <fstat>
+  close(fd);
+ 1c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 1ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1cc:	e8 1b 01 00 00       	call   2ec <close>
+  return r;
+ 1d1:	83 c4 10             	add    $0x10,%esp
+}
+ 1d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1d7:	89 f0                	mov    %esi,%eax
+ 1d9:	5b                   	pop    %ebx
+ 1da:	5e                   	pop    %esi
+ 1db:	5d                   	pop    %ebp
+ 1dc:	c3                   	ret
+ 1dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 1e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1e5:	eb ed                	jmp    1d4 <stat+0x34>
+ 1e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ee:	66 90                	xchg   %ax,%ax
+
+000001f0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	57                   	push   %edi
+ 1f4:	56                   	push   %esi
+ 1f5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 1fe:	85 c0                	test   %eax,%eax
+ 200:	7e 13                	jle    215 <memmove+0x25>
+ 202:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 204:	89 d7                	mov    %edx,%edi
+ 206:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 210:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 211:	39 f8                	cmp    %edi,%eax
+ 213:	75 fb                	jne    210 <memmove+0x20>
+  return vdst;
+}
+ 215:	5e                   	pop    %esi
+ 216:	89 d0                	mov    %edx,%eax
+ 218:	5f                   	pop    %edi
+ 219:	5d                   	pop    %ebp
+ 21a:	c3                   	ret
+ 21b:	66 90                	xchg   %ax,%ax
+ 21d:	66 90                	xchg   %ax,%ax
+ 21f:	90                   	nop
+
+00000220 <strcmp>:
+#include "types.h"
+#include "util.h"
+
+int
+strcmp(const char *p, const char *q)
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	53                   	push   %ebx
+ 224:	8b 55 08             	mov    0x8(%ebp),%edx
+ 227:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 22a:	0f b6 02             	movzbl (%edx),%eax
+ 22d:	84 c0                	test   %al,%al
+ 22f:	75 17                	jne    248 <strcmp+0x28>
+ 231:	eb 3a                	jmp    26d <strcmp+0x4d>
+ 233:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 237:	90                   	nop
+ 238:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 23c:	83 c2 01             	add    $0x1,%edx
+ 23f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 242:	84 c0                	test   %al,%al
+ 244:	74 1a                	je     260 <strcmp+0x40>
+    p++, q++;
+ 246:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 248:	0f b6 19             	movzbl (%ecx),%ebx
+ 24b:	38 c3                	cmp    %al,%bl
+ 24d:	74 e9                	je     238 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 24f:	29 d8                	sub    %ebx,%eax
+}
+ 251:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 254:	c9                   	leave
+ 255:	c3                   	ret
+ 256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 260:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 264:	31 c0                	xor    %eax,%eax
+ 266:	29 d8                	sub    %ebx,%eax
+}
+ 268:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 26b:	c9                   	leave
+ 26c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 26d:	0f b6 19             	movzbl (%ecx),%ebx
+ 270:	31 c0                	xor    %eax,%eax
+ 272:	eb db                	jmp    24f <strcmp+0x2f>
+ 274:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 27f:	90                   	nop
+
+00000280 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	53                   	push   %ebx
+ 284:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 287:	0f be 02             	movsbl (%edx),%eax
+ 28a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 28d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 290:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 295:	77 1e                	ja     2b5 <atoi+0x35>
+ 297:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 2a0:	83 c2 01             	add    $0x1,%edx
+ 2a3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 2a6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 2aa:	0f be 02             	movsbl (%edx),%eax
+ 2ad:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2b0:	80 fb 09             	cmp    $0x9,%bl
+ 2b3:	76 eb                	jbe    2a0 <atoi+0x20>
+  return n;
+ 2b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2b8:	89 c8                	mov    %ecx,%eax
+ 2ba:	c9                   	leave
+ 2bb:	c3                   	ret
+
+000002bc <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2bc:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2c1:	cd 40                	int    $0x40
+ 2c3:	c3                   	ret
+
+000002c4 <exit>:
+SYSCALL(exit)
+ 2c4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2c9:	cd 40                	int    $0x40
+ 2cb:	c3                   	ret
+
+000002cc <wait>:
+SYSCALL(wait)
+ 2cc:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2d1:	cd 40                	int    $0x40
+ 2d3:	c3                   	ret
+
+000002d4 <pipe>:
+SYSCALL(pipe)
+ 2d4:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2d9:	cd 40                	int    $0x40
+ 2db:	c3                   	ret
+
+000002dc <read>:
+SYSCALL(read)
+ 2dc:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2e1:	cd 40                	int    $0x40
+ 2e3:	c3                   	ret
+
+000002e4 <write>:
+SYSCALL(write)
+ 2e4:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2e9:	cd 40                	int    $0x40
+ 2eb:	c3                   	ret
+
+000002ec <close>:
+SYSCALL(close)
+ 2ec:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2f1:	cd 40                	int    $0x40
+ 2f3:	c3                   	ret
+
+000002f4 <kill>:
+SYSCALL(kill)
+ 2f4:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2f9:	cd 40                	int    $0x40
+ 2fb:	c3                   	ret
+
+000002fc <exec>:
+SYSCALL(exec)
+ 2fc:	b8 07 00 00 00       	mov    $0x7,%eax
+ 301:	cd 40                	int    $0x40
+ 303:	c3                   	ret
+
+00000304 <open>:
+SYSCALL(open)
+ 304:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 309:	cd 40                	int    $0x40
+ 30b:	c3                   	ret
+
+0000030c <mknod>:
+SYSCALL(mknod)
+ 30c:	b8 11 00 00 00       	mov    $0x11,%eax
+ 311:	cd 40                	int    $0x40
+ 313:	c3                   	ret
+
+00000314 <unlink>:
+SYSCALL(unlink)
+ 314:	b8 12 00 00 00       	mov    $0x12,%eax
+ 319:	cd 40                	int    $0x40
+ 31b:	c3                   	ret
+
+0000031c <fstat>:
+SYSCALL(fstat)
+ 31c:	b8 08 00 00 00       	mov    $0x8,%eax
+ 321:	cd 40                	int    $0x40
+ 323:	c3                   	ret
+
+00000324 <link>:
+SYSCALL(link)
+ 324:	b8 13 00 00 00       	mov    $0x13,%eax
+ 329:	cd 40                	int    $0x40
+ 32b:	c3                   	ret
+
+0000032c <mkdir>:
+SYSCALL(mkdir)
+ 32c:	b8 14 00 00 00       	mov    $0x14,%eax
+ 331:	cd 40                	int    $0x40
+ 333:	c3                   	ret
+
+00000334 <chdir>:
+SYSCALL(chdir)
+ 334:	b8 09 00 00 00       	mov    $0x9,%eax
+ 339:	cd 40                	int    $0x40
+ 33b:	c3                   	ret
+
+0000033c <dup>:
+SYSCALL(dup)
+ 33c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 341:	cd 40                	int    $0x40
+ 343:	c3                   	ret
+
+00000344 <getpid>:
+SYSCALL(getpid)
+ 344:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 349:	cd 40                	int    $0x40
+ 34b:	c3                   	ret
+
+0000034c <sbrk>:
+SYSCALL(sbrk)
+ 34c:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 351:	cd 40                	int    $0x40
+ 353:	c3                   	ret
+
+00000354 <sleep>:
+SYSCALL(sleep)
+ 354:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 359:	cd 40                	int    $0x40
+ 35b:	c3                   	ret
+
+0000035c <uptime>:
+SYSCALL(uptime)
+ 35c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 361:	cd 40                	int    $0x40
+ 363:	c3                   	ret
+
+00000364 <arp>:
+SYSCALL(arp)
+ 364:	b8 16 00 00 00       	mov    $0x16,%eax
+ 369:	cd 40                	int    $0x40
+ 36b:	c3                   	ret
+
+0000036c <mmap>:
+SYSCALL(mmap)
+ 36c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 371:	cd 40                	int    $0x40
+ 373:	c3                   	ret
+
+00000374 <munmap>:
+SYSCALL(munmap)
+ 374:	b8 18 00 00 00       	mov    $0x18,%eax
+ 379:	cd 40                	int    $0x40
+ 37b:	c3                   	ret
+
+0000037c <msync>:
+SYSCALL(msync)
+ 37c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 381:	cd 40                	int    $0x40
+ 383:	c3                   	ret
+
+00000384 <shmcreate>:
+SYSCALL(shmcreate)
+ 384:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 389:	cd 40                	int    $0x40
+ 38b:	c3                   	ret
+
+0000038c <shmattach>:
+SYSCALL(shmattach)
+ 38c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 391:	cd 40                	int    $0x40
+ 393:	c3                   	ret
+
+00000394 <shmdetach>:
+SYSCALL(shmdetach)
+ 394:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 399:	cd 40                	int    $0x40
+ 39b:	c3                   	ret
+
+0000039c <futex_wait>:
+SYSCALL(futex_wait)
+ 39c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3a1:	cd 40                	int    $0x40
+ 3a3:	c3                   	ret
+
+000003a4 <futex_wake>:
+SYSCALL(futex_wake)
+ 3a4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3a9:	cd 40                	int    $0x40
+ 3ab:	c3                   	ret
+
+000003ac <nice>:
+SYSCALL(nice)
+ 3ac:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3b1:	cd 40                	int    $0x40
+ 3b3:	c3                   	ret
+
+000003b4 <setpriority>:
+SYSCALL(setpriority)
+ 3b4:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3b9:	cd 40                	int    $0x40
+ 3bb:	c3                   	ret
+
+000003bc <cputime>:
+SYSCALL(cputime)
+ 3bc:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3c1:	cd 40                	int    $0x40
+ 3c3:	c3                   	ret
+
+000003c4 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 3c4:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3c9:	cd 40                	int    $0x40
+ 3cb:	c3                   	ret
+
+000003cc <clone>:
+SYSCALL(clone)
+ 3cc:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3d1:	cd 40                	int    $0x40
+ 3d3:	c3                   	ret
+
+000003d4 <join>:
+SYSCALL(join)
+ 3d4:	b8 24 00 00 00       	mov    $0x24,%eax
+ 3d9:	cd 40                	int    $0x40
+ 3db:	c3                   	ret
+
+000003dc <lockstat>:
+SYSCALL(lockstat)
+ 3dc:	b8 25 00 00 00       	mov    $0x25,%eax
+ 3e1:	cd 40                	int    $0x40
+ 3e3:	c3                   	ret
+ 3e4:	66 90                	xchg   %ax,%ax
+ 3e6:	66 90                	xchg   %ax,%ax
+ 3e8:	66 90                	xchg   %ax,%ax
+ 3ea:	66 90                	xchg   %ax,%ax
+ 3ec:	66 90                	xchg   %ax,%ax
+ 3ee:	66 90                	xchg   %ax,%ax
+
+000003f0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	57                   	push   %edi
+ 3f4:	56                   	push   %esi
+ 3f5:	53                   	push   %ebx
+ 3f6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 3f8:	89 d1                	mov    %edx,%ecx
+{
+ 3fa:	83 ec 3c             	sub    $0x3c,%esp
+ 3fd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 400:	85 d2                	test   %edx,%edx
+ 402:	0f 89 80 00 00 00    	jns    488 <printint+0x98>
+ 408:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 40c:	74 7a                	je     488 <printint+0x98>
+    x = -xx;
+ 40e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 410:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 415:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 418:	31 f6                	xor    %esi,%esi
+ 41a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 420:	89 c8                	mov    %ecx,%eax
+ 422:	31 d2                	xor    %edx,%edx
+ 424:	89 f7                	mov    %esi,%edi
+ 426:	f7 f3                	div    %ebx
+ 428:	8d 76 01             	lea    0x1(%esi),%esi
+ 42b:	0f b6 92 4c 08 00 00 	movzbl 0x84c(%edx),%edx
+ 432:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 436:	89 ca                	mov    %ecx,%edx
+ 438:	89 c1                	mov    %eax,%ecx
+ 43a:	39 da                	cmp    %ebx,%edx
+ 43c:	73 e2                	jae    420 <printint+0x30>
+  if(neg)
+ 43e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 441:	85 c0                	test   %eax,%eax
+ 443:	74 07                	je     44c <printint+0x5c>
+    buf[i++] = '-';
+ 445:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 44a:	89 f7                	mov    %esi,%edi
+ 44c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 44f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 452:	01 df                	add    %ebx,%edi
+ 454:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 458:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 45b:	83 ec 04             	sub    $0x4,%esp
+ 45e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 461:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 464:	6a 01                	push   $0x1
+ 466:	50                   	push   %eax
+ 467:	56                   	push   %esi
+ 468:	e8 77 fe ff ff       	call   2e4 <write>
+  while(--i >= 0)
+ 46d:	89 f8                	mov    %edi,%eax
+ 46f:	83 c4 10             	add    $0x10,%esp
+ 472:	83 ef 01             	sub    $0x1,%edi
+ 475:	39 d8                	cmp    %ebx,%eax
+ 477:	75 df                	jne    458 <printint+0x68>
+}
+ 479:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 47c:	5b                   	pop    %ebx
+ 47d:	5e                   	pop    %esi
+ 47e:	5f                   	pop    %edi
+ 47f:	5d                   	pop    %ebp
+ 480:	c3                   	ret
+ 481:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 488:	31 c0                	xor    %eax,%eax
+ 48a:	eb 89                	jmp    415 <printint+0x25>
+ 48c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	56                   	push   %esi
+ 495:	53                   	push   %ebx
+ 496:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 499:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 49c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 49f:	0f b6 1e             	movzbl (%esi),%ebx
+ 4a2:	83 c6 01             	add    $0x1,%esi
+ 4a5:	84 db                	test   %bl,%bl
+ 4a7:	74 67                	je     510 <printf+0x80>
+ 4a9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 4ac:	31 d2                	xor    %edx,%edx
+ 4ae:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 4b1:	eb 34                	jmp    4e7 <printf+0x57>
+ 4b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4b7:	90                   	nop
+ 4b8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 4bb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 4c0:	83 f8 25             	cmp    $0x25,%eax
+ 4c3:	74 18                	je     4dd <printf+0x4d>
+  write(fd, &c, 1);
+ 4c5:	83 ec 04             	sub    $0x4,%esp
+ 4c8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 4cb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 4ce:	6a 01                	push   $0x1
+ 4d0:	50                   	push   %eax
+ 4d1:	57                   	push   %edi
+ 4d2:	e8 0d fe ff ff       	call   2e4 <write>
+ 4d7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 4da:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 4dd:	0f b6 1e             	movzbl (%esi),%ebx
+ 4e0:	83 c6 01             	add    $0x1,%esi
+ 4e3:	84 db                	test   %bl,%bl
+ 4e5:	74 29                	je     510 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 4e7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 4ea:	85 d2                	test   %edx,%edx
+ 4ec:	74 ca                	je     4b8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 4ee:	83 fa 25             	cmp    $0x25,%edx
+ 4f1:	75 ea                	jne    4dd <printf+0x4d>
+      if(c == 'd'){
+ 4f3:	83 f8 25             	cmp    $0x25,%eax
+ 4f6:	0f 84 24 01 00 00    	je     620 <printf+0x190>
+ 4fc:	83 e8 63             	sub    $0x63,%eax
+ 4ff:	83 f8 15             	cmp    $0x15,%eax
+ 502:	77 1c                	ja     520 <printf+0x90>
+ 504:	ff 24 85 f4 07 00 00 	jmp    *0x7f4(,%eax,4)
+ 50b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 50f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 510:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 513:	5b                   	pop    %ebx
+ 514:	5e                   	pop    %esi
+ 515:	5f                   	pop    %edi
+ 516:	5d                   	pop    %ebp
+ 517:	c3                   	ret
+ 518:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 51f:	90                   	nop
+  write(fd, &c, 1);
+ 520:	83 ec 04             	sub    $0x4,%esp
+ 523:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 526:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 52a:	6a 01                	push   $0x1
+ 52c:	52                   	push   %edx
+ 52d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 530:	57                   	push   %edi
+ 531:	e8 ae fd ff ff       	call   2e4 <write>
+ 536:	83 c4 0c             	add    $0xc,%esp
+ 539:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 53c:	6a 01                	push   $0x1
+ 53e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 541:	52                   	push   %edx
+ 542:	57                   	push   %edi
+ 543:	e8 9c fd ff ff       	call   2e4 <write>
+        putc(fd, c);
+ 548:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 54b:	31 d2                	xor    %edx,%edx
+ 54d:	eb 8e                	jmp    4dd <printf+0x4d>
+ 54f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 550:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 553:	83 ec 0c             	sub    $0xc,%esp
+ 556:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 55b:	8b 13                	mov    (%ebx),%edx
+ 55d:	6a 00                	push   $0x0
+ 55f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 561:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 564:	e8 87 fe ff ff       	call   3f0 <printint>
+        ap++;
+ 569:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 56c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 56f:	31 d2                	xor    %edx,%edx
+ 571:	e9 67 ff ff ff       	jmp    4dd <printf+0x4d>
+ 576:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 57d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 580:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 583:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 585:	83 c0 04             	add    $0x4,%eax
+ 588:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 58b:	85 db                	test   %ebx,%ebx
+ 58d:	0f 84 9d 00 00 00    	je     630 <printf+0x1a0>
+        while(*s != 0){
+ 593:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 596:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 598:	84 c0                	test   %al,%al
+ 59a:	0f 84 3d ff ff ff    	je     4dd <printf+0x4d>
+ 5a0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5a3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 5a6:	89 de                	mov    %ebx,%esi
+ 5a8:	89 d3                	mov    %edx,%ebx
+ 5aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 5b0:	83 ec 04             	sub    $0x4,%esp
+ 5b3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 5b6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 5b9:	6a 01                	push   $0x1
+ 5bb:	53                   	push   %ebx
+ 5bc:	57                   	push   %edi
+ 5bd:	e8 22 fd ff ff       	call   2e4 <write>
+        while(*s != 0){
+ 5c2:	0f b6 06             	movzbl (%esi),%eax
+ 5c5:	83 c4 10             	add    $0x10,%esp
+ 5c8:	84 c0                	test   %al,%al
+ 5ca:	75 e4                	jne    5b0 <printf+0x120>
+      state = 0;
+ 5cc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 5cf:	31 d2                	xor    %edx,%edx
+ 5d1:	e9 07 ff ff ff       	jmp    4dd <printf+0x4d>
+ 5d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5dd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 5e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5e3:	83 ec 0c             	sub    $0xc,%esp
+ 5e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5eb:	8b 13                	mov    (%ebx),%edx
+ 5ed:	6a 01                	push   $0x1
+ 5ef:	e9 6b ff ff ff       	jmp    55f <printf+0xcf>
+ 5f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 5f8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 5fb:	83 ec 04             	sub    $0x4,%esp
+ 5fe:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 601:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 603:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 606:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 609:	6a 01                	push   $0x1
+ 60b:	52                   	push   %edx
+ 60c:	57                   	push   %edi
+ 60d:	e8 d2 fc ff ff       	call   2e4 <write>
+        ap++;
+ 612:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 615:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 618:	31 d2                	xor    %edx,%edx
+ 61a:	e9 be fe ff ff       	jmp    4dd <printf+0x4d>
+ 61f:	90                   	nop
+  write(fd, &c, 1);
+ 620:	83 ec 04             	sub    $0x4,%esp
+ 623:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 626:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 629:	6a 01                	push   $0x1
+ 62b:	e9 11 ff ff ff       	jmp    541 <printf+0xb1>
+ 630:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 635:	bb eb 07 00 00       	mov    $0x7eb,%ebx
+ 63a:	e9 61 ff ff ff       	jmp    5a0 <printf+0x110>
+ 63f:	90                   	nop
+
+00000640 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 640:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 641:	a1 f8 0a 00 00       	mov    0xaf8,%eax
+{
+ 646:	89 e5                	mov    %esp,%ebp
+ 648:	57                   	push   %edi
+ 649:	56                   	push   %esi
+ 64a:	53                   	push   %ebx
+ 64b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 64e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 651:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 658:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 65a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 65c:	39 ca                	cmp    %ecx,%edx
+ 65e:	73 30                	jae    690 <free+0x50>
+ 660:	39 c1                	cmp    %eax,%ecx
+ 662:	72 04                	jb     668 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 664:	39 c2                	cmp    %eax,%edx
+ 666:	72 f0                	jb     658 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 668:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 66b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 66e:	39 f8                	cmp    %edi,%eax
+ 670:	74 2e                	je     6a0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 672:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 675:	8b 42 04             	mov    0x4(%edx),%eax
+ 678:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 67b:	39 f1                	cmp    %esi,%ecx
+ 67d:	74 38                	je     6b7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 67f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 681:	5b                   	pop    %ebx
+  freep = p;
+ 682:	89 15 f8 0a 00 00    	mov    %edx,0xaf8
+}
+ 688:	5e                   	pop    %esi
+ 689:	5f                   	pop    %edi
+ 68a:	5d                   	pop    %ebp
+ 68b:	c3                   	ret
+ 68c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 690:	39 c1                	cmp    %eax,%ecx
+ 692:	72 d0                	jb     664 <free+0x24>
+ 694:	eb c2                	jmp    658 <free+0x18>
+ 696:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 69d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 6a0:	03 70 04             	add    0x4(%eax),%esi
+ 6a3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6a6:	8b 02                	mov    (%edx),%eax
+ 6a8:	8b 00                	mov    (%eax),%eax
+ 6aa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 6ad:	8b 42 04             	mov    0x4(%edx),%eax
+ 6b0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 6b3:	39 f1                	cmp    %esi,%ecx
+ 6b5:	75 c8                	jne    67f <free+0x3f>
+    p->s.size += bp->s.size;
+ 6b7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 6ba:	89 15 f8 0a 00 00    	mov    %edx,0xaf8
+    p->s.size += bp->s.size;
+ 6c0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 6c3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 6c6:	89 0a                	mov    %ecx,(%edx)
+}
+ 6c8:	5b                   	pop    %ebx
+ 6c9:	5e                   	pop    %esi
+ 6ca:	5f                   	pop    %edi
+ 6cb:	5d                   	pop    %ebp
+ 6cc:	c3                   	ret
+ 6cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006d0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 6d0:	55                   	push   %ebp
+ 6d1:	89 e5                	mov    %esp,%ebp
+ 6d3:	57                   	push   %edi
+ 6d4:	56                   	push   %esi
+ 6d5:	53                   	push   %ebx
+ 6d6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 6dc:	8b 15 f8 0a 00 00    	mov    0xaf8,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6e2:	8d 78 07             	lea    0x7(%eax),%edi
+ 6e5:	c1 ef 03             	shr    $0x3,%edi
+ 6e8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 6eb:	85 d2                	test   %edx,%edx
+ 6ed:	0f 84 8d 00 00 00    	je     780 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6f3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6f5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6f8:	39 f9                	cmp    %edi,%ecx
+ 6fa:	73 64                	jae    760 <malloc+0x90>
+  if(nu < 4096)
+ 6fc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 701:	39 df                	cmp    %ebx,%edi
+ 703:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 706:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 70d:	eb 0a                	jmp    719 <malloc+0x49>
+ 70f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 710:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 712:	8b 48 04             	mov    0x4(%eax),%ecx
+ 715:	39 f9                	cmp    %edi,%ecx
+ 717:	73 47                	jae    760 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 719:	89 c2                	mov    %eax,%edx
+ 71b:	39 05 f8 0a 00 00    	cmp    %eax,0xaf8
+ 721:	75 ed                	jne    710 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 723:	83 ec 0c             	sub    $0xc,%esp
+ 726:	56                   	push   %esi
+ 727:	e8 20 fc ff ff       	call   34c <sbrk>
+  if(p == (char*)-1)
+ 72c:	83 c4 10             	add    $0x10,%esp
+ 72f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 732:	74 1c                	je     750 <malloc+0x80>
+  hp->s.size = nu;
+ 734:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 737:	83 ec 0c             	sub    $0xc,%esp
+ 73a:	83 c0 08             	add    $0x8,%eax
+ 73d:	50                   	push   %eax
+ 73e:	e8 fd fe ff ff       	call   640 <free>
+  return freep;
+ 743:	8b 15 f8 0a 00 00    	mov    0xaf8,%edx
+      if((p = morecore(nunits)) == 0)
+ 749:	83 c4 10             	add    $0x10,%esp
+ 74c:	85 d2                	test   %edx,%edx
+ 74e:	75 c0                	jne    710 <malloc+0x40>
+        return 0;
+  }
+}
+ 750:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 753:	31 c0                	xor    %eax,%eax
+}
+ 755:	5b                   	pop    %ebx
+ 756:	5e                   	pop    %esi
+ 757:	5f                   	pop    %edi
+ 758:	5d                   	pop    %ebp
+ 759:	c3                   	ret
+ 75a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 760:	39 cf                	cmp    %ecx,%edi
+ 762:	74 4c                	je     7b0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 764:	29 f9                	sub    %edi,%ecx
+ 766:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 769:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 76c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 76f:	89 15 f8 0a 00 00    	mov    %edx,0xaf8
+}
+ 775:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 778:	83 c0 08             	add    $0x8,%eax
+}
+ 77b:	5b                   	pop    %ebx
+ 77c:	5e                   	pop    %esi
+ 77d:	5f                   	pop    %edi
+ 77e:	5d                   	pop    %ebp
+ 77f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 780:	c7 05 f8 0a 00 00 fc 	movl   $0xafc,0xaf8
+ 787:	0a 00 00 
+    base.s.size = 0;
+ 78a:	b8 fc 0a 00 00       	mov    $0xafc,%eax
+    base.s.ptr = freep = prevp = &base;
+ 78f:	c7 05 fc 0a 00 00 fc 	movl   $0xafc,0xafc
+ 796:	0a 00 00 
+    base.s.size = 0;
+ 799:	c7 05 00 0b 00 00 00 	movl   $0x0,0xb00
+ 7a0:	00 00 00 
+    if(p->s.size >= nunits){
+ 7a3:	e9 54 ff ff ff       	jmp    6fc <malloc+0x2c>
+ 7a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7af:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 7b0:	8b 08                	mov    (%eax),%ecx
+ 7b2:	89 0a                	mov    %ecx,(%edx)
+ 7b4:	eb b9                	jmp    76f <malloc+0x9f>
@@ -22,7 +22,7 @@
 
 int nbitmap = FSSIZE/(BSIZE*8) + 1;
 int ninodeblocks = NINODES / IPB + 1;
-int nlog = LOGSIZE;
+int nlog = FSSIZE/16 < LOGMAX ? FSSIZE/16 : LOGMAX;  // a sixteenth of the disk
 int nmeta;    // Number of meta blocks (boot, sb, nlog, inode, bitmap)
 int nblocks;  // Number of data blocks
 
@@ -90,7 +90,6 @@ main(int argc, char *argv[])
     exit(1);
   }
 
-  // 1 fs block = 1 disk sector
   nmeta = 2 + nlog + ninodeblocks + nbitmap;
   nblocks = FSSIZE - nmeta;
 
@@ -101,6 +100,7 @@ main(int argc, char *argv[])
   sb.logstart = xint(2);
   sb.inodestart = xint(2+nlog);
   sb.bmapstart = xint(2+nlog+ninodeblocks);
+  sb.bsize = xint(BSIZE);
 
   printf("nmeta %d (boot, super, log blocks %u inode blocks %u, bitmap blocks %u) blocks %d total %d\n",
          nmeta, nlog, ninodeblocks, nbitmap, nblocks, FSSIZE);
@@ -252,6 +252,21 @@ balloc(int used)
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 
+// Return entry i of indirect block blk, allocating a block
+// for it if there is none.
+uint
+ientry(uint blk, uint i)
+{
+  uint indirect[NINDIRECT];
+
+  rsect(blk, (char*)indirect);
+  if(indirect[i] == 0){
+    indirect[i] = xint(freeblock++);
+    wsect(blk, (char*)indirect);
+  }
+  return xint(indirect[i]);
+}
+
 void
 iappend(uint inum, void *xp, int n)
 {
@@ -259,7 +274,6 @@ iappend(uint inum, void *xp, int n)
   uint fbn, off, n1;
   struct dinode din;
   char buf[BSIZE];
-  uint indirect[NINDIRECT];
   uint x;
 
   rinode(inum, &din);
@@ -273,16 +287,18 @@ iappend(uint inum, void *xp, int n)
         din.addrs[fbn] = xint(freeblock++);
       }
       x = xint(din.addrs[fbn]);
-    } else {
+    } else if(fbn < NDIRECT + NINDIRECT){
       if(xint(din.addrs[NDIRECT]) == 0){
         din.addrs[NDIRECT] = xint(freeblock++);
       }
-      rsect(xint(din.addrs[NDIRECT]), (char*)indirect);
-      if(indirect[fbn - NDIRECT] == 0){
-        indirect[fbn - NDIRECT] = xint(freeblock++);
-        wsect(xint(din.addrs[NDIRECT]), (char*)indirect);
+      x = ientry(xint(din.addrs[NDIRECT]), fbn - NDIRECT);
+    } else {
+      if(xint(din.addrs[NDIRECT+1]) == 0){
+        din.addrs[NDIRECT+1] = xint(freeblock++);
       }
-      x = xint(indirect[fbn-NDIRECT]);
+      x = fbn - NDIRECT - NINDIRECT;
+      x = ientry(ientry(xint(din.addrs[NDIRECT+1]), x / NINDIRECT),
+                 x % NINDIRECT);
     }
     n1 = min(n, (fbn + 1) * BSIZE - off);
     rsect(x, buf);
@@ -142,6 +142,11 @@ struct segdesc {
 #define PTE_PS          0x080   // Page Size
 #define PTE_MBZ         0x180   // Bits must be zero
 
+// Page fault error code flags
+#define FEC_PR          0x1     // Page fault caused by protection violation
+#define FEC_WR          0x2     // Page fault caused by a write
+#define FEC_U           0x4     // Page fault occured while in user mode
+
 // Address in page table or page directory entry
 #define PTE_ADDR(pte)   ((uint)(pte) & ~0xFFF)
 #define PTE_FLAGS(pte)  ((uint)(pte) &  0xFFF)
@@ -1,20 +1,66 @@
 #include "nic.h"
 #include "defs.h"
+#include "param.h"
+#include "spinlock.h"
+#include "rcu.h"
+
+/*
+ * The table of loaded devices is read without a lock (see rcu.c).
+ * regnicdevice() copies the table, adds the new device and publishes
+ * the copy; the old table is freed after a grace period.
+ */
+struct nictab {
+    struct rcuhead rcu;	// must be first
+    int n;
+    nic nics[NNIC];
+};
+
+static struct nictab * nictab;
+static struct spinlock niclock;	// serializes regnicdevice()
+
+static void freenictab(struct rcuhead * h) {
+    kfree((char *) h);
+}
+
+void nicinit(void) {
+    initlock(&niclock, "nic");
+}
 
 void regnicdevice(nic d) { 
-    nics[0] = d;
+    struct nictab * old, * t;
+
+    if ((t = (struct nictab *) kalloc()) == 0)
+	panic("regnicdevice: out of memory");
+    acquire(&niclock);
+    old = nictab;
+    t->n = 0;
+    if (old) {
+	memmove(t, old, sizeof(*t));
+    }
+    if (t->n == NNIC)
+	panic("regnicdevice: too many devices");
+    t->nics[t->n++] = d;
+    __sync_synchronize();	// t must be filled in before readers can see it
+    nictab = t;
+    release(&niclock);
+    if (old)
+	callrcu(&old->rcu, freenictab);
     cprintf("regnicdevice");
 }
 
-int getnicdevice(char * intrfc, nic ** d) {
+int getnicdevice(char * intrfc, nic * d) {
+    struct nictab * t;
+
     cprintf("Get device for interface=%s\n", intrfc);
     // TODO: Fetch device details from a table of loaded devices using interface name
-    if (nics[0].sendpacket == 0 || nics[0].recvpacket == 0) {
-	cprintf("NICS sendpacket:%d\n", nics[0].sendpacket);
-	cprintf("NICS recvpacket:%d\n", nics[0].recvpacket);
+    rcureadlock();
+    t = nictab;
+    if (t == 0 || t->nics[0].sendpacket == 0 || t->nics[0].recvpacket == 0) {
+	rcureadunlock();
 	cprintf("ERROR: nic: No nic recognized\n");
 	return -1;
     }
-    * d = &nics[0];
+    * d = t->nics[0];
+    rcureadunlock();
     return 0;
-}
\ No newline at end of file
+}
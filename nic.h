@@ -14,8 +14,6 @@ typedef struct {
     void (* recvpacket)(void * drvr, uint8_t * pkt, uint16_t len);
 } nic;
 
-nic nics[1];
-
 void regnicdevice(nic d);
-int getnicdevice(char * intrfc, nic ** d);
+int getnicdevice(char * intrfc, nic * d);
 #endif
\ No newline at end of file
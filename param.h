@@ -3,12 +3,28 @@
 #define NCPU          8  // maximum number of CPUs
 #define NOFILE       16  // open files per process
 #define NFILE       100  // open files per system
-#define NINODE       50  // maximum number of active i-nodes
+#define NINODE       50  // minimum size of the i-node cache
+#define NINODEMAX  4096  // maximum size of the i-node cache
+#define NIHASH      257  // hash buckets in the i-node cache
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
-#define MAXOPBLOCKS  10  // max # of blocks any FS op writes
-#define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
-#define FSSIZE       1000  // size of file system in blocks
+#define MAXPATH     128  // longest path a system call takes, with nul
+#define MAXOPBLOCKS  32  // max # of blocks any FS op writes
+#define LOGMAX       1024  // max blocks in on-disk log
+// minimum size of disk block cache: the log pins up to a log's worth
+// of committed blocks plus half a log of commit buffers
+#define NBUF         (LOGMAX + LOGMAX/2 + MAXOPBLOCKS*3)
+#define NBUFMAX      4096  // maximum size of disk block cache
+#define NBUCKET       257  // hash buckets in the disk block cache
+#define RAMAX          32  // most blocks to read ahead of a file reader
+#define FSSIZE       8192  // size of file system in blocks
+#define NVMA         16  // memory regions per process
+#define NPCACHE     256  // pages in the file page cache
+#define NDCACHE    1024  // names in the directory entry cache
+#define NSHM         16  // shared-memory segments
+#define SHMMAXPG     64  // pages per shared-memory segment
+#define NLOCKSTAT    32  // lock names with contention counters
+#define NNIC          4  // network interfaces
 
+#define HZ          100  // clock ticks per second
@@ -0,0 +1,224 @@
+// Page cache.
+//
+// The page cache holds page-sized copies of file contents so that
+// several processes can map the same physical page, for example the
+// text of a program that is being run more than once.  Pages are
+// filled through readi(), and so through the buffer cache.
+//
+// Interface:
+// * pcacheget(ip, off) returns a page holding the file bytes
+//   [off, off+PGSIZE), zero-filled past the end of the file.
+//   The caller owns one reference to the page and drops it
+//   with kfree() when it unmaps the page.
+// * pcacheupdate(ip, off, src, n) copies data written to ip
+//   into its cached pages, so that they stay the same as the
+//   file; writei() calls it.
+// * pcacheread(ip, off, dst, n) reads from a cached page of ip,
+//   if there is one; readi() calls it, since a shared mapping
+//   may have stored to the page without writing the file yet.
+// * pcacheinval(ip) forgets the cached pages of ip; call it
+//   when the file is truncated.
+//
+// ip->pcached says whether ip may have cached pages, so that
+// readi() only looks in the cache for files that have been
+// mapped.
+//
+// The cache holds its own reference to each page.  A page whose
+// only reference is the cache's is not mapped anywhere and may be
+// recycled.  Private mappings map a cached page read-only and
+// copy it on write.  Shared mappings write to the cached page
+// directly, and msync() writes it back to the file.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+
+struct cpage {
+  uint dev;
+  uint inum;
+  uint off;
+  char *page;   // 0 if the slot is free
+};
+
+struct {
+  struct spinlock lock;
+  struct cpage pg[NPCACHE];
+  uint hand;    // next slot to consider for recycling
+} pcache;
+
+void
+pcacheinit(void)
+{
+  initlock(&pcache.lock, "pcache");
+}
+
+// Look for the cached page of ip at off.
+// Caller must hold pcache.lock.
+static struct cpage*
+pcachelookup(uint dev, uint inum, uint off)
+{
+  struct cpage *c;
+
+  for(c = pcache.pg; c < pcache.pg+NPCACHE; c++)
+    if(c->page && c->dev == dev && c->inum == inum && c->off == off)
+      return c;
+  return 0;
+}
+
+// Find a slot for a new page, recycling one that no
+// page table maps any more.  Caller must hold pcache.lock.
+static struct cpage*
+pcachevictim(void)
+{
+  struct cpage *c;
+  int i;
+
+  for(i = 0; i < NPCACHE; i++){
+    c = &pcache.pg[pcache.hand];
+    pcache.hand = (pcache.hand + 1) % NPCACHE;
+    if(c->page == 0)
+      return c;
+    if(krefcount(c->page) == 1){
+      kfree(c->page);
+      c->page = 0;
+      return c;
+    }
+  }
+  return 0;
+}
+
+// Return a referenced page holding the contents of ip at off.
+// Caller must hold ip->lock, which keeps the contents from
+// changing while a page is filled.
+// Returns 0 if out of memory or the file can't be read.
+char*
+pcacheget(struct inode *ip, uint off)
+{
+  struct cpage *c;
+  char *mem;
+  uint n;
+
+  if(!holdingsleep(&ip->lock))
+    panic("pcacheget");
+
+  acquire(&pcache.lock);
+  if((c = pcachelookup(ip->dev, ip->inum, off)) != 0){
+    kdup(c->page);
+    release(&pcache.lock);
+    return c->page;
+  }
+  release(&pcache.lock);
+
+  if((mem = kalloc()) == 0)
+    return 0;
+  memset(mem, 0, PGSIZE);
+  n = 0;
+  if(off < ip->size)
+    n = ip->size - off < PGSIZE ? ip->size - off : PGSIZE;
+  if(n > 0 && readi(ip, mem, off, n) != n){
+    kfree(mem);
+    return 0;
+  }
+
+  // Nobody else can have filled this page meanwhile, since
+  // that requires ip->lock.  If the cache is full of pages
+  // still in use, hand back an uncached page.
+  acquire(&pcache.lock);
+  if((c = pcachevictim()) != 0){
+    c->dev = ip->dev;
+    c->inum = ip->inum;
+    c->off = off;
+    c->page = mem;
+    kdup(mem);
+    ip->pcached = 1;
+  }
+  release(&pcache.lock);
+  return mem;
+}
+
+// Does ip have any cached pages?  ilock() asks when it reads
+// ip in, since its pages may have outlived its cached inode.
+int
+pcachehas(struct inode *ip)
+{
+  struct cpage *c;
+
+  acquire(&pcache.lock);
+  for(c = pcache.pg; c < pcache.pg+NPCACHE; c++){
+    if(c->page && c->dev == ip->dev && c->inum == ip->inum){
+      release(&pcache.lock);
+      return 1;
+    }
+  }
+  release(&pcache.lock);
+  return 0;
+}
+
+// Copy the n bytes of ip at off to dst from the cached page
+// holding them.  Returns 1 if it did, 0 if no cached page
+// holds them all, or -1 if dst faulted.
+// Caller must hold ip->lock.
+int
+pcacheread(struct inode *ip, uint off, char *dst, uint n)
+{
+  struct cpage *c;
+  int r;
+
+  if(!ip->pcached)
+    return 0;
+  acquire(&pcache.lock);
+  c = pcachelookup(ip->dev, ip->inum, PGROUNDDOWN(off));
+  if(c == 0 || off + n > c->off + PGSIZE){
+    release(&pcache.lock);
+    return 0;
+  }
+  r = ucopy(dst, c->page + (off - c->off), n) < 0 ? -1 : 1;
+  release(&pcache.lock);
+  return r;
+}
+
+// Forget the cached pages of ip.  Pages that are still
+// mapped stay valid for their current users.
+void
+pcacheinval(struct inode *ip)
+{
+  struct cpage *c;
+
+  acquire(&pcache.lock);
+  for(c = pcache.pg; c < pcache.pg+NPCACHE; c++){
+    if(c->page && c->dev == ip->dev && c->inum == ip->inum){
+      kfree(c->page);
+      c->page = 0;
+    }
+  }
+  ip->pcached = 0;
+  release(&pcache.lock);
+}
+
+// Copy the n bytes at src, just written to ip at off, into
+// any cached pages of ip that they overlap.
+void
+pcacheupdate(struct inode *ip, uint off, char *src, uint n)
+{
+  struct cpage *c;
+  uint lo, hi;
+
+  if(!ip->pcached)
+    return;
+  acquire(&pcache.lock);
+  for(c = pcache.pg; c < pcache.pg+NPCACHE; c++){
+    if(c->page == 0 || c->dev != ip->dev || c->inum != ip->inum)
+      continue;
+    if(c->off >= off + n || off >= c->off + PGSIZE)
+      continue;
+    lo = c->off > off ? c->off : off;
+    hi = c->off + PGSIZE < off + n ? c->off + PGSIZE : off + n;
+    memmove(c->page + (lo - c->off), src + (lo - off), hi - lo);
+  }
+  release(&pcache.lock);
+}
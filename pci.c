@@ -3,6 +3,7 @@
 #include "defs.h"
 #include "pciregs.h"
 #include "e1000.h"
+#include "virtnet.h"
 #include "nic.h"
 
 static const char * pcicls[] = {"Unclassified Device",
@@ -90,9 +91,35 @@ static int attache1000(pcifunc * pcifunc) {
     return 0;
 }
 
-pcidrvr attachpcivendbase[] = {{0x8086, 0x100e, attache1000}, {0, 0, 0},};
+static int attachpiix3ide(pcifunc * pcifunc) {
+    pcienabledev(pcifunc);
+    // BAR 4 holds the bus-master registers.
+    return idedmainit(pcifunc->regbase[4]);
+}
+
+static int attachvirtnet(pcifunc * pcifunc) {
+    pcienabledev(pcifunc);
+    nic d;
+    if (initvirtnet(pcifunc, &d.drvr, d.macaddr) < 0)
+	return -1;
+    d.sendpacket = sendvirtnet;
+    d.recvpacket = recvvirtnet;
+    regnicdevice(d);
+    return 0;
+}
+
+static int attachvirtblk(pcifunc * pcifunc) {
+    pcienabledev(pcifunc);
+    // BAR 0 holds the legacy virtio registers.
+    return virtblkinit(pcifunc->regbase[0], pcifunc->irqline);
+}
+
+pcidrvr attachpcivendbase[] = {{0x8086, 0x100e, attache1000},
+			       {0x8086, 0x7010, attachpiix3ide},
+			       {0x1af4, 0x1000, attachvirtnet},
+			       {0x1af4, 0x1001, attachvirtblk}, {0, 0, 0},};
 
-static void attachpcinic(pcifunc * pcifunc) {
+static void attachpcidev(pcifunc * pcifunc) {
     uint i;
     uint32_t vendid = PCI_VENDOR(pcifunc->devid);
     uint32_t prodid = PCI_PRODUCT(pcifunc->devid);
@@ -133,8 +160,7 @@ static int pcienumbus(pcibus * bus) {
 	    pf.devcls = pciconfread(&pf, PCI_CLASS_REG);
 	    pciprntfunc(&pf);
 	    
-	    if (PCI_CLASS(pf.devcls) == PCI_DEVICE_CLASS_NETWORK_CONTROLLER)
-		attachpcinic(&pf);
+	    attachpcidev(&pf);
 	}
     }
     return totdev;
@@ -90,7 +90,12 @@ pipewrite(struct pipe *p, char *addr, int n)
       wakeup(&p->nread);
       sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
     }
-    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+    if(ucopy(&p->data[p->nwrite % PIPESIZE], addr+i, 1) < 0){
+      wakeup(&p->nread);
+      release(&p->lock);
+      return -1;
+    }
+    p->nwrite++;
   }
   wakeup(&p->nread);  //DOC: pipewrite-wakeup1
   release(&p->lock);
@@ -113,7 +118,11 @@ piperead(struct pipe *p, char *addr, int n)
   for(i = 0; i < n; i++){  //DOC: piperead-copy
     if(p->nread == p->nwrite)
       break;
-    addr[i] = p->data[p->nread++ % PIPESIZE];
+    if(ucopy(addr+i, &p->data[p->nread % PIPESIZE], 1) < 0){
+      i = -1;
+      break;
+    }
+    p->nread++;
   }
   wakeup(&p->nwrite);  //DOC: piperead-wakeup
   release(&p->lock);
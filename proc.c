@@ -6,24 +6,191 @@
 #include "x86.h"
 #include "proc.h"
 #include "spinlock.h"
-
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+#include "sched.h"
+#include "traps.h"
+
+// ptable.lock guards allocation of process slots and
+// the parent links between processes.
 struct {
   struct spinlock lock;
   struct proc proc[NPROC];
 } ptable;
 
+// Each process has a lock guarding its state, chan and run
+// queue link.  A process switching in or out of the CPU holds
+// its lock across swtch(), so that no other CPU can pick it up
+// until it is off this CPU's stack.  The locks are kept here
+// rather than in struct proc so that proc.h need not depend
+// on spinlock.h.
+static struct spinlock plocks[NPROC];
+
+static struct spinlock*
+plock(struct proc *p)
+{
+  return &plocks[p - ptable.proc];
+}
+
+// Per-CPU run queues of RUNNABLE processes.
+//
+// There are two scheduling classes.  SCHED_FIFO processes run
+// before all others, highest rtprio first, in FIFO order within
+// a priority, until they block or yield.  SCHED_OTHER processes
+// share the rest of the CPU in proportion to their weight, which
+// comes from their nice value: each runs in turn for as long as
+// its vruntime, the CPU time it has had scaled down by its
+// weight, is the least on its queue.
+//
+// A CPU runs processes from its own queue; when that is empty,
+// or every BALANCETICKS ticks if another queue is longer than
+// its own, it takes one from the longest other queue.
+// Lock order: ptable.lock, then a sleep queue lock, then a
+// process lock, then a run queue lock.
+struct runq {
+  struct spinlock lock;
+  struct proc *rt;             // SCHED_FIFO list, best first
+  struct proc *heap[NPROC];    // SCHED_OTHER min-heap on vruntime
+  int nheap;
+  int len;                     // processes in both classes
+  uint minvruntime;            // never decreases (modulo wrap)
+  uint balanced;               // ticks at the last balance check
+};
+
+static struct runq runq[NCPU];
+
+#define BALANCETICKS 10
+#define NICE0WEIGHT  1024
+#define WAKEBONUS    (2*NICE0WEIGHT)  // vruntime credit for sleepers
+
+// Weight of each nice value, from -20 to 19.  Each step
+// is worth about 10% of CPU time against a neighbour.
+static int niceweight[NICE_MAX - NICE_MIN + 1] = {
+  88761, 71755, 56483, 46273, 36291,
+  29154, 23254, 18705, 14949, 11916,
+   9548,  7620,  6100,  4904,  3906,
+   3121,  2501,  1991,  1586,  1277,
+   1024,   820,   655,   526,   423,
+    335,   272,   215,   172,   137,
+    110,    87,    70,    56,    45,
+     36,    29,    23,    18,    15,
+};
+
+// Compare vruntimes, allowing for wrap-around.
+static int
+vbefore(uint a, uint b)
+{
+  return (int)(a - b) < 0;
+}
+
+static void
+heapswap(struct runq *rq, int i, int j)
+{
+  struct proc *p;
+
+  p = rq->heap[i];
+  rq->heap[i] = rq->heap[j];
+  rq->heap[j] = p;
+}
+
+// Restore heap order around rq->heap[i].
+static void
+heapfix(struct runq *rq, int i)
+{
+  int c;
+
+  while(i > 0 && vbefore(rq->heap[i]->vruntime, rq->heap[(i-1)/2]->vruntime)){
+    heapswap(rq, i, (i-1)/2);
+    i = (i-1)/2;
+  }
+  for(;;){
+    c = 2*i + 1;
+    if(c >= rq->nheap)
+      break;
+    if(c+1 < rq->nheap && vbefore(rq->heap[c+1]->vruntime, rq->heap[c]->vruntime))
+      c++;
+    if(!vbefore(rq->heap[c]->vruntime, rq->heap[i]->vruntime))
+      break;
+    heapswap(rq, i, c);
+    i = c;
+  }
+}
+
+// Remove and return rq->heap[i].
+static struct proc*
+heapdel(struct runq *rq, int i)
+{
+  struct proc *p;
+
+  p = rq->heap[i];
+  rq->heap[i] = rq->heap[--rq->nheap];
+  if(i < rq->nheap)
+    heapfix(rq, i);
+  return p;
+}
+
+// Sleeping processes are kept in queues hashed by channel,
+// so that wakeup() looks only at processes sleeping on
+// channels in the same bucket.  wakeup() takes the processes
+// it wakes off their queue; a process woken some other way
+// (kill) takes itself off when it gets going again.
+// A sleep queue lock comes before any process lock.
+#define NSLEEPQ 64
+
+struct sleepq {
+  struct spinlock lock;
+  struct proc *head;
+};
+
+static struct sleepq sleepq[NSLEEPQ];
+
+static struct sleepq*
+chanq(void *chan)
+{
+  return &sleepq[((uint)chan * 2654435761u) >> 26];
+}
+
 static struct proc *initproc;
 
 int nextpid = 1;
 extern void forkret(void);
 extern void trapret(void);
+static void kthreadret(void);
+static void kthreadmain(void (*)(void*), void*);
+static void startproc(struct proc*, struct proc*);
+
+// A process waiting in futexwait().  Waiters are kept in
+// hashed queues so that futexwake() looks only at the waiters
+// whose word hashes to the same bucket.  A bucket's lock also
+// protects its words between the value check in futexwait()
+// and going to sleep.
+struct futexwaiter {
+  int *key;                    // kernel address of the word
+  struct futexwaiter *next;
+};
+
+#define NFUTEXQ 64
 
-static void wakeup1(void *chan);
+struct {
+  struct spinlock lock;
+  struct futexwaiter *head;
+} futexq[NFUTEXQ];
 
 void
 pinit(void)
 {
+  int i;
+
   initlock(&ptable.lock, "ptable");
+  for(i = 0; i < NPROC; i++)
+    initlock(&plocks[i], "proc");
+  for(i = 0; i < NCPU; i++)
+    initlock(&runq[i].lock, "runq");
+  for(i = 0; i < NSLEEPQ; i++)
+    initlock(&sleepq[i].lock, "sleepq");
+  for(i = 0; i < NFUTEXQ; i++)
+    initlock(&futexq[i].lock, "futex");
 }
 
 // Must be called with interrupts disabled
@@ -65,6 +232,185 @@ myproc(void) {
   return p;
 }
 
+// Add p to its run queue.
+// Caller must hold p's lock and have made p RUNNABLE.
+static void
+runqput(struct proc *p)
+{
+  struct runq *rq = &runq[p->cpu];
+  struct proc **pp;
+
+  acquire(&rq->lock);
+  if(p->policy == SCHED_FIFO){
+    for(pp = &rq->rt; *pp && (*pp)->rtprio >= p->rtprio; pp = &(*pp)->rqnext)
+      ;
+    p->rqnext = *pp;
+    *pp = p;
+  } else {
+    // Don't let a process that slept a long time
+    // monopolize the CPU to catch up.
+    if(vbefore(p->vruntime, rq->minvruntime - WAKEBONUS))
+      p->vruntime = rq->minvruntime - WAKEBONUS;
+    rq->heap[rq->nheap++] = p;
+    heapfix(rq, rq->nheap - 1);
+  }
+  rq->len++;
+  release(&rq->lock);
+}
+
+// Take the next process to run off rq, or return 0
+// if it is empty.  If steal is set, prefer one that
+// has been waiting the least, as it matters least
+// which CPU it runs on.
+static struct proc*
+runqget(struct runq *rq, int steal)
+{
+  struct proc *p;
+
+  acquire(&rq->lock);
+  p = 0;
+  if(rq->rt){
+    p = rq->rt;
+    rq->rt = p->rqnext;
+  } else if(rq->nheap > 0){
+    p = heapdel(rq, steal ? rq->nheap - 1 : 0);
+    if(!steal && vbefore(rq->minvruntime, p->vruntime))
+      rq->minvruntime = p->vruntime;
+  }
+  if(p){
+    rq->len--;
+    p->rqnext = 0;
+  }
+  release(&rq->lock);
+  return p;
+}
+
+// Take p off its run queue.  Returns 0 if it is not
+// queued, because a scheduler is about to run it.
+// Caller must hold p's lock.
+static int
+runqremove(struct proc *p)
+{
+  struct runq *rq = &runq[p->cpu];
+  struct proc **pp;
+  int i, found;
+
+  acquire(&rq->lock);
+  found = 0;
+  for(pp = &rq->rt; *pp; pp = &(*pp)->rqnext){
+    if(*pp == p){
+      *pp = p->rqnext;
+      found = 1;
+      break;
+    }
+  }
+  for(i = 0; !found && i < rq->nheap; i++){
+    if(rq->heap[i] == p){
+      heapdel(rq, i);
+      found = 1;
+    }
+  }
+  if(found){
+    rq->len--;
+    p->rqnext = 0;
+  }
+  release(&rq->lock);
+  return found;
+}
+
+// Take a process from the longest run queue other than
+// runq[id], if that queue holds more than min processes,
+// and carry its vruntime over to runq[id].
+// Queue lengths are read without locks; they are only hints.
+static struct proc*
+runqsteal(int id, int min)
+{
+  struct runq *rq, *busiest;
+  struct proc *p;
+
+  busiest = 0;
+  for(rq = runq; rq < &runq[ncpu]; rq++)
+    if(rq != &runq[id] && rq->len > min &&
+       (busiest == 0 || rq->len > busiest->len))
+      busiest = rq;
+  if(busiest == 0 || (p = runqget(busiest, 1)) == 0)
+    return 0;
+  p->vruntime = p->vruntime - busiest->minvruntime + runq[id].minvruntime;
+  return p;
+}
+
+// Return the index of the shortest run queue,
+// where a new process should start.
+static int
+runqidle(void)
+{
+  int i, best;
+
+  best = 0;
+  for(i = 1; i < ncpu; i++)
+    if(runq[i].len < runq[best].len)
+      best = i;
+  return best;
+}
+
+// Wake a CPU halted in idle() to run the process just
+// queued on runq[id]: that queue's CPU if it is idle,
+// else any idle CPU, which will steal the process.
+static void
+kickidle(int id)
+{
+  struct cpu *c;
+
+  if(!cpus[id].idle)
+    for(c = cpus; c < &cpus[ncpu]; c++)
+      if(c->idle){
+        id = c - cpus;
+        break;
+      }
+  if(cpus[id].idle && &cpus[id] != mycpu())
+    lapicipi(cpus[id].apicid, T_IRQ0 + IRQ_WAKE);
+}
+
+// Make p RUNNABLE and queue it.
+// Caller must hold p's lock.
+static void
+makerunnable(struct proc *p)
+{
+  p->state = RUNNABLE;
+  runqput(p);
+  if(p != myproc())
+    kickidle(p->cpu);
+}
+
+// Halt this CPU until an interrupt, with the timer set
+// for the next timer, unless there is work in some run
+// queue.  Once idle is set, makerunnable() sends an IPI
+// for new work, so none is missed between the check and
+// the hlt.
+static void
+idle(struct cpu *c)
+{
+  struct runq *rq;
+  uint64_t n;
+
+  cli();
+  c->idle = 1;
+  c->rcuqs++;
+  __sync_synchronize();
+  n = nexttimeout();  // may wake processes; check the queues after
+  for(rq = runq; rq < &runq[ncpu]; rq++)
+    if(rq->len > 0)
+      break;
+  if(rq == &runq[ncpu]){
+    lapictimer(n);
+    stihlt();
+    cli();
+    clockarm();
+  }
+  c->idle = 0;
+  sti();
+}
+
 //PAGEBREAK: 32
 // Look in the process table for an UNUSED proc.
 // If found, change state to EMBRYO and initialize
@@ -88,6 +434,11 @@ allocproc(void)
 found:
   p->state = EMBRYO;
   p->pid = nextpid++;
+  p->cputime = 0;
+  p->mm = 0;
+  p->files = 0;
+  p->thread = 0;
+  p->ustack = 0;
 
   release(&ptable.lock);
 
@@ -115,6 +466,21 @@ found:
   return p;
 }
 
+// Free p, which has never run or has been reaped.
+static void
+freeproc(struct proc *p)
+{
+  kfree(p->kstack);
+  p->kstack = 0;
+  acquire(&ptable.lock);
+  p->pid = 0;
+  p->parent = 0;
+  p->name[0] = 0;
+  p->killed = 0;
+  p->state = UNUSED;
+  release(&ptable.lock);
+}
+
 //PAGEBREAK: 32
 // Set up first user process.
 void
@@ -126,10 +492,11 @@ userinit(void)
   p = allocproc();
   
   initproc = p;
-  if((p->pgdir = setupkvm()) == 0)
+  if((p->mm = mmalloc()) == 0 || (p->mm->pgdir = setupkvm()) == 0 ||
+     (p->files = filesalloc()) == 0)
     panic("userinit: out of memory?");
-  inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
-  p->sz = PGSIZE;
+  inituvm(p->mm->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
+  p->mm->sz = PGSIZE;
   memset(p->tf, 0, sizeof(*p->tf));
   p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
   p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
@@ -140,38 +507,22 @@ userinit(void)
   p->tf->eip = 0;  // beginning of initcode.S
 
   safestrcpy(p->name, "initcode", sizeof(p->name));
-  p->cwd = namei("/");
+  p->files->cwd = namei("/");
 
   // this assignment to p->state lets other cores
   // run this process. the acquire forces the above
   // writes to be visible, and the lock is also needed
   // because the assignment might not be atomic.
-  acquire(&ptable.lock);
-
-  p->state = RUNNABLE;
-
-  release(&ptable.lock);
-}
+  acquire(plock(p));
 
-// Grow current process's memory by n bytes.
-// Return 0 on success, -1 on failure.
-int
-growproc(int n)
-{
-  uint sz;
-  struct proc *curproc = myproc();
+  p->cpu = 0;
+  p->policy = SCHED_OTHER;
+  p->nice = 0;
+  p->rtprio = 0;
+  p->vruntime = 0;
+  makerunnable(p);
 
-  sz = curproc->sz;
-  if(n > 0){
-    if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
-      return -1;
-  } else if(n < 0){
-    if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
-      return -1;
-  }
-  curproc->sz = sz;
-  switchuvm(curproc);
-  return 0;
+  release(plock(p));
 }
 
 // Create a new process copying p as the parent.
@@ -180,7 +531,7 @@ growproc(int n)
 int
 fork(void)
 {
-  int i, pid;
+  int pid;
   struct proc *np;
   struct proc *curproc = myproc();
 
@@ -190,35 +541,152 @@ fork(void)
   }
 
   // Copy process state from proc.
-  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
-    kfree(np->kstack);
-    np->kstack = 0;
-    np->state = UNUSED;
+  if((np->mm = mmalloc()) == 0 || copymm(np, curproc) < 0 ||
+     (np->files = filescopy(curproc->files)) == 0){
+    if(np->mm)
+      mmput(np->mm);
+    np->mm = 0;
+    freeproc(np);
     return -1;
   }
-  np->sz = curproc->sz;
   np->parent = curproc;
   *np->tf = *curproc->tf;
 
   // Clear %eax so that fork returns 0 in the child.
   np->tf->eax = 0;
 
-  for(i = 0; i < NOFILE; i++)
-    if(curproc->ofile[i])
-      np->ofile[i] = filedup(curproc->ofile[i]);
-  np->cwd = idup(curproc->cwd);
-
   safestrcpy(np->name, curproc->name, sizeof(curproc->name));
 
   pid = np->pid;
+  startproc(np, curproc);
+  return pid;
+}
 
-  acquire(&ptable.lock);
+// Create a thread running fn(arg) in the current process's
+// address space, on the one-page user stack at stack, and
+// sharing its open files and current directory.
+// Returns the new thread's pid, or -1.
+int
+clone(uint fn, uint arg, uint stack)
+{
+  struct proc *np;
+  struct proc *curproc = myproc();
+  uint sp, ustack[2];
+
+  if(stack % PGSIZE != 0 || stack + PGSIZE > KERNBASE)
+    return -1;
+
+  // Start at fn with arg on the stack, as if called
+  // from a fake return PC.
+  ustack[0] = 0xffffffff;
+  ustack[1] = arg;
+  sp = stack + PGSIZE - sizeof(ustack);
+  if(copyout(curproc->mm->pgdir, sp, ustack, sizeof(ustack)) < 0)
+    return -1;
 
-  np->state = RUNNABLE;
+  if((np = allocproc()) == 0)
+    return -1;
+  np->mm = mmdup(curproc->mm);
+  np->files = filesdup(curproc->files);
+  np->parent = curproc;
+  np->thread = 1;
+  np->ustack = stack;
+  *np->tf = *curproc->tf;
+  np->tf->esp = sp;
+  np->tf->eip = fn;
+
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+  startproc(np, curproc);
+  return np->pid;
+}
 
+// Kill the other threads using mm, for exec().  Our own
+// threads go to init, which reaps them, since the new image
+// will never join() them.
+void
+execthreads(struct mm *mm)
+{
+  struct proc *p;
+  struct proc *curproc = myproc();
+
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p == curproc || p->mm != mm)
+      continue;
+    acquire(plock(p));
+    p->killed = 1;
+    if(p->state == SLEEPING)
+      makerunnable(p);
+    release(plock(p));
+    if(p->parent == curproc){
+      p->parent = initproc;
+      p->thread = 0;
+      if(p->state == ZOMBIE)
+        wakeup(initproc);
+    }
+  }
+  curproc->thread = 0;
   release(&ptable.lock);
+}
 
-  return pid;
+// Create a kernel thread running fn(arg), for driver work.
+// It belongs to init, and exits if fn returns.
+int
+kthread(char *name, void (*fn)(void*), void *arg)
+{
+  struct proc *np;
+  uint *sp;
+
+  if((np = allocproc()) == 0)
+    return -1;
+  // Start in kthreadret instead of forkret, and return from
+  // there into kthreadmain(fn, arg) instead of trapret.
+  np->context->eip = (uint)kthreadret;
+  sp = (uint*)(np->context + 1);
+  sp[0] = (uint)kthreadmain;
+  sp[1] = 0;  // kthreadmain's fake return PC
+  sp[2] = (uint)fn;
+  sp[3] = (uint)arg;
+  np->parent = initproc;
+  safestrcpy(np->name, name, sizeof(np->name));
+  startproc(np, initproc);
+  return np->pid;
+}
+
+// Make the new process np runnable.
+static void
+startproc(struct proc *np, struct proc *curproc)
+{
+  acquire(plock(np));
+
+  // The child inherits the parent's scheduling class, and
+  // starts level with the processes already on its queue.
+  np->cpu = runqidle();
+  np->policy = curproc->policy;
+  np->nice = curproc->nice;
+  np->rtprio = curproc->rtprio;
+  np->vruntime = runq[np->cpu].minvruntime;
+  makerunnable(np);
+
+  release(plock(np));
+}
+
+// A kernel thread's first scheduling swtches here.  It skips
+// forkret's file system setup, which only the first user
+// process, init, may do: a thread such as the rcu thread can
+// be scheduled before init.
+static void
+kthreadret(void)
+{
+  // Still holding our lock from scheduler.
+  release(plock(myproc()));
+}
+
+static void
+kthreadmain(void (*fn)(void*), void *arg)
+{
+  fn(arg);
+  exit();
 }
 
 // Exit the current process.  Does not return.
@@ -229,50 +697,51 @@ exit(void)
 {
   struct proc *curproc = myproc();
   struct proc *p;
-  int fd;
 
   if(curproc == initproc)
     panic("init exiting");
 
-  // Close all open files.
-  for(fd = 0; fd < NOFILE; fd++){
-    if(curproc->ofile[fd]){
-      fileclose(curproc->ofile[fd]);
-      curproc->ofile[fd] = 0;
-    }
-  }
-
-  begin_op();
-  iput(curproc->cwd);
-  end_op();
-  curproc->cwd = 0;
+  // Close all open files, unless other threads share them.
+  // The memory goes when the process is reaped, since
+  // until then we are still running on its page table.
+  if(curproc->files)
+    filesput(curproc->files);
+  curproc->files = 0;
 
   acquire(&ptable.lock);
 
   // Parent might be sleeping in wait().
-  wakeup1(curproc->parent);
+  wakeup(curproc->parent);
 
   // Pass abandoned children to init.
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
     if(p->parent == curproc){
       p->parent = initproc;
+      p->thread = 0;
       if(p->state == ZOMBIE)
-        wakeup1(initproc);
+        wakeup(initproc);
     }
   }
 
   // Jump into the scheduler, never to return.
+  // ptable.lock is held until the state is ZOMBIE so
+  // that wait() cannot miss it.
+  acquire(plock(curproc));
   curproc->state = ZOMBIE;
+  release(&ptable.lock);
   sched();
   panic("zombie exit");
 }
 
-// Wait for a child process to exit and return its pid.
-// Return -1 if this process has no children.
-int
-wait(void)
+// Wait for a child to exit and return its pid: a thread made
+// by clone() if thread is set, else a process.  Stores a
+// thread's user stack in *ustack.
+// Return -1 if this process has no such children.
+static int
+waitchild(int thread, uint *ustack)
 {
   struct proc *p;
+  struct mm *mm;
   int havekids, pid;
   struct proc *curproc = myproc();
   
@@ -281,23 +750,27 @@ wait(void)
     // Scan through table looking for exited children.
     havekids = 0;
     for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->parent != curproc)
+      if(p->parent != curproc || p->thread != thread)
         continue;
       havekids = 1;
+      // Taking p's lock makes sure that p is off its
+      // kernel stack before the stack is freed.
+      acquire(plock(p));
       if(p->state == ZOMBIE){
         // Found one.
         pid = p->pid;
-        kfree(p->kstack);
-        p->kstack = 0;
-        freevm(p->pgdir);
-        p->pid = 0;
-        p->parent = 0;
-        p->name[0] = 0;
-        p->killed = 0;
-        p->state = UNUSED;
+        if(ustack)
+          *ustack = p->ustack;
+        mm = p->mm;
+        p->mm = 0;
+        release(plock(p));
         release(&ptable.lock);
+        if(mm)
+          mmput(mm);
+        freeproc(p);
         return pid;
       }
+      release(plock(p));
     }
 
     // No point waiting if we don't have any children.
@@ -306,11 +779,28 @@ wait(void)
       return -1;
     }
 
-    // Wait for children to exit.  (See wakeup1 call in proc_exit.)
+    // Wait for children to exit.  (See wakeup call in exit.)
     sleep(curproc, &ptable.lock);  //DOC: wait-sleep
   }
 }
 
+// Wait for a child process to exit and return its pid.
+// Return -1 if this process has no children.
+int
+wait(void)
+{
+  return waitchild(0, 0);
+}
+
+// Wait for a thread made by clone() to exit and return
+// its pid, storing the stack it was given in *ustack.
+// Return -1 if this process has no such threads.
+int
+join(uint *ustack)
+{
+  return waitchild(1, ustack);
+}
+
 //PAGEBREAK: 42
 // Per-CPU process scheduler.
 // Each CPU calls scheduler() after setting itself up.
@@ -324,21 +814,37 @@ scheduler(void)
 {
   struct proc *p;
   struct cpu *c = mycpu();
+  int id = c - cpus;
+  struct runq *rq = &runq[id];
   c->proc = 0;
   
   for(;;){
     // Enable interrupts on this processor.
     sti();
 
-    // Loop over process table looking for process to run.
-    acquire(&ptable.lock);
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->state != RUNNABLE)
-        continue;
+    // Pick the next process: now and then one from a longer
+    // queue elsewhere, else the first on our own queue, else
+    // (we are idle) one from any other queue.
+    p = 0;
+    if(ticks - rq->balanced >= BALANCETICKS){
+      rq->balanced = ticks;
+      p = runqsteal(id, rq->len + 1);
+    }
+    if(p == 0)
+      p = runqget(rq, 0);
+    if(p == 0)
+      p = runqsteal(id, 0);
+    if(p == 0){
+      idle(c);
+      continue;
+    }
 
-      // Switch to chosen process.  It is the process's job
-      // to release ptable.lock and then reacquire it
-      // before jumping back to us.
+    // Switch to chosen process.  It is the process's job
+    // to release its lock and then reacquire it
+    // before jumping back to us.
+    acquire(plock(p));
+    if(p->state == RUNNABLE){
+      p->cpu = id;
       c->proc = p;
       switchuvm(p);
       p->state = RUNNING;
@@ -350,12 +856,11 @@ scheduler(void)
       // It should have changed its p->state before coming back.
       c->proc = 0;
     }
-    release(&ptable.lock);
-
+    release(plock(p));
   }
 }
 
-// Enter scheduler.  Must hold only ptable.lock
+// Enter scheduler.  Must hold only the process's lock
 // and have changed proc->state. Saves and restores
 // intena because intena is a property of this
 // kernel thread, not this CPU. It should
@@ -368,8 +873,8 @@ sched(void)
   int intena;
   struct proc *p = myproc();
 
-  if(!holding(&ptable.lock))
-    panic("sched ptable.lock");
+  if(!holding(plock(p)))
+    panic("sched proc lock");
   if(mycpu()->ncli != 1)
     panic("sched locks");
   if(p->state == RUNNING)
@@ -377,18 +882,103 @@ sched(void)
   if(readeflags()&FL_IF)
     panic("sched interruptible");
   intena = mycpu()->intena;
+  mycpu()->rcuqs++;
   swtch(&p->context, mycpu()->scheduler);
   mycpu()->intena = intena;
 }
 
+// Charge the current process for a clock tick.
+// Returns 1 if it should give up the CPU to a process
+// on its run queue that has a better claim to it.
+int
+schedtick(void)
+{
+  struct proc *p = myproc();
+  struct runq *rq = &runq[p->cpu];
+  int preempt;
+
+  p->cputime++;
+  acquire(&rq->lock);
+  if(p->policy == SCHED_FIFO){
+    preempt = rq->rt && rq->rt->rtprio > p->rtprio;
+  } else {
+    p->vruntime += NICE0WEIGHT * NICE0WEIGHT / niceweight[p->nice - NICE_MIN];
+    preempt = rq->rt ||
+      (rq->nheap > 0 && vbefore(rq->heap[0]->vruntime, p->vruntime));
+  }
+  release(&rq->lock);
+  return preempt;
+}
+
+// Set the scheduling class of process pid to policy
+// with priority prio: a nice value for SCHED_OTHER,
+// an rtprio for SCHED_FIFO.
+int
+setpriority(int pid, int policy, int prio)
+{
+  struct proc *p;
+  int queued;
+
+  if(policy == SCHED_FIFO){
+    if(prio < 1 || prio > RTPRIO_MAX)
+      return -1;
+  } else if(policy == SCHED_OTHER){
+    if(prio < NICE_MIN || prio > NICE_MAX)
+      return -1;
+  } else
+    return -1;
+
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    acquire(plock(p));
+    if(p->pid == pid && p->state != UNUSED){
+      // A queued process must be requeued in its new class.
+      queued = p->state == RUNNABLE && runqremove(p);
+      p->policy = policy;
+      if(policy == SCHED_FIFO){
+        p->rtprio = prio;
+      } else {
+        p->rtprio = 0;
+        p->nice = prio;
+      }
+      if(queued)
+        runqput(p);
+      release(plock(p));
+      return 0;
+    }
+    release(plock(p));
+  }
+  return -1;
+}
+
+// Add inc to the current process's nice value.
+// Returns the new nice value.
+int
+nice(int inc)
+{
+  struct proc *p = myproc();
+  int n;
+
+  acquire(plock(p));
+  n = p->nice + inc;
+  if(n < NICE_MIN)
+    n = NICE_MIN;
+  if(n > NICE_MAX)
+    n = NICE_MAX;
+  p->nice = n;
+  release(plock(p));
+  return n;
+}
+
 // Give up the CPU for one scheduling round.
 void
 yield(void)
 {
-  acquire(&ptable.lock);  //DOC: yieldlock
-  myproc()->state = RUNNABLE;
+  struct proc *p = myproc();
+
+  acquire(plock(p));  //DOC: yieldlock
+  makerunnable(p);
   sched();
-  release(&ptable.lock);
+  release(plock(p));
 }
 
 // A fork child's very first scheduling by scheduler()
@@ -397,16 +987,17 @@ void
 forkret(void)
 {
   static int first = 1;
-  // Still holding ptable.lock from scheduler.
-  release(&ptable.lock);
+  // Still holding our lock from scheduler.
+  release(plock(myproc()));
 
   if (first) {
     // Some initialization functions must be run in the context
     // of a regular process (e.g., they call sleep), and thus cannot
     // be run from main().
+    // The log must be recovered before iinit() reads the free map.
     first = 0;
-    iinit(ROOTDEV);
     initlog(ROOTDEV);
+    iinit(ROOTDEV);
   }
 
   // Return to "caller", actually trapret (see allocproc).
@@ -418,6 +1009,8 @@ void
 sleep(void *chan, struct spinlock *lk)
 {
   struct proc *p = myproc();
+  struct sleepq *q = chanq(chan);
+  struct proc **pp;
   
   if(p == 0)
     panic("sleep");
@@ -425,52 +1018,64 @@ sleep(void *chan, struct spinlock *lk)
   if(lk == 0)
     panic("sleep without lk");
 
-  // Must acquire ptable.lock in order to
+  // Must acquire p's lock in order to
   // change p->state and then call sched.
-  // Once we hold ptable.lock, we can be
-  // guaranteed that we won't miss any wakeup
-  // (wakeup runs with ptable.lock locked),
-  // so it's okay to release lk.
-  if(lk != &ptable.lock){  //DOC: sleeplock0
-    acquire(&ptable.lock);  //DOC: sleeplock1
-    release(lk);
-  }
-  // Go to sleep.
+  // p is on chan's queue and SLEEPING before lk
+  // is released, and wakeup takes the queue lock
+  // to look for it, so we can't miss a wakeup
+  // from anyone who holds lk while changing
+  // the condition.
+  acquire(&q->lock);  //DOC: sleeplock1
+  acquire(plock(p));
   p->chan = chan;
   p->state = SLEEPING;
+  p->sqnext = q->head;
+  q->head = p;
+  release(lk);
+  release(&q->lock);
 
+  // Go to sleep.
   sched();
 
   // Tidy up.
   p->chan = 0;
+  release(plock(p));  //DOC: sleeplock2
+
+  // Get off the queue if wakeup didn't take us off.
+  acquire(&q->lock);
+  for(pp = &q->head; *pp; pp = &(*pp)->sqnext){
+    if(*pp == p){
+      *pp = p->sqnext;
+      break;
+    }
+  }
+  release(&q->lock);
 
   // Reacquire original lock.
-  if(lk != &ptable.lock){  //DOC: sleeplock2
-    release(&ptable.lock);
-    acquire(lk);
-  }
+  acquire(lk);
 }
 
 //PAGEBREAK!
-// Wake up all processes sleeping on chan.
-// The ptable lock must be held.
-static void
-wakeup1(void *chan)
-{
-  struct proc *p;
-
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == SLEEPING && p->chan == chan)
-      p->state = RUNNABLE;
-}
-
 // Wake up all processes sleeping on chan.
 void
 wakeup(void *chan)
 {
-  acquire(&ptable.lock);
-  wakeup1(chan);
-  release(&ptable.lock);
+  struct sleepq *q = chanq(chan);
+  struct proc *p, **pp;
+
+  acquire(&q->lock);
+  for(pp = &q->head; (p = *pp) != 0; ){
+    if(p->chan != chan){
+      pp = &p->sqnext;
+      continue;
+    }
+    *pp = p->sqnext;
+    acquire(plock(p));
+    if(p->state == SLEEPING && p->chan == chan)
+      makerunnable(p);
+    release(plock(p));
+  }
+  release(&q->lock);
 }
 
 // Kill the process with the given pid.
@@ -481,21 +1086,104 @@ kill(int pid)
 {
   struct proc *p;
 
-  acquire(&ptable.lock);
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->pid == pid){
+    acquire(plock(p));
+    if(p->pid == pid && p->state != UNUSED){
       p->killed = 1;
       // Wake process from sleep if necessary.
       if(p->state == SLEEPING)
-        p->state = RUNNABLE;
-      release(&ptable.lock);
+        makerunnable(p);
+      release(plock(p));
       return 0;
     }
+    release(plock(p));
   }
-  release(&ptable.lock);
   return -1;
 }
 
+// Futexes.  Waiters are keyed by the physical address of
+// the user word, so processes that share the page, through
+// shm.c or a shared mapping, meet in the same queue whatever
+// address each has it at.  The page is made private and
+// writable first, or a copy-on-write page would change
+// under the waiter.
+static int*
+futexword(uint addr)
+{
+  struct proc *curproc = myproc();
+  char *page;
+
+  if(addr % 4 != 0 || vmprefault(curproc, addr, 4, 1) < 0)
+    return 0;
+  if((page = uva2ka(curproc->mm->pgdir, (char*)PGROUNDDOWN(addr))) == 0)
+    return 0;
+  return (int*)(page + addr % PGSIZE);
+}
+
+static int
+futexhash(int *key)
+{
+  return (V2P(key) >> 2) % NFUTEXQ;
+}
+
+// Sleep until woken by futexwake() if the word at
+// addr still holds val.  Returns -1 if it does not.
+int
+futexwait(uint addr, int val)
+{
+  struct futexwaiter w, **pp;
+  int h;
+
+  if((w.key = futexword(addr)) == 0)
+    return -1;
+  h = futexhash(w.key);
+  acquire(&futexq[h].lock);
+  if(*w.key != val || myproc()->killed){
+    release(&futexq[h].lock);
+    return -1;
+  }
+  w.next = futexq[h].head;
+  futexq[h].head = &w;
+  sleep(&w, &futexq[h].lock);
+
+  // futexwake() unlinks the waiters it wakes;
+  // anything else (kill) leaves w queued.
+  for(pp = &futexq[h].head; *pp; pp = &(*pp)->next){
+    if(*pp == &w){
+      *pp = w.next;
+      break;
+    }
+  }
+  release(&futexq[h].lock);
+  return 0;
+}
+
+// Wake up to n processes waiting on the word at addr.
+// Returns the number woken.
+int
+futexwake(uint addr, int n)
+{
+  struct futexwaiter *w, **pp;
+  int *key, h, woken;
+
+  if((key = futexword(addr)) == 0)
+    return -1;
+  h = futexhash(key);
+  woken = 0;
+  acquire(&futexq[h].lock);
+  for(pp = &futexq[h].head; (w = *pp) != 0 && woken < n; ){
+    if(w->key != key){
+      pp = &w->next;
+      continue;
+    }
+    *pp = w->next;
+    wakeup(w);
+    woken++;
+  }
+  release(&futexq[h].lock);
+  return woken;
+}
+
 //PAGEBREAK: 36
 // Print a process listing to console.  For debugging.
 // Runs when user types ^P on console.
@@ -523,7 +1211,7 @@ procdump(void)
       state = states[p->state];
     else
       state = "???";
-    cprintf("%d %s %s", p->pid, state, p->name);
+    cprintf("%d %s %s %d", p->pid, state, p->name, p->cputime);
     if(p->state == SLEEPING){
       getcallerpcs((uint*)p->context->ebp+2, pc);
       for(i=0; i<10 && pc[i] != 0; i++)
@@ -8,6 +8,9 @@ struct cpu {
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
   struct proc *proc;           // The process running on this cpu or null
+  volatile int idle;           // Halted in idle(), waiting for an interrupt
+  volatile uint tlbflushes;    // TLB flushes done for other CPUs
+  volatile uint rcuqs;         // RCU quiescent states passed
 };
 
 extern struct cpu cpus[NCPU];
@@ -34,10 +37,38 @@ struct context {
 
 enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
-// Per-process state
-struct proc {
+// A region of user memory whose pages are filled on demand
+// from a file, or with zeroes (see vmfault in vm.c).
+struct vma {
+  uint start;                  // First address (page aligned)
+  uint end;                    // One past the last address; 0 if unused
+  int flags;                   // VMA_ flags below
+  struct inode *ip;            // Backing file, or 0 if anonymous
+  struct shm *shm;             // Backing shared-memory segment, or 0
+  uint off;                    // File offset of start
+  uint filesz;                 // Bytes of file data; the rest reads as zero
+};
+
+#define VMA_WRITE   0x1        // Writable (private copy made on write)
+#define VMA_SHARED  0x2        // Writes go to pages shared with others
+#define VMA_MMAP    0x4        // Made by mmap; lies above sz
+
+// A user address space.  The threads made by clone() share
+// their creator's.  See vm.c.
+struct mm {
+  int ref;                     // Threads using it; 0 if free
+  int busy;                    // Held by mmlock()
   uint sz;                     // Size of process memory (bytes)
   pde_t* pgdir;                // Page table
+  struct vma vma[NVMA];        // Demand-paged memory regions
+};
+
+// Per-process state.  Each thread is a process of its own,
+// sharing its memory, open files and current directory with
+// the thread that cloned it.  Kernel threads have no mm or
+// files and never run in user space.
+struct proc {
+  struct mm *mm;               // Address space
   char *kstack;                // Bottom of kernel stack for this process
   enum procstate state;        // Process state
   int pid;                     // Process ID
@@ -45,9 +76,18 @@ struct proc {
   struct trapframe *tf;        // Trap frame for current syscall
   struct context *context;     // swtch() here to run process
   void *chan;                  // If non-zero, sleeping on chan
+  struct proc *sqnext;         // Next process in chan's sleep queue
+  int cpu;                     // Run queue the process belongs on
+  struct proc *rqnext;         // Next process on the run queue
+  int policy;                  // SCHED_OTHER or SCHED_FIFO (sched.h)
+  int nice;                    // SCHED_OTHER weight, NICE_MIN..NICE_MAX
+  int rtprio;                  // SCHED_FIFO priority, 1..RTPRIO_MAX
+  uint vruntime;               // Weighted CPU time, for SCHED_OTHER
+  uint cputime;                // Clock ticks spent running
   int killed;                  // If non-zero, have been killed
-  struct file *ofile[NOFILE];  // Open files
-  struct inode *cwd;           // Current directory
+  struct files *files;         // Open files and current directory
+  int thread;                  // If non-zero, made by clone()
+  uint ustack;                 // User stack given to clone(), for join()
   char name[16];               // Process name (debugging)
 };
 
@@ -56,3 +96,5 @@ struct proc {
 //   original data and bss
 //   fixed-size stack
 //   expandable heap
+// followed by a gap and then the regions made by mmap(),
+// which are allocated downward from KERNBASE.
@@ -0,0 +1,116 @@
+// Read-copy update.
+//
+// Readers of an RCU-protected structure take no lock: they
+// bracket the read with rcureadlock() and rcureadunlock(), which
+// only keep the CPU from switching to another process, and must
+// not sleep in between.  A writer makes a new copy of whatever it
+// changes and publishes it with a single pointer store; it must
+// not free the old copy until every reader that might have seen
+// it is done.
+//
+// A CPU that switches processes in sched(), takes a clock tick
+// in user space or sits idle cannot be inside a read section.
+// Each CPU counts these quiescent states in rcuqs.  Once every
+// other CPU has passed one, all the readers that started before
+// have finished; that is a grace period.
+//
+// Interface:
+// * rcusync() waits for a grace period.
+// * callrcu(h, fn) arranges for the rcu kernel thread to call
+//   fn(h) after a grace period, without waiting.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "rcu.h"
+
+struct {
+  struct spinlock lock;
+  struct rcuhead *head;   // callbacks waiting for a grace period
+} rcu;
+
+void
+rcureadlock(void)
+{
+  pushcli();
+}
+
+void
+rcureadunlock(void)
+{
+  popcli();
+}
+
+// Wait until every CPU has passed through a quiescent state.
+// Must be called from a process, outside any read section
+// and holding no spin locks.
+void
+rcusync(void)
+{
+  struct cpu *c, *me;
+  uint qs[NCPU];
+
+  // Our own CPU is quiescent right now.
+  pushcli();
+  me = mycpu();
+  for(c = cpus; c < &cpus[ncpu]; c++)
+    qs[c - cpus] = c->rcuqs;
+  popcli();
+
+  for(c = cpus; c < &cpus[ncpu]; c++)
+    while(c != me && c->rcuqs == qs[c - cpus] && !c->idle)
+      yield();
+}
+
+// Call fn(h) after a grace period.
+void
+callrcu(struct rcuhead *h, void (*fn)(struct rcuhead*))
+{
+  h->fn = fn;
+  acquire(&rcu.lock);
+  h->next = rcu.head;
+  rcu.head = h;
+  wakeup(&rcu);
+  release(&rcu.lock);
+}
+
+static void
+rcuthread(void *arg)
+{
+  struct rcuhead *h, *next;
+
+  for(;;){
+    acquire(&rcu.lock);
+    while(rcu.head == 0)
+      sleep(&rcu, &rcu.lock);
+    h = rcu.head;
+    rcu.head = 0;
+    release(&rcu.lock);
+
+    rcusync();
+    for(; h; h = next){
+      next = h->next;
+      h->fn(h);
+    }
+  }
+}
+
+void
+rcuinit(void)
+{
+  initlock(&rcu.lock, "rcu");
+}
+
+// Start the kernel thread that runs callbacks.
+// Must come after userinit().  Callbacks queued before
+// then wait for it.
+void
+rcustart(void)
+{
+  if(kthread("rcu", rcuthread, 0) < 0)
+    panic("rcustart");
+}
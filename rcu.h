@@ -0,0 +1,6 @@
+// Link for a callback waiting for an RCU grace period
+// (see callrcu in rcu.c).  Embed one in the object to be freed.
+struct rcuhead {
+  struct rcuhead *next;
+  void (*fn)(struct rcuhead*);
+};
@@ -0,0 +1,7 @@
+// Scheduling classes, for setpriority().
+#define SCHED_OTHER  0   // time-shared by weight (nice value)
+#define SCHED_FIFO   1   // real-time, run until block or yield
+
+#define NICE_MIN   (-20)
+#define NICE_MAX     19
+#define RTPRIO_MAX   99  // SCHED_FIFO priorities are 1..RTPRIO_MAX
@@ -0,0 +1,160 @@
+// Named shared-memory segments.
+//
+// A segment is a set of zeroed physical pages with a name.
+// Processes attach a segment by name and get it mapped into
+// their address space as a shared memory region (see shmmap in
+// vm.c), so that they all see the same pages without copying.
+//
+// Interface:
+// * shmcreate(name, size) makes a new segment, attached once.
+// * shmlookup(name) finds a segment and attaches it once more.
+// * shmdup() and shmput() count attachments; a segment is
+//   freed when its last attachment is gone.
+// * shmpage() returns one of a segment's pages.
+//
+// Each mapped page also carries a page reference (see kalloc.c),
+// so a page stays valid for as long as some page table maps it.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+
+#define SHMNAME   16   // longest segment name, with nul
+
+struct shm {
+  char name[SHMNAME];
+  int ref;                     // attachments; 0 if unused
+  uint npages;
+  char *pages[SHMMAXPG];
+};
+
+struct {
+  struct spinlock lock;
+  struct shm seg[NSHM];
+} shmtab;
+
+void
+shminit(void)
+{
+  initlock(&shmtab.lock, "shm");
+}
+
+// Look for the segment called name.
+// Caller must hold shmtab.lock.
+static struct shm*
+shmfind(char *name)
+{
+  struct shm *s;
+
+  for(s = shmtab.seg; s < &shmtab.seg[NSHM]; s++)
+    if(s->ref > 0 && strncmp(s->name, name, SHMNAME) == 0)
+      return s;
+  return 0;
+}
+
+// Free the pages in pages[0..n-1].
+static void
+freepages(char **pages, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++)
+    kfree(pages[i]);
+}
+
+// Make a segment of size bytes called name.
+// Returns the segment with one attachment, or 0 if the
+// name is taken, the table is full or memory runs out.
+struct shm*
+shmcreate(char *name, uint size)
+{
+  struct shm *s, *fs;
+  char *pages[SHMMAXPG];
+  int i, n;
+
+  n = PGROUNDUP(size) / PGSIZE;
+  if(size == 0 || n > SHMMAXPG)
+    return 0;
+  for(i = 0; i < n; i++){
+    if((pages[i] = kalloc()) == 0){
+      freepages(pages, i);
+      return 0;
+    }
+    memset(pages[i], 0, PGSIZE);
+  }
+
+  acquire(&shmtab.lock);
+  fs = 0;
+  for(s = shmtab.seg; s < &shmtab.seg[NSHM]; s++)
+    if(s->ref == 0){
+      fs = s;
+      break;
+    }
+  if(fs == 0 || shmfind(name)){
+    release(&shmtab.lock);
+    freepages(pages, n);
+    return 0;
+  }
+  safestrcpy(fs->name, name, SHMNAME);
+  fs->ref = 1;
+  fs->npages = n;
+  memmove(fs->pages, pages, n * sizeof(pages[0]));
+  release(&shmtab.lock);
+  return fs;
+}
+
+// Find the segment called name and attach it once more.
+struct shm*
+shmlookup(char *name)
+{
+  struct shm *s;
+
+  acquire(&shmtab.lock);
+  if((s = shmfind(name)) != 0)
+    s->ref++;
+  release(&shmtab.lock);
+  return s;
+}
+
+void
+shmdup(struct shm *s)
+{
+  acquire(&shmtab.lock);
+  if(s->ref < 1)
+    panic("shmdup");
+  s->ref++;
+  release(&shmtab.lock);
+}
+
+// Drop an attachment to s, freeing it if it was the last.
+void
+shmput(struct shm *s)
+{
+  acquire(&shmtab.lock);
+  if(s->ref < 1)
+    panic("shmput");
+  if(--s->ref == 0){
+    freepages(s->pages, s->npages);
+    s->npages = 0;
+  }
+  release(&shmtab.lock);
+}
+
+// Return the page of s at byte offset off, or 0.
+// The caller must hold an attachment to s.
+char*
+shmpage(struct shm *s, uint off)
+{
+  if(off / PGSIZE >= s->npages)
+    return 0;
+  return s->pages[off / PGSIZE];
+}
+
+// Return the size of s in bytes.
+uint
+shmsize(struct shm *s)
+{
+  return s->npages * PGSIZE;
+}
@@ -8,13 +8,70 @@
 #include "mmu.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "lockstat.h"
+
+// Contention counters, one record per lock name.  Every lock of
+// a name adds into the same record, so the counts for names such
+// as "proc" are totals over all of those locks; the updates are
+// atomic, since several such locks may be held at once.
+//
+// initlock() runs before this CPU is known to mycpu() (kinit1()
+// comes before mpinit()), so it can't take a lock: a record is
+// claimed by moving its state from LS_FREE to LS_CLAIMED with a
+// compare-and-swap, and becomes visible as LS_READY once it has
+// its name.
+#define LS_FREE     0
+#define LS_CLAIMED  1
+#define LS_READY    2
+
+static struct lockstat lockstats[NLOCKSTAT];
+static int lsstate[NLOCKSTAT];
+
+// Return the counters for locks called name, or 0 if the
+// table is full.
+static struct lockstat*
+lockstatfor(char *name)
+{
+  int i;
+
+  for(i = 0; i < NLOCKSTAT; i++){
+    if(lsstate[i] == LS_FREE &&
+       __sync_bool_compare_and_swap(&lsstate[i], LS_FREE, LS_CLAIMED)){
+      safestrcpy(lockstats[i].name, name, sizeof(lockstats[i].name));
+      __sync_synchronize();
+      lsstate[i] = LS_READY;
+      return &lockstats[i];
+    }
+    // Someone else is naming it; wait to see the name.
+    while(*(volatile int*)&lsstate[i] != LS_READY)
+      pause();
+    if(strncmp(lockstats[i].name, name, sizeof(lockstats[i].name)) == 0)
+      return &lockstats[i];
+  }
+  return 0;
+}
 
 void
 initlock(struct spinlock *lk, char *name)
 {
   lk->name = name;
-  lk->locked = 0;
+  lk->next = 0;
+  lk->owner = 0;
   lk->cpu = 0;
+  lk->stat = lockstatfor(name);
+}
+
+// Raise *p to v, if v is bigger.
+static void
+atomicmax(uint64_t *p, uint64_t v)
+{
+  uint64_t o;
+
+  do {
+    o = *(volatile uint64_t*)p;
+    if(v <= o)
+      return;
+  } while(!__sync_bool_compare_and_swap(p, o, v));
 }
 
 // Acquire the lock.
@@ -24,13 +81,24 @@ initlock(struct spinlock *lk, char *name)
 void
 acquire(struct spinlock *lk)
 {
+  uint t;
+  uint64_t t0, spin;
+
   pushcli(); // disable interrupts to avoid deadlock.
   if(holding(lk))
     panic("acquire");
 
-  // The xchg is atomic.
-  while(xchg(&lk->locked, 1) != 0)
-    ;
+  // Take a ticket; the lock xadd is atomic.  Then wait for our
+  // turn, reading owner only, so that waiting CPUs share its
+  // cache line instead of fighting over it.
+  t = __sync_fetch_and_add(&lk->next, 1);
+  spin = 0;
+  if(*(volatile uint*)&lk->owner != t){
+    t0 = rdtsc();
+    while(*(volatile uint*)&lk->owner != t)
+      pause();
+    spin = rdtsc() - t0;
+  }
 
   // Tell the C compiler and the processor to not move loads or stores
   // past this point, to ensure that the critical section's memory
@@ -40,15 +108,31 @@ acquire(struct spinlock *lk)
   // Record info about lock acquisition for debugging.
   lk->cpu = mycpu();
   getcallerpcs(&lk, lk->pcs);
+
+  if(lk->stat){
+    __sync_fetch_and_add(&lk->stat->acquires, 1);
+    if(spin){
+      __sync_fetch_and_add(&lk->stat->contended, 1);
+      __sync_fetch_and_add(&lk->stat->spin, spin);
+    }
+  }
+  lk->start = rdtsc();
 }
 
 // Release the lock.
 void
 release(struct spinlock *lk)
 {
+  uint64_t held;
+
   if(!holding(lk))
     panic("release");
 
+  if(lk->stat){
+    held = rdtsc() - lk->start;
+    atomicmax(&lk->stat->maxhold, held);
+  }
+
   lk->pcs[0] = 0;
   lk->cpu = 0;
 
@@ -59,14 +143,25 @@ release(struct spinlock *lk)
   // stores; __sync_synchronize() tells them both not to.
   __sync_synchronize();
 
-  // Release the lock, equivalent to lk->locked = 0.
-  // This code can't use a C assignment, since it might
-  // not be atomic. A real OS would use C atomics here.
-  asm volatile("movl $0, %0" : "+m" (lk->locked) : );
+  // Hand the lock to the next ticket.  Only the holder writes
+  // owner, so a plain increment is enough; the asm keeps the
+  // compiler from splitting or moving it.
+  asm volatile("incl %0" : "+m" (lk->owner) : );
 
   popcli();
 }
 
+// Copy the counters of the i'th kind of lock into *ls.
+// Returns -1 if there is no such lock.
+int
+lockstatget(int i, struct lockstat *ls)
+{
+  if(i < 0 || i >= NLOCKSTAT || lsstate[i] != LS_READY)
+    return -1;
+  *ls = lockstats[i];
+  return 0;
+}
+
 // Record the current call stack in pcs[] by following the %ebp chain.
 void
 getcallerpcs(void *v, uint pcs[])
@@ -89,7 +184,7 @@ getcallerpcs(void *v, uint pcs[])
 int
 holding(struct spinlock *lock)
 {
-  return lock->locked && lock->cpu == mycpu();
+  return lock->owner != lock->next && lock->cpu == mycpu();
 }
 
 
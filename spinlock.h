@@ -1,11 +1,19 @@
 // Mutual exclusion lock.
+// A ticket lock: each CPU that wants the lock takes the next
+// ticket and waits until owner reaches it, so that waiting CPUs
+// get the lock in the order they asked for it.
 struct spinlock {
-  uint locked;       // Is the lock held?
+  uint next;         // Next ticket to hand out.
+  uint owner;        // Ticket of the holder, or next if free.
 
   // For debugging:
   char *name;        // Name of lock.
   struct cpu *cpu;   // The cpu holding the lock.
   uint pcs[10];      // The call stack (an array of program counters)
                      // that locked the lock.
+
+  // For profiling:
+  struct lockstat *stat;  // Counters shared by locks of this name.
+  uint64_t start;    // TSC when the lock was acquired.
 };
 
@@ -0,0 +1,1309 @@
+
+_stressfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fs.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+  int fd, i;
+  char path[] = "stressfs0";
+   7:	b8 30 00 00 00       	mov    $0x30,%eax
+{
+   c:	ff 71 fc             	push   -0x4(%ecx)
+   f:	55                   	push   %ebp
+  10:	89 e5                	mov    %esp,%ebp
+  12:	57                   	push   %edi
+  13:	56                   	push   %esi
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+  memset(data, 'a', sizeof(data));
+  14:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+{
+  1a:	53                   	push   %ebx
+
+  for(i = 0; i < 4; i++)
+  1b:	31 db                	xor    %ebx,%ebx
+{
+  1d:	51                   	push   %ecx
+  1e:	81 ec 20 02 00 00    	sub    $0x220,%esp
+  char path[] = "stressfs0";
+  24:	66 89 85 e6 fd ff ff 	mov    %ax,-0x21a(%ebp)
+  2b:	c7 85 de fd ff ff 73 	movl   $0x65727473,-0x222(%ebp)
+  32:	74 72 65 
+  35:	c7 85 e2 fd ff ff 73 	movl   $0x73667373,-0x21e(%ebp)
+  3c:	73 66 73 
+  printf(1, "stressfs starting\n");
+  3f:	68 58 08 00 00       	push   $0x858
+  44:	6a 01                	push   $0x1
+  46:	e8 e5 04 00 00       	call   530 <printf>
+  memset(data, 'a', sizeof(data));
+  4b:	83 c4 0c             	add    $0xc,%esp
+  4e:	68 00 02 00 00       	push   $0x200
+  53:	6a 61                	push   $0x61
+  55:	56                   	push   %esi
+  56:	e8 25 01 00 00       	call   180 <memset>
+  5b:	83 c4 10             	add    $0x10,%esp
+    if(fork() > 0)
+  5e:	e8 f9 02 00 00       	call   35c <fork>
+  63:	85 c0                	test   %eax,%eax
+  65:	7f 08                	jg     6f <main+0x6f>
+  for(i = 0; i < 4; i++)
+  67:	83 c3 01             	add    $0x1,%ebx
+  6a:	83 fb 04             	cmp    $0x4,%ebx
+  6d:	75 ef                	jne    5e <main+0x5e>
+      break;
+
+  printf(1, "write %d\n", i);
+  6f:	83 ec 04             	sub    $0x4,%esp
+  72:	53                   	push   %ebx
+  73:	68 6b 08 00 00       	push   $0x86b
+  78:	6a 01                	push   $0x1
+  7a:	e8 b1 04 00 00       	call   530 <printf>
+
+  path[8] += i;
+  7f:	00 9d e6 fd ff ff    	add    %bl,-0x21a(%ebp)
+  fd = open(path, O_CREATE | O_RDWR);
+  85:	5f                   	pop    %edi
+  86:	bb 14 00 00 00       	mov    $0x14,%ebx
+  8b:	58                   	pop    %eax
+  8c:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  92:	68 02 02 00 00       	push   $0x202
+  97:	50                   	push   %eax
+  98:	e8 07 03 00 00       	call   3a4 <open>
+  9d:	83 c4 10             	add    $0x10,%esp
+  a0:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < 20; i++)
+  a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+//    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+  a8:	83 ec 04             	sub    $0x4,%esp
+  ab:	68 00 02 00 00       	push   $0x200
+  b0:	56                   	push   %esi
+  b1:	57                   	push   %edi
+  b2:	e8 cd 02 00 00       	call   384 <write>
+  for(i = 0; i < 20; i++)
+  b7:	83 c4 10             	add    $0x10,%esp
+  ba:	83 eb 01             	sub    $0x1,%ebx
+  bd:	75 e9                	jne    a8 <main+0xa8>
+  close(fd);
+  bf:	83 ec 0c             	sub    $0xc,%esp
+  c2:	57                   	push   %edi
+  c3:	e8 c4 02 00 00       	call   38c <close>
+
+  printf(1, "read\n");
+  c8:	58                   	pop    %eax
+  c9:	5a                   	pop    %edx
+  ca:	68 75 08 00 00       	push   $0x875
+  cf:	6a 01                	push   $0x1
+  d1:	e8 5a 04 00 00       	call   530 <printf>
+
+  fd = open(path, O_RDONLY);
+  d6:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  dc:	59                   	pop    %ecx
+  dd:	5b                   	pop    %ebx
+  de:	6a 00                	push   $0x0
+  e0:	bb 14 00 00 00       	mov    $0x14,%ebx
+  e5:	50                   	push   %eax
+  e6:	e8 b9 02 00 00       	call   3a4 <open>
+  eb:	83 c4 10             	add    $0x10,%esp
+  ee:	89 c7                	mov    %eax,%edi
+  for (i = 0; i < 20; i++)
+    read(fd, data, sizeof(data));
+  f0:	83 ec 04             	sub    $0x4,%esp
+  f3:	68 00 02 00 00       	push   $0x200
+  f8:	56                   	push   %esi
+  f9:	57                   	push   %edi
+  fa:	e8 7d 02 00 00       	call   37c <read>
+  for (i = 0; i < 20; i++)
+  ff:	83 c4 10             	add    $0x10,%esp
+ 102:	83 eb 01             	sub    $0x1,%ebx
+ 105:	75 e9                	jne    f0 <main+0xf0>
+  close(fd);
+ 107:	83 ec 0c             	sub    $0xc,%esp
+ 10a:	57                   	push   %edi
+ 10b:	e8 7c 02 00 00       	call   38c <close>
+
+  wait();
+ 110:	e8 57 02 00 00       	call   36c <wait>
+
+  exit();
+ 115:	e8 4a 02 00 00       	call   364 <exit>
+ 11a:	66 90                	xchg   %ax,%ax
+ 11c:	66 90                	xchg   %ax,%ax
+ 11e:	66 90                	xchg   %ax,%ax
+
+00000120 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 120:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 121:	31 c0                	xor    %eax,%eax
+{
+ 123:	89 e5                	mov    %esp,%ebp
+ 125:	53                   	push   %ebx
+ 126:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 129:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 130:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 134:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 137:	83 c0 01             	add    $0x1,%eax
+ 13a:	84 d2                	test   %dl,%dl
+ 13c:	75 f2                	jne    130 <strcpy+0x10>
+    ;
+  return os;
+}
+ 13e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 141:	89 c8                	mov    %ecx,%eax
+ 143:	c9                   	leave
+ 144:	c3                   	ret
+ 145:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 156:	80 3a 00             	cmpb   $0x0,(%edx)
+ 159:	74 15                	je     170 <strlen+0x20>
+ 15b:	31 c0                	xor    %eax,%eax
+ 15d:	8d 76 00             	lea    0x0(%esi),%esi
+ 160:	83 c0 01             	add    $0x1,%eax
+ 163:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 167:	89 c1                	mov    %eax,%ecx
+ 169:	75 f5                	jne    160 <strlen+0x10>
+    ;
+  return n;
+}
+ 16b:	89 c8                	mov    %ecx,%eax
+ 16d:	5d                   	pop    %ebp
+ 16e:	c3                   	ret
+ 16f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 170:	31 c9                	xor    %ecx,%ecx
+}
+ 172:	5d                   	pop    %ebp
+ 173:	89 c8                	mov    %ecx,%eax
+ 175:	c3                   	ret
+ 176:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000180 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	57                   	push   %edi
+ 184:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 187:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 18a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 18d:	89 d7                	mov    %edx,%edi
+ 18f:	fc                   	cld
+ 190:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 192:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 195:	89 d0                	mov    %edx,%eax
+ 197:	c9                   	leave
+ 198:	c3                   	ret
+ 199:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1aa:	0f b6 10             	movzbl (%eax),%edx
+ 1ad:	84 d2                	test   %dl,%dl
+ 1af:	75 12                	jne    1c3 <strchr+0x23>
+ 1b1:	eb 1d                	jmp    1d0 <strchr+0x30>
+ 1b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1b7:	90                   	nop
+ 1b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1bc:	83 c0 01             	add    $0x1,%eax
+ 1bf:	84 d2                	test   %dl,%dl
+ 1c1:	74 0d                	je     1d0 <strchr+0x30>
+    if(*s == c)
+ 1c3:	38 d1                	cmp    %dl,%cl
+ 1c5:	75 f1                	jne    1b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1c7:	5d                   	pop    %ebp
+ 1c8:	c3                   	ret
+ 1c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 1d0:	31 c0                	xor    %eax,%eax
+}
+ 1d2:	5d                   	pop    %ebp
+ 1d3:	c3                   	ret
+ 1d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1df:	90                   	nop
+
+000001e0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1e5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1e8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1e9:	31 db                	xor    %ebx,%ebx
+{
+ 1eb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1ee:	eb 27                	jmp    217 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1f0:	83 ec 04             	sub    $0x4,%esp
+ 1f3:	6a 01                	push   $0x1
+ 1f5:	56                   	push   %esi
+ 1f6:	6a 00                	push   $0x0
+ 1f8:	e8 7f 01 00 00       	call   37c <read>
+    if(cc < 1)
+ 1fd:	83 c4 10             	add    $0x10,%esp
+ 200:	85 c0                	test   %eax,%eax
+ 202:	7e 1d                	jle    221 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 204:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 208:	8b 55 08             	mov    0x8(%ebp),%edx
+ 20b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 20f:	3c 0a                	cmp    $0xa,%al
+ 211:	74 10                	je     223 <gets+0x43>
+ 213:	3c 0d                	cmp    $0xd,%al
+ 215:	74 0c                	je     223 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 217:	89 df                	mov    %ebx,%edi
+ 219:	83 c3 01             	add    $0x1,%ebx
+ 21c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 21f:	7c cf                	jl     1f0 <gets+0x10>
+ 221:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 223:	8b 45 08             	mov    0x8(%ebp),%eax
+ 226:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 22a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 22d:	5b                   	pop    %ebx
+ 22e:	5e                   	pop    %esi
+ 22f:	5f                   	pop    %edi
+ 230:	5d                   	pop    %ebp
+ 231:	c3                   	ret
+ 232:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 239:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000240 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	56                   	push   %esi
+ 244:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 245:	83 ec 08             	sub    $0x8,%esp
+ 248:	6a 00                	push   $0x0
+ 24a:	ff 75 08             	push   0x8(%ebp)
+ 24d:	e8 52 01 00 00       	call   3a4 <open>
+  if(fd < 0)
+ 252:	83 c4 10             	add    $0x10,%esp
+ 255:	85 c0                	test   %eax,%eax
+ 257:	78 27                	js     280 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 259:	83 ec 08             	sub    $0x8,%esp
+ 25c:	ff 75 0c             	push   0xc(%ebp)
+ 25f:	89 c3                	mov    %eax,%ebx
+ 261:	50                   	push   %eax
+ 262:	e8 55 01 00 00       	call   3bc <fstat>
+  close(fd);
+ 267:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 26a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 26c:	e8 1b 01 00 00       	call   38c <close>
+  return r;
+ 271:	83 c4 10             	add    $0x10,%esp
+}
+ 274:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 277:	89 f0                	mov    %esi,%eax
+ 279:	5b                   	pop    %ebx
+ 27a:	5e                   	pop    %esi
+ 27b:	5d                   	pop    %ebp
+ 27c:	c3                   	ret
+ 27d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 280:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 285:	eb ed                	jmp    274 <stat+0x34>
+ 287:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28e:	66 90                	xchg   %ax,%ax
+
+00000290 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	57                   	push   %edi
+ 294:	56                   	push   %esi
+ 295:	8b 45 10             	mov    0x10(%ebp),%eax
+ 298:	8b 55 08             	mov    0x8(%ebp),%edx
+ 29b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 29e:	85 c0                	test   %eax,%eax
+ 2a0:	7e 13                	jle    2b5 <memmove+0x25>
+ 2a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2a4:	89 d7                	mov    %edx,%edi
+ 2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2b1:	39 f8                	cmp    %edi,%eax
+ 2b3:	75 fb                	jne    2b0 <memmove+0x20>
+  return vdst;
+}
+ 2b5:	5e                   	pop    %esi
+ 2b6:	89 d0                	mov    %edx,%eax
+ 2b8:	5f                   	pop    %edi
+ 2b9:	5d                   	pop    %ebp
+ 2ba:	c3                   	ret
+ 2bb:	66 90                	xchg   %ax,%ax
+ 2bd:	66 90                	xchg   %ax,%ax
+ 2bf:	90                   	nop
+
+000002c0 <strcmp>:
+#include "types.h"
+#include "util.h"
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	53                   	push   %ebx
+ 2c4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 2ca:	0f b6 02             	movzbl (%edx),%eax
+ 2cd:	84 c0                	test   %al,%al
+ 2cf:	75 17                	jne    2e8 <strcmp+0x28>
+ 2d1:	eb 3a                	jmp    30d <strcmp+0x4d>
+ 2d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2d7:	90                   	nop
+ 2d8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 2dc:	83 c2 01             	add    $0x1,%edx
+ 2df:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 2e2:	84 c0                	test   %al,%al
+ 2e4:	74 1a                	je     300 <strcmp+0x40>
+    p++, q++;
+ 2e6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 2e8:	0f b6 19             	movzbl (%ecx),%ebx
+ 2eb:	38 c3                	cmp    %al,%bl
+ 2ed:	74 e9                	je     2d8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 2ef:	29 d8                	sub    %ebx,%eax
+}
+ 2f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2f4:	c9                   	leave
+ 2f5:	c3                   	ret
+ 2f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 300:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 304:	31 c0                	xor    %eax,%eax
+ 306:	29 d8                	sub    %ebx,%eax
+}
+ 308:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 30b:	c9                   	leave
+ 30c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 30d:	0f b6 19             	movzbl (%ecx),%ebx
+ 310:	31 c0                	xor    %eax,%eax
+ 312:	eb db                	jmp    2ef <strcmp+0x2f>
+ 314:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 31f:	90                   	nop
+
+00000320 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	53                   	push   %ebx
+ 324:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 327:	0f be 02             	movsbl (%edx),%eax
+ 32a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 32d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 330:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 335:	77 1e                	ja     355 <atoi+0x35>
+ 337:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 340:	83 c2 01             	add    $0x1,%edx
+ 343:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 346:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 34a:	0f be 02             	movsbl (%edx),%eax
+ 34d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 350:	80 fb 09             	cmp    $0x9,%bl
+ 353:	76 eb                	jbe    340 <atoi+0x20>
+  return n;
+ 355:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 358:	89 c8                	mov    %ecx,%eax
+ 35a:	c9                   	leave
+ 35b:	c3                   	ret
+
+0000035c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 35c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 361:	cd 40                	int    $0x40
+ 363:	c3                   	ret
+
+00000364 <exit>:
+SYSCALL(exit)
+ 364:	b8 02 00 00 00       	mov    $0x2,%eax
+ 369:	cd 40                	int    $0x40
+ 36b:	c3                   	ret
+
+0000036c <wait>:
+SYSCALL(wait)
+ 36c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 371:	cd 40                	int    $0x40
+ 373:	c3                   	ret
+
+00000374 <pipe>:
+SYSCALL(pipe)
+ 374:	b8 04 00 00 00       	mov    $0x4,%eax
+ 379:	cd 40                	int    $0x40
+ 37b:	c3                   	ret
+
+0000037c <read>:
+SYSCALL(read)
+ 37c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 381:	cd 40                	int    $0x40
+ 383:	c3                   	ret
+
+00000384 <write>:
+SYSCALL(write)
+ 384:	b8 10 00 00 00       	mov    $0x10,%eax
+ 389:	cd 40                	int    $0x40
+ 38b:	c3                   	ret
+
+0000038c <close>:
+SYSCALL(close)
+ 38c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 391:	cd 40                	int    $0x40
+ 393:	c3                   	ret
+
+00000394 <kill>:
+SYSCALL(kill)
+ 394:	b8 06 00 00 00       	mov    $0x6,%eax
+ 399:	cd 40                	int    $0x40
+ 39b:	c3                   	ret
+
+0000039c <exec>:
+SYSCALL(exec)
+ 39c:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3a1:	cd 40                	int    $0x40
+ 3a3:	c3                   	ret
+
+000003a4 <open>:
+SYSCALL(open)
+ 3a4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3a9:	cd 40                	int    $0x40
+ 3ab:	c3                   	ret
+
+000003ac <mknod>:
+SYSCALL(mknod)
+ 3ac:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3b1:	cd 40                	int    $0x40
+ 3b3:	c3                   	ret
+
+000003b4 <unlink>:
+SYSCALL(unlink)
+ 3b4:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3b9:	cd 40                	int    $0x40
+ 3bb:	c3                   	ret
+
+000003bc <fstat>:
+SYSCALL(fstat)
+ 3bc:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3c1:	cd 40                	int    $0x40
+ 3c3:	c3                   	ret
+
+000003c4 <link>:
+SYSCALL(link)
+ 3c4:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3c9:	cd 40                	int    $0x40
+ 3cb:	c3                   	ret
+
+000003cc <mkdir>:
+SYSCALL(mkdir)
+ 3cc:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3d1:	cd 40                	int    $0x40
+ 3d3:	c3                   	ret
+
+000003d4 <chdir>:
+SYSCALL(chdir)
+ 3d4:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3d9:	cd 40                	int    $0x40
+ 3db:	c3                   	ret
+
+000003dc <dup>:
+SYSCALL(dup)
+ 3dc:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3e1:	cd 40                	int    $0x40
+ 3e3:	c3                   	ret
+
+000003e4 <getpid>:
+SYSCALL(getpid)
+ 3e4:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3e9:	cd 40                	int    $0x40
+ 3eb:	c3                   	ret
+
+000003ec <sbrk>:
+SYSCALL(sbrk)
+ 3ec:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3f1:	cd 40                	int    $0x40
+ 3f3:	c3                   	ret
+
+000003f4 <sleep>:
+SYSCALL(sleep)
+ 3f4:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3f9:	cd 40                	int    $0x40
+ 3fb:	c3                   	ret
+
+000003fc <uptime>:
+SYSCALL(uptime)
+ 3fc:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 401:	cd 40                	int    $0x40
+ 403:	c3                   	ret
+
+00000404 <arp>:
+SYSCALL(arp)
+ 404:	b8 16 00 00 00       	mov    $0x16,%eax
+ 409:	cd 40                	int    $0x40
+ 40b:	c3                   	ret
+
+0000040c <mmap>:
+SYSCALL(mmap)
+ 40c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 411:	cd 40                	int    $0x40
+ 413:	c3                   	ret
+
+00000414 <munmap>:
+SYSCALL(munmap)
+ 414:	b8 18 00 00 00       	mov    $0x18,%eax
+ 419:	cd 40                	int    $0x40
+ 41b:	c3                   	ret
+
+0000041c <msync>:
+SYSCALL(msync)
+ 41c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 421:	cd 40                	int    $0x40
+ 423:	c3                   	ret
+
+00000424 <shmcreate>:
+SYSCALL(shmcreate)
+ 424:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 429:	cd 40                	int    $0x40
+ 42b:	c3                   	ret
+
+0000042c <shmattach>:
+SYSCALL(shmattach)
+ 42c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 431:	cd 40                	int    $0x40
+ 433:	c3                   	ret
+
+00000434 <shmdetach>:
+SYSCALL(shmdetach)
+ 434:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 439:	cd 40                	int    $0x40
+ 43b:	c3                   	ret
+
+0000043c <futex_wait>:
+SYSCALL(futex_wait)
+ 43c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 441:	cd 40                	int    $0x40
+ 443:	c3                   	ret
+
+00000444 <futex_wake>:
+SYSCALL(futex_wake)
+ 444:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 449:	cd 40                	int    $0x40
+ 44b:	c3                   	ret
+
+0000044c <nice>:
+SYSCALL(nice)
+ 44c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 451:	cd 40                	int    $0x40
+ 453:	c3                   	ret
+
+00000454 <setpriority>:
+SYSCALL(setpriority)
+ 454:	b8 20 00 00 00       	mov    $0x20,%eax
+ 459:	cd 40                	int    $0x40
+ 45b:	c3                   	ret
+
+0000045c <cputime>:
+SYSCALL(cputime)
+ 45c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 461:	cd 40                	int    $0x40
+ 463:	c3                   	ret
+
+00000464 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 464:	b8 22 00 00 00       	mov    $0x22,%eax
+ 469:	cd 40                	int    $0x40
+ 46b:	c3                   	ret
+
+0000046c <clone>:
+SYSCALL(clone)
+ 46c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 471:	cd 40                	int    $0x40
+ 473:	c3                   	ret
+
+00000474 <join>:
+SYSCALL(join)
+ 474:	b8 24 00 00 00       	mov    $0x24,%eax
+ 479:	cd 40                	int    $0x40
+ 47b:	c3                   	ret
+
+0000047c <lockstat>:
+SYSCALL(lockstat)
+ 47c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 481:	cd 40                	int    $0x40
+ 483:	c3                   	ret
+ 484:	66 90                	xchg   %ax,%ax
+ 486:	66 90                	xchg   %ax,%ax
+ 488:	66 90                	xchg   %ax,%ax
+ 48a:	66 90                	xchg   %ax,%ax
+ 48c:	66 90                	xchg   %ax,%ax
+ 48e:	66 90                	xchg   %ax,%ax
+
+00000490 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	56                   	push   %esi
+ 495:	53                   	push   %ebx
+ 496:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 498:	89 d1                	mov    %edx,%ecx
+{
+ 49a:	83 ec 3c             	sub    $0x3c,%esp
+ 49d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 4a0:	85 d2                	test   %edx,%edx
+ 4a2:	0f 89 80 00 00 00    	jns    528 <printint+0x98>
+ 4a8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 4ac:	74 7a                	je     528 <printint+0x98>
+    x = -xx;
+ 4ae:	f7 d9                	neg    %ecx
+    neg = 1;
+ 4b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 4b5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 4b8:	31 f6                	xor    %esi,%esi
+ 4ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 4c0:	89 c8                	mov    %ecx,%eax
+ 4c2:	31 d2                	xor    %edx,%edx
+ 4c4:	89 f7                	mov    %esi,%edi
+ 4c6:	f7 f3                	div    %ebx
+ 4c8:	8d 76 01             	lea    0x1(%esi),%esi
+ 4cb:	0f b6 92 dc 08 00 00 	movzbl 0x8dc(%edx),%edx
+ 4d2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 4d6:	89 ca                	mov    %ecx,%edx
+ 4d8:	89 c1                	mov    %eax,%ecx
+ 4da:	39 da                	cmp    %ebx,%edx
+ 4dc:	73 e2                	jae    4c0 <printint+0x30>
+  if(neg)
+ 4de:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 4e1:	85 c0                	test   %eax,%eax
+ 4e3:	74 07                	je     4ec <printint+0x5c>
+    buf[i++] = '-';
+ 4e5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 4ea:	89 f7                	mov    %esi,%edi
+ 4ec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 4ef:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 4f2:	01 df                	add    %ebx,%edi
+ 4f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 4f8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 4fb:	83 ec 04             	sub    $0x4,%esp
+ 4fe:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 501:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 504:	6a 01                	push   $0x1
+ 506:	50                   	push   %eax
+ 507:	56                   	push   %esi
+ 508:	e8 77 fe ff ff       	call   384 <write>
+  while(--i >= 0)
+ 50d:	89 f8                	mov    %edi,%eax
+ 50f:	83 c4 10             	add    $0x10,%esp
+ 512:	83 ef 01             	sub    $0x1,%edi
+ 515:	39 d8                	cmp    %ebx,%eax
+ 517:	75 df                	jne    4f8 <printint+0x68>
+}
+ 519:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 51c:	5b                   	pop    %ebx
+ 51d:	5e                   	pop    %esi
+ 51e:	5f                   	pop    %edi
+ 51f:	5d                   	pop    %ebp
+ 520:	c3                   	ret
+ 521:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 528:	31 c0                	xor    %eax,%eax
+ 52a:	eb 89                	jmp    4b5 <printint+0x25>
+ 52c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000530 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	57                   	push   %edi
+ 534:	56                   	push   %esi
+ 535:	53                   	push   %ebx
+ 536:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 539:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 53c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 53f:	0f b6 1e             	movzbl (%esi),%ebx
+ 542:	83 c6 01             	add    $0x1,%esi
+ 545:	84 db                	test   %bl,%bl
+ 547:	74 67                	je     5b0 <printf+0x80>
+ 549:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 54c:	31 d2                	xor    %edx,%edx
+ 54e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 551:	eb 34                	jmp    587 <printf+0x57>
+ 553:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 557:	90                   	nop
+ 558:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 55b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 560:	83 f8 25             	cmp    $0x25,%eax
+ 563:	74 18                	je     57d <printf+0x4d>
+  write(fd, &c, 1);
+ 565:	83 ec 04             	sub    $0x4,%esp
+ 568:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 56b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 56e:	6a 01                	push   $0x1
+ 570:	50                   	push   %eax
+ 571:	57                   	push   %edi
+ 572:	e8 0d fe ff ff       	call   384 <write>
+ 577:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 57a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 57d:	0f b6 1e             	movzbl (%esi),%ebx
+ 580:	83 c6 01             	add    $0x1,%esi
+ 583:	84 db                	test   %bl,%bl
+ 585:	74 29                	je     5b0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 587:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 58a:	85 d2                	test   %edx,%edx
+ 58c:	74 ca                	je     558 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 58e:	83 fa 25             	cmp    $0x25,%edx
+ 591:	75 ea                	jne    57d <printf+0x4d>
+      if(c == 'd'){
+ 593:	83 f8 25             	cmp    $0x25,%eax
+ 596:	0f 84 24 01 00 00    	je     6c0 <printf+0x190>
+ 59c:	83 e8 63             	sub    $0x63,%eax
+ 59f:	83 f8 15             	cmp    $0x15,%eax
+ 5a2:	77 1c                	ja     5c0 <printf+0x90>
+ 5a4:	ff 24 85 84 08 00 00 	jmp    *0x884(,%eax,4)
+ 5ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5af:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 5b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5b3:	5b                   	pop    %ebx
+ 5b4:	5e                   	pop    %esi
+ 5b5:	5f                   	pop    %edi
+ 5b6:	5d                   	pop    %ebp
+ 5b7:	c3                   	ret
+ 5b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5bf:	90                   	nop
+  write(fd, &c, 1);
+ 5c0:	83 ec 04             	sub    $0x4,%esp
+ 5c3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5c6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 5ca:	6a 01                	push   $0x1
+ 5cc:	52                   	push   %edx
+ 5cd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 5d0:	57                   	push   %edi
+ 5d1:	e8 ae fd ff ff       	call   384 <write>
+ 5d6:	83 c4 0c             	add    $0xc,%esp
+ 5d9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5dc:	6a 01                	push   $0x1
+ 5de:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 5e1:	52                   	push   %edx
+ 5e2:	57                   	push   %edi
+ 5e3:	e8 9c fd ff ff       	call   384 <write>
+        putc(fd, c);
+ 5e8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5eb:	31 d2                	xor    %edx,%edx
+ 5ed:	eb 8e                	jmp    57d <printf+0x4d>
+ 5ef:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 5f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5f3:	83 ec 0c             	sub    $0xc,%esp
+ 5f6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 5fb:	8b 13                	mov    (%ebx),%edx
+ 5fd:	6a 00                	push   $0x0
+ 5ff:	89 f8                	mov    %edi,%eax
+        ap++;
+ 601:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 604:	e8 87 fe ff ff       	call   490 <printint>
+        ap++;
+ 609:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 60c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 60f:	31 d2                	xor    %edx,%edx
+ 611:	e9 67 ff ff ff       	jmp    57d <printf+0x4d>
+ 616:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 61d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 620:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 623:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 625:	83 c0 04             	add    $0x4,%eax
+ 628:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 62b:	85 db                	test   %ebx,%ebx
+ 62d:	0f 84 9d 00 00 00    	je     6d0 <printf+0x1a0>
+        while(*s != 0){
+ 633:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 636:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 638:	84 c0                	test   %al,%al
+ 63a:	0f 84 3d ff ff ff    	je     57d <printf+0x4d>
+ 640:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 643:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 646:	89 de                	mov    %ebx,%esi
+ 648:	89 d3                	mov    %edx,%ebx
+ 64a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 650:	83 ec 04             	sub    $0x4,%esp
+ 653:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 656:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 659:	6a 01                	push   $0x1
+ 65b:	53                   	push   %ebx
+ 65c:	57                   	push   %edi
+ 65d:	e8 22 fd ff ff       	call   384 <write>
+        while(*s != 0){
+ 662:	0f b6 06             	movzbl (%esi),%eax
+ 665:	83 c4 10             	add    $0x10,%esp
+ 668:	84 c0                	test   %al,%al
+ 66a:	75 e4                	jne    650 <printf+0x120>
+      state = 0;
+ 66c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 66f:	31 d2                	xor    %edx,%edx
+ 671:	e9 07 ff ff ff       	jmp    57d <printf+0x4d>
+ 676:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 67d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 680:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 683:	83 ec 0c             	sub    $0xc,%esp
+ 686:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 68b:	8b 13                	mov    (%ebx),%edx
+ 68d:	6a 01                	push   $0x1
+ 68f:	e9 6b ff ff ff       	jmp    5ff <printf+0xcf>
+ 694:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 698:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 69b:	83 ec 04             	sub    $0x4,%esp
+ 69e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 6a1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 6a3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 6a6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6a9:	6a 01                	push   $0x1
+ 6ab:	52                   	push   %edx
+ 6ac:	57                   	push   %edi
+ 6ad:	e8 d2 fc ff ff       	call   384 <write>
+        ap++;
+ 6b2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6b5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6b8:	31 d2                	xor    %edx,%edx
+ 6ba:	e9 be fe ff ff       	jmp    57d <printf+0x4d>
+ 6bf:	90                   	nop
+  write(fd, &c, 1);
+ 6c0:	83 ec 04             	sub    $0x4,%esp
+ 6c3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6c6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6c9:	6a 01                	push   $0x1
+ 6cb:	e9 11 ff ff ff       	jmp    5e1 <printf+0xb1>
+ 6d0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 6d5:	bb 7b 08 00 00       	mov    $0x87b,%ebx
+ 6da:	e9 61 ff ff ff       	jmp    640 <printf+0x110>
+ 6df:	90                   	nop
+
+000006e0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6e0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6e1:	a1 88 0b 00 00       	mov    0xb88,%eax
+{
+ 6e6:	89 e5                	mov    %esp,%ebp
+ 6e8:	57                   	push   %edi
+ 6e9:	56                   	push   %esi
+ 6ea:	53                   	push   %ebx
+ 6eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 6ee:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6f8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6fa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6fc:	39 ca                	cmp    %ecx,%edx
+ 6fe:	73 30                	jae    730 <free+0x50>
+ 700:	39 c1                	cmp    %eax,%ecx
+ 702:	72 04                	jb     708 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 704:	39 c2                	cmp    %eax,%edx
+ 706:	72 f0                	jb     6f8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 708:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 70b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 70e:	39 f8                	cmp    %edi,%eax
+ 710:	74 2e                	je     740 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 712:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 715:	8b 42 04             	mov    0x4(%edx),%eax
+ 718:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 71b:	39 f1                	cmp    %esi,%ecx
+ 71d:	74 38                	je     757 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 71f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 721:	5b                   	pop    %ebx
+  freep = p;
+ 722:	89 15 88 0b 00 00    	mov    %edx,0xb88
+}
+ 728:	5e                   	pop    %esi
+ 729:	5f                   	pop    %edi
+ 72a:	5d                   	pop    %ebp
+ 72b:	c3                   	ret
+ 72c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 730:	39 c1                	cmp    %eax,%ecx
+ 732:	72 d0                	jb     704 <free+0x24>
+ 734:	eb c2                	jmp    6f8 <free+0x18>
+ 736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 740:	03 70 04             	add    0x4(%eax),%esi
+ 743:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 746:	8b 02                	mov    (%edx),%eax
+ 748:	8b 00                	mov    (%eax),%eax
+ 74a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 74d:	8b 42 04             	mov    0x4(%edx),%eax
+ 750:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 753:	39 f1                	cmp    %esi,%ecx
+ 755:	75 c8                	jne    71f <free+0x3f>
+    p->s.size += bp->s.size;
+ 757:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 75a:	89 15 88 0b 00 00    	mov    %edx,0xb88
+    p->s.size += bp->s.size;
+ 760:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 763:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 766:	89 0a                	mov    %ecx,(%edx)
+}
+ 768:	5b                   	pop    %ebx
+ 769:	5e                   	pop    %esi
+ 76a:	5f                   	pop    %edi
+ 76b:	5d                   	pop    %ebp
+ 76c:	c3                   	ret
+ 76d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000770 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 770:	55                   	push   %ebp
+ 771:	89 e5                	mov    %esp,%ebp
+ 773:	57                   	push   %edi
+ 774:	56                   	push   %esi
+ 775:	53                   	push   %ebx
+ 776:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 779:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 77c:	8b 15 88 0b 00 00    	mov    0xb88,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 782:	8d 78 07             	lea    0x7(%eax),%edi
+ 785:	c1 ef 03             	shr    $0x3,%edi
+ 788:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 78b:	85 d2                	test   %edx,%edx
+ 78d:	0f 84 8d 00 00 00    	je     820 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 793:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 795:	8b 48 04             	mov    0x4(%eax),%ecx
+ 798:	39 f9                	cmp    %edi,%ecx
+ 79a:	73 64                	jae    800 <malloc+0x90>
+  if(nu < 4096)
+ 79c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 7a1:	39 df                	cmp    %ebx,%edi
+ 7a3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 7a6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 7ad:	eb 0a                	jmp    7b9 <malloc+0x49>
+ 7af:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7b0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 7b2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 7b5:	39 f9                	cmp    %edi,%ecx
+ 7b7:	73 47                	jae    800 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 7b9:	89 c2                	mov    %eax,%edx
+ 7bb:	39 05 88 0b 00 00    	cmp    %eax,0xb88
+ 7c1:	75 ed                	jne    7b0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 7c3:	83 ec 0c             	sub    $0xc,%esp
+ 7c6:	56                   	push   %esi
+ 7c7:	e8 20 fc ff ff       	call   3ec <sbrk>
+  if(p == (char*)-1)
+ 7cc:	83 c4 10             	add    $0x10,%esp
+ 7cf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 7d2:	74 1c                	je     7f0 <malloc+0x80>
+  hp->s.size = nu;
+ 7d4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 7d7:	83 ec 0c             	sub    $0xc,%esp
+ 7da:	83 c0 08             	add    $0x8,%eax
+ 7dd:	50                   	push   %eax
+ 7de:	e8 fd fe ff ff       	call   6e0 <free>
+  return freep;
+ 7e3:	8b 15 88 0b 00 00    	mov    0xb88,%edx
+      if((p = morecore(nunits)) == 0)
+ 7e9:	83 c4 10             	add    $0x10,%esp
+ 7ec:	85 d2                	test   %edx,%edx
+ 7ee:	75 c0                	jne    7b0 <malloc+0x40>
+        return 0;
+  }
+}
+ 7f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 7f3:	31 c0                	xor    %eax,%eax
+}
+ 7f5:	5b                   	pop    %ebx
+ 7f6:	5e                   	pop    %esi
+ 7f7:	5f                   	pop    %edi
+ 7f8:	5d                   	pop    %ebp
+ 7f9:	c3                   	ret
+ 7fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 800:	39 cf                	cmp    %ecx,%edi
+ 802:	74 4c                	je     850 <malloc+0xe0>
+        p->s.size -= nunits;
+ 804:	29 f9                	sub    %edi,%ecx
+ 806:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 809:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 80c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 80f:	89 15 88 0b 00 00    	mov    %edx,0xb88
+}
+ 815:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 818:	83 c0 08             	add    $0x8,%eax
+}
+ 81b:	5b                   	pop    %ebx
+ 81c:	5e                   	pop    %esi
+ 81d:	5f                   	pop    %edi
+ 81e:	5d                   	pop    %ebp
+ 81f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 820:	c7 05 88 0b 00 00 8c 	movl   $0xb8c,0xb88
+ 827:	0b 00 00 
+    base.s.size = 0;
+ 82a:	b8 8c 0b 00 00       	mov    $0xb8c,%eax
+    base.s.ptr = freep = prevp = &base;
+ 82f:	c7 05 8c 0b 00 00 8c 	movl   $0xb8c,0xb8c
+ 836:	0b 00 00 
+    base.s.size = 0;
+ 839:	c7 05 90 0b 00 00 00 	movl   $0x0,0xb90
+ 840:	00 00 00 
+    if(p->s.size >= nunits){
+ 843:	e9 54 ff ff ff       	jmp    79c <malloc+0x2c>
+ 848:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 84f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 850:	8b 08                	mov    (%eax),%ecx
+ 852:	89 0a                	mov    %ecx,(%edx)
+ 854:	eb b9                	jmp    80f <malloc+0x9f>
@@ -3,18 +3,19 @@
   */
 #include "types.h"
 #include "defs.h"
+#include "param.h"
 
 int sys_arp(void) {
-    char * ipadd, * intrfc, * arpresp;
+    char ipadd[MAXPATH], intrfc[MAXPATH], * arpresp, mac[18];
     int size;
     
-    if (argstr(0, &intrfc) < 0 || argstr(1, &ipadd) < 0 || argint(3, &size) < 0 || argptr(2, &arpresp, size) < 0) {
+    if (argstr(0, intrfc, MAXPATH) < 0 || argstr(1, ipadd, MAXPATH) < 0 || argint(3, &size) < 0 || argwptr(2, &arpresp, size) < 0) {
 	cprintf("ERROR: sysarp: Failed to get Args\n");
 	return -1;
     }
-    if (sendrequest(intrfc, ipadd, arpresp) < 0) {
+    if (sendrequest(intrfc, ipadd, mac) < 0) {
 	cprintf("ERROR: sysarp: Failed to send ARP request for IP: %s\n", ipadd);
 	return -1;
     }
-    return 0;
+    return ucopy(arpresp, mac, size < sizeof(mac) ? size : sizeof(mac));
 }
\ No newline at end of file
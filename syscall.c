@@ -12,6 +12,14 @@
 // Arguments on the stack, from the user call to the C
 // library system call function. The saved user %esp points
 // to a saved program counter, and then the first argument.
+//
+// User memory may be allocated lazily (see vmfault in vm.c), so
+// the helpers below fault in the pages they validate before the
+// kernel touches them.  vmfault also decides which addresses
+// are valid: those below sz and those in an mmap region.  A
+// thread sharing the address space can still unmap the memory
+// after the check, so the kernel copies to and from user memory
+// with ucopy(), which fails instead of panicking if it faults.
 
 // Fetch the int at addr from the current process.
 int
@@ -19,28 +27,32 @@ fetchint(uint addr, int *ip)
 {
   struct proc *curproc = myproc();
 
-  if(addr >= curproc->sz || addr+4 > curproc->sz)
+  if(addr >= KERNBASE || vmprefault(curproc, addr, 4, 0) < 0)
     return -1;
-  *ip = *(int*)(addr);
-  return 0;
+  return ucopy(ip, (char*)addr, 4);
 }
 
-// Fetch the nul-terminated string at addr from the current process.
-// Doesn't actually copy the string - just sets *pp to point at it.
-// Returns length of string, not including nul.
+// Copy the nul-terminated string at addr from the current process
+// into buf, which holds max bytes.
+// Returns length of string, not including nul, or -1 if it
+// doesn't fit.
 int
-fetchstr(uint addr, char **pp)
+fetchstr(uint addr, char *buf, int max)
 {
-  char *s, *ep;
+  uint a;
+  int i;
   struct proc *curproc = myproc();
 
-  if(addr >= curproc->sz)
-    return -1;
-  *pp = (char*)addr;
-  ep = (char*)curproc->sz;
-  for(s = *pp; s < ep; s++){
-    if(*s == 0)
-      return s - *pp;
+  for(i = 0; i < max; i++){
+    a = addr + i;
+    if(a >= KERNBASE)
+      return -1;
+    if((i == 0 || a % PGSIZE == 0) && vmprefault(curproc, a, 1, 0) < 0)
+      return -1;
+    if(ucopy(&buf[i], (char*)a, 1) < 0)
+      return -1;
+    if(buf[i] == 0)
+      return i;
   }
   return -1;
 }
@@ -52,34 +64,51 @@ argint(int n, int *ip)
   return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
 }
 
-// Fetch the nth word-sized system call argument as a pointer
-// to a block of memory of size bytes.  Check that the pointer
-// lies within the process address space.
-int
-argptr(int n, char **pp, int size)
+static int
+fetchptr(int n, char **pp, int size, int write)
 {
   int i;
   struct proc *curproc = myproc();
  
   if(argint(n, &i) < 0)
     return -1;
-  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+  if(size < 0 || (uint)i >= KERNBASE)
+    return -1;
+  if(vmprefault(curproc, i, size, write) < 0)
     return -1;
   *pp = (char*)i;
   return 0;
 }
 
-// Fetch the nth word-sized system call argument as a string pointer.
-// Check that the pointer is valid and the string is nul-terminated.
-// (There is no shared writable memory, so the string can't change
-// between this check and being used by the kernel.)
+// Fetch the nth word-sized system call argument as a pointer
+// to a block of memory of size bytes.  Check that the pointer
+// lies within the process address space.  The kernel must copy
+// from the block with ucopy().
+int
+argptr(int n, char **pp, int size)
+{
+  return fetchptr(n, pp, size, 0);
+}
+
+// Like argptr, for a block the kernel will write to with
+// ucopy().  Shared read-only pages in the block are copied now,
+// since a kernel write to them would fault.
+int
+argwptr(int n, char **pp, int size)
+{
+  return fetchptr(n, pp, size, 1);
+}
+
+// Fetch the nth word-sized system call argument as a string
+// and copy it into buf, which holds max bytes.
+// Returns length of string, not including nul, or -1.
 int
-argstr(int n, char **pp)
+argstr(int n, char *buf, int max)
 {
   int addr;
   if(argint(n, &addr) < 0)
     return -1;
-  return fetchstr(addr, pp);
+  return fetchstr(addr, buf, max);
 }
 
 extern int sys_chdir(void);
@@ -104,6 +133,22 @@ extern int sys_wait(void);
 extern int sys_write(void);
 extern int sys_uptime(void);
 extern int sys_arp(void);
+extern int sys_mmap(void);
+extern int sys_munmap(void);
+extern int sys_msync(void);
+extern int sys_shmcreate(void);
+extern int sys_shmattach(void);
+extern int sys_shmdetach(void);
+extern int sys_futex_wait(void);
+extern int sys_futex_wake(void);
+extern int sys_nice(void);
+extern int sys_setpriority(void);
+extern int sys_cputime(void);
+extern int sys_clock_gettime(void);
+extern int sys_clone(void);
+extern int sys_join(void);
+extern int sys_lockstat(void);
+extern int sys_nanosleep(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -128,6 +173,22 @@ static int (*syscalls[])(void) = {
 [SYS_mkdir]   sys_mkdir,
 [SYS_close]   sys_close,
 [SYS_arp]     sys_arp,
+[SYS_mmap]    sys_mmap,
+[SYS_munmap]  sys_munmap,
+[SYS_msync]   sys_msync,
+[SYS_shmcreate]  sys_shmcreate,
+[SYS_shmattach]  sys_shmattach,
+[SYS_shmdetach]  sys_shmdetach,
+[SYS_futex_wait] sys_futex_wait,
+[SYS_futex_wake] sys_futex_wake,
+[SYS_nice]    sys_nice,
+[SYS_setpriority] sys_setpriority,
+[SYS_cputime] sys_cputime,
+[SYS_clock_gettime] sys_clock_gettime,
+[SYS_clone]   sys_clone,
+[SYS_join]    sys_join,
+[SYS_lockstat] sys_lockstat,
+[SYS_nanosleep] sys_nanosleep,
 };
 
 void
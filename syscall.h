@@ -20,4 +20,20 @@
 #define SYS_link   19
 #define SYS_mkdir  20
 #define SYS_close  21
-#define SYS_arp    22
\ No newline at end of file
+#define SYS_arp    22
+#define SYS_mmap   23
+#define SYS_munmap 24
+#define SYS_msync  25
+#define SYS_shmcreate  26
+#define SYS_shmattach  27
+#define SYS_shmdetach  28
+#define SYS_futex_wait 29
+#define SYS_futex_wake 30
+#define SYS_nice   31
+#define SYS_setpriority 32
+#define SYS_cputime 33
+#define SYS_clock_gettime 34
+#define SYS_clone  35
+#define SYS_join   36
+#define SYS_lockstat 37
+#define SYS_nanosleep 38
@@ -26,7 +26,7 @@ argfd(int n, int *pfd, struct file **pf)
 
   if(argint(n, &fd) < 0)
     return -1;
-  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->files->ofile[fd]) == 0)
     return -1;
   if(pfd)
     *pfd = fd;
@@ -41,17 +41,38 @@ static int
 fdalloc(struct file *f)
 {
   int fd;
-  struct proc *curproc = myproc();
+  struct files *fs = myproc()->files;
 
+  acquire(&fs->lock);
   for(fd = 0; fd < NOFILE; fd++){
-    if(curproc->ofile[fd] == 0){
-      curproc->ofile[fd] = f;
+    if(fs->ofile[fd] == 0){
+      fs->ofile[fd] = f;
+      release(&fs->lock);
       return fd;
     }
   }
+  release(&fs->lock);
   return -1;
 }
 
+// Remove f from descriptor fd.  Returns -1 if another
+// thread has already closed it.
+static int
+fdfree(int fd, struct file *f)
+{
+  struct files *fs = myproc()->files;
+  int r;
+
+  acquire(&fs->lock);
+  r = -1;
+  if(fs->ofile[fd] == f){
+    fs->ofile[fd] = 0;
+    r = 0;
+  }
+  release(&fs->lock);
+  return r;
+}
+
 int
 sys_dup(void)
 {
@@ -73,7 +94,7 @@ sys_read(void)
   int n;
   char *p;
 
-  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argwptr(1, &p, n) < 0)
     return -1;
   return fileread(f, p, n);
 }
@@ -96,9 +117,8 @@ sys_close(void)
   int fd;
   struct file *f;
 
-  if(argfd(0, &fd, &f) < 0)
+  if(argfd(0, &fd, &f) < 0 || fdfree(fd, f) < 0)
     return -1;
-  myproc()->ofile[fd] = 0;
   fileclose(f);
   return 0;
 }
@@ -107,21 +127,23 @@ int
 sys_fstat(void)
 {
   struct file *f;
-  struct stat *st;
+  struct stat *st, kst;
 
-  if(argfd(0, 0, &f) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+  if(argfd(0, 0, &f) < 0 || argwptr(1, (void*)&st, sizeof(*st)) < 0)
     return -1;
-  return filestat(f, st);
+  if(filestat(f, &kst) < 0)
+    return -1;
+  return ucopy(st, &kst, sizeof(kst));
 }
 
 // Create the path new as a link to the same inode as old.
 int
 sys_link(void)
 {
-  char name[DIRSIZ], *new, *old;
+  char name[DIRSIZ], new[MAXPATH], old[MAXPATH];
   struct inode *dp, *ip;
 
-  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+  if(argstr(0, old, MAXPATH) < 0 || argstr(1, new, MAXPATH) < 0)
     return -1;
 
   begin_op();
@@ -185,11 +207,10 @@ int
 sys_unlink(void)
 {
   struct inode *ip, *dp;
-  struct dirent de;
-  char name[DIRSIZ], *path;
+  char name[DIRSIZ], path[MAXPATH];
   uint off;
 
-  if(argstr(0, &path) < 0)
+  if(argstr(0, path, MAXPATH) < 0)
     return -1;
 
   begin_op();
@@ -215,9 +236,7 @@ sys_unlink(void)
     goto bad;
   }
 
-  memset(&de, 0, sizeof(de));
-  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-    panic("unlink: writei");
+  dirunlink(dp, off);
   if(ip->type == T_DIR){
     dp->nlink--;
     iupdate(dp);
@@ -286,12 +305,12 @@ create(char *path, short type, short major, short minor)
 int
 sys_open(void)
 {
-  char *path;
+  char path[MAXPATH];
   int fd, omode;
   struct file *f;
   struct inode *ip;
 
-  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+  if(argstr(0, path, MAXPATH) < 0 || argint(1, &omode) < 0)
     return -1;
 
   begin_op();
@@ -336,11 +355,11 @@ sys_open(void)
 int
 sys_mkdir(void)
 {
-  char *path;
+  char path[MAXPATH];
   struct inode *ip;
 
   begin_op();
-  if(argstr(0, &path) < 0 || (ip = create(path, T_DIR, 0, 0)) == 0){
+  if(argstr(0, path, MAXPATH) < 0 || (ip = create(path, T_DIR, 0, 0)) == 0){
     end_op();
     return -1;
   }
@@ -353,11 +372,11 @@ int
 sys_mknod(void)
 {
   struct inode *ip;
-  char *path;
+  char path[MAXPATH];
   int major, minor;
 
   begin_op();
-  if((argstr(0, &path)) < 0 ||
+  if((argstr(0, path, MAXPATH)) < 0 ||
      argint(1, &major) < 0 ||
      argint(2, &minor) < 0 ||
      (ip = create(path, T_DEV, major, minor)) == 0){
@@ -372,12 +391,12 @@ sys_mknod(void)
 int
 sys_chdir(void)
 {
-  char *path;
-  struct inode *ip;
-  struct proc *curproc = myproc();
+  char path[MAXPATH];
+  struct inode *ip, *old;
+  struct files *fs = myproc()->files;
   
   begin_op();
-  if(argstr(0, &path) < 0 || (ip = namei(path)) == 0){
+  if(argstr(0, path, MAXPATH) < 0 || (ip = namei(path)) == 0){
     end_op();
     return -1;
   }
@@ -388,58 +407,130 @@ sys_chdir(void)
     return -1;
   }
   iunlock(ip);
-  iput(curproc->cwd);
+  acquire(&fs->lock);
+  old = fs->cwd;
+  fs->cwd = ip;
+  release(&fs->lock);
+  iput(old);
   end_op();
-  curproc->cwd = ip;
   return 0;
 }
 
 int
 sys_exec(void)
 {
-  char *path, *argv[MAXARG];
-  int i;
+  char path[MAXPATH], *argv[MAXARG];
+  int i, r;
   uint uargv, uarg;
 
-  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+  if(argstr(0, path, MAXPATH) < 0 || argint(1, (int*)&uargv) < 0){
     return -1;
   }
+  // Copy the arguments into the kernel, a page each, since
+  // exec() leaves the old address space to other threads.
   memset(argv, 0, sizeof(argv));
+  r = -1;
   for(i=0;; i++){
     if(i >= NELEM(argv))
-      return -1;
+      goto bad;
     if(fetchint(uargv+4*i, (int*)&uarg) < 0)
-      return -1;
+      goto bad;
     if(uarg == 0){
       argv[i] = 0;
       break;
     }
-    if(fetchstr(uarg, &argv[i]) < 0)
-      return -1;
+    if((argv[i] = kalloc()) == 0 || fetchstr(uarg, argv[i], PGSIZE) < 0)
+      goto bad;
   }
-  return exec(path, argv);
+  r = exec(path, argv);
+
+bad:
+  for(i = 0; i < NELEM(argv) && argv[i] != 0; i++)
+    kfree(argv[i]);
+  return r;
 }
 
 int
 sys_pipe(void)
 {
-  int *fd;
+  int *fd, kfd[2];
   struct file *rf, *wf;
   int fd0, fd1;
 
-  if(argptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+  if(argwptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
     return -1;
   if(pipealloc(&rf, &wf) < 0)
     return -1;
   fd0 = -1;
   if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
     if(fd0 >= 0)
-      myproc()->ofile[fd0] = 0;
+      fdfree(fd0, rf);
     fileclose(rf);
     fileclose(wf);
     return -1;
   }
-  fd[0] = fd0;
-  fd[1] = fd1;
+  kfd[0] = fd0;
+  kfd[1] = fd1;
+  if(ucopy(fd, kfd, sizeof(kfd)) < 0){
+    // Unless another thread has closed them already.
+    if(fdfree(fd0, rf) == 0)
+      fileclose(rf);
+    if(fdfree(fd1, wf) == 0)
+      fileclose(wf);
+    return -1;
+  }
   return 0;
 }
+
+// Map a file, or anonymous memory if flags has MAP_ANONYMOUS.
+// The address argument is only a hint and is ignored.
+int
+sys_mmap(void)
+{
+  int addr, len, prot, flags, off, vflags;
+  struct file *f;
+  struct inode *ip;
+
+  if(argint(0, &addr) < 0 || argint(1, &len) < 0 || argint(2, &prot) < 0 ||
+     argint(3, &flags) < 0 || argint(5, &off) < 0)
+    return -1;
+  if(len <= 0 || off < 0 || off % PGSIZE != 0 || (prot & PROT_READ) == 0)
+    return -1;
+  if(!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE))
+    return -1;
+
+  vflags = 0;
+  if(prot & PROT_WRITE)
+    vflags |= VMA_WRITE;
+  if(flags & MAP_SHARED)
+    vflags |= VMA_SHARED;
+  ip = 0;
+  if(!(flags & MAP_ANONYMOUS)){
+    if(argfd(4, 0, &f) < 0 || f->type != FD_INODE || !f->readable)
+      return -1;
+    if((vflags & VMA_SHARED) && (vflags & VMA_WRITE) && !f->writable)
+      return -1;
+    ip = f->ip;
+  }
+  return mmap(myproc(), len, vflags, ip, off);
+}
+
+int
+sys_munmap(void)
+{
+  int addr, len;
+
+  if(argint(0, &addr) < 0 || argint(1, &len) < 0 || len <= 0)
+    return -1;
+  return munmap(myproc(), addr, len);
+}
+
+int
+sys_msync(void)
+{
+  int addr, len;
+
+  if(argint(0, &addr) < 0 || argint(1, &len) < 0 || len <= 0)
+    return -1;
+  return msync(myproc(), addr, len);
+}
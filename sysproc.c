@@ -2,6 +2,7 @@
 #include "x86.h"
 #include "defs.h"
 #include "date.h"
+#include "lockstat.h"
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
@@ -26,6 +27,29 @@ sys_wait(void)
   return wait();
 }
 
+int
+sys_clone(void)
+{
+  int fn, arg, stack;
+
+  if(argint(0, &fn) < 0 || argint(1, &arg) < 0 || argint(2, &stack) < 0)
+    return -1;
+  return clone(fn, arg, stack);
+}
+
+int
+sys_join(void)
+{
+  uint *stack, ustack;
+  int pid;
+
+  if(argwptr(0, (void*)&stack, sizeof(*stack)) < 0)
+    return -1;
+  if((pid = join(&ustack)) >= 0 && ucopy(stack, &ustack, sizeof(ustack)) < 0)
+    return -1;
+  return pid;
+}
+
 int
 sys_kill(void)
 {
@@ -50,8 +74,7 @@ sys_sbrk(void)
 
   if(argint(0, &n) < 0)
     return -1;
-  addr = myproc()->sz;
-  if(growproc(n) < 0)
+  if((addr = growmm(myproc(), n)) < 0)
     return -1;
   return addr;
 }
@@ -60,21 +83,23 @@ int
 sys_sleep(void)
 {
   int n;
-  uint ticks0;
 
-  if(argint(0, &n) < 0)
+  if(argint(0, &n) < 0 || n < 0)
     return -1;
-  acquire(&tickslock);
-  ticks0 = ticks;
-  while(ticks - ticks0 < n){
-    if(myproc()->killed){
-      release(&tickslock);
-      return -1;
-    }
-    sleep(&ticks, &tickslock);
-  }
-  release(&tickslock);
-  return 0;
+  return sleepns((uint64_t)n * (1000000000 / HZ));
+}
+
+// Sleep for the time in *ts, to the nanosecond as far as
+// the LAPIC timer goes.
+int
+sys_nanosleep(void)
+{
+  struct timespec *ts, kts;
+
+  if(argptr(0, (void*)&ts, sizeof(*ts)) < 0 ||
+     ucopy(&kts, ts, sizeof(kts)) < 0 || kts.tv_nsec >= 1000000000)
+    return -1;
+  return sleepns((uint64_t)kts.tv_sec * 1000000000 + kts.tv_nsec);
 }
 
 // return how many clock tick interrupts have occurred
@@ -85,7 +110,140 @@ sys_uptime(void)
   uint xticks;
 
   acquire(&tickslock);
+  clockupdate();
   xticks = ticks;
   release(&tickslock);
   return xticks;
 }
+
+// Store the time of clock clk in *ts.
+int
+sys_clock_gettime(void)
+{
+  int clk;
+  struct timespec *ts, kts;
+
+  if(argint(0, &clk) < 0 || argwptr(1, (void*)&ts, sizeof(*ts)) < 0)
+    return -1;
+  if(clk != CLOCK_MONOTONIC)
+    return -1;
+  clocktime(&kts);
+  return ucopy(ts, &kts, sizeof(kts));
+}
+
+// Copy the contention counters of up to n kinds of spin lock
+// into the array ls.  Returns the number copied.
+int
+sys_lockstat(void)
+{
+  int i, n;
+  struct lockstat *ls, l;
+
+  if(argint(1, &n) < 0 || n < 0)
+    return -1;
+  if(n > NLOCKSTAT)
+    n = NLOCKSTAT;
+  if(argwptr(0, (void*)&ls, n*sizeof(*ls)) < 0)
+    return -1;
+  for(i = 0; i < n && lockstatget(i, &l) == 0; i++)
+    if(ucopy(&ls[i], &l, sizeof(l)) < 0)
+      return -1;
+  return i;
+}
+
+// Create a shared-memory segment and attach it.
+// Returns its address.
+int
+sys_shmcreate(void)
+{
+  char name[MAXPATH];
+  int size, addr;
+  struct shm *s;
+
+  if(argstr(0, name, MAXPATH) < 0 || argint(1, &size) < 0 || size <= 0)
+    return -1;
+  if((s = shmcreate(name, size)) == 0)
+    return -1;
+  if((addr = shmmap(myproc(), s)) < 0)
+    shmput(s);
+  return addr;
+}
+
+// Attach an existing shared-memory segment.
+// Returns its address.
+int
+sys_shmattach(void)
+{
+  char name[MAXPATH];
+  int addr;
+  struct shm *s;
+
+  if(argstr(0, name, MAXPATH) < 0)
+    return -1;
+  if((s = shmlookup(name)) == 0)
+    return -1;
+  if((addr = shmmap(myproc(), s)) < 0)
+    shmput(s);
+  return addr;
+}
+
+int
+sys_shmdetach(void)
+{
+  int addr;
+
+  if(argint(0, &addr) < 0)
+    return -1;
+  return shmunmap(myproc(), addr);
+}
+
+int
+sys_futex_wait(void)
+{
+  int addr, val;
+
+  if(argint(0, &addr) < 0 || argint(1, &val) < 0)
+    return -1;
+  return futexwait(addr, val);
+}
+
+int
+sys_futex_wake(void)
+{
+  int addr, n;
+
+  if(argint(0, &addr) < 0 || argint(1, &n) < 0)
+    return -1;
+  return futexwake(addr, n);
+}
+
+int
+sys_nice(void)
+{
+  int inc;
+
+  if(argint(0, &inc) < 0)
+    return -1;
+  return nice(inc);
+}
+
+// Set the scheduling class of a process (0 means
+// the caller); see sched.h.
+int
+sys_setpriority(void)
+{
+  int pid, policy, prio;
+
+  if(argint(0, &pid) < 0 || argint(1, &policy) < 0 || argint(2, &prio) < 0)
+    return -1;
+  if(pid == 0)
+    pid = myproc()->pid;
+  return setpriority(pid, policy, prio);
+}
+
+// Return how many clock ticks the caller has run for.
+int
+sys_cputime(void)
+{
+  return myproc()->cputime;
+}
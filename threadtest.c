@@ -0,0 +1,93 @@
+// Tests of clone() and join() threads.  They live apart from
+// usertests, which is as big as a file can be.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+void
+threadfn(void *arg)
+{
+  *(int*)arg = 42;
+  exit();
+}
+
+// clone() a thread that shares our memory, and join() it.
+void
+threadtest(void)
+{
+  char *stack;
+  void *ustack;
+  int pid, n;
+
+  printf(1, "thread test\n");
+  stack = sbrk(2*4096);
+  stack = (char*)(((uint)stack + 4095) & ~4095);
+  n = 0;
+  if((pid = clone(threadfn, &n, stack)) < 0){
+    printf(1, "clone failed\n");
+    exit();
+  }
+  if(join(&ustack) != pid || ustack != stack || n != 42){
+    printf(1, "thread wrong: n %d\n", n);
+    exit();
+  }
+  printf(1, "thread ok\n");
+}
+
+char *tfpage;
+
+void
+unmapfn(void *arg)
+{
+  munmap(tfpage, 4096);
+  exit();
+}
+
+// a thread unmaps memory while another thread read()s into it:
+// the read fails, whether the kernel notices before copying or
+// faults in the middle of the copy.
+void
+threadfaulttest(void)
+{
+  char *stack;
+  void *ustack;
+  int i, fd, n, pid;
+
+  printf(1, "thread fault test\n");
+  stack = sbrk(2*4096);
+  stack = (char*)(((uint)stack + 4095) & ~4095);
+  for(i = 0; i < 20; i++){
+    tfpage = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+    if(tfpage == (char*)-1){
+      printf(1, "mmap failed\n");
+      exit();
+    }
+    if((pid = clone(unmapfn, 0, stack)) < 0){
+      printf(1, "clone failed\n");
+      exit();
+    }
+    do {
+      if((fd = open("README", 0)) < 0){
+        printf(1, "open README failed\n");
+        exit();
+      }
+      n = read(fd, tfpage, 4096);
+      close(fd);
+    } while(n >= 0);
+    if(join(&ustack) != pid){
+      printf(1, "join failed\n");
+      exit();
+    }
+  }
+  printf(1, "thread fault ok\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  threadtest();
+  threadfaulttest();
+  exit();
+}
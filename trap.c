@@ -7,12 +7,36 @@
 #include "x86.h"
 #include "traps.h"
 #include "spinlock.h"
+#include "date.h"
 
 // Interrupt descriptor table (shared by all CPUs).
 struct gatedesc idt[256];
 extern uint vectors[];  // in vectors.S: array of 256 entry pointers
+extern char ucopystart[], ucopyend[], ucopyfault[];  // in uaccess.S
+
+// The clock.  ticks counts clock ticks (1/HZ second) since
+// boot, as measured by the TSC.  Each CPU's LAPIC timer
+// interrupts it once a tick while it runs a process, or
+// sooner if a timer is due, and idle CPUs halt until the next
+// timer, so whichever CPU takes a timer interrupt brings
+// ticks up to date and fires the timers that are due.
+//
+// A timer is kept to the nanosecond, on a list sorted by
+// deadline, so a sleeper need not wait for the next tick.
+
+#define NSTICK  (1000000000 / HZ)  // nanoseconds per tick
+
+struct timer {
+  uint64_t when;       // deadline, in nanoseconds since boot
+  int pending;         // still on the list?
+  struct timer *next;
+};
+
 struct spinlock tickslock;
 uint ticks;
+static uint64_t tickstart;  // TSC at the start of the current tick
+static uint64_t tickns;     // nanoseconds since boot, likewise
+static struct timer *timers;  // pending timers, earliest first
 
 void
 tvinit(void)
@@ -24,6 +48,7 @@ tvinit(void)
   SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
 
   initlock(&tickslock, "time");
+  tickstart = rdtsc();
 }
 
 void
@@ -32,6 +57,130 @@ idtinit(void)
   lidt(idt, sizeof(idt));
 }
 
+// Nanoseconds since boot.  Caller must hold tickslock.
+static uint64_t
+clockns(void)
+{
+  uint64_t d;
+
+  d = rdtsc() - tickstart;
+  if((long long)d < 0)
+    d = 0;
+  if(d >= tsctick)
+    d = tsctick - 1;
+  return tickns + divl(d * NSTICK, tsctick);
+}
+
+// Advance ticks to the current time, and wake the
+// processes whose timers are due.
+// Caller must hold tickslock.
+void
+clockupdate(void)
+{
+  uint64_t now;
+  struct timer *t;
+  uint n;
+
+  now = rdtsc();
+  // Not if another CPU's TSC is a little ahead.
+  if((long long)(now - tickstart) >= (long long)tsctick){
+    n = divl(now - tickstart, tsctick);
+    ticks += n;
+    tickstart += (uint64_t)n * tsctick;
+    tickns += (uint64_t)n * NSTICK;
+  }
+  now = clockns();
+  while((t = timers) != 0 && t->when <= now){
+    timers = t->next;
+    t->pending = 0;
+    wakeup(t);
+  }
+}
+
+// Return the nanoseconds to the next timer, at least 1,
+// or 0 if there is none.
+uint64_t
+nexttimeout(void)
+{
+  uint64_t now, n;
+
+  acquire(&tickslock);
+  clockupdate();
+  n = 0;
+  if(timers){
+    now = clockns();
+    n = timers->when > now ? timers->when - now : 1;
+  }
+  release(&tickslock);
+  return n;
+}
+
+// Set this CPU's timer for the next timer or the end of a
+// tick, whichever comes first.
+void
+clockarm(void)
+{
+  uint64_t n;
+
+  n = nexttimeout();
+  if(n == 0 || n > NSTICK)
+    n = NSTICK;
+  lapictimer(n);
+}
+
+// Sleep for ns nanoseconds.  Returns -1 if the process is
+// killed first.
+int
+sleepns(uint64_t ns)
+{
+  struct timer t, **tp;
+  uint64_t now;
+  int r;
+
+  if(ns == 0)
+    return 0;
+  acquire(&tickslock);
+  clockupdate();
+  now = clockns();
+  t.when = now + ns;
+  t.pending = 1;
+  for(tp = &timers; *tp && (*tp)->when <= t.when; tp = &(*tp)->next)
+    ;
+  t.next = *tp;
+  *tp = &t;
+  // This CPU's timer may not be due for up to a tick.
+  if(timers == &t && ns < NSTICK)
+    lapictimer(ns);
+
+  r = 0;
+  while(t.pending){
+    if(myproc()->killed){
+      for(tp = &timers; *tp != &t; tp = &(*tp)->next)
+        ;
+      *tp = t.next;
+      r = -1;
+      break;
+    }
+    sleep(&t, &tickslock);
+  }
+  release(&tickslock);
+  return r;
+}
+
+// Store the time since boot in *ts, to the nanosecond.
+void
+clocktime(struct timespec *ts)
+{
+  uint64_t ns;
+
+  acquire(&tickslock);
+  clockupdate();
+  ns = clockns();
+  release(&tickslock);
+  ts->tv_sec = divl(ns, 1000000000);
+  ts->tv_nsec = ns - (uint64_t)ts->tv_sec * 1000000000;
+}
+
 //PAGEBREAK: 41
 void
 trap(struct trapframe *tf)
@@ -48,12 +197,22 @@ trap(struct trapframe *tf)
 
   switch(tf->trapno){
   case T_IRQ0 + IRQ_TIMER:
-    if(cpuid() == 0){
-      acquire(&tickslock);
-      ticks++;
-      wakeup(&ticks);
-      release(&tickslock);
-    }
+    if((tf->cs&3) == DPL_USER)
+      mycpu()->rcuqs++;
+    acquire(&tickslock);
+    clockupdate();
+    release(&tickslock);
+    clockarm();
+    lapiceoi();
+    break;
+  case T_IRQ0 + IRQ_TLB:
+    // Another CPU changed the page table of our threads.
+    lcr3(rcr3());
+    mycpu()->tlbflushes++;
+    lapiceoi();
+    break;
+  case T_IRQ0 + IRQ_WAKE:
+    // Sent to an idle CPU when there is work for it.
     lapiceoi();
     break;
   case T_IRQ0 + IRQ_IDE:
@@ -77,9 +236,30 @@ trap(struct trapframe *tf)
             cpuid(), tf->cs, tf->eip);
     lapiceoi();
     break;
+  case T_PGFLT:
+    // Lazily allocated user page?  Kernel code faults in user
+    // pages before touching them, so only user faults land here.
+    if(myproc() && (tf->cs&3) == DPL_USER &&
+       vmfault(myproc(), rcr2(), tf->err & FEC_WR) == 0)
+      break;
+    // Unless another thread unmapped the memory under a
+    // system call that had already checked it: ucopy() then
+    // fails, and so does the system call.
+    if((tf->cs&3) == 0 && rcr2() < KERNBASE &&
+       tf->eip >= (uint)ucopystart && tf->eip < (uint)ucopyend){
+      tf->eip = (uint)ucopyfault;
+      break;
+    }
+    // Otherwise a real fault; treat it like any other trap.
 
   //PAGEBREAK: 13
   default:
+    // PCI devices interrupt on lines set at boot.
+    if(tf->trapno >= T_IRQ0 && tf->trapno < T_IRQ0 + 16 &&
+       virtiointr(tf->trapno - T_IRQ0)){
+      lapiceoi();
+      break;
+    }
     if(myproc() == 0 || (tf->cs&3) == 0){
       // In kernel, it must be our mistake.
       cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
@@ -100,10 +280,11 @@ trap(struct trapframe *tf)
   if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
     exit();
 
-  // Force process to give up CPU on clock tick.
+  // Charge the process for the clock tick, and give up
+  // the CPU if the scheduler says so.
   // If interrupts were on while locks held, would need to check nlock.
   if(myproc() && myproc()->state == RUNNING &&
-     tf->trapno == T_IRQ0+IRQ_TIMER)
+     tf->trapno == T_IRQ0+IRQ_TIMER && schedtick())
     yield();
 
   // Check if the process has been killed since we yielded
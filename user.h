@@ -2,6 +2,8 @@
 
 struct stat;
 struct rtcdate;
+struct timespec;
+struct lockstat;
 
 // system calls
 int fork(void);
@@ -26,6 +28,22 @@ char* sbrk(int);
 int sleep(int);
 int uptime(void);
 int arp(char*, char*, char*, int);
+void* mmap(void*, int, int, int, int, int);
+int munmap(void*, int);
+int msync(void*, int);
+void* shmcreate(char*, int);
+void* shmattach(char*);
+int shmdetach(void*);
+int futex_wait(int*, int);
+int futex_wake(int*, int);
+int nice(int);
+int setpriority(int, int, int);
+int cputime(void);
+int clock_gettime(int, struct timespec*);
+int clone(void(*)(void*), void*, void*);
+int join(void**);
+int lockstat(struct lockstat*, int);
+int nanosleep(struct timespec*);
 
 // ulib.c
 int stat(char*, struct stat*);
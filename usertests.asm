@@ -0,0 +1,7906 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return randstate;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+      11:	68 99 5d 00 00       	push   $0x5d99
+      16:	6a 01                	push   $0x1
+      18:	e8 73 47 00 00       	call   4790 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+      1d:	59                   	pop    %ecx
+      1e:	58                   	pop    %eax
+      1f:	6a 00                	push   $0x0
+      21:	68 ad 5d 00 00       	push   $0x5dad
+      26:	e8 d9 45 00 00       	call   4604 <open>
+      2b:	83 c4 10             	add    $0x10,%esp
+      2e:	85 c0                	test   %eax,%eax
+      30:	78 13                	js     45 <main+0x45>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+      32:	52                   	push   %edx
+      33:	52                   	push   %edx
+      34:	68 64 66 00 00       	push   $0x6664
+      39:	6a 01                	push   $0x1
+      3b:	e8 50 47 00 00       	call   4790 <printf>
+    exit();
+      40:	e8 7f 45 00 00       	call   45c4 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+      45:	50                   	push   %eax
+      46:	50                   	push   %eax
+      47:	68 00 02 00 00       	push   $0x200
+      4c:	68 ad 5d 00 00       	push   $0x5dad
+      51:	e8 ae 45 00 00       	call   4604 <open>
+      56:	89 04 24             	mov    %eax,(%esp)
+      59:	e8 8e 45 00 00       	call   45ec <close>
+
+  argptest();
+      5e:	e8 8d 42 00 00       	call   42f0 <argptest>
+  createdelete();
+      63:	e8 f8 11 00 00       	call   1260 <createdelete>
+  linkunlink();
+      68:	e8 93 1a 00 00       	call   1b00 <linkunlink>
+  concreate();
+      6d:	e8 8e 17 00 00       	call   1800 <concreate>
+  fourfiles();
+      72:	e8 e9 0f 00 00       	call   1060 <fourfiles>
+  sharedfd();
+      77:	e8 24 0e 00 00       	call   ea0 <sharedfd>
+
+  bigargtest();
+      7c:	e8 2f 3f 00 00       	call   3fb0 <bigargtest>
+  bigwrite();
+      81:	e8 ea 25 00 00       	call   2670 <bigwrite>
+  bigargtest();
+      86:	e8 25 3f 00 00       	call   3fb0 <bigargtest>
+  bsstest();
+      8b:	e8 b0 3e 00 00       	call   3f40 <bsstest>
+  sbrktest();
+      90:	e8 1b 2f 00 00       	call   2fb0 <sbrktest>
+  lazysbrktest();
+      95:	e8 56 33 00 00       	call   33f0 <lazysbrktest>
+  cowdatatest();
+      9a:	e8 21 35 00 00       	call   35c0 <cowdatatest>
+  mmaptest();
+      9f:	e8 5c 36 00 00       	call   3700 <mmaptest>
+  shmtest();
+      a4:	e8 37 39 00 00       	call   39e0 <shmtest>
+  schedtest();
+      a9:	e8 a2 3a 00 00       	call   3b50 <schedtest>
+  clocktest();
+      ae:	e8 1d 3c 00 00       	call   3cd0 <clocktest>
+  threadtest();
+      b3:	e8 f8 3c 00 00       	call   3db0 <threadtest>
+  validatetest();
+      b8:	e8 d3 3d 00 00       	call   3e90 <validatetest>
+
+  opentest();
+      bd:	e8 7e 03 00 00       	call   440 <opentest>
+  writetest();
+      c2:	e8 09 04 00 00       	call   4d0 <writetest>
+  writetest1();
+      c7:	e8 e4 05 00 00       	call   6b0 <writetest1>
+  createtest();
+      cc:	e8 9f 07 00 00       	call   870 <createtest>
+
+  openiputtest();
+      d1:	e8 6a 02 00 00       	call   340 <openiputtest>
+  exitiputtest();
+      d6:	e8 65 01 00 00       	call   240 <exitiputtest>
+  iputtest();
+      db:	e8 80 00 00 00       	call   160 <iputtest>
+
+  mem();
+      e0:	e8 eb 0c 00 00       	call   dd0 <mem>
+  pipe1();
+      e5:	e8 66 09 00 00       	call   a50 <pipe1>
+  preempt();
+      ea:	e8 01 0b 00 00       	call   bf0 <preempt>
+  exitwait();
+      ef:	e8 5c 0c 00 00       	call   d50 <exitwait>
+
+  rmdot();
+      f4:	e8 67 29 00 00       	call   2a60 <rmdot>
+  fourteen();
+      f9:	e8 22 28 00 00       	call   2920 <fourteen>
+  bigfile();
+      fe:	e8 4d 26 00 00       	call   2750 <bigfile>
+  subdir();
+     103:	e8 88 1e 00 00       	call   1f90 <subdir>
+  linktest();
+     108:	e8 e3 14 00 00       	call   15f0 <linktest>
+  unlinkread();
+     10d:	e8 4e 13 00 00       	call   1460 <unlinkread>
+  dirfile();
+     112:	e8 c9 2a 00 00       	call   2be0 <dirfile>
+  iref();
+     117:	e8 c4 2c 00 00       	call   2de0 <iref>
+  forktest();
+     11c:	e8 df 2d 00 00       	call   2f00 <forktest>
+  bigdir(); // slow
+     121:	e8 ea 1a 00 00       	call   1c10 <bigdir>
+  dirchurn();
+     126:	e8 15 1c 00 00       	call   1d40 <dirchurn>
+
+  uio();
+     12b:	e8 50 41 00 00       	call   4280 <uio>
+
+  exectest();
+     130:	e8 cb 08 00 00       	call   a00 <exectest>
+
+  exit();
+     135:	e8 8a 44 00 00       	call   45c4 <exit>
+     13a:	66 90                	xchg   %ax,%ax
+     13c:	66 90                	xchg   %ax,%ax
+     13e:	66 90                	xchg   %ax,%ax
+
+00000140 <threadfn>:
+{
+     140:	55                   	push   %ebp
+     141:	89 e5                	mov    %esp,%ebp
+     143:	83 ec 08             	sub    $0x8,%esp
+  *(int*)arg = 42;
+     146:	8b 45 08             	mov    0x8(%ebp),%eax
+     149:	c7 00 2a 00 00 00    	movl   $0x2a,(%eax)
+  exit();
+     14f:	e8 70 44 00 00       	call   45c4 <exit>
+     154:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     15b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     15f:	90                   	nop
+
+00000160 <iputtest>:
+{
+     160:	55                   	push   %ebp
+     161:	89 e5                	mov    %esp,%ebp
+     163:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+     166:	68 3e 4b 00 00       	push   $0x4b3e
+     16b:	ff 35 c0 71 00 00    	push   0x71c0
+     171:	e8 1a 46 00 00       	call   4790 <printf>
+  if(mkdir("iputdir") < 0){
+     176:	c7 04 24 d1 4a 00 00 	movl   $0x4ad1,(%esp)
+     17d:	e8 aa 44 00 00       	call   462c <mkdir>
+     182:	83 c4 10             	add    $0x10,%esp
+     185:	85 c0                	test   %eax,%eax
+     187:	78 58                	js     1e1 <iputtest+0x81>
+  if(chdir("iputdir") < 0){
+     189:	83 ec 0c             	sub    $0xc,%esp
+     18c:	68 d1 4a 00 00       	push   $0x4ad1
+     191:	e8 9e 44 00 00       	call   4634 <chdir>
+     196:	83 c4 10             	add    $0x10,%esp
+     199:	85 c0                	test   %eax,%eax
+     19b:	0f 88 85 00 00 00    	js     226 <iputtest+0xc6>
+  if(unlink("../iputdir") < 0){
+     1a1:	83 ec 0c             	sub    $0xc,%esp
+     1a4:	68 ce 4a 00 00       	push   $0x4ace
+     1a9:	e8 66 44 00 00       	call   4614 <unlink>
+     1ae:	83 c4 10             	add    $0x10,%esp
+     1b1:	85 c0                	test   %eax,%eax
+     1b3:	78 5a                	js     20f <iputtest+0xaf>
+  if(chdir("/") < 0){
+     1b5:	83 ec 0c             	sub    $0xc,%esp
+     1b8:	68 f3 4a 00 00       	push   $0x4af3
+     1bd:	e8 72 44 00 00       	call   4634 <chdir>
+     1c2:	83 c4 10             	add    $0x10,%esp
+     1c5:	85 c0                	test   %eax,%eax
+     1c7:	78 2f                	js     1f8 <iputtest+0x98>
+  printf(stdout, "iput test ok\n");
+     1c9:	83 ec 08             	sub    $0x8,%esp
+     1cc:	68 67 4b 00 00       	push   $0x4b67
+     1d1:	ff 35 c0 71 00 00    	push   0x71c0
+     1d7:	e8 b4 45 00 00       	call   4790 <printf>
+}
+     1dc:	83 c4 10             	add    $0x10,%esp
+     1df:	c9                   	leave
+     1e0:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     1e1:	50                   	push   %eax
+     1e2:	50                   	push   %eax
+     1e3:	68 00 52 00 00       	push   $0x5200
+     1e8:	ff 35 c0 71 00 00    	push   0x71c0
+     1ee:	e8 9d 45 00 00       	call   4790 <printf>
+    exit();
+     1f3:	e8 cc 43 00 00       	call   45c4 <exit>
+    printf(stdout, "chdir / failed\n");
+     1f8:	50                   	push   %eax
+     1f9:	50                   	push   %eax
+     1fa:	68 f5 4a 00 00       	push   $0x4af5
+     1ff:	ff 35 c0 71 00 00    	push   0x71c0
+     205:	e8 86 45 00 00       	call   4790 <printf>
+    exit();
+     20a:	e8 b5 43 00 00       	call   45c4 <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+     20f:	52                   	push   %edx
+     210:	52                   	push   %edx
+     211:	68 d9 4a 00 00       	push   $0x4ad9
+     216:	ff 35 c0 71 00 00    	push   0x71c0
+     21c:	e8 6f 45 00 00       	call   4790 <printf>
+    exit();
+     221:	e8 9e 43 00 00       	call   45c4 <exit>
+    printf(stdout, "chdir iputdir failed\n");
+     226:	51                   	push   %ecx
+     227:	51                   	push   %ecx
+     228:	68 b8 4a 00 00       	push   $0x4ab8
+     22d:	ff 35 c0 71 00 00    	push   0x71c0
+     233:	e8 58 45 00 00       	call   4790 <printf>
+    exit();
+     238:	e8 87 43 00 00       	call   45c4 <exit>
+     23d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000240 <exitiputtest>:
+{
+     240:	55                   	push   %ebp
+     241:	89 e5                	mov    %esp,%ebp
+     243:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exitiput test\n");
+     246:	68 05 4b 00 00       	push   $0x4b05
+     24b:	ff 35 c0 71 00 00    	push   0x71c0
+     251:	e8 3a 45 00 00       	call   4790 <printf>
+  pid = fork();
+     256:	e8 61 43 00 00       	call   45bc <fork>
+  if(pid < 0){
+     25b:	83 c4 10             	add    $0x10,%esp
+     25e:	85 c0                	test   %eax,%eax
+     260:	0f 88 8a 00 00 00    	js     2f0 <exitiputtest+0xb0>
+  if(pid == 0){
+     266:	75 50                	jne    2b8 <exitiputtest+0x78>
+    if(mkdir("iputdir") < 0){
+     268:	83 ec 0c             	sub    $0xc,%esp
+     26b:	68 d1 4a 00 00       	push   $0x4ad1
+     270:	e8 b7 43 00 00       	call   462c <mkdir>
+     275:	83 c4 10             	add    $0x10,%esp
+     278:	85 c0                	test   %eax,%eax
+     27a:	0f 88 87 00 00 00    	js     307 <exitiputtest+0xc7>
+    if(chdir("iputdir") < 0){
+     280:	83 ec 0c             	sub    $0xc,%esp
+     283:	68 d1 4a 00 00       	push   $0x4ad1
+     288:	e8 a7 43 00 00       	call   4634 <chdir>
+     28d:	83 c4 10             	add    $0x10,%esp
+     290:	85 c0                	test   %eax,%eax
+     292:	0f 88 86 00 00 00    	js     31e <exitiputtest+0xde>
+    if(unlink("../iputdir") < 0){
+     298:	83 ec 0c             	sub    $0xc,%esp
+     29b:	68 ce 4a 00 00       	push   $0x4ace
+     2a0:	e8 6f 43 00 00       	call   4614 <unlink>
+     2a5:	83 c4 10             	add    $0x10,%esp
+     2a8:	85 c0                	test   %eax,%eax
+     2aa:	78 2c                	js     2d8 <exitiputtest+0x98>
+    exit();
+     2ac:	e8 13 43 00 00       	call   45c4 <exit>
+     2b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  wait();
+     2b8:	e8 0f 43 00 00       	call   45cc <wait>
+  printf(stdout, "exitiput test ok\n");
+     2bd:	83 ec 08             	sub    $0x8,%esp
+     2c0:	68 28 4b 00 00       	push   $0x4b28
+     2c5:	ff 35 c0 71 00 00    	push   0x71c0
+     2cb:	e8 c0 44 00 00       	call   4790 <printf>
+}
+     2d0:	83 c4 10             	add    $0x10,%esp
+     2d3:	c9                   	leave
+     2d4:	c3                   	ret
+     2d5:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(stdout, "unlink ../iputdir failed\n");
+     2d8:	83 ec 08             	sub    $0x8,%esp
+     2db:	68 d9 4a 00 00       	push   $0x4ad9
+     2e0:	ff 35 c0 71 00 00    	push   0x71c0
+     2e6:	e8 a5 44 00 00       	call   4790 <printf>
+      exit();
+     2eb:	e8 d4 42 00 00       	call   45c4 <exit>
+    printf(stdout, "fork failed\n");
+     2f0:	51                   	push   %ecx
+     2f1:	51                   	push   %ecx
+     2f2:	68 f9 5c 00 00       	push   $0x5cf9
+     2f7:	ff 35 c0 71 00 00    	push   0x71c0
+     2fd:	e8 8e 44 00 00       	call   4790 <printf>
+    exit();
+     302:	e8 bd 42 00 00       	call   45c4 <exit>
+      printf(stdout, "mkdir failed\n");
+     307:	52                   	push   %edx
+     308:	52                   	push   %edx
+     309:	68 00 52 00 00       	push   $0x5200
+     30e:	ff 35 c0 71 00 00    	push   0x71c0
+     314:	e8 77 44 00 00       	call   4790 <printf>
+      exit();
+     319:	e8 a6 42 00 00       	call   45c4 <exit>
+      printf(stdout, "child chdir failed\n");
+     31e:	50                   	push   %eax
+     31f:	50                   	push   %eax
+     320:	68 14 4b 00 00       	push   $0x4b14
+     325:	ff 35 c0 71 00 00    	push   0x71c0
+     32b:	e8 60 44 00 00       	call   4790 <printf>
+      exit();
+     330:	e8 8f 42 00 00       	call   45c4 <exit>
+     335:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     33c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000340 <openiputtest>:
+{
+     340:	55                   	push   %ebp
+     341:	89 e5                	mov    %esp,%ebp
+     343:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "openiput test\n");
+     346:	68 3a 4b 00 00       	push   $0x4b3a
+     34b:	ff 35 c0 71 00 00    	push   0x71c0
+     351:	e8 3a 44 00 00       	call   4790 <printf>
+  if(mkdir("oidir") < 0){
+     356:	c7 04 24 49 4b 00 00 	movl   $0x4b49,(%esp)
+     35d:	e8 ca 42 00 00       	call   462c <mkdir>
+     362:	83 c4 10             	add    $0x10,%esp
+     365:	85 c0                	test   %eax,%eax
+     367:	0f 88 9f 00 00 00    	js     40c <openiputtest+0xcc>
+  pid = fork();
+     36d:	e8 4a 42 00 00       	call   45bc <fork>
+  if(pid < 0){
+     372:	85 c0                	test   %eax,%eax
+     374:	78 7f                	js     3f5 <openiputtest+0xb5>
+  if(pid == 0){
+     376:	75 38                	jne    3b0 <openiputtest+0x70>
+    int fd = open("oidir", O_RDWR);
+     378:	83 ec 08             	sub    $0x8,%esp
+     37b:	6a 02                	push   $0x2
+     37d:	68 49 4b 00 00       	push   $0x4b49
+     382:	e8 7d 42 00 00       	call   4604 <open>
+    if(fd >= 0){
+     387:	83 c4 10             	add    $0x10,%esp
+     38a:	85 c0                	test   %eax,%eax
+     38c:	78 62                	js     3f0 <openiputtest+0xb0>
+      printf(stdout, "open directory for write succeeded\n");
+     38e:	83 ec 08             	sub    $0x8,%esp
+     391:	68 cc 5d 00 00       	push   $0x5dcc
+     396:	ff 35 c0 71 00 00    	push   0x71c0
+     39c:	e8 ef 43 00 00       	call   4790 <printf>
+      exit();
+     3a1:	e8 1e 42 00 00       	call   45c4 <exit>
+     3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ad:	8d 76 00             	lea    0x0(%esi),%esi
+  sleep(1);
+     3b0:	83 ec 0c             	sub    $0xc,%esp
+     3b3:	6a 01                	push   $0x1
+     3b5:	e8 9a 42 00 00       	call   4654 <sleep>
+  if(unlink("oidir") != 0){
+     3ba:	c7 04 24 49 4b 00 00 	movl   $0x4b49,(%esp)
+     3c1:	e8 4e 42 00 00       	call   4614 <unlink>
+     3c6:	83 c4 10             	add    $0x10,%esp
+     3c9:	85 c0                	test   %eax,%eax
+     3cb:	75 56                	jne    423 <openiputtest+0xe3>
+  wait();
+     3cd:	e8 fa 41 00 00       	call   45cc <wait>
+  printf(stdout, "openiput test ok\n");
+     3d2:	83 ec 08             	sub    $0x8,%esp
+     3d5:	68 63 4b 00 00       	push   $0x4b63
+     3da:	ff 35 c0 71 00 00    	push   0x71c0
+     3e0:	e8 ab 43 00 00       	call   4790 <printf>
+}
+     3e5:	83 c4 10             	add    $0x10,%esp
+     3e8:	c9                   	leave
+     3e9:	c3                   	ret
+     3ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    exit();
+     3f0:	e8 cf 41 00 00       	call   45c4 <exit>
+    printf(stdout, "fork failed\n");
+     3f5:	52                   	push   %edx
+     3f6:	52                   	push   %edx
+     3f7:	68 f9 5c 00 00       	push   $0x5cf9
+     3fc:	ff 35 c0 71 00 00    	push   0x71c0
+     402:	e8 89 43 00 00       	call   4790 <printf>
+    exit();
+     407:	e8 b8 41 00 00       	call   45c4 <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     40c:	51                   	push   %ecx
+     40d:	51                   	push   %ecx
+     40e:	68 4f 4b 00 00       	push   $0x4b4f
+     413:	ff 35 c0 71 00 00    	push   0x71c0
+     419:	e8 72 43 00 00       	call   4790 <printf>
+    exit();
+     41e:	e8 a1 41 00 00       	call   45c4 <exit>
+    printf(stdout, "unlink failed\n");
+     423:	50                   	push   %eax
+     424:	50                   	push   %eax
+     425:	68 45 52 00 00       	push   $0x5245
+     42a:	ff 35 c0 71 00 00    	push   0x71c0
+     430:	e8 5b 43 00 00       	call   4790 <printf>
+    exit();
+     435:	e8 8a 41 00 00       	call   45c4 <exit>
+     43a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000440 <opentest>:
+{
+     440:	55                   	push   %ebp
+     441:	89 e5                	mov    %esp,%ebp
+     443:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "open test\n");
+     446:	68 75 4b 00 00       	push   $0x4b75
+     44b:	ff 35 c0 71 00 00    	push   0x71c0
+     451:	e8 3a 43 00 00       	call   4790 <printf>
+  fd = open("echo", 0);
+     456:	58                   	pop    %eax
+     457:	5a                   	pop    %edx
+     458:	6a 00                	push   $0x0
+     45a:	68 80 4b 00 00       	push   $0x4b80
+     45f:	e8 a0 41 00 00       	call   4604 <open>
+  if(fd < 0){
+     464:	83 c4 10             	add    $0x10,%esp
+     467:	85 c0                	test   %eax,%eax
+     469:	78 36                	js     4a1 <opentest+0x61>
+  close(fd);
+     46b:	83 ec 0c             	sub    $0xc,%esp
+     46e:	50                   	push   %eax
+     46f:	e8 78 41 00 00       	call   45ec <close>
+  fd = open("doesnotexist", 0);
+     474:	5a                   	pop    %edx
+     475:	59                   	pop    %ecx
+     476:	6a 00                	push   $0x0
+     478:	68 98 4b 00 00       	push   $0x4b98
+     47d:	e8 82 41 00 00       	call   4604 <open>
+  if(fd >= 0){
+     482:	83 c4 10             	add    $0x10,%esp
+     485:	85 c0                	test   %eax,%eax
+     487:	79 2f                	jns    4b8 <opentest+0x78>
+  printf(stdout, "open test ok\n");
+     489:	83 ec 08             	sub    $0x8,%esp
+     48c:	68 c3 4b 00 00       	push   $0x4bc3
+     491:	ff 35 c0 71 00 00    	push   0x71c0
+     497:	e8 f4 42 00 00       	call   4790 <printf>
+}
+     49c:	83 c4 10             	add    $0x10,%esp
+     49f:	c9                   	leave
+     4a0:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     4a1:	50                   	push   %eax
+     4a2:	50                   	push   %eax
+     4a3:	68 85 4b 00 00       	push   $0x4b85
+     4a8:	ff 35 c0 71 00 00    	push   0x71c0
+     4ae:	e8 dd 42 00 00       	call   4790 <printf>
+    exit();
+     4b3:	e8 0c 41 00 00       	call   45c4 <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     4b8:	50                   	push   %eax
+     4b9:	50                   	push   %eax
+     4ba:	68 a5 4b 00 00       	push   $0x4ba5
+     4bf:	ff 35 c0 71 00 00    	push   0x71c0
+     4c5:	e8 c6 42 00 00       	call   4790 <printf>
+    exit();
+     4ca:	e8 f5 40 00 00       	call   45c4 <exit>
+     4cf:	90                   	nop
+
+000004d0 <writetest>:
+{
+     4d0:	55                   	push   %ebp
+     4d1:	89 e5                	mov    %esp,%ebp
+     4d3:	56                   	push   %esi
+     4d4:	53                   	push   %ebx
+  printf(stdout, "small file test\n");
+     4d5:	83 ec 08             	sub    $0x8,%esp
+     4d8:	68 d1 4b 00 00       	push   $0x4bd1
+     4dd:	ff 35 c0 71 00 00    	push   0x71c0
+     4e3:	e8 a8 42 00 00       	call   4790 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     4e8:	58                   	pop    %eax
+     4e9:	5a                   	pop    %edx
+     4ea:	68 02 02 00 00       	push   $0x202
+     4ef:	68 e2 4b 00 00       	push   $0x4be2
+     4f4:	e8 0b 41 00 00       	call   4604 <open>
+  if(fd >= 0){
+     4f9:	83 c4 10             	add    $0x10,%esp
+     4fc:	85 c0                	test   %eax,%eax
+     4fe:	0f 88 88 01 00 00    	js     68c <writetest+0x1bc>
+    printf(stdout, "creat small succeeded; ok\n");
+     504:	83 ec 08             	sub    $0x8,%esp
+     507:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+     509:	31 db                	xor    %ebx,%ebx
+    printf(stdout, "creat small succeeded; ok\n");
+     50b:	68 e8 4b 00 00       	push   $0x4be8
+     510:	ff 35 c0 71 00 00    	push   0x71c0
+     516:	e8 75 42 00 00       	call   4790 <printf>
+     51b:	83 c4 10             	add    $0x10,%esp
+     51e:	66 90                	xchg   %ax,%ax
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     520:	83 ec 04             	sub    $0x4,%esp
+     523:	6a 0a                	push   $0xa
+     525:	68 1f 4c 00 00       	push   $0x4c1f
+     52a:	56                   	push   %esi
+     52b:	e8 b4 40 00 00       	call   45e4 <write>
+     530:	83 c4 10             	add    $0x10,%esp
+     533:	83 f8 0a             	cmp    $0xa,%eax
+     536:	0f 85 d9 00 00 00    	jne    615 <writetest+0x145>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     53c:	83 ec 04             	sub    $0x4,%esp
+     53f:	6a 0a                	push   $0xa
+     541:	68 2a 4c 00 00       	push   $0x4c2a
+     546:	56                   	push   %esi
+     547:	e8 98 40 00 00       	call   45e4 <write>
+     54c:	83 c4 10             	add    $0x10,%esp
+     54f:	83 f8 0a             	cmp    $0xa,%eax
+     552:	0f 85 d6 00 00 00    	jne    62e <writetest+0x15e>
+  for(i = 0; i < 100; i++){
+     558:	83 c3 01             	add    $0x1,%ebx
+     55b:	83 fb 64             	cmp    $0x64,%ebx
+     55e:	75 c0                	jne    520 <writetest+0x50>
+  printf(stdout, "writes ok\n");
+     560:	83 ec 08             	sub    $0x8,%esp
+     563:	68 35 4c 00 00       	push   $0x4c35
+     568:	ff 35 c0 71 00 00    	push   0x71c0
+     56e:	e8 1d 42 00 00       	call   4790 <printf>
+  close(fd);
+     573:	89 34 24             	mov    %esi,(%esp)
+     576:	e8 71 40 00 00       	call   45ec <close>
+  fd = open("small", O_RDONLY);
+     57b:	5b                   	pop    %ebx
+     57c:	5e                   	pop    %esi
+     57d:	6a 00                	push   $0x0
+     57f:	68 e2 4b 00 00       	push   $0x4be2
+     584:	e8 7b 40 00 00       	call   4604 <open>
+  if(fd >= 0){
+     589:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     58c:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     58e:	85 c0                	test   %eax,%eax
+     590:	0f 88 b1 00 00 00    	js     647 <writetest+0x177>
+    printf(stdout, "open small succeeded ok\n");
+     596:	83 ec 08             	sub    $0x8,%esp
+     599:	68 40 4c 00 00       	push   $0x4c40
+     59e:	ff 35 c0 71 00 00    	push   0x71c0
+     5a4:	e8 e7 41 00 00       	call   4790 <printf>
+  i = read(fd, buf, 2000);
+     5a9:	83 c4 0c             	add    $0xc,%esp
+     5ac:	68 d0 07 00 00       	push   $0x7d0
+     5b1:	68 00 99 00 00       	push   $0x9900
+     5b6:	53                   	push   %ebx
+     5b7:	e8 20 40 00 00       	call   45dc <read>
+  if(i == 2000){
+     5bc:	83 c4 10             	add    $0x10,%esp
+     5bf:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     5c4:	0f 85 94 00 00 00    	jne    65e <writetest+0x18e>
+    printf(stdout, "read succeeded ok\n");
+     5ca:	83 ec 08             	sub    $0x8,%esp
+     5cd:	68 74 4c 00 00       	push   $0x4c74
+     5d2:	ff 35 c0 71 00 00    	push   0x71c0
+     5d8:	e8 b3 41 00 00       	call   4790 <printf>
+  close(fd);
+     5dd:	89 1c 24             	mov    %ebx,(%esp)
+     5e0:	e8 07 40 00 00       	call   45ec <close>
+  if(unlink("small") < 0){
+     5e5:	c7 04 24 e2 4b 00 00 	movl   $0x4be2,(%esp)
+     5ec:	e8 23 40 00 00       	call   4614 <unlink>
+     5f1:	83 c4 10             	add    $0x10,%esp
+     5f4:	85 c0                	test   %eax,%eax
+     5f6:	78 7d                	js     675 <writetest+0x1a5>
+  printf(stdout, "small file test ok\n");
+     5f8:	83 ec 08             	sub    $0x8,%esp
+     5fb:	68 9c 4c 00 00       	push   $0x4c9c
+     600:	ff 35 c0 71 00 00    	push   0x71c0
+     606:	e8 85 41 00 00       	call   4790 <printf>
+}
+     60b:	83 c4 10             	add    $0x10,%esp
+     60e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     611:	5b                   	pop    %ebx
+     612:	5e                   	pop    %esi
+     613:	5d                   	pop    %ebp
+     614:	c3                   	ret
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     615:	83 ec 04             	sub    $0x4,%esp
+     618:	53                   	push   %ebx
+     619:	68 f0 5d 00 00       	push   $0x5df0
+     61e:	ff 35 c0 71 00 00    	push   0x71c0
+     624:	e8 67 41 00 00       	call   4790 <printf>
+      exit();
+     629:	e8 96 3f 00 00       	call   45c4 <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     62e:	83 ec 04             	sub    $0x4,%esp
+     631:	53                   	push   %ebx
+     632:	68 14 5e 00 00       	push   $0x5e14
+     637:	ff 35 c0 71 00 00    	push   0x71c0
+     63d:	e8 4e 41 00 00       	call   4790 <printf>
+      exit();
+     642:	e8 7d 3f 00 00       	call   45c4 <exit>
+    printf(stdout, "error: open small failed!\n");
+     647:	51                   	push   %ecx
+     648:	51                   	push   %ecx
+     649:	68 59 4c 00 00       	push   $0x4c59
+     64e:	ff 35 c0 71 00 00    	push   0x71c0
+     654:	e8 37 41 00 00       	call   4790 <printf>
+    exit();
+     659:	e8 66 3f 00 00       	call   45c4 <exit>
+    printf(stdout, "read failed\n");
+     65e:	52                   	push   %edx
+     65f:	52                   	push   %edx
+     660:	68 c4 5a 00 00       	push   $0x5ac4
+     665:	ff 35 c0 71 00 00    	push   0x71c0
+     66b:	e8 20 41 00 00       	call   4790 <printf>
+    exit();
+     670:	e8 4f 3f 00 00       	call   45c4 <exit>
+    printf(stdout, "unlink small failed\n");
+     675:	50                   	push   %eax
+     676:	50                   	push   %eax
+     677:	68 87 4c 00 00       	push   $0x4c87
+     67c:	ff 35 c0 71 00 00    	push   0x71c0
+     682:	e8 09 41 00 00       	call   4790 <printf>
+    exit();
+     687:	e8 38 3f 00 00       	call   45c4 <exit>
+    printf(stdout, "error: creat small failed!\n");
+     68c:	50                   	push   %eax
+     68d:	50                   	push   %eax
+     68e:	68 03 4c 00 00       	push   $0x4c03
+     693:	ff 35 c0 71 00 00    	push   0x71c0
+     699:	e8 f2 40 00 00       	call   4790 <printf>
+    exit();
+     69e:	e8 21 3f 00 00       	call   45c4 <exit>
+     6a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000006b0 <writetest1>:
+{
+     6b0:	55                   	push   %ebp
+     6b1:	89 e5                	mov    %esp,%ebp
+     6b3:	56                   	push   %esi
+     6b4:	53                   	push   %ebx
+  printf(stdout, "big files test\n");
+     6b5:	83 ec 08             	sub    $0x8,%esp
+     6b8:	68 b0 4c 00 00       	push   $0x4cb0
+     6bd:	ff 35 c0 71 00 00    	push   0x71c0
+     6c3:	e8 c8 40 00 00       	call   4790 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+     6c8:	58                   	pop    %eax
+     6c9:	5a                   	pop    %edx
+     6ca:	68 02 02 00 00       	push   $0x202
+     6cf:	68 2a 4d 00 00       	push   $0x4d2a
+     6d4:	e8 2b 3f 00 00       	call   4604 <open>
+  if(fd < 0){
+     6d9:	83 c4 10             	add    $0x10,%esp
+     6dc:	85 c0                	test   %eax,%eax
+     6de:	0f 88 5d 01 00 00    	js     841 <writetest1+0x191>
+     6e4:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < NBIG; i++){
+     6e6:	31 db                	xor    %ebx,%ebx
+     6e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6ef:	90                   	nop
+    if(write(fd, buf, BSIZE) != BSIZE){
+     6f0:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+     6f3:	89 1d 00 99 00 00    	mov    %ebx,0x9900
+    if(write(fd, buf, BSIZE) != BSIZE){
+     6f9:	68 00 10 00 00       	push   $0x1000
+     6fe:	68 00 99 00 00       	push   $0x9900
+     703:	56                   	push   %esi
+     704:	e8 db 3e 00 00       	call   45e4 <write>
+     709:	83 c4 10             	add    $0x10,%esp
+     70c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+     711:	0f 85 b3 00 00 00    	jne    7ca <writetest1+0x11a>
+  for(i = 0; i < NBIG; i++){
+     717:	83 c3 01             	add    $0x1,%ebx
+     71a:	81 fb 0d 04 00 00    	cmp    $0x40d,%ebx
+     720:	75 ce                	jne    6f0 <writetest1+0x40>
+  close(fd);
+     722:	83 ec 0c             	sub    $0xc,%esp
+     725:	56                   	push   %esi
+     726:	e8 c1 3e 00 00       	call   45ec <close>
+  fd = open("big", O_RDONLY);
+     72b:	5b                   	pop    %ebx
+     72c:	5e                   	pop    %esi
+     72d:	6a 00                	push   $0x0
+     72f:	68 2a 4d 00 00       	push   $0x4d2a
+     734:	e8 cb 3e 00 00       	call   4604 <open>
+  if(fd < 0){
+     739:	83 c4 10             	add    $0x10,%esp
+  fd = open("big", O_RDONLY);
+     73c:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     73e:	85 c0                	test   %eax,%eax
+     740:	0f 88 e4 00 00 00    	js     82a <writetest1+0x17a>
+  n = 0;
+     746:	31 f6                	xor    %esi,%esi
+     748:	eb 1d                	jmp    767 <writetest1+0xb7>
+     74a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(i != BSIZE){
+     750:	3d 00 10 00 00       	cmp    $0x1000,%eax
+     755:	0f 85 9f 00 00 00    	jne    7fa <writetest1+0x14a>
+    if(((int*)buf)[0] != n){
+     75b:	a1 00 99 00 00       	mov    0x9900,%eax
+     760:	39 f0                	cmp    %esi,%eax
+     762:	75 7f                	jne    7e3 <writetest1+0x133>
+    n++;
+     764:	83 c6 01             	add    $0x1,%esi
+    i = read(fd, buf, BSIZE);
+     767:	83 ec 04             	sub    $0x4,%esp
+     76a:	68 00 10 00 00       	push   $0x1000
+     76f:	68 00 99 00 00       	push   $0x9900
+     774:	53                   	push   %ebx
+     775:	e8 62 3e 00 00       	call   45dc <read>
+    if(i == 0){
+     77a:	83 c4 10             	add    $0x10,%esp
+     77d:	85 c0                	test   %eax,%eax
+     77f:	75 cf                	jne    750 <writetest1+0xa0>
+      if(n != NBIG){
+     781:	81 fe 0d 04 00 00    	cmp    $0x40d,%esi
+     787:	0f 85 86 00 00 00    	jne    813 <writetest1+0x163>
+  close(fd);
+     78d:	83 ec 0c             	sub    $0xc,%esp
+     790:	53                   	push   %ebx
+     791:	e8 56 3e 00 00       	call   45ec <close>
+  if(unlink("big") < 0){
+     796:	c7 04 24 2a 4d 00 00 	movl   $0x4d2a,(%esp)
+     79d:	e8 72 3e 00 00       	call   4614 <unlink>
+     7a2:	83 c4 10             	add    $0x10,%esp
+     7a5:	85 c0                	test   %eax,%eax
+     7a7:	0f 88 ab 00 00 00    	js     858 <writetest1+0x1a8>
+  printf(stdout, "big files ok\n");
+     7ad:	83 ec 08             	sub    $0x8,%esp
+     7b0:	68 51 4d 00 00       	push   $0x4d51
+     7b5:	ff 35 c0 71 00 00    	push   0x71c0
+     7bb:	e8 d0 3f 00 00       	call   4790 <printf>
+}
+     7c0:	83 c4 10             	add    $0x10,%esp
+     7c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     7c6:	5b                   	pop    %ebx
+     7c7:	5e                   	pop    %esi
+     7c8:	5d                   	pop    %ebp
+     7c9:	c3                   	ret
+      printf(stdout, "error: write big file failed\n", i);
+     7ca:	83 ec 04             	sub    $0x4,%esp
+     7cd:	53                   	push   %ebx
+     7ce:	68 da 4c 00 00       	push   $0x4cda
+     7d3:	ff 35 c0 71 00 00    	push   0x71c0
+     7d9:	e8 b2 3f 00 00       	call   4790 <printf>
+      exit();
+     7de:	e8 e1 3d 00 00       	call   45c4 <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     7e3:	50                   	push   %eax
+     7e4:	56                   	push   %esi
+     7e5:	68 38 5e 00 00       	push   $0x5e38
+     7ea:	ff 35 c0 71 00 00    	push   0x71c0
+     7f0:	e8 9b 3f 00 00       	call   4790 <printf>
+      exit();
+     7f5:	e8 ca 3d 00 00       	call   45c4 <exit>
+      printf(stdout, "read failed %d\n", i);
+     7fa:	83 ec 04             	sub    $0x4,%esp
+     7fd:	50                   	push   %eax
+     7fe:	68 2e 4d 00 00       	push   $0x4d2e
+     803:	ff 35 c0 71 00 00    	push   0x71c0
+     809:	e8 82 3f 00 00       	call   4790 <printf>
+      exit();
+     80e:	e8 b1 3d 00 00       	call   45c4 <exit>
+        printf(stdout, "read only %d blocks from big", n);
+     813:	52                   	push   %edx
+     814:	56                   	push   %esi
+     815:	68 11 4d 00 00       	push   $0x4d11
+     81a:	ff 35 c0 71 00 00    	push   0x71c0
+     820:	e8 6b 3f 00 00       	call   4790 <printf>
+        exit();
+     825:	e8 9a 3d 00 00       	call   45c4 <exit>
+    printf(stdout, "error: open big failed!\n");
+     82a:	51                   	push   %ecx
+     82b:	51                   	push   %ecx
+     82c:	68 f8 4c 00 00       	push   $0x4cf8
+     831:	ff 35 c0 71 00 00    	push   0x71c0
+     837:	e8 54 3f 00 00       	call   4790 <printf>
+    exit();
+     83c:	e8 83 3d 00 00       	call   45c4 <exit>
+    printf(stdout, "error: creat big failed!\n");
+     841:	50                   	push   %eax
+     842:	50                   	push   %eax
+     843:	68 c0 4c 00 00       	push   $0x4cc0
+     848:	ff 35 c0 71 00 00    	push   0x71c0
+     84e:	e8 3d 3f 00 00       	call   4790 <printf>
+    exit();
+     853:	e8 6c 3d 00 00       	call   45c4 <exit>
+    printf(stdout, "unlink big failed\n");
+     858:	50                   	push   %eax
+     859:	50                   	push   %eax
+     85a:	68 3e 4d 00 00       	push   $0x4d3e
+     85f:	ff 35 c0 71 00 00    	push   0x71c0
+     865:	e8 26 3f 00 00       	call   4790 <printf>
+    exit();
+     86a:	e8 55 3d 00 00       	call   45c4 <exit>
+     86f:	90                   	nop
+
+00000870 <createtest>:
+{
+     870:	55                   	push   %ebp
+     871:	89 e5                	mov    %esp,%ebp
+     873:	53                   	push   %ebx
+  name[2] = '\0';
+     874:	bb 30 00 00 00       	mov    $0x30,%ebx
+{
+     879:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "many creates, followed by unlink test\n");
+     87c:	68 58 5e 00 00       	push   $0x5e58
+     881:	ff 35 c0 71 00 00    	push   0x71c0
+     887:	e8 04 3f 00 00       	call   4790 <printf>
+  name[0] = 'a';
+     88c:	c6 05 f0 98 00 00 61 	movb   $0x61,0x98f0
+  name[2] = '\0';
+     893:	83 c4 10             	add    $0x10,%esp
+     896:	c6 05 f2 98 00 00 00 	movb   $0x0,0x98f2
+  for(i = 0; i < 52; i++){
+     89d:	8d 76 00             	lea    0x0(%esi),%esi
+    fd = open(name, O_CREATE|O_RDWR);
+     8a0:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i;
+     8a3:	88 1d f1 98 00 00    	mov    %bl,0x98f1
+  for(i = 0; i < 52; i++){
+     8a9:	83 c3 01             	add    $0x1,%ebx
+    fd = open(name, O_CREATE|O_RDWR);
+     8ac:	68 02 02 00 00       	push   $0x202
+     8b1:	68 f0 98 00 00       	push   $0x98f0
+     8b6:	e8 49 3d 00 00       	call   4604 <open>
+    close(fd);
+     8bb:	89 04 24             	mov    %eax,(%esp)
+     8be:	e8 29 3d 00 00       	call   45ec <close>
+  for(i = 0; i < 52; i++){
+     8c3:	83 c4 10             	add    $0x10,%esp
+     8c6:	80 fb 64             	cmp    $0x64,%bl
+     8c9:	75 d5                	jne    8a0 <createtest+0x30>
+  name[0] = 'a';
+     8cb:	c6 05 f0 98 00 00 61 	movb   $0x61,0x98f0
+  name[2] = '\0';
+     8d2:	bb 30 00 00 00       	mov    $0x30,%ebx
+     8d7:	c6 05 f2 98 00 00 00 	movb   $0x0,0x98f2
+  for(i = 0; i < 52; i++){
+     8de:	66 90                	xchg   %ax,%ax
+    unlink(name);
+     8e0:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i;
+     8e3:	88 1d f1 98 00 00    	mov    %bl,0x98f1
+  for(i = 0; i < 52; i++){
+     8e9:	83 c3 01             	add    $0x1,%ebx
+    unlink(name);
+     8ec:	68 f0 98 00 00       	push   $0x98f0
+     8f1:	e8 1e 3d 00 00       	call   4614 <unlink>
+  for(i = 0; i < 52; i++){
+     8f6:	83 c4 10             	add    $0x10,%esp
+     8f9:	80 fb 64             	cmp    $0x64,%bl
+     8fc:	75 e2                	jne    8e0 <createtest+0x70>
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     8fe:	83 ec 08             	sub    $0x8,%esp
+     901:	68 80 5e 00 00       	push   $0x5e80
+     906:	ff 35 c0 71 00 00    	push   0x71c0
+     90c:	e8 7f 3e 00 00       	call   4790 <printf>
+}
+     911:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     914:	83 c4 10             	add    $0x10,%esp
+     917:	c9                   	leave
+     918:	c3                   	ret
+     919:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000920 <dirtest>:
+{
+     920:	55                   	push   %ebp
+     921:	89 e5                	mov    %esp,%ebp
+     923:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     926:	68 5f 4d 00 00       	push   $0x4d5f
+     92b:	ff 35 c0 71 00 00    	push   0x71c0
+     931:	e8 5a 3e 00 00       	call   4790 <printf>
+  if(mkdir("dir0") < 0){
+     936:	c7 04 24 6b 4d 00 00 	movl   $0x4d6b,(%esp)
+     93d:	e8 ea 3c 00 00       	call   462c <mkdir>
+     942:	83 c4 10             	add    $0x10,%esp
+     945:	85 c0                	test   %eax,%eax
+     947:	78 58                	js     9a1 <dirtest+0x81>
+  if(chdir("dir0") < 0){
+     949:	83 ec 0c             	sub    $0xc,%esp
+     94c:	68 6b 4d 00 00       	push   $0x4d6b
+     951:	e8 de 3c 00 00       	call   4634 <chdir>
+     956:	83 c4 10             	add    $0x10,%esp
+     959:	85 c0                	test   %eax,%eax
+     95b:	0f 88 85 00 00 00    	js     9e6 <dirtest+0xc6>
+  if(chdir("..") < 0){
+     961:	83 ec 0c             	sub    $0xc,%esp
+     964:	68 a5 53 00 00       	push   $0x53a5
+     969:	e8 c6 3c 00 00       	call   4634 <chdir>
+     96e:	83 c4 10             	add    $0x10,%esp
+     971:	85 c0                	test   %eax,%eax
+     973:	78 5a                	js     9cf <dirtest+0xaf>
+  if(unlink("dir0") < 0){
+     975:	83 ec 0c             	sub    $0xc,%esp
+     978:	68 6b 4d 00 00       	push   $0x4d6b
+     97d:	e8 92 3c 00 00       	call   4614 <unlink>
+     982:	83 c4 10             	add    $0x10,%esp
+     985:	85 c0                	test   %eax,%eax
+     987:	78 2f                	js     9b8 <dirtest+0x98>
+  printf(stdout, "mkdir test ok\n");
+     989:	83 ec 08             	sub    $0x8,%esp
+     98c:	68 a8 4d 00 00       	push   $0x4da8
+     991:	ff 35 c0 71 00 00    	push   0x71c0
+     997:	e8 f4 3d 00 00       	call   4790 <printf>
+}
+     99c:	83 c4 10             	add    $0x10,%esp
+     99f:	c9                   	leave
+     9a0:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     9a1:	50                   	push   %eax
+     9a2:	50                   	push   %eax
+     9a3:	68 00 52 00 00       	push   $0x5200
+     9a8:	ff 35 c0 71 00 00    	push   0x71c0
+     9ae:	e8 dd 3d 00 00       	call   4790 <printf>
+    exit();
+     9b3:	e8 0c 3c 00 00       	call   45c4 <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     9b8:	50                   	push   %eax
+     9b9:	50                   	push   %eax
+     9ba:	68 94 4d 00 00       	push   $0x4d94
+     9bf:	ff 35 c0 71 00 00    	push   0x71c0
+     9c5:	e8 c6 3d 00 00       	call   4790 <printf>
+    exit();
+     9ca:	e8 f5 3b 00 00       	call   45c4 <exit>
+    printf(stdout, "chdir .. failed\n");
+     9cf:	52                   	push   %edx
+     9d0:	52                   	push   %edx
+     9d1:	68 83 4d 00 00       	push   $0x4d83
+     9d6:	ff 35 c0 71 00 00    	push   0x71c0
+     9dc:	e8 af 3d 00 00       	call   4790 <printf>
+    exit();
+     9e1:	e8 de 3b 00 00       	call   45c4 <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     9e6:	51                   	push   %ecx
+     9e7:	51                   	push   %ecx
+     9e8:	68 70 4d 00 00       	push   $0x4d70
+     9ed:	ff 35 c0 71 00 00    	push   0x71c0
+     9f3:	e8 98 3d 00 00       	call   4790 <printf>
+    exit();
+     9f8:	e8 c7 3b 00 00       	call   45c4 <exit>
+     9fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a00 <exectest>:
+{
+     a00:	55                   	push   %ebp
+     a01:	89 e5                	mov    %esp,%ebp
+     a03:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     a06:	68 b7 4d 00 00       	push   $0x4db7
+     a0b:	ff 35 c0 71 00 00    	push   0x71c0
+     a11:	e8 7a 3d 00 00       	call   4790 <printf>
+  if(exec("echo", echoargv) < 0){
+     a16:	5a                   	pop    %edx
+     a17:	59                   	pop    %ecx
+     a18:	68 c4 71 00 00       	push   $0x71c4
+     a1d:	68 80 4b 00 00       	push   $0x4b80
+     a22:	e8 d5 3b 00 00       	call   45fc <exec>
+     a27:	83 c4 10             	add    $0x10,%esp
+     a2a:	85 c0                	test   %eax,%eax
+     a2c:	78 02                	js     a30 <exectest+0x30>
+}
+     a2e:	c9                   	leave
+     a2f:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     a30:	50                   	push   %eax
+     a31:	50                   	push   %eax
+     a32:	68 c2 4d 00 00       	push   $0x4dc2
+     a37:	ff 35 c0 71 00 00    	push   0x71c0
+     a3d:	e8 4e 3d 00 00       	call   4790 <printf>
+    exit();
+     a42:	e8 7d 3b 00 00       	call   45c4 <exit>
+     a47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a4e:	66 90                	xchg   %ax,%ax
+
+00000a50 <pipe1>:
+{
+     a50:	55                   	push   %ebp
+     a51:	89 e5                	mov    %esp,%ebp
+     a53:	57                   	push   %edi
+     a54:	56                   	push   %esi
+  if(pipe(fds) != 0){
+     a55:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+     a58:	53                   	push   %ebx
+     a59:	83 ec 28             	sub    $0x28,%esp
+  if(pipe(fds) != 0){
+     a5c:	50                   	push   %eax
+     a5d:	e8 72 3b 00 00       	call   45d4 <pipe>
+     a62:	83 c4 10             	add    $0x10,%esp
+     a65:	85 c0                	test   %eax,%eax
+     a67:	0f 85 41 01 00 00    	jne    bae <pipe1+0x15e>
+     a6d:	89 c6                	mov    %eax,%esi
+  pid = fork();
+     a6f:	e8 48 3b 00 00       	call   45bc <fork>
+  if(pid == 0){
+     a74:	85 c0                	test   %eax,%eax
+     a76:	0f 84 92 00 00 00    	je     b0e <pipe1+0xbe>
+  } else if(pid > 0){
+     a7c:	0f 8e 3f 01 00 00    	jle    bc1 <pipe1+0x171>
+    close(fds[1]);
+     a82:	83 ec 0c             	sub    $0xc,%esp
+     a85:	ff 75 e4             	push   -0x1c(%ebp)
+    total = 0;
+     a88:	31 db                	xor    %ebx,%ebx
+    cc = 1;
+     a8a:	bf 01 00 00 00       	mov    $0x1,%edi
+    close(fds[1]);
+     a8f:	e8 58 3b 00 00       	call   45ec <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+     a94:	83 c4 10             	add    $0x10,%esp
+     a97:	83 ec 04             	sub    $0x4,%esp
+     a9a:	57                   	push   %edi
+     a9b:	68 00 99 00 00       	push   $0x9900
+     aa0:	ff 75 e0             	push   -0x20(%ebp)
+     aa3:	e8 34 3b 00 00       	call   45dc <read>
+     aa8:	83 c4 10             	add    $0x10,%esp
+     aab:	89 c1                	mov    %eax,%ecx
+     aad:	85 c0                	test   %eax,%eax
+     aaf:	0f 8e b8 00 00 00    	jle    b6d <pipe1+0x11d>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     ab5:	89 f0                	mov    %esi,%eax
+     ab7:	32 05 00 99 00 00    	xor    0x9900,%al
+     abd:	0f b6 c0             	movzbl %al,%eax
+     ac0:	85 c0                	test   %eax,%eax
+     ac2:	75 30                	jne    af4 <pipe1+0xa4>
+     ac4:	83 c6 01             	add    $0x1,%esi
+     ac7:	eb 0f                	jmp    ad8 <pipe1+0x88>
+     ac9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ad0:	38 90 00 99 00 00    	cmp    %dl,0x9900(%eax)
+     ad6:	75 1c                	jne    af4 <pipe1+0xa4>
+     ad8:	8d 14 06             	lea    (%esi,%eax,1),%edx
+      for(i = 0; i < n; i++){
+     adb:	83 c0 01             	add    $0x1,%eax
+     ade:	39 c1                	cmp    %eax,%ecx
+     ae0:	75 ee                	jne    ad0 <pipe1+0x80>
+      cc = cc * 2;
+     ae2:	01 ff                	add    %edi,%edi
+      if(cc > sizeof(buf))
+     ae4:	b8 00 20 00 00       	mov    $0x2000,%eax
+      total += n;
+     ae9:	01 cb                	add    %ecx,%ebx
+      if(cc > sizeof(buf))
+     aeb:	89 d6                	mov    %edx,%esi
+     aed:	39 c7                	cmp    %eax,%edi
+     aef:	0f 4f f8             	cmovg  %eax,%edi
+     af2:	eb a3                	jmp    a97 <pipe1+0x47>
+          printf(1, "pipe1 oops 2\n");
+     af4:	83 ec 08             	sub    $0x8,%esp
+     af7:	68 f1 4d 00 00       	push   $0x4df1
+     afc:	6a 01                	push   $0x1
+     afe:	e8 8d 3c 00 00       	call   4790 <printf>
+     b03:	83 c4 10             	add    $0x10,%esp
+}
+     b06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b09:	5b                   	pop    %ebx
+     b0a:	5e                   	pop    %esi
+     b0b:	5f                   	pop    %edi
+     b0c:	5d                   	pop    %ebp
+     b0d:	c3                   	ret
+    close(fds[0]);
+     b0e:	83 ec 0c             	sub    $0xc,%esp
+     b11:	ff 75 e0             	push   -0x20(%ebp)
+  seq = 0;
+     b14:	31 db                	xor    %ebx,%ebx
+    close(fds[0]);
+     b16:	e8 d1 3a 00 00       	call   45ec <close>
+     b1b:	83 c4 10             	add    $0x10,%esp
+     b1e:	66 90                	xchg   %ax,%ax
+      for(i = 0; i < 1033; i++)
+     b20:	31 c0                	xor    %eax,%eax
+     b22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        buf[i] = seq++;
+     b28:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+      for(i = 0; i < 1033; i++)
+     b2b:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+     b2e:	88 90 ff 98 00 00    	mov    %dl,0x98ff(%eax)
+      for(i = 0; i < 1033; i++)
+     b34:	3d 09 04 00 00       	cmp    $0x409,%eax
+     b39:	75 ed                	jne    b28 <pipe1+0xd8>
+      if(write(fds[1], buf, 1033) != 1033){
+     b3b:	83 ec 04             	sub    $0x4,%esp
+        buf[i] = seq++;
+     b3e:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+     b44:	68 09 04 00 00       	push   $0x409
+     b49:	68 00 99 00 00       	push   $0x9900
+     b4e:	ff 75 e4             	push   -0x1c(%ebp)
+     b51:	e8 8e 3a 00 00       	call   45e4 <write>
+     b56:	83 c4 10             	add    $0x10,%esp
+     b59:	3d 09 04 00 00       	cmp    $0x409,%eax
+     b5e:	75 74                	jne    bd4 <pipe1+0x184>
+    for(n = 0; n < 5; n++){
+     b60:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     b66:	75 b8                	jne    b20 <pipe1+0xd0>
+    exit();
+     b68:	e8 57 3a 00 00       	call   45c4 <exit>
+    if(total != 5 * 1033){
+     b6d:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     b73:	75 26                	jne    b9b <pipe1+0x14b>
+    close(fds[0]);
+     b75:	83 ec 0c             	sub    $0xc,%esp
+     b78:	ff 75 e0             	push   -0x20(%ebp)
+     b7b:	e8 6c 3a 00 00       	call   45ec <close>
+    wait();
+     b80:	e8 47 3a 00 00       	call   45cc <wait>
+  printf(1, "pipe1 ok\n");
+     b85:	5a                   	pop    %edx
+     b86:	59                   	pop    %ecx
+     b87:	68 16 4e 00 00       	push   $0x4e16
+     b8c:	6a 01                	push   $0x1
+     b8e:	e8 fd 3b 00 00       	call   4790 <printf>
+     b93:	83 c4 10             	add    $0x10,%esp
+     b96:	e9 6b ff ff ff       	jmp    b06 <pipe1+0xb6>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     b9b:	56                   	push   %esi
+     b9c:	53                   	push   %ebx
+     b9d:	68 ff 4d 00 00       	push   $0x4dff
+     ba2:	6a 01                	push   $0x1
+     ba4:	e8 e7 3b 00 00       	call   4790 <printf>
+      exit();
+     ba9:	e8 16 3a 00 00       	call   45c4 <exit>
+    printf(1, "pipe() failed\n");
+     bae:	50                   	push   %eax
+     baf:	50                   	push   %eax
+     bb0:	68 d4 4d 00 00       	push   $0x4dd4
+     bb5:	6a 01                	push   $0x1
+     bb7:	e8 d4 3b 00 00       	call   4790 <printf>
+    exit();
+     bbc:	e8 03 3a 00 00       	call   45c4 <exit>
+    printf(1, "fork() failed\n");
+     bc1:	50                   	push   %eax
+     bc2:	50                   	push   %eax
+     bc3:	68 20 4e 00 00       	push   $0x4e20
+     bc8:	6a 01                	push   $0x1
+     bca:	e8 c1 3b 00 00       	call   4790 <printf>
+    exit();
+     bcf:	e8 f0 39 00 00       	call   45c4 <exit>
+        printf(1, "pipe1 oops 1\n");
+     bd4:	57                   	push   %edi
+     bd5:	57                   	push   %edi
+     bd6:	68 e3 4d 00 00       	push   $0x4de3
+     bdb:	6a 01                	push   $0x1
+     bdd:	e8 ae 3b 00 00       	call   4790 <printf>
+        exit();
+     be2:	e8 dd 39 00 00       	call   45c4 <exit>
+     be7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bee:	66 90                	xchg   %ax,%ax
+
+00000bf0 <preempt>:
+{
+     bf0:	55                   	push   %ebp
+     bf1:	89 e5                	mov    %esp,%ebp
+     bf3:	57                   	push   %edi
+     bf4:	56                   	push   %esi
+     bf5:	53                   	push   %ebx
+     bf6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "preempt: ");
+     bf9:	68 2f 4e 00 00       	push   $0x4e2f
+     bfe:	6a 01                	push   $0x1
+     c00:	e8 8b 3b 00 00       	call   4790 <printf>
+  pid1 = fork();
+     c05:	e8 b2 39 00 00       	call   45bc <fork>
+  if(pid1 == 0)
+     c0a:	83 c4 10             	add    $0x10,%esp
+     c0d:	85 c0                	test   %eax,%eax
+     c0f:	75 07                	jne    c18 <preempt+0x28>
+    for(;;)
+     c11:	eb fe                	jmp    c11 <preempt+0x21>
+     c13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c17:	90                   	nop
+     c18:	89 c3                	mov    %eax,%ebx
+  pid2 = fork();
+     c1a:	e8 9d 39 00 00       	call   45bc <fork>
+     c1f:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+     c21:	85 c0                	test   %eax,%eax
+     c23:	75 0b                	jne    c30 <preempt+0x40>
+    for(;;)
+     c25:	eb fe                	jmp    c25 <preempt+0x35>
+     c27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c2e:	66 90                	xchg   %ax,%ax
+  pipe(pfds);
+     c30:	83 ec 0c             	sub    $0xc,%esp
+     c33:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     c36:	50                   	push   %eax
+     c37:	e8 98 39 00 00       	call   45d4 <pipe>
+  pid3 = fork();
+     c3c:	e8 7b 39 00 00       	call   45bc <fork>
+  if(pid3 == 0){
+     c41:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+     c44:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+     c46:	85 c0                	test   %eax,%eax
+     c48:	75 3e                	jne    c88 <preempt+0x98>
+    close(pfds[0]);
+     c4a:	83 ec 0c             	sub    $0xc,%esp
+     c4d:	ff 75 e0             	push   -0x20(%ebp)
+     c50:	e8 97 39 00 00       	call   45ec <close>
+    if(write(pfds[1], "x", 1) != 1)
+     c55:	83 c4 0c             	add    $0xc,%esp
+     c58:	6a 01                	push   $0x1
+     c5a:	68 89 54 00 00       	push   $0x5489
+     c5f:	ff 75 e4             	push   -0x1c(%ebp)
+     c62:	e8 7d 39 00 00       	call   45e4 <write>
+     c67:	83 c4 10             	add    $0x10,%esp
+     c6a:	83 f8 01             	cmp    $0x1,%eax
+     c6d:	0f 85 b8 00 00 00    	jne    d2b <preempt+0x13b>
+    close(pfds[1]);
+     c73:	83 ec 0c             	sub    $0xc,%esp
+     c76:	ff 75 e4             	push   -0x1c(%ebp)
+     c79:	e8 6e 39 00 00       	call   45ec <close>
+     c7e:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+     c81:	eb fe                	jmp    c81 <preempt+0x91>
+     c83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c87:	90                   	nop
+  close(pfds[1]);
+     c88:	83 ec 0c             	sub    $0xc,%esp
+     c8b:	ff 75 e4             	push   -0x1c(%ebp)
+     c8e:	e8 59 39 00 00       	call   45ec <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     c93:	83 c4 0c             	add    $0xc,%esp
+     c96:	68 00 20 00 00       	push   $0x2000
+     c9b:	68 00 99 00 00       	push   $0x9900
+     ca0:	ff 75 e0             	push   -0x20(%ebp)
+     ca3:	e8 34 39 00 00       	call   45dc <read>
+     ca8:	83 c4 10             	add    $0x10,%esp
+     cab:	83 f8 01             	cmp    $0x1,%eax
+     cae:	75 67                	jne    d17 <preempt+0x127>
+  close(pfds[0]);
+     cb0:	83 ec 0c             	sub    $0xc,%esp
+     cb3:	ff 75 e0             	push   -0x20(%ebp)
+     cb6:	e8 31 39 00 00       	call   45ec <close>
+  printf(1, "kill... ");
+     cbb:	58                   	pop    %eax
+     cbc:	5a                   	pop    %edx
+     cbd:	68 60 4e 00 00       	push   $0x4e60
+     cc2:	6a 01                	push   $0x1
+     cc4:	e8 c7 3a 00 00       	call   4790 <printf>
+  kill(pid1);
+     cc9:	89 1c 24             	mov    %ebx,(%esp)
+     ccc:	e8 23 39 00 00       	call   45f4 <kill>
+  kill(pid2);
+     cd1:	89 34 24             	mov    %esi,(%esp)
+     cd4:	e8 1b 39 00 00       	call   45f4 <kill>
+  kill(pid3);
+     cd9:	89 3c 24             	mov    %edi,(%esp)
+     cdc:	e8 13 39 00 00       	call   45f4 <kill>
+  printf(1, "wait... ");
+     ce1:	59                   	pop    %ecx
+     ce2:	5b                   	pop    %ebx
+     ce3:	68 69 4e 00 00       	push   $0x4e69
+     ce8:	6a 01                	push   $0x1
+     cea:	e8 a1 3a 00 00       	call   4790 <printf>
+  wait();
+     cef:	e8 d8 38 00 00       	call   45cc <wait>
+  wait();
+     cf4:	e8 d3 38 00 00       	call   45cc <wait>
+  wait();
+     cf9:	e8 ce 38 00 00       	call   45cc <wait>
+  printf(1, "preempt ok\n");
+     cfe:	5e                   	pop    %esi
+     cff:	5f                   	pop    %edi
+     d00:	68 72 4e 00 00       	push   $0x4e72
+     d05:	6a 01                	push   $0x1
+     d07:	e8 84 3a 00 00       	call   4790 <printf>
+     d0c:	83 c4 10             	add    $0x10,%esp
+}
+     d0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d12:	5b                   	pop    %ebx
+     d13:	5e                   	pop    %esi
+     d14:	5f                   	pop    %edi
+     d15:	5d                   	pop    %ebp
+     d16:	c3                   	ret
+    printf(1, "preempt read error");
+     d17:	83 ec 08             	sub    $0x8,%esp
+     d1a:	68 4d 4e 00 00       	push   $0x4e4d
+     d1f:	6a 01                	push   $0x1
+     d21:	e8 6a 3a 00 00       	call   4790 <printf>
+     d26:	83 c4 10             	add    $0x10,%esp
+     d29:	eb e4                	jmp    d0f <preempt+0x11f>
+      printf(1, "preempt write error");
+     d2b:	83 ec 08             	sub    $0x8,%esp
+     d2e:	68 39 4e 00 00       	push   $0x4e39
+     d33:	6a 01                	push   $0x1
+     d35:	e8 56 3a 00 00       	call   4790 <printf>
+     d3a:	83 c4 10             	add    $0x10,%esp
+     d3d:	e9 31 ff ff ff       	jmp    c73 <preempt+0x83>
+     d42:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000d50 <exitwait>:
+{
+     d50:	55                   	push   %ebp
+     d51:	89 e5                	mov    %esp,%ebp
+     d53:	56                   	push   %esi
+     d54:	be 64 00 00 00       	mov    $0x64,%esi
+     d59:	53                   	push   %ebx
+     d5a:	eb 14                	jmp    d70 <exitwait+0x20>
+     d5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pid){
+     d60:	74 68                	je     dca <exitwait+0x7a>
+      if(wait() != pid){
+     d62:	e8 65 38 00 00       	call   45cc <wait>
+     d67:	39 d8                	cmp    %ebx,%eax
+     d69:	75 2d                	jne    d98 <exitwait+0x48>
+  for(i = 0; i < 100; i++){
+     d6b:	83 ee 01             	sub    $0x1,%esi
+     d6e:	74 41                	je     db1 <exitwait+0x61>
+    pid = fork();
+     d70:	e8 47 38 00 00       	call   45bc <fork>
+     d75:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+     d77:	85 c0                	test   %eax,%eax
+     d79:	79 e5                	jns    d60 <exitwait+0x10>
+      printf(1, "fork failed\n");
+     d7b:	83 ec 08             	sub    $0x8,%esp
+     d7e:	68 f9 5c 00 00       	push   $0x5cf9
+     d83:	6a 01                	push   $0x1
+     d85:	e8 06 3a 00 00       	call   4790 <printf>
+      return;
+     d8a:	83 c4 10             	add    $0x10,%esp
+}
+     d8d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d90:	5b                   	pop    %ebx
+     d91:	5e                   	pop    %esi
+     d92:	5d                   	pop    %ebp
+     d93:	c3                   	ret
+     d94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "wait wrong pid\n");
+     d98:	83 ec 08             	sub    $0x8,%esp
+     d9b:	68 7e 4e 00 00       	push   $0x4e7e
+     da0:	6a 01                	push   $0x1
+     da2:	e8 e9 39 00 00       	call   4790 <printf>
+        return;
+     da7:	83 c4 10             	add    $0x10,%esp
+}
+     daa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     dad:	5b                   	pop    %ebx
+     dae:	5e                   	pop    %esi
+     daf:	5d                   	pop    %ebp
+     db0:	c3                   	ret
+  printf(1, "exitwait ok\n");
+     db1:	83 ec 08             	sub    $0x8,%esp
+     db4:	68 8e 4e 00 00       	push   $0x4e8e
+     db9:	6a 01                	push   $0x1
+     dbb:	e8 d0 39 00 00       	call   4790 <printf>
+     dc0:	83 c4 10             	add    $0x10,%esp
+}
+     dc3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     dc6:	5b                   	pop    %ebx
+     dc7:	5e                   	pop    %esi
+     dc8:	5d                   	pop    %ebp
+     dc9:	c3                   	ret
+      exit();
+     dca:	e8 f5 37 00 00       	call   45c4 <exit>
+     dcf:	90                   	nop
+
+00000dd0 <mem>:
+{
+     dd0:	55                   	push   %ebp
+     dd1:	89 e5                	mov    %esp,%ebp
+     dd3:	56                   	push   %esi
+     dd4:	31 f6                	xor    %esi,%esi
+     dd6:	53                   	push   %ebx
+  printf(1, "mem test\n");
+     dd7:	83 ec 08             	sub    $0x8,%esp
+     dda:	68 9b 4e 00 00       	push   $0x4e9b
+     ddf:	6a 01                	push   $0x1
+     de1:	e8 aa 39 00 00       	call   4790 <printf>
+  ppid = getpid();
+     de6:	e8 59 38 00 00       	call   4644 <getpid>
+     deb:	89 c3                	mov    %eax,%ebx
+  if((pid = fork()) == 0){
+     ded:	e8 ca 37 00 00       	call   45bc <fork>
+     df2:	83 c4 10             	add    $0x10,%esp
+     df5:	85 c0                	test   %eax,%eax
+     df7:	74 0b                	je     e04 <mem+0x34>
+     df9:	e9 8a 00 00 00       	jmp    e88 <mem+0xb8>
+     dfe:	66 90                	xchg   %ax,%ax
+      *(char**)m2 = m1;
+     e00:	89 30                	mov    %esi,(%eax)
+     e02:	89 c6                	mov    %eax,%esi
+    while((m2 = malloc(10001)) != 0){
+     e04:	83 ec 0c             	sub    $0xc,%esp
+     e07:	68 11 27 00 00       	push   $0x2711
+     e0c:	e8 bf 3b 00 00       	call   49d0 <malloc>
+     e11:	83 c4 10             	add    $0x10,%esp
+     e14:	85 c0                	test   %eax,%eax
+     e16:	75 e8                	jne    e00 <mem+0x30>
+    while(m1){
+     e18:	85 f6                	test   %esi,%esi
+     e1a:	74 18                	je     e34 <mem+0x64>
+     e1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      m2 = *(char**)m1;
+     e20:	89 f0                	mov    %esi,%eax
+      free(m1);
+     e22:	83 ec 0c             	sub    $0xc,%esp
+      m2 = *(char**)m1;
+     e25:	8b 36                	mov    (%esi),%esi
+      free(m1);
+     e27:	50                   	push   %eax
+     e28:	e8 13 3b 00 00       	call   4940 <free>
+    while(m1){
+     e2d:	83 c4 10             	add    $0x10,%esp
+     e30:	85 f6                	test   %esi,%esi
+     e32:	75 ec                	jne    e20 <mem+0x50>
+    m1 = malloc(1024*20);
+     e34:	83 ec 0c             	sub    $0xc,%esp
+     e37:	68 00 50 00 00       	push   $0x5000
+     e3c:	e8 8f 3b 00 00       	call   49d0 <malloc>
+    if(m1 == 0){
+     e41:	83 c4 10             	add    $0x10,%esp
+     e44:	85 c0                	test   %eax,%eax
+     e46:	74 20                	je     e68 <mem+0x98>
+    free(m1);
+     e48:	83 ec 0c             	sub    $0xc,%esp
+     e4b:	50                   	push   %eax
+     e4c:	e8 ef 3a 00 00       	call   4940 <free>
+    printf(1, "mem ok\n");
+     e51:	58                   	pop    %eax
+     e52:	5a                   	pop    %edx
+     e53:	68 bf 4e 00 00       	push   $0x4ebf
+     e58:	6a 01                	push   $0x1
+     e5a:	e8 31 39 00 00       	call   4790 <printf>
+    exit();
+     e5f:	e8 60 37 00 00       	call   45c4 <exit>
+     e64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "couldn't allocate mem?!!\n");
+     e68:	83 ec 08             	sub    $0x8,%esp
+     e6b:	68 a5 4e 00 00       	push   $0x4ea5
+     e70:	6a 01                	push   $0x1
+     e72:	e8 19 39 00 00       	call   4790 <printf>
+      kill(ppid);
+     e77:	89 1c 24             	mov    %ebx,(%esp)
+     e7a:	e8 75 37 00 00       	call   45f4 <kill>
+      exit();
+     e7f:	e8 40 37 00 00       	call   45c4 <exit>
+     e84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+     e88:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e8b:	5b                   	pop    %ebx
+     e8c:	5e                   	pop    %esi
+     e8d:	5d                   	pop    %ebp
+    wait();
+     e8e:	e9 39 37 00 00       	jmp    45cc <wait>
+     e93:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ea0 <sharedfd>:
+{
+     ea0:	55                   	push   %ebp
+     ea1:	89 e5                	mov    %esp,%ebp
+     ea3:	57                   	push   %edi
+     ea4:	56                   	push   %esi
+     ea5:	53                   	push   %ebx
+     ea6:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "sharedfd test\n");
+     ea9:	68 c7 4e 00 00       	push   $0x4ec7
+     eae:	6a 01                	push   $0x1
+     eb0:	e8 db 38 00 00       	call   4790 <printf>
+  unlink("sharedfd");
+     eb5:	c7 04 24 d6 4e 00 00 	movl   $0x4ed6,(%esp)
+     ebc:	e8 53 37 00 00       	call   4614 <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+     ec1:	5b                   	pop    %ebx
+     ec2:	5e                   	pop    %esi
+     ec3:	68 02 02 00 00       	push   $0x202
+     ec8:	68 d6 4e 00 00       	push   $0x4ed6
+     ecd:	e8 32 37 00 00       	call   4604 <open>
+  if(fd < 0){
+     ed2:	83 c4 10             	add    $0x10,%esp
+     ed5:	85 c0                	test   %eax,%eax
+     ed7:	0f 88 2a 01 00 00    	js     1007 <sharedfd+0x167>
+     edd:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     edf:	8d 75 de             	lea    -0x22(%ebp),%esi
+     ee2:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  pid = fork();
+     ee7:	e8 d0 36 00 00       	call   45bc <fork>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     eec:	83 f8 01             	cmp    $0x1,%eax
+  pid = fork();
+     eef:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     ef2:	19 c0                	sbb    %eax,%eax
+     ef4:	83 ec 04             	sub    $0x4,%esp
+     ef7:	83 e0 f3             	and    $0xfffffff3,%eax
+     efa:	6a 0a                	push   $0xa
+     efc:	83 c0 70             	add    $0x70,%eax
+     eff:	50                   	push   %eax
+     f00:	56                   	push   %esi
+     f01:	e8 da 34 00 00       	call   43e0 <memset>
+     f06:	83 c4 10             	add    $0x10,%esp
+     f09:	eb 0a                	jmp    f15 <sharedfd+0x75>
+     f0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f0f:	90                   	nop
+  for(i = 0; i < 1000; i++){
+     f10:	83 eb 01             	sub    $0x1,%ebx
+     f13:	74 26                	je     f3b <sharedfd+0x9b>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+     f15:	83 ec 04             	sub    $0x4,%esp
+     f18:	6a 0a                	push   $0xa
+     f1a:	56                   	push   %esi
+     f1b:	57                   	push   %edi
+     f1c:	e8 c3 36 00 00       	call   45e4 <write>
+     f21:	83 c4 10             	add    $0x10,%esp
+     f24:	83 f8 0a             	cmp    $0xa,%eax
+     f27:	74 e7                	je     f10 <sharedfd+0x70>
+      printf(1, "fstests: write sharedfd failed\n");
+     f29:	83 ec 08             	sub    $0x8,%esp
+     f2c:	68 d4 5e 00 00       	push   $0x5ed4
+     f31:	6a 01                	push   $0x1
+     f33:	e8 58 38 00 00       	call   4790 <printf>
+      break;
+     f38:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0)
+     f3b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     f3e:	85 c9                	test   %ecx,%ecx
+     f40:	0f 84 f5 00 00 00    	je     103b <sharedfd+0x19b>
+    wait();
+     f46:	e8 81 36 00 00       	call   45cc <wait>
+  close(fd);
+     f4b:	83 ec 0c             	sub    $0xc,%esp
+  nc = np = 0;
+     f4e:	31 db                	xor    %ebx,%ebx
+  close(fd);
+     f50:	57                   	push   %edi
+     f51:	8d 7d e8             	lea    -0x18(%ebp),%edi
+     f54:	e8 93 36 00 00       	call   45ec <close>
+  fd = open("sharedfd", 0);
+     f59:	58                   	pop    %eax
+     f5a:	5a                   	pop    %edx
+     f5b:	6a 00                	push   $0x0
+     f5d:	68 d6 4e 00 00       	push   $0x4ed6
+     f62:	e8 9d 36 00 00       	call   4604 <open>
+  if(fd < 0){
+     f67:	83 c4 10             	add    $0x10,%esp
+  nc = np = 0;
+     f6a:	31 d2                	xor    %edx,%edx
+  fd = open("sharedfd", 0);
+     f6c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(fd < 0){
+     f6f:	85 c0                	test   %eax,%eax
+     f71:	0f 88 aa 00 00 00    	js     1021 <sharedfd+0x181>
+     f77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f7e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+     f80:	83 ec 04             	sub    $0x4,%esp
+     f83:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     f86:	6a 0a                	push   $0xa
+     f88:	56                   	push   %esi
+     f89:	ff 75 d0             	push   -0x30(%ebp)
+     f8c:	e8 4b 36 00 00       	call   45dc <read>
+     f91:	83 c4 10             	add    $0x10,%esp
+     f94:	85 c0                	test   %eax,%eax
+     f96:	7e 28                	jle    fc0 <sharedfd+0x120>
+     f98:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     f9b:	89 f0                	mov    %esi,%eax
+     f9d:	eb 13                	jmp    fb2 <sharedfd+0x112>
+     f9f:	90                   	nop
+        np++;
+     fa0:	80 f9 70             	cmp    $0x70,%cl
+     fa3:	0f 94 c1             	sete   %cl
+     fa6:	0f b6 c9             	movzbl %cl,%ecx
+     fa9:	01 cb                	add    %ecx,%ebx
+    for(i = 0; i < sizeof(buf); i++){
+     fab:	83 c0 01             	add    $0x1,%eax
+     fae:	39 f8                	cmp    %edi,%eax
+     fb0:	74 ce                	je     f80 <sharedfd+0xe0>
+      if(buf[i] == 'c')
+     fb2:	0f b6 08             	movzbl (%eax),%ecx
+     fb5:	80 f9 63             	cmp    $0x63,%cl
+     fb8:	75 e6                	jne    fa0 <sharedfd+0x100>
+        nc++;
+     fba:	83 c2 01             	add    $0x1,%edx
+      if(buf[i] == 'p')
+     fbd:	eb ec                	jmp    fab <sharedfd+0x10b>
+     fbf:	90                   	nop
+  close(fd);
+     fc0:	83 ec 0c             	sub    $0xc,%esp
+     fc3:	ff 75 d0             	push   -0x30(%ebp)
+     fc6:	e8 21 36 00 00       	call   45ec <close>
+  unlink("sharedfd");
+     fcb:	c7 04 24 d6 4e 00 00 	movl   $0x4ed6,(%esp)
+     fd2:	e8 3d 36 00 00       	call   4614 <unlink>
+  if(nc == 10000 && np == 10000){
+     fd7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     fda:	83 c4 10             	add    $0x10,%esp
+     fdd:	81 fa 10 27 00 00    	cmp    $0x2710,%edx
+     fe3:	75 5b                	jne    1040 <sharedfd+0x1a0>
+     fe5:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+     feb:	75 53                	jne    1040 <sharedfd+0x1a0>
+    printf(1, "sharedfd ok\n");
+     fed:	83 ec 08             	sub    $0x8,%esp
+     ff0:	68 df 4e 00 00       	push   $0x4edf
+     ff5:	6a 01                	push   $0x1
+     ff7:	e8 94 37 00 00       	call   4790 <printf>
+     ffc:	83 c4 10             	add    $0x10,%esp
+}
+     fff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1002:	5b                   	pop    %ebx
+    1003:	5e                   	pop    %esi
+    1004:	5f                   	pop    %edi
+    1005:	5d                   	pop    %ebp
+    1006:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for writing");
+    1007:	83 ec 08             	sub    $0x8,%esp
+    100a:	68 a8 5e 00 00       	push   $0x5ea8
+    100f:	6a 01                	push   $0x1
+    1011:	e8 7a 37 00 00       	call   4790 <printf>
+    return;
+    1016:	83 c4 10             	add    $0x10,%esp
+}
+    1019:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    101c:	5b                   	pop    %ebx
+    101d:	5e                   	pop    %esi
+    101e:	5f                   	pop    %edi
+    101f:	5d                   	pop    %ebp
+    1020:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    1021:	83 ec 08             	sub    $0x8,%esp
+    1024:	68 f4 5e 00 00       	push   $0x5ef4
+    1029:	6a 01                	push   $0x1
+    102b:	e8 60 37 00 00       	call   4790 <printf>
+    return;
+    1030:	83 c4 10             	add    $0x10,%esp
+}
+    1033:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1036:	5b                   	pop    %ebx
+    1037:	5e                   	pop    %esi
+    1038:	5f                   	pop    %edi
+    1039:	5d                   	pop    %ebp
+    103a:	c3                   	ret
+    exit();
+    103b:	e8 84 35 00 00       	call   45c4 <exit>
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    1040:	53                   	push   %ebx
+    1041:	52                   	push   %edx
+    1042:	68 ec 4e 00 00       	push   $0x4eec
+    1047:	6a 01                	push   $0x1
+    1049:	e8 42 37 00 00       	call   4790 <printf>
+    exit();
+    104e:	e8 71 35 00 00       	call   45c4 <exit>
+    1053:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    105a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001060 <fourfiles>:
+{
+    1060:	55                   	push   %ebp
+    1061:	89 e5                	mov    %esp,%ebp
+    1063:	57                   	push   %edi
+    1064:	56                   	push   %esi
+    1065:	53                   	push   %ebx
+  for(pi = 0; pi < 4; pi++){
+    1066:	31 db                	xor    %ebx,%ebx
+{
+    1068:	83 ec 34             	sub    $0x34,%esp
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    106b:	c7 45 d8 01 4f 00 00 	movl   $0x4f01,-0x28(%ebp)
+    1072:	c7 45 dc 4a 50 00 00 	movl   $0x504a,-0x24(%ebp)
+    1079:	c7 45 e0 4e 50 00 00 	movl   $0x504e,-0x20(%ebp)
+    1080:	c7 45 e4 04 4f 00 00 	movl   $0x4f04,-0x1c(%ebp)
+  printf(1, "fourfiles test\n");
+    1087:	68 07 4f 00 00       	push   $0x4f07
+    108c:	6a 01                	push   $0x1
+    108e:	e8 fd 36 00 00       	call   4790 <printf>
+    1093:	83 c4 10             	add    $0x10,%esp
+    fname = names[pi];
+    1096:	8b 74 9d d8          	mov    -0x28(%ebp,%ebx,4),%esi
+    unlink(fname);
+    109a:	83 ec 0c             	sub    $0xc,%esp
+    109d:	56                   	push   %esi
+    109e:	e8 71 35 00 00       	call   4614 <unlink>
+    pid = fork();
+    10a3:	e8 14 35 00 00       	call   45bc <fork>
+    if(pid < 0){
+    10a8:	83 c4 10             	add    $0x10,%esp
+    10ab:	85 c0                	test   %eax,%eax
+    10ad:	0f 88 65 01 00 00    	js     1218 <fourfiles+0x1b8>
+    if(pid == 0){
+    10b3:	0f 84 eb 00 00 00    	je     11a4 <fourfiles+0x144>
+  for(pi = 0; pi < 4; pi++){
+    10b9:	83 c3 01             	add    $0x1,%ebx
+    10bc:	83 fb 04             	cmp    $0x4,%ebx
+    10bf:	75 d5                	jne    1096 <fourfiles+0x36>
+    wait();
+    10c1:	e8 06 35 00 00       	call   45cc <wait>
+  for(i = 0; i < 2; i++){
+    10c6:	31 f6                	xor    %esi,%esi
+    wait();
+    10c8:	e8 ff 34 00 00       	call   45cc <wait>
+    10cd:	e8 fa 34 00 00       	call   45cc <wait>
+    10d2:	e8 f5 34 00 00       	call   45cc <wait>
+    fname = names[i];
+    10d7:	8b 5c b5 d8          	mov    -0x28(%ebp,%esi,4),%ebx
+    fd = open(fname, 0);
+    10db:	83 ec 08             	sub    $0x8,%esp
+    total = 0;
+    10de:	31 ff                	xor    %edi,%edi
+    fd = open(fname, 0);
+    10e0:	6a 00                	push   $0x0
+    10e2:	53                   	push   %ebx
+    10e3:	e8 1c 35 00 00       	call   4604 <open>
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    10e8:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    10eb:	83 c4 10             	add    $0x10,%esp
+    10ee:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    10f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10f8:	83 ec 04             	sub    $0x4,%esp
+    10fb:	68 00 20 00 00       	push   $0x2000
+    1100:	68 00 99 00 00       	push   $0x9900
+    1105:	ff 75 d4             	push   -0x2c(%ebp)
+    1108:	e8 cf 34 00 00       	call   45dc <read>
+    110d:	83 c4 10             	add    $0x10,%esp
+    1110:	89 c3                	mov    %eax,%ebx
+    1112:	85 c0                	test   %eax,%eax
+    1114:	7e 28                	jle    113e <fourfiles+0xde>
+      for(j = 0; j < n; j++){
+    1116:	31 c0                	xor    %eax,%eax
+    1118:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    111f:	90                   	nop
+        if(buf[j] != '0'+i){
+    1120:	83 fe 01             	cmp    $0x1,%esi
+    1123:	0f be 88 00 99 00 00 	movsbl 0x9900(%eax),%ecx
+    112a:	19 d2                	sbb    %edx,%edx
+    112c:	83 c2 31             	add    $0x31,%edx
+    112f:	39 d1                	cmp    %edx,%ecx
+    1131:	75 5d                	jne    1190 <fourfiles+0x130>
+      for(j = 0; j < n; j++){
+    1133:	83 c0 01             	add    $0x1,%eax
+    1136:	39 c3                	cmp    %eax,%ebx
+    1138:	75 e6                	jne    1120 <fourfiles+0xc0>
+      total += n;
+    113a:	01 df                	add    %ebx,%edi
+    113c:	eb ba                	jmp    10f8 <fourfiles+0x98>
+    close(fd);
+    113e:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    1141:	83 ec 0c             	sub    $0xc,%esp
+    1144:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1147:	51                   	push   %ecx
+    1148:	e8 9f 34 00 00       	call   45ec <close>
+    if(total != 12*500){
+    114d:	83 c4 10             	add    $0x10,%esp
+    1150:	81 ff 70 17 00 00    	cmp    $0x1770,%edi
+    1156:	0f 85 d0 00 00 00    	jne    122c <fourfiles+0x1cc>
+    unlink(fname);
+    115c:	83 ec 0c             	sub    $0xc,%esp
+    115f:	53                   	push   %ebx
+    1160:	e8 af 34 00 00       	call   4614 <unlink>
+  for(i = 0; i < 2; i++){
+    1165:	83 c4 10             	add    $0x10,%esp
+    1168:	85 f6                	test   %esi,%esi
+    116a:	75 0a                	jne    1176 <fourfiles+0x116>
+    116c:	be 01 00 00 00       	mov    $0x1,%esi
+    1171:	e9 61 ff ff ff       	jmp    10d7 <fourfiles+0x77>
+  printf(1, "fourfiles ok\n");
+    1176:	83 ec 08             	sub    $0x8,%esp
+    1179:	68 45 4f 00 00       	push   $0x4f45
+    117e:	6a 01                	push   $0x1
+    1180:	e8 0b 36 00 00       	call   4790 <printf>
+}
+    1185:	83 c4 10             	add    $0x10,%esp
+    1188:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    118b:	5b                   	pop    %ebx
+    118c:	5e                   	pop    %esi
+    118d:	5f                   	pop    %edi
+    118e:	5d                   	pop    %ebp
+    118f:	c3                   	ret
+          printf(1, "wrong char\n");
+    1190:	83 ec 08             	sub    $0x8,%esp
+    1193:	68 28 4f 00 00       	push   $0x4f28
+    1198:	6a 01                	push   $0x1
+    119a:	e8 f1 35 00 00       	call   4790 <printf>
+          exit();
+    119f:	e8 20 34 00 00       	call   45c4 <exit>
+      fd = open(fname, O_CREATE | O_RDWR);
+    11a4:	83 ec 08             	sub    $0x8,%esp
+    11a7:	68 02 02 00 00       	push   $0x202
+    11ac:	56                   	push   %esi
+    11ad:	e8 52 34 00 00       	call   4604 <open>
+      if(fd < 0){
+    11b2:	83 c4 10             	add    $0x10,%esp
+      fd = open(fname, O_CREATE | O_RDWR);
+    11b5:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+    11b7:	85 c0                	test   %eax,%eax
+    11b9:	78 45                	js     1200 <fourfiles+0x1a0>
+      memset(buf, '0'+pi, 512);
+    11bb:	83 ec 04             	sub    $0x4,%esp
+    11be:	83 c3 30             	add    $0x30,%ebx
+    11c1:	68 00 02 00 00       	push   $0x200
+    11c6:	53                   	push   %ebx
+    11c7:	bb 0c 00 00 00       	mov    $0xc,%ebx
+    11cc:	68 00 99 00 00       	push   $0x9900
+    11d1:	e8 0a 32 00 00       	call   43e0 <memset>
+    11d6:	83 c4 10             	add    $0x10,%esp
+        if((n = write(fd, buf, 500)) != 500){
+    11d9:	83 ec 04             	sub    $0x4,%esp
+    11dc:	68 f4 01 00 00       	push   $0x1f4
+    11e1:	68 00 99 00 00       	push   $0x9900
+    11e6:	56                   	push   %esi
+    11e7:	e8 f8 33 00 00       	call   45e4 <write>
+    11ec:	83 c4 10             	add    $0x10,%esp
+    11ef:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    11f4:	75 49                	jne    123f <fourfiles+0x1df>
+      for(i = 0; i < 12; i++){
+    11f6:	83 eb 01             	sub    $0x1,%ebx
+    11f9:	75 de                	jne    11d9 <fourfiles+0x179>
+      exit();
+    11fb:	e8 c4 33 00 00       	call   45c4 <exit>
+        printf(1, "create failed\n");
+    1200:	51                   	push   %ecx
+    1201:	51                   	push   %ecx
+    1202:	68 17 52 00 00       	push   $0x5217
+    1207:	6a 01                	push   $0x1
+    1209:	e8 82 35 00 00       	call   4790 <printf>
+        exit();
+    120e:	e8 b1 33 00 00       	call   45c4 <exit>
+    1213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1217:	90                   	nop
+      printf(1, "fork failed\n");
+    1218:	83 ec 08             	sub    $0x8,%esp
+    121b:	68 f9 5c 00 00       	push   $0x5cf9
+    1220:	6a 01                	push   $0x1
+    1222:	e8 69 35 00 00       	call   4790 <printf>
+      exit();
+    1227:	e8 98 33 00 00       	call   45c4 <exit>
+      printf(1, "wrong length %d\n", total);
+    122c:	50                   	push   %eax
+    122d:	57                   	push   %edi
+    122e:	68 34 4f 00 00       	push   $0x4f34
+    1233:	6a 01                	push   $0x1
+    1235:	e8 56 35 00 00       	call   4790 <printf>
+      exit();
+    123a:	e8 85 33 00 00       	call   45c4 <exit>
+          printf(1, "write failed %d\n", n);
+    123f:	52                   	push   %edx
+    1240:	50                   	push   %eax
+    1241:	68 17 4f 00 00       	push   $0x4f17
+    1246:	6a 01                	push   $0x1
+    1248:	e8 43 35 00 00       	call   4790 <printf>
+          exit();
+    124d:	e8 72 33 00 00       	call   45c4 <exit>
+    1252:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001260 <createdelete>:
+{
+    1260:	55                   	push   %ebp
+    1261:	89 e5                	mov    %esp,%ebp
+    1263:	57                   	push   %edi
+    1264:	56                   	push   %esi
+  for(pi = 0; pi < 4; pi++){
+    1265:	31 f6                	xor    %esi,%esi
+{
+    1267:	53                   	push   %ebx
+    1268:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "createdelete test\n");
+    126b:	68 53 4f 00 00       	push   $0x4f53
+    1270:	6a 01                	push   $0x1
+    1272:	e8 19 35 00 00       	call   4790 <printf>
+    1277:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    127a:	e8 3d 33 00 00       	call   45bc <fork>
+    127f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    1281:	85 c0                	test   %eax,%eax
+    1283:	0f 88 ac 01 00 00    	js     1435 <createdelete+0x1d5>
+    if(pid == 0){
+    1289:	0f 84 01 01 00 00    	je     1390 <createdelete+0x130>
+  for(pi = 0; pi < 4; pi++){
+    128f:	83 c6 01             	add    $0x1,%esi
+    1292:	83 fe 04             	cmp    $0x4,%esi
+    1295:	75 e3                	jne    127a <createdelete+0x1a>
+    wait();
+    1297:	e8 30 33 00 00       	call   45cc <wait>
+  for(i = 0; i < N; i++){
+    129c:	31 ff                	xor    %edi,%edi
+    129e:	8d 75 c8             	lea    -0x38(%ebp),%esi
+    wait();
+    12a1:	e8 26 33 00 00       	call   45cc <wait>
+    12a6:	e8 21 33 00 00       	call   45cc <wait>
+    12ab:	e8 1c 33 00 00       	call   45cc <wait>
+  name[0] = name[1] = name[2] = 0;
+    12b0:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+  for(i = 0; i < N; i++){
+    12b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if((i == 0 || i >= N/2) && fd < 0){
+    12b8:	85 ff                	test   %edi,%edi
+      name[1] = '0' + i;
+    12ba:	8d 47 30             	lea    0x30(%edi),%eax
+      if((i == 0 || i >= N/2) && fd < 0){
+    12bd:	bb 70 00 00 00       	mov    $0x70,%ebx
+    12c2:	0f 94 c2             	sete   %dl
+    12c5:	83 ff 09             	cmp    $0x9,%edi
+      name[1] = '0' + i;
+    12c8:	88 45 c6             	mov    %al,-0x3a(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    12cb:	0f 9f c0             	setg   %al
+    12ce:	09 c2                	or     %eax,%edx
+    12d0:	88 55 c7             	mov    %dl,-0x39(%ebp)
+      name[1] = '0' + i;
+    12d3:	0f b6 45 c6          	movzbl -0x3a(%ebp),%eax
+      fd = open(name, 0);
+    12d7:	83 ec 08             	sub    $0x8,%esp
+      name[0] = 'p' + pi;
+    12da:	88 5d c8             	mov    %bl,-0x38(%ebp)
+      name[1] = '0' + i;
+    12dd:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    12e0:	6a 00                	push   $0x0
+    12e2:	56                   	push   %esi
+    12e3:	e8 1c 33 00 00       	call   4604 <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    12e8:	83 c4 10             	add    $0x10,%esp
+    12eb:	80 7d c7 00          	cmpb   $0x0,-0x39(%ebp)
+    12ef:	74 7f                	je     1370 <createdelete+0x110>
+    12f1:	85 c0                	test   %eax,%eax
+    12f3:	0f 88 27 01 00 00    	js     1420 <createdelete+0x1c0>
+        close(fd);
+    12f9:	83 ec 0c             	sub    $0xc,%esp
+    12fc:	50                   	push   %eax
+    12fd:	e8 ea 32 00 00       	call   45ec <close>
+    1302:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    1305:	83 c3 01             	add    $0x1,%ebx
+    1308:	80 fb 74             	cmp    $0x74,%bl
+    130b:	75 c6                	jne    12d3 <createdelete+0x73>
+  for(i = 0; i < N; i++){
+    130d:	83 c7 01             	add    $0x1,%edi
+    1310:	83 ff 14             	cmp    $0x14,%edi
+    1313:	75 a3                	jne    12b8 <createdelete+0x58>
+    1315:	bf 70 00 00 00       	mov    $0x70,%edi
+    131a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[1] = '0' + i;
+    1320:	8d 47 c0             	lea    -0x40(%edi),%eax
+    1323:	bb 04 00 00 00       	mov    $0x4,%ebx
+    1328:	88 45 c7             	mov    %al,-0x39(%ebp)
+      name[0] = 'p' + i;
+    132b:	89 f8                	mov    %edi,%eax
+      unlink(name);
+    132d:	83 ec 0c             	sub    $0xc,%esp
+      name[0] = 'p' + i;
+    1330:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    1333:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+    1337:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    133a:	56                   	push   %esi
+    133b:	e8 d4 32 00 00       	call   4614 <unlink>
+    for(pi = 0; pi < 4; pi++){
+    1340:	83 c4 10             	add    $0x10,%esp
+    1343:	83 eb 01             	sub    $0x1,%ebx
+    1346:	75 e3                	jne    132b <createdelete+0xcb>
+  for(i = 0; i < N; i++){
+    1348:	83 c7 01             	add    $0x1,%edi
+    134b:	89 f8                	mov    %edi,%eax
+    134d:	3c 84                	cmp    $0x84,%al
+    134f:	75 cf                	jne    1320 <createdelete+0xc0>
+  printf(1, "createdelete ok\n");
+    1351:	83 ec 08             	sub    $0x8,%esp
+    1354:	68 66 4f 00 00       	push   $0x4f66
+    1359:	6a 01                	push   $0x1
+    135b:	e8 30 34 00 00       	call   4790 <printf>
+}
+    1360:	83 c4 10             	add    $0x10,%esp
+    1363:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1366:	5b                   	pop    %ebx
+    1367:	5e                   	pop    %esi
+    1368:	5f                   	pop    %edi
+    1369:	5d                   	pop    %ebp
+    136a:	c3                   	ret
+    136b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    136f:	90                   	nop
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    1370:	85 c0                	test   %eax,%eax
+    1372:	78 91                	js     1305 <createdelete+0xa5>
+        printf(1, "oops createdelete %s did exist\n", name);
+    1374:	50                   	push   %eax
+    1375:	56                   	push   %esi
+    1376:	68 44 5f 00 00       	push   $0x5f44
+    137b:	6a 01                	push   $0x1
+    137d:	e8 0e 34 00 00       	call   4790 <printf>
+        exit();
+    1382:	e8 3d 32 00 00       	call   45c4 <exit>
+    1387:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    138e:	66 90                	xchg   %ax,%ax
+      name[0] = 'p' + pi;
+    1390:	8d 46 70             	lea    0x70(%esi),%eax
+      name[2] = '\0';
+    1393:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    1397:	8d 75 c8             	lea    -0x38(%ebp),%esi
+      name[0] = 'p' + pi;
+    139a:	88 45 c8             	mov    %al,-0x38(%ebp)
+      for(i = 0; i < N; i++){
+    139d:	8d 76 00             	lea    0x0(%esi),%esi
+        fd = open(name, O_CREATE | O_RDWR);
+    13a0:	83 ec 08             	sub    $0x8,%esp
+        name[1] = '0' + i;
+    13a3:	8d 43 30             	lea    0x30(%ebx),%eax
+    13a6:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    13a9:	68 02 02 00 00       	push   $0x202
+    13ae:	56                   	push   %esi
+    13af:	e8 50 32 00 00       	call   4604 <open>
+        if(fd < 0){
+    13b4:	83 c4 10             	add    $0x10,%esp
+    13b7:	85 c0                	test   %eax,%eax
+    13b9:	0f 88 8a 00 00 00    	js     1449 <createdelete+0x1e9>
+        close(fd);
+    13bf:	83 ec 0c             	sub    $0xc,%esp
+    13c2:	50                   	push   %eax
+    13c3:	e8 24 32 00 00       	call   45ec <close>
+        if(i > 0 && (i % 2 ) == 0){
+    13c8:	83 c4 10             	add    $0x10,%esp
+    13cb:	85 db                	test   %ebx,%ebx
+    13cd:	74 19                	je     13e8 <createdelete+0x188>
+    13cf:	f6 c3 01             	test   $0x1,%bl
+    13d2:	74 1b                	je     13ef <createdelete+0x18f>
+      for(i = 0; i < N; i++){
+    13d4:	83 c3 01             	add    $0x1,%ebx
+    13d7:	83 fb 14             	cmp    $0x14,%ebx
+    13da:	75 c4                	jne    13a0 <createdelete+0x140>
+      exit();
+    13dc:	e8 e3 31 00 00       	call   45c4 <exit>
+    13e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      for(i = 0; i < N; i++){
+    13e8:	bb 01 00 00 00       	mov    $0x1,%ebx
+    13ed:	eb b1                	jmp    13a0 <createdelete+0x140>
+          name[1] = '0' + (i / 2);
+    13ef:	89 d8                	mov    %ebx,%eax
+          if(unlink(name) < 0){
+    13f1:	83 ec 0c             	sub    $0xc,%esp
+          name[1] = '0' + (i / 2);
+    13f4:	d1 f8                	sar    %eax
+    13f6:	83 c0 30             	add    $0x30,%eax
+    13f9:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    13fc:	56                   	push   %esi
+    13fd:	e8 12 32 00 00       	call   4614 <unlink>
+    1402:	83 c4 10             	add    $0x10,%esp
+    1405:	85 c0                	test   %eax,%eax
+    1407:	79 cb                	jns    13d4 <createdelete+0x174>
+            printf(1, "unlink failed\n");
+    1409:	52                   	push   %edx
+    140a:	52                   	push   %edx
+    140b:	68 45 52 00 00       	push   $0x5245
+    1410:	6a 01                	push   $0x1
+    1412:	e8 79 33 00 00       	call   4790 <printf>
+            exit();
+    1417:	e8 a8 31 00 00       	call   45c4 <exit>
+    141c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    1420:	83 ec 04             	sub    $0x4,%esp
+    1423:	56                   	push   %esi
+    1424:	68 20 5f 00 00       	push   $0x5f20
+    1429:	6a 01                	push   $0x1
+    142b:	e8 60 33 00 00       	call   4790 <printf>
+        exit();
+    1430:	e8 8f 31 00 00       	call   45c4 <exit>
+      printf(1, "fork failed\n");
+    1435:	83 ec 08             	sub    $0x8,%esp
+    1438:	68 f9 5c 00 00       	push   $0x5cf9
+    143d:	6a 01                	push   $0x1
+    143f:	e8 4c 33 00 00       	call   4790 <printf>
+      exit();
+    1444:	e8 7b 31 00 00       	call   45c4 <exit>
+          printf(1, "create failed\n");
+    1449:	83 ec 08             	sub    $0x8,%esp
+    144c:	68 17 52 00 00       	push   $0x5217
+    1451:	6a 01                	push   $0x1
+    1453:	e8 38 33 00 00       	call   4790 <printf>
+          exit();
+    1458:	e8 67 31 00 00       	call   45c4 <exit>
+    145d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001460 <unlinkread>:
+{
+    1460:	55                   	push   %ebp
+    1461:	89 e5                	mov    %esp,%ebp
+    1463:	56                   	push   %esi
+    1464:	53                   	push   %ebx
+  printf(1, "unlinkread test\n");
+    1465:	83 ec 08             	sub    $0x8,%esp
+    1468:	68 77 4f 00 00       	push   $0x4f77
+    146d:	6a 01                	push   $0x1
+    146f:	e8 1c 33 00 00       	call   4790 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    1474:	5b                   	pop    %ebx
+    1475:	5e                   	pop    %esi
+    1476:	68 02 02 00 00       	push   $0x202
+    147b:	68 88 4f 00 00       	push   $0x4f88
+    1480:	e8 7f 31 00 00       	call   4604 <open>
+  if(fd < 0){
+    1485:	83 c4 10             	add    $0x10,%esp
+    1488:	85 c0                	test   %eax,%eax
+    148a:	0f 88 e6 00 00 00    	js     1576 <unlinkread+0x116>
+  write(fd, "hello", 5);
+    1490:	83 ec 04             	sub    $0x4,%esp
+    1493:	89 c3                	mov    %eax,%ebx
+    1495:	6a 05                	push   $0x5
+    1497:	68 ad 4f 00 00       	push   $0x4fad
+    149c:	50                   	push   %eax
+    149d:	e8 42 31 00 00       	call   45e4 <write>
+  close(fd);
+    14a2:	89 1c 24             	mov    %ebx,(%esp)
+    14a5:	e8 42 31 00 00       	call   45ec <close>
+  fd = open("unlinkread", O_RDWR);
+    14aa:	58                   	pop    %eax
+    14ab:	5a                   	pop    %edx
+    14ac:	6a 02                	push   $0x2
+    14ae:	68 88 4f 00 00       	push   $0x4f88
+    14b3:	e8 4c 31 00 00       	call   4604 <open>
+  if(fd < 0){
+    14b8:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_RDWR);
+    14bb:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    14bd:	85 c0                	test   %eax,%eax
+    14bf:	0f 88 10 01 00 00    	js     15d5 <unlinkread+0x175>
+  if(unlink("unlinkread") != 0){
+    14c5:	83 ec 0c             	sub    $0xc,%esp
+    14c8:	68 88 4f 00 00       	push   $0x4f88
+    14cd:	e8 42 31 00 00       	call   4614 <unlink>
+    14d2:	83 c4 10             	add    $0x10,%esp
+    14d5:	85 c0                	test   %eax,%eax
+    14d7:	0f 85 e5 00 00 00    	jne    15c2 <unlinkread+0x162>
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    14dd:	83 ec 08             	sub    $0x8,%esp
+    14e0:	68 02 02 00 00       	push   $0x202
+    14e5:	68 88 4f 00 00       	push   $0x4f88
+    14ea:	e8 15 31 00 00       	call   4604 <open>
+  write(fd1, "yyy", 3);
+    14ef:	83 c4 0c             	add    $0xc,%esp
+    14f2:	6a 03                	push   $0x3
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    14f4:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    14f6:	68 e5 4f 00 00       	push   $0x4fe5
+    14fb:	50                   	push   %eax
+    14fc:	e8 e3 30 00 00       	call   45e4 <write>
+  close(fd1);
+    1501:	89 34 24             	mov    %esi,(%esp)
+    1504:	e8 e3 30 00 00       	call   45ec <close>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    1509:	83 c4 0c             	add    $0xc,%esp
+    150c:	68 00 20 00 00       	push   $0x2000
+    1511:	68 00 99 00 00       	push   $0x9900
+    1516:	53                   	push   %ebx
+    1517:	e8 c0 30 00 00       	call   45dc <read>
+    151c:	83 c4 10             	add    $0x10,%esp
+    151f:	83 f8 05             	cmp    $0x5,%eax
+    1522:	0f 85 87 00 00 00    	jne    15af <unlinkread+0x14f>
+  if(buf[0] != 'h'){
+    1528:	80 3d 00 99 00 00 68 	cmpb   $0x68,0x9900
+    152f:	75 6b                	jne    159c <unlinkread+0x13c>
+  if(write(fd, buf, 10) != 10){
+    1531:	83 ec 04             	sub    $0x4,%esp
+    1534:	6a 0a                	push   $0xa
+    1536:	68 00 99 00 00       	push   $0x9900
+    153b:	53                   	push   %ebx
+    153c:	e8 a3 30 00 00       	call   45e4 <write>
+    1541:	83 c4 10             	add    $0x10,%esp
+    1544:	83 f8 0a             	cmp    $0xa,%eax
+    1547:	75 40                	jne    1589 <unlinkread+0x129>
+  close(fd);
+    1549:	83 ec 0c             	sub    $0xc,%esp
+    154c:	53                   	push   %ebx
+    154d:	e8 9a 30 00 00       	call   45ec <close>
+  unlink("unlinkread");
+    1552:	c7 04 24 88 4f 00 00 	movl   $0x4f88,(%esp)
+    1559:	e8 b6 30 00 00       	call   4614 <unlink>
+  printf(1, "unlinkread ok\n");
+    155e:	58                   	pop    %eax
+    155f:	5a                   	pop    %edx
+    1560:	68 30 50 00 00       	push   $0x5030
+    1565:	6a 01                	push   $0x1
+    1567:	e8 24 32 00 00       	call   4790 <printf>
+}
+    156c:	83 c4 10             	add    $0x10,%esp
+    156f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1572:	5b                   	pop    %ebx
+    1573:	5e                   	pop    %esi
+    1574:	5d                   	pop    %ebp
+    1575:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    1576:	51                   	push   %ecx
+    1577:	51                   	push   %ecx
+    1578:	68 93 4f 00 00       	push   $0x4f93
+    157d:	6a 01                	push   $0x1
+    157f:	e8 0c 32 00 00       	call   4790 <printf>
+    exit();
+    1584:	e8 3b 30 00 00       	call   45c4 <exit>
+    printf(1, "unlinkread write failed\n");
+    1589:	51                   	push   %ecx
+    158a:	51                   	push   %ecx
+    158b:	68 17 50 00 00       	push   $0x5017
+    1590:	6a 01                	push   $0x1
+    1592:	e8 f9 31 00 00       	call   4790 <printf>
+    exit();
+    1597:	e8 28 30 00 00       	call   45c4 <exit>
+    printf(1, "unlinkread wrong data\n");
+    159c:	53                   	push   %ebx
+    159d:	53                   	push   %ebx
+    159e:	68 00 50 00 00       	push   $0x5000
+    15a3:	6a 01                	push   $0x1
+    15a5:	e8 e6 31 00 00       	call   4790 <printf>
+    exit();
+    15aa:	e8 15 30 00 00       	call   45c4 <exit>
+    printf(1, "unlinkread read failed");
+    15af:	56                   	push   %esi
+    15b0:	56                   	push   %esi
+    15b1:	68 e9 4f 00 00       	push   $0x4fe9
+    15b6:	6a 01                	push   $0x1
+    15b8:	e8 d3 31 00 00       	call   4790 <printf>
+    exit();
+    15bd:	e8 02 30 00 00       	call   45c4 <exit>
+    printf(1, "unlink unlinkread failed\n");
+    15c2:	50                   	push   %eax
+    15c3:	50                   	push   %eax
+    15c4:	68 cb 4f 00 00       	push   $0x4fcb
+    15c9:	6a 01                	push   $0x1
+    15cb:	e8 c0 31 00 00       	call   4790 <printf>
+    exit();
+    15d0:	e8 ef 2f 00 00       	call   45c4 <exit>
+    printf(1, "open unlinkread failed\n");
+    15d5:	50                   	push   %eax
+    15d6:	50                   	push   %eax
+    15d7:	68 b3 4f 00 00       	push   $0x4fb3
+    15dc:	6a 01                	push   $0x1
+    15de:	e8 ad 31 00 00       	call   4790 <printf>
+    exit();
+    15e3:	e8 dc 2f 00 00       	call   45c4 <exit>
+    15e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15ef:	90                   	nop
+
+000015f0 <linktest>:
+{
+    15f0:	55                   	push   %ebp
+    15f1:	89 e5                	mov    %esp,%ebp
+    15f3:	53                   	push   %ebx
+    15f4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "linktest\n");
+    15f7:	68 3f 50 00 00       	push   $0x503f
+    15fc:	6a 01                	push   $0x1
+    15fe:	e8 8d 31 00 00       	call   4790 <printf>
+  unlink("lf1");
+    1603:	c7 04 24 49 50 00 00 	movl   $0x5049,(%esp)
+    160a:	e8 05 30 00 00       	call   4614 <unlink>
+  unlink("lf2");
+    160f:	c7 04 24 4d 50 00 00 	movl   $0x504d,(%esp)
+    1616:	e8 f9 2f 00 00       	call   4614 <unlink>
+  fd = open("lf1", O_CREATE|O_RDWR);
+    161b:	58                   	pop    %eax
+    161c:	5a                   	pop    %edx
+    161d:	68 02 02 00 00       	push   $0x202
+    1622:	68 49 50 00 00       	push   $0x5049
+    1627:	e8 d8 2f 00 00       	call   4604 <open>
+  if(fd < 0){
+    162c:	83 c4 10             	add    $0x10,%esp
+    162f:	85 c0                	test   %eax,%eax
+    1631:	0f 88 1e 01 00 00    	js     1755 <linktest+0x165>
+  if(write(fd, "hello", 5) != 5){
+    1637:	83 ec 04             	sub    $0x4,%esp
+    163a:	89 c3                	mov    %eax,%ebx
+    163c:	6a 05                	push   $0x5
+    163e:	68 ad 4f 00 00       	push   $0x4fad
+    1643:	50                   	push   %eax
+    1644:	e8 9b 2f 00 00       	call   45e4 <write>
+    1649:	83 c4 10             	add    $0x10,%esp
+    164c:	83 f8 05             	cmp    $0x5,%eax
+    164f:	0f 85 98 01 00 00    	jne    17ed <linktest+0x1fd>
+  close(fd);
+    1655:	83 ec 0c             	sub    $0xc,%esp
+    1658:	53                   	push   %ebx
+    1659:	e8 8e 2f 00 00       	call   45ec <close>
+  if(link("lf1", "lf2") < 0){
+    165e:	5b                   	pop    %ebx
+    165f:	58                   	pop    %eax
+    1660:	68 4d 50 00 00       	push   $0x504d
+    1665:	68 49 50 00 00       	push   $0x5049
+    166a:	e8 b5 2f 00 00       	call   4624 <link>
+    166f:	83 c4 10             	add    $0x10,%esp
+    1672:	85 c0                	test   %eax,%eax
+    1674:	0f 88 60 01 00 00    	js     17da <linktest+0x1ea>
+  unlink("lf1");
+    167a:	83 ec 0c             	sub    $0xc,%esp
+    167d:	68 49 50 00 00       	push   $0x5049
+    1682:	e8 8d 2f 00 00       	call   4614 <unlink>
+  if(open("lf1", 0) >= 0){
+    1687:	58                   	pop    %eax
+    1688:	5a                   	pop    %edx
+    1689:	6a 00                	push   $0x0
+    168b:	68 49 50 00 00       	push   $0x5049
+    1690:	e8 6f 2f 00 00       	call   4604 <open>
+    1695:	83 c4 10             	add    $0x10,%esp
+    1698:	85 c0                	test   %eax,%eax
+    169a:	0f 89 27 01 00 00    	jns    17c7 <linktest+0x1d7>
+  fd = open("lf2", 0);
+    16a0:	83 ec 08             	sub    $0x8,%esp
+    16a3:	6a 00                	push   $0x0
+    16a5:	68 4d 50 00 00       	push   $0x504d
+    16aa:	e8 55 2f 00 00       	call   4604 <open>
+  if(fd < 0){
+    16af:	83 c4 10             	add    $0x10,%esp
+  fd = open("lf2", 0);
+    16b2:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    16b4:	85 c0                	test   %eax,%eax
+    16b6:	0f 88 f8 00 00 00    	js     17b4 <linktest+0x1c4>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    16bc:	83 ec 04             	sub    $0x4,%esp
+    16bf:	68 00 20 00 00       	push   $0x2000
+    16c4:	68 00 99 00 00       	push   $0x9900
+    16c9:	50                   	push   %eax
+    16ca:	e8 0d 2f 00 00       	call   45dc <read>
+    16cf:	83 c4 10             	add    $0x10,%esp
+    16d2:	83 f8 05             	cmp    $0x5,%eax
+    16d5:	0f 85 c6 00 00 00    	jne    17a1 <linktest+0x1b1>
+  close(fd);
+    16db:	83 ec 0c             	sub    $0xc,%esp
+    16de:	53                   	push   %ebx
+    16df:	e8 08 2f 00 00       	call   45ec <close>
+  if(link("lf2", "lf2") >= 0){
+    16e4:	58                   	pop    %eax
+    16e5:	5a                   	pop    %edx
+    16e6:	68 4d 50 00 00       	push   $0x504d
+    16eb:	68 4d 50 00 00       	push   $0x504d
+    16f0:	e8 2f 2f 00 00       	call   4624 <link>
+    16f5:	83 c4 10             	add    $0x10,%esp
+    16f8:	85 c0                	test   %eax,%eax
+    16fa:	0f 89 8e 00 00 00    	jns    178e <linktest+0x19e>
+  unlink("lf2");
+    1700:	83 ec 0c             	sub    $0xc,%esp
+    1703:	68 4d 50 00 00       	push   $0x504d
+    1708:	e8 07 2f 00 00       	call   4614 <unlink>
+  if(link("lf2", "lf1") >= 0){
+    170d:	59                   	pop    %ecx
+    170e:	5b                   	pop    %ebx
+    170f:	68 49 50 00 00       	push   $0x5049
+    1714:	68 4d 50 00 00       	push   $0x504d
+    1719:	e8 06 2f 00 00       	call   4624 <link>
+    171e:	83 c4 10             	add    $0x10,%esp
+    1721:	85 c0                	test   %eax,%eax
+    1723:	79 56                	jns    177b <linktest+0x18b>
+  if(link(".", "lf1") >= 0){
+    1725:	83 ec 08             	sub    $0x8,%esp
+    1728:	68 49 50 00 00       	push   $0x5049
+    172d:	68 a6 53 00 00       	push   $0x53a6
+    1732:	e8 ed 2e 00 00       	call   4624 <link>
+    1737:	83 c4 10             	add    $0x10,%esp
+    173a:	85 c0                	test   %eax,%eax
+    173c:	79 2a                	jns    1768 <linktest+0x178>
+  printf(1, "linktest ok\n");
+    173e:	83 ec 08             	sub    $0x8,%esp
+    1741:	68 e7 50 00 00       	push   $0x50e7
+    1746:	6a 01                	push   $0x1
+    1748:	e8 43 30 00 00       	call   4790 <printf>
+}
+    174d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1750:	83 c4 10             	add    $0x10,%esp
+    1753:	c9                   	leave
+    1754:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    1755:	50                   	push   %eax
+    1756:	50                   	push   %eax
+    1757:	68 51 50 00 00       	push   $0x5051
+    175c:	6a 01                	push   $0x1
+    175e:	e8 2d 30 00 00       	call   4790 <printf>
+    exit();
+    1763:	e8 5c 2e 00 00       	call   45c4 <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    1768:	50                   	push   %eax
+    1769:	50                   	push   %eax
+    176a:	68 cb 50 00 00       	push   $0x50cb
+    176f:	6a 01                	push   $0x1
+    1771:	e8 1a 30 00 00       	call   4790 <printf>
+    exit();
+    1776:	e8 49 2e 00 00       	call   45c4 <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    177b:	52                   	push   %edx
+    177c:	52                   	push   %edx
+    177d:	68 8c 5f 00 00       	push   $0x5f8c
+    1782:	6a 01                	push   $0x1
+    1784:	e8 07 30 00 00       	call   4790 <printf>
+    exit();
+    1789:	e8 36 2e 00 00       	call   45c4 <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    178e:	50                   	push   %eax
+    178f:	50                   	push   %eax
+    1790:	68 ad 50 00 00       	push   $0x50ad
+    1795:	6a 01                	push   $0x1
+    1797:	e8 f4 2f 00 00       	call   4790 <printf>
+    exit();
+    179c:	e8 23 2e 00 00       	call   45c4 <exit>
+    printf(1, "read lf2 failed\n");
+    17a1:	51                   	push   %ecx
+    17a2:	51                   	push   %ecx
+    17a3:	68 9c 50 00 00       	push   $0x509c
+    17a8:	6a 01                	push   $0x1
+    17aa:	e8 e1 2f 00 00       	call   4790 <printf>
+    exit();
+    17af:	e8 10 2e 00 00       	call   45c4 <exit>
+    printf(1, "open lf2 failed\n");
+    17b4:	53                   	push   %ebx
+    17b5:	53                   	push   %ebx
+    17b6:	68 8b 50 00 00       	push   $0x508b
+    17bb:	6a 01                	push   $0x1
+    17bd:	e8 ce 2f 00 00       	call   4790 <printf>
+    exit();
+    17c2:	e8 fd 2d 00 00       	call   45c4 <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    17c7:	50                   	push   %eax
+    17c8:	50                   	push   %eax
+    17c9:	68 64 5f 00 00       	push   $0x5f64
+    17ce:	6a 01                	push   $0x1
+    17d0:	e8 bb 2f 00 00       	call   4790 <printf>
+    exit();
+    17d5:	e8 ea 2d 00 00       	call   45c4 <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    17da:	51                   	push   %ecx
+    17db:	51                   	push   %ecx
+    17dc:	68 76 50 00 00       	push   $0x5076
+    17e1:	6a 01                	push   $0x1
+    17e3:	e8 a8 2f 00 00       	call   4790 <printf>
+    exit();
+    17e8:	e8 d7 2d 00 00       	call   45c4 <exit>
+    printf(1, "write lf1 failed\n");
+    17ed:	50                   	push   %eax
+    17ee:	50                   	push   %eax
+    17ef:	68 64 50 00 00       	push   $0x5064
+    17f4:	6a 01                	push   $0x1
+    17f6:	e8 95 2f 00 00       	call   4790 <printf>
+    exit();
+    17fb:	e8 c4 2d 00 00       	call   45c4 <exit>
+
+00001800 <concreate>:
+{
+    1800:	55                   	push   %ebp
+    1801:	89 e5                	mov    %esp,%ebp
+    1803:	57                   	push   %edi
+    1804:	56                   	push   %esi
+  for(i = 0; i < 40; i++){
+    1805:	31 f6                	xor    %esi,%esi
+{
+    1807:	53                   	push   %ebx
+    1808:	8d 5d ad             	lea    -0x53(%ebp),%ebx
+    180b:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "concreate test\n");
+    180e:	68 f4 50 00 00       	push   $0x50f4
+    1813:	6a 01                	push   $0x1
+    1815:	e8 76 2f 00 00       	call   4790 <printf>
+  file[0] = 'C';
+    181a:	c6 45 ad 43          	movb   $0x43,-0x53(%ebp)
+  file[2] = '\0';
+    181e:	83 c4 10             	add    $0x10,%esp
+    1821:	c6 45 af 00          	movb   $0x0,-0x51(%ebp)
+  for(i = 0; i < 40; i++){
+    1825:	eb 4c                	jmp    1873 <concreate+0x73>
+    1827:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    182e:	66 90                	xchg   %ax,%ax
+    1830:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+    if(pid && (i % 3) == 1){
+    1836:	3d ab aa aa aa       	cmp    $0xaaaaaaab,%eax
+    183b:	0f 83 8f 00 00 00    	jae    18d0 <concreate+0xd0>
+      fd = open(file, O_CREATE | O_RDWR);
+    1841:	83 ec 08             	sub    $0x8,%esp
+    1844:	68 02 02 00 00       	push   $0x202
+    1849:	53                   	push   %ebx
+    184a:	e8 b5 2d 00 00       	call   4604 <open>
+      if(fd < 0){
+    184f:	83 c4 10             	add    $0x10,%esp
+    1852:	85 c0                	test   %eax,%eax
+    1854:	78 63                	js     18b9 <concreate+0xb9>
+      close(fd);
+    1856:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 40; i++){
+    1859:	83 c6 01             	add    $0x1,%esi
+      close(fd);
+    185c:	50                   	push   %eax
+    185d:	e8 8a 2d 00 00       	call   45ec <close>
+    1862:	83 c4 10             	add    $0x10,%esp
+      wait();
+    1865:	e8 62 2d 00 00       	call   45cc <wait>
+  for(i = 0; i < 40; i++){
+    186a:	83 fe 28             	cmp    $0x28,%esi
+    186d:	0f 84 7f 00 00 00    	je     18f2 <concreate+0xf2>
+    unlink(file);
+    1873:	83 ec 0c             	sub    $0xc,%esp
+    file[1] = '0' + i;
+    1876:	8d 46 30             	lea    0x30(%esi),%eax
+    1879:	88 45 ae             	mov    %al,-0x52(%ebp)
+    unlink(file);
+    187c:	53                   	push   %ebx
+    187d:	e8 92 2d 00 00       	call   4614 <unlink>
+    pid = fork();
+    1882:	e8 35 2d 00 00       	call   45bc <fork>
+    if(pid && (i % 3) == 1){
+    1887:	83 c4 10             	add    $0x10,%esp
+    188a:	85 c0                	test   %eax,%eax
+    188c:	75 a2                	jne    1830 <concreate+0x30>
+      link("C0", file);
+    188e:	69 f6 cd cc cc cc    	imul   $0xcccccccd,%esi,%esi
+    } else if(pid == 0 && (i % 5) == 1){
+    1894:	81 fe cd cc cc cc    	cmp    $0xcccccccd,%esi
+    189a:	0f 83 d0 00 00 00    	jae    1970 <concreate+0x170>
+      fd = open(file, O_CREATE | O_RDWR);
+    18a0:	83 ec 08             	sub    $0x8,%esp
+    18a3:	68 02 02 00 00       	push   $0x202
+    18a8:	53                   	push   %ebx
+    18a9:	e8 56 2d 00 00       	call   4604 <open>
+      if(fd < 0){
+    18ae:	83 c4 10             	add    $0x10,%esp
+    18b1:	85 c0                	test   %eax,%eax
+    18b3:	0f 89 ea 01 00 00    	jns    1aa3 <concreate+0x2a3>
+        printf(1, "concreate create %s failed\n", file);
+    18b9:	83 ec 04             	sub    $0x4,%esp
+    18bc:	53                   	push   %ebx
+    18bd:	68 07 51 00 00       	push   $0x5107
+    18c2:	6a 01                	push   $0x1
+    18c4:	e8 c7 2e 00 00       	call   4790 <printf>
+        exit();
+    18c9:	e8 f6 2c 00 00       	call   45c4 <exit>
+    18ce:	66 90                	xchg   %ax,%ax
+      link("C0", file);
+    18d0:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < 40; i++){
+    18d3:	83 c6 01             	add    $0x1,%esi
+      link("C0", file);
+    18d6:	53                   	push   %ebx
+    18d7:	68 04 51 00 00       	push   $0x5104
+    18dc:	e8 43 2d 00 00       	call   4624 <link>
+    18e1:	83 c4 10             	add    $0x10,%esp
+      wait();
+    18e4:	e8 e3 2c 00 00       	call   45cc <wait>
+  for(i = 0; i < 40; i++){
+    18e9:	83 fe 28             	cmp    $0x28,%esi
+    18ec:	0f 85 81 ff ff ff    	jne    1873 <concreate+0x73>
+  memset(fa, 0, sizeof(fa));
+    18f2:	83 ec 04             	sub    $0x4,%esp
+    18f5:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    18f8:	6a 28                	push   $0x28
+    18fa:	6a 00                	push   $0x0
+    18fc:	50                   	push   %eax
+    18fd:	e8 de 2a 00 00       	call   43e0 <memset>
+  fd = open(".", 0);
+    1902:	5e                   	pop    %esi
+    1903:	5f                   	pop    %edi
+    1904:	6a 00                	push   $0x0
+    1906:	68 a6 53 00 00       	push   $0x53a6
+    190b:	8d 7d b0             	lea    -0x50(%ebp),%edi
+    190e:	e8 f1 2c 00 00       	call   4604 <open>
+  n = 0;
+    1913:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    191a:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    191d:	89 c6                	mov    %eax,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    191f:	90                   	nop
+    1920:	83 ec 04             	sub    $0x4,%esp
+    1923:	6a 10                	push   $0x10
+    1925:	57                   	push   %edi
+    1926:	56                   	push   %esi
+    1927:	e8 b0 2c 00 00       	call   45dc <read>
+    192c:	83 c4 10             	add    $0x10,%esp
+    192f:	85 c0                	test   %eax,%eax
+    1931:	7e 5d                	jle    1990 <concreate+0x190>
+    if(de.inum == 0)
+    1933:	66 83 7d b0 00       	cmpw   $0x0,-0x50(%ebp)
+    1938:	74 e6                	je     1920 <concreate+0x120>
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    193a:	80 7d b2 43          	cmpb   $0x43,-0x4e(%ebp)
+    193e:	75 e0                	jne    1920 <concreate+0x120>
+    1940:	80 7d b4 00          	cmpb   $0x0,-0x4c(%ebp)
+    1944:	75 da                	jne    1920 <concreate+0x120>
+      i = de.name[1] - '0';
+    1946:	0f be 45 b3          	movsbl -0x4d(%ebp),%eax
+    194a:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    194d:	83 f8 27             	cmp    $0x27,%eax
+    1950:	0f 87 5e 01 00 00    	ja     1ab4 <concreate+0x2b4>
+      if(fa[i]){
+    1956:	80 7c 05 c0 00       	cmpb   $0x0,-0x40(%ebp,%eax,1)
+    195b:	0f 85 7e 01 00 00    	jne    1adf <concreate+0x2df>
+      n++;
+    1961:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+      fa[i] = 1;
+    1965:	c6 44 05 c0 01       	movb   $0x1,-0x40(%ebp,%eax,1)
+      n++;
+    196a:	eb b4                	jmp    1920 <concreate+0x120>
+    196c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      link("C0", file);
+    1970:	83 ec 08             	sub    $0x8,%esp
+    1973:	53                   	push   %ebx
+    1974:	68 04 51 00 00       	push   $0x5104
+    1979:	e8 a6 2c 00 00       	call   4624 <link>
+    197e:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1981:	e8 3e 2c 00 00       	call   45c4 <exit>
+    1986:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    198d:	8d 76 00             	lea    0x0(%esi),%esi
+  close(fd);
+    1990:	83 ec 0c             	sub    $0xc,%esp
+    1993:	56                   	push   %esi
+    1994:	e8 53 2c 00 00       	call   45ec <close>
+  if(n != 40){
+    1999:	83 c4 10             	add    $0x10,%esp
+    199c:	83 7d a4 28          	cmpl   $0x28,-0x5c(%ebp)
+    19a0:	0f 85 26 01 00 00    	jne    1acc <concreate+0x2cc>
+  for(i = 0; i < 40; i++){
+    19a6:	31 f6                	xor    %esi,%esi
+    19a8:	eb 48                	jmp    19f2 <concreate+0x1f2>
+    19aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+       ((i % 3) == 1 && pid != 0)){
+    19b0:	85 ff                	test   %edi,%edi
+    19b2:	74 05                	je     19b9 <concreate+0x1b9>
+    19b4:	83 f8 01             	cmp    $0x1,%eax
+    19b7:	74 68                	je     1a21 <concreate+0x221>
+      unlink(file);
+    19b9:	83 ec 0c             	sub    $0xc,%esp
+    19bc:	53                   	push   %ebx
+    19bd:	e8 52 2c 00 00       	call   4614 <unlink>
+      unlink(file);
+    19c2:	89 1c 24             	mov    %ebx,(%esp)
+    19c5:	e8 4a 2c 00 00       	call   4614 <unlink>
+      unlink(file);
+    19ca:	89 1c 24             	mov    %ebx,(%esp)
+    19cd:	e8 42 2c 00 00       	call   4614 <unlink>
+      unlink(file);
+    19d2:	89 1c 24             	mov    %ebx,(%esp)
+    19d5:	e8 3a 2c 00 00       	call   4614 <unlink>
+    19da:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+    19dd:	85 ff                	test   %edi,%edi
+    19df:	74 a0                	je     1981 <concreate+0x181>
+      wait();
+    19e1:	e8 e6 2b 00 00       	call   45cc <wait>
+  for(i = 0; i < 40; i++){
+    19e6:	83 c6 01             	add    $0x1,%esi
+    19e9:	83 fe 28             	cmp    $0x28,%esi
+    19ec:	0f 84 86 00 00 00    	je     1a78 <concreate+0x278>
+    file[1] = '0' + i;
+    19f2:	8d 46 30             	lea    0x30(%esi),%eax
+    19f5:	88 45 ae             	mov    %al,-0x52(%ebp)
+    pid = fork();
+    19f8:	e8 bf 2b 00 00       	call   45bc <fork>
+    19fd:	89 c7                	mov    %eax,%edi
+    if(pid < 0){
+    19ff:	85 c0                	test   %eax,%eax
+    1a01:	0f 88 88 00 00 00    	js     1a8f <concreate+0x28f>
+    if(((i % 3) == 0 && pid == 0) ||
+    1a07:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    1a0c:	f7 e6                	mul    %esi
+    1a0e:	89 d0                	mov    %edx,%eax
+    1a10:	83 e2 fe             	and    $0xfffffffe,%edx
+    1a13:	d1 e8                	shr    %eax
+    1a15:	01 c2                	add    %eax,%edx
+    1a17:	89 f0                	mov    %esi,%eax
+    1a19:	29 d0                	sub    %edx,%eax
+    1a1b:	89 c1                	mov    %eax,%ecx
+    1a1d:	09 f9                	or     %edi,%ecx
+    1a1f:	75 8f                	jne    19b0 <concreate+0x1b0>
+      close(open(file, 0));
+    1a21:	83 ec 08             	sub    $0x8,%esp
+    1a24:	6a 00                	push   $0x0
+    1a26:	53                   	push   %ebx
+    1a27:	e8 d8 2b 00 00       	call   4604 <open>
+    1a2c:	89 04 24             	mov    %eax,(%esp)
+    1a2f:	e8 b8 2b 00 00       	call   45ec <close>
+      close(open(file, 0));
+    1a34:	58                   	pop    %eax
+    1a35:	5a                   	pop    %edx
+    1a36:	6a 00                	push   $0x0
+    1a38:	53                   	push   %ebx
+    1a39:	e8 c6 2b 00 00       	call   4604 <open>
+    1a3e:	89 04 24             	mov    %eax,(%esp)
+    1a41:	e8 a6 2b 00 00       	call   45ec <close>
+      close(open(file, 0));
+    1a46:	59                   	pop    %ecx
+    1a47:	58                   	pop    %eax
+    1a48:	6a 00                	push   $0x0
+    1a4a:	53                   	push   %ebx
+    1a4b:	e8 b4 2b 00 00       	call   4604 <open>
+    1a50:	89 04 24             	mov    %eax,(%esp)
+    1a53:	e8 94 2b 00 00       	call   45ec <close>
+      close(open(file, 0));
+    1a58:	58                   	pop    %eax
+    1a59:	5a                   	pop    %edx
+    1a5a:	6a 00                	push   $0x0
+    1a5c:	53                   	push   %ebx
+    1a5d:	e8 a2 2b 00 00       	call   4604 <open>
+    1a62:	89 04 24             	mov    %eax,(%esp)
+    1a65:	e8 82 2b 00 00       	call   45ec <close>
+    1a6a:	83 c4 10             	add    $0x10,%esp
+    1a6d:	e9 6b ff ff ff       	jmp    19dd <concreate+0x1dd>
+    1a72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  printf(1, "concreate ok\n");
+    1a78:	83 ec 08             	sub    $0x8,%esp
+    1a7b:	68 59 51 00 00       	push   $0x5159
+    1a80:	6a 01                	push   $0x1
+    1a82:	e8 09 2d 00 00       	call   4790 <printf>
+}
+    1a87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a8a:	5b                   	pop    %ebx
+    1a8b:	5e                   	pop    %esi
+    1a8c:	5f                   	pop    %edi
+    1a8d:	5d                   	pop    %ebp
+    1a8e:	c3                   	ret
+      printf(1, "fork failed\n");
+    1a8f:	83 ec 08             	sub    $0x8,%esp
+    1a92:	68 f9 5c 00 00       	push   $0x5cf9
+    1a97:	6a 01                	push   $0x1
+    1a99:	e8 f2 2c 00 00       	call   4790 <printf>
+      exit();
+    1a9e:	e8 21 2b 00 00       	call   45c4 <exit>
+      close(fd);
+    1aa3:	83 ec 0c             	sub    $0xc,%esp
+    1aa6:	50                   	push   %eax
+    1aa7:	e8 40 2b 00 00       	call   45ec <close>
+    1aac:	83 c4 10             	add    $0x10,%esp
+    1aaf:	e9 cd fe ff ff       	jmp    1981 <concreate+0x181>
+        printf(1, "concreate weird file %s\n", de.name);
+    1ab4:	83 ec 04             	sub    $0x4,%esp
+    1ab7:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1aba:	50                   	push   %eax
+    1abb:	68 23 51 00 00       	push   $0x5123
+    1ac0:	6a 01                	push   $0x1
+    1ac2:	e8 c9 2c 00 00       	call   4790 <printf>
+        exit();
+    1ac7:	e8 f8 2a 00 00       	call   45c4 <exit>
+    printf(1, "concreate not enough files in directory listing\n");
+    1acc:	51                   	push   %ecx
+    1acd:	51                   	push   %ecx
+    1ace:	68 b0 5f 00 00       	push   $0x5fb0
+    1ad3:	6a 01                	push   $0x1
+    1ad5:	e8 b6 2c 00 00       	call   4790 <printf>
+    exit();
+    1ada:	e8 e5 2a 00 00       	call   45c4 <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    1adf:	83 ec 04             	sub    $0x4,%esp
+    1ae2:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1ae5:	50                   	push   %eax
+    1ae6:	68 3c 51 00 00       	push   $0x513c
+    1aeb:	6a 01                	push   $0x1
+    1aed:	e8 9e 2c 00 00       	call   4790 <printf>
+        exit();
+    1af2:	e8 cd 2a 00 00       	call   45c4 <exit>
+    1af7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1afe:	66 90                	xchg   %ax,%ax
+
+00001b00 <linkunlink>:
+{
+    1b00:	55                   	push   %ebp
+    1b01:	89 e5                	mov    %esp,%ebp
+    1b03:	57                   	push   %edi
+    1b04:	56                   	push   %esi
+    1b05:	53                   	push   %ebx
+    1b06:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "linkunlink test\n");
+    1b09:	68 67 51 00 00       	push   $0x5167
+    1b0e:	6a 01                	push   $0x1
+    1b10:	e8 7b 2c 00 00       	call   4790 <printf>
+  unlink("x");
+    1b15:	c7 04 24 89 54 00 00 	movl   $0x5489,(%esp)
+    1b1c:	e8 f3 2a 00 00       	call   4614 <unlink>
+  pid = fork();
+    1b21:	e8 96 2a 00 00       	call   45bc <fork>
+  if(pid < 0){
+    1b26:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    1b29:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    1b2c:	85 c0                	test   %eax,%eax
+    1b2e:	0f 88 b6 00 00 00    	js     1bea <linkunlink+0xea>
+  unsigned int x = (pid ? 1 : 97);
+    1b34:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    1b38:	bb 64 00 00 00       	mov    $0x64,%ebx
+    if((x % 3) == 0){
+    1b3d:	be ab aa aa aa       	mov    $0xaaaaaaab,%esi
+  unsigned int x = (pid ? 1 : 97);
+    1b42:	19 ff                	sbb    %edi,%edi
+    1b44:	83 e7 60             	and    $0x60,%edi
+    1b47:	83 c7 01             	add    $0x1,%edi
+    1b4a:	eb 1e                	jmp    1b6a <linkunlink+0x6a>
+    1b4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    } else if((x % 3) == 1){
+    1b50:	83 f8 01             	cmp    $0x1,%eax
+    1b53:	74 7b                	je     1bd0 <linkunlink+0xd0>
+      unlink("x");
+    1b55:	83 ec 0c             	sub    $0xc,%esp
+    1b58:	68 89 54 00 00       	push   $0x5489
+    1b5d:	e8 b2 2a 00 00       	call   4614 <unlink>
+    1b62:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1b65:	83 eb 01             	sub    $0x1,%ebx
+    1b68:	74 41                	je     1bab <linkunlink+0xab>
+    x = x * 1103515245 + 12345;
+    1b6a:	69 cf 6d 4e c6 41    	imul   $0x41c64e6d,%edi,%ecx
+    1b70:	8d b9 39 30 00 00    	lea    0x3039(%ecx),%edi
+    if((x % 3) == 0){
+    1b76:	89 f8                	mov    %edi,%eax
+    1b78:	f7 e6                	mul    %esi
+    1b7a:	89 d0                	mov    %edx,%eax
+    1b7c:	83 e2 fe             	and    $0xfffffffe,%edx
+    1b7f:	d1 e8                	shr    %eax
+    1b81:	01 c2                	add    %eax,%edx
+    1b83:	89 f8                	mov    %edi,%eax
+    1b85:	29 d0                	sub    %edx,%eax
+    1b87:	75 c7                	jne    1b50 <linkunlink+0x50>
+      close(open("x", O_RDWR | O_CREATE));
+    1b89:	83 ec 08             	sub    $0x8,%esp
+    1b8c:	68 02 02 00 00       	push   $0x202
+    1b91:	68 89 54 00 00       	push   $0x5489
+    1b96:	e8 69 2a 00 00       	call   4604 <open>
+    1b9b:	89 04 24             	mov    %eax,(%esp)
+    1b9e:	e8 49 2a 00 00       	call   45ec <close>
+    1ba3:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1ba6:	83 eb 01             	sub    $0x1,%ebx
+    1ba9:	75 bf                	jne    1b6a <linkunlink+0x6a>
+  if(pid)
+    1bab:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1bae:	85 c0                	test   %eax,%eax
+    1bb0:	74 4b                	je     1bfd <linkunlink+0xfd>
+    wait();
+    1bb2:	e8 15 2a 00 00       	call   45cc <wait>
+  printf(1, "linkunlink ok\n");
+    1bb7:	83 ec 08             	sub    $0x8,%esp
+    1bba:	68 7c 51 00 00       	push   $0x517c
+    1bbf:	6a 01                	push   $0x1
+    1bc1:	e8 ca 2b 00 00       	call   4790 <printf>
+}
+    1bc6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1bc9:	5b                   	pop    %ebx
+    1bca:	5e                   	pop    %esi
+    1bcb:	5f                   	pop    %edi
+    1bcc:	5d                   	pop    %ebp
+    1bcd:	c3                   	ret
+    1bce:	66 90                	xchg   %ax,%ax
+      link("cat", "x");
+    1bd0:	83 ec 08             	sub    $0x8,%esp
+    1bd3:	68 89 54 00 00       	push   $0x5489
+    1bd8:	68 78 51 00 00       	push   $0x5178
+    1bdd:	e8 42 2a 00 00       	call   4624 <link>
+    1be2:	83 c4 10             	add    $0x10,%esp
+    1be5:	e9 7b ff ff ff       	jmp    1b65 <linkunlink+0x65>
+    printf(1, "fork failed\n");
+    1bea:	52                   	push   %edx
+    1beb:	52                   	push   %edx
+    1bec:	68 f9 5c 00 00       	push   $0x5cf9
+    1bf1:	6a 01                	push   $0x1
+    1bf3:	e8 98 2b 00 00       	call   4790 <printf>
+    exit();
+    1bf8:	e8 c7 29 00 00       	call   45c4 <exit>
+    exit();
+    1bfd:	e8 c2 29 00 00       	call   45c4 <exit>
+    1c02:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001c10 <bigdir>:
+{
+    1c10:	55                   	push   %ebp
+    1c11:	89 e5                	mov    %esp,%ebp
+    1c13:	57                   	push   %edi
+    1c14:	56                   	push   %esi
+    1c15:	53                   	push   %ebx
+    1c16:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "bigdir test\n");
+    1c19:	68 8b 51 00 00       	push   $0x518b
+    1c1e:	6a 01                	push   $0x1
+    1c20:	e8 6b 2b 00 00       	call   4790 <printf>
+  unlink("bd");
+    1c25:	c7 04 24 98 51 00 00 	movl   $0x5198,(%esp)
+    1c2c:	e8 e3 29 00 00       	call   4614 <unlink>
+  fd = open("bd", O_CREATE);
+    1c31:	5a                   	pop    %edx
+    1c32:	59                   	pop    %ecx
+    1c33:	68 00 02 00 00       	push   $0x200
+    1c38:	68 98 51 00 00       	push   $0x5198
+    1c3d:	e8 c2 29 00 00       	call   4604 <open>
+  if(fd < 0){
+    1c42:	83 c4 10             	add    $0x10,%esp
+    1c45:	85 c0                	test   %eax,%eax
+    1c47:	0f 88 de 00 00 00    	js     1d2b <bigdir+0x11b>
+  close(fd);
+    1c4d:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 500; i++){
+    1c50:	31 f6                	xor    %esi,%esi
+    1c52:	8d 7d de             	lea    -0x22(%ebp),%edi
+  close(fd);
+    1c55:	50                   	push   %eax
+    1c56:	e8 91 29 00 00       	call   45ec <close>
+    1c5b:	83 c4 10             	add    $0x10,%esp
+    1c5e:	66 90                	xchg   %ax,%ax
+    name[1] = '0' + (i / 64);
+    1c60:	89 f0                	mov    %esi,%eax
+    if(link("bd", name) != 0){
+    1c62:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'x';
+    1c65:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1c69:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1c6c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1c70:	83 c0 30             	add    $0x30,%eax
+    1c73:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1c76:	89 f0                	mov    %esi,%eax
+    1c78:	83 e0 3f             	and    $0x3f,%eax
+    1c7b:	83 c0 30             	add    $0x30,%eax
+    1c7e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(link("bd", name) != 0){
+    1c81:	57                   	push   %edi
+    1c82:	68 98 51 00 00       	push   $0x5198
+    1c87:	e8 98 29 00 00       	call   4624 <link>
+    1c8c:	83 c4 10             	add    $0x10,%esp
+    1c8f:	89 c3                	mov    %eax,%ebx
+    1c91:	85 c0                	test   %eax,%eax
+    1c93:	75 6e                	jne    1d03 <bigdir+0xf3>
+  for(i = 0; i < 500; i++){
+    1c95:	83 c6 01             	add    $0x1,%esi
+    1c98:	81 fe f4 01 00 00    	cmp    $0x1f4,%esi
+    1c9e:	75 c0                	jne    1c60 <bigdir+0x50>
+  unlink("bd");
+    1ca0:	83 ec 0c             	sub    $0xc,%esp
+    1ca3:	68 98 51 00 00       	push   $0x5198
+    1ca8:	e8 67 29 00 00       	call   4614 <unlink>
+    1cad:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + (i / 64);
+    1cb0:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    1cb2:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'x';
+    1cb5:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1cb9:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1cbc:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1cc0:	83 c0 30             	add    $0x30,%eax
+    1cc3:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1cc6:	89 d8                	mov    %ebx,%eax
+    1cc8:	83 e0 3f             	and    $0x3f,%eax
+    1ccb:	83 c0 30             	add    $0x30,%eax
+    1cce:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(unlink(name) != 0){
+    1cd1:	57                   	push   %edi
+    1cd2:	e8 3d 29 00 00       	call   4614 <unlink>
+    1cd7:	83 c4 10             	add    $0x10,%esp
+    1cda:	85 c0                	test   %eax,%eax
+    1cdc:	75 39                	jne    1d17 <bigdir+0x107>
+  for(i = 0; i < 500; i++){
+    1cde:	83 c3 01             	add    $0x1,%ebx
+    1ce1:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    1ce7:	75 c7                	jne    1cb0 <bigdir+0xa0>
+  printf(1, "bigdir ok\n");
+    1ce9:	83 ec 08             	sub    $0x8,%esp
+    1cec:	68 da 51 00 00       	push   $0x51da
+    1cf1:	6a 01                	push   $0x1
+    1cf3:	e8 98 2a 00 00       	call   4790 <printf>
+    1cf8:	83 c4 10             	add    $0x10,%esp
+}
+    1cfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1cfe:	5b                   	pop    %ebx
+    1cff:	5e                   	pop    %esi
+    1d00:	5f                   	pop    %edi
+    1d01:	5d                   	pop    %ebp
+    1d02:	c3                   	ret
+      printf(1, "bigdir link failed\n");
+    1d03:	83 ec 08             	sub    $0x8,%esp
+    1d06:	68 b1 51 00 00       	push   $0x51b1
+    1d0b:	6a 01                	push   $0x1
+    1d0d:	e8 7e 2a 00 00       	call   4790 <printf>
+      exit();
+    1d12:	e8 ad 28 00 00       	call   45c4 <exit>
+      printf(1, "bigdir unlink failed");
+    1d17:	83 ec 08             	sub    $0x8,%esp
+    1d1a:	68 c5 51 00 00       	push   $0x51c5
+    1d1f:	6a 01                	push   $0x1
+    1d21:	e8 6a 2a 00 00       	call   4790 <printf>
+      exit();
+    1d26:	e8 99 28 00 00       	call   45c4 <exit>
+    printf(1, "bigdir create failed\n");
+    1d2b:	50                   	push   %eax
+    1d2c:	50                   	push   %eax
+    1d2d:	68 9b 51 00 00       	push   $0x519b
+    1d32:	6a 01                	push   $0x1
+    1d34:	e8 57 2a 00 00       	call   4790 <printf>
+    exit();
+    1d39:	e8 86 28 00 00       	call   45c4 <exit>
+    1d3e:	66 90                	xchg   %ax,%ax
+
+00001d40 <dirchurn>:
+{
+    1d40:	55                   	push   %ebp
+    1d41:	89 e5                	mov    %esp,%ebp
+    1d43:	57                   	push   %edi
+    1d44:	56                   	push   %esi
+    1d45:	53                   	push   %ebx
+    1d46:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "dirchurn test\n");
+    1d49:	68 e5 51 00 00       	push   $0x51e5
+    1d4e:	6a 01                	push   $0x1
+    1d50:	e8 3b 2a 00 00       	call   4790 <printf>
+  if(mkdir("dc") != 0 || chdir("dc") != 0){
+    1d55:	c7 04 24 f4 51 00 00 	movl   $0x51f4,(%esp)
+    1d5c:	e8 cb 28 00 00       	call   462c <mkdir>
+    1d61:	83 c4 10             	add    $0x10,%esp
+    1d64:	85 c0                	test   %eax,%eax
+    1d66:	0f 85 ef 01 00 00    	jne    1f5b <dirchurn+0x21b>
+    1d6c:	83 ec 0c             	sub    $0xc,%esp
+    1d6f:	68 f4 51 00 00       	push   $0x51f4
+    1d74:	e8 bb 28 00 00       	call   4634 <chdir>
+    1d79:	83 c4 10             	add    $0x10,%esp
+    1d7c:	85 c0                	test   %eax,%eax
+    1d7e:	0f 85 d7 01 00 00    	jne    1f5b <dirchurn+0x21b>
+  name[0] = 'c';
+    1d84:	c6 45 e4 63          	movb   $0x63,-0x1c(%ebp)
+  for(round = 0; round < 6; round++){
+    1d88:	31 ff                	xor    %edi,%edi
+    1d8a:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  name[3] = '\0';
+    1d8d:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+    for(i = 0; i < 300; i++){
+    1d91:	31 db                	xor    %ebx,%ebx
+    1d93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1d97:	90                   	nop
+      name[1] = '0' + (i / 64);
+    1d98:	89 d8                	mov    %ebx,%eax
+    1d9a:	c1 f8 06             	sar    $0x6,%eax
+    1d9d:	83 c0 30             	add    $0x30,%eax
+    1da0:	88 45 e5             	mov    %al,-0x1b(%ebp)
+      name[2] = '0' + (i % 64);
+    1da3:	89 d8                	mov    %ebx,%eax
+    1da5:	83 e0 3f             	and    $0x3f,%eax
+    1da8:	83 c0 30             	add    $0x30,%eax
+    1dab:	88 45 e6             	mov    %al,-0x1a(%ebp)
+      if(round > 0 && i % 2 == 1)
+    1dae:	85 ff                	test   %edi,%edi
+    1db0:	74 05                	je     1db7 <dirchurn+0x77>
+    1db2:	f6 c3 01             	test   $0x1,%bl
+    1db5:	75 25                	jne    1ddc <dirchurn+0x9c>
+      if((fd = open(name, O_CREATE)) < 0){
+    1db7:	83 ec 08             	sub    $0x8,%esp
+    1dba:	68 00 02 00 00       	push   $0x200
+    1dbf:	56                   	push   %esi
+    1dc0:	e8 3f 28 00 00       	call   4604 <open>
+    1dc5:	83 c4 10             	add    $0x10,%esp
+    1dc8:	85 c0                	test   %eax,%eax
+    1dca:	0f 88 77 01 00 00    	js     1f47 <dirchurn+0x207>
+      close(fd);
+    1dd0:	83 ec 0c             	sub    $0xc,%esp
+    1dd3:	50                   	push   %eax
+    1dd4:	e8 13 28 00 00       	call   45ec <close>
+    1dd9:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < 300; i++){
+    1ddc:	83 c3 01             	add    $0x1,%ebx
+    1ddf:	81 fb 2c 01 00 00    	cmp    $0x12c,%ebx
+    1de5:	75 b1                	jne    1d98 <dirchurn+0x58>
+    for(i = 0; i < 300; i++){
+    1de7:	31 db                	xor    %ebx,%ebx
+    1de9:	eb 10                	jmp    1dfb <dirchurn+0xbb>
+    1deb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1def:	90                   	nop
+    1df0:	83 c3 01             	add    $0x1,%ebx
+    1df3:	81 fb 2c 01 00 00    	cmp    $0x12c,%ebx
+    1df9:	74 65                	je     1e60 <dirchurn+0x120>
+      name[1] = '0' + (i / 64);
+    1dfb:	89 d8                	mov    %ebx,%eax
+      fd = open(name, 0);
+    1dfd:	83 ec 08             	sub    $0x8,%esp
+      name[1] = '0' + (i / 64);
+    1e00:	c1 f8 06             	sar    $0x6,%eax
+    1e03:	83 c0 30             	add    $0x30,%eax
+    1e06:	88 45 e5             	mov    %al,-0x1b(%ebp)
+      name[2] = '0' + (i % 64);
+    1e09:	89 d8                	mov    %ebx,%eax
+    1e0b:	83 e0 3f             	and    $0x3f,%eax
+    1e0e:	83 c0 30             	add    $0x30,%eax
+    1e11:	88 45 e6             	mov    %al,-0x1a(%ebp)
+      fd = open(name, 0);
+    1e14:	6a 00                	push   $0x0
+    1e16:	56                   	push   %esi
+    1e17:	e8 e8 27 00 00       	call   4604 <open>
+      if(fd < 0){
+    1e1c:	83 c4 10             	add    $0x10,%esp
+    1e1f:	85 c0                	test   %eax,%eax
+    1e21:	0f 88 f8 00 00 00    	js     1f1f <dirchurn+0x1df>
+      close(fd);
+    1e27:	83 ec 0c             	sub    $0xc,%esp
+    1e2a:	50                   	push   %eax
+    1e2b:	e8 bc 27 00 00       	call   45ec <close>
+      if(i % 2 == 0 && unlink(name) != 0){
+    1e30:	83 c4 10             	add    $0x10,%esp
+    1e33:	f6 c3 01             	test   $0x1,%bl
+    1e36:	75 b8                	jne    1df0 <dirchurn+0xb0>
+    1e38:	83 ec 0c             	sub    $0xc,%esp
+    1e3b:	56                   	push   %esi
+    1e3c:	e8 d3 27 00 00       	call   4614 <unlink>
+    1e41:	83 c4 10             	add    $0x10,%esp
+    1e44:	85 c0                	test   %eax,%eax
+    1e46:	74 a8                	je     1df0 <dirchurn+0xb0>
+        printf(1, "dirchurn unlink failed\n");
+    1e48:	83 ec 08             	sub    $0x8,%esp
+    1e4b:	68 3c 52 00 00       	push   $0x523c
+    1e50:	6a 01                	push   $0x1
+    1e52:	e8 39 29 00 00       	call   4790 <printf>
+        exit();
+    1e57:	e8 68 27 00 00       	call   45c4 <exit>
+    1e5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    for(i = 0; i < 300; i += 2){
+    1e60:	31 db                	xor    %ebx,%ebx
+    1e62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[1] = '0' + (i / 64);
+    1e68:	89 d8                	mov    %ebx,%eax
+      if(open(name, 0) >= 0){
+    1e6a:	83 ec 08             	sub    $0x8,%esp
+      name[1] = '0' + (i / 64);
+    1e6d:	c1 f8 06             	sar    $0x6,%eax
+    1e70:	83 c0 30             	add    $0x30,%eax
+    1e73:	88 45 e5             	mov    %al,-0x1b(%ebp)
+      name[2] = '0' + (i % 64);
+    1e76:	89 d8                	mov    %ebx,%eax
+    1e78:	83 e0 3f             	and    $0x3f,%eax
+    1e7b:	83 c0 30             	add    $0x30,%eax
+    1e7e:	88 45 e6             	mov    %al,-0x1a(%ebp)
+      if(open(name, 0) >= 0){
+    1e81:	6a 00                	push   $0x0
+    1e83:	56                   	push   %esi
+    1e84:	e8 7b 27 00 00       	call   4604 <open>
+    1e89:	83 c4 10             	add    $0x10,%esp
+    1e8c:	85 c0                	test   %eax,%eax
+    1e8e:	0f 89 9f 00 00 00    	jns    1f33 <dirchurn+0x1f3>
+    for(i = 0; i < 300; i += 2){
+    1e94:	83 c3 02             	add    $0x2,%ebx
+    1e97:	81 fb 2c 01 00 00    	cmp    $0x12c,%ebx
+    1e9d:	75 c9                	jne    1e68 <dirchurn+0x128>
+  for(round = 0; round < 6; round++){
+    1e9f:	83 c7 01             	add    $0x1,%edi
+    1ea2:	83 ff 06             	cmp    $0x6,%edi
+    1ea5:	0f 85 e6 fe ff ff    	jne    1d91 <dirchurn+0x51>
+  for(i = 1; i < 300; i += 2){
+    1eab:	bb 01 00 00 00       	mov    $0x1,%ebx
+    name[1] = '0' + (i / 64);
+    1eb0:	89 d8                	mov    %ebx,%eax
+    unlink(name);
+    1eb2:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + (i / 64);
+    1eb5:	c1 f8 06             	sar    $0x6,%eax
+    1eb8:	83 c0 30             	add    $0x30,%eax
+    1ebb:	88 45 e5             	mov    %al,-0x1b(%ebp)
+    name[2] = '0' + (i % 64);
+    1ebe:	89 d8                	mov    %ebx,%eax
+  for(i = 1; i < 300; i += 2){
+    1ec0:	83 c3 02             	add    $0x2,%ebx
+    name[2] = '0' + (i % 64);
+    1ec3:	83 e0 3f             	and    $0x3f,%eax
+    1ec6:	83 c0 30             	add    $0x30,%eax
+    1ec9:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    unlink(name);
+    1ecc:	56                   	push   %esi
+    1ecd:	e8 42 27 00 00       	call   4614 <unlink>
+  for(i = 1; i < 300; i += 2){
+    1ed2:	83 c4 10             	add    $0x10,%esp
+    1ed5:	81 fb 2d 01 00 00    	cmp    $0x12d,%ebx
+    1edb:	75 d3                	jne    1eb0 <dirchurn+0x170>
+  if(chdir("..") != 0 || unlink("dc") != 0){
+    1edd:	83 ec 0c             	sub    $0xc,%esp
+    1ee0:	68 a5 53 00 00       	push   $0x53a5
+    1ee5:	e8 4a 27 00 00       	call   4634 <chdir>
+    1eea:	83 c4 10             	add    $0x10,%esp
+    1eed:	85 c0                	test   %eax,%eax
+    1eef:	75 7d                	jne    1f6e <dirchurn+0x22e>
+    1ef1:	83 ec 0c             	sub    $0xc,%esp
+    1ef4:	68 f4 51 00 00       	push   $0x51f4
+    1ef9:	e8 16 27 00 00       	call   4614 <unlink>
+    1efe:	83 c4 10             	add    $0x10,%esp
+    1f01:	85 c0                	test   %eax,%eax
+    1f03:	75 69                	jne    1f6e <dirchurn+0x22e>
+  printf(1, "dirchurn ok\n");
+    1f05:	83 ec 08             	sub    $0x8,%esp
+    1f08:	68 6d 52 00 00       	push   $0x526d
+    1f0d:	6a 01                	push   $0x1
+    1f0f:	e8 7c 28 00 00       	call   4790 <printf>
+}
+    1f14:	83 c4 10             	add    $0x10,%esp
+    1f17:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1f1a:	5b                   	pop    %ebx
+    1f1b:	5e                   	pop    %esi
+    1f1c:	5f                   	pop    %edi
+    1f1d:	5d                   	pop    %ebp
+    1f1e:	c3                   	ret
+        printf(1, "dirchurn open failed\n");
+    1f1f:	83 ec 08             	sub    $0x8,%esp
+    1f22:	68 26 52 00 00       	push   $0x5226
+    1f27:	6a 01                	push   $0x1
+    1f29:	e8 62 28 00 00       	call   4790 <printf>
+        exit();
+    1f2e:	e8 91 26 00 00       	call   45c4 <exit>
+        printf(1, "dirchurn unlinked file still there\n");
+    1f33:	83 ec 08             	sub    $0x8,%esp
+    1f36:	68 e4 5f 00 00       	push   $0x5fe4
+    1f3b:	6a 01                	push   $0x1
+    1f3d:	e8 4e 28 00 00       	call   4790 <printf>
+        exit();
+    1f42:	e8 7d 26 00 00       	call   45c4 <exit>
+        printf(1, "dirchurn create failed\n");
+    1f47:	83 ec 08             	sub    $0x8,%esp
+    1f4a:	68 0e 52 00 00       	push   $0x520e
+    1f4f:	6a 01                	push   $0x1
+    1f51:	e8 3a 28 00 00       	call   4790 <printf>
+        exit();
+    1f56:	e8 69 26 00 00       	call   45c4 <exit>
+    printf(1, "dirchurn mkdir failed\n");
+    1f5b:	52                   	push   %edx
+    1f5c:	52                   	push   %edx
+    1f5d:	68 f7 51 00 00       	push   $0x51f7
+    1f62:	6a 01                	push   $0x1
+    1f64:	e8 27 28 00 00       	call   4790 <printf>
+    exit();
+    1f69:	e8 56 26 00 00       	call   45c4 <exit>
+    printf(1, "dirchurn cleanup failed\n");
+    1f6e:	50                   	push   %eax
+    1f6f:	50                   	push   %eax
+    1f70:	68 54 52 00 00       	push   $0x5254
+    1f75:	6a 01                	push   $0x1
+    1f77:	e8 14 28 00 00       	call   4790 <printf>
+    exit();
+    1f7c:	e8 43 26 00 00       	call   45c4 <exit>
+    1f81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f8f:	90                   	nop
+
+00001f90 <subdir>:
+{
+    1f90:	55                   	push   %ebp
+    1f91:	89 e5                	mov    %esp,%ebp
+    1f93:	53                   	push   %ebx
+    1f94:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "subdir test\n");
+    1f97:	68 7a 52 00 00       	push   $0x527a
+    1f9c:	6a 01                	push   $0x1
+    1f9e:	e8 ed 27 00 00       	call   4790 <printf>
+  unlink("ff");
+    1fa3:	c7 04 24 03 53 00 00 	movl   $0x5303,(%esp)
+    1faa:	e8 65 26 00 00       	call   4614 <unlink>
+  if(mkdir("dd") != 0){
+    1faf:	c7 04 24 a0 53 00 00 	movl   $0x53a0,(%esp)
+    1fb6:	e8 71 26 00 00       	call   462c <mkdir>
+    1fbb:	83 c4 10             	add    $0x10,%esp
+    1fbe:	85 c0                	test   %eax,%eax
+    1fc0:	0f 85 b3 05 00 00    	jne    2579 <subdir+0x5e9>
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    1fc6:	83 ec 08             	sub    $0x8,%esp
+    1fc9:	68 02 02 00 00       	push   $0x202
+    1fce:	68 d9 52 00 00       	push   $0x52d9
+    1fd3:	e8 2c 26 00 00       	call   4604 <open>
+  if(fd < 0){
+    1fd8:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    1fdb:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1fdd:	85 c0                	test   %eax,%eax
+    1fdf:	0f 88 81 05 00 00    	js     2566 <subdir+0x5d6>
+  write(fd, "ff", 2);
+    1fe5:	83 ec 04             	sub    $0x4,%esp
+    1fe8:	6a 02                	push   $0x2
+    1fea:	68 03 53 00 00       	push   $0x5303
+    1fef:	50                   	push   %eax
+    1ff0:	e8 ef 25 00 00       	call   45e4 <write>
+  close(fd);
+    1ff5:	89 1c 24             	mov    %ebx,(%esp)
+    1ff8:	e8 ef 25 00 00       	call   45ec <close>
+  if(unlink("dd") >= 0){
+    1ffd:	c7 04 24 a0 53 00 00 	movl   $0x53a0,(%esp)
+    2004:	e8 0b 26 00 00       	call   4614 <unlink>
+    2009:	83 c4 10             	add    $0x10,%esp
+    200c:	85 c0                	test   %eax,%eax
+    200e:	0f 89 3f 05 00 00    	jns    2553 <subdir+0x5c3>
+  if(mkdir("/dd/dd") != 0){
+    2014:	83 ec 0c             	sub    $0xc,%esp
+    2017:	68 b4 52 00 00       	push   $0x52b4
+    201c:	e8 0b 26 00 00       	call   462c <mkdir>
+    2021:	83 c4 10             	add    $0x10,%esp
+    2024:	85 c0                	test   %eax,%eax
+    2026:	0f 85 14 05 00 00    	jne    2540 <subdir+0x5b0>
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    202c:	83 ec 08             	sub    $0x8,%esp
+    202f:	68 02 02 00 00       	push   $0x202
+    2034:	68 d6 52 00 00       	push   $0x52d6
+    2039:	e8 c6 25 00 00       	call   4604 <open>
+  if(fd < 0){
+    203e:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    2041:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2043:	85 c0                	test   %eax,%eax
+    2045:	0f 88 24 04 00 00    	js     246f <subdir+0x4df>
+  write(fd, "FF", 2);
+    204b:	83 ec 04             	sub    $0x4,%esp
+    204e:	6a 02                	push   $0x2
+    2050:	68 f7 52 00 00       	push   $0x52f7
+    2055:	50                   	push   %eax
+    2056:	e8 89 25 00 00       	call   45e4 <write>
+  close(fd);
+    205b:	89 1c 24             	mov    %ebx,(%esp)
+    205e:	e8 89 25 00 00       	call   45ec <close>
+  fd = open("dd/dd/../ff", 0);
+    2063:	58                   	pop    %eax
+    2064:	5a                   	pop    %edx
+    2065:	6a 00                	push   $0x0
+    2067:	68 fa 52 00 00       	push   $0x52fa
+    206c:	e8 93 25 00 00       	call   4604 <open>
+  if(fd < 0){
+    2071:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/../ff", 0);
+    2074:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2076:	85 c0                	test   %eax,%eax
+    2078:	0f 88 de 03 00 00    	js     245c <subdir+0x4cc>
+  cc = read(fd, buf, sizeof(buf));
+    207e:	83 ec 04             	sub    $0x4,%esp
+    2081:	68 00 20 00 00       	push   $0x2000
+    2086:	68 00 99 00 00       	push   $0x9900
+    208b:	50                   	push   %eax
+    208c:	e8 4b 25 00 00       	call   45dc <read>
+  if(cc != 2 || buf[0] != 'f'){
+    2091:	83 c4 10             	add    $0x10,%esp
+    2094:	83 f8 02             	cmp    $0x2,%eax
+    2097:	0f 85 3a 03 00 00    	jne    23d7 <subdir+0x447>
+    209d:	80 3d 00 99 00 00 66 	cmpb   $0x66,0x9900
+    20a4:	0f 85 2d 03 00 00    	jne    23d7 <subdir+0x447>
+  close(fd);
+    20aa:	83 ec 0c             	sub    $0xc,%esp
+    20ad:	53                   	push   %ebx
+    20ae:	e8 39 25 00 00       	call   45ec <close>
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    20b3:	59                   	pop    %ecx
+    20b4:	5b                   	pop    %ebx
+    20b5:	68 3a 53 00 00       	push   $0x533a
+    20ba:	68 d6 52 00 00       	push   $0x52d6
+    20bf:	e8 60 25 00 00       	call   4624 <link>
+    20c4:	83 c4 10             	add    $0x10,%esp
+    20c7:	85 c0                	test   %eax,%eax
+    20c9:	0f 85 c6 03 00 00    	jne    2495 <subdir+0x505>
+  if(unlink("dd/dd/ff") != 0){
+    20cf:	83 ec 0c             	sub    $0xc,%esp
+    20d2:	68 d6 52 00 00       	push   $0x52d6
+    20d7:	e8 38 25 00 00       	call   4614 <unlink>
+    20dc:	83 c4 10             	add    $0x10,%esp
+    20df:	85 c0                	test   %eax,%eax
+    20e1:	0f 85 16 03 00 00    	jne    23fd <subdir+0x46d>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    20e7:	83 ec 08             	sub    $0x8,%esp
+    20ea:	6a 00                	push   $0x0
+    20ec:	68 d6 52 00 00       	push   $0x52d6
+    20f1:	e8 0e 25 00 00       	call   4604 <open>
+    20f6:	83 c4 10             	add    $0x10,%esp
+    20f9:	85 c0                	test   %eax,%eax
+    20fb:	0f 89 2c 04 00 00    	jns    252d <subdir+0x59d>
+  if(chdir("dd") != 0){
+    2101:	83 ec 0c             	sub    $0xc,%esp
+    2104:	68 a0 53 00 00       	push   $0x53a0
+    2109:	e8 26 25 00 00       	call   4634 <chdir>
+    210e:	83 c4 10             	add    $0x10,%esp
+    2111:	85 c0                	test   %eax,%eax
+    2113:	0f 85 01 04 00 00    	jne    251a <subdir+0x58a>
+  if(chdir("dd/../../dd") != 0){
+    2119:	83 ec 0c             	sub    $0xc,%esp
+    211c:	68 6e 53 00 00       	push   $0x536e
+    2121:	e8 0e 25 00 00       	call   4634 <chdir>
+    2126:	83 c4 10             	add    $0x10,%esp
+    2129:	85 c0                	test   %eax,%eax
+    212b:	0f 85 b9 02 00 00    	jne    23ea <subdir+0x45a>
+  if(chdir("dd/../../../dd") != 0){
+    2131:	83 ec 0c             	sub    $0xc,%esp
+    2134:	68 94 53 00 00       	push   $0x5394
+    2139:	e8 f6 24 00 00       	call   4634 <chdir>
+    213e:	83 c4 10             	add    $0x10,%esp
+    2141:	85 c0                	test   %eax,%eax
+    2143:	0f 85 a1 02 00 00    	jne    23ea <subdir+0x45a>
+  if(chdir("./..") != 0){
+    2149:	83 ec 0c             	sub    $0xc,%esp
+    214c:	68 a3 53 00 00       	push   $0x53a3
+    2151:	e8 de 24 00 00       	call   4634 <chdir>
+    2156:	83 c4 10             	add    $0x10,%esp
+    2159:	85 c0                	test   %eax,%eax
+    215b:	0f 85 21 03 00 00    	jne    2482 <subdir+0x4f2>
+  fd = open("dd/dd/ffff", 0);
+    2161:	83 ec 08             	sub    $0x8,%esp
+    2164:	6a 00                	push   $0x0
+    2166:	68 3a 53 00 00       	push   $0x533a
+    216b:	e8 94 24 00 00       	call   4604 <open>
+  if(fd < 0){
+    2170:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ffff", 0);
+    2173:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2175:	85 c0                	test   %eax,%eax
+    2177:	0f 88 e0 04 00 00    	js     265d <subdir+0x6cd>
+  if(read(fd, buf, sizeof(buf)) != 2){
+    217d:	83 ec 04             	sub    $0x4,%esp
+    2180:	68 00 20 00 00       	push   $0x2000
+    2185:	68 00 99 00 00       	push   $0x9900
+    218a:	50                   	push   %eax
+    218b:	e8 4c 24 00 00       	call   45dc <read>
+    2190:	83 c4 10             	add    $0x10,%esp
+    2193:	83 f8 02             	cmp    $0x2,%eax
+    2196:	0f 85 ae 04 00 00    	jne    264a <subdir+0x6ba>
+  close(fd);
+    219c:	83 ec 0c             	sub    $0xc,%esp
+    219f:	53                   	push   %ebx
+    21a0:	e8 47 24 00 00       	call   45ec <close>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    21a5:	58                   	pop    %eax
+    21a6:	5a                   	pop    %edx
+    21a7:	6a 00                	push   $0x0
+    21a9:	68 d6 52 00 00       	push   $0x52d6
+    21ae:	e8 51 24 00 00       	call   4604 <open>
+    21b3:	83 c4 10             	add    $0x10,%esp
+    21b6:	85 c0                	test   %eax,%eax
+    21b8:	0f 89 65 02 00 00    	jns    2423 <subdir+0x493>
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    21be:	83 ec 08             	sub    $0x8,%esp
+    21c1:	68 02 02 00 00       	push   $0x202
+    21c6:	68 ee 53 00 00       	push   $0x53ee
+    21cb:	e8 34 24 00 00       	call   4604 <open>
+    21d0:	83 c4 10             	add    $0x10,%esp
+    21d3:	85 c0                	test   %eax,%eax
+    21d5:	0f 89 35 02 00 00    	jns    2410 <subdir+0x480>
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    21db:	83 ec 08             	sub    $0x8,%esp
+    21de:	68 02 02 00 00       	push   $0x202
+    21e3:	68 13 54 00 00       	push   $0x5413
+    21e8:	e8 17 24 00 00       	call   4604 <open>
+    21ed:	83 c4 10             	add    $0x10,%esp
+    21f0:	85 c0                	test   %eax,%eax
+    21f2:	0f 89 0f 03 00 00    	jns    2507 <subdir+0x577>
+  if(open("dd", O_CREATE) >= 0){
+    21f8:	83 ec 08             	sub    $0x8,%esp
+    21fb:	68 00 02 00 00       	push   $0x200
+    2200:	68 a0 53 00 00       	push   $0x53a0
+    2205:	e8 fa 23 00 00       	call   4604 <open>
+    220a:	83 c4 10             	add    $0x10,%esp
+    220d:	85 c0                	test   %eax,%eax
+    220f:	0f 89 df 02 00 00    	jns    24f4 <subdir+0x564>
+  if(open("dd", O_RDWR) >= 0){
+    2215:	83 ec 08             	sub    $0x8,%esp
+    2218:	6a 02                	push   $0x2
+    221a:	68 a0 53 00 00       	push   $0x53a0
+    221f:	e8 e0 23 00 00       	call   4604 <open>
+    2224:	83 c4 10             	add    $0x10,%esp
+    2227:	85 c0                	test   %eax,%eax
+    2229:	0f 89 b2 02 00 00    	jns    24e1 <subdir+0x551>
+  if(open("dd", O_WRONLY) >= 0){
+    222f:	83 ec 08             	sub    $0x8,%esp
+    2232:	6a 01                	push   $0x1
+    2234:	68 a0 53 00 00       	push   $0x53a0
+    2239:	e8 c6 23 00 00       	call   4604 <open>
+    223e:	83 c4 10             	add    $0x10,%esp
+    2241:	85 c0                	test   %eax,%eax
+    2243:	0f 89 85 02 00 00    	jns    24ce <subdir+0x53e>
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    2249:	83 ec 08             	sub    $0x8,%esp
+    224c:	68 82 54 00 00       	push   $0x5482
+    2251:	68 ee 53 00 00       	push   $0x53ee
+    2256:	e8 c9 23 00 00       	call   4624 <link>
+    225b:	83 c4 10             	add    $0x10,%esp
+    225e:	85 c0                	test   %eax,%eax
+    2260:	0f 84 55 02 00 00    	je     24bb <subdir+0x52b>
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    2266:	83 ec 08             	sub    $0x8,%esp
+    2269:	68 82 54 00 00       	push   $0x5482
+    226e:	68 13 54 00 00       	push   $0x5413
+    2273:	e8 ac 23 00 00       	call   4624 <link>
+    2278:	83 c4 10             	add    $0x10,%esp
+    227b:	85 c0                	test   %eax,%eax
+    227d:	0f 84 25 02 00 00    	je     24a8 <subdir+0x518>
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    2283:	83 ec 08             	sub    $0x8,%esp
+    2286:	68 3a 53 00 00       	push   $0x533a
+    228b:	68 d9 52 00 00       	push   $0x52d9
+    2290:	e8 8f 23 00 00       	call   4624 <link>
+    2295:	83 c4 10             	add    $0x10,%esp
+    2298:	85 c0                	test   %eax,%eax
+    229a:	0f 84 a9 01 00 00    	je     2449 <subdir+0x4b9>
+  if(mkdir("dd/ff/ff") == 0){
+    22a0:	83 ec 0c             	sub    $0xc,%esp
+    22a3:	68 ee 53 00 00       	push   $0x53ee
+    22a8:	e8 7f 23 00 00       	call   462c <mkdir>
+    22ad:	83 c4 10             	add    $0x10,%esp
+    22b0:	85 c0                	test   %eax,%eax
+    22b2:	0f 84 7e 01 00 00    	je     2436 <subdir+0x4a6>
+  if(mkdir("dd/xx/ff") == 0){
+    22b8:	83 ec 0c             	sub    $0xc,%esp
+    22bb:	68 13 54 00 00       	push   $0x5413
+    22c0:	e8 67 23 00 00       	call   462c <mkdir>
+    22c5:	83 c4 10             	add    $0x10,%esp
+    22c8:	85 c0                	test   %eax,%eax
+    22ca:	0f 84 67 03 00 00    	je     2637 <subdir+0x6a7>
+  if(mkdir("dd/dd/ffff") == 0){
+    22d0:	83 ec 0c             	sub    $0xc,%esp
+    22d3:	68 3a 53 00 00       	push   $0x533a
+    22d8:	e8 4f 23 00 00       	call   462c <mkdir>
+    22dd:	83 c4 10             	add    $0x10,%esp
+    22e0:	85 c0                	test   %eax,%eax
+    22e2:	0f 84 3c 03 00 00    	je     2624 <subdir+0x694>
+  if(unlink("dd/xx/ff") == 0){
+    22e8:	83 ec 0c             	sub    $0xc,%esp
+    22eb:	68 13 54 00 00       	push   $0x5413
+    22f0:	e8 1f 23 00 00       	call   4614 <unlink>
+    22f5:	83 c4 10             	add    $0x10,%esp
+    22f8:	85 c0                	test   %eax,%eax
+    22fa:	0f 84 11 03 00 00    	je     2611 <subdir+0x681>
+  if(unlink("dd/ff/ff") == 0){
+    2300:	83 ec 0c             	sub    $0xc,%esp
+    2303:	68 ee 53 00 00       	push   $0x53ee
+    2308:	e8 07 23 00 00       	call   4614 <unlink>
+    230d:	83 c4 10             	add    $0x10,%esp
+    2310:	85 c0                	test   %eax,%eax
+    2312:	0f 84 e6 02 00 00    	je     25fe <subdir+0x66e>
+  if(chdir("dd/ff") == 0){
+    2318:	83 ec 0c             	sub    $0xc,%esp
+    231b:	68 d9 52 00 00       	push   $0x52d9
+    2320:	e8 0f 23 00 00       	call   4634 <chdir>
+    2325:	83 c4 10             	add    $0x10,%esp
+    2328:	85 c0                	test   %eax,%eax
+    232a:	0f 84 bb 02 00 00    	je     25eb <subdir+0x65b>
+  if(chdir("dd/xx") == 0){
+    2330:	83 ec 0c             	sub    $0xc,%esp
+    2333:	68 85 54 00 00       	push   $0x5485
+    2338:	e8 f7 22 00 00       	call   4634 <chdir>
+    233d:	83 c4 10             	add    $0x10,%esp
+    2340:	85 c0                	test   %eax,%eax
+    2342:	0f 84 90 02 00 00    	je     25d8 <subdir+0x648>
+  if(unlink("dd/dd/ffff") != 0){
+    2348:	83 ec 0c             	sub    $0xc,%esp
+    234b:	68 3a 53 00 00       	push   $0x533a
+    2350:	e8 bf 22 00 00       	call   4614 <unlink>
+    2355:	83 c4 10             	add    $0x10,%esp
+    2358:	85 c0                	test   %eax,%eax
+    235a:	0f 85 9d 00 00 00    	jne    23fd <subdir+0x46d>
+  if(unlink("dd/ff") != 0){
+    2360:	83 ec 0c             	sub    $0xc,%esp
+    2363:	68 d9 52 00 00       	push   $0x52d9
+    2368:	e8 a7 22 00 00       	call   4614 <unlink>
+    236d:	83 c4 10             	add    $0x10,%esp
+    2370:	85 c0                	test   %eax,%eax
+    2372:	0f 85 4d 02 00 00    	jne    25c5 <subdir+0x635>
+  if(unlink("dd") == 0){
+    2378:	83 ec 0c             	sub    $0xc,%esp
+    237b:	68 a0 53 00 00       	push   $0x53a0
+    2380:	e8 8f 22 00 00       	call   4614 <unlink>
+    2385:	83 c4 10             	add    $0x10,%esp
+    2388:	85 c0                	test   %eax,%eax
+    238a:	0f 84 22 02 00 00    	je     25b2 <subdir+0x622>
+  if(unlink("dd/dd") < 0){
+    2390:	83 ec 0c             	sub    $0xc,%esp
+    2393:	68 b5 52 00 00       	push   $0x52b5
+    2398:	e8 77 22 00 00       	call   4614 <unlink>
+    239d:	83 c4 10             	add    $0x10,%esp
+    23a0:	85 c0                	test   %eax,%eax
+    23a2:	0f 88 f7 01 00 00    	js     259f <subdir+0x60f>
+  if(unlink("dd") < 0){
+    23a8:	83 ec 0c             	sub    $0xc,%esp
+    23ab:	68 a0 53 00 00       	push   $0x53a0
+    23b0:	e8 5f 22 00 00       	call   4614 <unlink>
+    23b5:	83 c4 10             	add    $0x10,%esp
+    23b8:	85 c0                	test   %eax,%eax
+    23ba:	0f 88 cc 01 00 00    	js     258c <subdir+0x5fc>
+  printf(1, "subdir ok\n");
+    23c0:	83 ec 08             	sub    $0x8,%esp
+    23c3:	68 82 55 00 00       	push   $0x5582
+    23c8:	6a 01                	push   $0x1
+    23ca:	e8 c1 23 00 00       	call   4790 <printf>
+}
+    23cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    23d2:	83 c4 10             	add    $0x10,%esp
+    23d5:	c9                   	leave
+    23d6:	c3                   	ret
+    printf(1, "dd/dd/../ff wrong content\n");
+    23d7:	50                   	push   %eax
+    23d8:	50                   	push   %eax
+    23d9:	68 1f 53 00 00       	push   $0x531f
+    23de:	6a 01                	push   $0x1
+    23e0:	e8 ab 23 00 00       	call   4790 <printf>
+    exit();
+    23e5:	e8 da 21 00 00       	call   45c4 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    23ea:	50                   	push   %eax
+    23eb:	50                   	push   %eax
+    23ec:	68 7a 53 00 00       	push   $0x537a
+    23f1:	6a 01                	push   $0x1
+    23f3:	e8 98 23 00 00       	call   4790 <printf>
+    exit();
+    23f8:	e8 c7 21 00 00       	call   45c4 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    23fd:	50                   	push   %eax
+    23fe:	50                   	push   %eax
+    23ff:	68 45 53 00 00       	push   $0x5345
+    2404:	6a 01                	push   $0x1
+    2406:	e8 85 23 00 00       	call   4790 <printf>
+    exit();
+    240b:	e8 b4 21 00 00       	call   45c4 <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    2410:	51                   	push   %ecx
+    2411:	51                   	push   %ecx
+    2412:	68 f7 53 00 00       	push   $0x53f7
+    2417:	6a 01                	push   $0x1
+    2419:	e8 72 23 00 00       	call   4790 <printf>
+    exit();
+    241e:	e8 a1 21 00 00       	call   45c4 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    2423:	53                   	push   %ebx
+    2424:	53                   	push   %ebx
+    2425:	68 78 60 00 00       	push   $0x6078
+    242a:	6a 01                	push   $0x1
+    242c:	e8 5f 23 00 00       	call   4790 <printf>
+    exit();
+    2431:	e8 8e 21 00 00       	call   45c4 <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    2436:	51                   	push   %ecx
+    2437:	51                   	push   %ecx
+    2438:	68 8b 54 00 00       	push   $0x548b
+    243d:	6a 01                	push   $0x1
+    243f:	e8 4c 23 00 00       	call   4790 <printf>
+    exit();
+    2444:	e8 7b 21 00 00       	call   45c4 <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    2449:	53                   	push   %ebx
+    244a:	53                   	push   %ebx
+    244b:	68 e8 60 00 00       	push   $0x60e8
+    2450:	6a 01                	push   $0x1
+    2452:	e8 39 23 00 00       	call   4790 <printf>
+    exit();
+    2457:	e8 68 21 00 00       	call   45c4 <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    245c:	50                   	push   %eax
+    245d:	50                   	push   %eax
+    245e:	68 06 53 00 00       	push   $0x5306
+    2463:	6a 01                	push   $0x1
+    2465:	e8 26 23 00 00       	call   4790 <printf>
+    exit();
+    246a:	e8 55 21 00 00       	call   45c4 <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    246f:	51                   	push   %ecx
+    2470:	51                   	push   %ecx
+    2471:	68 df 52 00 00       	push   $0x52df
+    2476:	6a 01                	push   $0x1
+    2478:	e8 13 23 00 00       	call   4790 <printf>
+    exit();
+    247d:	e8 42 21 00 00       	call   45c4 <exit>
+    printf(1, "chdir ./.. failed\n");
+    2482:	50                   	push   %eax
+    2483:	50                   	push   %eax
+    2484:	68 a8 53 00 00       	push   $0x53a8
+    2489:	6a 01                	push   $0x1
+    248b:	e8 00 23 00 00       	call   4790 <printf>
+    exit();
+    2490:	e8 2f 21 00 00       	call   45c4 <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    2495:	52                   	push   %edx
+    2496:	52                   	push   %edx
+    2497:	68 30 60 00 00       	push   $0x6030
+    249c:	6a 01                	push   $0x1
+    249e:	e8 ed 22 00 00       	call   4790 <printf>
+    exit();
+    24a3:	e8 1c 21 00 00       	call   45c4 <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    24a8:	50                   	push   %eax
+    24a9:	50                   	push   %eax
+    24aa:	68 c4 60 00 00       	push   $0x60c4
+    24af:	6a 01                	push   $0x1
+    24b1:	e8 da 22 00 00       	call   4790 <printf>
+    exit();
+    24b6:	e8 09 21 00 00       	call   45c4 <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    24bb:	50                   	push   %eax
+    24bc:	50                   	push   %eax
+    24bd:	68 a0 60 00 00       	push   $0x60a0
+    24c2:	6a 01                	push   $0x1
+    24c4:	e8 c7 22 00 00       	call   4790 <printf>
+    exit();
+    24c9:	e8 f6 20 00 00       	call   45c4 <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    24ce:	50                   	push   %eax
+    24cf:	50                   	push   %eax
+    24d0:	68 67 54 00 00       	push   $0x5467
+    24d5:	6a 01                	push   $0x1
+    24d7:	e8 b4 22 00 00       	call   4790 <printf>
+    exit();
+    24dc:	e8 e3 20 00 00       	call   45c4 <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    24e1:	50                   	push   %eax
+    24e2:	50                   	push   %eax
+    24e3:	68 4e 54 00 00       	push   $0x544e
+    24e8:	6a 01                	push   $0x1
+    24ea:	e8 a1 22 00 00       	call   4790 <printf>
+    exit();
+    24ef:	e8 d0 20 00 00       	call   45c4 <exit>
+    printf(1, "create dd succeeded!\n");
+    24f4:	50                   	push   %eax
+    24f5:	50                   	push   %eax
+    24f6:	68 38 54 00 00       	push   $0x5438
+    24fb:	6a 01                	push   $0x1
+    24fd:	e8 8e 22 00 00       	call   4790 <printf>
+    exit();
+    2502:	e8 bd 20 00 00       	call   45c4 <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    2507:	52                   	push   %edx
+    2508:	52                   	push   %edx
+    2509:	68 1c 54 00 00       	push   $0x541c
+    250e:	6a 01                	push   $0x1
+    2510:	e8 7b 22 00 00       	call   4790 <printf>
+    exit();
+    2515:	e8 aa 20 00 00       	call   45c4 <exit>
+    printf(1, "chdir dd failed\n");
+    251a:	50                   	push   %eax
+    251b:	50                   	push   %eax
+    251c:	68 5d 53 00 00       	push   $0x535d
+    2521:	6a 01                	push   $0x1
+    2523:	e8 68 22 00 00       	call   4790 <printf>
+    exit();
+    2528:	e8 97 20 00 00       	call   45c4 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    252d:	50                   	push   %eax
+    252e:	50                   	push   %eax
+    252f:	68 54 60 00 00       	push   $0x6054
+    2534:	6a 01                	push   $0x1
+    2536:	e8 55 22 00 00       	call   4790 <printf>
+    exit();
+    253b:	e8 84 20 00 00       	call   45c4 <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    2540:	53                   	push   %ebx
+    2541:	53                   	push   %ebx
+    2542:	68 bb 52 00 00       	push   $0x52bb
+    2547:	6a 01                	push   $0x1
+    2549:	e8 42 22 00 00       	call   4790 <printf>
+    exit();
+    254e:	e8 71 20 00 00       	call   45c4 <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    2553:	50                   	push   %eax
+    2554:	50                   	push   %eax
+    2555:	68 08 60 00 00       	push   $0x6008
+    255a:	6a 01                	push   $0x1
+    255c:	e8 2f 22 00 00       	call   4790 <printf>
+    exit();
+    2561:	e8 5e 20 00 00       	call   45c4 <exit>
+    printf(1, "create dd/ff failed\n");
+    2566:	50                   	push   %eax
+    2567:	50                   	push   %eax
+    2568:	68 9f 52 00 00       	push   $0x529f
+    256d:	6a 01                	push   $0x1
+    256f:	e8 1c 22 00 00       	call   4790 <printf>
+    exit();
+    2574:	e8 4b 20 00 00       	call   45c4 <exit>
+    printf(1, "subdir mkdir dd failed\n");
+    2579:	50                   	push   %eax
+    257a:	50                   	push   %eax
+    257b:	68 87 52 00 00       	push   $0x5287
+    2580:	6a 01                	push   $0x1
+    2582:	e8 09 22 00 00       	call   4790 <printf>
+    exit();
+    2587:	e8 38 20 00 00       	call   45c4 <exit>
+    printf(1, "unlink dd failed\n");
+    258c:	50                   	push   %eax
+    258d:	50                   	push   %eax
+    258e:	68 70 55 00 00       	push   $0x5570
+    2593:	6a 01                	push   $0x1
+    2595:	e8 f6 21 00 00       	call   4790 <printf>
+    exit();
+    259a:	e8 25 20 00 00       	call   45c4 <exit>
+    printf(1, "unlink dd/dd failed\n");
+    259f:	52                   	push   %edx
+    25a0:	52                   	push   %edx
+    25a1:	68 5b 55 00 00       	push   $0x555b
+    25a6:	6a 01                	push   $0x1
+    25a8:	e8 e3 21 00 00       	call   4790 <printf>
+    exit();
+    25ad:	e8 12 20 00 00       	call   45c4 <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    25b2:	51                   	push   %ecx
+    25b3:	51                   	push   %ecx
+    25b4:	68 0c 61 00 00       	push   $0x610c
+    25b9:	6a 01                	push   $0x1
+    25bb:	e8 d0 21 00 00       	call   4790 <printf>
+    exit();
+    25c0:	e8 ff 1f 00 00       	call   45c4 <exit>
+    printf(1, "unlink dd/ff failed\n");
+    25c5:	53                   	push   %ebx
+    25c6:	53                   	push   %ebx
+    25c7:	68 46 55 00 00       	push   $0x5546
+    25cc:	6a 01                	push   $0x1
+    25ce:	e8 bd 21 00 00       	call   4790 <printf>
+    exit();
+    25d3:	e8 ec 1f 00 00       	call   45c4 <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    25d8:	50                   	push   %eax
+    25d9:	50                   	push   %eax
+    25da:	68 2e 55 00 00       	push   $0x552e
+    25df:	6a 01                	push   $0x1
+    25e1:	e8 aa 21 00 00       	call   4790 <printf>
+    exit();
+    25e6:	e8 d9 1f 00 00       	call   45c4 <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    25eb:	50                   	push   %eax
+    25ec:	50                   	push   %eax
+    25ed:	68 16 55 00 00       	push   $0x5516
+    25f2:	6a 01                	push   $0x1
+    25f4:	e8 97 21 00 00       	call   4790 <printf>
+    exit();
+    25f9:	e8 c6 1f 00 00       	call   45c4 <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    25fe:	50                   	push   %eax
+    25ff:	50                   	push   %eax
+    2600:	68 fa 54 00 00       	push   $0x54fa
+    2605:	6a 01                	push   $0x1
+    2607:	e8 84 21 00 00       	call   4790 <printf>
+    exit();
+    260c:	e8 b3 1f 00 00       	call   45c4 <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    2611:	50                   	push   %eax
+    2612:	50                   	push   %eax
+    2613:	68 de 54 00 00       	push   $0x54de
+    2618:	6a 01                	push   $0x1
+    261a:	e8 71 21 00 00       	call   4790 <printf>
+    exit();
+    261f:	e8 a0 1f 00 00       	call   45c4 <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    2624:	50                   	push   %eax
+    2625:	50                   	push   %eax
+    2626:	68 c1 54 00 00       	push   $0x54c1
+    262b:	6a 01                	push   $0x1
+    262d:	e8 5e 21 00 00       	call   4790 <printf>
+    exit();
+    2632:	e8 8d 1f 00 00       	call   45c4 <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    2637:	52                   	push   %edx
+    2638:	52                   	push   %edx
+    2639:	68 a6 54 00 00       	push   $0x54a6
+    263e:	6a 01                	push   $0x1
+    2640:	e8 4b 21 00 00       	call   4790 <printf>
+    exit();
+    2645:	e8 7a 1f 00 00       	call   45c4 <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    264a:	51                   	push   %ecx
+    264b:	51                   	push   %ecx
+    264c:	68 d3 53 00 00       	push   $0x53d3
+    2651:	6a 01                	push   $0x1
+    2653:	e8 38 21 00 00       	call   4790 <printf>
+    exit();
+    2658:	e8 67 1f 00 00       	call   45c4 <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    265d:	53                   	push   %ebx
+    265e:	53                   	push   %ebx
+    265f:	68 bb 53 00 00       	push   $0x53bb
+    2664:	6a 01                	push   $0x1
+    2666:	e8 25 21 00 00       	call   4790 <printf>
+    exit();
+    266b:	e8 54 1f 00 00       	call   45c4 <exit>
+
+00002670 <bigwrite>:
+{
+    2670:	55                   	push   %ebp
+    2671:	89 e5                	mov    %esp,%ebp
+    2673:	56                   	push   %esi
+    2674:	53                   	push   %ebx
+  for(sz = 499; sz < 12*512; sz += 471){
+    2675:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+  printf(1, "bigwrite test\n");
+    267a:	83 ec 08             	sub    $0x8,%esp
+    267d:	68 8d 55 00 00       	push   $0x558d
+    2682:	6a 01                	push   $0x1
+    2684:	e8 07 21 00 00       	call   4790 <printf>
+  unlink("bigwrite");
+    2689:	c7 04 24 9c 55 00 00 	movl   $0x559c,(%esp)
+    2690:	e8 7f 1f 00 00       	call   4614 <unlink>
+    2695:	83 c4 10             	add    $0x10,%esp
+    2698:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    269f:	90                   	nop
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    26a0:	83 ec 08             	sub    $0x8,%esp
+    26a3:	68 02 02 00 00       	push   $0x202
+    26a8:	68 9c 55 00 00       	push   $0x559c
+    26ad:	e8 52 1f 00 00       	call   4604 <open>
+    if(fd < 0){
+    26b2:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    26b5:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    26b7:	85 c0                	test   %eax,%eax
+    26b9:	78 7e                	js     2739 <bigwrite+0xc9>
+      int cc = write(fd, buf, sz);
+    26bb:	83 ec 04             	sub    $0x4,%esp
+    26be:	53                   	push   %ebx
+    26bf:	68 00 99 00 00       	push   $0x9900
+    26c4:	50                   	push   %eax
+    26c5:	e8 1a 1f 00 00       	call   45e4 <write>
+      if(cc != sz){
+    26ca:	83 c4 10             	add    $0x10,%esp
+    26cd:	39 d8                	cmp    %ebx,%eax
+    26cf:	75 55                	jne    2726 <bigwrite+0xb6>
+      int cc = write(fd, buf, sz);
+    26d1:	83 ec 04             	sub    $0x4,%esp
+    26d4:	53                   	push   %ebx
+    26d5:	68 00 99 00 00       	push   $0x9900
+    26da:	56                   	push   %esi
+    26db:	e8 04 1f 00 00       	call   45e4 <write>
+      if(cc != sz){
+    26e0:	83 c4 10             	add    $0x10,%esp
+    26e3:	39 c3                	cmp    %eax,%ebx
+    26e5:	75 3f                	jne    2726 <bigwrite+0xb6>
+    close(fd);
+    26e7:	83 ec 0c             	sub    $0xc,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    26ea:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    close(fd);
+    26f0:	56                   	push   %esi
+    26f1:	e8 f6 1e 00 00       	call   45ec <close>
+    unlink("bigwrite");
+    26f6:	c7 04 24 9c 55 00 00 	movl   $0x559c,(%esp)
+    26fd:	e8 12 1f 00 00       	call   4614 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    2702:	83 c4 10             	add    $0x10,%esp
+    2705:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+    270b:	75 93                	jne    26a0 <bigwrite+0x30>
+  printf(1, "bigwrite ok\n");
+    270d:	83 ec 08             	sub    $0x8,%esp
+    2710:	68 cf 55 00 00       	push   $0x55cf
+    2715:	6a 01                	push   $0x1
+    2717:	e8 74 20 00 00       	call   4790 <printf>
+}
+    271c:	83 c4 10             	add    $0x10,%esp
+    271f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2722:	5b                   	pop    %ebx
+    2723:	5e                   	pop    %esi
+    2724:	5d                   	pop    %ebp
+    2725:	c3                   	ret
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    2726:	50                   	push   %eax
+    2727:	53                   	push   %ebx
+    2728:	68 bd 55 00 00       	push   $0x55bd
+    272d:	6a 01                	push   $0x1
+    272f:	e8 5c 20 00 00       	call   4790 <printf>
+        exit();
+    2734:	e8 8b 1e 00 00       	call   45c4 <exit>
+      printf(1, "cannot create bigwrite\n");
+    2739:	83 ec 08             	sub    $0x8,%esp
+    273c:	68 a5 55 00 00       	push   $0x55a5
+    2741:	6a 01                	push   $0x1
+    2743:	e8 48 20 00 00       	call   4790 <printf>
+      exit();
+    2748:	e8 77 1e 00 00       	call   45c4 <exit>
+    274d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002750 <bigfile>:
+{
+    2750:	55                   	push   %ebp
+    2751:	89 e5                	mov    %esp,%ebp
+    2753:	57                   	push   %edi
+    2754:	56                   	push   %esi
+    2755:	53                   	push   %ebx
+    2756:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "bigfile test\n");
+    2759:	68 dc 55 00 00       	push   $0x55dc
+    275e:	6a 01                	push   $0x1
+    2760:	e8 2b 20 00 00       	call   4790 <printf>
+  unlink("bigfile");
+    2765:	c7 04 24 f8 55 00 00 	movl   $0x55f8,(%esp)
+    276c:	e8 a3 1e 00 00       	call   4614 <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    2771:	58                   	pop    %eax
+    2772:	5a                   	pop    %edx
+    2773:	68 02 02 00 00       	push   $0x202
+    2778:	68 f8 55 00 00       	push   $0x55f8
+    277d:	e8 82 1e 00 00       	call   4604 <open>
+  if(fd < 0){
+    2782:	83 c4 10             	add    $0x10,%esp
+    2785:	85 c0                	test   %eax,%eax
+    2787:	0f 88 5e 01 00 00    	js     28eb <bigfile+0x19b>
+    278d:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+    278f:	31 db                	xor    %ebx,%ebx
+    2791:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    memset(buf, i, 600);
+    2798:	83 ec 04             	sub    $0x4,%esp
+    279b:	68 58 02 00 00       	push   $0x258
+    27a0:	53                   	push   %ebx
+    27a1:	68 00 99 00 00       	push   $0x9900
+    27a6:	e8 35 1c 00 00       	call   43e0 <memset>
+    if(write(fd, buf, 600) != 600){
+    27ab:	83 c4 0c             	add    $0xc,%esp
+    27ae:	68 58 02 00 00       	push   $0x258
+    27b3:	68 00 99 00 00       	push   $0x9900
+    27b8:	56                   	push   %esi
+    27b9:	e8 26 1e 00 00       	call   45e4 <write>
+    27be:	83 c4 10             	add    $0x10,%esp
+    27c1:	3d 58 02 00 00       	cmp    $0x258,%eax
+    27c6:	0f 85 f8 00 00 00    	jne    28c4 <bigfile+0x174>
+  for(i = 0; i < 20; i++){
+    27cc:	83 c3 01             	add    $0x1,%ebx
+    27cf:	83 fb 14             	cmp    $0x14,%ebx
+    27d2:	75 c4                	jne    2798 <bigfile+0x48>
+  close(fd);
+    27d4:	83 ec 0c             	sub    $0xc,%esp
+    27d7:	56                   	push   %esi
+    27d8:	e8 0f 1e 00 00       	call   45ec <close>
+  fd = open("bigfile", 0);
+    27dd:	5e                   	pop    %esi
+    27de:	5f                   	pop    %edi
+    27df:	6a 00                	push   $0x0
+    27e1:	68 f8 55 00 00       	push   $0x55f8
+    27e6:	e8 19 1e 00 00       	call   4604 <open>
+  if(fd < 0){
+    27eb:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", 0);
+    27ee:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    27f0:	85 c0                	test   %eax,%eax
+    27f2:	0f 88 e0 00 00 00    	js     28d8 <bigfile+0x188>
+  total = 0;
+    27f8:	31 db                	xor    %ebx,%ebx
+  for(i = 0; ; i++){
+    27fa:	31 ff                	xor    %edi,%edi
+    27fc:	eb 30                	jmp    282e <bigfile+0xde>
+    27fe:	66 90                	xchg   %ax,%ax
+    if(cc != 300){
+    2800:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    2805:	0f 85 91 00 00 00    	jne    289c <bigfile+0x14c>
+    if(buf[0] != i/2 || buf[299] != i/2){
+    280b:	89 fa                	mov    %edi,%edx
+    280d:	0f be 05 00 99 00 00 	movsbl 0x9900,%eax
+    2814:	d1 fa                	sar    %edx
+    2816:	39 d0                	cmp    %edx,%eax
+    2818:	75 6e                	jne    2888 <bigfile+0x138>
+    281a:	0f be 15 2b 9a 00 00 	movsbl 0x9a2b,%edx
+    2821:	39 d0                	cmp    %edx,%eax
+    2823:	75 63                	jne    2888 <bigfile+0x138>
+    total += cc;
+    2825:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+  for(i = 0; ; i++){
+    282b:	83 c7 01             	add    $0x1,%edi
+    cc = read(fd, buf, 300);
+    282e:	83 ec 04             	sub    $0x4,%esp
+    2831:	68 2c 01 00 00       	push   $0x12c
+    2836:	68 00 99 00 00       	push   $0x9900
+    283b:	56                   	push   %esi
+    283c:	e8 9b 1d 00 00       	call   45dc <read>
+    if(cc < 0){
+    2841:	83 c4 10             	add    $0x10,%esp
+    2844:	85 c0                	test   %eax,%eax
+    2846:	78 68                	js     28b0 <bigfile+0x160>
+    if(cc == 0)
+    2848:	75 b6                	jne    2800 <bigfile+0xb0>
+  close(fd);
+    284a:	83 ec 0c             	sub    $0xc,%esp
+    284d:	56                   	push   %esi
+    284e:	e8 99 1d 00 00       	call   45ec <close>
+  if(total != 20*600){
+    2853:	83 c4 10             	add    $0x10,%esp
+    2856:	81 fb e0 2e 00 00    	cmp    $0x2ee0,%ebx
+    285c:	0f 85 9c 00 00 00    	jne    28fe <bigfile+0x1ae>
+  unlink("bigfile");
+    2862:	83 ec 0c             	sub    $0xc,%esp
+    2865:	68 f8 55 00 00       	push   $0x55f8
+    286a:	e8 a5 1d 00 00       	call   4614 <unlink>
+  printf(1, "bigfile test ok\n");
+    286f:	58                   	pop    %eax
+    2870:	5a                   	pop    %edx
+    2871:	68 87 56 00 00       	push   $0x5687
+    2876:	6a 01                	push   $0x1
+    2878:	e8 13 1f 00 00       	call   4790 <printf>
+}
+    287d:	83 c4 10             	add    $0x10,%esp
+    2880:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2883:	5b                   	pop    %ebx
+    2884:	5e                   	pop    %esi
+    2885:	5f                   	pop    %edi
+    2886:	5d                   	pop    %ebp
+    2887:	c3                   	ret
+      printf(1, "read bigfile wrong data\n");
+    2888:	83 ec 08             	sub    $0x8,%esp
+    288b:	68 54 56 00 00       	push   $0x5654
+    2890:	6a 01                	push   $0x1
+    2892:	e8 f9 1e 00 00       	call   4790 <printf>
+      exit();
+    2897:	e8 28 1d 00 00       	call   45c4 <exit>
+      printf(1, "short read bigfile\n");
+    289c:	83 ec 08             	sub    $0x8,%esp
+    289f:	68 40 56 00 00       	push   $0x5640
+    28a4:	6a 01                	push   $0x1
+    28a6:	e8 e5 1e 00 00       	call   4790 <printf>
+      exit();
+    28ab:	e8 14 1d 00 00       	call   45c4 <exit>
+      printf(1, "read bigfile failed\n");
+    28b0:	83 ec 08             	sub    $0x8,%esp
+    28b3:	68 2b 56 00 00       	push   $0x562b
+    28b8:	6a 01                	push   $0x1
+    28ba:	e8 d1 1e 00 00       	call   4790 <printf>
+      exit();
+    28bf:	e8 00 1d 00 00       	call   45c4 <exit>
+      printf(1, "write bigfile failed\n");
+    28c4:	83 ec 08             	sub    $0x8,%esp
+    28c7:	68 00 56 00 00       	push   $0x5600
+    28cc:	6a 01                	push   $0x1
+    28ce:	e8 bd 1e 00 00       	call   4790 <printf>
+      exit();
+    28d3:	e8 ec 1c 00 00       	call   45c4 <exit>
+    printf(1, "cannot open bigfile\n");
+    28d8:	53                   	push   %ebx
+    28d9:	53                   	push   %ebx
+    28da:	68 16 56 00 00       	push   $0x5616
+    28df:	6a 01                	push   $0x1
+    28e1:	e8 aa 1e 00 00       	call   4790 <printf>
+    exit();
+    28e6:	e8 d9 1c 00 00       	call   45c4 <exit>
+    printf(1, "cannot create bigfile");
+    28eb:	50                   	push   %eax
+    28ec:	50                   	push   %eax
+    28ed:	68 ea 55 00 00       	push   $0x55ea
+    28f2:	6a 01                	push   $0x1
+    28f4:	e8 97 1e 00 00       	call   4790 <printf>
+    exit();
+    28f9:	e8 c6 1c 00 00       	call   45c4 <exit>
+    printf(1, "read bigfile wrong total\n");
+    28fe:	51                   	push   %ecx
+    28ff:	51                   	push   %ecx
+    2900:	68 6d 56 00 00       	push   $0x566d
+    2905:	6a 01                	push   $0x1
+    2907:	e8 84 1e 00 00       	call   4790 <printf>
+    exit();
+    290c:	e8 b3 1c 00 00       	call   45c4 <exit>
+    2911:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2918:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    291f:	90                   	nop
+
+00002920 <fourteen>:
+{
+    2920:	55                   	push   %ebp
+    2921:	89 e5                	mov    %esp,%ebp
+    2923:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "fourteen test\n");
+    2926:	68 98 56 00 00       	push   $0x5698
+    292b:	6a 01                	push   $0x1
+    292d:	e8 5e 1e 00 00       	call   4790 <printf>
+  if(mkdir("12345678901234") != 0){
+    2932:	c7 04 24 d3 56 00 00 	movl   $0x56d3,(%esp)
+    2939:	e8 ee 1c 00 00       	call   462c <mkdir>
+    293e:	83 c4 10             	add    $0x10,%esp
+    2941:	85 c0                	test   %eax,%eax
+    2943:	0f 85 97 00 00 00    	jne    29e0 <fourteen+0xc0>
+  if(mkdir("12345678901234/123456789012345") != 0){
+    2949:	83 ec 0c             	sub    $0xc,%esp
+    294c:	68 2c 61 00 00       	push   $0x612c
+    2951:	e8 d6 1c 00 00       	call   462c <mkdir>
+    2956:	83 c4 10             	add    $0x10,%esp
+    2959:	85 c0                	test   %eax,%eax
+    295b:	0f 85 de 00 00 00    	jne    2a3f <fourteen+0x11f>
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    2961:	83 ec 08             	sub    $0x8,%esp
+    2964:	68 00 02 00 00       	push   $0x200
+    2969:	68 7c 61 00 00       	push   $0x617c
+    296e:	e8 91 1c 00 00       	call   4604 <open>
+  if(fd < 0){
+    2973:	83 c4 10             	add    $0x10,%esp
+    2976:	85 c0                	test   %eax,%eax
+    2978:	0f 88 ae 00 00 00    	js     2a2c <fourteen+0x10c>
+  close(fd);
+    297e:	83 ec 0c             	sub    $0xc,%esp
+    2981:	50                   	push   %eax
+    2982:	e8 65 1c 00 00       	call   45ec <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    2987:	58                   	pop    %eax
+    2988:	5a                   	pop    %edx
+    2989:	6a 00                	push   $0x0
+    298b:	68 ec 61 00 00       	push   $0x61ec
+    2990:	e8 6f 1c 00 00       	call   4604 <open>
+  if(fd < 0){
+    2995:	83 c4 10             	add    $0x10,%esp
+    2998:	85 c0                	test   %eax,%eax
+    299a:	78 7d                	js     2a19 <fourteen+0xf9>
+  close(fd);
+    299c:	83 ec 0c             	sub    $0xc,%esp
+    299f:	50                   	push   %eax
+    29a0:	e8 47 1c 00 00       	call   45ec <close>
+  if(mkdir("12345678901234/12345678901234") == 0){
+    29a5:	c7 04 24 c4 56 00 00 	movl   $0x56c4,(%esp)
+    29ac:	e8 7b 1c 00 00       	call   462c <mkdir>
+    29b1:	83 c4 10             	add    $0x10,%esp
+    29b4:	85 c0                	test   %eax,%eax
+    29b6:	74 4e                	je     2a06 <fourteen+0xe6>
+  if(mkdir("123456789012345/12345678901234") == 0){
+    29b8:	83 ec 0c             	sub    $0xc,%esp
+    29bb:	68 88 62 00 00       	push   $0x6288
+    29c0:	e8 67 1c 00 00       	call   462c <mkdir>
+    29c5:	83 c4 10             	add    $0x10,%esp
+    29c8:	85 c0                	test   %eax,%eax
+    29ca:	74 27                	je     29f3 <fourteen+0xd3>
+  printf(1, "fourteen ok\n");
+    29cc:	83 ec 08             	sub    $0x8,%esp
+    29cf:	68 e2 56 00 00       	push   $0x56e2
+    29d4:	6a 01                	push   $0x1
+    29d6:	e8 b5 1d 00 00       	call   4790 <printf>
+}
+    29db:	83 c4 10             	add    $0x10,%esp
+    29de:	c9                   	leave
+    29df:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    29e0:	50                   	push   %eax
+    29e1:	50                   	push   %eax
+    29e2:	68 a7 56 00 00       	push   $0x56a7
+    29e7:	6a 01                	push   $0x1
+    29e9:	e8 a2 1d 00 00       	call   4790 <printf>
+    exit();
+    29ee:	e8 d1 1b 00 00       	call   45c4 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    29f3:	50                   	push   %eax
+    29f4:	50                   	push   %eax
+    29f5:	68 a8 62 00 00       	push   $0x62a8
+    29fa:	6a 01                	push   $0x1
+    29fc:	e8 8f 1d 00 00       	call   4790 <printf>
+    exit();
+    2a01:	e8 be 1b 00 00       	call   45c4 <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    2a06:	52                   	push   %edx
+    2a07:	52                   	push   %edx
+    2a08:	68 58 62 00 00       	push   $0x6258
+    2a0d:	6a 01                	push   $0x1
+    2a0f:	e8 7c 1d 00 00       	call   4790 <printf>
+    exit();
+    2a14:	e8 ab 1b 00 00       	call   45c4 <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    2a19:	51                   	push   %ecx
+    2a1a:	51                   	push   %ecx
+    2a1b:	68 1c 62 00 00       	push   $0x621c
+    2a20:	6a 01                	push   $0x1
+    2a22:	e8 69 1d 00 00       	call   4790 <printf>
+    exit();
+    2a27:	e8 98 1b 00 00       	call   45c4 <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    2a2c:	51                   	push   %ecx
+    2a2d:	51                   	push   %ecx
+    2a2e:	68 ac 61 00 00       	push   $0x61ac
+    2a33:	6a 01                	push   $0x1
+    2a35:	e8 56 1d 00 00       	call   4790 <printf>
+    exit();
+    2a3a:	e8 85 1b 00 00       	call   45c4 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    2a3f:	50                   	push   %eax
+    2a40:	50                   	push   %eax
+    2a41:	68 4c 61 00 00       	push   $0x614c
+    2a46:	6a 01                	push   $0x1
+    2a48:	e8 43 1d 00 00       	call   4790 <printf>
+    exit();
+    2a4d:	e8 72 1b 00 00       	call   45c4 <exit>
+    2a52:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2a59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002a60 <rmdot>:
+{
+    2a60:	55                   	push   %ebp
+    2a61:	89 e5                	mov    %esp,%ebp
+    2a63:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    2a66:	68 ef 56 00 00       	push   $0x56ef
+    2a6b:	6a 01                	push   $0x1
+    2a6d:	e8 1e 1d 00 00       	call   4790 <printf>
+  if(mkdir("dots") != 0){
+    2a72:	c7 04 24 fb 56 00 00 	movl   $0x56fb,(%esp)
+    2a79:	e8 ae 1b 00 00       	call   462c <mkdir>
+    2a7e:	83 c4 10             	add    $0x10,%esp
+    2a81:	85 c0                	test   %eax,%eax
+    2a83:	0f 85 b0 00 00 00    	jne    2b39 <rmdot+0xd9>
+  if(chdir("dots") != 0){
+    2a89:	83 ec 0c             	sub    $0xc,%esp
+    2a8c:	68 fb 56 00 00       	push   $0x56fb
+    2a91:	e8 9e 1b 00 00       	call   4634 <chdir>
+    2a96:	83 c4 10             	add    $0x10,%esp
+    2a99:	85 c0                	test   %eax,%eax
+    2a9b:	0f 85 1d 01 00 00    	jne    2bbe <rmdot+0x15e>
+  if(unlink(".") == 0){
+    2aa1:	83 ec 0c             	sub    $0xc,%esp
+    2aa4:	68 a6 53 00 00       	push   $0x53a6
+    2aa9:	e8 66 1b 00 00       	call   4614 <unlink>
+    2aae:	83 c4 10             	add    $0x10,%esp
+    2ab1:	85 c0                	test   %eax,%eax
+    2ab3:	0f 84 f2 00 00 00    	je     2bab <rmdot+0x14b>
+  if(unlink("..") == 0){
+    2ab9:	83 ec 0c             	sub    $0xc,%esp
+    2abc:	68 a5 53 00 00       	push   $0x53a5
+    2ac1:	e8 4e 1b 00 00       	call   4614 <unlink>
+    2ac6:	83 c4 10             	add    $0x10,%esp
+    2ac9:	85 c0                	test   %eax,%eax
+    2acb:	0f 84 c7 00 00 00    	je     2b98 <rmdot+0x138>
+  if(chdir("/") != 0){
+    2ad1:	83 ec 0c             	sub    $0xc,%esp
+    2ad4:	68 f3 4a 00 00       	push   $0x4af3
+    2ad9:	e8 56 1b 00 00       	call   4634 <chdir>
+    2ade:	83 c4 10             	add    $0x10,%esp
+    2ae1:	85 c0                	test   %eax,%eax
+    2ae3:	0f 85 9c 00 00 00    	jne    2b85 <rmdot+0x125>
+  if(unlink("dots/.") == 0){
+    2ae9:	83 ec 0c             	sub    $0xc,%esp
+    2aec:	68 43 57 00 00       	push   $0x5743
+    2af1:	e8 1e 1b 00 00       	call   4614 <unlink>
+    2af6:	83 c4 10             	add    $0x10,%esp
+    2af9:	85 c0                	test   %eax,%eax
+    2afb:	74 75                	je     2b72 <rmdot+0x112>
+  if(unlink("dots/..") == 0){
+    2afd:	83 ec 0c             	sub    $0xc,%esp
+    2b00:	68 61 57 00 00       	push   $0x5761
+    2b05:	e8 0a 1b 00 00       	call   4614 <unlink>
+    2b0a:	83 c4 10             	add    $0x10,%esp
+    2b0d:	85 c0                	test   %eax,%eax
+    2b0f:	74 4e                	je     2b5f <rmdot+0xff>
+  if(unlink("dots") != 0){
+    2b11:	83 ec 0c             	sub    $0xc,%esp
+    2b14:	68 fb 56 00 00       	push   $0x56fb
+    2b19:	e8 f6 1a 00 00       	call   4614 <unlink>
+    2b1e:	83 c4 10             	add    $0x10,%esp
+    2b21:	85 c0                	test   %eax,%eax
+    2b23:	75 27                	jne    2b4c <rmdot+0xec>
+  printf(1, "rmdot ok\n");
+    2b25:	83 ec 08             	sub    $0x8,%esp
+    2b28:	68 96 57 00 00       	push   $0x5796
+    2b2d:	6a 01                	push   $0x1
+    2b2f:	e8 5c 1c 00 00       	call   4790 <printf>
+}
+    2b34:	83 c4 10             	add    $0x10,%esp
+    2b37:	c9                   	leave
+    2b38:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    2b39:	50                   	push   %eax
+    2b3a:	50                   	push   %eax
+    2b3b:	68 00 57 00 00       	push   $0x5700
+    2b40:	6a 01                	push   $0x1
+    2b42:	e8 49 1c 00 00       	call   4790 <printf>
+    exit();
+    2b47:	e8 78 1a 00 00       	call   45c4 <exit>
+    printf(1, "unlink dots failed!\n");
+    2b4c:	50                   	push   %eax
+    2b4d:	50                   	push   %eax
+    2b4e:	68 81 57 00 00       	push   $0x5781
+    2b53:	6a 01                	push   $0x1
+    2b55:	e8 36 1c 00 00       	call   4790 <printf>
+    exit();
+    2b5a:	e8 65 1a 00 00       	call   45c4 <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    2b5f:	52                   	push   %edx
+    2b60:	52                   	push   %edx
+    2b61:	68 69 57 00 00       	push   $0x5769
+    2b66:	6a 01                	push   $0x1
+    2b68:	e8 23 1c 00 00       	call   4790 <printf>
+    exit();
+    2b6d:	e8 52 1a 00 00       	call   45c4 <exit>
+    printf(1, "unlink dots/. worked!\n");
+    2b72:	51                   	push   %ecx
+    2b73:	51                   	push   %ecx
+    2b74:	68 4a 57 00 00       	push   $0x574a
+    2b79:	6a 01                	push   $0x1
+    2b7b:	e8 10 1c 00 00       	call   4790 <printf>
+    exit();
+    2b80:	e8 3f 1a 00 00       	call   45c4 <exit>
+    printf(1, "chdir / failed\n");
+    2b85:	50                   	push   %eax
+    2b86:	50                   	push   %eax
+    2b87:	68 f5 4a 00 00       	push   $0x4af5
+    2b8c:	6a 01                	push   $0x1
+    2b8e:	e8 fd 1b 00 00       	call   4790 <printf>
+    exit();
+    2b93:	e8 2c 1a 00 00       	call   45c4 <exit>
+    printf(1, "rm .. worked!\n");
+    2b98:	50                   	push   %eax
+    2b99:	50                   	push   %eax
+    2b9a:	68 34 57 00 00       	push   $0x5734
+    2b9f:	6a 01                	push   $0x1
+    2ba1:	e8 ea 1b 00 00       	call   4790 <printf>
+    exit();
+    2ba6:	e8 19 1a 00 00       	call   45c4 <exit>
+    printf(1, "rm . worked!\n");
+    2bab:	50                   	push   %eax
+    2bac:	50                   	push   %eax
+    2bad:	68 26 57 00 00       	push   $0x5726
+    2bb2:	6a 01                	push   $0x1
+    2bb4:	e8 d7 1b 00 00       	call   4790 <printf>
+    exit();
+    2bb9:	e8 06 1a 00 00       	call   45c4 <exit>
+    printf(1, "chdir dots failed\n");
+    2bbe:	50                   	push   %eax
+    2bbf:	50                   	push   %eax
+    2bc0:	68 13 57 00 00       	push   $0x5713
+    2bc5:	6a 01                	push   $0x1
+    2bc7:	e8 c4 1b 00 00       	call   4790 <printf>
+    exit();
+    2bcc:	e8 f3 19 00 00       	call   45c4 <exit>
+    2bd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2bd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2bdf:	90                   	nop
+
+00002be0 <dirfile>:
+{
+    2be0:	55                   	push   %ebp
+    2be1:	89 e5                	mov    %esp,%ebp
+    2be3:	53                   	push   %ebx
+    2be4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dir vs file\n");
+    2be7:	68 a0 57 00 00       	push   $0x57a0
+    2bec:	6a 01                	push   $0x1
+    2bee:	e8 9d 1b 00 00       	call   4790 <printf>
+  fd = open("dirfile", O_CREATE);
+    2bf3:	5b                   	pop    %ebx
+    2bf4:	58                   	pop    %eax
+    2bf5:	68 00 02 00 00       	push   $0x200
+    2bfa:	68 ad 57 00 00       	push   $0x57ad
+    2bff:	e8 00 1a 00 00       	call   4604 <open>
+  if(fd < 0){
+    2c04:	83 c4 10             	add    $0x10,%esp
+    2c07:	85 c0                	test   %eax,%eax
+    2c09:	0f 88 43 01 00 00    	js     2d52 <dirfile+0x172>
+  close(fd);
+    2c0f:	83 ec 0c             	sub    $0xc,%esp
+    2c12:	50                   	push   %eax
+    2c13:	e8 d4 19 00 00       	call   45ec <close>
+  if(chdir("dirfile") == 0){
+    2c18:	c7 04 24 ad 57 00 00 	movl   $0x57ad,(%esp)
+    2c1f:	e8 10 1a 00 00       	call   4634 <chdir>
+    2c24:	83 c4 10             	add    $0x10,%esp
+    2c27:	85 c0                	test   %eax,%eax
+    2c29:	0f 84 10 01 00 00    	je     2d3f <dirfile+0x15f>
+  fd = open("dirfile/xx", 0);
+    2c2f:	83 ec 08             	sub    $0x8,%esp
+    2c32:	6a 00                	push   $0x0
+    2c34:	68 e6 57 00 00       	push   $0x57e6
+    2c39:	e8 c6 19 00 00       	call   4604 <open>
+  if(fd >= 0){
+    2c3e:	83 c4 10             	add    $0x10,%esp
+    2c41:	85 c0                	test   %eax,%eax
+    2c43:	0f 89 e3 00 00 00    	jns    2d2c <dirfile+0x14c>
+  fd = open("dirfile/xx", O_CREATE);
+    2c49:	83 ec 08             	sub    $0x8,%esp
+    2c4c:	68 00 02 00 00       	push   $0x200
+    2c51:	68 e6 57 00 00       	push   $0x57e6
+    2c56:	e8 a9 19 00 00       	call   4604 <open>
+  if(fd >= 0){
+    2c5b:	83 c4 10             	add    $0x10,%esp
+    2c5e:	85 c0                	test   %eax,%eax
+    2c60:	0f 89 c6 00 00 00    	jns    2d2c <dirfile+0x14c>
+  if(mkdir("dirfile/xx") == 0){
+    2c66:	83 ec 0c             	sub    $0xc,%esp
+    2c69:	68 e6 57 00 00       	push   $0x57e6
+    2c6e:	e8 b9 19 00 00       	call   462c <mkdir>
+    2c73:	83 c4 10             	add    $0x10,%esp
+    2c76:	85 c0                	test   %eax,%eax
+    2c78:	0f 84 46 01 00 00    	je     2dc4 <dirfile+0x1e4>
+  if(unlink("dirfile/xx") == 0){
+    2c7e:	83 ec 0c             	sub    $0xc,%esp
+    2c81:	68 e6 57 00 00       	push   $0x57e6
+    2c86:	e8 89 19 00 00       	call   4614 <unlink>
+    2c8b:	83 c4 10             	add    $0x10,%esp
+    2c8e:	85 c0                	test   %eax,%eax
+    2c90:	0f 84 1b 01 00 00    	je     2db1 <dirfile+0x1d1>
+  if(link("README", "dirfile/xx") == 0){
+    2c96:	83 ec 08             	sub    $0x8,%esp
+    2c99:	68 e6 57 00 00       	push   $0x57e6
+    2c9e:	68 4a 58 00 00       	push   $0x584a
+    2ca3:	e8 7c 19 00 00       	call   4624 <link>
+    2ca8:	83 c4 10             	add    $0x10,%esp
+    2cab:	85 c0                	test   %eax,%eax
+    2cad:	0f 84 eb 00 00 00    	je     2d9e <dirfile+0x1be>
+  if(unlink("dirfile") != 0){
+    2cb3:	83 ec 0c             	sub    $0xc,%esp
+    2cb6:	68 ad 57 00 00       	push   $0x57ad
+    2cbb:	e8 54 19 00 00       	call   4614 <unlink>
+    2cc0:	83 c4 10             	add    $0x10,%esp
+    2cc3:	85 c0                	test   %eax,%eax
+    2cc5:	0f 85 c0 00 00 00    	jne    2d8b <dirfile+0x1ab>
+  fd = open(".", O_RDWR);
+    2ccb:	83 ec 08             	sub    $0x8,%esp
+    2cce:	6a 02                	push   $0x2
+    2cd0:	68 a6 53 00 00       	push   $0x53a6
+    2cd5:	e8 2a 19 00 00       	call   4604 <open>
+  if(fd >= 0){
+    2cda:	83 c4 10             	add    $0x10,%esp
+    2cdd:	85 c0                	test   %eax,%eax
+    2cdf:	0f 89 93 00 00 00    	jns    2d78 <dirfile+0x198>
+  fd = open(".", 0);
+    2ce5:	83 ec 08             	sub    $0x8,%esp
+    2ce8:	6a 00                	push   $0x0
+    2cea:	68 a6 53 00 00       	push   $0x53a6
+    2cef:	e8 10 19 00 00       	call   4604 <open>
+  if(write(fd, "x", 1) > 0){
+    2cf4:	83 c4 0c             	add    $0xc,%esp
+    2cf7:	6a 01                	push   $0x1
+  fd = open(".", 0);
+    2cf9:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    2cfb:	68 89 54 00 00       	push   $0x5489
+    2d00:	50                   	push   %eax
+    2d01:	e8 de 18 00 00       	call   45e4 <write>
+    2d06:	83 c4 10             	add    $0x10,%esp
+    2d09:	85 c0                	test   %eax,%eax
+    2d0b:	7f 58                	jg     2d65 <dirfile+0x185>
+  close(fd);
+    2d0d:	83 ec 0c             	sub    $0xc,%esp
+    2d10:	53                   	push   %ebx
+    2d11:	e8 d6 18 00 00       	call   45ec <close>
+  printf(1, "dir vs file OK\n");
+    2d16:	58                   	pop    %eax
+    2d17:	5a                   	pop    %edx
+    2d18:	68 7d 58 00 00       	push   $0x587d
+    2d1d:	6a 01                	push   $0x1
+    2d1f:	e8 6c 1a 00 00       	call   4790 <printf>
+}
+    2d24:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2d27:	83 c4 10             	add    $0x10,%esp
+    2d2a:	c9                   	leave
+    2d2b:	c3                   	ret
+    printf(1, "create dirfile/xx succeeded!\n");
+    2d2c:	50                   	push   %eax
+    2d2d:	50                   	push   %eax
+    2d2e:	68 f1 57 00 00       	push   $0x57f1
+    2d33:	6a 01                	push   $0x1
+    2d35:	e8 56 1a 00 00       	call   4790 <printf>
+    exit();
+    2d3a:	e8 85 18 00 00       	call   45c4 <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    2d3f:	52                   	push   %edx
+    2d40:	52                   	push   %edx
+    2d41:	68 cc 57 00 00       	push   $0x57cc
+    2d46:	6a 01                	push   $0x1
+    2d48:	e8 43 1a 00 00       	call   4790 <printf>
+    exit();
+    2d4d:	e8 72 18 00 00       	call   45c4 <exit>
+    printf(1, "create dirfile failed\n");
+    2d52:	51                   	push   %ecx
+    2d53:	51                   	push   %ecx
+    2d54:	68 b5 57 00 00       	push   $0x57b5
+    2d59:	6a 01                	push   $0x1
+    2d5b:	e8 30 1a 00 00       	call   4790 <printf>
+    exit();
+    2d60:	e8 5f 18 00 00       	call   45c4 <exit>
+    printf(1, "write . succeeded!\n");
+    2d65:	51                   	push   %ecx
+    2d66:	51                   	push   %ecx
+    2d67:	68 69 58 00 00       	push   $0x5869
+    2d6c:	6a 01                	push   $0x1
+    2d6e:	e8 1d 1a 00 00       	call   4790 <printf>
+    exit();
+    2d73:	e8 4c 18 00 00       	call   45c4 <exit>
+    printf(1, "open . for writing succeeded!\n");
+    2d78:	53                   	push   %ebx
+    2d79:	53                   	push   %ebx
+    2d7a:	68 fc 62 00 00       	push   $0x62fc
+    2d7f:	6a 01                	push   $0x1
+    2d81:	e8 0a 1a 00 00       	call   4790 <printf>
+    exit();
+    2d86:	e8 39 18 00 00       	call   45c4 <exit>
+    printf(1, "unlink dirfile failed!\n");
+    2d8b:	50                   	push   %eax
+    2d8c:	50                   	push   %eax
+    2d8d:	68 51 58 00 00       	push   $0x5851
+    2d92:	6a 01                	push   $0x1
+    2d94:	e8 f7 19 00 00       	call   4790 <printf>
+    exit();
+    2d99:	e8 26 18 00 00       	call   45c4 <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    2d9e:	50                   	push   %eax
+    2d9f:	50                   	push   %eax
+    2da0:	68 dc 62 00 00       	push   $0x62dc
+    2da5:	6a 01                	push   $0x1
+    2da7:	e8 e4 19 00 00       	call   4790 <printf>
+    exit();
+    2dac:	e8 13 18 00 00       	call   45c4 <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    2db1:	50                   	push   %eax
+    2db2:	50                   	push   %eax
+    2db3:	68 2c 58 00 00       	push   $0x582c
+    2db8:	6a 01                	push   $0x1
+    2dba:	e8 d1 19 00 00       	call   4790 <printf>
+    exit();
+    2dbf:	e8 00 18 00 00       	call   45c4 <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    2dc4:	50                   	push   %eax
+    2dc5:	50                   	push   %eax
+    2dc6:	68 0f 58 00 00       	push   $0x580f
+    2dcb:	6a 01                	push   $0x1
+    2dcd:	e8 be 19 00 00       	call   4790 <printf>
+    exit();
+    2dd2:	e8 ed 17 00 00       	call   45c4 <exit>
+    2dd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2dde:	66 90                	xchg   %ax,%ax
+
+00002de0 <iref>:
+{
+    2de0:	55                   	push   %ebp
+    2de1:	89 e5                	mov    %esp,%ebp
+    2de3:	53                   	push   %ebx
+  printf(1, "empty file name\n");
+    2de4:	bb 33 00 00 00       	mov    $0x33,%ebx
+{
+    2de9:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "empty file name\n");
+    2dec:	68 8d 58 00 00       	push   $0x588d
+    2df1:	6a 01                	push   $0x1
+    2df3:	e8 98 19 00 00       	call   4790 <printf>
+    2df8:	83 c4 10             	add    $0x10,%esp
+    2dfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2dff:	90                   	nop
+    if(mkdir("irefd") != 0){
+    2e00:	83 ec 0c             	sub    $0xc,%esp
+    2e03:	68 9e 58 00 00       	push   $0x589e
+    2e08:	e8 1f 18 00 00       	call   462c <mkdir>
+    2e0d:	83 c4 10             	add    $0x10,%esp
+    2e10:	85 c0                	test   %eax,%eax
+    2e12:	0f 85 bb 00 00 00    	jne    2ed3 <iref+0xf3>
+    if(chdir("irefd") != 0){
+    2e18:	83 ec 0c             	sub    $0xc,%esp
+    2e1b:	68 9e 58 00 00       	push   $0x589e
+    2e20:	e8 0f 18 00 00       	call   4634 <chdir>
+    2e25:	83 c4 10             	add    $0x10,%esp
+    2e28:	85 c0                	test   %eax,%eax
+    2e2a:	0f 85 b7 00 00 00    	jne    2ee7 <iref+0x107>
+    mkdir("");
+    2e30:	83 ec 0c             	sub    $0xc,%esp
+    2e33:	68 be 4e 00 00       	push   $0x4ebe
+    2e38:	e8 ef 17 00 00       	call   462c <mkdir>
+    link("README", "");
+    2e3d:	59                   	pop    %ecx
+    2e3e:	58                   	pop    %eax
+    2e3f:	68 be 4e 00 00       	push   $0x4ebe
+    2e44:	68 4a 58 00 00       	push   $0x584a
+    2e49:	e8 d6 17 00 00       	call   4624 <link>
+    fd = open("", O_CREATE);
+    2e4e:	58                   	pop    %eax
+    2e4f:	5a                   	pop    %edx
+    2e50:	68 00 02 00 00       	push   $0x200
+    2e55:	68 be 4e 00 00       	push   $0x4ebe
+    2e5a:	e8 a5 17 00 00       	call   4604 <open>
+    if(fd >= 0)
+    2e5f:	83 c4 10             	add    $0x10,%esp
+    2e62:	85 c0                	test   %eax,%eax
+    2e64:	78 0c                	js     2e72 <iref+0x92>
+      close(fd);
+    2e66:	83 ec 0c             	sub    $0xc,%esp
+    2e69:	50                   	push   %eax
+    2e6a:	e8 7d 17 00 00       	call   45ec <close>
+    2e6f:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    2e72:	83 ec 08             	sub    $0x8,%esp
+    2e75:	68 00 02 00 00       	push   $0x200
+    2e7a:	68 88 54 00 00       	push   $0x5488
+    2e7f:	e8 80 17 00 00       	call   4604 <open>
+    if(fd >= 0)
+    2e84:	83 c4 10             	add    $0x10,%esp
+    2e87:	85 c0                	test   %eax,%eax
+    2e89:	78 0c                	js     2e97 <iref+0xb7>
+      close(fd);
+    2e8b:	83 ec 0c             	sub    $0xc,%esp
+    2e8e:	50                   	push   %eax
+    2e8f:	e8 58 17 00 00       	call   45ec <close>
+    2e94:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    2e97:	83 ec 0c             	sub    $0xc,%esp
+    2e9a:	68 88 54 00 00       	push   $0x5488
+    2e9f:	e8 70 17 00 00       	call   4614 <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    2ea4:	83 c4 10             	add    $0x10,%esp
+    2ea7:	83 eb 01             	sub    $0x1,%ebx
+    2eaa:	0f 85 50 ff ff ff    	jne    2e00 <iref+0x20>
+  chdir("/");
+    2eb0:	83 ec 0c             	sub    $0xc,%esp
+    2eb3:	68 f3 4a 00 00       	push   $0x4af3
+    2eb8:	e8 77 17 00 00       	call   4634 <chdir>
+  printf(1, "empty file name OK\n");
+    2ebd:	58                   	pop    %eax
+    2ebe:	5a                   	pop    %edx
+    2ebf:	68 cc 58 00 00       	push   $0x58cc
+    2ec4:	6a 01                	push   $0x1
+    2ec6:	e8 c5 18 00 00       	call   4790 <printf>
+}
+    2ecb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2ece:	83 c4 10             	add    $0x10,%esp
+    2ed1:	c9                   	leave
+    2ed2:	c3                   	ret
+      printf(1, "mkdir irefd failed\n");
+    2ed3:	83 ec 08             	sub    $0x8,%esp
+    2ed6:	68 a4 58 00 00       	push   $0x58a4
+    2edb:	6a 01                	push   $0x1
+    2edd:	e8 ae 18 00 00       	call   4790 <printf>
+      exit();
+    2ee2:	e8 dd 16 00 00       	call   45c4 <exit>
+      printf(1, "chdir irefd failed\n");
+    2ee7:	83 ec 08             	sub    $0x8,%esp
+    2eea:	68 b8 58 00 00       	push   $0x58b8
+    2eef:	6a 01                	push   $0x1
+    2ef1:	e8 9a 18 00 00       	call   4790 <printf>
+      exit();
+    2ef6:	e8 c9 16 00 00       	call   45c4 <exit>
+    2efb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2eff:	90                   	nop
+
+00002f00 <forktest>:
+{
+    2f00:	55                   	push   %ebp
+    2f01:	89 e5                	mov    %esp,%ebp
+    2f03:	53                   	push   %ebx
+  for(n=0; n<1000; n++){
+    2f04:	31 db                	xor    %ebx,%ebx
+{
+    2f06:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "fork test\n");
+    2f09:	68 e0 58 00 00       	push   $0x58e0
+    2f0e:	6a 01                	push   $0x1
+    2f10:	e8 7b 18 00 00       	call   4790 <printf>
+    2f15:	83 c4 10             	add    $0x10,%esp
+    2f18:	eb 13                	jmp    2f2d <forktest+0x2d>
+    2f1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(pid == 0)
+    2f20:	74 4d                	je     2f6f <forktest+0x6f>
+  for(n=0; n<1000; n++){
+    2f22:	83 c3 01             	add    $0x1,%ebx
+    2f25:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    2f2b:	74 6e                	je     2f9b <forktest+0x9b>
+    pid = fork();
+    2f2d:	e8 8a 16 00 00       	call   45bc <fork>
+    if(pid < 0)
+    2f32:	85 c0                	test   %eax,%eax
+    2f34:	79 ea                	jns    2f20 <forktest+0x20>
+  for(; n > 0; n--){
+    2f36:	85 db                	test   %ebx,%ebx
+    2f38:	74 14                	je     2f4e <forktest+0x4e>
+    2f3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(wait() < 0){
+    2f40:	e8 87 16 00 00       	call   45cc <wait>
+    2f45:	85 c0                	test   %eax,%eax
+    2f47:	78 2b                	js     2f74 <forktest+0x74>
+  for(; n > 0; n--){
+    2f49:	83 eb 01             	sub    $0x1,%ebx
+    2f4c:	75 f2                	jne    2f40 <forktest+0x40>
+  if(wait() != -1){
+    2f4e:	e8 79 16 00 00       	call   45cc <wait>
+    2f53:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2f56:	75 30                	jne    2f88 <forktest+0x88>
+  printf(1, "fork test OK\n");
+    2f58:	83 ec 08             	sub    $0x8,%esp
+    2f5b:	68 12 59 00 00       	push   $0x5912
+    2f60:	6a 01                	push   $0x1
+    2f62:	e8 29 18 00 00       	call   4790 <printf>
+}
+    2f67:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2f6a:	83 c4 10             	add    $0x10,%esp
+    2f6d:	c9                   	leave
+    2f6e:	c3                   	ret
+      exit();
+    2f6f:	e8 50 16 00 00       	call   45c4 <exit>
+      printf(1, "wait stopped early\n");
+    2f74:	83 ec 08             	sub    $0x8,%esp
+    2f77:	68 eb 58 00 00       	push   $0x58eb
+    2f7c:	6a 01                	push   $0x1
+    2f7e:	e8 0d 18 00 00       	call   4790 <printf>
+      exit();
+    2f83:	e8 3c 16 00 00       	call   45c4 <exit>
+    printf(1, "wait got too many\n");
+    2f88:	50                   	push   %eax
+    2f89:	50                   	push   %eax
+    2f8a:	68 ff 58 00 00       	push   $0x58ff
+    2f8f:	6a 01                	push   $0x1
+    2f91:	e8 fa 17 00 00       	call   4790 <printf>
+    exit();
+    2f96:	e8 29 16 00 00       	call   45c4 <exit>
+    printf(1, "fork claimed to work 1000 times!\n");
+    2f9b:	52                   	push   %edx
+    2f9c:	52                   	push   %edx
+    2f9d:	68 1c 63 00 00       	push   $0x631c
+    2fa2:	6a 01                	push   $0x1
+    2fa4:	e8 e7 17 00 00       	call   4790 <printf>
+    exit();
+    2fa9:	e8 16 16 00 00       	call   45c4 <exit>
+    2fae:	66 90                	xchg   %ax,%ax
+
+00002fb0 <sbrktest>:
+{
+    2fb0:	55                   	push   %ebp
+    2fb1:	89 e5                	mov    %esp,%ebp
+    2fb3:	57                   	push   %edi
+    2fb4:	56                   	push   %esi
+  for(i = 0; i < 5000; i++){
+    2fb5:	31 f6                	xor    %esi,%esi
+{
+    2fb7:	53                   	push   %ebx
+    2fb8:	83 ec 64             	sub    $0x64,%esp
+  printf(stdout, "sbrk test\n");
+    2fbb:	68 d0 59 00 00       	push   $0x59d0
+    2fc0:	ff 35 c0 71 00 00    	push   0x71c0
+    2fc6:	e8 c5 17 00 00       	call   4790 <printf>
+  oldbrk = sbrk(0);
+    2fcb:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2fd2:	e8 75 16 00 00       	call   464c <sbrk>
+    2fd7:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  a = sbrk(0);
+    2fda:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2fe1:	e8 66 16 00 00       	call   464c <sbrk>
+    2fe6:	83 c4 10             	add    $0x10,%esp
+    2fe9:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 5000; i++){
+    2feb:	eb 05                	jmp    2ff2 <sbrktest+0x42>
+    2fed:	8d 76 00             	lea    0x0(%esi),%esi
+    a = b + 1;
+    2ff0:	89 c3                	mov    %eax,%ebx
+    b = sbrk(1);
+    2ff2:	83 ec 0c             	sub    $0xc,%esp
+    2ff5:	6a 01                	push   $0x1
+    2ff7:	e8 50 16 00 00       	call   464c <sbrk>
+    if(b != a){
+    2ffc:	83 c4 10             	add    $0x10,%esp
+    2fff:	39 d8                	cmp    %ebx,%eax
+    3001:	0f 85 9c 02 00 00    	jne    32a3 <sbrktest+0x2f3>
+  for(i = 0; i < 5000; i++){
+    3007:	83 c6 01             	add    $0x1,%esi
+    *b = 1;
+    300a:	c6 03 01             	movb   $0x1,(%ebx)
+    a = b + 1;
+    300d:	8d 43 01             	lea    0x1(%ebx),%eax
+  for(i = 0; i < 5000; i++){
+    3010:	81 fe 88 13 00 00    	cmp    $0x1388,%esi
+    3016:	75 d8                	jne    2ff0 <sbrktest+0x40>
+  pid = fork();
+    3018:	e8 9f 15 00 00       	call   45bc <fork>
+    301d:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    301f:	85 c0                	test   %eax,%eax
+    3021:	0f 88 02 03 00 00    	js     3329 <sbrktest+0x379>
+  c = sbrk(1);
+    3027:	83 ec 0c             	sub    $0xc,%esp
+  if(c != a + 1){
+    302a:	83 c3 02             	add    $0x2,%ebx
+  c = sbrk(1);
+    302d:	6a 01                	push   $0x1
+    302f:	e8 18 16 00 00       	call   464c <sbrk>
+  c = sbrk(1);
+    3034:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    303b:	e8 0c 16 00 00       	call   464c <sbrk>
+  if(c != a + 1){
+    3040:	83 c4 10             	add    $0x10,%esp
+    3043:	39 c3                	cmp    %eax,%ebx
+    3045:	0f 85 3b 03 00 00    	jne    3386 <sbrktest+0x3d6>
+  if(pid == 0)
+    304b:	85 f6                	test   %esi,%esi
+    304d:	0f 84 2e 03 00 00    	je     3381 <sbrktest+0x3d1>
+  wait();
+    3053:	e8 74 15 00 00       	call   45cc <wait>
+  a = sbrk(0);
+    3058:	83 ec 0c             	sub    $0xc,%esp
+    305b:	6a 00                	push   $0x0
+    305d:	e8 ea 15 00 00       	call   464c <sbrk>
+    3062:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    3064:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3069:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    306b:	89 04 24             	mov    %eax,(%esp)
+    306e:	e8 d9 15 00 00       	call   464c <sbrk>
+  if (p != a) {
+    3073:	83 c4 10             	add    $0x10,%esp
+    3076:	39 c3                	cmp    %eax,%ebx
+    3078:	0f 85 94 02 00 00    	jne    3312 <sbrktest+0x362>
+  a = sbrk(0);
+    307e:	83 ec 0c             	sub    $0xc,%esp
+  *lastaddr = 99;
+    3081:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+  a = sbrk(0);
+    3088:	6a 00                	push   $0x0
+    308a:	e8 bd 15 00 00       	call   464c <sbrk>
+  c = sbrk(-4096);
+    308f:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+  a = sbrk(0);
+    3096:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    3098:	e8 af 15 00 00       	call   464c <sbrk>
+  if(c == (char*)0xffffffff){
+    309d:	83 c4 10             	add    $0x10,%esp
+    30a0:	83 f8 ff             	cmp    $0xffffffff,%eax
+    30a3:	0f 84 22 03 00 00    	je     33cb <sbrktest+0x41b>
+  c = sbrk(0);
+    30a9:	83 ec 0c             	sub    $0xc,%esp
+    30ac:	6a 00                	push   $0x0
+    30ae:	e8 99 15 00 00       	call   464c <sbrk>
+  if(c != a - 4096){
+    30b3:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    30b9:	83 c4 10             	add    $0x10,%esp
+    30bc:	39 d0                	cmp    %edx,%eax
+    30be:	0f 85 f0 02 00 00    	jne    33b4 <sbrktest+0x404>
+  a = sbrk(0);
+    30c4:	83 ec 0c             	sub    $0xc,%esp
+    30c7:	6a 00                	push   $0x0
+    30c9:	e8 7e 15 00 00       	call   464c <sbrk>
+  c = sbrk(4096);
+    30ce:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  a = sbrk(0);
+    30d5:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    30d7:	e8 70 15 00 00       	call   464c <sbrk>
+  if(c != a || sbrk(0) != a + 4096){
+    30dc:	83 c4 10             	add    $0x10,%esp
+  c = sbrk(4096);
+    30df:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    30e1:	39 c3                	cmp    %eax,%ebx
+    30e3:	0f 85 b4 02 00 00    	jne    339d <sbrktest+0x3ed>
+    30e9:	83 ec 0c             	sub    $0xc,%esp
+    30ec:	6a 00                	push   $0x0
+    30ee:	e8 59 15 00 00       	call   464c <sbrk>
+    30f3:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    30f9:	83 c4 10             	add    $0x10,%esp
+    30fc:	39 c2                	cmp    %eax,%edx
+    30fe:	0f 85 99 02 00 00    	jne    339d <sbrktest+0x3ed>
+  if(*lastaddr == 99){
+    3104:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    310b:	0f 84 2f 02 00 00    	je     3340 <sbrktest+0x390>
+  a = sbrk(0);
+    3111:	83 ec 0c             	sub    $0xc,%esp
+    3114:	6a 00                	push   $0x0
+    3116:	e8 31 15 00 00       	call   464c <sbrk>
+  c = sbrk(-(sbrk(0) - oldbrk));
+    311b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  a = sbrk(0);
+    3122:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    3124:	e8 23 15 00 00       	call   464c <sbrk>
+    3129:	89 c2                	mov    %eax,%edx
+    312b:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    312e:	29 d0                	sub    %edx,%eax
+    3130:	89 04 24             	mov    %eax,(%esp)
+    3133:	e8 14 15 00 00       	call   464c <sbrk>
+  if(c != a){
+    3138:	83 c4 10             	add    $0x10,%esp
+    313b:	39 c3                	cmp    %eax,%ebx
+    313d:	0f 85 b8 01 00 00    	jne    32fb <sbrktest+0x34b>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    3143:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    3148:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    314f:	90                   	nop
+    ppid = getpid();
+    3150:	e8 ef 14 00 00       	call   4644 <getpid>
+    3155:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    3157:	e8 60 14 00 00       	call   45bc <fork>
+    if(pid < 0){
+    315c:	85 c0                	test   %eax,%eax
+    315e:	0f 88 5d 01 00 00    	js     32c1 <sbrktest+0x311>
+    if(pid == 0){
+    3164:	0f 84 6f 01 00 00    	je     32d9 <sbrktest+0x329>
+    wait();
+    316a:	e8 5d 14 00 00       	call   45cc <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    316f:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    3175:	81 fb 80 84 1e 80    	cmp    $0x801e8480,%ebx
+    317b:	75 d3                	jne    3150 <sbrktest+0x1a0>
+  if(pipe(fds) != 0){
+    317d:	83 ec 0c             	sub    $0xc,%esp
+    3180:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    3183:	50                   	push   %eax
+    3184:	e8 4b 14 00 00       	call   45d4 <pipe>
+    3189:	83 c4 10             	add    $0x10,%esp
+    318c:	85 c0                	test   %eax,%eax
+    318e:	0f 85 da 01 00 00    	jne    336e <sbrktest+0x3be>
+    3194:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+    3197:	8d 75 e8             	lea    -0x18(%ebp),%esi
+    319a:	89 df                	mov    %ebx,%edi
+    319c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((pids[i] = fork()) == 0){
+    31a0:	e8 17 14 00 00       	call   45bc <fork>
+    31a5:	89 07                	mov    %eax,(%edi)
+    31a7:	85 c0                	test   %eax,%eax
+    31a9:	0f 84 91 00 00 00    	je     3240 <sbrktest+0x290>
+    if(pids[i] != -1)
+    31af:	83 f8 ff             	cmp    $0xffffffff,%eax
+    31b2:	74 14                	je     31c8 <sbrktest+0x218>
+      read(fds[0], &scratch, 1);
+    31b4:	83 ec 04             	sub    $0x4,%esp
+    31b7:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    31ba:	6a 01                	push   $0x1
+    31bc:	50                   	push   %eax
+    31bd:	ff 75 b8             	push   -0x48(%ebp)
+    31c0:	e8 17 14 00 00       	call   45dc <read>
+    31c5:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    31c8:	83 c7 04             	add    $0x4,%edi
+    31cb:	39 f7                	cmp    %esi,%edi
+    31cd:	75 d1                	jne    31a0 <sbrktest+0x1f0>
+  c = sbrk(4096);
+    31cf:	83 ec 0c             	sub    $0xc,%esp
+    31d2:	68 00 10 00 00       	push   $0x1000
+    31d7:	e8 70 14 00 00       	call   464c <sbrk>
+    31dc:	83 c4 10             	add    $0x10,%esp
+    31df:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    31e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(pids[i] == -1)
+    31e8:	8b 03                	mov    (%ebx),%eax
+    31ea:	83 f8 ff             	cmp    $0xffffffff,%eax
+    31ed:	74 11                	je     3200 <sbrktest+0x250>
+    kill(pids[i]);
+    31ef:	83 ec 0c             	sub    $0xc,%esp
+    31f2:	50                   	push   %eax
+    31f3:	e8 fc 13 00 00       	call   45f4 <kill>
+    wait();
+    31f8:	e8 cf 13 00 00       	call   45cc <wait>
+    31fd:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3200:	83 c3 04             	add    $0x4,%ebx
+    3203:	39 f3                	cmp    %esi,%ebx
+    3205:	75 e1                	jne    31e8 <sbrktest+0x238>
+  if(c == (char*)0xffffffff){
+    3207:	83 ff ff             	cmp    $0xffffffff,%edi
+    320a:	0f 84 47 01 00 00    	je     3357 <sbrktest+0x3a7>
+  if(sbrk(0) > oldbrk)
+    3210:	83 ec 0c             	sub    $0xc,%esp
+    3213:	6a 00                	push   $0x0
+    3215:	e8 32 14 00 00       	call   464c <sbrk>
+    321a:	83 c4 10             	add    $0x10,%esp
+    321d:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+    3220:	72 60                	jb     3282 <sbrktest+0x2d2>
+  printf(stdout, "sbrk test OK\n");
+    3222:	83 ec 08             	sub    $0x8,%esp
+    3225:	68 bd 59 00 00       	push   $0x59bd
+    322a:	ff 35 c0 71 00 00    	push   0x71c0
+    3230:	e8 5b 15 00 00       	call   4790 <printf>
+}
+    3235:	83 c4 10             	add    $0x10,%esp
+    3238:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    323b:	5b                   	pop    %ebx
+    323c:	5e                   	pop    %esi
+    323d:	5f                   	pop    %edi
+    323e:	5d                   	pop    %ebp
+    323f:	c3                   	ret
+      sbrk(BIG - (uint)sbrk(0));
+    3240:	83 ec 0c             	sub    $0xc,%esp
+    3243:	6a 00                	push   $0x0
+    3245:	e8 02 14 00 00       	call   464c <sbrk>
+    324a:	89 c2                	mov    %eax,%edx
+    324c:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3251:	29 d0                	sub    %edx,%eax
+    3253:	89 04 24             	mov    %eax,(%esp)
+    3256:	e8 f1 13 00 00       	call   464c <sbrk>
+      write(fds[1], "x", 1);
+    325b:	83 c4 0c             	add    $0xc,%esp
+    325e:	6a 01                	push   $0x1
+    3260:	68 89 54 00 00       	push   $0x5489
+    3265:	ff 75 bc             	push   -0x44(%ebp)
+    3268:	e8 77 13 00 00       	call   45e4 <write>
+    326d:	83 c4 10             	add    $0x10,%esp
+      for(;;) sleep(1000);
+    3270:	83 ec 0c             	sub    $0xc,%esp
+    3273:	68 e8 03 00 00       	push   $0x3e8
+    3278:	e8 d7 13 00 00       	call   4654 <sleep>
+    327d:	83 c4 10             	add    $0x10,%esp
+    3280:	eb ee                	jmp    3270 <sbrktest+0x2c0>
+    sbrk(-(sbrk(0) - oldbrk));
+    3282:	83 ec 0c             	sub    $0xc,%esp
+    3285:	6a 00                	push   $0x0
+    3287:	e8 c0 13 00 00       	call   464c <sbrk>
+    328c:	89 c2                	mov    %eax,%edx
+    328e:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    3291:	29 d0                	sub    %edx,%eax
+    3293:	89 04 24             	mov    %eax,(%esp)
+    3296:	e8 b1 13 00 00       	call   464c <sbrk>
+    329b:	83 c4 10             	add    $0x10,%esp
+    329e:	e9 7f ff ff ff       	jmp    3222 <sbrktest+0x272>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    32a3:	83 ec 0c             	sub    $0xc,%esp
+    32a6:	50                   	push   %eax
+    32a7:	53                   	push   %ebx
+    32a8:	56                   	push   %esi
+    32a9:	68 20 59 00 00       	push   $0x5920
+    32ae:	ff 35 c0 71 00 00    	push   0x71c0
+    32b4:	e8 d7 14 00 00       	call   4790 <printf>
+      exit();
+    32b9:	83 c4 20             	add    $0x20,%esp
+    32bc:	e8 03 13 00 00       	call   45c4 <exit>
+      printf(stdout, "fork failed\n");
+    32c1:	83 ec 08             	sub    $0x8,%esp
+    32c4:	68 f9 5c 00 00       	push   $0x5cf9
+    32c9:	ff 35 c0 71 00 00    	push   0x71c0
+    32cf:	e8 bc 14 00 00       	call   4790 <printf>
+      exit();
+    32d4:	e8 eb 12 00 00       	call   45c4 <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    32d9:	0f be 03             	movsbl (%ebx),%eax
+    32dc:	50                   	push   %eax
+    32dd:	53                   	push   %ebx
+    32de:	68 89 59 00 00       	push   $0x5989
+    32e3:	ff 35 c0 71 00 00    	push   0x71c0
+    32e9:	e8 a2 14 00 00       	call   4790 <printf>
+      kill(ppid);
+    32ee:	89 34 24             	mov    %esi,(%esp)
+    32f1:	e8 fe 12 00 00       	call   45f4 <kill>
+      exit();
+    32f6:	e8 c9 12 00 00       	call   45c4 <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    32fb:	50                   	push   %eax
+    32fc:	53                   	push   %ebx
+    32fd:	68 10 64 00 00       	push   $0x6410
+    3302:	ff 35 c0 71 00 00    	push   0x71c0
+    3308:	e8 83 14 00 00       	call   4790 <printf>
+    exit();
+    330d:	e8 b2 12 00 00       	call   45c4 <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    3312:	56                   	push   %esi
+    3313:	56                   	push   %esi
+    3314:	68 40 63 00 00       	push   $0x6340
+    3319:	ff 35 c0 71 00 00    	push   0x71c0
+    331f:	e8 6c 14 00 00       	call   4790 <printf>
+    exit();
+    3324:	e8 9b 12 00 00       	call   45c4 <exit>
+    printf(stdout, "sbrk test fork failed\n");
+    3329:	50                   	push   %eax
+    332a:	50                   	push   %eax
+    332b:	68 3b 59 00 00       	push   $0x593b
+    3330:	ff 35 c0 71 00 00    	push   0x71c0
+    3336:	e8 55 14 00 00       	call   4790 <printf>
+    exit();
+    333b:	e8 84 12 00 00       	call   45c4 <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    3340:	51                   	push   %ecx
+    3341:	51                   	push   %ecx
+    3342:	68 e0 63 00 00       	push   $0x63e0
+    3347:	ff 35 c0 71 00 00    	push   0x71c0
+    334d:	e8 3e 14 00 00       	call   4790 <printf>
+    exit();
+    3352:	e8 6d 12 00 00       	call   45c4 <exit>
+    printf(stdout, "failed sbrk leaked memory\n");
+    3357:	50                   	push   %eax
+    3358:	50                   	push   %eax
+    3359:	68 a2 59 00 00       	push   $0x59a2
+    335e:	ff 35 c0 71 00 00    	push   0x71c0
+    3364:	e8 27 14 00 00       	call   4790 <printf>
+    exit();
+    3369:	e8 56 12 00 00       	call   45c4 <exit>
+    printf(1, "pipe() failed\n");
+    336e:	52                   	push   %edx
+    336f:	52                   	push   %edx
+    3370:	68 d4 4d 00 00       	push   $0x4dd4
+    3375:	6a 01                	push   $0x1
+    3377:	e8 14 14 00 00       	call   4790 <printf>
+    exit();
+    337c:	e8 43 12 00 00       	call   45c4 <exit>
+    exit();
+    3381:	e8 3e 12 00 00       	call   45c4 <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    3386:	57                   	push   %edi
+    3387:	57                   	push   %edi
+    3388:	68 52 59 00 00       	push   $0x5952
+    338d:	ff 35 c0 71 00 00    	push   0x71c0
+    3393:	e8 f8 13 00 00       	call   4790 <printf>
+    exit();
+    3398:	e8 27 12 00 00       	call   45c4 <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    339d:	56                   	push   %esi
+    339e:	53                   	push   %ebx
+    339f:	68 b8 63 00 00       	push   $0x63b8
+    33a4:	ff 35 c0 71 00 00    	push   0x71c0
+    33aa:	e8 e1 13 00 00       	call   4790 <printf>
+    exit();
+    33af:	e8 10 12 00 00       	call   45c4 <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    33b4:	50                   	push   %eax
+    33b5:	53                   	push   %ebx
+    33b6:	68 80 63 00 00       	push   $0x6380
+    33bb:	ff 35 c0 71 00 00    	push   0x71c0
+    33c1:	e8 ca 13 00 00       	call   4790 <printf>
+    exit();
+    33c6:	e8 f9 11 00 00       	call   45c4 <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    33cb:	53                   	push   %ebx
+    33cc:	53                   	push   %ebx
+    33cd:	68 6e 59 00 00       	push   $0x596e
+    33d2:	ff 35 c0 71 00 00    	push   0x71c0
+    33d8:	e8 b3 13 00 00       	call   4790 <printf>
+    exit();
+    33dd:	e8 e2 11 00 00       	call   45c4 <exit>
+    33e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    33e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000033f0 <lazysbrktest>:
+{
+    33f0:	55                   	push   %ebp
+    33f1:	89 e5                	mov    %esp,%ebp
+    33f3:	57                   	push   %edi
+    33f4:	56                   	push   %esi
+    33f5:	53                   	push   %ebx
+    33f6:	83 ec 14             	sub    $0x14,%esp
+  printf(stdout, "lazy sbrk test\n");
+    33f9:	68 cb 59 00 00       	push   $0x59cb
+    33fe:	ff 35 c0 71 00 00    	push   0x71c0
+    3404:	e8 87 13 00 00       	call   4790 <printf>
+  oldbrk = sbrk(0);
+    3409:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3410:	e8 37 12 00 00       	call   464c <sbrk>
+  a = sbrk(amt);
+    3415:	c7 04 24 00 00 00 04 	movl   $0x4000000,(%esp)
+  oldbrk = sbrk(0);
+    341c:	89 c3                	mov    %eax,%ebx
+  a = sbrk(amt);
+    341e:	e8 29 12 00 00       	call   464c <sbrk>
+  if(a == (char*)0xffffffff){
+    3423:	83 c4 10             	add    $0x10,%esp
+    3426:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3429:	0f 84 27 01 00 00    	je     3556 <lazysbrktest+0x166>
+    342f:	89 c6                	mov    %eax,%esi
+  for(p = a; p < a + amt; p += 4*1024*1024)
+    3431:	8d 90 00 00 00 04    	lea    0x4000000(%eax),%edx
+    3437:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    343e:	66 90                	xchg   %ax,%ax
+    *p = 'x';
+    3440:	c6 00 78             	movb   $0x78,(%eax)
+  for(p = a; p < a + amt; p += 4*1024*1024)
+    3443:	05 00 00 40 00       	add    $0x400000,%eax
+    3448:	39 d0                	cmp    %edx,%eax
+    344a:	75 f4                	jne    3440 <lazysbrktest+0x50>
+  if(a[4096] != 0 || a[amt-1] != 0){
+    344c:	80 be 00 10 00 00 00 	cmpb   $0x0,0x1000(%esi)
+    3453:	0f 85 42 01 00 00    	jne    359b <lazysbrktest+0x1ab>
+    3459:	80 be ff ff ff 03 00 	cmpb   $0x0,0x3ffffff(%esi)
+    3460:	0f 85 35 01 00 00    	jne    359b <lazysbrktest+0x1ab>
+  fd = open("README", 0);
+    3466:	83 ec 08             	sub    $0x8,%esp
+    3469:	6a 00                	push   $0x0
+    346b:	68 4a 58 00 00       	push   $0x584a
+    3470:	e8 8f 11 00 00       	call   4604 <open>
+  if(fd < 0 || read(fd, a + amt - 4096, 100) != 100){
+    3475:	83 c4 10             	add    $0x10,%esp
+  fd = open("README", 0);
+    3478:	89 c7                	mov    %eax,%edi
+  if(fd < 0 || read(fd, a + amt - 4096, 100) != 100){
+    347a:	85 c0                	test   %eax,%eax
+    347c:	0f 88 02 01 00 00    	js     3584 <lazysbrktest+0x194>
+    3482:	83 ec 04             	sub    $0x4,%esp
+    3485:	8d 86 00 f0 ff 03    	lea    0x3fff000(%esi),%eax
+    348b:	6a 64                	push   $0x64
+    348d:	50                   	push   %eax
+    348e:	57                   	push   %edi
+    348f:	e8 48 11 00 00       	call   45dc <read>
+    3494:	83 c4 10             	add    $0x10,%esp
+    3497:	83 f8 64             	cmp    $0x64,%eax
+    349a:	0f 85 e4 00 00 00    	jne    3584 <lazysbrktest+0x194>
+  close(fd);
+    34a0:	83 ec 0c             	sub    $0xc,%esp
+    34a3:	57                   	push   %edi
+    34a4:	e8 43 11 00 00       	call   45ec <close>
+  pid = fork();
+    34a9:	e8 0e 11 00 00       	call   45bc <fork>
+  if(pid < 0){
+    34ae:	83 c4 10             	add    $0x10,%esp
+    34b1:	85 c0                	test   %eax,%eax
+    34b3:	0f 88 b4 00 00 00    	js     356d <lazysbrktest+0x17d>
+  if(pid == 0){
+    34b9:	75 45                	jne    3500 <lazysbrktest+0x110>
+    if(a[0] != 'x' || a[4*1024*1024] != 'x' || a[8192] != 0){
+    34bb:	80 3e 78             	cmpb   $0x78,(%esi)
+    34be:	75 12                	jne    34d2 <lazysbrktest+0xe2>
+    34c0:	80 be 00 00 40 00 78 	cmpb   $0x78,0x400000(%esi)
+    34c7:	75 09                	jne    34d2 <lazysbrktest+0xe2>
+    34c9:	80 be 00 20 00 00 00 	cmpb   $0x0,0x2000(%esi)
+    34d0:	74 1e                	je     34f0 <lazysbrktest+0x100>
+      printf(stdout, "lazy sbrk child sees wrong data\n");
+    34d2:	83 ec 08             	sub    $0x8,%esp
+    34d5:	68 60 64 00 00       	push   $0x6460
+    34da:	ff 35 c0 71 00 00    	push   0x71c0
+    34e0:	e8 ab 12 00 00       	call   4790 <printf>
+      exit();
+    34e5:	e8 da 10 00 00       	call   45c4 <exit>
+    34ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    a[8192] = 'y';
+    34f0:	c6 86 00 20 00 00 79 	movb   $0x79,0x2000(%esi)
+    exit();
+    34f7:	e8 c8 10 00 00       	call   45c4 <exit>
+    34fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  wait();
+    3500:	e8 c7 10 00 00       	call   45cc <wait>
+  if(a[8192] != 0){
+    3505:	80 be 00 20 00 00 00 	cmpb   $0x0,0x2000(%esi)
+    350c:	75 31                	jne    353f <lazysbrktest+0x14f>
+  sbrk(-(sbrk(0) - oldbrk));
+    350e:	83 ec 0c             	sub    $0xc,%esp
+    3511:	6a 00                	push   $0x0
+    3513:	e8 34 11 00 00       	call   464c <sbrk>
+    3518:	29 c3                	sub    %eax,%ebx
+    351a:	89 1c 24             	mov    %ebx,(%esp)
+    351d:	e8 2a 11 00 00       	call   464c <sbrk>
+  printf(stdout, "lazy sbrk ok\n");
+    3522:	58                   	pop    %eax
+    3523:	5a                   	pop    %edx
+    3524:	68 28 5a 00 00       	push   $0x5a28
+    3529:	ff 35 c0 71 00 00    	push   0x71c0
+    352f:	e8 5c 12 00 00       	call   4790 <printf>
+}
+    3534:	83 c4 10             	add    $0x10,%esp
+    3537:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    353a:	5b                   	pop    %ebx
+    353b:	5e                   	pop    %esi
+    353c:	5f                   	pop    %edi
+    353d:	5d                   	pop    %ebp
+    353e:	c3                   	ret
+    printf(stdout, "lazy sbrk child write leaked to parent\n");
+    353f:	51                   	push   %ecx
+    3540:	51                   	push   %ecx
+    3541:	68 84 64 00 00       	push   $0x6484
+    3546:	ff 35 c0 71 00 00    	push   0x71c0
+    354c:	e8 3f 12 00 00       	call   4790 <printf>
+    exit();
+    3551:	e8 6e 10 00 00       	call   45c4 <exit>
+    printf(stdout, "lazy sbrk failed to reserve\n");
+    3556:	50                   	push   %eax
+    3557:	50                   	push   %eax
+    3558:	68 db 59 00 00       	push   $0x59db
+    355d:	ff 35 c0 71 00 00    	push   0x71c0
+    3563:	e8 28 12 00 00       	call   4790 <printf>
+    exit();
+    3568:	e8 57 10 00 00       	call   45c4 <exit>
+    printf(stdout, "lazy sbrk fork failed\n");
+    356d:	53                   	push   %ebx
+    356e:	53                   	push   %ebx
+    356f:	68 11 5a 00 00       	push   $0x5a11
+    3574:	ff 35 c0 71 00 00    	push   0x71c0
+    357a:	e8 11 12 00 00       	call   4790 <printf>
+    exit();
+    357f:	e8 40 10 00 00       	call   45c4 <exit>
+    printf(stdout, "lazy sbrk read into untouched page failed\n");
+    3584:	56                   	push   %esi
+    3585:	56                   	push   %esi
+    3586:	68 34 64 00 00       	push   $0x6434
+    358b:	ff 35 c0 71 00 00    	push   0x71c0
+    3591:	e8 fa 11 00 00       	call   4790 <printf>
+    exit();
+    3596:	e8 29 10 00 00       	call   45c4 <exit>
+    printf(stdout, "lazy sbrk page not zero\n");
+    359b:	57                   	push   %edi
+    359c:	57                   	push   %edi
+    359d:	68 f8 59 00 00       	push   $0x59f8
+    35a2:	ff 35 c0 71 00 00    	push   0x71c0
+    35a8:	e8 e3 11 00 00       	call   4790 <printf>
+    exit();
+    35ad:	e8 12 10 00 00       	call   45c4 <exit>
+    35b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    35b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000035c0 <cowdatatest>:
+{
+    35c0:	55                   	push   %ebp
+    35c1:	89 e5                	mov    %esp,%ebp
+    35c3:	53                   	push   %ebx
+    35c4:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "cow data test\n");
+    35c7:	68 36 5a 00 00       	push   $0x5a36
+    35cc:	ff 35 c0 71 00 00    	push   0x71c0
+    35d2:	e8 b9 11 00 00       	call   4790 <printf>
+  pid = fork();
+    35d7:	e8 e0 0f 00 00       	call   45bc <fork>
+  if(pid < 0){
+    35dc:	83 c4 10             	add    $0x10,%esp
+    35df:	85 c0                	test   %eax,%eax
+    35e1:	0f 88 de 00 00 00    	js     36c5 <cowdatatest+0x105>
+  if(pid == 0){
+    35e7:	75 6f                	jne    3658 <cowdatatest+0x98>
+    if(strcmp(cowdata, "cow data") != 0){
+    35e9:	83 ec 08             	sub    $0x8,%esp
+    35ec:	68 5b 5a 00 00       	push   $0x5a5b
+    35f1:	68 80 71 00 00       	push   $0x7180
+    35f6:	e8 25 0f 00 00       	call   4520 <strcmp>
+    35fb:	83 c4 10             	add    $0x10,%esp
+    35fe:	85 c0                	test   %eax,%eax
+    3600:	0f 85 d6 00 00 00    	jne    36dc <cowdatatest+0x11c>
+    fd = open("README", 0);
+    3606:	83 ec 08             	sub    $0x8,%esp
+    cowdata[0] = 'C';
+    3609:	c6 05 80 71 00 00 43 	movb   $0x43,0x7180
+    fd = open("README", 0);
+    3610:	6a 00                	push   $0x0
+    3612:	68 4a 58 00 00       	push   $0x584a
+    3617:	e8 e8 0f 00 00       	call   4604 <open>
+    if(fd < 0 || read(fd, cowdata + 32, 16) != 16){
+    361c:	83 c4 10             	add    $0x10,%esp
+    fd = open("README", 0);
+    361f:	89 c3                	mov    %eax,%ebx
+    if(fd < 0 || read(fd, cowdata + 32, 16) != 16){
+    3621:	85 c0                	test   %eax,%eax
+    3623:	78 18                	js     363d <cowdatatest+0x7d>
+    3625:	83 ec 04             	sub    $0x4,%esp
+    3628:	6a 10                	push   $0x10
+    362a:	68 a0 71 00 00       	push   $0x71a0
+    362f:	50                   	push   %eax
+    3630:	e8 a7 0f 00 00       	call   45dc <read>
+    3635:	83 c4 10             	add    $0x10,%esp
+    3638:	83 f8 10             	cmp    $0x10,%eax
+    363b:	74 63                	je     36a0 <cowdatatest+0xe0>
+      printf(stdout, "cow data read into data page failed\n");
+    363d:	83 ec 08             	sub    $0x8,%esp
+    3640:	68 cc 64 00 00       	push   $0x64cc
+    3645:	ff 35 c0 71 00 00    	push   0x71c0
+    364b:	e8 40 11 00 00       	call   4790 <printf>
+      exit();
+    3650:	e8 6f 0f 00 00       	call   45c4 <exit>
+    3655:	8d 76 00             	lea    0x0(%esi),%esi
+  wait();
+    3658:	e8 6f 0f 00 00       	call   45cc <wait>
+  if(strcmp(cowdata, "cow data") != 0 || cowdata[32] != 0){
+    365d:	83 ec 08             	sub    $0x8,%esp
+    3660:	68 5b 5a 00 00       	push   $0x5a5b
+    3665:	68 80 71 00 00       	push   $0x7180
+    366a:	e8 b1 0e 00 00       	call   4520 <strcmp>
+    366f:	83 c4 10             	add    $0x10,%esp
+    3672:	85 c0                	test   %eax,%eax
+    3674:	75 38                	jne    36ae <cowdatatest+0xee>
+    3676:	80 3d a0 71 00 00 00 	cmpb   $0x0,0x71a0
+  printf(stdout, "cow data ok\n");
+    367d:	a1 c0 71 00 00       	mov    0x71c0,%eax
+  if(strcmp(cowdata, "cow data") != 0 || cowdata[32] != 0){
+    3682:	75 2a                	jne    36ae <cowdatatest+0xee>
+  printf(stdout, "cow data ok\n");
+    3684:	83 ec 08             	sub    $0x8,%esp
+    3687:	68 64 5a 00 00       	push   $0x5a64
+    368c:	50                   	push   %eax
+    368d:	e8 fe 10 00 00       	call   4790 <printf>
+}
+    3692:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3695:	83 c4 10             	add    $0x10,%esp
+    3698:	c9                   	leave
+    3699:	c3                   	ret
+    369a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    close(fd);
+    36a0:	83 ec 0c             	sub    $0xc,%esp
+    36a3:	53                   	push   %ebx
+    36a4:	e8 43 0f 00 00       	call   45ec <close>
+    exit();
+    36a9:	e8 16 0f 00 00       	call   45c4 <exit>
+    printf(stdout, "cow data child write leaked to parent\n");
+    36ae:	50                   	push   %eax
+    36af:	50                   	push   %eax
+    36b0:	68 f4 64 00 00       	push   $0x64f4
+    36b5:	ff 35 c0 71 00 00    	push   0x71c0
+    36bb:	e8 d0 10 00 00       	call   4790 <printf>
+    exit();
+    36c0:	e8 ff 0e 00 00       	call   45c4 <exit>
+    printf(stdout, "cow data fork failed\n");
+    36c5:	51                   	push   %ecx
+    36c6:	51                   	push   %ecx
+    36c7:	68 45 5a 00 00       	push   $0x5a45
+    36cc:	ff 35 c0 71 00 00    	push   0x71c0
+    36d2:	e8 b9 10 00 00       	call   4790 <printf>
+    exit();
+    36d7:	e8 e8 0e 00 00       	call   45c4 <exit>
+      printf(stdout, "cow data child sees wrong data\n");
+    36dc:	52                   	push   %edx
+    36dd:	52                   	push   %edx
+    36de:	68 ac 64 00 00       	push   $0x64ac
+    36e3:	ff 35 c0 71 00 00    	push   0x71c0
+    36e9:	e8 a2 10 00 00       	call   4790 <printf>
+      exit();
+    36ee:	e8 d1 0e 00 00       	call   45c4 <exit>
+    36f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    36fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003700 <mmaptest>:
+{
+    3700:	55                   	push   %ebp
+    3701:	89 e5                	mov    %esp,%ebp
+    3703:	57                   	push   %edi
+    3704:	56                   	push   %esi
+    3705:	53                   	push   %ebx
+    3706:	83 ec 14             	sub    $0x14,%esp
+  printf(stdout, "mmap test\n");
+    3709:	68 71 5a 00 00       	push   $0x5a71
+    370e:	ff 35 c0 71 00 00    	push   0x71c0
+    3714:	e8 77 10 00 00       	call   4790 <printf>
+  fd = open("mmapfile", O_CREATE|O_RDWR);
+    3719:	58                   	pop    %eax
+    371a:	5a                   	pop    %edx
+    371b:	68 02 02 00 00       	push   $0x202
+    3720:	68 7c 5a 00 00       	push   $0x5a7c
+    3725:	e8 da 0e 00 00       	call   4604 <open>
+  memset(buf, 'a', 4096);
+    372a:	83 c4 0c             	add    $0xc,%esp
+    372d:	68 00 10 00 00       	push   $0x1000
+  fd = open("mmapfile", O_CREATE|O_RDWR);
+    3732:	89 c3                	mov    %eax,%ebx
+  memset(buf, 'a', 4096);
+    3734:	6a 61                	push   $0x61
+    3736:	68 00 99 00 00       	push   $0x9900
+    373b:	e8 a0 0c 00 00       	call   43e0 <memset>
+  if(fd < 0 || write(fd, buf, 4096) != 4096){
+    3740:	83 c4 10             	add    $0x10,%esp
+    3743:	85 db                	test   %ebx,%ebx
+    3745:	0f 88 f0 01 00 00    	js     393b <mmaptest+0x23b>
+    374b:	83 ec 04             	sub    $0x4,%esp
+    374e:	68 00 10 00 00       	push   $0x1000
+    3753:	68 00 99 00 00       	push   $0x9900
+    3758:	53                   	push   %ebx
+    3759:	e8 86 0e 00 00       	call   45e4 <write>
+    375e:	83 c4 10             	add    $0x10,%esp
+    3761:	3d 00 10 00 00       	cmp    $0x1000,%eax
+    3766:	0f 85 cf 01 00 00    	jne    393b <mmaptest+0x23b>
+  p = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+    376c:	83 ec 08             	sub    $0x8,%esp
+    376f:	6a 00                	push   $0x0
+    3771:	53                   	push   %ebx
+    3772:	6a 02                	push   $0x2
+    3774:	6a 03                	push   $0x3
+    3776:	68 00 10 00 00       	push   $0x1000
+    377b:	6a 00                	push   $0x0
+    377d:	e8 ea 0e 00 00       	call   466c <mmap>
+  if(p == (char*)-1 || p[0] != 'a' || p[4095] != 'a'){
+    3782:	83 c4 20             	add    $0x20,%esp
+  p = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+    3785:	89 c6                	mov    %eax,%esi
+  if(p == (char*)-1 || p[0] != 'a' || p[4095] != 'a'){
+    3787:	83 f8 ff             	cmp    $0xffffffff,%eax
+    378a:	0f 84 93 01 00 00    	je     3923 <mmaptest+0x223>
+    3790:	80 38 61             	cmpb   $0x61,(%eax)
+    3793:	0f 85 8a 01 00 00    	jne    3923 <mmaptest+0x223>
+    3799:	80 b8 ff 0f 00 00 61 	cmpb   $0x61,0xfff(%eax)
+    37a0:	0f 85 7d 01 00 00    	jne    3923 <mmaptest+0x223>
+  q = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+    37a6:	83 ec 08             	sub    $0x8,%esp
+  p[0] = 'b';
+    37a9:	c6 00 62             	movb   $0x62,(%eax)
+  q = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+    37ac:	6a 00                	push   $0x0
+    37ae:	53                   	push   %ebx
+    37af:	6a 01                	push   $0x1
+    37b1:	6a 03                	push   $0x3
+    37b3:	68 00 10 00 00       	push   $0x1000
+    37b8:	6a 00                	push   $0x0
+    37ba:	e8 ad 0e 00 00       	call   466c <mmap>
+  if(q == (char*)-1 || q[0] != 'a'){
+    37bf:	83 c4 20             	add    $0x20,%esp
+  q = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+    37c2:	89 c7                	mov    %eax,%edi
+  if(q == (char*)-1 || q[0] != 'a'){
+    37c4:	83 f8 ff             	cmp    $0xffffffff,%eax
+    37c7:	0f 84 85 01 00 00    	je     3952 <mmaptest+0x252>
+    37cd:	80 38 61             	cmpb   $0x61,(%eax)
+    37d0:	0f 85 7c 01 00 00    	jne    3952 <mmaptest+0x252>
+  close(fd);
+    37d6:	83 ec 0c             	sub    $0xc,%esp
+  q[1] = 'c';
+    37d9:	c6 40 01 63          	movb   $0x63,0x1(%eax)
+  close(fd);
+    37dd:	53                   	push   %ebx
+    37de:	e8 09 0e 00 00       	call   45ec <close>
+  if(msync(q, 4096) < 0){
+    37e3:	5b                   	pop    %ebx
+    37e4:	58                   	pop    %eax
+    37e5:	68 00 10 00 00       	push   $0x1000
+    37ea:	57                   	push   %edi
+    37eb:	e8 8c 0e 00 00       	call   467c <msync>
+    37f0:	83 c4 10             	add    $0x10,%esp
+    37f3:	85 c0                	test   %eax,%eax
+    37f5:	0f 88 b3 01 00 00    	js     39ae <mmaptest+0x2ae>
+  fd = open("mmapfile", O_RDONLY);
+    37fb:	83 ec 08             	sub    $0x8,%esp
+    37fe:	6a 00                	push   $0x0
+    3800:	68 7c 5a 00 00       	push   $0x5a7c
+    3805:	e8 fa 0d 00 00       	call   4604 <open>
+  if(fd < 0 || read(fd, buf, 2) != 2 || buf[0] != 'a' || buf[1] != 'c'){
+    380a:	83 c4 10             	add    $0x10,%esp
+  fd = open("mmapfile", O_RDONLY);
+    380d:	89 c3                	mov    %eax,%ebx
+  if(fd < 0 || read(fd, buf, 2) != 2 || buf[0] != 'a' || buf[1] != 'c'){
+    380f:	85 c0                	test   %eax,%eax
+    3811:	0f 88 f4 00 00 00    	js     390b <mmaptest+0x20b>
+    3817:	83 ec 04             	sub    $0x4,%esp
+    381a:	6a 02                	push   $0x2
+    381c:	68 00 99 00 00       	push   $0x9900
+    3821:	50                   	push   %eax
+    3822:	e8 b5 0d 00 00       	call   45dc <read>
+    3827:	83 c4 10             	add    $0x10,%esp
+    382a:	83 f8 02             	cmp    $0x2,%eax
+    382d:	0f 85 d8 00 00 00    	jne    390b <mmaptest+0x20b>
+    3833:	80 3d 00 99 00 00 61 	cmpb   $0x61,0x9900
+    383a:	0f 85 cb 00 00 00    	jne    390b <mmaptest+0x20b>
+    3840:	80 3d 01 99 00 00 63 	cmpb   $0x63,0x9901
+    3847:	0f 85 be 00 00 00    	jne    390b <mmaptest+0x20b>
+  close(fd);
+    384d:	83 ec 0c             	sub    $0xc,%esp
+    3850:	53                   	push   %ebx
+    3851:	e8 96 0d 00 00       	call   45ec <close>
+  if(munmap(p, 4096) < 0 || munmap(q, 4096) < 0){
+    3856:	58                   	pop    %eax
+    3857:	5a                   	pop    %edx
+    3858:	68 00 10 00 00       	push   $0x1000
+    385d:	56                   	push   %esi
+    385e:	e8 11 0e 00 00       	call   4674 <munmap>
+    3863:	83 c4 10             	add    $0x10,%esp
+    3866:	85 c0                	test   %eax,%eax
+    3868:	0f 88 12 01 00 00    	js     3980 <mmaptest+0x280>
+    386e:	83 ec 08             	sub    $0x8,%esp
+    3871:	68 00 10 00 00       	push   $0x1000
+    3876:	57                   	push   %edi
+    3877:	e8 f8 0d 00 00       	call   4674 <munmap>
+    387c:	83 c4 10             	add    $0x10,%esp
+    387f:	85 c0                	test   %eax,%eax
+    3881:	0f 88 f9 00 00 00    	js     3980 <mmaptest+0x280>
+  p = mmap(0, 8192, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+    3887:	83 ec 08             	sub    $0x8,%esp
+    388a:	6a 00                	push   $0x0
+    388c:	6a ff                	push   $0xffffffff
+    388e:	6a 21                	push   $0x21
+    3890:	6a 03                	push   $0x3
+    3892:	68 00 20 00 00       	push   $0x2000
+    3897:	6a 00                	push   $0x0
+    3899:	e8 ce 0d 00 00       	call   466c <mmap>
+  if(p == (char*)-1){
+    389e:	83 c4 20             	add    $0x20,%esp
+  p = mmap(0, 8192, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+    38a1:	89 c3                	mov    %eax,%ebx
+  if(p == (char*)-1){
+    38a3:	83 f8 ff             	cmp    $0xffffffff,%eax
+    38a6:	0f 84 eb 00 00 00    	je     3997 <mmaptest+0x297>
+  pid = fork();
+    38ac:	e8 0b 0d 00 00       	call   45bc <fork>
+  if(pid == 0){
+    38b1:	85 c0                	test   %eax,%eax
+    38b3:	0f 84 0c 01 00 00    	je     39c5 <mmaptest+0x2c5>
+  wait();
+    38b9:	e8 0e 0d 00 00       	call   45cc <wait>
+  if(p[0] != 0 || p[4096] != 'x'){
+    38be:	80 3b 00             	cmpb   $0x0,(%ebx)
+    38c1:	0f 85 a2 00 00 00    	jne    3969 <mmaptest+0x269>
+    38c7:	80 bb 00 10 00 00 78 	cmpb   $0x78,0x1000(%ebx)
+    38ce:	0f 85 95 00 00 00    	jne    3969 <mmaptest+0x269>
+  munmap(p, 8192);
+    38d4:	83 ec 08             	sub    $0x8,%esp
+    38d7:	68 00 20 00 00       	push   $0x2000
+    38dc:	53                   	push   %ebx
+    38dd:	e8 92 0d 00 00       	call   4674 <munmap>
+  unlink("mmapfile");
+    38e2:	c7 04 24 7c 5a 00 00 	movl   $0x5a7c,(%esp)
+    38e9:	e8 26 0d 00 00       	call   4614 <unlink>
+  printf(stdout, "mmap ok\n");
+    38ee:	58                   	pop    %eax
+    38ef:	5a                   	pop    %edx
+    38f0:	68 20 5b 00 00       	push   $0x5b20
+    38f5:	ff 35 c0 71 00 00    	push   0x71c0
+    38fb:	e8 90 0e 00 00       	call   4790 <printf>
+}
+    3900:	83 c4 10             	add    $0x10,%esp
+    3903:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3906:	5b                   	pop    %ebx
+    3907:	5e                   	pop    %esi
+    3908:	5f                   	pop    %edi
+    3909:	5d                   	pop    %ebp
+    390a:	c3                   	ret
+    printf(stdout, "mmap shared write not in file\n");
+    390b:	83 ec 08             	sub    $0x8,%esp
+    390e:	68 1c 65 00 00       	push   $0x651c
+    3913:	ff 35 c0 71 00 00    	push   0x71c0
+    3919:	e8 72 0e 00 00       	call   4790 <printf>
+    exit();
+    391e:	e8 a1 0c 00 00       	call   45c4 <exit>
+    printf(stdout, "mmap private read failed\n");
+    3923:	83 ec 08             	sub    $0x8,%esp
+    3926:	68 9e 5a 00 00       	push   $0x5a9e
+    392b:	ff 35 c0 71 00 00    	push   0x71c0
+    3931:	e8 5a 0e 00 00       	call   4790 <printf>
+    exit();
+    3936:	e8 89 0c 00 00       	call   45c4 <exit>
+    printf(stdout, "mmap test create failed\n");
+    393b:	50                   	push   %eax
+    393c:	50                   	push   %eax
+    393d:	68 85 5a 00 00       	push   $0x5a85
+    3942:	ff 35 c0 71 00 00    	push   0x71c0
+    3948:	e8 43 0e 00 00       	call   4790 <printf>
+    exit();
+    394d:	e8 72 0c 00 00       	call   45c4 <exit>
+    printf(stdout, "mmap shared read failed\n");
+    3952:	50                   	push   %eax
+    3953:	50                   	push   %eax
+    3954:	68 b8 5a 00 00       	push   $0x5ab8
+    3959:	ff 35 c0 71 00 00    	push   0x71c0
+    395f:	e8 2c 0e 00 00       	call   4790 <printf>
+    exit();
+    3964:	e8 5b 0c 00 00       	call   45c4 <exit>
+    printf(stdout, "mmap anonymous not shared\n");
+    3969:	51                   	push   %ecx
+    396a:	51                   	push   %ecx
+    396b:	68 05 5b 00 00       	push   $0x5b05
+    3970:	ff 35 c0 71 00 00    	push   0x71c0
+    3976:	e8 15 0e 00 00       	call   4790 <printf>
+    exit();
+    397b:	e8 44 0c 00 00       	call   45c4 <exit>
+    printf(stdout, "munmap failed\n");
+    3980:	56                   	push   %esi
+    3981:	56                   	push   %esi
+    3982:	68 df 5a 00 00       	push   $0x5adf
+    3987:	ff 35 c0 71 00 00    	push   0x71c0
+    398d:	e8 fe 0d 00 00       	call   4790 <printf>
+    exit();
+    3992:	e8 2d 0c 00 00       	call   45c4 <exit>
+    printf(stdout, "mmap anonymous failed\n");
+    3997:	53                   	push   %ebx
+    3998:	53                   	push   %ebx
+    3999:	68 ee 5a 00 00       	push   $0x5aee
+    399e:	ff 35 c0 71 00 00    	push   0x71c0
+    39a4:	e8 e7 0d 00 00       	call   4790 <printf>
+    exit();
+    39a9:	e8 16 0c 00 00       	call   45c4 <exit>
+    printf(stdout, "msync failed\n");
+    39ae:	51                   	push   %ecx
+    39af:	51                   	push   %ecx
+    39b0:	68 d1 5a 00 00       	push   $0x5ad1
+    39b5:	ff 35 c0 71 00 00    	push   0x71c0
+    39bb:	e8 d0 0d 00 00       	call   4790 <printf>
+    exit();
+    39c0:	e8 ff 0b 00 00       	call   45c4 <exit>
+    p[4096] = 'x';
+    39c5:	c6 83 00 10 00 00 78 	movb   $0x78,0x1000(%ebx)
+    exit();
+    39cc:	e8 f3 0b 00 00       	call   45c4 <exit>
+    39d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    39d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    39df:	90                   	nop
+
+000039e0 <shmtest>:
+{
+    39e0:	55                   	push   %ebp
+    39e1:	89 e5                	mov    %esp,%ebp
+    39e3:	53                   	push   %ebx
+    39e4:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "shm test\n");
+    39e7:	68 29 5b 00 00       	push   $0x5b29
+    39ec:	ff 35 c0 71 00 00    	push   0x71c0
+    39f2:	e8 99 0d 00 00       	call   4790 <printf>
+  p = shmcreate("shmtest", 8192);
+    39f7:	58                   	pop    %eax
+    39f8:	5a                   	pop    %edx
+    39f9:	68 00 20 00 00       	push   $0x2000
+    39fe:	68 33 5b 00 00       	push   $0x5b33
+    3a03:	e8 7c 0c 00 00       	call   4684 <shmcreate>
+  if(p == (int*)-1 || shmcreate("shmtest", 4096) != (void*)-1){
+    3a08:	83 c4 10             	add    $0x10,%esp
+    3a0b:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3a0e:	0f 84 0b 01 00 00    	je     3b1f <shmtest+0x13f>
+    3a14:	83 ec 08             	sub    $0x8,%esp
+    3a17:	89 c3                	mov    %eax,%ebx
+    3a19:	68 00 10 00 00       	push   $0x1000
+    3a1e:	68 33 5b 00 00       	push   $0x5b33
+    3a23:	e8 5c 0c 00 00       	call   4684 <shmcreate>
+    3a28:	83 c4 10             	add    $0x10,%esp
+    3a2b:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3a2e:	0f 85 eb 00 00 00    	jne    3b1f <shmtest+0x13f>
+  pid = fork();
+    3a34:	e8 83 0b 00 00       	call   45bc <fork>
+  if(pid == 0){
+    3a39:	85 c0                	test   %eax,%eax
+    3a3b:	75 11                	jne    3a4e <shmtest+0x6e>
+    3a3d:	eb 71                	jmp    3ab0 <shmtest+0xd0>
+    3a3f:	90                   	nop
+    futex_wait(p, 0);
+    3a40:	83 ec 08             	sub    $0x8,%esp
+    3a43:	6a 00                	push   $0x0
+    3a45:	53                   	push   %ebx
+    3a46:	e8 51 0c 00 00       	call   469c <futex_wait>
+  while(p[0] == 0)
+    3a4b:	83 c4 10             	add    $0x10,%esp
+    3a4e:	8b 0b                	mov    (%ebx),%ecx
+    3a50:	85 c9                	test   %ecx,%ecx
+    3a52:	74 ec                	je     3a40 <shmtest+0x60>
+  wait();
+    3a54:	e8 73 0b 00 00       	call   45cc <wait>
+  if(p[1024] != 42){
+    3a59:	83 bb 00 10 00 00 2a 	cmpl   $0x2a,0x1000(%ebx)
+    3a60:	0f 85 d0 00 00 00    	jne    3b36 <shmtest+0x156>
+  if(shmdetach(p) < 0 || shmattach("shmtest") != (void*)-1){
+    3a66:	83 ec 0c             	sub    $0xc,%esp
+    3a69:	53                   	push   %ebx
+    3a6a:	e8 25 0c 00 00       	call   4694 <shmdetach>
+    3a6f:	83 c4 10             	add    $0x10,%esp
+    3a72:	85 c0                	test   %eax,%eax
+    3a74:	0f 88 8e 00 00 00    	js     3b08 <shmtest+0x128>
+    3a7a:	83 ec 0c             	sub    $0xc,%esp
+    3a7d:	68 33 5b 00 00       	push   $0x5b33
+    3a82:	e8 05 0c 00 00       	call   468c <shmattach>
+    3a87:	83 c4 10             	add    $0x10,%esp
+    3a8a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3a8d:	75 79                	jne    3b08 <shmtest+0x128>
+  printf(stdout, "shm ok\n");
+    3a8f:	83 ec 08             	sub    $0x8,%esp
+    3a92:	68 8b 5b 00 00       	push   $0x5b8b
+    3a97:	ff 35 c0 71 00 00    	push   0x71c0
+    3a9d:	e8 ee 0c 00 00       	call   4790 <printf>
+}
+    3aa2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3aa5:	83 c4 10             	add    $0x10,%esp
+    3aa8:	c9                   	leave
+    3aa9:	c3                   	ret
+    3aaa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    shmdetach(p);
+    3ab0:	83 ec 0c             	sub    $0xc,%esp
+    3ab3:	53                   	push   %ebx
+    3ab4:	e8 db 0b 00 00       	call   4694 <shmdetach>
+    q = shmattach("shmtest");
+    3ab9:	c7 04 24 33 5b 00 00 	movl   $0x5b33,(%esp)
+    3ac0:	e8 c7 0b 00 00       	call   468c <shmattach>
+    if(q == (int*)-1){
+    3ac5:	83 c4 10             	add    $0x10,%esp
+    3ac8:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3acb:	74 23                	je     3af0 <shmtest+0x110>
+    futex_wake(q, 1);
+    3acd:	83 ec 08             	sub    $0x8,%esp
+    q[0] = 1;
+    3ad0:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+    q[1024] = 42;
+    3ad6:	c7 80 00 10 00 00 2a 	movl   $0x2a,0x1000(%eax)
+    3add:	00 00 00 
+    futex_wake(q, 1);
+    3ae0:	6a 01                	push   $0x1
+    3ae2:	50                   	push   %eax
+    3ae3:	e8 bc 0b 00 00       	call   46a4 <futex_wake>
+    exit();
+    3ae8:	e8 d7 0a 00 00       	call   45c4 <exit>
+    3aed:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(stdout, "shmattach failed\n");
+    3af0:	83 ec 08             	sub    $0x8,%esp
+    3af3:	68 4d 5b 00 00       	push   $0x5b4d
+    3af8:	ff 35 c0 71 00 00    	push   0x71c0
+    3afe:	e8 8d 0c 00 00       	call   4790 <printf>
+      exit();
+    3b03:	e8 bc 0a 00 00       	call   45c4 <exit>
+    printf(stdout, "shm segment not freed\n");
+    3b08:	50                   	push   %eax
+    3b09:	50                   	push   %eax
+    3b0a:	68 74 5b 00 00       	push   $0x5b74
+    3b0f:	ff 35 c0 71 00 00    	push   0x71c0
+    3b15:	e8 76 0c 00 00       	call   4790 <printf>
+    exit();
+    3b1a:	e8 a5 0a 00 00       	call   45c4 <exit>
+    printf(stdout, "shmcreate failed\n");
+    3b1f:	53                   	push   %ebx
+    3b20:	53                   	push   %ebx
+    3b21:	68 3b 5b 00 00       	push   $0x5b3b
+    3b26:	ff 35 c0 71 00 00    	push   0x71c0
+    3b2c:	e8 5f 0c 00 00       	call   4790 <printf>
+    exit();
+    3b31:	e8 8e 0a 00 00       	call   45c4 <exit>
+    printf(stdout, "shm data not shared\n");
+    3b36:	52                   	push   %edx
+    3b37:	52                   	push   %edx
+    3b38:	68 5f 5b 00 00       	push   $0x5b5f
+    3b3d:	ff 35 c0 71 00 00    	push   0x71c0
+    3b43:	e8 48 0c 00 00       	call   4790 <printf>
+    exit();
+    3b48:	e8 77 0a 00 00       	call   45c4 <exit>
+    3b4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003b50 <schedtest>:
+{
+    3b50:	55                   	push   %ebp
+    3b51:	89 e5                	mov    %esp,%ebp
+    3b53:	56                   	push   %esi
+    3b54:	53                   	push   %ebx
+  printf(stdout, "sched test\n");
+    3b55:	83 ec 08             	sub    $0x8,%esp
+    3b58:	68 93 5b 00 00       	push   $0x5b93
+    3b5d:	ff 35 c0 71 00 00    	push   0x71c0
+    3b63:	e8 28 0c 00 00       	call   4790 <printf>
+  if(nice(5) != 5 || nice(-100) != NICE_MIN || nice(-NICE_MIN) != 0){
+    3b68:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+    3b6f:	e8 38 0b 00 00       	call   46ac <nice>
+    3b74:	83 c4 10             	add    $0x10,%esp
+    3b77:	83 f8 05             	cmp    $0x5,%eax
+    3b7a:	0f 85 e7 00 00 00    	jne    3c67 <schedtest+0x117>
+    3b80:	83 ec 0c             	sub    $0xc,%esp
+    3b83:	6a 9c                	push   $0xffffff9c
+    3b85:	e8 22 0b 00 00       	call   46ac <nice>
+    3b8a:	83 c4 10             	add    $0x10,%esp
+    3b8d:	83 f8 ec             	cmp    $0xffffffec,%eax
+    3b90:	0f 85 d1 00 00 00    	jne    3c67 <schedtest+0x117>
+    3b96:	83 ec 0c             	sub    $0xc,%esp
+    3b99:	6a 14                	push   $0x14
+    3b9b:	e8 0c 0b 00 00       	call   46ac <nice>
+    3ba0:	83 c4 10             	add    $0x10,%esp
+    3ba3:	85 c0                	test   %eax,%eax
+    3ba5:	0f 85 bc 00 00 00    	jne    3c67 <schedtest+0x117>
+  if(setpriority(0, SCHED_FIFO, 0) != -1 ||
+    3bab:	83 ec 04             	sub    $0x4,%esp
+    3bae:	6a 00                	push   $0x0
+    3bb0:	6a 01                	push   $0x1
+    3bb2:	6a 00                	push   $0x0
+    3bb4:	e8 fb 0a 00 00       	call   46b4 <setpriority>
+    3bb9:	83 c4 10             	add    $0x10,%esp
+    3bbc:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3bbf:	0f 85 d1 00 00 00    	jne    3c96 <schedtest+0x146>
+     setpriority(0, SCHED_OTHER, NICE_MAX+1) != -1 ||
+    3bc5:	83 ec 04             	sub    $0x4,%esp
+    3bc8:	6a 14                	push   $0x14
+    3bca:	6a 00                	push   $0x0
+    3bcc:	6a 00                	push   $0x0
+    3bce:	e8 e1 0a 00 00       	call   46b4 <setpriority>
+  if(setpriority(0, SCHED_FIFO, 0) != -1 ||
+    3bd3:	83 c4 10             	add    $0x10,%esp
+    3bd6:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3bd9:	0f 85 b7 00 00 00    	jne    3c96 <schedtest+0x146>
+     setpriority(0, 7, 0) != -1){
+    3bdf:	83 ec 04             	sub    $0x4,%esp
+    3be2:	6a 00                	push   $0x0
+    3be4:	6a 07                	push   $0x7
+    3be6:	6a 00                	push   $0x0
+    3be8:	e8 c7 0a 00 00       	call   46b4 <setpriority>
+     setpriority(0, SCHED_OTHER, NICE_MAX+1) != -1 ||
+    3bed:	83 c4 10             	add    $0x10,%esp
+    3bf0:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3bf3:	0f 85 9d 00 00 00    	jne    3c96 <schedtest+0x146>
+  if(setpriority(0, SCHED_FIFO, 10) < 0 ||
+    3bf9:	83 ec 04             	sub    $0x4,%esp
+    3bfc:	6a 0a                	push   $0xa
+    3bfe:	6a 01                	push   $0x1
+    3c00:	6a 00                	push   $0x0
+    3c02:	e8 ad 0a 00 00       	call   46b4 <setpriority>
+    3c07:	83 c4 10             	add    $0x10,%esp
+    3c0a:	85 c0                	test   %eax,%eax
+    3c0c:	78 71                	js     3c7f <schedtest+0x12f>
+     setpriority(0, SCHED_OTHER, 0) < 0){
+    3c0e:	83 ec 04             	sub    $0x4,%esp
+    3c11:	6a 00                	push   $0x0
+    3c13:	6a 00                	push   $0x0
+    3c15:	6a 00                	push   $0x0
+    3c17:	e8 98 0a 00 00       	call   46b4 <setpriority>
+  if(setpriority(0, SCHED_FIFO, 10) < 0 ||
+    3c1c:	83 c4 10             	add    $0x10,%esp
+    3c1f:	85 c0                	test   %eax,%eax
+    3c21:	78 5c                	js     3c7f <schedtest+0x12f>
+  t0 = cputime();
+    3c23:	e8 94 0a 00 00       	call   46bc <cputime>
+    3c28:	89 c6                	mov    %eax,%esi
+  start = uptime();
+    3c2a:	e8 2d 0a 00 00       	call   465c <uptime>
+  while(uptime() < start + 5)
+    3c2f:	8d 58 04             	lea    0x4(%eax),%ebx
+    3c32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    3c38:	e8 1f 0a 00 00       	call   465c <uptime>
+    3c3d:	39 d8                	cmp    %ebx,%eax
+    3c3f:	7e f7                	jle    3c38 <schedtest+0xe8>
+  if(cputime() <= t0){
+    3c41:	e8 76 0a 00 00       	call   46bc <cputime>
+    3c46:	39 f0                	cmp    %esi,%eax
+    3c48:	7e 64                	jle    3cae <schedtest+0x15e>
+  printf(stdout, "sched ok\n");
+    3c4a:	83 ec 08             	sub    $0x8,%esp
+    3c4d:	68 d4 5b 00 00       	push   $0x5bd4
+    3c52:	ff 35 c0 71 00 00    	push   0x71c0
+    3c58:	e8 33 0b 00 00       	call   4790 <printf>
+}
+    3c5d:	83 c4 10             	add    $0x10,%esp
+    3c60:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3c63:	5b                   	pop    %ebx
+    3c64:	5e                   	pop    %esi
+    3c65:	5d                   	pop    %ebp
+    3c66:	c3                   	ret
+    printf(stdout, "nice wrong\n");
+    3c67:	83 ec 08             	sub    $0x8,%esp
+    3c6a:	68 9f 5b 00 00       	push   $0x5b9f
+    3c6f:	ff 35 c0 71 00 00    	push   0x71c0
+    3c75:	e8 16 0b 00 00       	call   4790 <printf>
+    exit();
+    3c7a:	e8 45 09 00 00       	call   45c4 <exit>
+    printf(stdout, "setpriority failed\n");
+    3c7f:	52                   	push   %edx
+    3c80:	52                   	push   %edx
+    3c81:	68 ab 5b 00 00       	push   $0x5bab
+    3c86:	ff 35 c0 71 00 00    	push   0x71c0
+    3c8c:	e8 ff 0a 00 00       	call   4790 <printf>
+    exit();
+    3c91:	e8 2e 09 00 00       	call   45c4 <exit>
+    printf(stdout, "setpriority accepted bad arguments\n");
+    3c96:	83 ec 08             	sub    $0x8,%esp
+    3c99:	68 3c 65 00 00       	push   $0x653c
+    3c9e:	ff 35 c0 71 00 00    	push   0x71c0
+    3ca4:	e8 e7 0a 00 00       	call   4790 <printf>
+    exit();
+    3ca9:	e8 16 09 00 00       	call   45c4 <exit>
+    printf(stdout, "cputime not charged\n");
+    3cae:	50                   	push   %eax
+    3caf:	50                   	push   %eax
+    3cb0:	68 bf 5b 00 00       	push   $0x5bbf
+    3cb5:	ff 35 c0 71 00 00    	push   0x71c0
+    3cbb:	e8 d0 0a 00 00       	call   4790 <printf>
+    exit();
+    3cc0:	e8 ff 08 00 00       	call   45c4 <exit>
+    3cc5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3ccc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003cd0 <clocktest>:
+{
+    3cd0:	55                   	push   %ebp
+    3cd1:	89 e5                	mov    %esp,%ebp
+    3cd3:	57                   	push   %edi
+    3cd4:	56                   	push   %esi
+    3cd5:	53                   	push   %ebx
+  if(clock_gettime(CLOCK_MONOTONIC, &a) < 0 || clock_gettime(99, &a) != -1){
+    3cd6:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+{
+    3cd9:	83 ec 24             	sub    $0x24,%esp
+  printf(stdout, "clock test\n");
+    3cdc:	68 de 5b 00 00       	push   $0x5bde
+    3ce1:	ff 35 c0 71 00 00    	push   0x71c0
+    3ce7:	e8 a4 0a 00 00       	call   4790 <printf>
+  if(clock_gettime(CLOCK_MONOTONIC, &a) < 0 || clock_gettime(99, &a) != -1){
+    3cec:	5e                   	pop    %esi
+    3ced:	5f                   	pop    %edi
+    3cee:	53                   	push   %ebx
+    3cef:	6a 01                	push   $0x1
+    3cf1:	e8 ce 09 00 00       	call   46c4 <clock_gettime>
+    3cf6:	83 c4 10             	add    $0x10,%esp
+    3cf9:	85 c0                	test   %eax,%eax
+    3cfb:	0f 88 81 00 00 00    	js     3d82 <clocktest+0xb2>
+    3d01:	83 ec 08             	sub    $0x8,%esp
+    3d04:	53                   	push   %ebx
+    3d05:	6a 63                	push   $0x63
+    3d07:	e8 b8 09 00 00       	call   46c4 <clock_gettime>
+    3d0c:	83 c4 10             	add    $0x10,%esp
+    3d0f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3d12:	75 6e                	jne    3d82 <clocktest+0xb2>
+  sleep(3);
+    3d14:	83 ec 0c             	sub    $0xc,%esp
+  ms = (b.tv_sec - a.tv_sec) * 1000 + b.tv_nsec / 1000000 - a.tv_nsec / 1000000;
+    3d17:	bf 83 de 1b 43       	mov    $0x431bde83,%edi
+  sleep(3);
+    3d1c:	6a 03                	push   $0x3
+    3d1e:	e8 31 09 00 00       	call   4654 <sleep>
+  clock_gettime(CLOCK_MONOTONIC, &b);
+    3d23:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    3d26:	5a                   	pop    %edx
+    3d27:	59                   	pop    %ecx
+    3d28:	50                   	push   %eax
+    3d29:	6a 01                	push   $0x1
+    3d2b:	e8 94 09 00 00       	call   46c4 <clock_gettime>
+  ms = (b.tv_sec - a.tv_sec) * 1000 + b.tv_nsec / 1000000 - a.tv_nsec / 1000000;
+    3d30:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    3d33:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  if(b.tv_nsec >= 1000000000 || ms < 2000 / HZ){
+    3d36:	83 c4 10             	add    $0x10,%esp
+  ms = (b.tv_sec - a.tv_sec) * 1000 + b.tv_nsec / 1000000 - a.tv_nsec / 1000000;
+    3d39:	2b 4d d8             	sub    -0x28(%ebp),%ecx
+    3d3c:	89 f0                	mov    %esi,%eax
+    3d3e:	69 c9 e8 03 00 00    	imul   $0x3e8,%ecx,%ecx
+    3d44:	f7 e7                	mul    %edi
+    3d46:	89 f8                	mov    %edi,%eax
+    3d48:	c1 ea 12             	shr    $0x12,%edx
+    3d4b:	89 d3                	mov    %edx,%ebx
+    3d4d:	f7 65 dc             	mull   -0x24(%ebp)
+    3d50:	c1 ea 12             	shr    $0x12,%edx
+    3d53:	29 d3                	sub    %edx,%ebx
+    3d55:	01 d9                	add    %ebx,%ecx
+  if(b.tv_nsec >= 1000000000 || ms < 2000 / HZ){
+    3d57:	83 f9 13             	cmp    $0x13,%ecx
+    3d5a:	76 3d                	jbe    3d99 <clocktest+0xc9>
+    3d5c:	81 fe ff c9 9a 3b    	cmp    $0x3b9ac9ff,%esi
+    3d62:	77 35                	ja     3d99 <clocktest+0xc9>
+  printf(stdout, "clock ok\n");
+    3d64:	83 ec 08             	sub    $0x8,%esp
+    3d67:	68 1a 5c 00 00       	push   $0x5c1a
+    3d6c:	ff 35 c0 71 00 00    	push   0x71c0
+    3d72:	e8 19 0a 00 00       	call   4790 <printf>
+}
+    3d77:	83 c4 10             	add    $0x10,%esp
+    3d7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3d7d:	5b                   	pop    %ebx
+    3d7e:	5e                   	pop    %esi
+    3d7f:	5f                   	pop    %edi
+    3d80:	5d                   	pop    %ebp
+    3d81:	c3                   	ret
+    printf(stdout, "clock_gettime failed\n");
+    3d82:	53                   	push   %ebx
+    3d83:	53                   	push   %ebx
+    3d84:	68 ea 5b 00 00       	push   $0x5bea
+    3d89:	ff 35 c0 71 00 00    	push   0x71c0
+    3d8f:	e8 fc 09 00 00       	call   4790 <printf>
+    exit();
+    3d94:	e8 2b 08 00 00       	call   45c4 <exit>
+    printf(stdout, "clock wrong: slept %d ms\n", ms);
+    3d99:	50                   	push   %eax
+    3d9a:	51                   	push   %ecx
+    3d9b:	68 00 5c 00 00       	push   $0x5c00
+    3da0:	ff 35 c0 71 00 00    	push   0x71c0
+    3da6:	e8 e5 09 00 00       	call   4790 <printf>
+    exit();
+    3dab:	e8 14 08 00 00       	call   45c4 <exit>
+
+00003db0 <threadtest>:
+{
+    3db0:	55                   	push   %ebp
+    3db1:	89 e5                	mov    %esp,%ebp
+    3db3:	56                   	push   %esi
+    3db4:	53                   	push   %ebx
+    3db5:	83 ec 18             	sub    $0x18,%esp
+  printf(stdout, "thread test\n");
+    3db8:	68 24 5c 00 00       	push   $0x5c24
+    3dbd:	ff 35 c0 71 00 00    	push   0x71c0
+    3dc3:	e8 c8 09 00 00       	call   4790 <printf>
+  stack = sbrk(2*4096);
+    3dc8:	c7 04 24 00 20 00 00 	movl   $0x2000,(%esp)
+    3dcf:	e8 78 08 00 00       	call   464c <sbrk>
+  if((pid = clone(threadfn, &n, stack)) < 0){
+    3dd4:	83 c4 0c             	add    $0xc,%esp
+  n = 0;
+    3dd7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  stack = (char*)(((uint)stack + 4095) & ~4095);
+    3dde:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+  if((pid = clone(threadfn, &n, stack)) < 0){
+    3de4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  stack = (char*)(((uint)stack + 4095) & ~4095);
+    3de7:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if((pid = clone(threadfn, &n, stack)) < 0){
+    3ded:	53                   	push   %ebx
+    3dee:	50                   	push   %eax
+    3def:	68 40 01 00 00       	push   $0x140
+    3df4:	e8 d3 08 00 00       	call   46cc <clone>
+    3df9:	83 c4 10             	add    $0x10,%esp
+    3dfc:	85 c0                	test   %eax,%eax
+    3dfe:	78 5a                	js     3e5a <threadtest+0xaa>
+  if(join(&ustack) != pid || ustack != stack || n != 42){
+    3e00:	83 ec 0c             	sub    $0xc,%esp
+    3e03:	89 c6                	mov    %eax,%esi
+    3e05:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    3e08:	50                   	push   %eax
+    3e09:	e8 c6 08 00 00       	call   46d4 <join>
+    3e0e:	83 c4 10             	add    $0x10,%esp
+    3e11:	39 f0                	cmp    %esi,%eax
+    3e13:	75 2a                	jne    3e3f <threadtest+0x8f>
+    3e15:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  printf(stdout, "thread ok\n");
+    3e18:	a1 c0 71 00 00       	mov    0x71c0,%eax
+  if(join(&ustack) != pid || ustack != stack || n != 42){
+    3e1d:	39 5d f0             	cmp    %ebx,-0x10(%ebp)
+    3e20:	75 1d                	jne    3e3f <threadtest+0x8f>
+    3e22:	83 fa 2a             	cmp    $0x2a,%edx
+    3e25:	75 18                	jne    3e3f <threadtest+0x8f>
+  printf(stdout, "thread ok\n");
+    3e27:	83 ec 08             	sub    $0x8,%esp
+    3e2a:	68 53 5c 00 00       	push   $0x5c53
+    3e2f:	50                   	push   %eax
+    3e30:	e8 5b 09 00 00       	call   4790 <printf>
+}
+    3e35:	83 c4 10             	add    $0x10,%esp
+    3e38:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3e3b:	5b                   	pop    %ebx
+    3e3c:	5e                   	pop    %esi
+    3e3d:	5d                   	pop    %ebp
+    3e3e:	c3                   	ret
+    printf(stdout, "thread wrong: n %d\n", n);
+    3e3f:	83 ec 04             	sub    $0x4,%esp
+    3e42:	ff 75 f4             	push   -0xc(%ebp)
+    3e45:	68 3f 5c 00 00       	push   $0x5c3f
+    3e4a:	ff 35 c0 71 00 00    	push   0x71c0
+    3e50:	e8 3b 09 00 00       	call   4790 <printf>
+    exit();
+    3e55:	e8 6a 07 00 00       	call   45c4 <exit>
+    printf(stdout, "clone failed\n");
+    3e5a:	50                   	push   %eax
+    3e5b:	50                   	push   %eax
+    3e5c:	68 31 5c 00 00       	push   $0x5c31
+    3e61:	ff 35 c0 71 00 00    	push   0x71c0
+    3e67:	e8 24 09 00 00       	call   4790 <printf>
+    exit();
+    3e6c:	e8 53 07 00 00       	call   45c4 <exit>
+    3e71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3e78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3e7f:	90                   	nop
+
+00003e80 <validateint>:
+}
+    3e80:	c3                   	ret
+    3e81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3e88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3e8f:	90                   	nop
+
+00003e90 <validatetest>:
+{
+    3e90:	55                   	push   %ebp
+    3e91:	89 e5                	mov    %esp,%ebp
+    3e93:	56                   	push   %esi
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3e94:	31 f6                	xor    %esi,%esi
+{
+    3e96:	53                   	push   %ebx
+  printf(stdout, "validate test\n");
+    3e97:	83 ec 08             	sub    $0x8,%esp
+    3e9a:	68 5e 5c 00 00       	push   $0x5c5e
+    3e9f:	ff 35 c0 71 00 00    	push   0x71c0
+    3ea5:	e8 e6 08 00 00       	call   4790 <printf>
+    3eaa:	83 c4 10             	add    $0x10,%esp
+    3ead:	8d 76 00             	lea    0x0(%esi),%esi
+    if((pid = fork()) == 0){
+    3eb0:	e8 07 07 00 00       	call   45bc <fork>
+    3eb5:	89 c3                	mov    %eax,%ebx
+    3eb7:	85 c0                	test   %eax,%eax
+    3eb9:	74 63                	je     3f1e <validatetest+0x8e>
+    sleep(0);
+    3ebb:	83 ec 0c             	sub    $0xc,%esp
+    3ebe:	6a 00                	push   $0x0
+    3ec0:	e8 8f 07 00 00       	call   4654 <sleep>
+    sleep(0);
+    3ec5:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3ecc:	e8 83 07 00 00       	call   4654 <sleep>
+    kill(pid);
+    3ed1:	89 1c 24             	mov    %ebx,(%esp)
+    3ed4:	e8 1b 07 00 00       	call   45f4 <kill>
+    wait();
+    3ed9:	e8 ee 06 00 00       	call   45cc <wait>
+    if(link("nosuchfile", (char*)p) != -1){
+    3ede:	58                   	pop    %eax
+    3edf:	5a                   	pop    %edx
+    3ee0:	56                   	push   %esi
+    3ee1:	68 6d 5c 00 00       	push   $0x5c6d
+    3ee6:	e8 39 07 00 00       	call   4624 <link>
+    3eeb:	83 c4 10             	add    $0x10,%esp
+    3eee:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3ef1:	75 30                	jne    3f23 <validatetest+0x93>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3ef3:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    3ef9:	81 fe 00 40 11 00    	cmp    $0x114000,%esi
+    3eff:	75 af                	jne    3eb0 <validatetest+0x20>
+  printf(stdout, "validate ok\n");
+    3f01:	83 ec 08             	sub    $0x8,%esp
+    3f04:	68 91 5c 00 00       	push   $0x5c91
+    3f09:	ff 35 c0 71 00 00    	push   0x71c0
+    3f0f:	e8 7c 08 00 00       	call   4790 <printf>
+}
+    3f14:	83 c4 10             	add    $0x10,%esp
+    3f17:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3f1a:	5b                   	pop    %ebx
+    3f1b:	5e                   	pop    %esi
+    3f1c:	5d                   	pop    %ebp
+    3f1d:	c3                   	ret
+      exit();
+    3f1e:	e8 a1 06 00 00       	call   45c4 <exit>
+      printf(stdout, "link should not succeed\n");
+    3f23:	83 ec 08             	sub    $0x8,%esp
+    3f26:	68 78 5c 00 00       	push   $0x5c78
+    3f2b:	ff 35 c0 71 00 00    	push   0x71c0
+    3f31:	e8 5a 08 00 00       	call   4790 <printf>
+      exit();
+    3f36:	e8 89 06 00 00       	call   45c4 <exit>
+    3f3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3f3f:	90                   	nop
+
+00003f40 <bsstest>:
+{
+    3f40:	55                   	push   %ebp
+    3f41:	89 e5                	mov    %esp,%ebp
+    3f43:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "bss test\n");
+    3f46:	68 9e 5c 00 00       	push   $0x5c9e
+    3f4b:	ff 35 c0 71 00 00    	push   0x71c0
+    3f51:	e8 3a 08 00 00       	call   4790 <printf>
+    3f56:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    3f59:	31 c0                	xor    %eax,%eax
+    3f5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3f5f:	90                   	nop
+    if(uninit[i] != '\0'){
+    3f60:	80 b8 e0 71 00 00 00 	cmpb   $0x0,0x71e0(%eax)
+    3f67:	75 22                	jne    3f8b <bsstest+0x4b>
+  for(i = 0; i < sizeof(uninit); i++){
+    3f69:	83 c0 01             	add    $0x1,%eax
+    3f6c:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    3f71:	75 ed                	jne    3f60 <bsstest+0x20>
+  printf(stdout, "bss test ok\n");
+    3f73:	83 ec 08             	sub    $0x8,%esp
+    3f76:	68 b9 5c 00 00       	push   $0x5cb9
+    3f7b:	ff 35 c0 71 00 00    	push   0x71c0
+    3f81:	e8 0a 08 00 00       	call   4790 <printf>
+}
+    3f86:	83 c4 10             	add    $0x10,%esp
+    3f89:	c9                   	leave
+    3f8a:	c3                   	ret
+      printf(stdout, "bss test failed\n");
+    3f8b:	83 ec 08             	sub    $0x8,%esp
+    3f8e:	68 a8 5c 00 00       	push   $0x5ca8
+    3f93:	ff 35 c0 71 00 00    	push   0x71c0
+    3f99:	e8 f2 07 00 00       	call   4790 <printf>
+      exit();
+    3f9e:	e8 21 06 00 00       	call   45c4 <exit>
+    3fa3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3faa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003fb0 <bigargtest>:
+{
+    3fb0:	55                   	push   %ebp
+    3fb1:	89 e5                	mov    %esp,%ebp
+    3fb3:	83 ec 14             	sub    $0x14,%esp
+  unlink("bigarg-ok");
+    3fb6:	68 c6 5c 00 00       	push   $0x5cc6
+    3fbb:	e8 54 06 00 00       	call   4614 <unlink>
+  pid = fork();
+    3fc0:	e8 f7 05 00 00       	call   45bc <fork>
+  if(pid == 0){
+    3fc5:	83 c4 10             	add    $0x10,%esp
+    3fc8:	85 c0                	test   %eax,%eax
+    3fca:	74 44                	je     4010 <bigargtest+0x60>
+  } else if(pid < 0){
+    3fcc:	0f 88 c3 00 00 00    	js     4095 <bigargtest+0xe5>
+  wait();
+    3fd2:	e8 f5 05 00 00       	call   45cc <wait>
+  fd = open("bigarg-ok", 0);
+    3fd7:	83 ec 08             	sub    $0x8,%esp
+    3fda:	6a 00                	push   $0x0
+    3fdc:	68 c6 5c 00 00       	push   $0x5cc6
+    3fe1:	e8 1e 06 00 00       	call   4604 <open>
+  if(fd < 0){
+    3fe6:	83 c4 10             	add    $0x10,%esp
+    3fe9:	85 c0                	test   %eax,%eax
+    3feb:	0f 88 8d 00 00 00    	js     407e <bigargtest+0xce>
+  close(fd);
+    3ff1:	83 ec 0c             	sub    $0xc,%esp
+    3ff4:	50                   	push   %eax
+    3ff5:	e8 f2 05 00 00       	call   45ec <close>
+  unlink("bigarg-ok");
+    3ffa:	c7 04 24 c6 5c 00 00 	movl   $0x5cc6,(%esp)
+    4001:	e8 0e 06 00 00       	call   4614 <unlink>
+}
+    4006:	83 c4 10             	add    $0x10,%esp
+    4009:	c9                   	leave
+    400a:	c3                   	ret
+    400b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    400f:	90                   	nop
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    4010:	c7 04 85 00 b9 00 00 	movl   $0x6560,0xb900(,%eax,4)
+    4017:	60 65 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    401b:	83 c0 01             	add    $0x1,%eax
+    401e:	83 f8 1f             	cmp    $0x1f,%eax
+    4021:	75 ed                	jne    4010 <bigargtest+0x60>
+    args[MAXARG-1] = 0;
+    4023:	31 c9                	xor    %ecx,%ecx
+    4025:	89 0d 7c b9 00 00    	mov    %ecx,0xb97c
+    printf(stdout, "bigarg test\n");
+    402b:	50                   	push   %eax
+    402c:	50                   	push   %eax
+    402d:	68 d0 5c 00 00       	push   $0x5cd0
+    4032:	ff 35 c0 71 00 00    	push   0x71c0
+    4038:	e8 53 07 00 00       	call   4790 <printf>
+    exec("echo", args);
+    403d:	58                   	pop    %eax
+    403e:	5a                   	pop    %edx
+    403f:	68 00 b9 00 00       	push   $0xb900
+    4044:	68 80 4b 00 00       	push   $0x4b80
+    4049:	e8 ae 05 00 00       	call   45fc <exec>
+    printf(stdout, "bigarg test ok\n");
+    404e:	59                   	pop    %ecx
+    404f:	58                   	pop    %eax
+    4050:	68 dd 5c 00 00       	push   $0x5cdd
+    4055:	ff 35 c0 71 00 00    	push   0x71c0
+    405b:	e8 30 07 00 00       	call   4790 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    4060:	58                   	pop    %eax
+    4061:	5a                   	pop    %edx
+    4062:	68 00 02 00 00       	push   $0x200
+    4067:	68 c6 5c 00 00       	push   $0x5cc6
+    406c:	e8 93 05 00 00       	call   4604 <open>
+    close(fd);
+    4071:	89 04 24             	mov    %eax,(%esp)
+    4074:	e8 73 05 00 00       	call   45ec <close>
+    exit();
+    4079:	e8 46 05 00 00       	call   45c4 <exit>
+    printf(stdout, "bigarg test failed!\n");
+    407e:	50                   	push   %eax
+    407f:	50                   	push   %eax
+    4080:	68 06 5d 00 00       	push   $0x5d06
+    4085:	ff 35 c0 71 00 00    	push   0x71c0
+    408b:	e8 00 07 00 00       	call   4790 <printf>
+    exit();
+    4090:	e8 2f 05 00 00       	call   45c4 <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    4095:	52                   	push   %edx
+    4096:	52                   	push   %edx
+    4097:	68 ed 5c 00 00       	push   $0x5ced
+    409c:	ff 35 c0 71 00 00    	push   0x71c0
+    40a2:	e8 e9 06 00 00       	call   4790 <printf>
+    exit();
+    40a7:	e8 18 05 00 00       	call   45c4 <exit>
+    40ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000040b0 <fsfull>:
+{
+    40b0:	55                   	push   %ebp
+    40b1:	89 e5                	mov    %esp,%ebp
+    40b3:	57                   	push   %edi
+    40b4:	56                   	push   %esi
+  for(nfiles = 0; ; nfiles++){
+    40b5:	31 f6                	xor    %esi,%esi
+{
+    40b7:	53                   	push   %ebx
+    40b8:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "fsfull test\n");
+    40bb:	68 1b 5d 00 00       	push   $0x5d1b
+    40c0:	6a 01                	push   $0x1
+    40c2:	e8 c9 06 00 00       	call   4790 <printf>
+    40c7:	83 c4 10             	add    $0x10,%esp
+    40ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    40d0:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    40d5:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    printf(1, "writing %s\n", name);
+    40da:	83 ec 04             	sub    $0x4,%esp
+    name[0] = 'f';
+    40dd:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    40e1:	f7 e6                	mul    %esi
+    name[5] = '\0';
+    40e3:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    40e7:	c1 ea 06             	shr    $0x6,%edx
+    40ea:	8d 42 30             	lea    0x30(%edx),%eax
+    40ed:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    40f0:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    40f6:	89 f2                	mov    %esi,%edx
+    40f8:	29 c2                	sub    %eax,%edx
+    40fa:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    40ff:	f7 e2                	mul    %edx
+    name[3] = '0' + (nfiles % 100) / 10;
+    4101:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4106:	c1 ea 05             	shr    $0x5,%edx
+    4109:	83 c2 30             	add    $0x30,%edx
+    410c:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    410f:	f7 e6                	mul    %esi
+    4111:	c1 ea 05             	shr    $0x5,%edx
+    4114:	6b c2 64             	imul   $0x64,%edx,%eax
+    4117:	89 f2                	mov    %esi,%edx
+    4119:	29 c2                	sub    %eax,%edx
+    411b:	89 d0                	mov    %edx,%eax
+    411d:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    411f:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    4121:	c1 ea 03             	shr    $0x3,%edx
+    4124:	83 c2 30             	add    $0x30,%edx
+    4127:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    412a:	f7 e1                	mul    %ecx
+    412c:	89 f0                	mov    %esi,%eax
+    412e:	c1 ea 03             	shr    $0x3,%edx
+    4131:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    4134:	01 d2                	add    %edx,%edx
+    4136:	29 d0                	sub    %edx,%eax
+    4138:	83 c0 30             	add    $0x30,%eax
+    413b:	88 45 ac             	mov    %al,-0x54(%ebp)
+    printf(1, "writing %s\n", name);
+    413e:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    4141:	50                   	push   %eax
+    4142:	68 28 5d 00 00       	push   $0x5d28
+    4147:	6a 01                	push   $0x1
+    4149:	e8 42 06 00 00       	call   4790 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    414e:	58                   	pop    %eax
+    414f:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    4152:	5a                   	pop    %edx
+    4153:	68 02 02 00 00       	push   $0x202
+    4158:	50                   	push   %eax
+    4159:	e8 a6 04 00 00       	call   4604 <open>
+    if(fd < 0){
+    415e:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    4161:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    4163:	85 c0                	test   %eax,%eax
+    4165:	78 4f                	js     41b6 <fsfull+0x106>
+    int total = 0;
+    4167:	31 db                	xor    %ebx,%ebx
+    4169:	eb 07                	jmp    4172 <fsfull+0xc2>
+    416b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    416f:	90                   	nop
+      total += cc;
+    4170:	01 c3                	add    %eax,%ebx
+      int cc = write(fd, buf, 512);
+    4172:	83 ec 04             	sub    $0x4,%esp
+    4175:	68 00 02 00 00       	push   $0x200
+    417a:	68 00 99 00 00       	push   $0x9900
+    417f:	57                   	push   %edi
+    4180:	e8 5f 04 00 00       	call   45e4 <write>
+      if(cc < 512)
+    4185:	83 c4 10             	add    $0x10,%esp
+    4188:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    418d:	7f e1                	jg     4170 <fsfull+0xc0>
+    printf(1, "wrote %d bytes\n", total);
+    418f:	83 ec 04             	sub    $0x4,%esp
+    4192:	53                   	push   %ebx
+    4193:	68 44 5d 00 00       	push   $0x5d44
+    4198:	6a 01                	push   $0x1
+    419a:	e8 f1 05 00 00       	call   4790 <printf>
+    close(fd);
+    419f:	89 3c 24             	mov    %edi,(%esp)
+    41a2:	e8 45 04 00 00       	call   45ec <close>
+    if(total == 0)
+    41a7:	83 c4 10             	add    $0x10,%esp
+    41aa:	85 db                	test   %ebx,%ebx
+    41ac:	74 1e                	je     41cc <fsfull+0x11c>
+  for(nfiles = 0; ; nfiles++){
+    41ae:	83 c6 01             	add    $0x1,%esi
+    41b1:	e9 1a ff ff ff       	jmp    40d0 <fsfull+0x20>
+      printf(1, "open %s failed\n", name);
+    41b6:	83 ec 04             	sub    $0x4,%esp
+    41b9:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    41bc:	50                   	push   %eax
+    41bd:	68 34 5d 00 00       	push   $0x5d34
+    41c2:	6a 01                	push   $0x1
+    41c4:	e8 c7 05 00 00       	call   4790 <printf>
+      break;
+    41c9:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + nfiles / 1000;
+    41cc:	bf d3 4d 62 10       	mov    $0x10624dd3,%edi
+    name[2] = '0' + (nfiles % 1000) / 100;
+    41d1:	bb 1f 85 eb 51       	mov    $0x51eb851f,%ebx
+    41d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    41dd:	8d 76 00             	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    41e0:	89 f0                	mov    %esi,%eax
+    unlink(name);
+    41e2:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'f';
+    41e5:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    41e9:	f7 e7                	mul    %edi
+    name[5] = '\0';
+    41eb:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    41ef:	c1 ea 06             	shr    $0x6,%edx
+    41f2:	8d 42 30             	lea    0x30(%edx),%eax
+    41f5:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    41f8:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    41fe:	89 f2                	mov    %esi,%edx
+    4200:	29 c2                	sub    %eax,%edx
+    4202:	89 d0                	mov    %edx,%eax
+    4204:	f7 e3                	mul    %ebx
+    name[3] = '0' + (nfiles % 100) / 10;
+    4206:	89 f0                	mov    %esi,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4208:	c1 ea 05             	shr    $0x5,%edx
+    420b:	83 c2 30             	add    $0x30,%edx
+    420e:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    4211:	f7 e3                	mul    %ebx
+    4213:	c1 ea 05             	shr    $0x5,%edx
+    4216:	6b ca 64             	imul   $0x64,%edx,%ecx
+    4219:	89 f2                	mov    %esi,%edx
+    421b:	29 ca                	sub    %ecx,%edx
+    421d:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    4222:	89 d0                	mov    %edx,%eax
+    4224:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    4226:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    4228:	c1 ea 03             	shr    $0x3,%edx
+    422b:	83 c2 30             	add    $0x30,%edx
+    422e:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    4231:	f7 e1                	mul    %ecx
+    4233:	89 f0                	mov    %esi,%eax
+    nfiles--;
+    4235:	83 ee 01             	sub    $0x1,%esi
+    name[4] = '0' + (nfiles % 10);
+    4238:	c1 ea 03             	shr    $0x3,%edx
+    423b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    423e:	01 d2                	add    %edx,%edx
+    4240:	29 d0                	sub    %edx,%eax
+    4242:	83 c0 30             	add    $0x30,%eax
+    4245:	88 45 ac             	mov    %al,-0x54(%ebp)
+    unlink(name);
+    4248:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    424b:	50                   	push   %eax
+    424c:	e8 c3 03 00 00       	call   4614 <unlink>
+  while(nfiles >= 0){
+    4251:	83 c4 10             	add    $0x10,%esp
+    4254:	83 fe ff             	cmp    $0xffffffff,%esi
+    4257:	75 87                	jne    41e0 <fsfull+0x130>
+  printf(1, "fsfull test finished\n");
+    4259:	83 ec 08             	sub    $0x8,%esp
+    425c:	68 54 5d 00 00       	push   $0x5d54
+    4261:	6a 01                	push   $0x1
+    4263:	e8 28 05 00 00       	call   4790 <printf>
+}
+    4268:	83 c4 10             	add    $0x10,%esp
+    426b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    426e:	5b                   	pop    %ebx
+    426f:	5e                   	pop    %esi
+    4270:	5f                   	pop    %edi
+    4271:	5d                   	pop    %ebp
+    4272:	c3                   	ret
+    4273:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    427a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00004280 <uio>:
+{
+    4280:	55                   	push   %ebp
+    4281:	89 e5                	mov    %esp,%ebp
+    4283:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "uio test\n");
+    4286:	68 6a 5d 00 00       	push   $0x5d6a
+    428b:	6a 01                	push   $0x1
+    428d:	e8 fe 04 00 00       	call   4790 <printf>
+  pid = fork();
+    4292:	e8 25 03 00 00       	call   45bc <fork>
+  if(pid == 0){
+    4297:	83 c4 10             	add    $0x10,%esp
+    429a:	85 c0                	test   %eax,%eax
+    429c:	74 1b                	je     42b9 <uio+0x39>
+  } else if(pid < 0){
+    429e:	78 3d                	js     42dd <uio+0x5d>
+  wait();
+    42a0:	e8 27 03 00 00       	call   45cc <wait>
+  printf(1, "uio test done\n");
+    42a5:	83 ec 08             	sub    $0x8,%esp
+    42a8:	68 74 5d 00 00       	push   $0x5d74
+    42ad:	6a 01                	push   $0x1
+    42af:	e8 dc 04 00 00       	call   4790 <printf>
+}
+    42b4:	83 c4 10             	add    $0x10,%esp
+    42b7:	c9                   	leave
+    42b8:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    42b9:	b8 09 00 00 00       	mov    $0x9,%eax
+    42be:	ba 70 00 00 00       	mov    $0x70,%edx
+    42c3:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    42c4:	ba 71 00 00 00       	mov    $0x71,%edx
+    42c9:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    42ca:	52                   	push   %edx
+    42cb:	52                   	push   %edx
+    42cc:	68 40 66 00 00       	push   $0x6640
+    42d1:	6a 01                	push   $0x1
+    42d3:	e8 b8 04 00 00       	call   4790 <printf>
+    exit();
+    42d8:	e8 e7 02 00 00       	call   45c4 <exit>
+    printf (1, "fork failed\n");
+    42dd:	50                   	push   %eax
+    42de:	50                   	push   %eax
+    42df:	68 f9 5c 00 00       	push   $0x5cf9
+    42e4:	6a 01                	push   $0x1
+    42e6:	e8 a5 04 00 00       	call   4790 <printf>
+    exit();
+    42eb:	e8 d4 02 00 00       	call   45c4 <exit>
+
+000042f0 <argptest>:
+{
+    42f0:	55                   	push   %ebp
+    42f1:	89 e5                	mov    %esp,%ebp
+    42f3:	53                   	push   %ebx
+    42f4:	83 ec 0c             	sub    $0xc,%esp
+  fd = open("init", O_RDONLY);
+    42f7:	6a 00                	push   $0x0
+    42f9:	68 83 5d 00 00       	push   $0x5d83
+    42fe:	e8 01 03 00 00       	call   4604 <open>
+  if (fd < 0) {
+    4303:	83 c4 10             	add    $0x10,%esp
+    4306:	85 c0                	test   %eax,%eax
+    4308:	78 39                	js     4343 <argptest+0x53>
+  read(fd, sbrk(0) - 1, -1);
+    430a:	83 ec 0c             	sub    $0xc,%esp
+    430d:	89 c3                	mov    %eax,%ebx
+    430f:	6a 00                	push   $0x0
+    4311:	e8 36 03 00 00       	call   464c <sbrk>
+    4316:	83 c4 0c             	add    $0xc,%esp
+    4319:	83 e8 01             	sub    $0x1,%eax
+    431c:	6a ff                	push   $0xffffffff
+    431e:	50                   	push   %eax
+    431f:	53                   	push   %ebx
+    4320:	e8 b7 02 00 00       	call   45dc <read>
+  close(fd);
+    4325:	89 1c 24             	mov    %ebx,(%esp)
+    4328:	e8 bf 02 00 00       	call   45ec <close>
+  printf(1, "arg test passed\n");
+    432d:	58                   	pop    %eax
+    432e:	5a                   	pop    %edx
+    432f:	68 88 5d 00 00       	push   $0x5d88
+    4334:	6a 01                	push   $0x1
+    4336:	e8 55 04 00 00       	call   4790 <printf>
+}
+    433b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    433e:	83 c4 10             	add    $0x10,%esp
+    4341:	c9                   	leave
+    4342:	c3                   	ret
+    printf(2, "open failed\n");
+    4343:	51                   	push   %ecx
+    4344:	51                   	push   %ecx
+    4345:	68 2f 52 00 00       	push   $0x522f
+    434a:	6a 02                	push   $0x2
+    434c:	e8 3f 04 00 00       	call   4790 <printf>
+    exit();
+    4351:	e8 6e 02 00 00       	call   45c4 <exit>
+    4356:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    435d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004360 <rand>:
+  randstate = randstate * 1664525 + 1013904223;
+    4360:	69 05 60 71 00 00 0d 	imul   $0x19660d,0x7160,%eax
+    4367:	66 19 00 
+    436a:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    436f:	a3 60 71 00 00       	mov    %eax,0x7160
+}
+    4374:	c3                   	ret
+    4375:	66 90                	xchg   %ax,%ax
+    4377:	66 90                	xchg   %ax,%ax
+    4379:	66 90                	xchg   %ax,%ax
+    437b:	66 90                	xchg   %ax,%ax
+    437d:	66 90                	xchg   %ax,%ax
+    437f:	90                   	nop
+
+00004380 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+    4380:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    4381:	31 c0                	xor    %eax,%eax
+{
+    4383:	89 e5                	mov    %esp,%ebp
+    4385:	53                   	push   %ebx
+    4386:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    4389:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    438c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    4390:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    4394:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    4397:	83 c0 01             	add    $0x1,%eax
+    439a:	84 d2                	test   %dl,%dl
+    439c:	75 f2                	jne    4390 <strcpy+0x10>
+    ;
+  return os;
+}
+    439e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    43a1:	89 c8                	mov    %ecx,%eax
+    43a3:	c9                   	leave
+    43a4:	c3                   	ret
+    43a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    43ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000043b0 <strlen>:
+
+uint
+strlen(char *s)
+{
+    43b0:	55                   	push   %ebp
+    43b1:	89 e5                	mov    %esp,%ebp
+    43b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    43b6:	80 3a 00             	cmpb   $0x0,(%edx)
+    43b9:	74 15                	je     43d0 <strlen+0x20>
+    43bb:	31 c0                	xor    %eax,%eax
+    43bd:	8d 76 00             	lea    0x0(%esi),%esi
+    43c0:	83 c0 01             	add    $0x1,%eax
+    43c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    43c7:	89 c1                	mov    %eax,%ecx
+    43c9:	75 f5                	jne    43c0 <strlen+0x10>
+    ;
+  return n;
+}
+    43cb:	89 c8                	mov    %ecx,%eax
+    43cd:	5d                   	pop    %ebp
+    43ce:	c3                   	ret
+    43cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+    43d0:	31 c9                	xor    %ecx,%ecx
+}
+    43d2:	5d                   	pop    %ebp
+    43d3:	89 c8                	mov    %ecx,%eax
+    43d5:	c3                   	ret
+    43d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    43dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000043e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    43e0:	55                   	push   %ebp
+    43e1:	89 e5                	mov    %esp,%ebp
+    43e3:	57                   	push   %edi
+    43e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    43e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    43ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+    43ed:	89 d7                	mov    %edx,%edi
+    43ef:	fc                   	cld
+    43f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    43f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    43f5:	89 d0                	mov    %edx,%eax
+    43f7:	c9                   	leave
+    43f8:	c3                   	ret
+    43f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00004400 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    4400:	55                   	push   %ebp
+    4401:	89 e5                	mov    %esp,%ebp
+    4403:	8b 45 08             	mov    0x8(%ebp),%eax
+    4406:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    440a:	0f b6 10             	movzbl (%eax),%edx
+    440d:	84 d2                	test   %dl,%dl
+    440f:	75 12                	jne    4423 <strchr+0x23>
+    4411:	eb 1d                	jmp    4430 <strchr+0x30>
+    4413:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4417:	90                   	nop
+    4418:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    441c:	83 c0 01             	add    $0x1,%eax
+    441f:	84 d2                	test   %dl,%dl
+    4421:	74 0d                	je     4430 <strchr+0x30>
+    if(*s == c)
+    4423:	38 d1                	cmp    %dl,%cl
+    4425:	75 f1                	jne    4418 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    4427:	5d                   	pop    %ebp
+    4428:	c3                   	ret
+    4429:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    4430:	31 c0                	xor    %eax,%eax
+}
+    4432:	5d                   	pop    %ebp
+    4433:	c3                   	ret
+    4434:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    443b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    443f:	90                   	nop
+
+00004440 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    4440:	55                   	push   %ebp
+    4441:	89 e5                	mov    %esp,%ebp
+    4443:	57                   	push   %edi
+    4444:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    4445:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    4448:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    4449:	31 db                	xor    %ebx,%ebx
+{
+    444b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    444e:	eb 27                	jmp    4477 <gets+0x37>
+    cc = read(0, &c, 1);
+    4450:	83 ec 04             	sub    $0x4,%esp
+    4453:	6a 01                	push   $0x1
+    4455:	56                   	push   %esi
+    4456:	6a 00                	push   $0x0
+    4458:	e8 7f 01 00 00       	call   45dc <read>
+    if(cc < 1)
+    445d:	83 c4 10             	add    $0x10,%esp
+    4460:	85 c0                	test   %eax,%eax
+    4462:	7e 1d                	jle    4481 <gets+0x41>
+      break;
+    buf[i++] = c;
+    4464:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    4468:	8b 55 08             	mov    0x8(%ebp),%edx
+    446b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    446f:	3c 0a                	cmp    $0xa,%al
+    4471:	74 10                	je     4483 <gets+0x43>
+    4473:	3c 0d                	cmp    $0xd,%al
+    4475:	74 0c                	je     4483 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    4477:	89 df                	mov    %ebx,%edi
+    4479:	83 c3 01             	add    $0x1,%ebx
+    447c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    447f:	7c cf                	jl     4450 <gets+0x10>
+    4481:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    4483:	8b 45 08             	mov    0x8(%ebp),%eax
+    4486:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    448a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    448d:	5b                   	pop    %ebx
+    448e:	5e                   	pop    %esi
+    448f:	5f                   	pop    %edi
+    4490:	5d                   	pop    %ebp
+    4491:	c3                   	ret
+    4492:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4499:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000044a0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    44a0:	55                   	push   %ebp
+    44a1:	89 e5                	mov    %esp,%ebp
+    44a3:	56                   	push   %esi
+    44a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    44a5:	83 ec 08             	sub    $0x8,%esp
+    44a8:	6a 00                	push   $0x0
+    44aa:	ff 75 08             	push   0x8(%ebp)
+    44ad:	e8 52 01 00 00       	call   4604 <open>
+  if(fd < 0)
+    44b2:	83 c4 10             	add    $0x10,%esp
+    44b5:	85 c0                	test   %eax,%eax
+    44b7:	78 27                	js     44e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    44b9:	83 ec 08             	sub    $0x8,%esp
+    44bc:	ff 75 0c             	push   0xc(%ebp)
+    44bf:	89 c3                	mov    %eax,%ebx
+    44c1:	50                   	push   %eax
+    44c2:	e8 55 01 00 00       	call   461c <fstat>
+  close(fd);
+    44c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    44ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+    44cc:	e8 1b 01 00 00       	call   45ec <close>
+  return r;
+    44d1:	83 c4 10             	add    $0x10,%esp
+}
+    44d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    44d7:	89 f0                	mov    %esi,%eax
+    44d9:	5b                   	pop    %ebx
+    44da:	5e                   	pop    %esi
+    44db:	5d                   	pop    %ebp
+    44dc:	c3                   	ret
+    44dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    44e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    44e5:	eb ed                	jmp    44d4 <stat+0x34>
+    44e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    44ee:	66 90                	xchg   %ax,%ax
+
+000044f0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    44f0:	55                   	push   %ebp
+    44f1:	89 e5                	mov    %esp,%ebp
+    44f3:	57                   	push   %edi
+    44f4:	56                   	push   %esi
+    44f5:	8b 45 10             	mov    0x10(%ebp),%eax
+    44f8:	8b 55 08             	mov    0x8(%ebp),%edx
+    44fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    44fe:	85 c0                	test   %eax,%eax
+    4500:	7e 13                	jle    4515 <memmove+0x25>
+    4502:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    4504:	89 d7                	mov    %edx,%edi
+    4506:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    450d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    4510:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    4511:	39 f8                	cmp    %edi,%eax
+    4513:	75 fb                	jne    4510 <memmove+0x20>
+  return vdst;
+}
+    4515:	5e                   	pop    %esi
+    4516:	89 d0                	mov    %edx,%eax
+    4518:	5f                   	pop    %edi
+    4519:	5d                   	pop    %ebp
+    451a:	c3                   	ret
+    451b:	66 90                	xchg   %ax,%ax
+    451d:	66 90                	xchg   %ax,%ax
+    451f:	90                   	nop
+
+00004520 <strcmp>:
+#include "types.h"
+#include "util.h"
+
+int
+strcmp(const char *p, const char *q)
+{
+    4520:	55                   	push   %ebp
+    4521:	89 e5                	mov    %esp,%ebp
+    4523:	53                   	push   %ebx
+    4524:	8b 55 08             	mov    0x8(%ebp),%edx
+    4527:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    452a:	0f b6 02             	movzbl (%edx),%eax
+    452d:	84 c0                	test   %al,%al
+    452f:	75 17                	jne    4548 <strcmp+0x28>
+    4531:	eb 3a                	jmp    456d <strcmp+0x4d>
+    4533:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4537:	90                   	nop
+    4538:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    453c:	83 c2 01             	add    $0x1,%edx
+    453f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    4542:	84 c0                	test   %al,%al
+    4544:	74 1a                	je     4560 <strcmp+0x40>
+    p++, q++;
+    4546:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    4548:	0f b6 19             	movzbl (%ecx),%ebx
+    454b:	38 c3                	cmp    %al,%bl
+    454d:	74 e9                	je     4538 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    454f:	29 d8                	sub    %ebx,%eax
+}
+    4551:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4554:	c9                   	leave
+    4555:	c3                   	ret
+    4556:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    455d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    4560:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    4564:	31 c0                	xor    %eax,%eax
+    4566:	29 d8                	sub    %ebx,%eax
+}
+    4568:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    456b:	c9                   	leave
+    456c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    456d:	0f b6 19             	movzbl (%ecx),%ebx
+    4570:	31 c0                	xor    %eax,%eax
+    4572:	eb db                	jmp    454f <strcmp+0x2f>
+    4574:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    457b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    457f:	90                   	nop
+
+00004580 <atoi>:
+
+int
+atoi(const char *s)
+{
+    4580:	55                   	push   %ebp
+    4581:	89 e5                	mov    %esp,%ebp
+    4583:	53                   	push   %ebx
+    4584:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    4587:	0f be 02             	movsbl (%edx),%eax
+    458a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    458d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    4590:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    4595:	77 1e                	ja     45b5 <atoi+0x35>
+    4597:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    459e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    45a0:	83 c2 01             	add    $0x1,%edx
+    45a3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    45a6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    45aa:	0f be 02             	movsbl (%edx),%eax
+    45ad:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    45b0:	80 fb 09             	cmp    $0x9,%bl
+    45b3:	76 eb                	jbe    45a0 <atoi+0x20>
+  return n;
+    45b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    45b8:	89 c8                	mov    %ecx,%eax
+    45ba:	c9                   	leave
+    45bb:	c3                   	ret
+
+000045bc <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    45bc:	b8 01 00 00 00       	mov    $0x1,%eax
+    45c1:	cd 40                	int    $0x40
+    45c3:	c3                   	ret
+
+000045c4 <exit>:
+SYSCALL(exit)
+    45c4:	b8 02 00 00 00       	mov    $0x2,%eax
+    45c9:	cd 40                	int    $0x40
+    45cb:	c3                   	ret
+
+000045cc <wait>:
+SYSCALL(wait)
+    45cc:	b8 03 00 00 00       	mov    $0x3,%eax
+    45d1:	cd 40                	int    $0x40
+    45d3:	c3                   	ret
+
+000045d4 <pipe>:
+SYSCALL(pipe)
+    45d4:	b8 04 00 00 00       	mov    $0x4,%eax
+    45d9:	cd 40                	int    $0x40
+    45db:	c3                   	ret
+
+000045dc <read>:
+SYSCALL(read)
+    45dc:	b8 05 00 00 00       	mov    $0x5,%eax
+    45e1:	cd 40                	int    $0x40
+    45e3:	c3                   	ret
+
+000045e4 <write>:
+SYSCALL(write)
+    45e4:	b8 10 00 00 00       	mov    $0x10,%eax
+    45e9:	cd 40                	int    $0x40
+    45eb:	c3                   	ret
+
+000045ec <close>:
+SYSCALL(close)
+    45ec:	b8 15 00 00 00       	mov    $0x15,%eax
+    45f1:	cd 40                	int    $0x40
+    45f3:	c3                   	ret
+
+000045f4 <kill>:
+SYSCALL(kill)
+    45f4:	b8 06 00 00 00       	mov    $0x6,%eax
+    45f9:	cd 40                	int    $0x40
+    45fb:	c3                   	ret
+
+000045fc <exec>:
+SYSCALL(exec)
+    45fc:	b8 07 00 00 00       	mov    $0x7,%eax
+    4601:	cd 40                	int    $0x40
+    4603:	c3                   	ret
+
+00004604 <open>:
+SYSCALL(open)
+    4604:	b8 0f 00 00 00       	mov    $0xf,%eax
+    4609:	cd 40                	int    $0x40
+    460b:	c3                   	ret
+
+0000460c <mknod>:
+SYSCALL(mknod)
+    460c:	b8 11 00 00 00       	mov    $0x11,%eax
+    4611:	cd 40                	int    $0x40
+    4613:	c3                   	ret
+
+00004614 <unlink>:
+SYSCALL(unlink)
+    4614:	b8 12 00 00 00       	mov    $0x12,%eax
+    4619:	cd 40                	int    $0x40
+    461b:	c3                   	ret
+
+0000461c <fstat>:
+SYSCALL(fstat)
+    461c:	b8 08 00 00 00       	mov    $0x8,%eax
+    4621:	cd 40                	int    $0x40
+    4623:	c3                   	ret
+
+00004624 <link>:
+SYSCALL(link)
+    4624:	b8 13 00 00 00       	mov    $0x13,%eax
+    4629:	cd 40                	int    $0x40
+    462b:	c3                   	ret
+
+0000462c <mkdir>:
+SYSCALL(mkdir)
+    462c:	b8 14 00 00 00       	mov    $0x14,%eax
+    4631:	cd 40                	int    $0x40
+    4633:	c3                   	ret
+
+00004634 <chdir>:
+SYSCALL(chdir)
+    4634:	b8 09 00 00 00       	mov    $0x9,%eax
+    4639:	cd 40                	int    $0x40
+    463b:	c3                   	ret
+
+0000463c <dup>:
+SYSCALL(dup)
+    463c:	b8 0a 00 00 00       	mov    $0xa,%eax
+    4641:	cd 40                	int    $0x40
+    4643:	c3                   	ret
+
+00004644 <getpid>:
+SYSCALL(getpid)
+    4644:	b8 0b 00 00 00       	mov    $0xb,%eax
+    4649:	cd 40                	int    $0x40
+    464b:	c3                   	ret
+
+0000464c <sbrk>:
+SYSCALL(sbrk)
+    464c:	b8 0c 00 00 00       	mov    $0xc,%eax
+    4651:	cd 40                	int    $0x40
+    4653:	c3                   	ret
+
+00004654 <sleep>:
+SYSCALL(sleep)
+    4654:	b8 0d 00 00 00       	mov    $0xd,%eax
+    4659:	cd 40                	int    $0x40
+    465b:	c3                   	ret
+
+0000465c <uptime>:
+SYSCALL(uptime)
+    465c:	b8 0e 00 00 00       	mov    $0xe,%eax
+    4661:	cd 40                	int    $0x40
+    4663:	c3                   	ret
+
+00004664 <arp>:
+SYSCALL(arp)
+    4664:	b8 16 00 00 00       	mov    $0x16,%eax
+    4669:	cd 40                	int    $0x40
+    466b:	c3                   	ret
+
+0000466c <mmap>:
+SYSCALL(mmap)
+    466c:	b8 17 00 00 00       	mov    $0x17,%eax
+    4671:	cd 40                	int    $0x40
+    4673:	c3                   	ret
+
+00004674 <munmap>:
+SYSCALL(munmap)
+    4674:	b8 18 00 00 00       	mov    $0x18,%eax
+    4679:	cd 40                	int    $0x40
+    467b:	c3                   	ret
+
+0000467c <msync>:
+SYSCALL(msync)
+    467c:	b8 19 00 00 00       	mov    $0x19,%eax
+    4681:	cd 40                	int    $0x40
+    4683:	c3                   	ret
+
+00004684 <shmcreate>:
+SYSCALL(shmcreate)
+    4684:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    4689:	cd 40                	int    $0x40
+    468b:	c3                   	ret
+
+0000468c <shmattach>:
+SYSCALL(shmattach)
+    468c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    4691:	cd 40                	int    $0x40
+    4693:	c3                   	ret
+
+00004694 <shmdetach>:
+SYSCALL(shmdetach)
+    4694:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    4699:	cd 40                	int    $0x40
+    469b:	c3                   	ret
+
+0000469c <futex_wait>:
+SYSCALL(futex_wait)
+    469c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    46a1:	cd 40                	int    $0x40
+    46a3:	c3                   	ret
+
+000046a4 <futex_wake>:
+SYSCALL(futex_wake)
+    46a4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    46a9:	cd 40                	int    $0x40
+    46ab:	c3                   	ret
+
+000046ac <nice>:
+SYSCALL(nice)
+    46ac:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    46b1:	cd 40                	int    $0x40
+    46b3:	c3                   	ret
+
+000046b4 <setpriority>:
+SYSCALL(setpriority)
+    46b4:	b8 20 00 00 00       	mov    $0x20,%eax
+    46b9:	cd 40                	int    $0x40
+    46bb:	c3                   	ret
+
+000046bc <cputime>:
+SYSCALL(cputime)
+    46bc:	b8 21 00 00 00       	mov    $0x21,%eax
+    46c1:	cd 40                	int    $0x40
+    46c3:	c3                   	ret
+
+000046c4 <clock_gettime>:
+SYSCALL(clock_gettime)
+    46c4:	b8 22 00 00 00       	mov    $0x22,%eax
+    46c9:	cd 40                	int    $0x40
+    46cb:	c3                   	ret
+
+000046cc <clone>:
+SYSCALL(clone)
+    46cc:	b8 23 00 00 00       	mov    $0x23,%eax
+    46d1:	cd 40                	int    $0x40
+    46d3:	c3                   	ret
+
+000046d4 <join>:
+SYSCALL(join)
+    46d4:	b8 24 00 00 00       	mov    $0x24,%eax
+    46d9:	cd 40                	int    $0x40
+    46db:	c3                   	ret
+
+000046dc <lockstat>:
+SYSCALL(lockstat)
+    46dc:	b8 25 00 00 00       	mov    $0x25,%eax
+    46e1:	cd 40                	int    $0x40
+    46e3:	c3                   	ret
+    46e4:	66 90                	xchg   %ax,%ax
+    46e6:	66 90                	xchg   %ax,%ax
+    46e8:	66 90                	xchg   %ax,%ax
+    46ea:	66 90                	xchg   %ax,%ax
+    46ec:	66 90                	xchg   %ax,%ax
+    46ee:	66 90                	xchg   %ax,%ax
+
+000046f0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    46f0:	55                   	push   %ebp
+    46f1:	89 e5                	mov    %esp,%ebp
+    46f3:	57                   	push   %edi
+    46f4:	56                   	push   %esi
+    46f5:	53                   	push   %ebx
+    46f6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    46f8:	89 d1                	mov    %edx,%ecx
+{
+    46fa:	83 ec 3c             	sub    $0x3c,%esp
+    46fd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    4700:	85 d2                	test   %edx,%edx
+    4702:	0f 89 80 00 00 00    	jns    4788 <printint+0x98>
+    4708:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    470c:	74 7a                	je     4788 <printint+0x98>
+    x = -xx;
+    470e:	f7 d9                	neg    %ecx
+    neg = 1;
+    4710:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    4715:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    4718:	31 f6                	xor    %esi,%esi
+    471a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    4720:	89 c8                	mov    %ecx,%eax
+    4722:	31 d2                	xor    %edx,%edx
+    4724:	89 f7                	mov    %esi,%edi
+    4726:	f7 f3                	div    %ebx
+    4728:	8d 76 01             	lea    0x1(%esi),%esi
+    472b:	0f b6 92 f0 66 00 00 	movzbl 0x66f0(%edx),%edx
+    4732:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    4736:	89 ca                	mov    %ecx,%edx
+    4738:	89 c1                	mov    %eax,%ecx
+    473a:	39 da                	cmp    %ebx,%edx
+    473c:	73 e2                	jae    4720 <printint+0x30>
+  if(neg)
+    473e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    4741:	85 c0                	test   %eax,%eax
+    4743:	74 07                	je     474c <printint+0x5c>
+    buf[i++] = '-';
+    4745:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    474a:	89 f7                	mov    %esi,%edi
+    474c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    474f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    4752:	01 df                	add    %ebx,%edi
+    4754:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    4758:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    475b:	83 ec 04             	sub    $0x4,%esp
+    475e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    4761:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    4764:	6a 01                	push   $0x1
+    4766:	50                   	push   %eax
+    4767:	56                   	push   %esi
+    4768:	e8 77 fe ff ff       	call   45e4 <write>
+  while(--i >= 0)
+    476d:	89 f8                	mov    %edi,%eax
+    476f:	83 c4 10             	add    $0x10,%esp
+    4772:	83 ef 01             	sub    $0x1,%edi
+    4775:	39 d8                	cmp    %ebx,%eax
+    4777:	75 df                	jne    4758 <printint+0x68>
+}
+    4779:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    477c:	5b                   	pop    %ebx
+    477d:	5e                   	pop    %esi
+    477e:	5f                   	pop    %edi
+    477f:	5d                   	pop    %ebp
+    4780:	c3                   	ret
+    4781:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    4788:	31 c0                	xor    %eax,%eax
+    478a:	eb 89                	jmp    4715 <printint+0x25>
+    478c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004790 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    4790:	55                   	push   %ebp
+    4791:	89 e5                	mov    %esp,%ebp
+    4793:	57                   	push   %edi
+    4794:	56                   	push   %esi
+    4795:	53                   	push   %ebx
+    4796:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    4799:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    479c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    479f:	0f b6 1e             	movzbl (%esi),%ebx
+    47a2:	83 c6 01             	add    $0x1,%esi
+    47a5:	84 db                	test   %bl,%bl
+    47a7:	74 67                	je     4810 <printf+0x80>
+    47a9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    47ac:	31 d2                	xor    %edx,%edx
+    47ae:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    47b1:	eb 34                	jmp    47e7 <printf+0x57>
+    47b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    47b7:	90                   	nop
+    47b8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    47bb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    47c0:	83 f8 25             	cmp    $0x25,%eax
+    47c3:	74 18                	je     47dd <printf+0x4d>
+  write(fd, &c, 1);
+    47c5:	83 ec 04             	sub    $0x4,%esp
+    47c8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    47cb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    47ce:	6a 01                	push   $0x1
+    47d0:	50                   	push   %eax
+    47d1:	57                   	push   %edi
+    47d2:	e8 0d fe ff ff       	call   45e4 <write>
+    47d7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    47da:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    47dd:	0f b6 1e             	movzbl (%esi),%ebx
+    47e0:	83 c6 01             	add    $0x1,%esi
+    47e3:	84 db                	test   %bl,%bl
+    47e5:	74 29                	je     4810 <printf+0x80>
+    c = fmt[i] & 0xff;
+    47e7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    47ea:	85 d2                	test   %edx,%edx
+    47ec:	74 ca                	je     47b8 <printf+0x28>
+      }
+    } else if(state == '%'){
+    47ee:	83 fa 25             	cmp    $0x25,%edx
+    47f1:	75 ea                	jne    47dd <printf+0x4d>
+      if(c == 'd'){
+    47f3:	83 f8 25             	cmp    $0x25,%eax
+    47f6:	0f 84 24 01 00 00    	je     4920 <printf+0x190>
+    47fc:	83 e8 63             	sub    $0x63,%eax
+    47ff:	83 f8 15             	cmp    $0x15,%eax
+    4802:	77 1c                	ja     4820 <printf+0x90>
+    4804:	ff 24 85 98 66 00 00 	jmp    *0x6698(,%eax,4)
+    480b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    480f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    4810:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4813:	5b                   	pop    %ebx
+    4814:	5e                   	pop    %esi
+    4815:	5f                   	pop    %edi
+    4816:	5d                   	pop    %ebp
+    4817:	c3                   	ret
+    4818:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    481f:	90                   	nop
+  write(fd, &c, 1);
+    4820:	83 ec 04             	sub    $0x4,%esp
+    4823:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4826:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    482a:	6a 01                	push   $0x1
+    482c:	52                   	push   %edx
+    482d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    4830:	57                   	push   %edi
+    4831:	e8 ae fd ff ff       	call   45e4 <write>
+    4836:	83 c4 0c             	add    $0xc,%esp
+    4839:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    483c:	6a 01                	push   $0x1
+    483e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    4841:	52                   	push   %edx
+    4842:	57                   	push   %edi
+    4843:	e8 9c fd ff ff       	call   45e4 <write>
+        putc(fd, c);
+    4848:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    484b:	31 d2                	xor    %edx,%edx
+    484d:	eb 8e                	jmp    47dd <printf+0x4d>
+    484f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    4850:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    4853:	83 ec 0c             	sub    $0xc,%esp
+    4856:	b9 10 00 00 00       	mov    $0x10,%ecx
+    485b:	8b 13                	mov    (%ebx),%edx
+    485d:	6a 00                	push   $0x0
+    485f:	89 f8                	mov    %edi,%eax
+        ap++;
+    4861:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    4864:	e8 87 fe ff ff       	call   46f0 <printint>
+        ap++;
+    4869:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    486c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    486f:	31 d2                	xor    %edx,%edx
+    4871:	e9 67 ff ff ff       	jmp    47dd <printf+0x4d>
+    4876:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    487d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    4880:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    4883:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    4885:	83 c0 04             	add    $0x4,%eax
+    4888:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    488b:	85 db                	test   %ebx,%ebx
+    488d:	0f 84 9d 00 00 00    	je     4930 <printf+0x1a0>
+        while(*s != 0){
+    4893:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    4896:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    4898:	84 c0                	test   %al,%al
+    489a:	0f 84 3d ff ff ff    	je     47dd <printf+0x4d>
+    48a0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    48a3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    48a6:	89 de                	mov    %ebx,%esi
+    48a8:	89 d3                	mov    %edx,%ebx
+    48aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    48b0:	83 ec 04             	sub    $0x4,%esp
+    48b3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    48b6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    48b9:	6a 01                	push   $0x1
+    48bb:	53                   	push   %ebx
+    48bc:	57                   	push   %edi
+    48bd:	e8 22 fd ff ff       	call   45e4 <write>
+        while(*s != 0){
+    48c2:	0f b6 06             	movzbl (%esi),%eax
+    48c5:	83 c4 10             	add    $0x10,%esp
+    48c8:	84 c0                	test   %al,%al
+    48ca:	75 e4                	jne    48b0 <printf+0x120>
+      state = 0;
+    48cc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    48cf:	31 d2                	xor    %edx,%edx
+    48d1:	e9 07 ff ff ff       	jmp    47dd <printf+0x4d>
+    48d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    48dd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    48e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    48e3:	83 ec 0c             	sub    $0xc,%esp
+    48e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    48eb:	8b 13                	mov    (%ebx),%edx
+    48ed:	6a 01                	push   $0x1
+    48ef:	e9 6b ff ff ff       	jmp    485f <printf+0xcf>
+    48f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    48f8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    48fb:	83 ec 04             	sub    $0x4,%esp
+    48fe:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    4901:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    4903:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    4906:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    4909:	6a 01                	push   $0x1
+    490b:	52                   	push   %edx
+    490c:	57                   	push   %edi
+    490d:	e8 d2 fc ff ff       	call   45e4 <write>
+        ap++;
+    4912:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    4915:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    4918:	31 d2                	xor    %edx,%edx
+    491a:	e9 be fe ff ff       	jmp    47dd <printf+0x4d>
+    491f:	90                   	nop
+  write(fd, &c, 1);
+    4920:	83 ec 04             	sub    $0x4,%esp
+    4923:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    4926:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4929:	6a 01                	push   $0x1
+    492b:	e9 11 ff ff ff       	jmp    4841 <printf+0xb1>
+    4930:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    4935:	bb 8e 66 00 00       	mov    $0x668e,%ebx
+    493a:	e9 61 ff ff ff       	jmp    48a0 <printf+0x110>
+    493f:	90                   	nop
+
+00004940 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    4940:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4941:	a1 80 b9 00 00       	mov    0xb980,%eax
+{
+    4946:	89 e5                	mov    %esp,%ebp
+    4948:	57                   	push   %edi
+    4949:	56                   	push   %esi
+    494a:	53                   	push   %ebx
+    494b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    494e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4951:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4958:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    495a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    495c:	39 ca                	cmp    %ecx,%edx
+    495e:	73 30                	jae    4990 <free+0x50>
+    4960:	39 c1                	cmp    %eax,%ecx
+    4962:	72 04                	jb     4968 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    4964:	39 c2                	cmp    %eax,%edx
+    4966:	72 f0                	jb     4958 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    4968:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    496b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    496e:	39 f8                	cmp    %edi,%eax
+    4970:	74 2e                	je     49a0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    4972:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    4975:	8b 42 04             	mov    0x4(%edx),%eax
+    4978:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    497b:	39 f1                	cmp    %esi,%ecx
+    497d:	74 38                	je     49b7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    497f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    4981:	5b                   	pop    %ebx
+  freep = p;
+    4982:	89 15 80 b9 00 00    	mov    %edx,0xb980
+}
+    4988:	5e                   	pop    %esi
+    4989:	5f                   	pop    %edi
+    498a:	5d                   	pop    %ebp
+    498b:	c3                   	ret
+    498c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    4990:	39 c1                	cmp    %eax,%ecx
+    4992:	72 d0                	jb     4964 <free+0x24>
+    4994:	eb c2                	jmp    4958 <free+0x18>
+    4996:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    499d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    49a0:	03 70 04             	add    0x4(%eax),%esi
+    49a3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    49a6:	8b 02                	mov    (%edx),%eax
+    49a8:	8b 00                	mov    (%eax),%eax
+    49aa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    49ad:	8b 42 04             	mov    0x4(%edx),%eax
+    49b0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    49b3:	39 f1                	cmp    %esi,%ecx
+    49b5:	75 c8                	jne    497f <free+0x3f>
+    p->s.size += bp->s.size;
+    49b7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    49ba:	89 15 80 b9 00 00    	mov    %edx,0xb980
+    p->s.size += bp->s.size;
+    49c0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    49c3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    49c6:	89 0a                	mov    %ecx,(%edx)
+}
+    49c8:	5b                   	pop    %ebx
+    49c9:	5e                   	pop    %esi
+    49ca:	5f                   	pop    %edi
+    49cb:	5d                   	pop    %ebp
+    49cc:	c3                   	ret
+    49cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000049d0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    49d0:	55                   	push   %ebp
+    49d1:	89 e5                	mov    %esp,%ebp
+    49d3:	57                   	push   %edi
+    49d4:	56                   	push   %esi
+    49d5:	53                   	push   %ebx
+    49d6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    49d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    49dc:	8b 15 80 b9 00 00    	mov    0xb980,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    49e2:	8d 78 07             	lea    0x7(%eax),%edi
+    49e5:	c1 ef 03             	shr    $0x3,%edi
+    49e8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    49eb:	85 d2                	test   %edx,%edx
+    49ed:	0f 84 8d 00 00 00    	je     4a80 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    49f3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    49f5:	8b 48 04             	mov    0x4(%eax),%ecx
+    49f8:	39 f9                	cmp    %edi,%ecx
+    49fa:	73 64                	jae    4a60 <malloc+0x90>
+  if(nu < 4096)
+    49fc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    4a01:	39 df                	cmp    %ebx,%edi
+    4a03:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    4a06:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    4a0d:	eb 0a                	jmp    4a19 <malloc+0x49>
+    4a0f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4a10:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    4a12:	8b 48 04             	mov    0x4(%eax),%ecx
+    4a15:	39 f9                	cmp    %edi,%ecx
+    4a17:	73 47                	jae    4a60 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    4a19:	89 c2                	mov    %eax,%edx
+    4a1b:	39 05 80 b9 00 00    	cmp    %eax,0xb980
+    4a21:	75 ed                	jne    4a10 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    4a23:	83 ec 0c             	sub    $0xc,%esp
+    4a26:	56                   	push   %esi
+    4a27:	e8 20 fc ff ff       	call   464c <sbrk>
+  if(p == (char*)-1)
+    4a2c:	83 c4 10             	add    $0x10,%esp
+    4a2f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4a32:	74 1c                	je     4a50 <malloc+0x80>
+  hp->s.size = nu;
+    4a34:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    4a37:	83 ec 0c             	sub    $0xc,%esp
+    4a3a:	83 c0 08             	add    $0x8,%eax
+    4a3d:	50                   	push   %eax
+    4a3e:	e8 fd fe ff ff       	call   4940 <free>
+  return freep;
+    4a43:	8b 15 80 b9 00 00    	mov    0xb980,%edx
+      if((p = morecore(nunits)) == 0)
+    4a49:	83 c4 10             	add    $0x10,%esp
+    4a4c:	85 d2                	test   %edx,%edx
+    4a4e:	75 c0                	jne    4a10 <malloc+0x40>
+        return 0;
+  }
+}
+    4a50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    4a53:	31 c0                	xor    %eax,%eax
+}
+    4a55:	5b                   	pop    %ebx
+    4a56:	5e                   	pop    %esi
+    4a57:	5f                   	pop    %edi
+    4a58:	5d                   	pop    %ebp
+    4a59:	c3                   	ret
+    4a5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    4a60:	39 cf                	cmp    %ecx,%edi
+    4a62:	74 4c                	je     4ab0 <malloc+0xe0>
+        p->s.size -= nunits;
+    4a64:	29 f9                	sub    %edi,%ecx
+    4a66:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    4a69:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    4a6c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    4a6f:	89 15 80 b9 00 00    	mov    %edx,0xb980
+}
+    4a75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    4a78:	83 c0 08             	add    $0x8,%eax
+}
+    4a7b:	5b                   	pop    %ebx
+    4a7c:	5e                   	pop    %esi
+    4a7d:	5f                   	pop    %edi
+    4a7e:	5d                   	pop    %ebp
+    4a7f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    4a80:	c7 05 80 b9 00 00 84 	movl   $0xb984,0xb980
+    4a87:	b9 00 00 
+    base.s.size = 0;
+    4a8a:	b8 84 b9 00 00       	mov    $0xb984,%eax
+    base.s.ptr = freep = prevp = &base;
+    4a8f:	c7 05 84 b9 00 00 84 	movl   $0xb984,0xb984
+    4a96:	b9 00 00 
+    base.s.size = 0;
+    4a99:	c7 05 88 b9 00 00 00 	movl   $0x0,0xb988
+    4aa0:	00 00 00 
+    if(p->s.size >= nunits){
+    4aa3:	e9 54 ff ff ff       	jmp    49fc <malloc+0x2c>
+    4aa8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4aaf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    4ab0:	8b 08                	mov    (%eax),%ecx
+    4ab2:	89 0a                	mov    %ecx,(%edx)
+    4ab4:	eb b9                	jmp    4a6f <malloc+0x9f>
@@ -4,6 +4,8 @@
 #include "user.h"
 #include "fs.h"
 #include "fcntl.h"
+#include "sched.h"
+#include "date.h"
 #include "syscall.h"
 #include "traps.h"
 #include "memlayout.h"
@@ -184,6 +186,9 @@ writetest(void)
   printf(stdout, "small file test ok\n");
 }
 
+// Blocks in the big file: enough to need the double-indirect block.
+#define NBIG (NDIRECT + NINDIRECT + 2)
+
 void
 writetest1(void)
 {
@@ -197,9 +202,9 @@ writetest1(void)
     exit();
   }
 
-  for(i = 0; i < MAXFILE; i++){
+  for(i = 0; i < NBIG; i++){
     ((int*)buf)[0] = i;
-    if(write(fd, buf, 512) != 512){
+    if(write(fd, buf, BSIZE) != BSIZE){
       printf(stdout, "error: write big file failed\n", i);
       exit();
     }
@@ -215,14 +220,14 @@ writetest1(void)
 
   n = 0;
   for(;;){
-    i = read(fd, buf, 512);
+    i = read(fd, buf, BSIZE);
     if(i == 0){
-      if(n == MAXFILE - 1){
+      if(n != NBIG){
         printf(stdout, "read only %d blocks from big", n);
         exit();
       }
       break;
-    } else if(i != 512){
+    } else if(i != BSIZE){
       printf(stdout, "read failed %d\n", i);
       exit();
     }
@@ -931,6 +936,173 @@ bigdir(void)
   printf(1, "bigdir ok\n");
 }
 
+// link and unlink names in one directory over and over, more
+// distinct names over time than its index has room for, so that
+// the index has to be rebuilt without the removed entries.
+// All the names are links to one file, to use a single inode.
+void
+dcname(char *name, int i)
+{
+  name[0] = 'c';
+  name[1] = '0' + (i / 64);
+  name[2] = '0' + (i % 64);
+  name[3] = '\0';
+}
+
+void
+dirchurn(void)
+{
+  int i, round, fd;
+  char name[4];
+
+  printf(1, "dirchurn test\n");
+  if(mkdir("dc") != 0 || chdir("dc") != 0){
+    printf(1, "dirchurn mkdir failed\n");
+    exit();
+  }
+  if((fd = open("f", O_CREATE)) < 0){
+    printf(1, "dirchurn create failed\n");
+    exit();
+  }
+  close(fd);
+  // 20 rounds of 80 names: 1600 distinct names, with at most 160
+  // of them there at once.  Each new name mostly takes a slot
+  // that has never been used, and the index fills up around
+  // round 16.
+  for(round = 0; round < 20; round++){
+    for(i = round*80; i < round*80 + 80; i++){
+      dcname(name, i);
+      if(link("f", name) != 0){
+        printf(1, "dirchurn link failed\n");
+        exit();
+      }
+    }
+    if(round > 0){
+      for(i = (round-1)*80; i < round*80; i++){
+        dcname(name, i);
+        if(unlink(name) != 0){
+          printf(1, "dirchurn unlink failed\n");
+          exit();
+        }
+      }
+    }
+    for(i = (round > 0 ? round-1 : 0)*80; i < round*80 + 80; i++){
+      dcname(name, i);
+      fd = open(name, 0);
+      if(i >= round*80 && fd < 0){
+        printf(1, "dirchurn open failed\n");
+        exit();
+      }
+      if(i < round*80 && fd >= 0){
+        printf(1, "dirchurn unlinked name still there\n");
+        exit();
+      }
+      if(fd >= 0)
+        close(fd);
+    }
+  }
+  for(i = 19*80; i < 20*80; i++){
+    dcname(name, i);
+    unlink(name);
+  }
+  if(unlink("f") != 0 || chdir("..") != 0 || unlink("dc") != 0){
+    printf(1, "dirchurn cleanup failed\n");
+    exit();
+  }
+  printf(1, "dirchurn ok\n");
+}
+
+// Look names up again after each change to them, so that the
+// answers come from the dentry cache.
+void
+dcachetest(void)
+{
+  struct stat sa, sb;
+  int fd, i;
+  char c;
+
+  printf(1, "dcache test\n");
+  if(mkdir("dct") != 0){
+    printf(1, "dcache mkdir failed\n");
+    exit();
+  }
+
+  // A missing name, then created, then removed.
+  for(i = 0; i < 2; i++){
+    if(open("dct/x", 0) >= 0){
+      printf(1, "dcache opened missing name\n");
+      exit();
+    }
+  }
+  if((fd = open("dct/x", O_CREATE|O_RDWR)) < 0 || write(fd, "x", 1) != 1){
+    printf(1, "dcache create failed\n");
+    exit();
+  }
+  close(fd);
+  for(i = 0; i < 2; i++){
+    if((fd = open("dct/x", 0)) < 0 || read(fd, &c, 1) != 1 || c != 'x'){
+      printf(1, "dcache open of created name failed\n");
+      exit();
+    }
+    close(fd);
+  }
+  if(unlink("dct/x") != 0){
+    printf(1, "dcache unlink failed\n");
+    exit();
+  }
+  for(i = 0; i < 2; i++){
+    if(open("dct/x", 0) >= 0){
+      printf(1, "dcache opened unlinked name\n");
+      exit();
+    }
+  }
+
+  // link() over a name known to be missing, and unlink() of
+  // one of two names known to be there.
+  if((fd = open("dct/a", O_CREATE|O_RDWR)) < 0){
+    printf(1, "dcache create failed\n");
+    exit();
+  }
+  close(fd);
+  if(open("dct/b", 0) >= 0){
+    printf(1, "dcache opened missing name\n");
+    exit();
+  }
+  if(link("dct/a", "dct/b") != 0){
+    printf(1, "dcache link failed\n");
+    exit();
+  }
+  if(stat("dct/a", &sa) < 0 || stat("dct/b", &sb) < 0 ||
+     sa.ino != sb.ino || sb.nlink != 2){
+    printf(1, "dcache link not seen\n");
+    exit();
+  }
+  if(unlink("dct/a") != 0){
+    printf(1, "dcache unlink failed\n");
+    exit();
+  }
+  if(open("dct/a", 0) >= 0 || stat("dct/b", &sb) < 0 ||
+     sb.ino != sa.ino || sb.nlink != 1){
+    printf(1, "dcache unlink not seen\n");
+    exit();
+  }
+  if(link("dct/b", "dct/a") != 0 || stat("dct/a", &sa) < 0 ||
+     sa.ino != sb.ino){
+    printf(1, "dcache relink failed\n");
+    exit();
+  }
+
+  if(unlink("dct/a") != 0 || unlink("dct/b") != 0 || unlink("dct") != 0){
+    printf(1, "dcache cleanup failed\n");
+    exit();
+  }
+  if(open("dct/b", 0) >= 0 || open("dct", 0) >= 0){
+    printf(1, "dcache opened removed name\n");
+    exit();
+  }
+  printf(1, "dcache ok\n");
+}
+
 void
 subdir(void)
 {
@@ -1546,6 +1718,295 @@ sbrktest(void)
   printf(stdout, "sbrk test OK\n");
 }
 
+// sbrk() reserves address space; pages are allocated on first touch.
+void
+lazysbrktest(void)
+{
+  char *oldbrk, *a, *p;
+  int fd, pid;
+  uint amt;
+
+  printf(stdout, "lazy sbrk test\n");
+  oldbrk = sbrk(0);
+  amt = 64*1024*1024;
+  a = sbrk(amt);
+  if(a == (char*)0xffffffff){
+    printf(stdout, "lazy sbrk failed to reserve\n");
+    exit();
+  }
+
+  // touch a few scattered pages; untouched ones must read as zero
+  for(p = a; p < a + amt; p += 4*1024*1024)
+    *p = 'x';
+  if(a[4096] != 0 || a[amt-1] != 0){
+    printf(stdout, "lazy sbrk page not zero\n");
+    exit();
+  }
+
+  // the kernel must fault in an untouched page it writes to
+  fd = open("README", 0);
+  if(fd < 0 || read(fd, a + amt - 4096, 100) != 100){
+    printf(stdout, "lazy sbrk read into untouched page failed\n");
+    exit();
+  }
+  close(fd);
+
+  // fork copies touched pages and leaves untouched ones lazy
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "lazy sbrk fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    if(a[0] != 'x' || a[4*1024*1024] != 'x' || a[8192] != 0){
+      printf(stdout, "lazy sbrk child sees wrong data\n");
+      exit();
+    }
+    a[8192] = 'y';
+    exit();
+  }
+  wait();
+  if(a[8192] != 0){
+    printf(stdout, "lazy sbrk child write leaked to parent\n");
+    exit();
+  }
+
+  sbrk(-(sbrk(0) - oldbrk));
+  printf(stdout, "lazy sbrk ok\n");
+}
+
+// initialized data is paged in from the executable and shared
+// with the parent until somebody writes to it
+char cowdata[64] = "cow data";
+
+void
+cowdatatest(void)
+{
+  int fd, pid;
+
+  printf(stdout, "cow data test\n");
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "cow data fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    if(strcmp(cowdata, "cow data") != 0){
+      printf(stdout, "cow data child sees wrong data\n");
+      exit();
+    }
+    cowdata[0] = 'C';
+    fd = open("README", 0);
+    if(fd < 0 || read(fd, cowdata + 32, 16) != 16){
+      printf(stdout, "cow data read into data page failed\n");
+      exit();
+    }
+    close(fd);
+    exit();
+  }
+  wait();
+  if(strcmp(cowdata, "cow data") != 0 || cowdata[32] != 0){
+    printf(stdout, "cow data child write leaked to parent\n");
+    exit();
+  }
+  printf(stdout, "cow data ok\n");
+}
+
+void
+mmaptest(void)
+{
+  int fd, pid;
+  char *p, *q;
+
+  printf(stdout, "mmap test\n");
+  fd = open("mmapfile", O_CREATE|O_RDWR);
+  memset(buf, 'a', 4096);
+  if(fd < 0 || write(fd, buf, 4096) != 4096){
+    printf(stdout, "mmap test create failed\n");
+    exit();
+  }
+
+  // a private mapping reads the file; writes to it stay private
+  p = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+  if(p == (char*)-1 || p[0] != 'a' || p[4095] != 'a'){
+    printf(stdout, "mmap private read failed\n");
+    exit();
+  }
+  p[0] = 'b';
+
+  // a shared mapping writes through to the file on msync
+  q = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+  if(q == (char*)-1 || q[0] != 'a'){
+    printf(stdout, "mmap shared read failed\n");
+    exit();
+  }
+  q[1] = 'c';
+  close(fd);
+
+  // read() sees stores to a shared mapping before msync, and
+  // the mapping sees write()s
+  fd = open("mmapfile", O_RDWR);
+  if(fd < 0 || read(fd, buf, 2) != 2 || buf[1] != 'c'){
+    printf(stdout, "mmap shared store not seen by read\n");
+    exit();
+  }
+  buf[0] = 'd';
+  if(write(fd, buf, 1) != 1 || q[2] != 'd'){
+    printf(stdout, "write not seen by mmap shared\n");
+    exit();
+  }
+  close(fd);
+
+  if(msync(q, 4096) < 0){
+    printf(stdout, "msync failed\n");
+    exit();
+  }
+  fd = open("mmapfile", O_RDONLY);
+  if(fd < 0 || read(fd, buf, 2) != 2 || buf[0] != 'a' || buf[1] != 'c'){
+    printf(stdout, "mmap shared write not in file\n");
+    exit();
+  }
+  close(fd);
+  if(munmap(p, 4096) < 0 || munmap(q, 4096) < 0){
+    printf(stdout, "munmap failed\n");
+    exit();
+  }
+
+  // anonymous shared memory is shared with children
+  p = mmap(0, 8192, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+  if(p == (char*)-1){
+    printf(stdout, "mmap anonymous failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid == 0){
+    p[4096] = 'x';
+    exit();
+  }
+  wait();
+  if(p[0] != 0 || p[4096] != 'x'){
+    printf(stdout, "mmap anonymous not shared\n");
+    exit();
+  }
+  munmap(p, 8192);
+  unlink("mmapfile");
+  printf(stdout, "mmap ok\n");
+}
+
+// a child attaches a shared-memory segment by name and
+// wakes its parent through a futex in the segment
+void
+shmtest(void)
+{
+  int *p, *q, pid;
+
+  printf(stdout, "shm test\n");
+  p = shmcreate("shmtest", 8192);
+  if(p == (int*)-1 || shmcreate("shmtest", 4096) != (void*)-1){
+    printf(stdout, "shmcreate failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid == 0){
+    shmdetach(p);
+    q = shmattach("shmtest");
+    if(q == (int*)-1){
+      printf(stdout, "shmattach failed\n");
+      exit();
+    }
+    q[1024] = 42;
+    q[0] = 1;
+    futex_wake(q, 1);
+    exit();
+  }
+  while(p[0] == 0)
+    futex_wait(p, 0);
+  wait();
+  if(p[1024] != 42){
+    printf(stdout, "shm data not shared\n");
+    exit();
+  }
+  if(shmdetach(p) < 0 || shmattach("shmtest") != (void*)-1){
+    printf(stdout, "shm segment not freed\n");
+    exit();
+  }
+  printf(stdout, "shm ok\n");
+}
+
+void
+schedtest(void)
+{
+  int t0, start;
+
+  printf(stdout, "sched test\n");
+  if(nice(5) != 5 || nice(-100) != NICE_MIN || nice(-NICE_MIN) != 0){
+    printf(stdout, "nice wrong\n");
+    exit();
+  }
+  if(setpriority(0, SCHED_FIFO, 0) != -1 ||
+     setpriority(0, SCHED_OTHER, NICE_MAX+1) != -1 ||
+     setpriority(0, 7, 0) != -1){
+    printf(stdout, "setpriority accepted bad arguments\n");
+    exit();
+  }
+  if(setpriority(0, SCHED_FIFO, 10) < 0 ||
+     setpriority(0, SCHED_OTHER, 0) < 0){
+    printf(stdout, "setpriority failed\n");
+    exit();
+  }
+
+  // spin until the clock ticks a few times; some of
+  // them must be charged to us
+  t0 = cputime();
+  start = uptime();
+  while(uptime() < start + 5)
+    ;
+  if(cputime() <= t0){
+    printf(stdout, "cputime not charged\n");
+    exit();
+  }
+  printf(stdout, "sched ok\n");
+}
+
+void
+clocktest(void)
+{
+  struct timespec a, b, ts;
+  uint ms;
+  int i;
+
+  printf(stdout, "clock test\n");
+  if(clock_gettime(CLOCK_MONOTONIC, &a) < 0 || clock_gettime(99, &a) != -1){
+    printf(stdout, "clock_gettime failed\n");
+    exit();
+  }
+  sleep(3);
+  clock_gettime(CLOCK_MONOTONIC, &b);
+  ms = (b.tv_sec - a.tv_sec) * 1000 + b.tv_nsec / 1000000 - a.tv_nsec / 1000000;
+  if(b.tv_nsec >= 1000000000 || ms < 2000 / HZ){
+    printf(stdout, "clock wrong: slept %d ms\n", ms);
+    exit();
+  }
+
+  // Sleeps shorter than a tick shouldn't wait for one.
+  ts.tv_sec = 0;
+  ts.tv_nsec = 1000000;
+  clock_gettime(CLOCK_MONOTONIC, &a);
+  for(i = 0; i < 10; i++){
+    if(nanosleep(&ts) < 0){
+      printf(stdout, "nanosleep failed\n");
+      exit();
+    }
+  }
+  clock_gettime(CLOCK_MONOTONIC, &b);
+  ms = (b.tv_sec - a.tv_sec) * 1000 + b.tv_nsec / 1000000 - a.tv_nsec / 1000000;
+  if(ms < 10 || ms >= 10 * 1000 / HZ){
+    printf(stdout, "clock wrong: 10 1-ms nanosleeps took %d ms\n", ms);
+    exit();
+  }
+  printf(stdout, "clock ok\n");
+}
+
 void
 validateint(int *p)
 {
@@ -1768,6 +2229,12 @@ main(int argc, char *argv[])
   bigargtest();
   bsstest();
   sbrktest();
+  lazysbrktest();
+  cowdatatest();
+  mmaptest();
+  shmtest();
+  schedtest();
+  clocktest();
   validatetest();
 
   opentest();
@@ -1794,6 +2261,8 @@ main(int argc, char *argv[])
   iref();
   forktest();
   bigdir(); // slow
+  dirchurn();
+  dcachetest();
 
   uio();
 
@@ -0,0 +1,161 @@
+// Virtio block device driver.
+//
+// Under QEMU with the file system image on a virtio disk
+// (-drive ...,if=virtio), pciinit() finds the device and calls
+// virtblkinit(), and from then on iderw() hands the requests for
+// disk 1 to virtblkrw().  Unlike an IDE disk, the device takes
+// many requests at once: each is a chain of three descriptors
+// (a header saying what to do, the block's data, and a status
+// byte for the device to fill in) and they complete in any
+// order, each raising an interrupt.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+#include "virtio.h"
+
+#define VIRTIO_BLK_T_IN   0   // read
+#define VIRTIO_BLK_T_OUT  1   // write
+#define VIRTIO_BLK_CAPACITY (VIRTIO_CONFIG+0)  // 64 bits, in sectors
+
+#define SECTOR_SIZE 512
+
+struct virtblkhdr {
+  uint type;
+  uint reserved;
+  uint64_t sector;
+};
+
+// A request, found by the first descriptor of its chain.
+struct virtblkreq {
+  struct virtblkhdr hdr;
+  uchar status;        // 0 when the device has done it
+  struct buf *b;
+};
+
+static struct spinlock vblock;
+static uint vbbase;     // I/O base; 0 if there is no device
+static uint vbsectors;  // size of the disk
+static struct virtq vbq;
+static struct virtblkreq vbreq[VQMAX];
+static char vbqmem[VQBYTES(VQMAX)] __attribute__((__aligned__(PGSIZE)));
+
+static void virtblkintr(void);
+
+int
+virtblkinit(uint iobase, int irq)
+{
+  uint features;
+
+  if(iobase == 0 || vbbase != 0)
+    return -1;
+  initlock(&vblock, "virtblk");
+  features = 0;
+  virtiostart(iobase, &features);
+  if(vqinit(&vbq, iobase, 0, vbqmem, sizeof(vbqmem)) < 0){
+    outb(iobase+VIRTIO_STATUS, VIRTIO_S_FAILED);
+    return -1;
+  }
+  vbsectors = inl(iobase+VIRTIO_BLK_CAPACITY);
+  if(virtiosetintr(irq, virtblkintr) < 0){
+    outb(iobase+VIRTIO_STATUS, VIRTIO_S_FAILED);
+    return -1;
+  }
+  virtioready(iobase);
+  vbbase = iobase;
+  cprintf("virtblk: %d sectors, queue of %d\n", vbsectors, vbq.n);
+  return 0;
+}
+
+// Sync buf with the virtio disk, like iderw().
+// Returns -1 if there is no virtio disk.
+int
+virtblkrw(struct buf *b)
+{
+  struct virtblkreq *r;
+  int d[3], i, write;
+
+  if(vbbase == 0)
+    return -1;
+  if((b->blockno + 1) * (BSIZE/SECTOR_SIZE) > vbsectors)
+    panic("virtblkrw: blockno");
+
+  acquire(&vblock);
+  while(vbq.nfree < 3)
+    sleep(&vbq, &vblock);
+  for(i = 0; i < 3; i++)
+    d[i] = vqalloc(&vbq);
+
+  write = b->flags & B_DIRTY;
+  r = &vbreq[d[0]];
+  r->hdr.type = write ? VIRTIO_BLK_T_OUT : VIRTIO_BLK_T_IN;
+  r->hdr.reserved = 0;
+  r->hdr.sector = b->blockno * (BSIZE/SECTOR_SIZE);
+  r->status = 0xff;
+  r->b = b;
+
+  vbq.desc[d[0]].addr = V2P(&r->hdr);
+  vbq.desc[d[0]].len = sizeof(r->hdr);
+  vbq.desc[d[0]].flags = VQD_NEXT;
+  vbq.desc[d[0]].next = d[1];
+  vbq.desc[d[1]].addr = V2P(b->data);
+  vbq.desc[d[1]].len = BSIZE;
+  vbq.desc[d[1]].flags = VQD_NEXT | (write ? 0 : VQD_WRITE);
+  vbq.desc[d[1]].next = d[2];
+  vbq.desc[d[2]].addr = V2P(&r->status);
+  vbq.desc[d[2]].len = 1;
+  vbq.desc[d[2]].flags = VQD_WRITE;
+  vqsubmit(&vbq, d[0]);
+
+  if(b->flags & B_ASYNC){
+    release(&vblock);
+    return 0;
+  }
+
+  // Wait for request to finish.
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID)
+    sleep(b, &vblock);
+  release(&vblock);
+  return 0;
+}
+
+// Interrupt handler.
+static void
+virtblkintr(void)
+{
+  struct virtblkreq *r;
+  struct buf *b;
+  int id;
+
+  acquire(&vblock);
+  // Reading the ISR lowers the interrupt line, so requests
+  // finishing after this raise a new interrupt.
+  inb(vbq.iobase+VIRTIO_ISR);
+  while((id = vqnextused(&vbq, 0)) >= 0){
+    r = &vbreq[id];
+    b = r->b;
+    if(r->status != 0)
+      cprintf("virtblk: error %d on block %d\n", r->status, b->blockno);
+    r->b = 0;
+    vqfree(&vbq, id);
+
+    // Wake process waiting for this buf, or release it if
+    // nobody is.
+    b->flags |= B_VALID;
+    b->flags &= ~B_DIRTY;
+    if(b->flags & B_ASYNC){
+      b->flags &= ~B_ASYNC;
+      brelse(b);
+    } else
+      wakeup(b);
+  }
+  wakeup(&vbq);
+  release(&vblock);
+}
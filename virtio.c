@@ -0,0 +1,163 @@
+// Virtio devices: the parts that the block and network drivers
+// share, from device setup to handing descriptors back and forth
+// (see virtio.h).
+//
+// A driver sets a device up with virtiostart(), vqinit() for
+// each of its queues and virtioready().  It then takes chains of
+// descriptors with vqalloc(), passes them to the device with
+// vqsubmit(), gets them back with vqnextused() and frees them
+// with vqfree().  Callers keep each queue under a lock of their
+// own.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "virtio.h"
+
+#define NVIRTIO 4   // devices with interrupt handlers
+
+static struct {
+  int irq;
+  void (*intr)(void);
+} virtiointrs[NVIRTIO];
+static int nvirtiointr;
+
+// Reset the device at iobase and agree on features: *features
+// holds the ones the driver can use, and is left holding the
+// ones the device has too.
+void
+virtiostart(uint iobase, uint *features)
+{
+  outb(iobase+VIRTIO_STATUS, 0);
+  outb(iobase+VIRTIO_STATUS, VIRTIO_S_ACK);
+  outb(iobase+VIRTIO_STATUS, VIRTIO_S_ACK|VIRTIO_S_DRIVER);
+  *features &= inl(iobase+VIRTIO_DEVFEATURES);
+  outl(iobase+VIRTIO_DRVFEATURES, *features);
+}
+
+// Set up queue sel of the device at iobase in mem, which is
+// size bytes and page-aligned.  Returns -1 if the device has no
+// such queue or it doesn't fit.
+int
+vqinit(struct virtq *q, uint iobase, int sel, char *mem, uint size)
+{
+  uint i, n;
+
+  outw(iobase+VIRTIO_QSELECT, sel);
+  n = inw(iobase+VIRTIO_QSIZE);
+  if(n == 0 || n > VQMAX || VQBYTES(n) > size)
+    return -1;
+  memset(mem, 0, VQBYTES(n));
+  q->iobase = iobase;
+  q->sel = sel;
+  q->n = n;
+  q->desc = (struct vqdesc*)mem;
+  q->avail = (struct vqavail*)(mem + 16*n);
+  q->used = (struct vqused*)(mem + PGROUNDUP(16*n + 6 + 2*n));
+  for(i = 0; i < n; i++)
+    q->desc[i].next = i + 1;
+  q->freehead = 0;
+  q->nfree = n;
+  q->lastused = 0;
+  outl(iobase+VIRTIO_QADDR, V2P(mem) >> PGSHIFT);
+  return 0;
+}
+
+// Tell the device at iobase that the driver is ready.
+void
+virtioready(uint iobase)
+{
+  outb(iobase+VIRTIO_STATUS, VIRTIO_S_ACK|VIRTIO_S_DRIVER|VIRTIO_S_DRIVER_OK);
+}
+
+// Take a free descriptor, or return -1 if there is none.
+int
+vqalloc(struct virtq *q)
+{
+  int i;
+
+  if(q->nfree == 0)
+    return -1;
+  i = q->freehead;
+  q->freehead = q->desc[i].next;
+  q->nfree--;
+  return i;
+}
+
+// Free the chain of descriptors starting at head.
+void
+vqfree(struct virtq *q, int head)
+{
+  int i, more;
+
+  for(i = head; ; i = q->desc[i].next){
+    q->nfree++;
+    more = q->desc[i].flags & VQD_NEXT;
+    q->desc[i].flags = 0;
+    if(!more)
+      break;
+  }
+  q->desc[i].next = q->freehead;
+  q->freehead = head;
+}
+
+// Hand the chain starting at head to the device.
+void
+vqsubmit(struct virtq *q, int head)
+{
+  q->avail->ring[q->avail->idx % q->n] = head;
+  __sync_synchronize();  // the device must see the entry first
+  q->avail->idx++;
+  __sync_synchronize();
+  outw(q->iobase+VIRTIO_QNOTIFY, q->sel);
+}
+
+// Return the head of the next chain the device is done with,
+// setting *len to the bytes it wrote, or return -1.
+int
+vqnextused(struct virtq *q, uint *len)
+{
+  struct vqusedelem *e;
+
+  if(q->lastused == *(volatile ushort*)&q->used->idx)
+    return -1;
+  __sync_synchronize();  // read the entry after the index
+  e = &q->used->ring[q->lastused % q->n];
+  q->lastused++;
+  if(len)
+    *len = e->len;
+  return e->id;
+}
+
+// Have virtiointr() call intr for interrupts on irq.
+int
+virtiosetintr(int irq, void (*intr)(void))
+{
+  if(nvirtiointr == NVIRTIO)
+    return -1;
+  virtiointrs[nvirtiointr].irq = irq;
+  virtiointrs[nvirtiointr].intr = intr;
+  nvirtiointr++;
+  ioapicenable(irq, 0);
+  return 0;
+}
+
+// Handle an interrupt on irq, if a virtio device uses it.
+// PCI devices may share a line, so ask every handler.
+int
+virtiointr(int irq)
+{
+  int i, found;
+
+  found = 0;
+  for(i = 0; i < nvirtiointr; i++){
+    if(virtiointrs[i].irq == irq){
+      virtiointrs[i].intr();
+      found = 1;
+    }
+  }
+  return found;
+}
@@ -0,0 +1,81 @@
+// Virtio devices through the legacy PCI interface, which is
+// what QEMU offers by default: vendor 0x1af4, devices 0x1000
+// (network) and 0x1001 (block).  The device and the driver
+// share split virtqueues in memory: a table of descriptors, an
+// available ring through which the driver hands descriptor
+// chains to the device, and a used ring through which the
+// device hands them back.
+
+// Registers, as offsets from the I/O base in BAR 0.
+#define VIRTIO_DEVFEATURES  0x00  // 32 bits: features the device has
+#define VIRTIO_DRVFEATURES  0x04  // 32 bits: features the driver uses
+#define VIRTIO_QADDR        0x08  // 32 bits: page number of the queue
+#define VIRTIO_QSIZE        0x0c  // 16 bits: entries in the queue
+#define VIRTIO_QSELECT      0x0e  // 16 bits: queue the above refer to
+#define VIRTIO_QNOTIFY      0x10  // 16 bits: queue with new entries
+#define VIRTIO_STATUS       0x12  // 8 bits
+#define VIRTIO_ISR          0x13  // 8 bits; reading acknowledges
+#define VIRTIO_CONFIG       0x14  // device-specific configuration
+
+// Status bits.
+#define VIRTIO_S_ACK        0x01  // found the device
+#define VIRTIO_S_DRIVER     0x02  // know how to drive it
+#define VIRTIO_S_DRIVER_OK  0x04  // ready
+#define VIRTIO_S_FAILED     0x80
+
+#define VQMAX 256   // most entries in a queue the drivers can use
+
+// A descriptor: a piece of memory for the device to read or,
+// with VQD_WRITE, to write.
+struct vqdesc {
+  uint64_t addr;   // physical address
+  uint len;
+  ushort flags;
+  ushort next;     // next in the chain, with VQD_NEXT
+};
+#define VQD_NEXT    1
+#define VQD_WRITE   2
+
+struct vqavail {
+  ushort flags;
+  ushort idx;      // where the driver puts the next entry
+  ushort ring[];   // heads of descriptor chains
+};
+#define VQA_NOINTR  1   // don't interrupt when done
+
+struct vqusedelem {
+  uint id;         // head of the chain
+  uint len;        // bytes the device wrote
+};
+
+struct vqused {
+  ushort flags;
+  ushort idx;      // where the device puts the next entry
+  struct vqusedelem ring[];
+};
+
+// Bytes of memory for a queue of n entries: the descriptors
+// and the available ring, then the used ring from the next
+// page boundary on.
+#define VQBYTES(n) (PGROUNDUP(16*(n) + 6 + 2*(n)) + PGROUNDUP(6 + 8*(n)))
+
+struct virtq {
+  uint iobase;
+  int sel;           // queue number in the device
+  uint n;            // entries
+  struct vqdesc *desc;
+  struct vqavail *avail;
+  struct vqused *used;
+  ushort freehead;   // free descriptors, through next
+  uint nfree;
+  ushort lastused;   // used->idx as far as the driver has looked
+};
+
+void virtiostart(uint iobase, uint *features);
+int  vqinit(struct virtq *q, uint iobase, int sel, char *mem, uint size);
+void virtioready(uint iobase);
+int  vqalloc(struct virtq *q);
+void vqfree(struct virtq *q, int head);
+void vqsubmit(struct virtq *q, int head);
+int  vqnextused(struct virtq *q, uint *len);
+int  virtiosetintr(int irq, void (*intr)(void));
@@ -0,0 +1,195 @@
+/*
+ * Driver for the virtio network device (legacy PCI interface)
+ * The device has a receive queue (0) and a transmit queue (1).
+ * Each packet travels in a chain of two descriptors: a virtio-net
+ * header, which this driver leaves zero (no offloads), and the
+ * ethernet frame.  Like the E1000 driver, sending waits for the
+ * device to take the packet, and receiving polls; the queues ask
+ * the device not to interrupt.
+ */
+#include "virtnet.h"
+#include "defs.h"
+#include "x86.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "virtio.h"
+
+/*
+ * Queues
+ * 	Receive
+ * 	Transmit
+ */
+#define VIRTNET_RXQ 0
+#define VIRTNET_TXQ 1
+
+/*
+ * Feature bits
+ * 	Device has a MAC address in its configuration
+ */
+#define VIRTNET_F_MAC	(1 << 5)
+
+/*
+ * Device configuration
+ * 	MAC address
+ */
+#define VIRTNET_CONFIG_MAC	(VIRTIO_CONFIG + 0)
+
+/*
+ * Receive buffers posted to the device
+ * Size of a packet buffer
+ */
+#define VIRTNET_RXBUFS	16
+#define VIRTNET_BUFSIZE	2048
+
+/*
+ * Header in front of each packet
+ */
+typedef struct {
+    uint8_t flags;
+    uint8_t gsotype;
+    uint16_t hdrlen;
+    uint16_t gsosize;
+    uint16_t csumstart;
+    uint16_t csumoffset;
+} virtnethdr;
+
+/*
+ * Virtio Network Device Structure
+ */
+typedef struct {
+    struct spinlock lock;
+    uint32_t iobase;
+    struct virtq rxq, txq;
+    virtnethdr rxhdr[VIRTNET_RXBUFS];
+    virtnethdr txhdr;
+    int rxhead[VIRTNET_RXBUFS];	// first descriptor of each receive buffer
+    uint8_t * rxbuf[VIRTNET_RXBUFS];
+    uint8_t * txbuf;
+    uint8_t mac[6];
+} virtnet;
+
+// Queue memory must be physically contiguous, so one device only.
+static char rxqmem[VQBYTES(VQMAX)] __attribute__((__aligned__(PGSIZE)));
+static char txqmem[VQBYTES(VQMAX)] __attribute__((__aligned__(PGSIZE)));
+static int virtnetfound;
+
+// Give receive buffer i to the device.
+static void postrxbuf(virtnet * vn, int i) {
+    int h = vn->rxhead[i];
+    int d = vn->rxq.desc[h].next;
+
+    vn->rxq.desc[h].addr = V2P(&vn->rxhdr[i]);
+    vn->rxq.desc[h].len = sizeof(virtnethdr);
+    vn->rxq.desc[h].flags = VQD_NEXT | VQD_WRITE;
+    vn->rxq.desc[d].addr = V2P(vn->rxbuf[i]);
+    vn->rxq.desc[d].len = VIRTNET_BUFSIZE;
+    vn->rxq.desc[d].flags = VQD_WRITE;
+    vqsubmit(&vn->rxq, h);
+}
+
+int initvirtnet(pcifunc * pcif, void ** drv, uint8_t * macaddr) {
+    virtnet * vn;
+    uint32_t iobase = pcif->regbase[0];
+    uint features;
+    int i;
+    char * page;
+
+    if (virtnetfound || iobase == 0 || iobase > 0xffff)
+	return -1;
+    if (sizeof(virtnet) > PGSIZE)
+	panic("virtnet too big");
+    if ((vn = (virtnet *)kalloc()) == 0)
+	return -1;
+    memset(vn, 0, sizeof(*vn));
+    initlock(&vn->lock, "virtnet");
+    vn->iobase = iobase;
+
+    features = VIRTNET_F_MAC;
+    virtiostart(iobase, &features);
+    if (vqinit(&vn->rxq, iobase, VIRTNET_RXQ, rxqmem, sizeof(rxqmem)) < 0 ||
+	vqinit(&vn->txq, iobase, VIRTNET_TXQ, txqmem, sizeof(txqmem)) < 0 ||
+	vn->rxq.n < 2 * VIRTNET_RXBUFS || vn->txq.n < 2) {
+	outb(iobase + VIRTIO_STATUS, VIRTIO_S_FAILED);
+	kfree((char *)vn);
+	return -1;
+    }
+    vn->rxq.avail->flags = VQA_NOINTR;
+    vn->txq.avail->flags = VQA_NOINTR;
+
+    if (features & VIRTNET_F_MAC) {
+	for (i = 0; i < 6; i++)
+	    vn->mac[i] = inb(iobase + VIRTNET_CONFIG_MAC + i);
+    }
+    memmove(macaddr, vn->mac, 6);
+    char macstr[18];
+    unpackmac(vn->mac, macstr);
+    macstr[17] = 0;
+    cprintf("\nMAC Address of the virtio network device:%s\n", macstr);
+
+    // Two buffers per page.
+    page = 0;
+    for (i = 0; i < VIRTNET_RXBUFS; i++) {
+	if (i % 2 == 0 && (page = kalloc()) == 0)
+	    panic("initvirtnet: out of memory");
+	vn->rxbuf[i] = (uint8_t *)page + (i % 2) * VIRTNET_BUFSIZE;
+	vn->rxhead[i] = vqalloc(&vn->rxq);
+	vn->rxq.desc[vn->rxhead[i]].next = vqalloc(&vn->rxq);
+	postrxbuf(vn, i);
+    }
+    if ((vn->txbuf = (uint8_t *)kalloc()) == 0)
+	panic("initvirtnet: out of memory");
+
+    virtioready(iobase);
+    virtnetfound = 1;
+    * drv = vn;
+    return 0;
+}
+
+void sendvirtnet(void * drv, uint8_t * pkt, uint16_t len) {
+    virtnet * vn = (virtnet *)drv;
+    int h, d;
+
+    if (len > VIRTNET_BUFSIZE)
+	len = VIRTNET_BUFSIZE;
+    acquire(&vn->lock);
+    memset(&vn->txhdr, 0, sizeof(vn->txhdr));
+    memmove(vn->txbuf, pkt, len);
+    h = vqalloc(&vn->txq);
+    d = vqalloc(&vn->txq);
+    vn->txq.desc[h].addr = V2P(&vn->txhdr);
+    vn->txq.desc[h].len = sizeof(virtnethdr);
+    vn->txq.desc[h].flags = VQD_NEXT;
+    vn->txq.desc[h].next = d;
+    vn->txq.desc[d].addr = V2P(vn->txbuf);
+    vn->txq.desc[d].len = len;
+    vn->txq.desc[d].flags = 0;
+    vqsubmit(&vn->txq, h);
+
+    // Wait for the device to be done with the buffer.
+    while (vqnextused(&vn->txq, 0) != h)
+	;
+    vqfree(&vn->txq, h);
+    release(&vn->lock);
+}
+
+// Copy the next received frame, if there is one, into pkt.
+void recvvirtnet(void * drv, uint8_t * pkt, uint16_t len) {
+    virtnet * vn = (virtnet *)drv;
+    uint n;
+    int h, i;
+
+    acquire(&vn->lock);
+    if ((h = vqnextused(&vn->rxq, &n)) >= 0) {
+	for (i = 0; i < VIRTNET_RXBUFS; i++) {
+	    if (vn->rxhead[i] != h)
+		continue;
+	    n = n > sizeof(virtnethdr) ? n - sizeof(virtnethdr) : 0;
+	    memmove(pkt, vn->rxbuf[i], n < len ? n : len);
+	    postrxbuf(vn, i);
+	    break;
+	}
+    }
+    release(&vn->lock);
+}
@@ -0,0 +1,16 @@
+#ifndef VIRTNET_H__
+#define VIRTNET_H__
+/*
+ * Driver for the virtio network device (legacy PCI interface)
+ * Device information retrieved from the following source:
+ * 	Virtual I/O Device (VIRTIO) Version 1.0, section 4.1.5 (Legacy Interfaces)
+ */
+#include "types.h"
+#include "nic.h"
+#include "pci.h"
+
+int initvirtnet(pcifunc * pcif, void ** driver, uint8_t * mac);
+
+void sendvirtnet(void * virtnet, uint8_t * pkt, uint16_t len);
+void recvvirtnet(void * virtnet, uint8_t * pkt, uint16_t len);
+#endif
@@ -6,6 +6,11 @@
 #include "mmu.h"
 #include "proc.h"
 #include "elf.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+#include "traps.h"
 
 extern char data[];  // defined by kernel.ld
 pde_t *kpgdir;  // for use in scheduler()
@@ -160,8 +165,6 @@ switchuvm(struct proc *p)
     panic("switchuvm: no process");
   if(p->kstack == 0)
     panic("switchuvm: no kstack");
-  if(p->pgdir == 0)
-    panic("switchuvm: no pgdir");
 
   pushcli();
   mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts,
@@ -173,7 +176,8 @@ switchuvm(struct proc *p)
   // forbids I/O instructions (e.g., inb and outb) from user space
   mycpu()->ts.iomb = (ushort) 0xFFFF;
   ltr(SEG_TSS << 3);
-  lcr3(V2P(p->pgdir));  // switch to process's address space
+  // switch to process's address space; kernel threads have none
+  lcr3(V2P(p->mm ? p->mm->pgdir : kpgdir));
   popcli();
 }
 
@@ -192,30 +196,6 @@ inituvm(pde_t *pgdir, char *init, uint sz)
   memmove(mem, init, sz);
 }
 
-// Load a program segment into pgdir.  addr must be page-aligned
-// and the pages from addr to addr+sz must already be mapped.
-int
-loaduvm(pde_t *pgdir, char *addr, struct inode *ip, uint offset, uint sz)
-{
-  uint i, pa, n;
-  pte_t *pte;
-
-  if((uint) addr % PGSIZE != 0)
-    panic("loaduvm: addr must be page aligned");
-  for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
-      panic("loaduvm: address should exist");
-    pa = PTE_ADDR(*pte);
-    if(sz - i < PGSIZE)
-      n = sz - i;
-    else
-      n = PGSIZE;
-    if(readi(ip, P2V(pa), offset+i, n) != n)
-      return -1;
-  }
-  return 0;
-}
-
 // Allocate page tables and physical memory to grow process from oldsz to
 // newsz, which need not be page aligned.  Returns new size or 0 on error.
 int
@@ -310,31 +290,358 @@ clearpteu(pde_t *pgdir, char *uva)
   *pte &= ~PTE_U;
 }
 
+// Address spaces.  mmtab.lock guards ref and busy; the rest
+// of an address space is guarded by mmlock(), which sleeps,
+// since page faults may have to read from disk.
+struct {
+  struct spinlock lock;
+  struct mm mm[NPROC];
+} mmtab;
+
+void
+mminit(void)
+{
+  initlock(&mmtab.lock, "mmtab");
+}
+
+// Allocate an empty address space with no page table.
+struct mm*
+mmalloc(void)
+{
+  struct mm *mm;
+
+  acquire(&mmtab.lock);
+  for(mm = mmtab.mm; mm < &mmtab.mm[NPROC]; mm++){
+    if(mm->ref == 0){
+      memset(mm, 0, sizeof(*mm));
+      mm->ref = 1;
+      release(&mmtab.lock);
+      return mm;
+    }
+  }
+  release(&mmtab.lock);
+  return 0;
+}
+
+struct mm*
+mmdup(struct mm *mm)
+{
+  acquire(&mmtab.lock);
+  if(mm->ref < 1)
+    panic("mmdup");
+  mm->ref++;
+  release(&mmtab.lock);
+  return mm;
+}
+
+// Drop a reference to mm.  The last one writes back and
+// releases its regions and frees its page table, so the
+// caller must not be running on it.
+// Must not be called inside a transaction.
+void
+mmput(struct mm *mm)
+{
+  acquire(&mmtab.lock);
+  if(mm->ref < 1)
+    panic("mmput");
+  if(mm->ref > 1){
+    mm->ref--;
+    release(&mmtab.lock);
+    return;
+  }
+  release(&mmtab.lock);
+
+  // Nobody else can find mm while ref is still 1.
+  freevma(mm->pgdir, mm->vma);
+  if(mm->pgdir)
+    freevm(mm->pgdir);
+  acquire(&mmtab.lock);
+  mm->pgdir = 0;
+  mm->ref = 0;
+  release(&mmtab.lock);
+}
+
+void
+mmlock(struct mm *mm)
+{
+  acquire(&mmtab.lock);
+  while(mm->busy)
+    sleep(mm, &mmtab.lock);
+  mm->busy = 1;
+  release(&mmtab.lock);
+}
+
+void
+mmunlock(struct mm *mm)
+{
+  acquire(&mmtab.lock);
+  mm->busy = 0;
+  wakeup(mm);
+  release(&mmtab.lock);
+}
+
+// Flush this CPU's TLB if it is using mm's page table, and
+// make the other CPUs running threads of mm do the same,
+// waiting until they have.  Call it after mappings change.
+// Caller must hold mmlock(mm), so that two CPUs never wait
+// on each other.
+static void
+tlbflush(struct mm *mm)
+{
+  struct cpu *c, *me;
+  struct proc *p;
+  uint n;
+
+  if(rcr3() == V2P(mm->pgdir))
+    lcr3(V2P(mm->pgdir));
+  if(mm->ref < 2)
+    return;
+  pushcli();
+  me = mycpu();
+  popcli();
+  for(c = cpus; c < &cpus[ncpu]; c++){
+    if(c == me || (p = c->proc) == 0 || p->mm != mm)
+      continue;
+    n = c->tlbflushes;
+    lapicipi(c->apicid, T_IRQ0 + IRQ_TLB);
+    while(c->tlbflushes == n)
+      pause();
+  }
+}
+
+// Return the memory region of mm containing va, or 0.
+static struct vma*
+findvma(struct mm *mm, uint va)
+{
+  struct vma *v;
+
+  for(v = mm->vma; v < &mm->vma[NVMA]; v++)
+    if(v->end && v->start <= va && va < v->end)
+      return v;
+  return 0;
+}
+
+// Give mm a private, writable copy of the read-only page
+// mapped by pte.
+static int
+cowpage(struct mm *mm, pte_t *pte)
+{
+  char *mem, *old;
+
+  old = P2V(PTE_ADDR(*pte));
+  if(krefcount(old) == 1){
+    // Nobody else has it any more; just take it.
+    *pte |= PTE_W;
+  } else {
+    if((mem = kalloc()) == 0){
+      cprintf("vmfault out of memory\n");
+      return -1;
+    }
+    memmove(mem, old, PGSIZE);
+    *pte = V2P(mem) | PTE_FLAGS(*pte) | PTE_W;
+    kfree(old);
+  }
+  tlbflush(mm);  // drop the stale read-only entries
+  return 0;
+}
+
+// Read the page at va of region v in from its file.  Whole
+// pages of file data come from the page cache and are mapped
+// read-only, so that every process running the same program
+// shares them; the first write makes a private copy.  Pages
+// that are partly or wholly past the file data are private.
+static char*
+filepage(struct vma *v, uint va, int write, int *perm)
+{
+  char *mem, *page;
+  uint pgoff, n;
+
+  pgoff = va - v->start;
+  n = 0;
+  if(pgoff < v->filesz)
+    n = v->filesz - pgoff < PGSIZE ? v->filesz - pgoff : PGSIZE;
+
+  ilock(v->ip);
+  if(n == PGSIZE && (v->flags & VMA_SHARED)){
+    // Shared file mappings all use the cached page itself.
+    page = pcacheget(v->ip, v->off + pgoff);
+    *perm = PTE_U | ((v->flags & VMA_WRITE) ? PTE_W : 0);
+  } else if(n == PGSIZE){
+    page = pcacheget(v->ip, v->off + pgoff);
+    *perm = PTE_U;
+    if(page && write){
+      mem = kalloc();
+      if(mem)
+        memmove(mem, page, PGSIZE);
+      kfree(page);
+      page = mem;
+      *perm = PTE_W|PTE_U;
+    }
+  } else {
+    if((page = kalloc()) != 0){
+      memset(page, 0, PGSIZE);
+      if(n > 0 && readi(v->ip, page, v->off + pgoff, n) != n){
+        kfree(page);
+        page = 0;
+      }
+    }
+    *perm = PTE_U | ((v->flags & VMA_WRITE) ? PTE_W : 0);
+  }
+  iunlock(v->ip);
+  return page;
+}
+
+// Handle a fault at va in mm, as vmfault does.
+// Caller must hold mmlock(mm).
+static int
+fault(struct mm *mm, uint va, int write)
+{
+  char *mem;
+  pte_t *pte;
+  uint a;
+  int perm;
+  struct vma *v;
+
+  a = PGROUNDDOWN(va);
+  v = findvma(mm, a);
+  if(va >= mm->sz && v == 0)
+    return -1;
+  if(write && v && (v->flags & VMA_WRITE) == 0)
+    return -1;
+  pte = walkpgdir(mm->pgdir, (char*)a, 0);
+  if(pte && (*pte & PTE_P)){
+    // Already mapped.  Fine unless it is the stack guard page
+    // or a write to a shared read-only page.
+    if((*pte & PTE_U) == 0)
+      return -1;
+    if(write && (*pte & PTE_W) == 0)
+      return v ? cowpage(mm, pte) : -1;
+    return 0;
+  }
+
+  if(v && v->shm){
+    if((mem = shmpage(v->shm, v->off + (a - v->start))) == 0)
+      return -1;
+    kdup(mem);
+    perm = PTE_W|PTE_U;
+  } else if(v && v->ip){
+    if((mem = filepage(v, a, write, &perm)) == 0){
+      cprintf("vmfault: cannot read page\n");
+      return -1;
+    }
+  } else {
+    if((mem = kalloc()) == 0){
+      cprintf("vmfault out of memory\n");
+      return -1;
+    }
+    memset(mem, 0, PGSIZE);
+    perm = PTE_U;
+    if(v == 0 || (v->flags & VMA_WRITE))
+      perm |= PTE_W;
+  }
+  if(mappages(mm->pgdir, (char*)a, PGSIZE, V2P(mem), perm) < 0){
+    cprintf("vmfault out of memory (2)\n");
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+
+// Handle a page fault at user virtual address va in process p.
+// Nothing is mapped until it is touched: program text and data
+// and file mappings are read in by filepage(), while pages of
+// the heap grown by sbrk() and of anonymous mappings are
+// zero-filled.  Shared-memory segment pages come from shm.c.
+// Returns 0 if the page is now mapped with the access the fault
+// asked for, -1 if the access is not legal and the process
+// should be killed.
+int
+vmfault(struct proc *p, uint va, int write)
+{
+  int r;
+
+  mmlock(p->mm);
+  r = fault(p->mm, va, write);
+  mmunlock(p->mm);
+  return r;
+}
+
+// Make sure every page in [va, va+n) is mapped in p, faulting in
+// any lazily allocated pages.  System calls use this before the
+// kernel touches user memory, since a page fault taken in kernel
+// mode doesn't fault pages in: it just makes ucopy() fail.
+// Returns 0 on success, -1 on failure.
+int
+vmprefault(struct proc *p, uint va, uint n, int write)
+{
+  uint a, last;
+  int r;
+
+  if(n == 0)
+    return 0;
+  if(va + n < va)
+    return -1;
+  a = PGROUNDDOWN(va);
+  last = PGROUNDDOWN(va + n - 1);
+  mmlock(p->mm);
+  for(;;){
+    if((r = fault(p->mm, a, write)) < 0 || a == last)
+      break;
+    a += PGSIZE;
+  }
+  mmunlock(p->mm);
+  return r;
+}
+
+// Copy the page mapped at va in pgdir s, if any, to pgdir d.
+// Read-only pages, and every page if share is set, are shared
+// rather than copied.
+static int
+copypage(pde_t *d, pde_t *s, uint va, int share)
+{
+  pte_t *pte;
+  uint pa, flags;
+  char *mem;
+
+  if((pte = walkpgdir(s, (void*)va, 0)) == 0 || !(*pte & PTE_P))
+    return 0;
+  pa = PTE_ADDR(*pte);
+  flags = PTE_FLAGS(*pte);
+  if(share || (flags & PTE_W) == 0){
+    // Nobody writes to a read-only page in place (see
+    // vmfault), so parent and child can share it.
+    kdup(P2V(pa));
+    if(mappages(d, (void*)va, PGSIZE, pa, flags) < 0){
+      kfree(P2V(pa));
+      return -1;
+    }
+    return 0;
+  }
+  if((mem = kalloc()) == 0)
+    return -1;
+  memmove(mem, (char*)P2V(pa), PGSIZE);
+  if(mappages(d, (void*)va, PGSIZE, V2P(mem), flags) < 0){
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+
 // Given a parent process's page table, create a copy
 // of it for a child.
 pde_t*
 copyuvm(pde_t *pgdir, uint sz)
 {
   pde_t *d;
-  pte_t *pte;
-  uint pa, i, flags;
-  char *mem;
+  uint i;
 
   if((d = setupkvm()) == 0)
     return 0;
-  for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
-      panic("copyuvm: pte should exist");
-    if(!(*pte & PTE_P))
-      panic("copyuvm: page not present");
-    pa = PTE_ADDR(*pte);
-    flags = PTE_FLAGS(*pte);
-    if((mem = kalloc()) == 0)
+  // Heap pages that were never touched are not mapped;
+  // the child will fault them in on its own.
+  for(i = 0; i < sz; i += PGSIZE)
+    if(copypage(d, pgdir, i, 0) < 0)
       goto bad;
-    memmove(mem, (char*)P2V(pa), PGSIZE);
-    if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0)
-      goto bad;
-  }
   return d;
 
 bad:
@@ -342,6 +649,370 @@ bad:
   return 0;
 }
 
+// Take another reference to whatever backs region v.
+static void
+vmadup(struct vma *v)
+{
+  if(v->ip)
+    idup(v->ip);
+  if(v->shm)
+    shmdup(v->shm);
+}
+
+// Release region v.
+// Must not be called inside a transaction.
+static void
+vmaput(struct vma *v)
+{
+  if(v->ip){
+    begin_op();
+    iput(v->ip);
+    end_op();
+  }
+  if(v->shm)
+    shmput(v->shm);
+  memset(v, 0, sizeof(*v));
+}
+
+// Give child np a copy of p's memory: its page table, and its
+// memory regions along with the pages of its mmap regions,
+// which lie above sz.  Pages of shared regions are shared.
+int
+copymm(struct proc *np, struct proc *p)
+{
+  struct mm *nm, *mm;
+  struct vma *v;
+  uint a;
+  int i;
+
+  nm = np->mm;
+  mm = p->mm;
+  mmlock(mm);
+  if((nm->pgdir = copyuvm(mm->pgdir, mm->sz)) == 0)
+    goto bad;
+  nm->sz = mm->sz;
+  for(v = mm->vma; v < &mm->vma[NVMA]; v++){
+    if(!(v->flags & VMA_MMAP))
+      continue;
+    for(a = v->start; a < v->end; a += PGSIZE){
+      // Untouched pages of a shared anonymous region must exist
+      // now, or parent and child would each fill in their own.
+      if(v->ip == 0 && v->shm == 0 && (v->flags & VMA_SHARED) &&
+         fault(mm, a, 0) < 0)
+        goto bad;
+      if(copypage(nm->pgdir, mm->pgdir, a, v->flags & VMA_SHARED) < 0)
+        goto bad;
+    }
+  }
+  for(i = 0; i < NVMA; i++){
+    nm->vma[i] = mm->vma[i];
+    vmadup(&nm->vma[i]);
+  }
+  mmunlock(mm);
+  return 0;
+
+bad:
+  mmunlock(mm);
+  return -1;
+}
+
+// Write the dirty pages of shared file region v that lie in
+// [start, end) back to the file.  Bytes past the end of the
+// file are not written; mappings never grow a file.
+// Caller must hold mmlock(mm), if mm is in use.
+// Must not be called inside a transaction.
+static void
+vmasync(struct mm *mm, pde_t *pgdir, struct vma *v, uint start, uint end)
+{
+  pte_t *pte;
+  uint a, off, n;
+
+  if(v->ip == 0 || (v->flags & (VMA_SHARED|VMA_WRITE)) != (VMA_SHARED|VMA_WRITE))
+    return;
+  for(a = start; a < end; a += PGSIZE){
+    pte = walkpgdir(pgdir, (void*)a, 0);
+    if(pte == 0 || (*pte & (PTE_P|PTE_D)) != (PTE_P|PTE_D))
+      continue;
+    // Clear the dirty bit before writing, and drop any TLB
+    // entry that still has it set, so later stores are seen.
+    *pte &= ~PTE_D;
+    if(mm)
+      tlbflush(mm);
+    off = v->off + (a - v->start);
+    begin_op();
+    ilock(v->ip);
+    if(off < v->ip->size){
+      n = v->ip->size - off < PGSIZE ? v->ip->size - off : PGSIZE;
+      writei(v->ip, P2V(PTE_ADDR(*pte)), off, n);
+    }
+    iunlock(v->ip);
+    end_op();
+  }
+}
+
+// Drop all the memory regions in vma, first writing back
+// the dirty pages of shared file mappings in pgdir (if any),
+// which must not be in use.
+// Must not be called inside a transaction.
+void
+freevma(pde_t *pgdir, struct vma *vma)
+{
+  int i;
+
+  for(i = 0; i < NVMA; i++){
+    if(pgdir && vma[i].end)
+      vmasync(0, pgdir, &vma[i], vma[i].start, vma[i].end);
+    vmaput(&vma[i]);
+  }
+}
+
+// Unmap and free the pages of mm in [start, end).
+// Caller must hold mmlock(mm).
+static void
+unmap(struct mm *mm, uint start, uint end)
+{
+  deallocuvm(mm->pgdir, end, start);
+  tlbflush(mm);
+}
+
+// Return the lowest address used by the mmap regions
+// of mm, which is as far as the heap may grow.
+static uint
+mmapbase(struct mm *mm)
+{
+  struct vma *v;
+  uint base;
+
+  base = KERNBASE;
+  for(v = mm->vma; v < &mm->vma[NVMA]; v++)
+    if((v->flags & VMA_MMAP) && v->start < base)
+      base = v->start;
+  return base;
+}
+
+// Grow p's memory by n bytes, or shrink it if n is negative.
+// Growing only reserves address space; the pages are
+// allocated and zeroed when first touched (see vmfault).
+// Returns the old size, or -1.
+int
+growmm(struct proc *p, int n)
+{
+  struct mm *mm = p->mm;
+  uint sz, old;
+
+  mmlock(mm);
+  old = sz = mm->sz;
+  if(n > 0){
+    if(sz + n < sz || sz + n > mmapbase(mm))
+      goto bad;
+    // Refuse requests that could never be backed by memory.
+    if((PGROUNDUP(sz + n) - PGROUNDUP(sz)) / PGSIZE > kfreecount())
+      goto bad;
+    sz += n;
+  } else if(n < 0){
+    if(sz + n > sz)
+      goto bad;
+    sz += n;
+    unmap(mm, PGROUNDUP(sz), PGROUNDUP(old));
+  }
+  mm->sz = sz;
+  mmunlock(mm);
+  return old;
+
+bad:
+  mmunlock(mm);
+  return -1;
+}
+
+// Find a free region slot in mm and room for len bytes
+// of mmap region, placed downward from KERNBASE below any
+// existing regions.  Returns the slot with start, end and
+// flags set, or 0.  Caller must hold mmlock(mm).
+static struct vma*
+vmaalloc(struct mm *mm, uint len)
+{
+  struct vma *v, *nv;
+  uint top, start;
+
+  len = PGROUNDUP(len);
+  if(len == 0 || len >= KERNBASE)
+    return 0;
+  nv = 0;
+  for(v = mm->vma; v < &mm->vma[NVMA]; v++)
+    if(v->end == 0){
+      nv = v;
+      break;
+    }
+  if(nv == 0)
+    return 0;
+
+  top = KERNBASE;
+again:
+  if(top < mm->sz || top - mm->sz < len)
+    return 0;
+  start = top - len;
+  for(v = mm->vma; v < &mm->vma[NVMA]; v++){
+    if(v->end && v->start < top && start < v->end){
+      top = v->start;
+      goto again;
+    }
+  }
+
+  memset(nv, 0, sizeof(*nv));
+  nv->start = start;
+  nv->end = start + len;
+  nv->flags = VMA_MMAP;
+  return nv;
+}
+
+// Map len bytes of ip starting at file offset off into p,
+// or zero-filled memory if ip is 0.
+// Returns the address of the region, or -1.
+int
+mmap(struct proc *p, uint len, int flags, struct inode *ip, uint off)
+{
+  struct vma *v;
+  int addr;
+
+  mmlock(p->mm);
+  addr = -1;
+  if((v = vmaalloc(p->mm, len)) != 0){
+    v->flags |= flags;
+    v->ip = ip ? idup(ip) : 0;
+    v->off = off;
+    v->filesz = v->end - v->start;
+    addr = v->start;
+  }
+  mmunlock(p->mm);
+  return addr;
+}
+
+// Map shared-memory segment s into p, taking over the
+// caller's attachment.  Returns the address, or -1.
+int
+shmmap(struct proc *p, struct shm *s)
+{
+  struct vma *v;
+  int addr;
+
+  mmlock(p->mm);
+  addr = -1;
+  if((v = vmaalloc(p->mm, shmsize(s))) != 0){
+    v->flags |= VMA_SHARED | VMA_WRITE;
+    v->shm = s;
+    addr = v->start;
+  }
+  mmunlock(p->mm);
+  return addr;
+}
+
+// Write back the dirty pages of shared file mappings
+// in [addr, addr+len).
+int
+msync(struct proc *p, uint addr, uint len)
+{
+  struct mm *mm = p->mm;
+  struct vma *v;
+  uint end;
+
+  end = PGROUNDUP(addr + len);
+  if(addr % PGSIZE || end < addr)
+    return -1;
+  mmlock(mm);
+  for(v = mm->vma; v < &mm->vma[NVMA]; v++){
+    if((v->flags & VMA_MMAP) && v->start < end && addr < v->end)
+      vmasync(mm, mm->pgdir, v,
+              addr > v->start ? addr : v->start,
+              end < v->end ? end : v->end);
+  }
+  mmunlock(mm);
+  return 0;
+}
+
+// Remove the mappings of mm in [addr, end), as munmap does.
+// Caller must hold mmlock(mm).
+static int
+unmapvma(struct mm *mm, uint addr, uint end)
+{
+  struct vma *v, *nv;
+  uint s, e;
+
+  // Find a slot for the upper half of a split region
+  // before changing anything.
+  nv = 0;
+  for(v = mm->vma; v < &mm->vma[NVMA]; v++){
+    if((v->flags & VMA_MMAP) && v->start < addr && end < v->end){
+      for(nv = mm->vma; nv < &mm->vma[NVMA]; nv++)
+        if(nv->end == 0)
+          break;
+      if(nv == &mm->vma[NVMA])
+        return -1;
+      *nv = *v;
+      nv->start = end;
+      nv->off += end - v->start;
+      nv->filesz -= end - v->start;
+      vmadup(nv);
+      v->end = end;
+      break;
+    }
+  }
+
+  for(v = mm->vma; v < &mm->vma[NVMA]; v++){
+    if(!(v->flags & VMA_MMAP) || v->start >= end || addr >= v->end)
+      continue;
+    s = addr > v->start ? addr : v->start;
+    e = end < v->end ? end : v->end;
+    vmasync(mm, mm->pgdir, v, s, e);
+    unmap(mm, s, e);
+    if(s == v->start && e == v->end){
+      vmaput(v);
+    } else if(s == v->start){
+      v->off += e - v->start;
+      v->filesz -= e - v->start;
+      v->start = e;
+    } else {
+      v->end = s;
+    }
+  }
+  return 0;
+}
+
+// Remove the mappings in [addr, addr+len), writing dirty
+// shared file pages back first.  A region that loses its
+// middle is split in two.
+int
+munmap(struct proc *p, uint addr, uint len)
+{
+  uint end;
+  int r;
+
+  end = PGROUNDUP(addr + len);
+  if(addr % PGSIZE || end <= addr)
+    return -1;
+  mmlock(p->mm);
+  r = unmapvma(p->mm, addr, end);
+  mmunlock(p->mm);
+  return r;
+}
+
+// Detach the shared-memory segment mapped at addr in p.
+int
+shmunmap(struct proc *p, uint addr)
+{
+  struct vma *v;
+  int r;
+
+  mmlock(p->mm);
+  r = -1;
+  for(v = p->mm->vma; v < &p->mm->vma[NVMA]; v++)
+    if(v->shm && v->start == addr){
+      r = unmapvma(p->mm, v->start, v->end);
+      break;
+    }
+  mmunlock(p->mm);
+  return r;
+}
+
 //PAGEBREAK!
 // Map user virtual address to kernel address.
 char*
@@ -350,6 +1021,8 @@ uva2ka(pde_t *pgdir, char *uva)
   pte_t *pte;
 
   pte = walkpgdir(pgdir, uva, 0);
+  if(pte == 0)
+    return 0;
   if((*pte & PTE_P) == 0)
     return 0;
   if((*pte & PTE_U) == 0)
@@ -360,15 +1033,22 @@ uva2ka(pde_t *pgdir, char *uva)
 // Copy len bytes from p to user address va in page table pgdir.
 // Most useful when pgdir is not the current page table.
 // uva2ka ensures this only works for PTE_U pages.
+// If pgdir belongs to the current process, pages that have
+// not been faulted in yet or are shared read-only are made
+// private and writable on the way (see vmfault).
 int
 copyout(pde_t *pgdir, uint va, void *p, uint len)
 {
   char *buf, *pa0;
   uint n, va0;
+  struct proc *curproc = myproc();
 
   buf = (char*)p;
   while(len > 0){
     va0 = (uint)PGROUNDDOWN(va);
+    if(curproc && curproc->mm && curproc->mm->pgdir == pgdir &&
+       vmfault(curproc, va0, 1) < 0)
+      return -1;
     pa0 = uva2ka(pgdir, (char*)va0);
     if(pa0 == 0)
       return -1;
@@ -0,0 +1,1368 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 01 00 00 00       	mov    $0x1,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  24:	83 f8 01             	cmp    $0x1,%eax
+  27:	7f 28                	jg     51 <main+0x51>
+  29:	eb 54                	jmp    7f <main+0x7f>
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "wc: cannot open %s\n", argv[i]);
+      exit();
+    }
+    wc(fd, argv[i]);
+  30:	83 ec 08             	sub    $0x8,%esp
+  33:	ff 33                	push   (%ebx)
+  for(i = 1; i < argc; i++){
+  35:	83 c6 01             	add    $0x1,%esi
+  38:	83 c3 04             	add    $0x4,%ebx
+    wc(fd, argv[i]);
+  3b:	50                   	push   %eax
+  3c:	e8 5f 00 00 00       	call   a0 <wc>
+    close(fd);
+  41:	89 3c 24             	mov    %edi,(%esp)
+  44:	e8 a3 03 00 00       	call   3ec <close>
+  for(i = 1; i < argc; i++){
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  4f:	74 29                	je     7a <main+0x7a>
+    if((fd = open(argv[i], 0)) < 0){
+  51:	83 ec 08             	sub    $0x8,%esp
+  54:	6a 00                	push   $0x0
+  56:	ff 33                	push   (%ebx)
+  58:	e8 a7 03 00 00       	call   404 <open>
+  5d:	83 c4 10             	add    $0x10,%esp
+  60:	89 c7                	mov    %eax,%edi
+  62:	85 c0                	test   %eax,%eax
+  64:	79 ca                	jns    30 <main+0x30>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+  66:	50                   	push   %eax
+  67:	ff 33                	push   (%ebx)
+  69:	68 db 08 00 00       	push   $0x8db
+  6e:	6a 01                	push   $0x1
+  70:	e8 1b 05 00 00       	call   590 <printf>
+      exit();
+  75:	e8 4a 03 00 00       	call   3c4 <exit>
+  }
+  exit();
+  7a:	e8 45 03 00 00       	call   3c4 <exit>
+    wc(0, "");
+  7f:	52                   	push   %edx
+  80:	52                   	push   %edx
+  81:	68 cd 08 00 00       	push   $0x8cd
+  86:	6a 00                	push   $0x0
+  88:	e8 13 00 00 00       	call   a0 <wc>
+    exit();
+  8d:	e8 32 03 00 00       	call   3c4 <exit>
+  92:	66 90                	xchg   %ax,%ax
+  94:	66 90                	xchg   %ax,%ax
+  96:	66 90                	xchg   %ax,%ax
+  98:	66 90                	xchg   %ax,%ax
+  9a:	66 90                	xchg   %ax,%ax
+  9c:	66 90                	xchg   %ax,%ax
+  9e:	66 90                	xchg   %ax,%ax
+
+000000a0 <wc>:
+{
+  a0:	55                   	push   %ebp
+  l = w = c = 0;
+  a1:	31 d2                	xor    %edx,%edx
+{
+  a3:	89 e5                	mov    %esp,%ebp
+  a5:	57                   	push   %edi
+  a6:	56                   	push   %esi
+  inword = 0;
+  a7:	31 f6                	xor    %esi,%esi
+{
+  a9:	53                   	push   %ebx
+  l = w = c = 0;
+  aa:	31 db                	xor    %ebx,%ebx
+{
+  ac:	83 ec 1c             	sub    $0x1c,%esp
+  l = w = c = 0;
+  af:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  b6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  c0:	83 ec 04             	sub    $0x4,%esp
+  c3:	68 00 02 00 00       	push   $0x200
+  c8:	68 40 0c 00 00       	push   $0xc40
+  cd:	ff 75 08             	push   0x8(%ebp)
+  d0:	e8 07 03 00 00       	call   3dc <read>
+  d5:	83 c4 10             	add    $0x10,%esp
+  d8:	89 c1                	mov    %eax,%ecx
+  da:	85 c0                	test   %eax,%eax
+  dc:	7e 62                	jle    140 <wc+0xa0>
+    for(i=0; i<n; i++){
+  de:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  e1:	31 ff                	xor    %edi,%edi
+  e3:	eb 0d                	jmp    f2 <wc+0x52>
+  e5:	8d 76 00             	lea    0x0(%esi),%esi
+        inword = 0;
+  e8:	31 f6                	xor    %esi,%esi
+    for(i=0; i<n; i++){
+  ea:	83 c7 01             	add    $0x1,%edi
+  ed:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  f0:	74 3e                	je     130 <wc+0x90>
+      if(buf[i] == '\n')
+  f2:	0f be 87 40 0c 00 00 	movsbl 0xc40(%edi),%eax
+        l++;
+  f9:	31 c9                	xor    %ecx,%ecx
+  fb:	3c 0a                	cmp    $0xa,%al
+  fd:	0f 94 c1             	sete   %cl
+      if(strchr(" \r\t\n\v", buf[i]))
+ 100:	83 ec 08             	sub    $0x8,%esp
+ 103:	50                   	push   %eax
+        l++;
+ 104:	01 cb                	add    %ecx,%ebx
+      if(strchr(" \r\t\n\v", buf[i]))
+ 106:	68 b8 08 00 00       	push   $0x8b8
+ 10b:	e8 f0 00 00 00       	call   200 <strchr>
+ 110:	83 c4 10             	add    $0x10,%esp
+ 113:	85 c0                	test   %eax,%eax
+ 115:	75 d1                	jne    e8 <wc+0x48>
+      else if(!inword){
+ 117:	85 f6                	test   %esi,%esi
+ 119:	75 cf                	jne    ea <wc+0x4a>
+        w++;
+ 11b:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+        inword = 1;
+ 11f:	be 01 00 00 00       	mov    $0x1,%esi
+    for(i=0; i<n; i++){
+ 124:	83 c7 01             	add    $0x1,%edi
+ 127:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+ 12a:	75 c6                	jne    f2 <wc+0x52>
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      c++;
+ 130:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 133:	01 4d dc             	add    %ecx,-0x24(%ebp)
+ 136:	eb 88                	jmp    c0 <wc+0x20>
+ 138:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13f:	90                   	nop
+  if(n < 0){
+ 140:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 143:	75 22                	jne    167 <wc+0xc7>
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+ 145:	83 ec 08             	sub    $0x8,%esp
+ 148:	ff 75 0c             	push   0xc(%ebp)
+ 14b:	52                   	push   %edx
+ 14c:	ff 75 e0             	push   -0x20(%ebp)
+ 14f:	53                   	push   %ebx
+ 150:	68 ce 08 00 00       	push   $0x8ce
+ 155:	6a 01                	push   $0x1
+ 157:	e8 34 04 00 00       	call   590 <printf>
+}
+ 15c:	83 c4 20             	add    $0x20,%esp
+ 15f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 162:	5b                   	pop    %ebx
+ 163:	5e                   	pop    %esi
+ 164:	5f                   	pop    %edi
+ 165:	5d                   	pop    %ebp
+ 166:	c3                   	ret
+    printf(1, "wc: read error\n");
+ 167:	50                   	push   %eax
+ 168:	50                   	push   %eax
+ 169:	68 be 08 00 00       	push   $0x8be
+ 16e:	6a 01                	push   $0x1
+ 170:	e8 1b 04 00 00       	call   590 <printf>
+    exit();
+ 175:	e8 4a 02 00 00       	call   3c4 <exit>
+ 17a:	66 90                	xchg   %ax,%ax
+ 17c:	66 90                	xchg   %ax,%ax
+ 17e:	66 90                	xchg   %ax,%ax
+
+00000180 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 180:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 181:	31 c0                	xor    %eax,%eax
+{
+ 183:	89 e5                	mov    %esp,%ebp
+ 185:	53                   	push   %ebx
+ 186:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 189:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 18c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 190:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 194:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 197:	83 c0 01             	add    $0x1,%eax
+ 19a:	84 d2                	test   %dl,%dl
+ 19c:	75 f2                	jne    190 <strcpy+0x10>
+    ;
+  return os;
+}
+ 19e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1a1:	89 c8                	mov    %ecx,%eax
+ 1a3:	c9                   	leave
+ 1a4:	c3                   	ret
+ 1a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001b0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1b6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1b9:	74 15                	je     1d0 <strlen+0x20>
+ 1bb:	31 c0                	xor    %eax,%eax
+ 1bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 1c0:	83 c0 01             	add    $0x1,%eax
+ 1c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1c7:	89 c1                	mov    %eax,%ecx
+ 1c9:	75 f5                	jne    1c0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1cb:	89 c8                	mov    %ecx,%eax
+ 1cd:	5d                   	pop    %ebp
+ 1ce:	c3                   	ret
+ 1cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1d0:	31 c9                	xor    %ecx,%ecx
+}
+ 1d2:	5d                   	pop    %ebp
+ 1d3:	89 c8                	mov    %ecx,%eax
+ 1d5:	c3                   	ret
+ 1d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ed:	89 d7                	mov    %edx,%edi
+ 1ef:	fc                   	cld
+ 1f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1f5:	89 d0                	mov    %edx,%eax
+ 1f7:	c9                   	leave
+ 1f8:	c3                   	ret
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	8b 45 08             	mov    0x8(%ebp),%eax
+ 206:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 20a:	0f b6 10             	movzbl (%eax),%edx
+ 20d:	84 d2                	test   %dl,%dl
+ 20f:	75 12                	jne    223 <strchr+0x23>
+ 211:	eb 1d                	jmp    230 <strchr+0x30>
+ 213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 217:	90                   	nop
+ 218:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 21c:	83 c0 01             	add    $0x1,%eax
+ 21f:	84 d2                	test   %dl,%dl
+ 221:	74 0d                	je     230 <strchr+0x30>
+    if(*s == c)
+ 223:	38 d1                	cmp    %dl,%cl
+ 225:	75 f1                	jne    218 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 227:	5d                   	pop    %ebp
+ 228:	c3                   	ret
+ 229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 230:	31 c0                	xor    %eax,%eax
+}
+ 232:	5d                   	pop    %ebp
+ 233:	c3                   	ret
+ 234:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 23f:	90                   	nop
+
+00000240 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 245:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 248:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 249:	31 db                	xor    %ebx,%ebx
+{
+ 24b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 24e:	eb 27                	jmp    277 <gets+0x37>
+    cc = read(0, &c, 1);
+ 250:	83 ec 04             	sub    $0x4,%esp
+ 253:	6a 01                	push   $0x1
+ 255:	56                   	push   %esi
+ 256:	6a 00                	push   $0x0
+ 258:	e8 7f 01 00 00       	call   3dc <read>
+    if(cc < 1)
+ 25d:	83 c4 10             	add    $0x10,%esp
+ 260:	85 c0                	test   %eax,%eax
+ 262:	7e 1d                	jle    281 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 264:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 268:	8b 55 08             	mov    0x8(%ebp),%edx
+ 26b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 26f:	3c 0a                	cmp    $0xa,%al
+ 271:	74 10                	je     283 <gets+0x43>
+ 273:	3c 0d                	cmp    $0xd,%al
+ 275:	74 0c                	je     283 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 277:	89 df                	mov    %ebx,%edi
+ 279:	83 c3 01             	add    $0x1,%ebx
+ 27c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 27f:	7c cf                	jl     250 <gets+0x10>
+ 281:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 283:	8b 45 08             	mov    0x8(%ebp),%eax
+ 286:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 28a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 28d:	5b                   	pop    %ebx
+ 28e:	5e                   	pop    %esi
+ 28f:	5f                   	pop    %edi
+ 290:	5d                   	pop    %ebp
+ 291:	c3                   	ret
+ 292:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	56                   	push   %esi
+ 2a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2a5:	83 ec 08             	sub    $0x8,%esp
+ 2a8:	6a 00                	push   $0x0
+ 2aa:	ff 75 08             	push   0x8(%ebp)
+ 2ad:	e8 52 01 00 00       	call   404 <open>
+  if(fd < 0)
+ 2b2:	83 c4 10             	add    $0x10,%esp
+ 2b5:	85 c0                	test   %eax,%eax
+ 2b7:	78 27                	js     2e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2b9:	83 ec 08             	sub    $0x8,%esp
+ 2bc:	ff 75 0c             	push   0xc(%ebp)
+ 2bf:	89 c3                	mov    %eax,%ebx
+ 2c1:	50                   	push   %eax
+ 2c2:	e8 55 01 00 00       	call   41c <fstat>
+  close(fd);
+ 2c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2cc:	e8 1b 01 00 00       	call   3ec <close>
+  return r;
+ 2d1:	83 c4 10             	add    $0x10,%esp
+}
+ 2d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2d7:	89 f0                	mov    %esi,%eax
+ 2d9:	5b                   	pop    %ebx
+ 2da:	5e                   	pop    %esi
+ 2db:	5d                   	pop    %ebp
+ 2dc:	c3                   	ret
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2e5:	eb ed                	jmp    2d4 <stat+0x34>
+ 2e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ee:	66 90                	xchg   %ax,%ax
+
+000002f0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	57                   	push   %edi
+ 2f4:	56                   	push   %esi
+ 2f5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 2fe:	85 c0                	test   %eax,%eax
+ 300:	7e 13                	jle    315 <memmove+0x25>
+ 302:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 304:	89 d7                	mov    %edx,%edi
+ 306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 310:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 311:	39 f8                	cmp    %edi,%eax
+ 313:	75 fb                	jne    310 <memmove+0x20>
+  return vdst;
+}
+ 315:	5e                   	pop    %esi
+ 316:	89 d0                	mov    %edx,%eax
+ 318:	5f                   	pop    %edi
+ 319:	5d                   	pop    %ebp
+ 31a:	c3                   	ret
+ 31b:	66 90                	xchg   %ax,%ax
+ 31d:	66 90                	xchg   %ax,%ax
+ 31f:	90                   	nop
+
+00000320 <strcmp>:
+#include "types.h"
+#include "util.h"
+
+int
+strcmp(const char *p, const char *q)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	53                   	push   %ebx
+ 324:	8b 55 08             	mov    0x8(%ebp),%edx
+ 327:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 32a:	0f b6 02             	movzbl (%edx),%eax
+ 32d:	84 c0                	test   %al,%al
+ 32f:	75 17                	jne    348 <strcmp+0x28>
+ 331:	eb 3a                	jmp    36d <strcmp+0x4d>
+ 333:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 337:	90                   	nop
+ 338:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 33c:	83 c2 01             	add    $0x1,%edx
+ 33f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 342:	84 c0                	test   %al,%al
+ 344:	74 1a                	je     360 <strcmp+0x40>
+    p++, q++;
+ 346:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 348:	0f b6 19             	movzbl (%ecx),%ebx
+ 34b:	38 c3                	cmp    %al,%bl
+ 34d:	74 e9                	je     338 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 34f:	29 d8                	sub    %ebx,%eax
+}
+ 351:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 354:	c9                   	leave
+ 355:	c3                   	ret
+ 356:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 360:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 364:	31 c0                	xor    %eax,%eax
+ 366:	29 d8                	sub    %ebx,%eax
+}
+ 368:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 36b:	c9                   	leave
+ 36c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 36d:	0f b6 19             	movzbl (%ecx),%ebx
+ 370:	31 c0                	xor    %eax,%eax
+ 372:	eb db                	jmp    34f <strcmp+0x2f>
+ 374:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 37f:	90                   	nop
+
+00000380 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	53                   	push   %ebx
+ 384:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 387:	0f be 02             	movsbl (%edx),%eax
+ 38a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 38d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 390:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 395:	77 1e                	ja     3b5 <atoi+0x35>
+ 397:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3a0:	83 c2 01             	add    $0x1,%edx
+ 3a3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3a6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3aa:	0f be 02             	movsbl (%edx),%eax
+ 3ad:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3b0:	80 fb 09             	cmp    $0x9,%bl
+ 3b3:	76 eb                	jbe    3a0 <atoi+0x20>
+  return n;
+ 3b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3b8:	89 c8                	mov    %ecx,%eax
+ 3ba:	c9                   	leave
+ 3bb:	c3                   	ret
+
+000003bc <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3bc:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3c1:	cd 40                	int    $0x40
+ 3c3:	c3                   	ret
+
+000003c4 <exit>:
+SYSCALL(exit)
+ 3c4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3c9:	cd 40                	int    $0x40
+ 3cb:	c3                   	ret
+
+000003cc <wait>:
+SYSCALL(wait)
+ 3cc:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3d1:	cd 40                	int    $0x40
+ 3d3:	c3                   	ret
+
+000003d4 <pipe>:
+SYSCALL(pipe)
+ 3d4:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3d9:	cd 40                	int    $0x40
+ 3db:	c3                   	ret
+
+000003dc <read>:
+SYSCALL(read)
+ 3dc:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3e1:	cd 40                	int    $0x40
+ 3e3:	c3                   	ret
+
+000003e4 <write>:
+SYSCALL(write)
+ 3e4:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3e9:	cd 40                	int    $0x40
+ 3eb:	c3                   	ret
+
+000003ec <close>:
+SYSCALL(close)
+ 3ec:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3f1:	cd 40                	int    $0x40
+ 3f3:	c3                   	ret
+
+000003f4 <kill>:
+SYSCALL(kill)
+ 3f4:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3f9:	cd 40                	int    $0x40
+ 3fb:	c3                   	ret
+
+000003fc <exec>:
+SYSCALL(exec)
+ 3fc:	b8 07 00 00 00       	mov    $0x7,%eax
+ 401:	cd 40                	int    $0x40
+ 403:	c3                   	ret
+
+00000404 <open>:
+SYSCALL(open)
+ 404:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 409:	cd 40                	int    $0x40
+ 40b:	c3                   	ret
+
+0000040c <mknod>:
+SYSCALL(mknod)
+ 40c:	b8 11 00 00 00       	mov    $0x11,%eax
+ 411:	cd 40                	int    $0x40
+ 413:	c3                   	ret
+
+00000414 <unlink>:
+SYSCALL(unlink)
+ 414:	b8 12 00 00 00       	mov    $0x12,%eax
+ 419:	cd 40                	int    $0x40
+ 41b:	c3                   	ret
+
+0000041c <fstat>:
+SYSCALL(fstat)
+ 41c:	b8 08 00 00 00       	mov    $0x8,%eax
+ 421:	cd 40                	int    $0x40
+ 423:	c3                   	ret
+
+00000424 <link>:
+SYSCALL(link)
+ 424:	b8 13 00 00 00       	mov    $0x13,%eax
+ 429:	cd 40                	int    $0x40
+ 42b:	c3                   	ret
+
+0000042c <mkdir>:
+SYSCALL(mkdir)
+ 42c:	b8 14 00 00 00       	mov    $0x14,%eax
+ 431:	cd 40                	int    $0x40
+ 433:	c3                   	ret
+
+00000434 <chdir>:
+SYSCALL(chdir)
+ 434:	b8 09 00 00 00       	mov    $0x9,%eax
+ 439:	cd 40                	int    $0x40
+ 43b:	c3                   	ret
+
+0000043c <dup>:
+SYSCALL(dup)
+ 43c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 441:	cd 40                	int    $0x40
+ 443:	c3                   	ret
+
+00000444 <getpid>:
+SYSCALL(getpid)
+ 444:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 449:	cd 40                	int    $0x40
+ 44b:	c3                   	ret
+
+0000044c <sbrk>:
+SYSCALL(sbrk)
+ 44c:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 451:	cd 40                	int    $0x40
+ 453:	c3                   	ret
+
+00000454 <sleep>:
+SYSCALL(sleep)
+ 454:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 459:	cd 40                	int    $0x40
+ 45b:	c3                   	ret
+
+0000045c <uptime>:
+SYSCALL(uptime)
+ 45c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 461:	cd 40                	int    $0x40
+ 463:	c3                   	ret
+
+00000464 <arp>:
+SYSCALL(arp)
+ 464:	b8 16 00 00 00       	mov    $0x16,%eax
+ 469:	cd 40                	int    $0x40
+ 46b:	c3                   	ret
+
+0000046c <mmap>:
+SYSCALL(mmap)
+ 46c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 471:	cd 40                	int    $0x40
+ 473:	c3                   	ret
+
+00000474 <munmap>:
+SYSCALL(munmap)
+ 474:	b8 18 00 00 00       	mov    $0x18,%eax
+ 479:	cd 40                	int    $0x40
+ 47b:	c3                   	ret
+
+0000047c <msync>:
+SYSCALL(msync)
+ 47c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 481:	cd 40                	int    $0x40
+ 483:	c3                   	ret
+
+00000484 <shmcreate>:
+SYSCALL(shmcreate)
+ 484:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 489:	cd 40                	int    $0x40
+ 48b:	c3                   	ret
+
+0000048c <shmattach>:
+SYSCALL(shmattach)
+ 48c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 491:	cd 40                	int    $0x40
+ 493:	c3                   	ret
+
+00000494 <shmdetach>:
+SYSCALL(shmdetach)
+ 494:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 499:	cd 40                	int    $0x40
+ 49b:	c3                   	ret
+
+0000049c <futex_wait>:
+SYSCALL(futex_wait)
+ 49c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4a1:	cd 40                	int    $0x40
+ 4a3:	c3                   	ret
+
+000004a4 <futex_wake>:
+SYSCALL(futex_wake)
+ 4a4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4a9:	cd 40                	int    $0x40
+ 4ab:	c3                   	ret
+
+000004ac <nice>:
+SYSCALL(nice)
+ 4ac:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4b1:	cd 40                	int    $0x40
+ 4b3:	c3                   	ret
+
+000004b4 <setpriority>:
+SYSCALL(setpriority)
+ 4b4:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4b9:	cd 40                	int    $0x40
+ 4bb:	c3                   	ret
+
+000004bc <cputime>:
+SYSCALL(cputime)
+ 4bc:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4c1:	cd 40                	int    $0x40
+ 4c3:	c3                   	ret
+
+000004c4 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 4c4:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4c9:	cd 40                	int    $0x40
+ 4cb:	c3                   	ret
+
+000004cc <clone>:
+SYSCALL(clone)
+ 4cc:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4d1:	cd 40                	int    $0x40
+ 4d3:	c3                   	ret
+
+000004d4 <join>:
+SYSCALL(join)
+ 4d4:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4d9:	cd 40                	int    $0x40
+ 4db:	c3                   	ret
+
+000004dc <lockstat>:
+SYSCALL(lockstat)
+ 4dc:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4e1:	cd 40                	int    $0x40
+ 4e3:	c3                   	ret
+ 4e4:	66 90                	xchg   %ax,%ax
+ 4e6:	66 90                	xchg   %ax,%ax
+ 4e8:	66 90                	xchg   %ax,%ax
+ 4ea:	66 90                	xchg   %ax,%ax
+ 4ec:	66 90                	xchg   %ax,%ax
+ 4ee:	66 90                	xchg   %ax,%ax
+
+000004f0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	57                   	push   %edi
+ 4f4:	56                   	push   %esi
+ 4f5:	53                   	push   %ebx
+ 4f6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 4f8:	89 d1                	mov    %edx,%ecx
+{
+ 4fa:	83 ec 3c             	sub    $0x3c,%esp
+ 4fd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 500:	85 d2                	test   %edx,%edx
+ 502:	0f 89 80 00 00 00    	jns    588 <printint+0x98>
+ 508:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 50c:	74 7a                	je     588 <printint+0x98>
+    x = -xx;
+ 50e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 510:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 515:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 518:	31 f6                	xor    %esi,%esi
+ 51a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 520:	89 c8                	mov    %ecx,%eax
+ 522:	31 d2                	xor    %edx,%edx
+ 524:	89 f7                	mov    %esi,%edi
+ 526:	f7 f3                	div    %ebx
+ 528:	8d 76 01             	lea    0x1(%esi),%esi
+ 52b:	0f b6 92 50 09 00 00 	movzbl 0x950(%edx),%edx
+ 532:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 536:	89 ca                	mov    %ecx,%edx
+ 538:	89 c1                	mov    %eax,%ecx
+ 53a:	39 da                	cmp    %ebx,%edx
+ 53c:	73 e2                	jae    520 <printint+0x30>
+  if(neg)
+ 53e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 541:	85 c0                	test   %eax,%eax
+ 543:	74 07                	je     54c <printint+0x5c>
+    buf[i++] = '-';
+ 545:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 54a:	89 f7                	mov    %esi,%edi
+ 54c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 54f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 552:	01 df                	add    %ebx,%edi
+ 554:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 558:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 55b:	83 ec 04             	sub    $0x4,%esp
+ 55e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 561:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 564:	6a 01                	push   $0x1
+ 566:	50                   	push   %eax
+ 567:	56                   	push   %esi
+ 568:	e8 77 fe ff ff       	call   3e4 <write>
+  while(--i >= 0)
+ 56d:	89 f8                	mov    %edi,%eax
+ 56f:	83 c4 10             	add    $0x10,%esp
+ 572:	83 ef 01             	sub    $0x1,%edi
+ 575:	39 d8                	cmp    %ebx,%eax
+ 577:	75 df                	jne    558 <printint+0x68>
+}
+ 579:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 57c:	5b                   	pop    %ebx
+ 57d:	5e                   	pop    %esi
+ 57e:	5f                   	pop    %edi
+ 57f:	5d                   	pop    %ebp
+ 580:	c3                   	ret
+ 581:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 588:	31 c0                	xor    %eax,%eax
+ 58a:	eb 89                	jmp    515 <printint+0x25>
+ 58c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000590 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+ 593:	57                   	push   %edi
+ 594:	56                   	push   %esi
+ 595:	53                   	push   %ebx
+ 596:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 599:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 59c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 59f:	0f b6 1e             	movzbl (%esi),%ebx
+ 5a2:	83 c6 01             	add    $0x1,%esi
+ 5a5:	84 db                	test   %bl,%bl
+ 5a7:	74 67                	je     610 <printf+0x80>
+ 5a9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 5ac:	31 d2                	xor    %edx,%edx
+ 5ae:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 5b1:	eb 34                	jmp    5e7 <printf+0x57>
+ 5b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5b7:	90                   	nop
+ 5b8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 5bb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 5c0:	83 f8 25             	cmp    $0x25,%eax
+ 5c3:	74 18                	je     5dd <printf+0x4d>
+  write(fd, &c, 1);
+ 5c5:	83 ec 04             	sub    $0x4,%esp
+ 5c8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5cb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5ce:	6a 01                	push   $0x1
+ 5d0:	50                   	push   %eax
+ 5d1:	57                   	push   %edi
+ 5d2:	e8 0d fe ff ff       	call   3e4 <write>
+ 5d7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 5da:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 5dd:	0f b6 1e             	movzbl (%esi),%ebx
+ 5e0:	83 c6 01             	add    $0x1,%esi
+ 5e3:	84 db                	test   %bl,%bl
+ 5e5:	74 29                	je     610 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 5e7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 5ea:	85 d2                	test   %edx,%edx
+ 5ec:	74 ca                	je     5b8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 5ee:	83 fa 25             	cmp    $0x25,%edx
+ 5f1:	75 ea                	jne    5dd <printf+0x4d>
+      if(c == 'd'){
+ 5f3:	83 f8 25             	cmp    $0x25,%eax
+ 5f6:	0f 84 24 01 00 00    	je     720 <printf+0x190>
+ 5fc:	83 e8 63             	sub    $0x63,%eax
+ 5ff:	83 f8 15             	cmp    $0x15,%eax
+ 602:	77 1c                	ja     620 <printf+0x90>
+ 604:	ff 24 85 f8 08 00 00 	jmp    *0x8f8(,%eax,4)
+ 60b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 60f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 610:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 613:	5b                   	pop    %ebx
+ 614:	5e                   	pop    %esi
+ 615:	5f                   	pop    %edi
+ 616:	5d                   	pop    %ebp
+ 617:	c3                   	ret
+ 618:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 61f:	90                   	nop
+  write(fd, &c, 1);
+ 620:	83 ec 04             	sub    $0x4,%esp
+ 623:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 626:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 62a:	6a 01                	push   $0x1
+ 62c:	52                   	push   %edx
+ 62d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 630:	57                   	push   %edi
+ 631:	e8 ae fd ff ff       	call   3e4 <write>
+ 636:	83 c4 0c             	add    $0xc,%esp
+ 639:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 63c:	6a 01                	push   $0x1
+ 63e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 641:	52                   	push   %edx
+ 642:	57                   	push   %edi
+ 643:	e8 9c fd ff ff       	call   3e4 <write>
+        putc(fd, c);
+ 648:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 64b:	31 d2                	xor    %edx,%edx
+ 64d:	eb 8e                	jmp    5dd <printf+0x4d>
+ 64f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 650:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 653:	83 ec 0c             	sub    $0xc,%esp
+ 656:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 65b:	8b 13                	mov    (%ebx),%edx
+ 65d:	6a 00                	push   $0x0
+ 65f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 661:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 664:	e8 87 fe ff ff       	call   4f0 <printint>
+        ap++;
+ 669:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 66c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 66f:	31 d2                	xor    %edx,%edx
+ 671:	e9 67 ff ff ff       	jmp    5dd <printf+0x4d>
+ 676:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 67d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 680:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 683:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 685:	83 c0 04             	add    $0x4,%eax
+ 688:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 68b:	85 db                	test   %ebx,%ebx
+ 68d:	0f 84 9d 00 00 00    	je     730 <printf+0x1a0>
+        while(*s != 0){
+ 693:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 696:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 698:	84 c0                	test   %al,%al
+ 69a:	0f 84 3d ff ff ff    	je     5dd <printf+0x4d>
+ 6a0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6a3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 6a6:	89 de                	mov    %ebx,%esi
+ 6a8:	89 d3                	mov    %edx,%ebx
+ 6aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 6b0:	83 ec 04             	sub    $0x4,%esp
+ 6b3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 6b6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 6b9:	6a 01                	push   $0x1
+ 6bb:	53                   	push   %ebx
+ 6bc:	57                   	push   %edi
+ 6bd:	e8 22 fd ff ff       	call   3e4 <write>
+        while(*s != 0){
+ 6c2:	0f b6 06             	movzbl (%esi),%eax
+ 6c5:	83 c4 10             	add    $0x10,%esp
+ 6c8:	84 c0                	test   %al,%al
+ 6ca:	75 e4                	jne    6b0 <printf+0x120>
+      state = 0;
+ 6cc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 6cf:	31 d2                	xor    %edx,%edx
+ 6d1:	e9 07 ff ff ff       	jmp    5dd <printf+0x4d>
+ 6d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6dd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 6e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6e3:	83 ec 0c             	sub    $0xc,%esp
+ 6e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 6eb:	8b 13                	mov    (%ebx),%edx
+ 6ed:	6a 01                	push   $0x1
+ 6ef:	e9 6b ff ff ff       	jmp    65f <printf+0xcf>
+ 6f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 6f8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 6fb:	83 ec 04             	sub    $0x4,%esp
+ 6fe:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 701:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 703:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 706:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 709:	6a 01                	push   $0x1
+ 70b:	52                   	push   %edx
+ 70c:	57                   	push   %edi
+ 70d:	e8 d2 fc ff ff       	call   3e4 <write>
+        ap++;
+ 712:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 715:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 718:	31 d2                	xor    %edx,%edx
+ 71a:	e9 be fe ff ff       	jmp    5dd <printf+0x4d>
+ 71f:	90                   	nop
+  write(fd, &c, 1);
+ 720:	83 ec 04             	sub    $0x4,%esp
+ 723:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 726:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 729:	6a 01                	push   $0x1
+ 72b:	e9 11 ff ff ff       	jmp    641 <printf+0xb1>
+ 730:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 735:	bb ef 08 00 00       	mov    $0x8ef,%ebx
+ 73a:	e9 61 ff ff ff       	jmp    6a0 <printf+0x110>
+ 73f:	90                   	nop
+
+00000740 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 740:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 741:	a1 40 0e 00 00       	mov    0xe40,%eax
+{
+ 746:	89 e5                	mov    %esp,%ebp
+ 748:	57                   	push   %edi
+ 749:	56                   	push   %esi
+ 74a:	53                   	push   %ebx
+ 74b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 74e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 751:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 758:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 75a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 75c:	39 ca                	cmp    %ecx,%edx
+ 75e:	73 30                	jae    790 <free+0x50>
+ 760:	39 c1                	cmp    %eax,%ecx
+ 762:	72 04                	jb     768 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 764:	39 c2                	cmp    %eax,%edx
+ 766:	72 f0                	jb     758 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 768:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 76b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 76e:	39 f8                	cmp    %edi,%eax
+ 770:	74 2e                	je     7a0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 772:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 775:	8b 42 04             	mov    0x4(%edx),%eax
+ 778:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 77b:	39 f1                	cmp    %esi,%ecx
+ 77d:	74 38                	je     7b7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 77f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 781:	5b                   	pop    %ebx
+  freep = p;
+ 782:	89 15 40 0e 00 00    	mov    %edx,0xe40
+}
+ 788:	5e                   	pop    %esi
+ 789:	5f                   	pop    %edi
+ 78a:	5d                   	pop    %ebp
+ 78b:	c3                   	ret
+ 78c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 790:	39 c1                	cmp    %eax,%ecx
+ 792:	72 d0                	jb     764 <free+0x24>
+ 794:	eb c2                	jmp    758 <free+0x18>
+ 796:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 79d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 7a0:	03 70 04             	add    0x4(%eax),%esi
+ 7a3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7a6:	8b 02                	mov    (%edx),%eax
+ 7a8:	8b 00                	mov    (%eax),%eax
+ 7aa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 7ad:	8b 42 04             	mov    0x4(%edx),%eax
+ 7b0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7b3:	39 f1                	cmp    %esi,%ecx
+ 7b5:	75 c8                	jne    77f <free+0x3f>
+    p->s.size += bp->s.size;
+ 7b7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 7ba:	89 15 40 0e 00 00    	mov    %edx,0xe40
+    p->s.size += bp->s.size;
+ 7c0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 7c3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 7c6:	89 0a                	mov    %ecx,(%edx)
+}
+ 7c8:	5b                   	pop    %ebx
+ 7c9:	5e                   	pop    %esi
+ 7ca:	5f                   	pop    %edi
+ 7cb:	5d                   	pop    %ebp
+ 7cc:	c3                   	ret
+ 7cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007d0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 7d0:	55                   	push   %ebp
+ 7d1:	89 e5                	mov    %esp,%ebp
+ 7d3:	57                   	push   %edi
+ 7d4:	56                   	push   %esi
+ 7d5:	53                   	push   %ebx
+ 7d6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 7dc:	8b 15 40 0e 00 00    	mov    0xe40,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7e2:	8d 78 07             	lea    0x7(%eax),%edi
+ 7e5:	c1 ef 03             	shr    $0x3,%edi
+ 7e8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 7eb:	85 d2                	test   %edx,%edx
+ 7ed:	0f 84 8d 00 00 00    	je     880 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7f3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 7f5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 7f8:	39 f9                	cmp    %edi,%ecx
+ 7fa:	73 64                	jae    860 <malloc+0x90>
+  if(nu < 4096)
+ 7fc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 801:	39 df                	cmp    %ebx,%edi
+ 803:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 806:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 80d:	eb 0a                	jmp    819 <malloc+0x49>
+ 80f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 810:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 812:	8b 48 04             	mov    0x4(%eax),%ecx
+ 815:	39 f9                	cmp    %edi,%ecx
+ 817:	73 47                	jae    860 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 819:	89 c2                	mov    %eax,%edx
+ 81b:	39 05 40 0e 00 00    	cmp    %eax,0xe40
+ 821:	75 ed                	jne    810 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 823:	83 ec 0c             	sub    $0xc,%esp
+ 826:	56                   	push   %esi
+ 827:	e8 20 fc ff ff       	call   44c <sbrk>
+  if(p == (char*)-1)
+ 82c:	83 c4 10             	add    $0x10,%esp
+ 82f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 832:	74 1c                	je     850 <malloc+0x80>
+  hp->s.size = nu;
+ 834:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 837:	83 ec 0c             	sub    $0xc,%esp
+ 83a:	83 c0 08             	add    $0x8,%eax
+ 83d:	50                   	push   %eax
+ 83e:	e8 fd fe ff ff       	call   740 <free>
+  return freep;
+ 843:	8b 15 40 0e 00 00    	mov    0xe40,%edx
+      if((p = morecore(nunits)) == 0)
+ 849:	83 c4 10             	add    $0x10,%esp
+ 84c:	85 d2                	test   %edx,%edx
+ 84e:	75 c0                	jne    810 <malloc+0x40>
+        return 0;
+  }
+}
+ 850:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 853:	31 c0                	xor    %eax,%eax
+}
+ 855:	5b                   	pop    %ebx
+ 856:	5e                   	pop    %esi
+ 857:	5f                   	pop    %edi
+ 858:	5d                   	pop    %ebp
+ 859:	c3                   	ret
+ 85a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 860:	39 cf                	cmp    %ecx,%edi
+ 862:	74 4c                	je     8b0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 864:	29 f9                	sub    %edi,%ecx
+ 866:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 869:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 86c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 86f:	89 15 40 0e 00 00    	mov    %edx,0xe40
+}
+ 875:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 878:	83 c0 08             	add    $0x8,%eax
+}
+ 87b:	5b                   	pop    %ebx
+ 87c:	5e                   	pop    %esi
+ 87d:	5f                   	pop    %edi
+ 87e:	5d                   	pop    %ebp
+ 87f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 880:	c7 05 40 0e 00 00 44 	movl   $0xe44,0xe40
+ 887:	0e 00 00 
+    base.s.size = 0;
+ 88a:	b8 44 0e 00 00       	mov    $0xe44,%eax
+    base.s.ptr = freep = prevp = &base;
+ 88f:	c7 05 44 0e 00 00 44 	movl   $0xe44,0xe44
+ 896:	0e 00 00 
+    base.s.size = 0;
+ 899:	c7 05 48 0e 00 00 00 	movl   $0x0,0xe48
+ 8a0:	00 00 00 
+    if(p->s.size >= nunits){
+ 8a3:	e9 54 ff ff ff       	jmp    7fc <malloc+0x2c>
+ 8a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8af:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 8b0:	8b 08                	mov    (%eax),%ecx
+ 8b2:	89 0a                	mov    %ecx,(%edx)
+ 8b4:	eb b9                	jmp    86f <malloc+0x9f>
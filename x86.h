@@ -9,6 +9,15 @@ inb(ushort port)
   return data;
 }
 
+static inline ushort
+inw(ushort port)
+{
+  ushort data;
+
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+  return data;
+}
+
 static inline uint32_t
 inl(int port) {
     uint32_t data;
@@ -129,6 +138,15 @@ sti(void)
   asm volatile("sti");
 }
 
+// Enable interrupts and wait for one.  sti takes effect only
+// after the next instruction, so an interrupt that arrives
+// between the two still wakes the hlt.
+static inline void
+stihlt(void)
+{
+  asm volatile("sti; hlt");
+}
+
 static inline uint
 xchg(volatile uint *addr, uint newval)
 {
@@ -156,6 +174,38 @@ lcr3(uint val)
   asm volatile("movl %0,%%cr3" : : "r" (val));
 }
 
+static inline uint
+rcr3(void)
+{
+  uint val;
+  asm volatile("movl %%cr3,%0" : "=r" (val));
+  return val;
+}
+
+static inline uint64_t
+rdtsc(void)
+{
+  uint64_t t;
+  asm volatile("rdtsc" : "=A" (t));
+  return t;
+}
+
+// Tell the CPU this is a spin-wait loop.
+static inline void
+pause(void)
+{
+  asm volatile("pause");
+}
+
+// Divide n by d; the quotient must fit in 32 bits.
+static inline uint
+divl(uint64_t n, uint d)
+{
+  uint q, r;
+  asm("divl %4" : "=a" (q), "=d" (r) : "a" ((uint)n), "d" ((uint)(n>>32)), "rm" (d));
+  return q;
+}
+
 //PAGEBREAK: 36
 // Layout of the trap frame built on the stack by the
 // hardware and by trapasm.S, and passed to trap().
@@ -0,0 +1,1200 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+  11:	e8 56 02 00 00       	call   26c <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7e 0d                	jle    27 <main+0x27>
+    sleep(5);  // Let child exit before parent.
+  1a:	83 ec 0c             	sub    $0xc,%esp
+  1d:	6a 05                	push   $0x5
+  1f:	e8 e0 02 00 00       	call   304 <sleep>
+  24:	83 c4 10             	add    $0x10,%esp
+  exit();
+  27:	e8 48 02 00 00       	call   274 <exit>
+  2c:	66 90                	xchg   %ax,%ax
+  2e:	66 90                	xchg   %ax,%ax
+
+00000030 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  30:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  31:	31 c0                	xor    %eax,%eax
+{
+  33:	89 e5                	mov    %esp,%ebp
+  35:	53                   	push   %ebx
+  36:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  39:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  40:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  44:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  47:	83 c0 01             	add    $0x1,%eax
+  4a:	84 d2                	test   %dl,%dl
+  4c:	75 f2                	jne    40 <strcpy+0x10>
+    ;
+  return os;
+}
+  4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  51:	89 c8                	mov    %ecx,%eax
+  53:	c9                   	leave
+  54:	c3                   	ret
+  55:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000060 <strlen>:
+
+uint
+strlen(char *s)
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  66:	80 3a 00             	cmpb   $0x0,(%edx)
+  69:	74 15                	je     80 <strlen+0x20>
+  6b:	31 c0                	xor    %eax,%eax
+  6d:	8d 76 00             	lea    0x0(%esi),%esi
+  70:	83 c0 01             	add    $0x1,%eax
+  73:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  77:	89 c1                	mov    %eax,%ecx
+  79:	75 f5                	jne    70 <strlen+0x10>
+    ;
+  return n;
+}
+  7b:	89 c8                	mov    %ecx,%eax
+  7d:	5d                   	pop    %ebp
+  7e:	c3                   	ret
+  7f:	90                   	nop
+  for(n = 0; s[n]; n++)
+  80:	31 c9                	xor    %ecx,%ecx
+}
+  82:	5d                   	pop    %ebp
+  83:	89 c8                	mov    %ecx,%eax
+  85:	c3                   	ret
+  86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000090 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	57                   	push   %edi
+  94:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  97:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  9a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  9d:	89 d7                	mov    %edx,%edi
+  9f:	fc                   	cld
+  a0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  a5:	89 d0                	mov    %edx,%eax
+  a7:	c9                   	leave
+  a8:	c3                   	ret
+  a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000000b0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  b0:	55                   	push   %ebp
+  b1:	89 e5                	mov    %esp,%ebp
+  b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+  ba:	0f b6 10             	movzbl (%eax),%edx
+  bd:	84 d2                	test   %dl,%dl
+  bf:	75 12                	jne    d3 <strchr+0x23>
+  c1:	eb 1d                	jmp    e0 <strchr+0x30>
+  c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  c7:	90                   	nop
+  c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+  cc:	83 c0 01             	add    $0x1,%eax
+  cf:	84 d2                	test   %dl,%dl
+  d1:	74 0d                	je     e0 <strchr+0x30>
+    if(*s == c)
+  d3:	38 d1                	cmp    %dl,%cl
+  d5:	75 f1                	jne    c8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+  d7:	5d                   	pop    %ebp
+  d8:	c3                   	ret
+  d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+  e0:	31 c0                	xor    %eax,%eax
+}
+  e2:	5d                   	pop    %ebp
+  e3:	c3                   	ret
+  e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ef:	90                   	nop
+
+000000f0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	57                   	push   %edi
+  f4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+  f5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+  f8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+  f9:	31 db                	xor    %ebx,%ebx
+{
+  fb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+  fe:	eb 27                	jmp    127 <gets+0x37>
+    cc = read(0, &c, 1);
+ 100:	83 ec 04             	sub    $0x4,%esp
+ 103:	6a 01                	push   $0x1
+ 105:	56                   	push   %esi
+ 106:	6a 00                	push   $0x0
+ 108:	e8 7f 01 00 00       	call   28c <read>
+    if(cc < 1)
+ 10d:	83 c4 10             	add    $0x10,%esp
+ 110:	85 c0                	test   %eax,%eax
+ 112:	7e 1d                	jle    131 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 114:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 118:	8b 55 08             	mov    0x8(%ebp),%edx
+ 11b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 11f:	3c 0a                	cmp    $0xa,%al
+ 121:	74 10                	je     133 <gets+0x43>
+ 123:	3c 0d                	cmp    $0xd,%al
+ 125:	74 0c                	je     133 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 127:	89 df                	mov    %ebx,%edi
+ 129:	83 c3 01             	add    $0x1,%ebx
+ 12c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 12f:	7c cf                	jl     100 <gets+0x10>
+ 131:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 133:	8b 45 08             	mov    0x8(%ebp),%eax
+ 136:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 13a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 13d:	5b                   	pop    %ebx
+ 13e:	5e                   	pop    %esi
+ 13f:	5f                   	pop    %edi
+ 140:	5d                   	pop    %ebp
+ 141:	c3                   	ret
+ 142:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	56                   	push   %esi
+ 154:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 155:	83 ec 08             	sub    $0x8,%esp
+ 158:	6a 00                	push   $0x0
+ 15a:	ff 75 08             	push   0x8(%ebp)
+ 15d:	e8 52 01 00 00       	call   2b4 <open>
+  if(fd < 0)
+ 162:	83 c4 10             	add    $0x10,%esp
+ 165:	85 c0                	test   %eax,%eax
+ 167:	78 27                	js     190 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 169:	83 ec 08             	sub    $0x8,%esp
+ 16c:	ff 75 0c             	push   0xc(%ebp)
+ 16f:	89 c3                	mov    %eax,%ebx
+ 171:	50                   	push   %eax
+ 172:	e8 55 01 00 00       	call   2cc <fstat>
+  close(fd);
+ 177:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 17a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 17c:	e8 1b 01 00 00       	call   29c <close>
+  return r;
+ 181:	83 c4 10             	add    $0x10,%esp
+}
+ 184:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 187:	89 f0                	mov    %esi,%eax
+ 189:	5b                   	pop    %ebx
+ 18a:	5e                   	pop    %esi
+ 18b:	5d                   	pop    %ebp
+ 18c:	c3                   	ret
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 190:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 195:	eb ed                	jmp    184 <stat+0x34>
+ 197:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19e:	66 90                	xchg   %ax,%ax
+
+000001a0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	57                   	push   %edi
+ 1a4:	56                   	push   %esi
+ 1a5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 1ae:	85 c0                	test   %eax,%eax
+ 1b0:	7e 13                	jle    1c5 <memmove+0x25>
+ 1b2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 1b4:	89 d7                	mov    %edx,%edi
+ 1b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1bd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 1c0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 1c1:	39 f8                	cmp    %edi,%eax
+ 1c3:	75 fb                	jne    1c0 <memmove+0x20>
+  return vdst;
+}
+ 1c5:	5e                   	pop    %esi
+ 1c6:	89 d0                	mov    %edx,%eax
+ 1c8:	5f                   	pop    %edi
+ 1c9:	5d                   	pop    %ebp
+ 1ca:	c3                   	ret
+ 1cb:	66 90                	xchg   %ax,%ax
+ 1cd:	66 90                	xchg   %ax,%ax
+ 1cf:	90                   	nop
+
+000001d0 <strcmp>:
+#include "types.h"
+#include "util.h"
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	53                   	push   %ebx
+ 1d4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1da:	0f b6 02             	movzbl (%edx),%eax
+ 1dd:	84 c0                	test   %al,%al
+ 1df:	75 17                	jne    1f8 <strcmp+0x28>
+ 1e1:	eb 3a                	jmp    21d <strcmp+0x4d>
+ 1e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1e7:	90                   	nop
+ 1e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 1ec:	83 c2 01             	add    $0x1,%edx
+ 1ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1f2:	84 c0                	test   %al,%al
+ 1f4:	74 1a                	je     210 <strcmp+0x40>
+    p++, q++;
+ 1f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1f8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1fb:	38 c3                	cmp    %al,%bl
+ 1fd:	74 e9                	je     1e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1ff:	29 d8                	sub    %ebx,%eax
+}
+ 201:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 204:	c9                   	leave
+ 205:	c3                   	ret
+ 206:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 210:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 214:	31 c0                	xor    %eax,%eax
+ 216:	29 d8                	sub    %ebx,%eax
+}
+ 218:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 21b:	c9                   	leave
+ 21c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 21d:	0f b6 19             	movzbl (%ecx),%ebx
+ 220:	31 c0                	xor    %eax,%eax
+ 222:	eb db                	jmp    1ff <strcmp+0x2f>
+ 224:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 22f:	90                   	nop
+
+00000230 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	53                   	push   %ebx
+ 234:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 237:	0f be 02             	movsbl (%edx),%eax
+ 23a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 23d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 240:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 245:	77 1e                	ja     265 <atoi+0x35>
+ 247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 250:	83 c2 01             	add    $0x1,%edx
+ 253:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 256:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 25a:	0f be 02             	movsbl (%edx),%eax
+ 25d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 260:	80 fb 09             	cmp    $0x9,%bl
+ 263:	76 eb                	jbe    250 <atoi+0x20>
+  return n;
+ 265:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 268:	89 c8                	mov    %ecx,%eax
+ 26a:	c9                   	leave
+ 26b:	c3                   	ret
+
+0000026c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 26c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 271:	cd 40                	int    $0x40
+ 273:	c3                   	ret
+
+00000274 <exit>:
+SYSCALL(exit)
+ 274:	b8 02 00 00 00       	mov    $0x2,%eax
+ 279:	cd 40                	int    $0x40
+ 27b:	c3                   	ret
+
+0000027c <wait>:
+SYSCALL(wait)
+ 27c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 281:	cd 40                	int    $0x40
+ 283:	c3                   	ret
+
+00000284 <pipe>:
+SYSCALL(pipe)
+ 284:	b8 04 00 00 00       	mov    $0x4,%eax
+ 289:	cd 40                	int    $0x40
+ 28b:	c3                   	ret
+
+0000028c <read>:
+SYSCALL(read)
+ 28c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 291:	cd 40                	int    $0x40
+ 293:	c3                   	ret
+
+00000294 <write>:
+SYSCALL(write)
+ 294:	b8 10 00 00 00       	mov    $0x10,%eax
+ 299:	cd 40                	int    $0x40
+ 29b:	c3                   	ret
+
+0000029c <close>:
+SYSCALL(close)
+ 29c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2a1:	cd 40                	int    $0x40
+ 2a3:	c3                   	ret
+
+000002a4 <kill>:
+SYSCALL(kill)
+ 2a4:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2a9:	cd 40                	int    $0x40
+ 2ab:	c3                   	ret
+
+000002ac <exec>:
+SYSCALL(exec)
+ 2ac:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2b1:	cd 40                	int    $0x40
+ 2b3:	c3                   	ret
+
+000002b4 <open>:
+SYSCALL(open)
+ 2b4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2b9:	cd 40                	int    $0x40
+ 2bb:	c3                   	ret
+
+000002bc <mknod>:
+SYSCALL(mknod)
+ 2bc:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2c1:	cd 40                	int    $0x40
+ 2c3:	c3                   	ret
+
+000002c4 <unlink>:
+SYSCALL(unlink)
+ 2c4:	b8 12 00 00 00       	mov    $0x12,%eax
+ 2c9:	cd 40                	int    $0x40
+ 2cb:	c3                   	ret
+
+000002cc <fstat>:
+SYSCALL(fstat)
+ 2cc:	b8 08 00 00 00       	mov    $0x8,%eax
+ 2d1:	cd 40                	int    $0x40
+ 2d3:	c3                   	ret
+
+000002d4 <link>:
+SYSCALL(link)
+ 2d4:	b8 13 00 00 00       	mov    $0x13,%eax
+ 2d9:	cd 40                	int    $0x40
+ 2db:	c3                   	ret
+
+000002dc <mkdir>:
+SYSCALL(mkdir)
+ 2dc:	b8 14 00 00 00       	mov    $0x14,%eax
+ 2e1:	cd 40                	int    $0x40
+ 2e3:	c3                   	ret
+
+000002e4 <chdir>:
+SYSCALL(chdir)
+ 2e4:	b8 09 00 00 00       	mov    $0x9,%eax
+ 2e9:	cd 40                	int    $0x40
+ 2eb:	c3                   	ret
+
+000002ec <dup>:
+SYSCALL(dup)
+ 2ec:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 2f1:	cd 40                	int    $0x40
+ 2f3:	c3                   	ret
+
+000002f4 <getpid>:
+SYSCALL(getpid)
+ 2f4:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 2f9:	cd 40                	int    $0x40
+ 2fb:	c3                   	ret
+
+000002fc <sbrk>:
+SYSCALL(sbrk)
+ 2fc:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 301:	cd 40                	int    $0x40
+ 303:	c3                   	ret
+
+00000304 <sleep>:
+SYSCALL(sleep)
+ 304:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 309:	cd 40                	int    $0x40
+ 30b:	c3                   	ret
+
+0000030c <uptime>:
+SYSCALL(uptime)
+ 30c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 311:	cd 40                	int    $0x40
+ 313:	c3                   	ret
+
+00000314 <arp>:
+SYSCALL(arp)
+ 314:	b8 16 00 00 00       	mov    $0x16,%eax
+ 319:	cd 40                	int    $0x40
+ 31b:	c3                   	ret
+
+0000031c <mmap>:
+SYSCALL(mmap)
+ 31c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 321:	cd 40                	int    $0x40
+ 323:	c3                   	ret
+
+00000324 <munmap>:
+SYSCALL(munmap)
+ 324:	b8 18 00 00 00       	mov    $0x18,%eax
+ 329:	cd 40                	int    $0x40
+ 32b:	c3                   	ret
+
+0000032c <msync>:
+SYSCALL(msync)
+ 32c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 331:	cd 40                	int    $0x40
+ 333:	c3                   	ret
+
+00000334 <shmcreate>:
+SYSCALL(shmcreate)
+ 334:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 339:	cd 40                	int    $0x40
+ 33b:	c3                   	ret
+
+0000033c <shmattach>:
+SYSCALL(shmattach)
+ 33c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 341:	cd 40                	int    $0x40
+ 343:	c3                   	ret
+
+00000344 <shmdetach>:
+SYSCALL(shmdetach)
+ 344:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 349:	cd 40                	int    $0x40
+ 34b:	c3                   	ret
+
+0000034c <futex_wait>:
+SYSCALL(futex_wait)
+ 34c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 351:	cd 40                	int    $0x40
+ 353:	c3                   	ret
+
+00000354 <futex_wake>:
+SYSCALL(futex_wake)
+ 354:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 359:	cd 40                	int    $0x40
+ 35b:	c3                   	ret
+
+0000035c <nice>:
+SYSCALL(nice)
+ 35c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 361:	cd 40                	int    $0x40
+ 363:	c3                   	ret
+
+00000364 <setpriority>:
+SYSCALL(setpriority)
+ 364:	b8 20 00 00 00       	mov    $0x20,%eax
+ 369:	cd 40                	int    $0x40
+ 36b:	c3                   	ret
+
+0000036c <cputime>:
+SYSCALL(cputime)
+ 36c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 371:	cd 40                	int    $0x40
+ 373:	c3                   	ret
+
+00000374 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 374:	b8 22 00 00 00       	mov    $0x22,%eax
+ 379:	cd 40                	int    $0x40
+ 37b:	c3                   	ret
+
+0000037c <clone>:
+SYSCALL(clone)
+ 37c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 381:	cd 40                	int    $0x40
+ 383:	c3                   	ret
+
+00000384 <join>:
+SYSCALL(join)
+ 384:	b8 24 00 00 00       	mov    $0x24,%eax
+ 389:	cd 40                	int    $0x40
+ 38b:	c3                   	ret
+
+0000038c <lockstat>:
+SYSCALL(lockstat)
+ 38c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 391:	cd 40                	int    $0x40
+ 393:	c3                   	ret
+ 394:	66 90                	xchg   %ax,%ax
+ 396:	66 90                	xchg   %ax,%ax
+ 398:	66 90                	xchg   %ax,%ax
+ 39a:	66 90                	xchg   %ax,%ax
+ 39c:	66 90                	xchg   %ax,%ax
+ 39e:	66 90                	xchg   %ax,%ax
+
+000003a0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	57                   	push   %edi
+ 3a4:	56                   	push   %esi
+ 3a5:	53                   	push   %ebx
+ 3a6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 3a8:	89 d1                	mov    %edx,%ecx
+{
+ 3aa:	83 ec 3c             	sub    $0x3c,%esp
+ 3ad:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 3b0:	85 d2                	test   %edx,%edx
+ 3b2:	0f 89 80 00 00 00    	jns    438 <printint+0x98>
+ 3b8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 3bc:	74 7a                	je     438 <printint+0x98>
+    x = -xx;
+ 3be:	f7 d9                	neg    %ecx
+    neg = 1;
+ 3c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 3c5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 3c8:	31 f6                	xor    %esi,%esi
+ 3ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 3d0:	89 c8                	mov    %ecx,%eax
+ 3d2:	31 d2                	xor    %edx,%edx
+ 3d4:	89 f7                	mov    %esi,%edi
+ 3d6:	f7 f3                	div    %ebx
+ 3d8:	8d 76 01             	lea    0x1(%esi),%esi
+ 3db:	0f b6 92 c8 07 00 00 	movzbl 0x7c8(%edx),%edx
+ 3e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 3e6:	89 ca                	mov    %ecx,%edx
+ 3e8:	89 c1                	mov    %eax,%ecx
+ 3ea:	39 da                	cmp    %ebx,%edx
+ 3ec:	73 e2                	jae    3d0 <printint+0x30>
+  if(neg)
+ 3ee:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 3f1:	85 c0                	test   %eax,%eax
+ 3f3:	74 07                	je     3fc <printint+0x5c>
+    buf[i++] = '-';
+ 3f5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 3fa:	89 f7                	mov    %esi,%edi
+ 3fc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 3ff:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 402:	01 df                	add    %ebx,%edi
+ 404:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 408:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 40b:	83 ec 04             	sub    $0x4,%esp
+ 40e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 411:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 414:	6a 01                	push   $0x1
+ 416:	50                   	push   %eax
+ 417:	56                   	push   %esi
+ 418:	e8 77 fe ff ff       	call   294 <write>
+  while(--i >= 0)
+ 41d:	89 f8                	mov    %edi,%eax
+ 41f:	83 c4 10             	add    $0x10,%esp
+ 422:	83 ef 01             	sub    $0x1,%edi
+ 425:	39 d8                	cmp    %ebx,%eax
+ 427:	75 df                	jne    408 <printint+0x68>
+}
+ 429:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 42c:	5b                   	pop    %ebx
+ 42d:	5e                   	pop    %esi
+ 42e:	5f                   	pop    %edi
+ 42f:	5d                   	pop    %ebp
+ 430:	c3                   	ret
+ 431:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 438:	31 c0                	xor    %eax,%eax
+ 43a:	eb 89                	jmp    3c5 <printint+0x25>
+ 43c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000440 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	57                   	push   %edi
+ 444:	56                   	push   %esi
+ 445:	53                   	push   %ebx
+ 446:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 449:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 44c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 44f:	0f b6 1e             	movzbl (%esi),%ebx
+ 452:	83 c6 01             	add    $0x1,%esi
+ 455:	84 db                	test   %bl,%bl
+ 457:	74 67                	je     4c0 <printf+0x80>
+ 459:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 45c:	31 d2                	xor    %edx,%edx
+ 45e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 461:	eb 34                	jmp    497 <printf+0x57>
+ 463:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 467:	90                   	nop
+ 468:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 46b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 470:	83 f8 25             	cmp    $0x25,%eax
+ 473:	74 18                	je     48d <printf+0x4d>
+  write(fd, &c, 1);
+ 475:	83 ec 04             	sub    $0x4,%esp
+ 478:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 47b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 47e:	6a 01                	push   $0x1
+ 480:	50                   	push   %eax
+ 481:	57                   	push   %edi
+ 482:	e8 0d fe ff ff       	call   294 <write>
+ 487:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 48a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 48d:	0f b6 1e             	movzbl (%esi),%ebx
+ 490:	83 c6 01             	add    $0x1,%esi
+ 493:	84 db                	test   %bl,%bl
+ 495:	74 29                	je     4c0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 497:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 49a:	85 d2                	test   %edx,%edx
+ 49c:	74 ca                	je     468 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 49e:	83 fa 25             	cmp    $0x25,%edx
+ 4a1:	75 ea                	jne    48d <printf+0x4d>
+      if(c == 'd'){
+ 4a3:	83 f8 25             	cmp    $0x25,%eax
+ 4a6:	0f 84 24 01 00 00    	je     5d0 <printf+0x190>
+ 4ac:	83 e8 63             	sub    $0x63,%eax
+ 4af:	83 f8 15             	cmp    $0x15,%eax
+ 4b2:	77 1c                	ja     4d0 <printf+0x90>
+ 4b4:	ff 24 85 70 07 00 00 	jmp    *0x770(,%eax,4)
+ 4bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4bf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 4c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4c3:	5b                   	pop    %ebx
+ 4c4:	5e                   	pop    %esi
+ 4c5:	5f                   	pop    %edi
+ 4c6:	5d                   	pop    %ebp
+ 4c7:	c3                   	ret
+ 4c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4cf:	90                   	nop
+  write(fd, &c, 1);
+ 4d0:	83 ec 04             	sub    $0x4,%esp
+ 4d3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 4d6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 4da:	6a 01                	push   $0x1
+ 4dc:	52                   	push   %edx
+ 4dd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 4e0:	57                   	push   %edi
+ 4e1:	e8 ae fd ff ff       	call   294 <write>
+ 4e6:	83 c4 0c             	add    $0xc,%esp
+ 4e9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 4ec:	6a 01                	push   $0x1
+ 4ee:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 4f1:	52                   	push   %edx
+ 4f2:	57                   	push   %edi
+ 4f3:	e8 9c fd ff ff       	call   294 <write>
+        putc(fd, c);
+ 4f8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 4fb:	31 d2                	xor    %edx,%edx
+ 4fd:	eb 8e                	jmp    48d <printf+0x4d>
+ 4ff:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 500:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 503:	83 ec 0c             	sub    $0xc,%esp
+ 506:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 50b:	8b 13                	mov    (%ebx),%edx
+ 50d:	6a 00                	push   $0x0
+ 50f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 511:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 514:	e8 87 fe ff ff       	call   3a0 <printint>
+        ap++;
+ 519:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 51c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 51f:	31 d2                	xor    %edx,%edx
+ 521:	e9 67 ff ff ff       	jmp    48d <printf+0x4d>
+ 526:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 530:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 533:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 535:	83 c0 04             	add    $0x4,%eax
+ 538:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 53b:	85 db                	test   %ebx,%ebx
+ 53d:	0f 84 9d 00 00 00    	je     5e0 <printf+0x1a0>
+        while(*s != 0){
+ 543:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 546:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 548:	84 c0                	test   %al,%al
+ 54a:	0f 84 3d ff ff ff    	je     48d <printf+0x4d>
+ 550:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 553:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 556:	89 de                	mov    %ebx,%esi
+ 558:	89 d3                	mov    %edx,%ebx
+ 55a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 560:	83 ec 04             	sub    $0x4,%esp
+ 563:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 566:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 569:	6a 01                	push   $0x1
+ 56b:	53                   	push   %ebx
+ 56c:	57                   	push   %edi
+ 56d:	e8 22 fd ff ff       	call   294 <write>
+        while(*s != 0){
+ 572:	0f b6 06             	movzbl (%esi),%eax
+ 575:	83 c4 10             	add    $0x10,%esp
+ 578:	84 c0                	test   %al,%al
+ 57a:	75 e4                	jne    560 <printf+0x120>
+      state = 0;
+ 57c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 57f:	31 d2                	xor    %edx,%edx
+ 581:	e9 07 ff ff ff       	jmp    48d <printf+0x4d>
+ 586:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 590:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 593:	83 ec 0c             	sub    $0xc,%esp
+ 596:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 59b:	8b 13                	mov    (%ebx),%edx
+ 59d:	6a 01                	push   $0x1
+ 59f:	e9 6b ff ff ff       	jmp    50f <printf+0xcf>
+ 5a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 5a8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 5ab:	83 ec 04             	sub    $0x4,%esp
+ 5ae:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 5b1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 5b3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 5b6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5b9:	6a 01                	push   $0x1
+ 5bb:	52                   	push   %edx
+ 5bc:	57                   	push   %edi
+ 5bd:	e8 d2 fc ff ff       	call   294 <write>
+        ap++;
+ 5c2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 5c5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5c8:	31 d2                	xor    %edx,%edx
+ 5ca:	e9 be fe ff ff       	jmp    48d <printf+0x4d>
+ 5cf:	90                   	nop
+  write(fd, &c, 1);
+ 5d0:	83 ec 04             	sub    $0x4,%esp
+ 5d3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5d6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5d9:	6a 01                	push   $0x1
+ 5db:	e9 11 ff ff ff       	jmp    4f1 <printf+0xb1>
+ 5e0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 5e5:	bb 68 07 00 00       	mov    $0x768,%ebx
+ 5ea:	e9 61 ff ff ff       	jmp    550 <printf+0x110>
+ 5ef:	90                   	nop
+
+000005f0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 5f0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 5f1:	a1 64 0a 00 00       	mov    0xa64,%eax
+{
+ 5f6:	89 e5                	mov    %esp,%ebp
+ 5f8:	57                   	push   %edi
+ 5f9:	56                   	push   %esi
+ 5fa:	53                   	push   %ebx
+ 5fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 5fe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 601:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 608:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 60a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 60c:	39 ca                	cmp    %ecx,%edx
+ 60e:	73 30                	jae    640 <free+0x50>
+ 610:	39 c1                	cmp    %eax,%ecx
+ 612:	72 04                	jb     618 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 614:	39 c2                	cmp    %eax,%edx
+ 616:	72 f0                	jb     608 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 618:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 61b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 61e:	39 f8                	cmp    %edi,%eax
+ 620:	74 2e                	je     650 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 622:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 625:	8b 42 04             	mov    0x4(%edx),%eax
+ 628:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 62b:	39 f1                	cmp    %esi,%ecx
+ 62d:	74 38                	je     667 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 62f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 631:	5b                   	pop    %ebx
+  freep = p;
+ 632:	89 15 64 0a 00 00    	mov    %edx,0xa64
+}
+ 638:	5e                   	pop    %esi
+ 639:	5f                   	pop    %edi
+ 63a:	5d                   	pop    %ebp
+ 63b:	c3                   	ret
+ 63c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 640:	39 c1                	cmp    %eax,%ecx
+ 642:	72 d0                	jb     614 <free+0x24>
+ 644:	eb c2                	jmp    608 <free+0x18>
+ 646:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 64d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 650:	03 70 04             	add    0x4(%eax),%esi
+ 653:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 656:	8b 02                	mov    (%edx),%eax
+ 658:	8b 00                	mov    (%eax),%eax
+ 65a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 65d:	8b 42 04             	mov    0x4(%edx),%eax
+ 660:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 663:	39 f1                	cmp    %esi,%ecx
+ 665:	75 c8                	jne    62f <free+0x3f>
+    p->s.size += bp->s.size;
+ 667:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 66a:	89 15 64 0a 00 00    	mov    %edx,0xa64
+    p->s.size += bp->s.size;
+ 670:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 673:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 676:	89 0a                	mov    %ecx,(%edx)
+}
+ 678:	5b                   	pop    %ebx
+ 679:	5e                   	pop    %esi
+ 67a:	5f                   	pop    %edi
+ 67b:	5d                   	pop    %ebp
+ 67c:	c3                   	ret
+ 67d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000680 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 680:	55                   	push   %ebp
+ 681:	89 e5                	mov    %esp,%ebp
+ 683:	57                   	push   %edi
+ 684:	56                   	push   %esi
+ 685:	53                   	push   %ebx
+ 686:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 689:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 68c:	8b 15 64 0a 00 00    	mov    0xa64,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 692:	8d 78 07             	lea    0x7(%eax),%edi
+ 695:	c1 ef 03             	shr    $0x3,%edi
+ 698:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 69b:	85 d2                	test   %edx,%edx
+ 69d:	0f 84 8d 00 00 00    	je     730 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6a3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6a5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6a8:	39 f9                	cmp    %edi,%ecx
+ 6aa:	73 64                	jae    710 <malloc+0x90>
+  if(nu < 4096)
+ 6ac:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 6b1:	39 df                	cmp    %ebx,%edi
+ 6b3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 6b6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 6bd:	eb 0a                	jmp    6c9 <malloc+0x49>
+ 6bf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6c0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6c2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6c5:	39 f9                	cmp    %edi,%ecx
+ 6c7:	73 47                	jae    710 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 6c9:	89 c2                	mov    %eax,%edx
+ 6cb:	39 05 64 0a 00 00    	cmp    %eax,0xa64
+ 6d1:	75 ed                	jne    6c0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 6d3:	83 ec 0c             	sub    $0xc,%esp
+ 6d6:	56                   	push   %esi
+ 6d7:	e8 20 fc ff ff       	call   2fc <sbrk>
+  if(p == (char*)-1)
+ 6dc:	83 c4 10             	add    $0x10,%esp
+ 6df:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 6e2:	74 1c                	je     700 <malloc+0x80>
+  hp->s.size = nu;
+ 6e4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 6e7:	83 ec 0c             	sub    $0xc,%esp
+ 6ea:	83 c0 08             	add    $0x8,%eax
+ 6ed:	50                   	push   %eax
+ 6ee:	e8 fd fe ff ff       	call   5f0 <free>
+  return freep;
+ 6f3:	8b 15 64 0a 00 00    	mov    0xa64,%edx
+      if((p = morecore(nunits)) == 0)
+ 6f9:	83 c4 10             	add    $0x10,%esp
+ 6fc:	85 d2                	test   %edx,%edx
+ 6fe:	75 c0                	jne    6c0 <malloc+0x40>
+        return 0;
+  }
+}
+ 700:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 703:	31 c0                	xor    %eax,%eax
+}
+ 705:	5b                   	pop    %ebx
+ 706:	5e                   	pop    %esi
+ 707:	5f                   	pop    %edi
+ 708:	5d                   	pop    %ebp
+ 709:	c3                   	ret
+ 70a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 710:	39 cf                	cmp    %ecx,%edi
+ 712:	74 4c                	je     760 <malloc+0xe0>
+        p->s.size -= nunits;
+ 714:	29 f9                	sub    %edi,%ecx
+ 716:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 719:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 71c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 71f:	89 15 64 0a 00 00    	mov    %edx,0xa64
+}
+ 725:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 728:	83 c0 08             	add    $0x8,%eax
+}
+ 72b:	5b                   	pop    %ebx
+ 72c:	5e                   	pop    %esi
+ 72d:	5f                   	pop    %edi
+ 72e:	5d                   	pop    %ebp
+ 72f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 730:	c7 05 64 0a 00 00 68 	movl   $0xa68,0xa64
+ 737:	0a 00 00 
+    base.s.size = 0;
+ 73a:	b8 68 0a 00 00       	mov    $0xa68,%eax
+    base.s.ptr = freep = prevp = &base;
+ 73f:	c7 05 68 0a 00 00 68 	movl   $0xa68,0xa68
+ 746:	0a 00 00 
+    base.s.size = 0;
+ 749:	c7 05 6c 0a 00 00 00 	movl   $0x0,0xa6c
+ 750:	00 00 00 
+    if(p->s.size >= nunits){
+ 753:	e9 54 ff ff ff       	jmp    6ac <malloc+0x2c>
+ 758:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 75f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 760:	8b 08                	mov    (%eax),%ecx
+ 762:	89 0a                	mov    %ecx,(%edx)
+ 764:	eb b9                	jmp    71f <malloc+0x9f>